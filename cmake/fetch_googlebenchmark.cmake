@@ -0,0 +1,22 @@
+cmake_minimum_required(VERSION 3.15)
+
+# ---------------------------------------------------------------
+# Use an installed Google Benchmark if available, otherwise fetch it from github
+# ---------------------------------------------------------------
+find_package(benchmark QUIET)
+
+if(NOT benchmark_FOUND)
+    include(FetchContent)
+
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+    FetchContent_Declare(
+    googlebenchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG        v1.7.1
+    )
+    FetchContent_MakeAvailable(googlebenchmark)
+endif()
+# ---------------------------------------------------------------
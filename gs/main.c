@@ -24,12 +24,21 @@ const uint8_t TEMP_STATIC_KEY[AES_KEY_SIZE] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x0
 
 static correct_reed_solomon *rsGs;
 
-static gs_error_code_t decodePacket(packed_ax25_i_frame_t *ax25data, packed_rs_packet_t *rsData);
+// Puts downlinked frames back in order and tracks which ones to ask the OBC to resend
+static ax25_arq_rx_window_t downlinkRxWindow;
+
+static gs_error_code_t decodePacket(const uint8_t *ax25Data, uint16_t ax25DataLen, packed_rs_packet_t *rsData,
+                                    void *pSerialPort);
+
+static void decodeFrameCallback(const uint8_t *frame, uint16_t frameLen, void *userData);
+
+static void deliverDownlinkFrame(const unstuffed_ax25_i_frame_t *frame, void *userData);
+
+static gs_error_code_t answerPoll(void *pSerialPort);
 
 static uint32_t getCurrentTime(void);
 
 int main(void) {
-  gs_error_code_t gsErrCode;
   obc_gs_error_code_t obcGsErrCode;
 
   char demoNum = 0;
@@ -213,54 +222,22 @@ int main(void) {
 
   /* Receive Data */
 
-  uint16_t axDataIndex = 0;
-  packed_ax25_i_frame_t axData = {0};
-  bool startFlagReceived = false;
+  ax25ArqRxInit(&downlinkRxWindow, deliverDownlinkFrame, NULL);
+
+  ax25_deframer_t deframer;
+  ax25DeframerInit(&deframer, decodeFrameCallback, pSerialPort);
 
   while (1) {
-    uint8_t byte = '\0';
-    if (CSerialPortReadData(pSerialPort, &byte, 1) < 0) {
+    uint8_t rxBuffer[AX25_MAXIMUM_PKT_LEN];
+    int bytesRead = CSerialPortReadData(pSerialPort, rxBuffer, sizeof(rxBuffer));
+    if (bytesRead < 0) {
       printf("Error Reading! \r\n");
       break;
     }
 
-    if (axDataIndex >= sizeof(axData.data)) {
-      // Restart the decoding process
-      memset(&axData, 0, sizeof(axData));
-      axDataIndex = 0;
-      startFlagReceived = false;
-    }
-
-    if (byte == AX25_FLAG) {
-      axData.data[axDataIndex++] = byte;
-
-      // Decode packet if we have start flag, end flag, and at least 1 byte of data
-      // During idling, multiple AX25_FLAGs may be sent in a row, so we enforce that
-      // axData.data[1] must be something other than AX25_FLAG
-      if (axDataIndex > 2) {
-        axData.length = axDataIndex;
-
-        packed_rs_packet_t rsData = {0};
-        gsErrCode = decodePacket(&axData, &rsData);
-        if (gsErrCode != GS_ERR_CODE_SUCCESS) {
-          printf("Failed to decode packet!");
-          exit(1);
-        }
-
-        // Restart the decoding process
-        memset(&axData, 0, sizeof(axData));
-        axDataIndex = 0;
-        startFlagReceived = false;
-      } else {
-        startFlagReceived = true;
-        axDataIndex = 1;
-      }
-
-      continue;
-    }
-
-    if (startFlagReceived) {
-      axData.data[axDataIndex++] = byte;
+    // Complete frames are decoded by decodeFrameCallback as the deframer finds them
+    if (ax25DeframerPush(&deframer, rxBuffer, (size_t)bytesRead) != OBC_GS_ERR_CODE_SUCCESS) {
+      printf("Dropped an oversized AX.25 frame!\r\n");
     }
   }
 
@@ -269,12 +246,21 @@ int main(void) {
   CSerialPortFree(pSerialPort);
 }
 
-static gs_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_packet_t *rsData) {
+static void decodeFrameCallback(const uint8_t *frame, uint16_t frameLen, void *userData) {
+  packed_rs_packet_t rsData = {0};
+  // Frames lost to corruption are asked for again when the OBC polls, so carry on with the next one
+  if (decodePacket(frame, frameLen, &rsData, userData) != GS_ERR_CODE_SUCCESS) {
+    printf("Failed to decode packet!\n");
+  }
+}
+
+static gs_error_code_t decodePacket(const uint8_t *ax25Data, uint16_t ax25DataLen, packed_rs_packet_t *rsData,
+                                    void *pSerialPort) {
   obc_gs_error_code_t interfaceErr;
 
   // perform bit unstuffing
   unstuffed_ax25_i_frame_t unstuffedPacket = {0};
-  interfaceErr = ax25Unstuff(ax25Data->data, ax25Data->length, unstuffedPacket.data, &unstuffedPacket.length);
+  interfaceErr = ax25Unstuff(ax25Data, ax25DataLen, unstuffedPacket.data, &unstuffedPacket.length);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
     return GS_ERR_CODE_AX25_DECODE_FAILURE;
   }
@@ -296,15 +282,62 @@ static gs_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_p
   // check for a valid ax25 frame and perform the command response if necessary
   u_frame_cmd_t receivedCmd = {0};
   interfaceErr = ax25Recv(&unstuffedPacket, &receivedCmd);
+  if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
+    return GS_ERR_CODE_CORRUPTED_MSG;
+  }
+
+  // The OBC sends a DISC after each downlink, and numbers the frames of its next one from 0
+  if (receivedCmd != 0) {
+    ax25ArqRxHandleUFrame(&downlinkRxWindow, receivedCmd);
+    return GS_ERR_CODE_SUCCESS;
+  }
 
-  uint8_t decodedData[RS_DECODED_SIZE] = {0};
-  memcpy(decodedData, unstuffedPacket.data + AX25_INFO_FIELD_POSITION, RS_DECODED_SIZE);
+  // The OBC polls once it has sent a window of frames, and waits for the answer before sending more
+  ax25_s_frame_info_t sFrameInfo;
+  if (ax25GetSFrameInfo(&unstuffedPacket, &sFrameInfo) == OBC_GS_ERR_CODE_SUCCESS) {
+    return sFrameInfo.pollFinal ? answerPoll(pSerialPort) : GS_ERR_CODE_SUCCESS;
+  }
 
+  if (unstuffedPacket.length == AX25_MINIMUM_I_FRAME_LEN) {
+    // Printed by deliverDownlinkFrame once every frame before it has arrived
+    if (ax25ArqRxFrame(&downlinkRxWindow, &unstuffedPacket) != OBC_GS_ERR_CODE_SUCCESS) {
+      return GS_ERR_CODE_CORRUPTED_MSG;
+    }
+  }
+
+  return GS_ERR_CODE_SUCCESS;
+}
+
+static void deliverDownlinkFrame(const unstuffed_ax25_i_frame_t *frame, void *userData) {
   printf("Received (and decoded) data: ");
   for (uint8_t i = 0; i < RS_DECODED_SIZE; ++i) {
-    printf("%x ", decodedData[i]);
+    printf("%x ", frame->data[AX25_INFO_FIELD_POSITION + i]);
   }
   printf("\n");
+}
+
+/**
+ * @brief answers a poll from the OBC with an SREJ for every frame still missing, then an RR acknowledging everything
+ * received in order with the final bit set
+ */
+static gs_error_code_t answerPoll(void *pSerialPort) {
+  uint8_t missing[AX25_ARQ_WINDOW_SIZE];
+  uint8_t numMissing = 0;
+  ax25ArqRxMissing(&downlinkRxWindow, missing, &numMissing);
+
+  packed_ax25_s_frame_t sFrame = {0};
+  for (uint8_t i = 0; i < numMissing; ++i) {
+    if (ax25SendSFrame(&sFrame, AX25_S_FRAME_SREJ_CONTROL, missing[i], 0) != OBC_GS_ERR_CODE_SUCCESS) {
+      return GS_ERR_CODE_AX25_DECODE_FAILURE;
+    }
+    CSerialPortWriteData(pSerialPort, sFrame.data, sFrame.length);
+  }
+
+  if (ax25SendSFrame(&sFrame, AX25_S_FRAME_RR_CONTROL, ax25ArqRxNextExpected(&downlinkRxWindow), 1) !=
+      OBC_GS_ERR_CODE_SUCCESS) {
+    return GS_ERR_CODE_AX25_DECODE_FAILURE;
+  }
+  CSerialPortWriteData(pSerialPort, sFrame.data, sFrame.length);
 
   return GS_ERR_CODE_SUCCESS;
 }
@@ -6,11 +6,11 @@
 #include <stdint.h>
 #include <string.h>
 
-// Store the AES context
-static struct AES_ctx ctx;
+// Context used by the functions that don't take one
+static obc_gs_aes_ctx_t defaultAesCtx;
 
 /**
- * @brief Decrypts the AES blocks
+ * @brief Decrypts the AES blocks using the default AES context
  *
  * @param aesData Pointer to an aes_data_t struct that includes a struct of the IV and data
  * @param output array to store the decrypted data
@@ -19,6 +19,25 @@ static struct AES_ctx ctx;
  * @return obc_gs_error_code_t - whether or not the data was successfully decrypted
  */
 obc_gs_error_code_t aes128Decrypt(aes_data_t *aesData, uint8_t *output, uint8_t outputBufferLen) {
+  return aes128DecryptWithCtx(&defaultAesCtx, aesData, output, outputBufferLen);
+}
+
+/**
+ * @brief Decrypts the AES blocks using the given AES context
+ *
+ * @param ctx AES context initialized with aes128InitCtx
+ * @param aesData Pointer to an aes_data_t struct that includes a struct of the IV and data
+ * @param output array to store the decrypted data
+ * @param outputBufferLen length of the buffer to store the decrypted data
+ *
+ * @return obc_gs_error_code_t - whether or not the data was successfully decrypted
+ */
+obc_gs_error_code_t aes128DecryptWithCtx(const obc_gs_aes_ctx_t *ctx, aes_data_t *aesData, uint8_t *output,
+                                         uint8_t outputBufferLen) {
+  if (ctx == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
   if (aesData == NULL) {
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
@@ -31,25 +50,55 @@ obc_gs_error_code_t aes128Decrypt(aes_data_t *aesData, uint8_t *output, uint8_t
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
 
+  // CTR mode advances the IV as it goes, so each call works on its own copy of the context and the shared key
+  // schedule is never written
+  struct AES_ctx callCtx = ctx->aesCtx;
+
   memcpy(output, aesData->ciphertext, aesData->ciphertextLen);
-  AES_ctx_set_iv(&ctx, aesData->iv);
-  AES_CTR_xcrypt_buffer(&ctx, output, aesData->ciphertextLen);
+  AES_ctx_set_iv(&callCtx, aesData->iv);
+  AES_CTR_xcrypt_buffer(&callCtx, output, aesData->ciphertextLen);
 
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
 /**
- * @brief Initializes the AES context
+ * @brief Initializes the default AES context
  *
  * @param key - The key to decrypt the AES blocks with
  * @return obc_gs_error_code_t - whether or not the context was successfully initialized
  */
 obc_gs_error_code_t initializeAesCtx(const uint8_t *key) {
+  return aes128InitCtx(&defaultAesCtx, key);
+}
+
+/**
+ * @brief Initializes an AES context
+ *
+ * @param ctx - The AES context to initialize
+ * @param key - The key to decrypt the AES blocks with
+ * @return obc_gs_error_code_t - whether or not the context was successfully initialized
+ */
+obc_gs_error_code_t aes128InitCtx(obc_gs_aes_ctx_t *ctx, const uint8_t *key) {
+  if (ctx == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
   if (key == NULL) {
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
 
-  AES_init_ctx(&ctx, key);
+  AES_init_ctx(&ctx->aesCtx, key);
 
   return OBC_GS_ERR_CODE_SUCCESS;
 }
+
+/**
+ * @brief Clears the key schedule of an AES context
+ *
+ * @param ctx - The AES context to clear
+ */
+void aes128DestroyCtx(obc_gs_aes_ctx_t *ctx) {
+  if (ctx != NULL) {
+    memset(ctx, 0, sizeof(*ctx));
+  }
+}
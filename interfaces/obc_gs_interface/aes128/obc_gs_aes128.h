@@ -2,6 +2,8 @@
 
 #include "obc_gs_errors.h"
 
+#include <aes.h>
+
 #include <stdint.h>
 #include <stddef.h>
 
@@ -17,7 +19,19 @@ typedef struct {
 } aes_data_t;
 
 /**
- * @brief Decrypts the AES blocks
+ * @brief AES key schedule. It is only written by aes128InitCtx, so one context can be shared by any number of
+ * threads or tasks decrypting at the same time
+ */
+typedef struct {
+  struct AES_ctx aesCtx;
+} obc_gs_aes_ctx_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Decrypts the AES blocks using the default AES context
  *
  * @param aesData Pointer to an aes_data_t struct that includes a struct of the IV and data
  * @param output array to store the decrypted data
@@ -26,8 +40,38 @@ typedef struct {
 obc_gs_error_code_t aes128Decrypt(aes_data_t *aesData, uint8_t *output, uint8_t outputBufferLen);
 
 /**
- * @brief Initializes the AES context
+ * @brief Initializes the default AES context
  *
  * @param key - The key to decrypt the AES blocks with
  */
 obc_gs_error_code_t initializeAesCtx(const uint8_t *key);
+
+/**
+ * @brief Initializes an AES context
+ *
+ * @param ctx - The AES context to initialize
+ * @param key - The key to decrypt the AES blocks with
+ */
+obc_gs_error_code_t aes128InitCtx(obc_gs_aes_ctx_t *ctx, const uint8_t *key);
+
+/**
+ * @brief Clears the key schedule of an AES context
+ *
+ * @param ctx - The AES context to clear
+ */
+void aes128DestroyCtx(obc_gs_aes_ctx_t *ctx);
+
+/**
+ * @brief Decrypts the AES blocks using the given AES context
+ *
+ * @param ctx AES context initialized with aes128InitCtx
+ * @param aesData Pointer to an aes_data_t struct that includes a struct of the IV and data
+ * @param output array to store the decrypted data
+ * @param outputBufferLen length of the buffer to store the decrypted data
+ */
+obc_gs_error_code_t aes128DecryptWithCtx(const obc_gs_aes_ctx_t *ctx, aes_data_t *aesData, uint8_t *output,
+                                         uint8_t outputBufferLen);
+
+#ifdef __cplusplus
+}
+#endif
@@ -11,6 +11,10 @@
 #define POLL_FINAL_BIT_OFFSET 4
 #define POLL_FINAL_BIT_MASK (0x01 << POLL_FINAL_BIT_OFFSET)
 
+/* The two least significant bits of the first control byte are 01 for S frames */
+#define AX25_S_FRAME_TYPE_MASK 0x03U
+#define AX25_S_FRAME_TYPE 0x01U
+
 #define SRC_CALLSIGN "\0\0\0\0\0\0"
 
 #define AX25_ADDRESS_SPACE_BYTE 0x40
@@ -161,7 +165,13 @@ obc_gs_error_code_t ax25SendIFrame(uint8_t *telemData, uint8_t telemDataLen, uns
     return OBC_GS_ERR_CODE_INVALID_ARG;
   }
 
-  memset(ax25Data->data, 0, AX25_MINIMUM_I_FRAME_LEN);
+  // telemData may already be sitting in the info field of ax25Data, so clear around it rather than over it
+  uint8_t *infoField = ax25Data->data + AX25_INFO_FIELD_POSITION;
+  memset(ax25Data->data, 0, AX25_INFO_FIELD_POSITION);
+  if (telemData != infoField) {
+    memcpy(infoField, telemData, telemDataLen);
+  }
+  memset(infoField + telemDataLen, 0, AX25_MINIMUM_I_FRAME_LEN - AX25_INFO_FIELD_POSITION - telemDataLen);
   ax25Data->length = AX25_MINIMUM_I_FRAME_LEN;
 
   ax25Data->data[0] = AX25_FLAG;
@@ -172,7 +182,6 @@ obc_gs_error_code_t ax25SendIFrame(uint8_t *telemData, uint8_t telemDataLen, uns
   ax25Data->data[AX25_CONTROL_BYTES_POSITION] = (pktReceiveNum << 1);
   ax25Data->data[AX25_CONTROL_BYTES_POSITION + 1] = (pktSentNum << 1);
   ax25Data->data[AX25_MOD128_PID_POSITION] = AX25_PID;
-  memcpy(ax25Data->data + AX25_INFO_FIELD_POSITION, telemData, telemDataLen);
 
   uint16_t fcs;
   fcsCalculate(ax25Data->data, AX25_MINIMUM_I_FRAME_LEN, &fcs);
@@ -246,6 +255,78 @@ obc_gs_error_code_t ax25SendUFrame(packed_ax25_u_frame_t *ax25Data, uint8_t cmd,
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
+obc_gs_error_code_t ax25SendSFrame(packed_ax25_s_frame_t *ax25Data, uint8_t sFrameControl, uint8_t receiveSeqNum,
+                                   uint8_t pollFinalBit) {
+  if (ax25Data == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (sFrameControl != AX25_S_FRAME_RR_CONTROL && sFrameControl != AX25_S_FRAME_RNR_CONTROL &&
+      sFrameControl != AX25_S_FRAME_REJ_CONTROL && sFrameControl != AX25_S_FRAME_SREJ_CONTROL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (receiveSeqNum >= AX25_ARQ_MODULUS) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (pollFinalBit > 1) {  // poll bit should be either 1 or 0
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (currentLinkDestAddr.length != AX25_DEST_ADDR_BYTES) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint8_t ax25PacketUnstuffed[AX25_SUPERVISORY_FRAME_LENGTH] = {0};
+
+  ax25PacketUnstuffed[0] = AX25_FLAG;
+
+  memcpy(ax25PacketUnstuffed + AX25_DEST_ADDR_POSITION, currentLinkDestAddr.data, AX25_DEST_ADDR_BYTES);
+
+  uint8_t srcAddress[AX25_SRC_ADDR_BYTES] = SRC_CALLSIGN;
+  memcpy(ax25PacketUnstuffed + AX25_SRC_ADDR_POSITION, srcAddress, AX25_SRC_ADDR_BYTES);
+
+  ax25PacketUnstuffed[AX25_CONTROL_BYTES_POSITION] = sFrameControl;
+  ax25PacketUnstuffed[AX25_CONTROL_BYTES_POSITION + 1] = (uint8_t)(receiveSeqNum << 1) | pollFinalBit;
+  ax25PacketUnstuffed[AX25_MOD128_PID_POSITION] = AX25_PID;
+
+  uint16_t fcs;
+  fcsCalculate(ax25PacketUnstuffed, AX25_SUPERVISORY_FRAME_LENGTH, &fcs);
+
+  ax25PacketUnstuffed[AX25_S_FRAME_FCS_POSITION] = (uint8_t)(fcs >> 8);
+  ax25PacketUnstuffed[AX25_S_FRAME_FCS_POSITION + 1] = (uint8_t)(fcs & 0xFF);
+
+  obc_gs_error_code_t errCode =
+      ax25Stuff(ax25PacketUnstuffed, AX25_SUPERVISORY_FRAME_LENGTH, ax25Data->data, &ax25Data->length);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  ax25Data->data[ax25Data->length - 1] = AX25_FLAG;
+  ax25Data->data[0] = AX25_FLAG;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t ax25GetSFrameInfo(const unstuffed_ax25_i_frame_t *unstuffedPacket,
+                                      ax25_s_frame_info_t *sFrameInfo) {
+  if (unstuffedPacket == NULL || sFrameInfo == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint8_t controlByte = unstuffedPacket->data[AX25_CONTROL_BYTES_POSITION];
+  if ((controlByte & AX25_S_FRAME_TYPE_MASK) != AX25_S_FRAME_TYPE) {
+    return OBC_GS_ERR_CODE_INVALID_AX25_PACKET;
+  }
+
+  sFrameInfo->control = controlByte;
+  sFrameInfo->receiveSeqNum = unstuffedPacket->data[AX25_CONTROL_BYTES_POSITION + 1] >> 1;
+  sFrameInfo->pollFinal = (unstuffedPacket->data[AX25_CONTROL_BYTES_POSITION + 1] & 0x01) != 0;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
 obc_gs_error_code_t ax25Recv(unstuffed_ax25_i_frame_t *unstuffedPacket, u_frame_cmd_t *command) {
   if (unstuffedPacket == NULL) {
     return OBC_GS_ERR_CODE_INVALID_ARG;
@@ -284,52 +365,6 @@ obc_gs_error_code_t ax25Recv(unstuffed_ax25_i_frame_t *unstuffedPacket, u_frame_
   return errCode;
 }
 
-obc_gs_error_code_t ax25Unstuff(uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
-                                uint16_t *unstuffedPacketLen) {
-  uint8_t bitCount = 0;
-  uint8_t stuffingFlag = 0;
-  uint16_t unstuffedBitLength = 0;  // count as bits
-
-  // Set the first flag
-  unstuffedPacket[0] = AX25_FLAG;
-  unstuffedBitLength += 8;
-
-  // loop from second byte to second last byte since first and last are the flags
-  for (uint16_t stuffedPacketIndex = 1; stuffedPacketIndex < packetLen - 1; ++stuffedPacketIndex) {
-    uint8_t current_byte = packet[stuffedPacketIndex];
-
-    for (uint8_t offset = 0; offset < 8; ++offset) {
-      uint8_t bit = (current_byte >> (7 - offset)) & 0x01;
-
-      if (stuffingFlag) {
-        bitCount = 0;
-        stuffingFlag = 0;
-        continue;  // Skip adding the stuffed bit
-      }
-
-      if (bit == 1) {
-        bitCount++;
-        if (bitCount == 5) {
-          bitCount = 0;
-          stuffingFlag = 1;
-        }
-      } else {
-        bitCount = 0;
-      }
-      unstuffedPacket[unstuffedBitLength / 8] |= bit << (7 - (unstuffedBitLength % 8));
-      unstuffedBitLength++;
-    }
-  }
-  // Add last flag to end of the packet, rounding up
-  unstuffedPacket[(unstuffedBitLength + 7) / 8] = AX25_FLAG;
-  unstuffedBitLength += 8;
-
-  // convert bits to bytes
-  *unstuffedPacketLen = unstuffedBitLength / 8;
-
-  return OBC_GS_ERR_CODE_SUCCESS;
-}
-
 static obc_gs_error_code_t sFrameRecv(unstuffed_ax25_i_frame_t *unstuffedPacket) {
   if (memcmp(unstuffedPacket->data + AX25_SRC_ADDR_POSITION, currentLinkDestAddr.data, AX25_SRC_ADDR_BYTES) != 0) {
     return OBC_GS_ERR_CODE_INVALID_TNC;
@@ -337,18 +372,15 @@ static obc_gs_error_code_t sFrameRecv(unstuffed_ax25_i_frame_t *unstuffedPacket)
   if (unstuffedPacket->data[AX25_MOD128_PID_POSITION] != AX25_PID) {
     return OBC_GS_ERR_CODE_INVALID_AX25_PACKET;
   }
-  uint8_t controlBytes[AX25_MOD128_CONTROL_BYTES] = {unstuffedPacket->data[AX25_ADDRESS_BYTES + 1],
-                                                     unstuffedPacket->data[AX25_ADDRESS_BYTES + 2]};
-
-  if (controlBytes[0] == AX25_S_FRAME_RR_CONTROL) {
-    /* TODO: implement response for receieve ready S frame*/
-  } else if (controlBytes[0] == AX25_S_FRAME_RNR_CONTROL) {
-    /* TODO: implement response for receieve not ready S frame*/
-  } else if (controlBytes[0] == AX25_S_FRAME_REJ_CONTROL) {
-    /* TODO: implement response for rejected S frame*/
-  } else if (controlBytes[0] == AX25_S_FRAME_SREJ_CONTROL) {
-    /* TODO: implement response for selective reject S frame*/
-  } else {
+  if (unstuffedPacket->length != AX25_SUPERVISORY_FRAME_LENGTH) {
+    return OBC_GS_ERR_CODE_INVALID_AX25_PACKET;
+  }
+
+  // Acknowledgements and retransmission requests are acted on by the ARQ window of the link (see
+  // obc_gs_ax25_arq.c) after reading them with ax25GetSFrameInfo, so they are only validated here
+  uint8_t controlByte = unstuffedPacket->data[AX25_CONTROL_BYTES_POSITION];
+  if (controlByte != AX25_S_FRAME_RR_CONTROL && controlByte != AX25_S_FRAME_RNR_CONTROL &&
+      controlByte != AX25_S_FRAME_REJ_CONTROL && controlByte != AX25_S_FRAME_SREJ_CONTROL) {
     return OBC_GS_ERR_CODE_INVALID_AX25_PACKET;
   }
 
@@ -450,36 +482,6 @@ static obc_gs_error_code_t fcsCheck(const uint8_t *data, uint16_t dataLen, uint1
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
-obc_gs_error_code_t ax25Stuff(uint8_t *rawData, uint16_t rawDataLen, uint8_t *stuffedData, uint16_t *stuffedDataLen) {
-  if (rawData == NULL || stuffedData == NULL || stuffedDataLen == NULL) {
-    return OBC_GS_ERR_CODE_INVALID_ARG;
-  }
-
-  uint16_t rawOffset = 0, stuffedOffset = 8, oneCount = 0;
-  uint8_t currentBit;
-
-  // Cycle through raw data to find 1s
-  for (rawOffset = 8; rawOffset < (rawDataLen - 1) * 8; ++rawOffset) {
-    currentBit = (rawData[rawOffset / 8] >> (7 - (rawOffset % 8))) & 1;
-    stuffedData[stuffedOffset / 8] |= (currentBit << (7 - (stuffedOffset % 8)));
-    stuffedOffset++;
-
-    if (currentBit == 1) {
-      oneCount++;
-      if (oneCount == 5) {
-        oneCount = 0;
-        stuffedData[stuffedOffset / 8] |= 0;
-        stuffedOffset++;
-      }
-    } else {
-      oneCount = 0;
-    }
-  }
-
-  *stuffedDataLen = ((stuffedOffset + 7) / 8) + 1;
-  return OBC_GS_ERR_CODE_SUCCESS;
-}
-
 obc_gs_error_code_t ax25GetDestAddress(ax25_addr_t *address, uint8_t callSign[], uint8_t callSignLength, uint8_t ssid,
                                        uint8_t controlBit) {
   if (address == NULL) {
@@ -566,6 +568,8 @@ void setCurrentLinkDestAddress(ax25_addr_t *destAddress) {
 
 void clearCurrentLinkDestAddress(void) { memset(&currentLinkDestAddr, 0, sizeof(ax25_addr_t)); }
 
+void ax25ResetSendSequenceNumber(void) { pktSentNum = 0; }
+
 static inline uint16_t reverseUint16(uint16_t numToReverse) {
   uint16_t reverseNum = 0;
   for (uint8_t i = 0; i < sizeof(numToReverse) * 8; i++) {
@@ -3,6 +3,8 @@
 #include "obc_gs_errors.h"
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
 
 #define AX25_START_FLAG_BYTES 1
 #define AX25_END_FLAG_BYTES 1
@@ -63,6 +65,15 @@ is (8*x)/5. As a result, the maximum number of bytes in a frame is [(8*x) + (8*x
 
 #define MAX_U_FRAME_CMD_VALUE 3
 
+/* S frames carry no info field, so only the address, control, PID and FCS bytes can have bits stuffed into them */
+#define AX25_MAXIMUM_S_FRAME_LENGTH (AX25_SUPERVISORY_FRAME_LENGTH * 6 / 5 + 1)
+
+/* Sequence numbers of our I and S frames are 7 bits wide */
+#define AX25_ARQ_MODULUS 128U
+/* Number of I frames that can be sent before an acknowledgement is needed. For selective repeat this must not be more
+   than half of AX25_ARQ_MODULUS, otherwise a retransmission can't be told apart from a new frame */
+#define AX25_ARQ_WINDOW_SIZE 8U
+
 #define CALL_SIGN_BYTES 6
 
 typedef struct {
@@ -80,13 +91,70 @@ typedef struct {
   uint8_t length;
 } packed_ax25_u_frame_t;
 
+typedef struct {
+  uint8_t data[AX25_MAXIMUM_S_FRAME_LENGTH];
+  uint16_t length;
+} packed_ax25_s_frame_t;
+
 typedef struct {
   uint8_t data[AX25_DEST_ADDR_BYTES];
   uint8_t length;
 } ax25_addr_t;
 
+typedef struct {
+  uint8_t control;        // One of the AX25_S_FRAME_*_CONTROL values
+  uint8_t receiveSeqNum;  // N(R), the sequence number of the next I frame the sender of the S frame expects
+  bool pollFinal;
+} ax25_s_frame_info_t;
+
 typedef enum { U_FRAME_CMD_CONN = 1, U_FRAME_CMD_DISC = 2, U_FRAME_CMD_ACK = 3 } u_frame_cmd_t;
 
+/**
+ * @brief called by the deframer for every complete stuffed frame found in the received stream
+ *
+ * @param frame the stuffed frame, including the opening and closing flags. Only valid for the duration of the call
+ * @param frameLen number of bytes in frame
+ * @param userData the pointer given to ax25DeframerInit
+ */
+typedef void (*ax25_deframer_callback_t)(const uint8_t *frame, uint16_t frameLen, void *userData);
+
+typedef struct {
+  packed_ax25_i_frame_t partialFrame;  // Holds a frame that started in an earlier call, from its opening flag onward
+  bool inFrame;                        // Whether an opening flag has been seen and partialFrame is being filled
+  ax25_deframer_callback_t callback;
+  void *userData;
+} ax25_deframer_t;
+
+/**
+ * @brief sending side of a selective repeat ARQ link; keeps every stuffed I frame until it has been acknowledged
+ */
+typedef struct {
+  packed_ax25_i_frame_t frames[AX25_ARQ_WINDOW_SIZE];  // Indexed by sequence number modulo AX25_ARQ_WINDOW_SIZE
+  bool retransmit[AX25_ARQ_WINDOW_SIZE];               // Whether the matching entry of frames needs to be resent
+  uint8_t ackSeqNum;                                   // V(A), the oldest sequence number not yet acknowledged
+  uint8_t sendSeqNum;                                  // V(S), the sequence number of the next frame to be stored
+  bool gapReported;                                    // Whether an SREJ was received since the last poll
+} ax25_arq_tx_window_t;
+
+/**
+ * @brief called by the receive window for every I frame, in sequence number order and exactly once each
+ *
+ * @param frame the unstuffed I frame. Only valid for the duration of the call
+ * @param userData the pointer given to ax25ArqRxInit
+ */
+typedef void (*ax25_arq_deliver_callback_t)(const unstuffed_ax25_i_frame_t *frame, void *userData);
+
+/**
+ * @brief receiving side of a selective repeat ARQ link; holds frames received out of order until the gaps are filled
+ */
+typedef struct {
+  unstuffed_ax25_i_frame_t frames[AX25_ARQ_WINDOW_SIZE];  // Indexed by sequence number modulo AX25_ARQ_WINDOW_SIZE
+  bool received[AX25_ARQ_WINDOW_SIZE];                    // Whether the matching entry of frames is waiting delivery
+  uint8_t receiveSeqNum;                                  // V(R), the sequence number of the next frame to deliver
+  ax25_arq_deliver_callback_t deliver;
+  void *userData;
+} ax25_arq_rx_window_t;
+
 extern ax25_addr_t cubesatCallsign;
 extern ax25_addr_t groundStationCallsign;
 
@@ -112,6 +180,15 @@ static inline uint32_t ax25StuffedWithFlagShareLen(uint32_t infoBytesLen) {
   return (((infoBytesLen + AX25_INFO_BYTES - 1) / AX25_INFO_BYTES) * (AX25_MAXIMUM_PKT_LEN - 1)) + 1;
 }
 
+/**
+ * @brief returns the send sequence number N(S) of an unstuffed I frame
+ *
+ * @param unstuffedPacket the unstuffed I frame
+ */
+static inline uint8_t ax25GetIFrameSendSeqNum(const unstuffed_ax25_i_frame_t *unstuffedPacket) {
+  return (uint8_t)(unstuffedPacket->data[AX25_CONTROL_BYTES_POSITION + 1] >> 1);
+}
+
 /**
  * @brief prepares ax25data with appropriate number of I frames when utilizing flag-sharing
  *
@@ -127,6 +204,9 @@ obc_gs_error_code_t ax25SendIFrameWithFlagSharing(uint8_t *telemData, uint32_t t
 /**
  * @brief adds ax.25 headers onto telemetry being downlinked and stores the length of the packet in az25Data->length
  *
+ * @note telemData may point at the info field of ax25Data (ax25Data->data + AX25_INFO_FIELD_POSITION) to frame data
+ * that was written there in place. The rest of the info field is cleared either way
+ *
  * @param telemData data to send that needs ax.25 headers added onto it
  * @param telemDataLen length of the telemData array
  * @param ax25Data array to store the ax.25 frame
@@ -144,6 +224,31 @@ obc_gs_error_code_t ax25SendIFrame(uint8_t *telemData, uint8_t telemDataLen, uns
  */
 obc_gs_error_code_t ax25SendUFrame(packed_ax25_u_frame_t *ax25Data, uint8_t cmd, uint8_t pollFinalBit);
 
+/**
+ * @brief format a buffer into an S frame (RR, RNR, REJ or SREJ) and bit stuff it
+ *
+ * @param ax25Data buffer to store the S frame to be sent
+ * @param sFrameControl one of the AX25_S_FRAME_*_CONTROL values
+ * @param receiveSeqNum N(R); the next expected sequence number for RR/RNR/REJ, or the missing frame for SREJ
+ * @param pollFinalBit what to set the poll/final bit to in the S frame (either 1 or 0)
+ *
+ * @return obc_gs_error_code_t - whether or not the buffer was correctly formatted
+ */
+obc_gs_error_code_t ax25SendSFrame(packed_ax25_s_frame_t *ax25Data, uint8_t sFrameControl, uint8_t receiveSeqNum,
+                                   uint8_t pollFinalBit);
+
+/**
+ * @brief reads the type, N(R) and poll/final bit out of a received S frame
+ *
+ * @note the frame should already have been checked by ax25Recv
+ *
+ * @param unstuffedPacket the received unstuffed ax.25 frame
+ * @param sFrameInfo buffer to store the contents of the S frame
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_AX25_PACKET if the frame is not an S frame
+ */
+obc_gs_error_code_t ax25GetSFrameInfo(const unstuffed_ax25_i_frame_t *unstuffedPacket, ax25_s_frame_info_t *sFrameInfo);
+
 /**
  * @brief checks for a valid ax25 frame and performs command handling if necessary
  *
@@ -156,16 +261,20 @@ obc_gs_error_code_t ax25Recv(unstuffed_ax25_i_frame_t *unstuffedPacket, u_frame_
 /**
  * @brief performs bit unstuffing on a receive ax.25 packet
  *
+ * @note the unstuffing is table driven and processes a whole byte per lookup
+ *
  * @param packet pointer to a buffer with the received stuffed ax.25 data
  * @param packetLen length of the packetLen buffer
  * @param unstuffedPacket pointer to a buffer to hold the unstuffed ax.25 packet
  * @param unstuffedPacketLen stores the number of bytes written to unstuffedPacket
  */
-obc_gs_error_code_t ax25Unstuff(uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+obc_gs_error_code_t ax25Unstuff(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
                                 uint16_t *unstuffedPacketLen);
 
 /**
- * @brief performs bit unstuffing on a receive ax.25 packet
+ * @brief performs bit stuffing on an ax.25 frame; the first and last bytes (flags) are left for the caller to fill in
+ *
+ * @note the stuffing is table driven and processes a whole byte per lookup
  *
  * @param rawData unstuffed data buffer
  * @param rawDataLen length of the rawData buffer
@@ -214,6 +323,165 @@ void setCurrentLinkDestAddress(ax25_addr_t *destAddress);
  */
 void clearCurrentLinkDestAddress(void);
 
+/**
+ * @brief resets the send sequence number so the next I frame sent is numbered 0
+ *
+ * @note the receive sequence number belongs to whoever decodes received I frames, and is only reset when a link is set
+ * up or acknowledged
+ */
+void ax25ResetSendSequenceNumber(void);
+
+/**
+ * @brief sets up a deframer to split a continuous stream of received bytes into stuffed ax.25 frames
+ *
+ * @param deframer the deframer to set up
+ * @param callback called with every complete frame found by ax25DeframerPush
+ * @param userData passed through to callback
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if deframer or callback is NULL
+ */
+obc_gs_error_code_t ax25DeframerInit(ax25_deframer_t *deframer, ax25_deframer_callback_t callback, void *userData);
+
+/**
+ * @brief drops any partially received frame so the deframer waits for a new opening flag
+ *
+ * @param deframer the deframer to reset
+ */
+void ax25DeframerReset(ax25_deframer_t *deframer);
+
+/**
+ * @brief feeds received bytes to the deframer, calling the deframer callback for every frame completed by them
+ *
+ * @note data may be split anywhere, frames are carried over between calls. Frames that lie entirely within data are
+ * passed to the callback straight out of data; only a frame that spans calls is buffered. The closing flag of a frame
+ * also opens the next one, and runs of idle flags are skipped
+ *
+ * @param deframer the deframer to feed
+ * @param data the received bytes
+ * @param dataLen number of bytes in data
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_BUFF_TOO_SMALL if a frame longer than AX25_MAXIMUM_PKT_LEN was dropped,
+ * after the rest of data has still been processed
+ */
+obc_gs_error_code_t ax25DeframerPush(ax25_deframer_t *deframer, const uint8_t *data, size_t dataLen);
+
+/**
+ * @brief empties a transmit window; the next frame stored must be numbered 0
+ *
+ * @param window the transmit window to reset
+ */
+void ax25ArqTxReset(ax25_arq_tx_window_t *window);
+
+/**
+ * @brief returns the number of frames in the transmit window that have been stored but not yet acknowledged
+ *
+ * @param window the transmit window
+ */
+uint8_t ax25ArqTxOutstanding(const ax25_arq_tx_window_t *window);
+
+/**
+ * @brief keeps a copy of a stuffed I frame that is about to be sent until it is acknowledged
+ *
+ * @param window the transmit window
+ * @param frame the stuffed I frame
+ * @param sendSeqNum N(S) of the frame, which must be the window's V(S)
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_BUFF_TOO_SMALL if AX25_ARQ_WINDOW_SIZE frames are already outstanding,
+ * OBC_GS_ERR_CODE_INVALID_ARG if the frame is out of sequence
+ */
+obc_gs_error_code_t ax25ArqTxStore(ax25_arq_tx_window_t *window, const packed_ax25_i_frame_t *frame,
+                                   uint8_t sendSeqNum);
+
+/**
+ * @brief forgets the answers to earlier polls; to be called whenever a poll is sent
+ *
+ * @note Without this, an SREJ whose final RR was lost would stop the next final RR from resending lost frames
+ *
+ * @param window the transmit window
+ */
+void ax25ArqTxStartCheckpoint(ax25_arq_tx_window_t *window);
+
+/**
+ * @brief acts on an S frame received from the other end of the link
+ *
+ * @note RR, RNR and REJ acknowledge every frame before N(R). REJ also marks everything still outstanding for
+ * retransmission, as does a final RR if no SREJ came before it. SREJ marks just frame N(R), and is ignored if that
+ * frame is not outstanding. Marked frames are collected with ax25ArqTxNextRetransmission
+ *
+ * @param window the transmit window
+ * @param sFrameInfo the contents of the S frame, from ax25GetSFrameInfo
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if N(R) of an acknowledgement is not between V(A) and V(S)
+ */
+obc_gs_error_code_t ax25ArqTxHandleSFrame(ax25_arq_tx_window_t *window, const ax25_s_frame_info_t *sFrameInfo);
+
+/**
+ * @brief takes the oldest outstanding frame marked for retransmission by ax25ArqTxHandleSFrame and clears its mark
+ *
+ * @param window the transmit window
+ * @param frame set to the stored frame, which stays valid until it is acknowledged
+ *
+ * @return bool - false once no more frames need to be resent
+ */
+bool ax25ArqTxNextRetransmission(ax25_arq_tx_window_t *window, const packed_ax25_i_frame_t **frame);
+
+/**
+ * @brief sets up an empty receive window expecting frame 0 next
+ *
+ * @param window the receive window to set up
+ * @param deliver called with every frame once all frames before it have been delivered
+ * @param userData passed through to deliver
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG if window or deliver is NULL
+ */
+obc_gs_error_code_t ax25ArqRxInit(ax25_arq_rx_window_t *window, ax25_arq_deliver_callback_t deliver, void *userData);
+
+/**
+ * @brief empties the receive window and expects frame 0 next if a received U frame set up or took down the link
+ *
+ * @note the OBC ends every downlink with a DISC and numbers the frames of the next one from 0, so without this the
+ * frames of every downlink after the first would be dropped as duplicates
+ *
+ * @param window the receive window
+ * @param command the command ax25Recv read from the U frame
+ */
+void ax25ArqRxHandleUFrame(ax25_arq_rx_window_t *window, u_frame_cmd_t command);
+
+/**
+ * @brief hands a received I frame (already checked by ax25Recv) to the receive window
+ *
+ * @note an in sequence frame is delivered straight away along with any buffered frames that follow it. Frames ahead of
+ * V(R) are buffered, and duplicates of frames that were already delivered or buffered are dropped
+ *
+ * @param window the receive window
+ * @param unstuffedPacket the received unstuffed I frame
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_AX25_PACKET if the frame is too far ahead of V(R) to buffer
+ */
+obc_gs_error_code_t ax25ArqRxFrame(ax25_arq_rx_window_t *window, const unstuffed_ax25_i_frame_t *unstuffedPacket);
+
+/**
+ * @brief returns V(R), the N(R) to acknowledge with in an RR or REJ
+ *
+ * @param window the receive window
+ */
+uint8_t ax25ArqRxNextExpected(const ax25_arq_rx_window_t *window);
+
+/**
+ * @brief lists the sequence numbers in the receive window that have not been received, to be requested with SREJs
+ *
+ * @note nothing is listed unless a frame is buffered past a gap. Then the whole window is listed, since frames lost
+ * after the last one received leave nothing to reveal them; the sender ignores SREJs for frames it has not sent. With
+ * nothing listed, any frames the sender still has outstanding after the RR were all lost and can simply be resent
+ *
+ * @param window the receive window
+ * @param missingSeqNums buffer of at least AX25_ARQ_WINDOW_SIZE entries to store the missing sequence numbers in
+ * @param numMissing set to the number of entries written to missingSeqNums
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_INVALID_ARG on NULL arguments
+ */
+obc_gs_error_code_t ax25ArqRxMissing(const ax25_arq_rx_window_t *window, uint8_t *missingSeqNums, uint8_t *numMissing);
+
 #ifdef __cplusplus
 }
 #endif
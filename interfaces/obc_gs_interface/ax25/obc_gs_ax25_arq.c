@@ -0,0 +1,282 @@
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Selective repeat ARQ over AX.25 I frames.
+ *
+ * The link is half-duplex, so acknowledgements are exchanged at checkpoints rather than continuously. The sender
+ * transmits up to AX25_ARQ_WINDOW_SIZE I frames and then polls with an RR that has the P bit set. The receiver answers
+ * with an SREJ for each frame it is missing (see ax25ArqRxMissing) followed by RR(V(R)) with the F bit set. The sender
+ * treats the RR as a cumulative acknowledgement and resends only the SREJ'd frames; if the receiver reported no gaps
+ * since the poll (see ax25ArqTxStartCheckpoint), everything still outstanding after the RR was lost and is resent.
+ * A REJ acknowledges up to N(R) and asks for everything after it, which is what a go-back-N receiver would send.
+ *
+ * Sequence numbers are modulo AX25_ARQ_MODULUS and frames are stored in a window slot chosen by sequence number modulo
+ * AX25_ARQ_WINDOW_SIZE. Since the window is at most half the sequence space, a sequence number within the window never
+ * aliases one that was delivered before it.
+ */
+
+#define SEQ_NUM_MASK (AX25_ARQ_MODULUS - 1U)
+#define WINDOW_SLOT(seqNum) ((seqNum) % AX25_ARQ_WINDOW_SIZE)
+
+/**
+ * @brief returns how far seqNum is ahead of base, modulo AX25_ARQ_MODULUS
+ */
+static inline uint8_t seqNumDistance(uint8_t base, uint8_t seqNum) { return (uint8_t)((seqNum - base) & SEQ_NUM_MASK); }
+
+void ax25ArqTxReset(ax25_arq_tx_window_t *window) {
+  if (window == NULL) {
+    return;
+  }
+
+  // Stale frames are never read since only slots between V(A) and V(S) are outstanding
+  memset(window->retransmit, 0, sizeof(window->retransmit));
+  window->ackSeqNum = 0;
+  window->sendSeqNum = 0;
+  window->gapReported = false;
+}
+
+uint8_t ax25ArqTxOutstanding(const ax25_arq_tx_window_t *window) {
+  if (window == NULL) {
+    return 0;
+  }
+
+  return seqNumDistance(window->ackSeqNum, window->sendSeqNum);
+}
+
+obc_gs_error_code_t ax25ArqTxStore(ax25_arq_tx_window_t *window, const packed_ax25_i_frame_t *frame,
+                                   uint8_t sendSeqNum) {
+  if (window == NULL || frame == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (frame->length > AX25_MAXIMUM_PKT_LEN) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (sendSeqNum != window->sendSeqNum) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (ax25ArqTxOutstanding(window) >= AX25_ARQ_WINDOW_SIZE) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  packed_ax25_i_frame_t *slot = &window->frames[WINDOW_SLOT(sendSeqNum)];
+  memcpy(slot->data, frame->data, frame->length);
+  slot->length = frame->length;
+  window->retransmit[WINDOW_SLOT(sendSeqNum)] = false;
+
+  window->sendSeqNum = (sendSeqNum + 1) & SEQ_NUM_MASK;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+void ax25ArqTxStartCheckpoint(ax25_arq_tx_window_t *window) {
+  if (window == NULL) {
+    return;
+  }
+
+  window->gapReported = false;
+}
+
+/**
+ * @brief acknowledges every outstanding frame numbered before receiveSeqNum
+ */
+static obc_gs_error_code_t ackFrames(ax25_arq_tx_window_t *window, uint8_t receiveSeqNum) {
+  // N(R) can acknowledge anything from nothing (V(A)) up to every frame sent (V(S))
+  if (seqNumDistance(window->ackSeqNum, receiveSeqNum) > ax25ArqTxOutstanding(window)) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  while (window->ackSeqNum != receiveSeqNum) {
+    window->retransmit[WINDOW_SLOT(window->ackSeqNum)] = false;
+    window->ackSeqNum = (window->ackSeqNum + 1) & SEQ_NUM_MASK;
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief marks every outstanding frame for retransmission
+ */
+static void retransmitOutstanding(ax25_arq_tx_window_t *window) {
+  for (uint8_t seqNum = window->ackSeqNum; seqNum != window->sendSeqNum; seqNum = (seqNum + 1) & SEQ_NUM_MASK) {
+    window->retransmit[WINDOW_SLOT(seqNum)] = true;
+  }
+}
+
+obc_gs_error_code_t ax25ArqTxHandleSFrame(ax25_arq_tx_window_t *window, const ax25_s_frame_info_t *sFrameInfo) {
+  if (window == NULL || sFrameInfo == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint8_t receiveSeqNum = sFrameInfo->receiveSeqNum & SEQ_NUM_MASK;
+  obc_gs_error_code_t errCode;
+
+  switch (sFrameInfo->control) {
+    case AX25_S_FRAME_RR_CONTROL:
+      errCode = ackFrames(window, receiveSeqNum);
+      if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+        return errCode;
+      }
+      if (sFrameInfo->pollFinal) {
+        // With no gaps reported, the receiver has nothing past N(R), so whatever is still outstanding was lost
+        if (!window->gapReported) {
+          retransmitOutstanding(window);
+        }
+        window->gapReported = false;
+      }
+      return OBC_GS_ERR_CODE_SUCCESS;
+    case AX25_S_FRAME_RNR_CONTROL:
+      // The receiver is busy, hold off on retransmitting until it polls ready again
+      if (sFrameInfo->pollFinal) {
+        window->gapReported = false;
+      }
+      return ackFrames(window, receiveSeqNum);
+    case AX25_S_FRAME_REJ_CONTROL:
+      errCode = ackFrames(window, receiveSeqNum);
+      if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+        return errCode;
+      }
+      retransmitOutstanding(window);
+      if (sFrameInfo->pollFinal) {
+        window->gapReported = false;
+      }
+      return OBC_GS_ERR_CODE_SUCCESS;
+    case AX25_S_FRAME_SREJ_CONTROL:
+      // SREJs cover the receiver's whole window, which can run past the frames that were actually sent
+      if (seqNumDistance(window->ackSeqNum, receiveSeqNum) < ax25ArqTxOutstanding(window)) {
+        window->retransmit[WINDOW_SLOT(receiveSeqNum)] = true;
+        window->gapReported = true;
+      }
+      return OBC_GS_ERR_CODE_SUCCESS;
+    default:
+      return OBC_GS_ERR_CODE_INVALID_AX25_PACKET;
+  }
+}
+
+bool ax25ArqTxNextRetransmission(ax25_arq_tx_window_t *window, const packed_ax25_i_frame_t **frame) {
+  if (window == NULL || frame == NULL) {
+    return false;
+  }
+
+  for (uint8_t seqNum = window->ackSeqNum; seqNum != window->sendSeqNum; seqNum = (seqNum + 1) & SEQ_NUM_MASK) {
+    uint8_t slot = WINDOW_SLOT(seqNum);
+    if (window->retransmit[slot]) {
+      window->retransmit[slot] = false;
+      *frame = &window->frames[slot];
+      return true;
+    }
+  }
+
+  return false;
+}
+
+obc_gs_error_code_t ax25ArqRxInit(ax25_arq_rx_window_t *window, ax25_arq_deliver_callback_t deliver, void *userData) {
+  if (window == NULL || deliver == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  memset(window->received, 0, sizeof(window->received));
+  window->receiveSeqNum = 0;
+  window->deliver = deliver;
+  window->userData = userData;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+void ax25ArqRxHandleUFrame(ax25_arq_rx_window_t *window, u_frame_cmd_t command) {
+  if (window == NULL) {
+    return;
+  }
+
+  // The sender numbers its I frames from 0 again after setting up or taking down the link, so whatever this window was
+  // waiting for won't come
+  if (command == U_FRAME_CMD_CONN || command == U_FRAME_CMD_DISC) {
+    memset(window->received, 0, sizeof(window->received));
+    window->receiveSeqNum = 0;
+  }
+}
+
+obc_gs_error_code_t ax25ArqRxFrame(ax25_arq_rx_window_t *window, const unstuffed_ax25_i_frame_t *unstuffedPacket) {
+  if (window == NULL || unstuffedPacket == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (unstuffedPacket->length > AX25_MINIMUM_I_FRAME_LEN) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint8_t sendSeqNum = ax25GetIFrameSendSeqNum(unstuffedPacket) & SEQ_NUM_MASK;
+  uint8_t distance = seqNumDistance(window->receiveSeqNum, sendSeqNum);
+
+  if (distance >= AX25_ARQ_WINDOW_SIZE) {
+    // A retransmission of a frame that was already delivered, sent because its acknowledgement was lost
+    if (distance >= AX25_ARQ_MODULUS - AX25_ARQ_WINDOW_SIZE) {
+      return OBC_GS_ERR_CODE_SUCCESS;
+    }
+    return OBC_GS_ERR_CODE_INVALID_AX25_PACKET;
+  }
+
+  if (distance != 0) {
+    uint8_t slot = WINDOW_SLOT(sendSeqNum);
+    if (!window->received[slot]) {
+      memcpy(window->frames[slot].data, unstuffedPacket->data, unstuffedPacket->length);
+      window->frames[slot].length = unstuffedPacket->length;
+      window->received[slot] = true;
+    }
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  // In sequence, so deliver it without buffering and then release whatever it was holding up
+  window->deliver(unstuffedPacket, window->userData);
+  window->receiveSeqNum = (window->receiveSeqNum + 1) & SEQ_NUM_MASK;
+
+  uint8_t slot = WINDOW_SLOT(window->receiveSeqNum);
+  while (window->received[slot]) {
+    window->received[slot] = false;
+    window->deliver(&window->frames[slot], window->userData);
+    window->receiveSeqNum = (window->receiveSeqNum + 1) & SEQ_NUM_MASK;
+    slot = WINDOW_SLOT(window->receiveSeqNum);
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+uint8_t ax25ArqRxNextExpected(const ax25_arq_rx_window_t *window) {
+  if (window == NULL) {
+    return 0;
+  }
+
+  return window->receiveSeqNum;
+}
+
+obc_gs_error_code_t ax25ArqRxMissing(const ax25_arq_rx_window_t *window, uint8_t *missingSeqNums, uint8_t *numMissing) {
+  if (window == NULL || missingSeqNums == NULL || numMissing == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  *numMissing = 0;
+
+  bool anyBuffered = false;
+  for (uint8_t i = 0; i < AX25_ARQ_WINDOW_SIZE; ++i) {
+    anyBuffered |= window->received[i];
+  }
+  if (!anyBuffered) {
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  for (uint8_t i = 0; i < AX25_ARQ_WINDOW_SIZE; ++i) {
+    uint8_t seqNum = (window->receiveSeqNum + i) & SEQ_NUM_MASK;
+    if (!window->received[WINDOW_SLOT(seqNum)]) {
+      missingSeqNums[(*numMissing)++] = seqNum;
+    }
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
@@ -0,0 +1,122 @@
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Incremental AX.25 deframer.
+ *
+ * Received bytes arrive in spans of any length. Flags are located with memchr rather than by testing each byte, and a
+ * frame whose opening and closing flags are both in the current span is handed to the callback in place. Only the
+ * tail of a span that ends mid-frame is copied into the deframer, to be completed by a later span.
+ *
+ * A frame is at least 3 bytes long (flag, data, flag), so back-to-back flags sent while idling are skipped. The closing
+ * flag of a frame is also treated as the opening flag of the next, which allows senders to share flags between frames.
+ */
+
+#define AX25_DEFRAMER_MIN_FRAME_LEN 3U
+
+obc_gs_error_code_t ax25DeframerInit(ax25_deframer_t *deframer, ax25_deframer_callback_t callback, void *userData) {
+  if (deframer == NULL || callback == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  deframer->callback = callback;
+  deframer->userData = userData;
+  ax25DeframerReset(deframer);
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+void ax25DeframerReset(ax25_deframer_t *deframer) {
+  if (deframer == NULL) {
+    return;
+  }
+
+  // Only the length needs resetting, stale bytes past it are never read
+  deframer->partialFrame.length = 0;
+  deframer->inFrame = false;
+}
+
+obc_gs_error_code_t ax25DeframerPush(ax25_deframer_t *deframer, const uint8_t *data, size_t dataLen) {
+  if (deframer == NULL || deframer->callback == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (dataLen == 0) {
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  if (data == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  packed_ax25_i_frame_t *partialFrame = &deframer->partialFrame;
+  obc_gs_error_code_t errCode = OBC_GS_ERR_CODE_SUCCESS;
+
+  const uint8_t *pos = data;
+  const uint8_t *end = data + dataLen;
+  const uint8_t *frameStart = NULL;  // Opening flag of the current frame if it is in data, otherwise it's buffered
+
+  while (pos < end) {
+    const uint8_t *flag = memchr(pos, AX25_FLAG, (size_t)(end - pos));
+    if (flag == NULL) {
+      break;
+    }
+
+    if (deframer->inFrame) {
+      const uint8_t *frame;
+      size_t frameLen;
+
+      if (frameStart != NULL) {
+        frame = frameStart;
+        frameLen = (size_t)(flag - frameStart) + 1U;
+      } else {
+        // Complete the frame started in an earlier call
+        frame = partialFrame->data;
+        frameLen = partialFrame->length + (size_t)(flag - pos) + 1U;
+        if (frameLen <= sizeof(partialFrame->data)) {
+          memcpy(partialFrame->data + partialFrame->length, pos, (size_t)(flag - pos) + 1U);
+        }
+      }
+
+      if (frameLen > sizeof(partialFrame->data)) {
+        errCode = OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+      } else if (frameLen >= AX25_DEFRAMER_MIN_FRAME_LEN) {
+        deframer->callback(frame, (uint16_t)frameLen, deframer->userData);
+      }
+    }
+
+    // This flag opens the next frame
+    deframer->inFrame = true;
+    frameStart = flag;
+    pos = flag + 1;
+  }
+
+  if (!deframer->inFrame) {
+    return errCode;
+  }
+
+  // Buffer whatever is left of an unfinished frame so the next call can complete it
+  size_t startLen = 0;
+  if (frameStart != NULL) {
+    pos = frameStart;
+  } else {
+    startLen = partialFrame->length;
+  }
+
+  size_t remainingLen = (size_t)(end - pos);
+  if (startLen + remainingLen > sizeof(partialFrame->data)) {
+    // Too long to be a frame, so drop it and wait for the next flag
+    ax25DeframerReset(deframer);
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  memcpy(partialFrame->data + startLen, pos, remainingLen);
+  partialFrame->length = (uint16_t)(startLen + remainingLen);
+
+  return errCode;
+}
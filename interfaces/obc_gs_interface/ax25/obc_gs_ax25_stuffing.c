@@ -0,0 +1,493 @@
+#include "obc_gs_ax25.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Table-driven AX.25 bit stuffing engine.
+ *
+ * Instead of walking the frame one bit at a time, each input byte is translated with a single table lookup indexed by
+ * the current run-length state and the byte value. Each entry holds the output bits for that byte (right aligned, MSB
+ * first), how many bits were added or removed, and the run-length state to use for the next byte. Output bits are
+ * collected in a 32-bit accumulator and written out a whole byte at a time.
+ *
+ * The tables were generated from the bitwise algorithm and are checked against it in test_obc_gs_ax25.cpp.
+ */
+
+/* Stuff table entry: bits 0-9 = output bits, bits 10-11 = number of stuffed bits, bits 12-14 = next ones count */
+#define AX25_STUFF_ENTRY_BITS_MASK 0x03FFU
+#define AX25_STUFF_ENTRY_EXTRA_SHIFT 10U
+#define AX25_STUFF_ENTRY_EXTRA_MASK 0x03U
+#define AX25_STUFF_ENTRY_STATE_SHIFT 12U
+#define AX25_STUFF_ENTRY_STATE_MASK 0x07U
+
+/* Unstuff table entry: bits 0-7 = output bits, bits 8-9 = number of removed bits, bits 10-12 = next state */
+#define AX25_UNSTUFF_ENTRY_BITS_MASK 0x00FFU
+#define AX25_UNSTUFF_ENTRY_REMOVED_SHIFT 8U
+#define AX25_UNSTUFF_ENTRY_REMOVED_MASK 0x03U
+#define AX25_UNSTUFF_ENTRY_STATE_SHIFT 10U
+#define AX25_UNSTUFF_ENTRY_STATE_MASK 0x07U
+
+/* Number of run-length states: 0-4 consecutive 1s */
+#define AX25_STUFF_STATE_COUNT 5U
+/* Number of run-length states: 0-4 consecutive 1s, or 5 when the next bit is a stuffed bit that must be dropped */
+#define AX25_UNSTUFF_STATE_COUNT 6U
+
+static const uint16_t ax25StuffTable[AX25_STUFF_STATE_COUNT][256] = {
+  {
+    0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U,
+    0x0008U, 0x1009U, 0x000AU, 0x200BU, 0x000CU, 0x100DU, 0x000EU, 0x400FU,
+    0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+    0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU,
+    0x0020U, 0x1021U, 0x0022U, 0x2023U, 0x0024U, 0x1025U, 0x0026U, 0x3027U,
+    0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+    0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U,
+    0x0038U, 0x1039U, 0x003AU, 0x203BU, 0x003CU, 0x103DU, 0x047CU, 0x147DU,
+    0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+    0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU,
+    0x0050U, 0x1051U, 0x0052U, 0x2053U, 0x0054U, 0x1055U, 0x0056U, 0x3057U,
+    0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+    0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U,
+    0x0068U, 0x1069U, 0x006AU, 0x206BU, 0x006CU, 0x106DU, 0x006EU, 0x406FU,
+    0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+    0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU,
+    0x0080U, 0x1081U, 0x0082U, 0x2083U, 0x0084U, 0x1085U, 0x0086U, 0x3087U,
+    0x0088U, 0x1089U, 0x008AU, 0x208BU, 0x008CU, 0x108DU, 0x008EU, 0x408FU,
+    0x0090U, 0x1091U, 0x0092U, 0x2093U, 0x0094U, 0x1095U, 0x0096U, 0x3097U,
+    0x0098U, 0x1099U, 0x009AU, 0x209BU, 0x009CU, 0x109DU, 0x009EU, 0x053EU,
+    0x00A0U, 0x10A1U, 0x00A2U, 0x20A3U, 0x00A4U, 0x10A5U, 0x00A6U, 0x30A7U,
+    0x00A8U, 0x10A9U, 0x00AAU, 0x20ABU, 0x00ACU, 0x10ADU, 0x00AEU, 0x40AFU,
+    0x00B0U, 0x10B1U, 0x00B2U, 0x20B3U, 0x00B4U, 0x10B5U, 0x00B6U, 0x30B7U,
+    0x00B8U, 0x10B9U, 0x00BAU, 0x20BBU, 0x00BCU, 0x10BDU, 0x057CU, 0x157DU,
+    0x00C0U, 0x10C1U, 0x00C2U, 0x20C3U, 0x00C4U, 0x10C5U, 0x00C6U, 0x30C7U,
+    0x00C8U, 0x10C9U, 0x00CAU, 0x20CBU, 0x00CCU, 0x10CDU, 0x00CEU, 0x40CFU,
+    0x00D0U, 0x10D1U, 0x00D2U, 0x20D3U, 0x00D4U, 0x10D5U, 0x00D6U, 0x30D7U,
+    0x00D8U, 0x10D9U, 0x00DAU, 0x20DBU, 0x00DCU, 0x10DDU, 0x00DEU, 0x05BEU,
+    0x00E0U, 0x10E1U, 0x00E2U, 0x20E3U, 0x00E4U, 0x10E5U, 0x00E6U, 0x30E7U,
+    0x00E8U, 0x10E9U, 0x00EAU, 0x20EBU, 0x00ECU, 0x10EDU, 0x00EEU, 0x40EFU,
+    0x00F0U, 0x10F1U, 0x00F2U, 0x20F3U, 0x00F4U, 0x10F5U, 0x00F6U, 0x30F7U,
+    0x05F0U, 0x15F1U, 0x05F2U, 0x25F3U, 0x05F4U, 0x15F5U, 0x05F6U, 0x35F7U,
+  },
+  {
+    0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U,
+    0x0008U, 0x1009U, 0x000AU, 0x200BU, 0x000CU, 0x100DU, 0x000EU, 0x400FU,
+    0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+    0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU,
+    0x0020U, 0x1021U, 0x0022U, 0x2023U, 0x0024U, 0x1025U, 0x0026U, 0x3027U,
+    0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+    0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U,
+    0x0038U, 0x1039U, 0x003AU, 0x203BU, 0x003CU, 0x103DU, 0x047CU, 0x147DU,
+    0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+    0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU,
+    0x0050U, 0x1051U, 0x0052U, 0x2053U, 0x0054U, 0x1055U, 0x0056U, 0x3057U,
+    0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+    0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U,
+    0x0068U, 0x1069U, 0x006AU, 0x206BU, 0x006CU, 0x106DU, 0x006EU, 0x406FU,
+    0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+    0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU,
+    0x0080U, 0x1081U, 0x0082U, 0x2083U, 0x0084U, 0x1085U, 0x0086U, 0x3087U,
+    0x0088U, 0x1089U, 0x008AU, 0x208BU, 0x008CU, 0x108DU, 0x008EU, 0x408FU,
+    0x0090U, 0x1091U, 0x0092U, 0x2093U, 0x0094U, 0x1095U, 0x0096U, 0x3097U,
+    0x0098U, 0x1099U, 0x009AU, 0x209BU, 0x009CU, 0x109DU, 0x009EU, 0x053EU,
+    0x00A0U, 0x10A1U, 0x00A2U, 0x20A3U, 0x00A4U, 0x10A5U, 0x00A6U, 0x30A7U,
+    0x00A8U, 0x10A9U, 0x00AAU, 0x20ABU, 0x00ACU, 0x10ADU, 0x00AEU, 0x40AFU,
+    0x00B0U, 0x10B1U, 0x00B2U, 0x20B3U, 0x00B4U, 0x10B5U, 0x00B6U, 0x30B7U,
+    0x00B8U, 0x10B9U, 0x00BAU, 0x20BBU, 0x00BCU, 0x10BDU, 0x057CU, 0x157DU,
+    0x00C0U, 0x10C1U, 0x00C2U, 0x20C3U, 0x00C4U, 0x10C5U, 0x00C6U, 0x30C7U,
+    0x00C8U, 0x10C9U, 0x00CAU, 0x20CBU, 0x00CCU, 0x10CDU, 0x00CEU, 0x40CFU,
+    0x00D0U, 0x10D1U, 0x00D2U, 0x20D3U, 0x00D4U, 0x10D5U, 0x00D6U, 0x30D7U,
+    0x00D8U, 0x10D9U, 0x00DAU, 0x20DBU, 0x00DCU, 0x10DDU, 0x00DEU, 0x05BEU,
+    0x00E0U, 0x10E1U, 0x00E2U, 0x20E3U, 0x00E4U, 0x10E5U, 0x00E6U, 0x30E7U,
+    0x00E8U, 0x10E9U, 0x00EAU, 0x20EBU, 0x00ECU, 0x10EDU, 0x00EEU, 0x40EFU,
+    0x05E0U, 0x15E1U, 0x05E2U, 0x25E3U, 0x05E4U, 0x15E5U, 0x05E6U, 0x35E7U,
+    0x05E8U, 0x15E9U, 0x05EAU, 0x25EBU, 0x05ECU, 0x15EDU, 0x05EEU, 0x45EFU,
+  },
+  {
+    0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U,
+    0x0008U, 0x1009U, 0x000AU, 0x200BU, 0x000CU, 0x100DU, 0x000EU, 0x400FU,
+    0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+    0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU,
+    0x0020U, 0x1021U, 0x0022U, 0x2023U, 0x0024U, 0x1025U, 0x0026U, 0x3027U,
+    0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+    0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U,
+    0x0038U, 0x1039U, 0x003AU, 0x203BU, 0x003CU, 0x103DU, 0x047CU, 0x147DU,
+    0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+    0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU,
+    0x0050U, 0x1051U, 0x0052U, 0x2053U, 0x0054U, 0x1055U, 0x0056U, 0x3057U,
+    0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+    0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U,
+    0x0068U, 0x1069U, 0x006AU, 0x206BU, 0x006CU, 0x106DU, 0x006EU, 0x406FU,
+    0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+    0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU,
+    0x0080U, 0x1081U, 0x0082U, 0x2083U, 0x0084U, 0x1085U, 0x0086U, 0x3087U,
+    0x0088U, 0x1089U, 0x008AU, 0x208BU, 0x008CU, 0x108DU, 0x008EU, 0x408FU,
+    0x0090U, 0x1091U, 0x0092U, 0x2093U, 0x0094U, 0x1095U, 0x0096U, 0x3097U,
+    0x0098U, 0x1099U, 0x009AU, 0x209BU, 0x009CU, 0x109DU, 0x009EU, 0x053EU,
+    0x00A0U, 0x10A1U, 0x00A2U, 0x20A3U, 0x00A4U, 0x10A5U, 0x00A6U, 0x30A7U,
+    0x00A8U, 0x10A9U, 0x00AAU, 0x20ABU, 0x00ACU, 0x10ADU, 0x00AEU, 0x40AFU,
+    0x00B0U, 0x10B1U, 0x00B2U, 0x20B3U, 0x00B4U, 0x10B5U, 0x00B6U, 0x30B7U,
+    0x00B8U, 0x10B9U, 0x00BAU, 0x20BBU, 0x00BCU, 0x10BDU, 0x057CU, 0x157DU,
+    0x00C0U, 0x10C1U, 0x00C2U, 0x20C3U, 0x00C4U, 0x10C5U, 0x00C6U, 0x30C7U,
+    0x00C8U, 0x10C9U, 0x00CAU, 0x20CBU, 0x00CCU, 0x10CDU, 0x00CEU, 0x40CFU,
+    0x00D0U, 0x10D1U, 0x00D2U, 0x20D3U, 0x00D4U, 0x10D5U, 0x00D6U, 0x30D7U,
+    0x00D8U, 0x10D9U, 0x00DAU, 0x20DBU, 0x00DCU, 0x10DDU, 0x00DEU, 0x05BEU,
+    0x05C0U, 0x15C1U, 0x05C2U, 0x25C3U, 0x05C4U, 0x15C5U, 0x05C6U, 0x35C7U,
+    0x05C8U, 0x15C9U, 0x05CAU, 0x25CBU, 0x05CCU, 0x15CDU, 0x05CEU, 0x45CFU,
+    0x05D0U, 0x15D1U, 0x05D2U, 0x25D3U, 0x05D4U, 0x15D5U, 0x05D6U, 0x35D7U,
+    0x05D8U, 0x15D9U, 0x05DAU, 0x25DBU, 0x05DCU, 0x15DDU, 0x05DEU, 0x0BBEU,
+  },
+  {
+    0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U,
+    0x0008U, 0x1009U, 0x000AU, 0x200BU, 0x000CU, 0x100DU, 0x000EU, 0x400FU,
+    0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+    0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU,
+    0x0020U, 0x1021U, 0x0022U, 0x2023U, 0x0024U, 0x1025U, 0x0026U, 0x3027U,
+    0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+    0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U,
+    0x0038U, 0x1039U, 0x003AU, 0x203BU, 0x003CU, 0x103DU, 0x047CU, 0x147DU,
+    0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+    0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU,
+    0x0050U, 0x1051U, 0x0052U, 0x2053U, 0x0054U, 0x1055U, 0x0056U, 0x3057U,
+    0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+    0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U,
+    0x0068U, 0x1069U, 0x006AU, 0x206BU, 0x006CU, 0x106DU, 0x006EU, 0x406FU,
+    0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+    0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU,
+    0x0080U, 0x1081U, 0x0082U, 0x2083U, 0x0084U, 0x1085U, 0x0086U, 0x3087U,
+    0x0088U, 0x1089U, 0x008AU, 0x208BU, 0x008CU, 0x108DU, 0x008EU, 0x408FU,
+    0x0090U, 0x1091U, 0x0092U, 0x2093U, 0x0094U, 0x1095U, 0x0096U, 0x3097U,
+    0x0098U, 0x1099U, 0x009AU, 0x209BU, 0x009CU, 0x109DU, 0x009EU, 0x053EU,
+    0x00A0U, 0x10A1U, 0x00A2U, 0x20A3U, 0x00A4U, 0x10A5U, 0x00A6U, 0x30A7U,
+    0x00A8U, 0x10A9U, 0x00AAU, 0x20ABU, 0x00ACU, 0x10ADU, 0x00AEU, 0x40AFU,
+    0x00B0U, 0x10B1U, 0x00B2U, 0x20B3U, 0x00B4U, 0x10B5U, 0x00B6U, 0x30B7U,
+    0x00B8U, 0x10B9U, 0x00BAU, 0x20BBU, 0x00BCU, 0x10BDU, 0x057CU, 0x157DU,
+    0x0580U, 0x1581U, 0x0582U, 0x2583U, 0x0584U, 0x1585U, 0x0586U, 0x3587U,
+    0x0588U, 0x1589U, 0x058AU, 0x258BU, 0x058CU, 0x158DU, 0x058EU, 0x458FU,
+    0x0590U, 0x1591U, 0x0592U, 0x2593U, 0x0594U, 0x1595U, 0x0596U, 0x3597U,
+    0x0598U, 0x1599U, 0x059AU, 0x259BU, 0x059CU, 0x159DU, 0x059EU, 0x0B3EU,
+    0x05A0U, 0x15A1U, 0x05A2U, 0x25A3U, 0x05A4U, 0x15A5U, 0x05A6U, 0x35A7U,
+    0x05A8U, 0x15A9U, 0x05AAU, 0x25ABU, 0x05ACU, 0x15ADU, 0x05AEU, 0x45AFU,
+    0x05B0U, 0x15B1U, 0x05B2U, 0x25B3U, 0x05B4U, 0x15B5U, 0x05B6U, 0x35B7U,
+    0x05B8U, 0x15B9U, 0x05BAU, 0x25BBU, 0x05BCU, 0x15BDU, 0x0B7CU, 0x1B7DU,
+  },
+  {
+    0x0000U, 0x1001U, 0x0002U, 0x2003U, 0x0004U, 0x1005U, 0x0006U, 0x3007U,
+    0x0008U, 0x1009U, 0x000AU, 0x200BU, 0x000CU, 0x100DU, 0x000EU, 0x400FU,
+    0x0010U, 0x1011U, 0x0012U, 0x2013U, 0x0014U, 0x1015U, 0x0016U, 0x3017U,
+    0x0018U, 0x1019U, 0x001AU, 0x201BU, 0x001CU, 0x101DU, 0x001EU, 0x043EU,
+    0x0020U, 0x1021U, 0x0022U, 0x2023U, 0x0024U, 0x1025U, 0x0026U, 0x3027U,
+    0x0028U, 0x1029U, 0x002AU, 0x202BU, 0x002CU, 0x102DU, 0x002EU, 0x402FU,
+    0x0030U, 0x1031U, 0x0032U, 0x2033U, 0x0034U, 0x1035U, 0x0036U, 0x3037U,
+    0x0038U, 0x1039U, 0x003AU, 0x203BU, 0x003CU, 0x103DU, 0x047CU, 0x147DU,
+    0x0040U, 0x1041U, 0x0042U, 0x2043U, 0x0044U, 0x1045U, 0x0046U, 0x3047U,
+    0x0048U, 0x1049U, 0x004AU, 0x204BU, 0x004CU, 0x104DU, 0x004EU, 0x404FU,
+    0x0050U, 0x1051U, 0x0052U, 0x2053U, 0x0054U, 0x1055U, 0x0056U, 0x3057U,
+    0x0058U, 0x1059U, 0x005AU, 0x205BU, 0x005CU, 0x105DU, 0x005EU, 0x04BEU,
+    0x0060U, 0x1061U, 0x0062U, 0x2063U, 0x0064U, 0x1065U, 0x0066U, 0x3067U,
+    0x0068U, 0x1069U, 0x006AU, 0x206BU, 0x006CU, 0x106DU, 0x006EU, 0x406FU,
+    0x0070U, 0x1071U, 0x0072U, 0x2073U, 0x0074U, 0x1075U, 0x0076U, 0x3077U,
+    0x0078U, 0x1079U, 0x007AU, 0x207BU, 0x04F8U, 0x14F9U, 0x04FAU, 0x24FBU,
+    0x0500U, 0x1501U, 0x0502U, 0x2503U, 0x0504U, 0x1505U, 0x0506U, 0x3507U,
+    0x0508U, 0x1509U, 0x050AU, 0x250BU, 0x050CU, 0x150DU, 0x050EU, 0x450FU,
+    0x0510U, 0x1511U, 0x0512U, 0x2513U, 0x0514U, 0x1515U, 0x0516U, 0x3517U,
+    0x0518U, 0x1519U, 0x051AU, 0x251BU, 0x051CU, 0x151DU, 0x051EU, 0x0A3EU,
+    0x0520U, 0x1521U, 0x0522U, 0x2523U, 0x0524U, 0x1525U, 0x0526U, 0x3527U,
+    0x0528U, 0x1529U, 0x052AU, 0x252BU, 0x052CU, 0x152DU, 0x052EU, 0x452FU,
+    0x0530U, 0x1531U, 0x0532U, 0x2533U, 0x0534U, 0x1535U, 0x0536U, 0x3537U,
+    0x0538U, 0x1539U, 0x053AU, 0x253BU, 0x053CU, 0x153DU, 0x0A7CU, 0x1A7DU,
+    0x0540U, 0x1541U, 0x0542U, 0x2543U, 0x0544U, 0x1545U, 0x0546U, 0x3547U,
+    0x0548U, 0x1549U, 0x054AU, 0x254BU, 0x054CU, 0x154DU, 0x054EU, 0x454FU,
+    0x0550U, 0x1551U, 0x0552U, 0x2553U, 0x0554U, 0x1555U, 0x0556U, 0x3557U,
+    0x0558U, 0x1559U, 0x055AU, 0x255BU, 0x055CU, 0x155DU, 0x055EU, 0x0ABEU,
+    0x0560U, 0x1561U, 0x0562U, 0x2563U, 0x0564U, 0x1565U, 0x0566U, 0x3567U,
+    0x0568U, 0x1569U, 0x056AU, 0x256BU, 0x056CU, 0x156DU, 0x056EU, 0x456FU,
+    0x0570U, 0x1571U, 0x0572U, 0x2573U, 0x0574U, 0x1575U, 0x0576U, 0x3577U,
+    0x0578U, 0x1579U, 0x057AU, 0x257BU, 0x0AF8U, 0x1AF9U, 0x0AFAU, 0x2AFBU,
+  },
+};
+
+static const uint16_t ax25UnstuffTable[AX25_UNSTUFF_STATE_COUNT][256] = {
+  {
+    0x0000U, 0x0401U, 0x0002U, 0x0803U, 0x0004U, 0x0405U, 0x0006U, 0x0C07U,
+    0x0008U, 0x0409U, 0x000AU, 0x080BU, 0x000CU, 0x040DU, 0x000EU, 0x100FU,
+    0x0010U, 0x0411U, 0x0012U, 0x0813U, 0x0014U, 0x0415U, 0x0016U, 0x0C17U,
+    0x0018U, 0x0419U, 0x001AU, 0x081BU, 0x001CU, 0x041DU, 0x001EU, 0x141FU,
+    0x0020U, 0x0421U, 0x0022U, 0x0823U, 0x0024U, 0x0425U, 0x0026U, 0x0C27U,
+    0x0028U, 0x0429U, 0x002AU, 0x082BU, 0x002CU, 0x042DU, 0x002EU, 0x102FU,
+    0x0030U, 0x0431U, 0x0032U, 0x0833U, 0x0034U, 0x0435U, 0x0036U, 0x0C37U,
+    0x0038U, 0x0439U, 0x003AU, 0x083BU, 0x003CU, 0x043DU, 0x011FU, 0x011FU,
+    0x0040U, 0x0441U, 0x0042U, 0x0843U, 0x0044U, 0x0445U, 0x0046U, 0x0C47U,
+    0x0048U, 0x0449U, 0x004AU, 0x084BU, 0x004CU, 0x044DU, 0x004EU, 0x104FU,
+    0x0050U, 0x0451U, 0x0052U, 0x0853U, 0x0054U, 0x0455U, 0x0056U, 0x0C57U,
+    0x0058U, 0x0459U, 0x005AU, 0x085BU, 0x005CU, 0x045DU, 0x005EU, 0x145FU,
+    0x0060U, 0x0461U, 0x0062U, 0x0863U, 0x0064U, 0x0465U, 0x0066U, 0x0C67U,
+    0x0068U, 0x0469U, 0x006AU, 0x086BU, 0x006CU, 0x046DU, 0x006EU, 0x106FU,
+    0x0070U, 0x0471U, 0x0072U, 0x0873U, 0x0074U, 0x0475U, 0x0076U, 0x0C77U,
+    0x0078U, 0x0479U, 0x007AU, 0x087BU, 0x013EU, 0x053FU, 0x013EU, 0x053FU,
+    0x0080U, 0x0481U, 0x0082U, 0x0883U, 0x0084U, 0x0485U, 0x0086U, 0x0C87U,
+    0x0088U, 0x0489U, 0x008AU, 0x088BU, 0x008CU, 0x048DU, 0x008EU, 0x108FU,
+    0x0090U, 0x0491U, 0x0092U, 0x0893U, 0x0094U, 0x0495U, 0x0096U, 0x0C97U,
+    0x0098U, 0x0499U, 0x009AU, 0x089BU, 0x009CU, 0x049DU, 0x009EU, 0x149FU,
+    0x00A0U, 0x04A1U, 0x00A2U, 0x08A3U, 0x00A4U, 0x04A5U, 0x00A6U, 0x0CA7U,
+    0x00A8U, 0x04A9U, 0x00AAU, 0x08ABU, 0x00ACU, 0x04ADU, 0x00AEU, 0x10AFU,
+    0x00B0U, 0x04B1U, 0x00B2U, 0x08B3U, 0x00B4U, 0x04B5U, 0x00B6U, 0x0CB7U,
+    0x00B8U, 0x04B9U, 0x00BAU, 0x08BBU, 0x00BCU, 0x04BDU, 0x015FU, 0x015FU,
+    0x00C0U, 0x04C1U, 0x00C2U, 0x08C3U, 0x00C4U, 0x04C5U, 0x00C6U, 0x0CC7U,
+    0x00C8U, 0x04C9U, 0x00CAU, 0x08CBU, 0x00CCU, 0x04CDU, 0x00CEU, 0x10CFU,
+    0x00D0U, 0x04D1U, 0x00D2U, 0x08D3U, 0x00D4U, 0x04D5U, 0x00D6U, 0x0CD7U,
+    0x00D8U, 0x04D9U, 0x00DAU, 0x08DBU, 0x00DCU, 0x04DDU, 0x00DEU, 0x14DFU,
+    0x00E0U, 0x04E1U, 0x00E2U, 0x08E3U, 0x00E4U, 0x04E5U, 0x00E6U, 0x0CE7U,
+    0x00E8U, 0x04E9U, 0x00EAU, 0x08EBU, 0x00ECU, 0x04EDU, 0x00EEU, 0x10EFU,
+    0x00F0U, 0x04F1U, 0x00F2U, 0x08F3U, 0x00F4U, 0x04F5U, 0x00F6U, 0x0CF7U,
+    0x017CU, 0x057DU, 0x017EU, 0x097FU, 0x017CU, 0x057DU, 0x017EU, 0x097FU,
+  },
+  {
+    0x0000U, 0x0401U, 0x0002U, 0x0803U, 0x0004U, 0x0405U, 0x0006U, 0x0C07U,
+    0x0008U, 0x0409U, 0x000AU, 0x080BU, 0x000CU, 0x040DU, 0x000EU, 0x100FU,
+    0x0010U, 0x0411U, 0x0012U, 0x0813U, 0x0014U, 0x0415U, 0x0016U, 0x0C17U,
+    0x0018U, 0x0419U, 0x001AU, 0x081BU, 0x001CU, 0x041DU, 0x001EU, 0x141FU,
+    0x0020U, 0x0421U, 0x0022U, 0x0823U, 0x0024U, 0x0425U, 0x0026U, 0x0C27U,
+    0x0028U, 0x0429U, 0x002AU, 0x082BU, 0x002CU, 0x042DU, 0x002EU, 0x102FU,
+    0x0030U, 0x0431U, 0x0032U, 0x0833U, 0x0034U, 0x0435U, 0x0036U, 0x0C37U,
+    0x0038U, 0x0439U, 0x003AU, 0x083BU, 0x003CU, 0x043DU, 0x011FU, 0x011FU,
+    0x0040U, 0x0441U, 0x0042U, 0x0843U, 0x0044U, 0x0445U, 0x0046U, 0x0C47U,
+    0x0048U, 0x0449U, 0x004AU, 0x084BU, 0x004CU, 0x044DU, 0x004EU, 0x104FU,
+    0x0050U, 0x0451U, 0x0052U, 0x0853U, 0x0054U, 0x0455U, 0x0056U, 0x0C57U,
+    0x0058U, 0x0459U, 0x005AU, 0x085BU, 0x005CU, 0x045DU, 0x005EU, 0x145FU,
+    0x0060U, 0x0461U, 0x0062U, 0x0863U, 0x0064U, 0x0465U, 0x0066U, 0x0C67U,
+    0x0068U, 0x0469U, 0x006AU, 0x086BU, 0x006CU, 0x046DU, 0x006EU, 0x106FU,
+    0x0070U, 0x0471U, 0x0072U, 0x0873U, 0x0074U, 0x0475U, 0x0076U, 0x0C77U,
+    0x0078U, 0x0479U, 0x007AU, 0x087BU, 0x013EU, 0x053FU, 0x013EU, 0x053FU,
+    0x0080U, 0x0481U, 0x0082U, 0x0883U, 0x0084U, 0x0485U, 0x0086U, 0x0C87U,
+    0x0088U, 0x0489U, 0x008AU, 0x088BU, 0x008CU, 0x048DU, 0x008EU, 0x108FU,
+    0x0090U, 0x0491U, 0x0092U, 0x0893U, 0x0094U, 0x0495U, 0x0096U, 0x0C97U,
+    0x0098U, 0x0499U, 0x009AU, 0x089BU, 0x009CU, 0x049DU, 0x009EU, 0x149FU,
+    0x00A0U, 0x04A1U, 0x00A2U, 0x08A3U, 0x00A4U, 0x04A5U, 0x00A6U, 0x0CA7U,
+    0x00A8U, 0x04A9U, 0x00AAU, 0x08ABU, 0x00ACU, 0x04ADU, 0x00AEU, 0x10AFU,
+    0x00B0U, 0x04B1U, 0x00B2U, 0x08B3U, 0x00B4U, 0x04B5U, 0x00B6U, 0x0CB7U,
+    0x00B8U, 0x04B9U, 0x00BAU, 0x08BBU, 0x00BCU, 0x04BDU, 0x015FU, 0x015FU,
+    0x00C0U, 0x04C1U, 0x00C2U, 0x08C3U, 0x00C4U, 0x04C5U, 0x00C6U, 0x0CC7U,
+    0x00C8U, 0x04C9U, 0x00CAU, 0x08CBU, 0x00CCU, 0x04CDU, 0x00CEU, 0x10CFU,
+    0x00D0U, 0x04D1U, 0x00D2U, 0x08D3U, 0x00D4U, 0x04D5U, 0x00D6U, 0x0CD7U,
+    0x00D8U, 0x04D9U, 0x00DAU, 0x08DBU, 0x00DCU, 0x04DDU, 0x00DEU, 0x14DFU,
+    0x00E0U, 0x04E1U, 0x00E2U, 0x08E3U, 0x00E4U, 0x04E5U, 0x00E6U, 0x0CE7U,
+    0x00E8U, 0x04E9U, 0x00EAU, 0x08EBU, 0x00ECU, 0x04EDU, 0x00EEU, 0x10EFU,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x017CU, 0x057DU, 0x017EU, 0x0D7FU,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x017CU, 0x057DU, 0x017EU, 0x0D7FU,
+  },
+  {
+    0x0000U, 0x0401U, 0x0002U, 0x0803U, 0x0004U, 0x0405U, 0x0006U, 0x0C07U,
+    0x0008U, 0x0409U, 0x000AU, 0x080BU, 0x000CU, 0x040DU, 0x000EU, 0x100FU,
+    0x0010U, 0x0411U, 0x0012U, 0x0813U, 0x0014U, 0x0415U, 0x0016U, 0x0C17U,
+    0x0018U, 0x0419U, 0x001AU, 0x081BU, 0x001CU, 0x041DU, 0x001EU, 0x141FU,
+    0x0020U, 0x0421U, 0x0022U, 0x0823U, 0x0024U, 0x0425U, 0x0026U, 0x0C27U,
+    0x0028U, 0x0429U, 0x002AU, 0x082BU, 0x002CU, 0x042DU, 0x002EU, 0x102FU,
+    0x0030U, 0x0431U, 0x0032U, 0x0833U, 0x0034U, 0x0435U, 0x0036U, 0x0C37U,
+    0x0038U, 0x0439U, 0x003AU, 0x083BU, 0x003CU, 0x043DU, 0x011FU, 0x011FU,
+    0x0040U, 0x0441U, 0x0042U, 0x0843U, 0x0044U, 0x0445U, 0x0046U, 0x0C47U,
+    0x0048U, 0x0449U, 0x004AU, 0x084BU, 0x004CU, 0x044DU, 0x004EU, 0x104FU,
+    0x0050U, 0x0451U, 0x0052U, 0x0853U, 0x0054U, 0x0455U, 0x0056U, 0x0C57U,
+    0x0058U, 0x0459U, 0x005AU, 0x085BU, 0x005CU, 0x045DU, 0x005EU, 0x145FU,
+    0x0060U, 0x0461U, 0x0062U, 0x0863U, 0x0064U, 0x0465U, 0x0066U, 0x0C67U,
+    0x0068U, 0x0469U, 0x006AU, 0x086BU, 0x006CU, 0x046DU, 0x006EU, 0x106FU,
+    0x0070U, 0x0471U, 0x0072U, 0x0873U, 0x0074U, 0x0475U, 0x0076U, 0x0C77U,
+    0x0078U, 0x0479U, 0x007AU, 0x087BU, 0x013EU, 0x053FU, 0x013EU, 0x053FU,
+    0x0080U, 0x0481U, 0x0082U, 0x0883U, 0x0084U, 0x0485U, 0x0086U, 0x0C87U,
+    0x0088U, 0x0489U, 0x008AU, 0x088BU, 0x008CU, 0x048DU, 0x008EU, 0x108FU,
+    0x0090U, 0x0491U, 0x0092U, 0x0893U, 0x0094U, 0x0495U, 0x0096U, 0x0C97U,
+    0x0098U, 0x0499U, 0x009AU, 0x089BU, 0x009CU, 0x049DU, 0x009EU, 0x149FU,
+    0x00A0U, 0x04A1U, 0x00A2U, 0x08A3U, 0x00A4U, 0x04A5U, 0x00A6U, 0x0CA7U,
+    0x00A8U, 0x04A9U, 0x00AAU, 0x08ABU, 0x00ACU, 0x04ADU, 0x00AEU, 0x10AFU,
+    0x00B0U, 0x04B1U, 0x00B2U, 0x08B3U, 0x00B4U, 0x04B5U, 0x00B6U, 0x0CB7U,
+    0x00B8U, 0x04B9U, 0x00BAU, 0x08BBU, 0x00BCU, 0x04BDU, 0x015FU, 0x015FU,
+    0x00C0U, 0x04C1U, 0x00C2U, 0x08C3U, 0x00C4U, 0x04C5U, 0x00C6U, 0x0CC7U,
+    0x00C8U, 0x04C9U, 0x00CAU, 0x08CBU, 0x00CCU, 0x04CDU, 0x00CEU, 0x10CFU,
+    0x00D0U, 0x04D1U, 0x00D2U, 0x08D3U, 0x00D4U, 0x04D5U, 0x00D6U, 0x0CD7U,
+    0x00D8U, 0x04D9U, 0x00DAU, 0x08DBU, 0x00DCU, 0x04DDU, 0x00DEU, 0x14DFU,
+    0x0170U, 0x0571U, 0x0172U, 0x0973U, 0x0174U, 0x0575U, 0x0176U, 0x0D77U,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x017CU, 0x057DU, 0x017EU, 0x117FU,
+    0x0170U, 0x0571U, 0x0172U, 0x0973U, 0x0174U, 0x0575U, 0x0176U, 0x0D77U,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x017CU, 0x057DU, 0x017EU, 0x117FU,
+  },
+  {
+    0x0000U, 0x0401U, 0x0002U, 0x0803U, 0x0004U, 0x0405U, 0x0006U, 0x0C07U,
+    0x0008U, 0x0409U, 0x000AU, 0x080BU, 0x000CU, 0x040DU, 0x000EU, 0x100FU,
+    0x0010U, 0x0411U, 0x0012U, 0x0813U, 0x0014U, 0x0415U, 0x0016U, 0x0C17U,
+    0x0018U, 0x0419U, 0x001AU, 0x081BU, 0x001CU, 0x041DU, 0x001EU, 0x141FU,
+    0x0020U, 0x0421U, 0x0022U, 0x0823U, 0x0024U, 0x0425U, 0x0026U, 0x0C27U,
+    0x0028U, 0x0429U, 0x002AU, 0x082BU, 0x002CU, 0x042DU, 0x002EU, 0x102FU,
+    0x0030U, 0x0431U, 0x0032U, 0x0833U, 0x0034U, 0x0435U, 0x0036U, 0x0C37U,
+    0x0038U, 0x0439U, 0x003AU, 0x083BU, 0x003CU, 0x043DU, 0x011FU, 0x011FU,
+    0x0040U, 0x0441U, 0x0042U, 0x0843U, 0x0044U, 0x0445U, 0x0046U, 0x0C47U,
+    0x0048U, 0x0449U, 0x004AU, 0x084BU, 0x004CU, 0x044DU, 0x004EU, 0x104FU,
+    0x0050U, 0x0451U, 0x0052U, 0x0853U, 0x0054U, 0x0455U, 0x0056U, 0x0C57U,
+    0x0058U, 0x0459U, 0x005AU, 0x085BU, 0x005CU, 0x045DU, 0x005EU, 0x145FU,
+    0x0060U, 0x0461U, 0x0062U, 0x0863U, 0x0064U, 0x0465U, 0x0066U, 0x0C67U,
+    0x0068U, 0x0469U, 0x006AU, 0x086BU, 0x006CU, 0x046DU, 0x006EU, 0x106FU,
+    0x0070U, 0x0471U, 0x0072U, 0x0873U, 0x0074U, 0x0475U, 0x0076U, 0x0C77U,
+    0x0078U, 0x0479U, 0x007AU, 0x087BU, 0x013EU, 0x053FU, 0x013EU, 0x053FU,
+    0x0080U, 0x0481U, 0x0082U, 0x0883U, 0x0084U, 0x0485U, 0x0086U, 0x0C87U,
+    0x0088U, 0x0489U, 0x008AU, 0x088BU, 0x008CU, 0x048DU, 0x008EU, 0x108FU,
+    0x0090U, 0x0491U, 0x0092U, 0x0893U, 0x0094U, 0x0495U, 0x0096U, 0x0C97U,
+    0x0098U, 0x0499U, 0x009AU, 0x089BU, 0x009CU, 0x049DU, 0x009EU, 0x149FU,
+    0x00A0U, 0x04A1U, 0x00A2U, 0x08A3U, 0x00A4U, 0x04A5U, 0x00A6U, 0x0CA7U,
+    0x00A8U, 0x04A9U, 0x00AAU, 0x08ABU, 0x00ACU, 0x04ADU, 0x00AEU, 0x10AFU,
+    0x00B0U, 0x04B1U, 0x00B2U, 0x08B3U, 0x00B4U, 0x04B5U, 0x00B6U, 0x0CB7U,
+    0x00B8U, 0x04B9U, 0x00BAU, 0x08BBU, 0x00BCU, 0x04BDU, 0x015FU, 0x015FU,
+    0x0160U, 0x0561U, 0x0162U, 0x0963U, 0x0164U, 0x0565U, 0x0166U, 0x0D67U,
+    0x0168U, 0x0569U, 0x016AU, 0x096BU, 0x016CU, 0x056DU, 0x016EU, 0x116FU,
+    0x0170U, 0x0571U, 0x0172U, 0x0973U, 0x0174U, 0x0575U, 0x0176U, 0x0D77U,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x017CU, 0x057DU, 0x017EU, 0x157FU,
+    0x0160U, 0x0561U, 0x0162U, 0x0963U, 0x0164U, 0x0565U, 0x0166U, 0x0D67U,
+    0x0168U, 0x0569U, 0x016AU, 0x096BU, 0x016CU, 0x056DU, 0x016EU, 0x116FU,
+    0x0170U, 0x0571U, 0x0172U, 0x0973U, 0x0174U, 0x0575U, 0x0176U, 0x0D77U,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x017CU, 0x057DU, 0x017EU, 0x157FU,
+  },
+  {
+    0x0000U, 0x0401U, 0x0002U, 0x0803U, 0x0004U, 0x0405U, 0x0006U, 0x0C07U,
+    0x0008U, 0x0409U, 0x000AU, 0x080BU, 0x000CU, 0x040DU, 0x000EU, 0x100FU,
+    0x0010U, 0x0411U, 0x0012U, 0x0813U, 0x0014U, 0x0415U, 0x0016U, 0x0C17U,
+    0x0018U, 0x0419U, 0x001AU, 0x081BU, 0x001CU, 0x041DU, 0x001EU, 0x141FU,
+    0x0020U, 0x0421U, 0x0022U, 0x0823U, 0x0024U, 0x0425U, 0x0026U, 0x0C27U,
+    0x0028U, 0x0429U, 0x002AU, 0x082BU, 0x002CU, 0x042DU, 0x002EU, 0x102FU,
+    0x0030U, 0x0431U, 0x0032U, 0x0833U, 0x0034U, 0x0435U, 0x0036U, 0x0C37U,
+    0x0038U, 0x0439U, 0x003AU, 0x083BU, 0x003CU, 0x043DU, 0x011FU, 0x011FU,
+    0x0040U, 0x0441U, 0x0042U, 0x0843U, 0x0044U, 0x0445U, 0x0046U, 0x0C47U,
+    0x0048U, 0x0449U, 0x004AU, 0x084BU, 0x004CU, 0x044DU, 0x004EU, 0x104FU,
+    0x0050U, 0x0451U, 0x0052U, 0x0853U, 0x0054U, 0x0455U, 0x0056U, 0x0C57U,
+    0x0058U, 0x0459U, 0x005AU, 0x085BU, 0x005CU, 0x045DU, 0x005EU, 0x145FU,
+    0x0060U, 0x0461U, 0x0062U, 0x0863U, 0x0064U, 0x0465U, 0x0066U, 0x0C67U,
+    0x0068U, 0x0469U, 0x006AU, 0x086BU, 0x006CU, 0x046DU, 0x006EU, 0x106FU,
+    0x0070U, 0x0471U, 0x0072U, 0x0873U, 0x0074U, 0x0475U, 0x0076U, 0x0C77U,
+    0x0078U, 0x0479U, 0x007AU, 0x087BU, 0x013EU, 0x053FU, 0x013EU, 0x053FU,
+    0x0140U, 0x0541U, 0x0142U, 0x0943U, 0x0144U, 0x0545U, 0x0146U, 0x0D47U,
+    0x0148U, 0x0549U, 0x014AU, 0x094BU, 0x014CU, 0x054DU, 0x014EU, 0x114FU,
+    0x0150U, 0x0551U, 0x0152U, 0x0953U, 0x0154U, 0x0555U, 0x0156U, 0x0D57U,
+    0x0158U, 0x0559U, 0x015AU, 0x095BU, 0x015CU, 0x055DU, 0x015EU, 0x155FU,
+    0x0160U, 0x0561U, 0x0162U, 0x0963U, 0x0164U, 0x0565U, 0x0166U, 0x0D67U,
+    0x0168U, 0x0569U, 0x016AU, 0x096BU, 0x016CU, 0x056DU, 0x016EU, 0x116FU,
+    0x0170U, 0x0571U, 0x0172U, 0x0973U, 0x0174U, 0x0575U, 0x0176U, 0x0D77U,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x017CU, 0x057DU, 0x023FU, 0x023FU,
+    0x0140U, 0x0541U, 0x0142U, 0x0943U, 0x0144U, 0x0545U, 0x0146U, 0x0D47U,
+    0x0148U, 0x0549U, 0x014AU, 0x094BU, 0x014CU, 0x054DU, 0x014EU, 0x114FU,
+    0x0150U, 0x0551U, 0x0152U, 0x0953U, 0x0154U, 0x0555U, 0x0156U, 0x0D57U,
+    0x0158U, 0x0559U, 0x015AU, 0x095BU, 0x015CU, 0x055DU, 0x015EU, 0x155FU,
+    0x0160U, 0x0561U, 0x0162U, 0x0963U, 0x0164U, 0x0565U, 0x0166U, 0x0D67U,
+    0x0168U, 0x0569U, 0x016AU, 0x096BU, 0x016CU, 0x056DU, 0x016EU, 0x116FU,
+    0x0170U, 0x0571U, 0x0172U, 0x0973U, 0x0174U, 0x0575U, 0x0176U, 0x0D77U,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x017CU, 0x057DU, 0x023FU, 0x023FU,
+  },
+  {
+    0x0100U, 0x0501U, 0x0102U, 0x0903U, 0x0104U, 0x0505U, 0x0106U, 0x0D07U,
+    0x0108U, 0x0509U, 0x010AU, 0x090BU, 0x010CU, 0x050DU, 0x010EU, 0x110FU,
+    0x0110U, 0x0511U, 0x0112U, 0x0913U, 0x0114U, 0x0515U, 0x0116U, 0x0D17U,
+    0x0118U, 0x0519U, 0x011AU, 0x091BU, 0x011CU, 0x051DU, 0x011EU, 0x151FU,
+    0x0120U, 0x0521U, 0x0122U, 0x0923U, 0x0124U, 0x0525U, 0x0126U, 0x0D27U,
+    0x0128U, 0x0529U, 0x012AU, 0x092BU, 0x012CU, 0x052DU, 0x012EU, 0x112FU,
+    0x0130U, 0x0531U, 0x0132U, 0x0933U, 0x0134U, 0x0535U, 0x0136U, 0x0D37U,
+    0x0138U, 0x0539U, 0x013AU, 0x093BU, 0x013CU, 0x053DU, 0x021FU, 0x021FU,
+    0x0140U, 0x0541U, 0x0142U, 0x0943U, 0x0144U, 0x0545U, 0x0146U, 0x0D47U,
+    0x0148U, 0x0549U, 0x014AU, 0x094BU, 0x014CU, 0x054DU, 0x014EU, 0x114FU,
+    0x0150U, 0x0551U, 0x0152U, 0x0953U, 0x0154U, 0x0555U, 0x0156U, 0x0D57U,
+    0x0158U, 0x0559U, 0x015AU, 0x095BU, 0x015CU, 0x055DU, 0x015EU, 0x155FU,
+    0x0160U, 0x0561U, 0x0162U, 0x0963U, 0x0164U, 0x0565U, 0x0166U, 0x0D67U,
+    0x0168U, 0x0569U, 0x016AU, 0x096BU, 0x016CU, 0x056DU, 0x016EU, 0x116FU,
+    0x0170U, 0x0571U, 0x0172U, 0x0973U, 0x0174U, 0x0575U, 0x0176U, 0x0D77U,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x023EU, 0x063FU, 0x023EU, 0x063FU,
+    0x0100U, 0x0501U, 0x0102U, 0x0903U, 0x0104U, 0x0505U, 0x0106U, 0x0D07U,
+    0x0108U, 0x0509U, 0x010AU, 0x090BU, 0x010CU, 0x050DU, 0x010EU, 0x110FU,
+    0x0110U, 0x0511U, 0x0112U, 0x0913U, 0x0114U, 0x0515U, 0x0116U, 0x0D17U,
+    0x0118U, 0x0519U, 0x011AU, 0x091BU, 0x011CU, 0x051DU, 0x011EU, 0x151FU,
+    0x0120U, 0x0521U, 0x0122U, 0x0923U, 0x0124U, 0x0525U, 0x0126U, 0x0D27U,
+    0x0128U, 0x0529U, 0x012AU, 0x092BU, 0x012CU, 0x052DU, 0x012EU, 0x112FU,
+    0x0130U, 0x0531U, 0x0132U, 0x0933U, 0x0134U, 0x0535U, 0x0136U, 0x0D37U,
+    0x0138U, 0x0539U, 0x013AU, 0x093BU, 0x013CU, 0x053DU, 0x021FU, 0x021FU,
+    0x0140U, 0x0541U, 0x0142U, 0x0943U, 0x0144U, 0x0545U, 0x0146U, 0x0D47U,
+    0x0148U, 0x0549U, 0x014AU, 0x094BU, 0x014CU, 0x054DU, 0x014EU, 0x114FU,
+    0x0150U, 0x0551U, 0x0152U, 0x0953U, 0x0154U, 0x0555U, 0x0156U, 0x0D57U,
+    0x0158U, 0x0559U, 0x015AU, 0x095BU, 0x015CU, 0x055DU, 0x015EU, 0x155FU,
+    0x0160U, 0x0561U, 0x0162U, 0x0963U, 0x0164U, 0x0565U, 0x0166U, 0x0D67U,
+    0x0168U, 0x0569U, 0x016AU, 0x096BU, 0x016CU, 0x056DU, 0x016EU, 0x116FU,
+    0x0170U, 0x0571U, 0x0172U, 0x0973U, 0x0174U, 0x0575U, 0x0176U, 0x0D77U,
+    0x0178U, 0x0579U, 0x017AU, 0x097BU, 0x023EU, 0x063FU, 0x023EU, 0x063FU,
+  },
+};
+
+obc_gs_error_code_t ax25Stuff(uint8_t *rawData, uint16_t rawDataLen, uint8_t *stuffedData, uint16_t *stuffedDataLen) {
+  if (rawData == NULL || stuffedData == NULL || stuffedDataLen == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t bitBuffer = 0;
+  uint8_t bitBufferLen = 0;
+  uint8_t oneCount = 0;
+  uint16_t stuffedIndex = AX25_START_FLAG_BYTES;
+
+  // The first and last bytes are the flags, which are never stuffed and are written by the caller
+  for (uint16_t rawIndex = AX25_START_FLAG_BYTES; rawIndex + AX25_END_FLAG_BYTES < rawDataLen; ++rawIndex) {
+    uint16_t entry = ax25StuffTable[oneCount][rawData[rawIndex]];
+    uint8_t entryLen = 8U + ((entry >> AX25_STUFF_ENTRY_EXTRA_SHIFT) & AX25_STUFF_ENTRY_EXTRA_MASK);
+
+    bitBuffer = (bitBuffer << entryLen) | (entry & AX25_STUFF_ENTRY_BITS_MASK);
+    bitBufferLen += entryLen;
+    oneCount = (entry >> AX25_STUFF_ENTRY_STATE_SHIFT) & AX25_STUFF_ENTRY_STATE_MASK;
+
+    while (bitBufferLen >= 8U) {
+      bitBufferLen -= 8U;
+      stuffedData[stuffedIndex++] = (uint8_t)(bitBuffer >> bitBufferLen);
+    }
+  }
+
+  // Pad the last partial byte with 0s
+  if (bitBufferLen > 0U) {
+    stuffedData[stuffedIndex++] = (uint8_t)(bitBuffer << (8U - bitBufferLen));
+  }
+
+  *stuffedDataLen = stuffedIndex + AX25_END_FLAG_BYTES;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t ax25Unstuff(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+                                uint16_t *unstuffedPacketLen) {
+  if (packet == NULL || unstuffedPacket == NULL || unstuffedPacketLen == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint32_t bitBuffer = 0;
+  uint8_t bitBufferLen = 0;
+  uint8_t state = 0;
+  uint16_t unstuffedIndex = AX25_START_FLAG_BYTES;
+
+  // Set the first flag
+  unstuffedPacket[0] = AX25_FLAG;
+
+  // loop from second byte to second last byte since first and last are the flags
+  for (uint16_t stuffedIndex = AX25_START_FLAG_BYTES; stuffedIndex + AX25_END_FLAG_BYTES < packetLen; ++stuffedIndex) {
+    uint16_t entry = ax25UnstuffTable[state][packet[stuffedIndex]];
+    uint8_t entryLen = 8U - ((entry >> AX25_UNSTUFF_ENTRY_REMOVED_SHIFT) & AX25_UNSTUFF_ENTRY_REMOVED_MASK);
+
+    bitBuffer = (bitBuffer << entryLen) | (entry & AX25_UNSTUFF_ENTRY_BITS_MASK);
+    bitBufferLen += entryLen;
+    state = (entry >> AX25_UNSTUFF_ENTRY_STATE_SHIFT) & AX25_UNSTUFF_ENTRY_STATE_MASK;
+
+    if (bitBufferLen >= 8U) {
+      bitBufferLen -= 8U;
+      unstuffedPacket[unstuffedIndex++] = (uint8_t)(bitBuffer >> bitBufferLen);
+    }
+  }
+
+  // Only whole bytes count towards the length; a trailing partial byte is padding left over from stuffing
+  uint16_t unstuffedLen = unstuffedIndex + AX25_END_FLAG_BYTES;
+
+  if (bitBufferLen > 0U) {
+    unstuffedPacket[unstuffedIndex++] = (uint8_t)(bitBuffer << (8U - bitBufferLen));
+  }
+
+  // Add last flag to end of the packet, rounding up
+  unstuffedPacket[unstuffedIndex] = AX25_FLAG;
+
+  // The length is written last since callers may place it directly after a full-sized unstuffed buffer
+  *unstuffedPacketLen = unstuffedLen;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
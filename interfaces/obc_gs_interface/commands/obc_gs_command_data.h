@@ -17,6 +17,14 @@ typedef struct {
   uint8_t logLevel;
 } downlink_logs_next_pass_cmd_data_t;
 
+// CMD_DOWNLINK_TELEM_QUERY
+typedef struct {
+  uint32_t startTime;        // Earliest timestamp to downlink
+  uint32_t endTime;          // Latest timestamp to downlink
+  uint32_t idMask;           // Bit N set to downlink telemetry with telemetry_data_id_t N
+  uint16_t maxSamplesPerId;  // Only the newest maxSamplesPerId samples of each ID are downlinked; 0 for no limit
+} downlink_telem_query_cmd_data_t;
+
 /* -------------------------- */
 /*   Command Message Struct   */
 /* -------------------------- */
@@ -25,6 +33,7 @@ typedef struct {
   union {
     rtc_sync_cmd_data_t rtcSync;
     downlink_logs_next_pass_cmd_data_t downlinkLogsNextPass;
+    downlink_telem_query_cmd_data_t downlinkTelemQuery;
   };
 
   uint32_t timestamp;  // Unix timestamp in seconds
@@ -38,5 +38,6 @@ typedef enum {
   CMD_MICRO_SD_FORMAT,
   CMD_PING,
   CMD_DOWNLINK_TELEM,
+  CMD_DOWNLINK_TELEM_QUERY,
   NUM_CMD_CALLBACKS
 } cmd_callback_id_t;
@@ -28,6 +28,9 @@ static void packPingCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t*
 // CMD_DOWNLINK_TELEM
 static void packDownlinkTelemCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t* msg);
 
+// CMD_DOWNLINK_TELEM_QUERY
+static void packDownlinkTelemQueryCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t* msg);
+
 typedef void (*pack_func_t)(uint8_t*, uint32_t*, const cmd_msg_t*);
 
 static const pack_func_t packFns[] = {
@@ -37,6 +40,7 @@ static const pack_func_t packFns[] = {
     [CMD_MICRO_SD_FORMAT] = packMicroSdFormat,
     [CMD_PING] = packPingCmdData,
     [CMD_DOWNLINK_TELEM] = packDownlinkTelemCmdData,
+    [CMD_DOWNLINK_TELEM_QUERY] = packDownlinkTelemQueryCmdData,
     // Add more functions for other commands as needed
 };
 
@@ -97,3 +101,11 @@ static void packPingCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t*
 static void packDownlinkTelemCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t* msg) {
   // No data to pack
 }
+
+// CMD_DOWNLINK_TELEM_QUERY
+static void packDownlinkTelemQueryCmdData(uint8_t* buffer, uint32_t* offset, const cmd_msg_t* cmdMsg) {
+  packUint32(cmdMsg->downlinkTelemQuery.startTime, buffer, offset);
+  packUint32(cmdMsg->downlinkTelemQuery.endTime, buffer, offset);
+  packUint32(cmdMsg->downlinkTelemQuery.idMask, buffer, offset);
+  packUint16(cmdMsg->downlinkTelemQuery.maxSamplesPerId, buffer, offset);
+}
@@ -28,6 +28,9 @@ static void unpackPingCmdData(const uint8_t* buffer, uint32_t* offset, cmd_msg_t
 // CMD_DOWNLINK_TELEM
 static void unpackDownlinkTelemCmdData(const uint8_t* buffer, uint32_t* offset, cmd_msg_t* msg);
 
+// CMD_DOWNLINK_TELEM_QUERY
+static void unpackDownlinkTelemQueryCmdData(const uint8_t* buffer, uint32_t* offset, cmd_msg_t* msg);
+
 typedef void (*unpack_func_t)(const uint8_t*, uint32_t*, cmd_msg_t*);
 
 static const unpack_func_t unpackFns[] = {
@@ -37,6 +40,7 @@ static const unpack_func_t unpackFns[] = {
     [CMD_MICRO_SD_FORMAT] = unpackMicroSdFormat,
     [CMD_PING] = unpackPingCmdData,
     [CMD_DOWNLINK_TELEM] = unpackDownlinkTelemCmdData,
+    [CMD_DOWNLINK_TELEM_QUERY] = unpackDownlinkTelemQueryCmdData,
     // Add more functions for other commands as needed
 };
 
@@ -101,3 +105,10 @@ static void unpackPingCmdData(const uint8_t* buffer, uint32_t* offset, cmd_msg_t
 static void unpackDownlinkTelemCmdData(const uint8_t* buffer, uint32_t* offset, cmd_msg_t* msg) {
   // No data to unpack
 }
+
+static void unpackDownlinkTelemQueryCmdData(const uint8_t* buffer, uint32_t* offset, cmd_msg_t* cmdMsg) {
+  cmdMsg->downlinkTelemQuery.startTime = unpackUint32(buffer, offset);
+  cmdMsg->downlinkTelemQuery.endTime = unpackUint32(buffer, offset);
+  cmdMsg->downlinkTelemQuery.idMask = unpackUint32(buffer, offset);
+  cmdMsg->downlinkTelemQuery.maxSamplesPerId = unpackUint16(buffer, offset);
+}
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
+
+// Starting value for crc16CcittUpdate, matching calculateCrc16Ccitt
+#define CRC16_CCITT_INITIAL_VALUE 0x0000U
 
 #ifdef __cplusplus
 extern "C" {
@@ -16,6 +20,20 @@ extern "C" {
  */
 uint16_t calculateCrc16Ccitt(const uint8_t *data, uint16_t dataLen);
 
+/**
+ * @brief continues a CRC16-CCITT checksum over more data, so it can be calculated as the data arrives
+ *
+ * @note crc16CcittUpdate(crc16CcittUpdate(CRC16_CCITT_INITIAL_VALUE, a, aLen), b, bLen) gives the same result as
+ * calculateCrc16Ccitt over a followed by b
+ *
+ * @param crc: the checksum of the data so far, or CRC16_CCITT_INITIAL_VALUE to start a new one
+ * @param data: the next data to include in the checksum
+ * @param dataLen: length of data
+ *
+ * @return the checksum including data
+ */
+uint16_t crc16CcittUpdate(uint16_t crc, const uint8_t *data, size_t dataLen);
+
 #ifdef __cplusplus
 }
 #endif
@@ -8,12 +8,16 @@ typedef enum {
 
   /* Pack/Unpack error codes 100-200 */
   OBC_GS_ERR_CODE_UNSUPPORTED_CMD = 2,
+  OBC_GS_ERR_CODE_END_OF_PACKET = 100,
+  OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET = 101,
 
   /* AES error codes 200-300 */
 
   /* FEC error codes 300-400 */
   OBC_GS_ERR_CODE_REED_SOL_ENC_ERR = 300,
   OBC_GS_ERR_CODE_REED_SOL_DEC_ERR = 301,
+  OBC_GS_ERR_CODE_REED_SOL_WORKER_ERR = 302,
+  OBC_GS_ERR_CODE_REED_SOL_INIT_ERR = 303,
 
   /* AX25 error codes 400-500 */
   OBC_GS_ERR_CODE_INVALID_AX25_PACKET = 400,
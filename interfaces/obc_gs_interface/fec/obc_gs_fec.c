@@ -4,9 +4,60 @@
 
 #include <correct.h>
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
-static correct_reed_solomon *rs = NULL;
+#ifdef OBC_GS_FEC_THREAD_POOL
+#include <pthread.h>
+#endif
+
+// Blocks are handed out to batch workers this many at a time
+#define RS_BATCH_BLOCKS_PER_CLAIM 8U
+
+typedef enum {
+  RS_BATCH_ENCODE,
+  RS_BATCH_DECODE,
+} rs_batch_op_t;
+
+typedef struct {
+  rs_batch_op_t op;
+  const uint8_t *input;
+  uint8_t *output;
+  obc_gs_error_code_t *blockStatus;
+  size_t numBlocks;
+  size_t nextBlock;  // Next unclaimed block, shared by all threads working on the job
+} rs_batch_job_t;
+
+// Batch jobs walk the block arrays as flat byte arrays
+_Static_assert(sizeof(packed_rs_packet_t) == RS_ENCODED_SIZE, "packed_rs_packet_t must not be padded");
+_Static_assert(sizeof(packed_telem_packet_t) == RS_DECODED_SIZE, "packed_telem_packet_t must not be padded");
+
+// Context used by the functions that don't take one
+static obc_gs_fec_ctx_t defaultFecCtx = {.rs = NULL};
+
+#ifdef OBC_GS_FEC_THREAD_POOL
+typedef struct {
+  pthread_t threads[RS_BATCH_MAX_WORKERS];
+  obc_gs_fec_ctx_t fecCtxs[RS_BATCH_MAX_WORKERS];  // Each worker needs its own decoder scratch space
+  uint8_t numWorkers;
+
+  pthread_mutex_t lock;
+  pthread_cond_t jobReady;
+  pthread_cond_t jobDone;
+  rs_batch_job_t *job;
+  uint32_t jobGeneration;    // Incremented every time a new job is posted
+  uint32_t startGeneration;  // jobGeneration when the workers were started
+  uint8_t busyWorkers;
+  bool stopping;
+} rs_batch_pool_t;
+
+static rs_batch_pool_t rsPool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .jobReady = PTHREAD_COND_INITIALIZER,
+    .jobDone = PTHREAD_COND_INITIALIZER,
+};
+#endif
 
 /**
  * @brief takes in a packed telemtry array and encodes it using reed solomon
@@ -21,7 +72,8 @@ obc_gs_error_code_t rsEncode(uint8_t *telemData, packed_rs_packet_t *rsData) {
 
   if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
 
-  if ((uint8_t)correct_reed_solomon_encode(rs, telemData, RS_DECODED_SIZE, rsData->data) < RS_ENCODED_SIZE) {
+  // Our code is always the CCSDS (255, 223) code, so use the table-driven encoder which needs no codec state
+  if (correct_reed_solomon_encode_ccsds(telemData, RS_DECODED_SIZE, rsData->data) != RS_ENCODED_SIZE) {
     return OBC_GS_ERR_CODE_REED_SOL_ENC_ERR;
   }
 
@@ -38,27 +90,309 @@ obc_gs_error_code_t rsEncode(uint8_t *telemData, packed_rs_packet_t *rsData) {
  * @return obc_gs_error_code_t - whether or not the data was successfully decoded
  */
 obc_gs_error_code_t rsDecode(packed_rs_packet_t *rsData, uint8_t *decodedData, uint8_t decodedDataLen) {
+  return rsDecodeWithCtx(&defaultFecCtx, rsData, decodedData, decodedDataLen);
+}
+
+/**
+ * @brief Decodes the reed solomon data using the given FEC context
+ *
+ * @param ctx FEC context initialized with rsInitCtx
+ * @param rsData 255 byte array that has encoded reed solomon data
+ * @param decodedData pointer to a uint8_t array of size 223B
+ * @param decodedDataLen length of the decodedData array
+ *
+ * @return obc_gs_error_code_t - whether or not the data was successfully decoded
+ */
+obc_gs_error_code_t rsDecodeWithCtx(obc_gs_fec_ctx_t *ctx, packed_rs_packet_t *rsData, uint8_t *decodedData,
+                                    uint8_t decodedDataLen) {
+  if (ctx == NULL || ctx->rs == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
   if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
 
   if (decodedData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
 
   if (decodedDataLen < RS_DECODED_SIZE) return OBC_GS_ERR_CODE_INVALID_ARG;
 
-  int8_t decodedLength = correct_reed_solomon_decode(rs, rsData->data, RS_ENCODED_SIZE, decodedData);
+  ssize_t decodedLength = correct_reed_solomon_decode_ccsds(ctx->rs, rsData->data, RS_ENCODED_SIZE, decodedData);
+  if (decodedLength == -1) return OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Decodes the reed solomon data using the given FEC context, given the positions of bytes that are known to be
+ * unreliable
+ *
+ * @param ctx FEC context initialized with rsInitCtx
+ * @param rsData 255 byte array that has encoded reed solomon data
+ * @param erasurePositions distinct byte offsets into rsData->data of the unreliable bytes
+ * @param numErasures number of entries in erasurePositions, at most RS_PARITY_SIZE
+ * @param decodedData pointer to a uint8_t array of size 223B
+ * @param decodedDataLen length of the decodedData array
+ *
+ * @return obc_gs_error_code_t - whether or not the data was successfully decoded
+ */
+obc_gs_error_code_t rsDecodeWithErasures(obc_gs_fec_ctx_t *ctx, packed_rs_packet_t *rsData,
+                                         const uint8_t *erasurePositions, uint8_t numErasures, uint8_t *decodedData,
+                                         uint8_t decodedDataLen) {
+  if (numErasures == 0) return rsDecodeWithCtx(ctx, rsData, decodedData, decodedDataLen);
+
+  if (ctx == NULL || ctx->rs == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (rsData == NULL || erasurePositions == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (decodedData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (decodedDataLen < RS_DECODED_SIZE) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (numErasures > RS_PARITY_SIZE) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  // A repeated or out of range position would give the erasure locator a bogus root
+  for (uint8_t i = 0; i < numErasures; ++i) {
+    if (erasurePositions[i] >= RS_ENCODED_SIZE) return OBC_GS_ERR_CODE_INVALID_ARG;
+    for (uint8_t j = 0; j < i; ++j) {
+      if (erasurePositions[j] == erasurePositions[i]) return OBC_GS_ERR_CODE_INVALID_ARG;
+    }
+  }
+
+  ssize_t decodedLength = correct_reed_solomon_decode_with_erasures(ctx->rs, rsData->data, RS_ENCODED_SIZE,
+                                                                    erasurePositions, numErasures, decodedData);
   if (decodedLength == -1) return OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
 
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
 void initRs(void) {
-  if (rs == NULL) {
-    // Create reed solomon variable for encryption and decryption
-    rs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  if (defaultFecCtx.rs == NULL) {
+    rsInitCtx(&defaultFecCtx);
   }
 }
 
 void destroyRs(void) {
-  if (rs != NULL) {
-    correct_reed_solomon_destroy(rs);
+  rsDestroyCtx(&defaultFecCtx);
+}
+
+/**
+ * @brief Creates the reed solomon decoder of a FEC context
+ *
+ * @param ctx FEC context to initialize
+ *
+ * @return obc_gs_error_code_t - whether or not the context was successfully initialized
+ */
+obc_gs_error_code_t rsInitCtx(obc_gs_fec_ctx_t *ctx) {
+  if (ctx == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  ctx->rs = correct_reed_solomon_ccsds_init(&ctx->codec);
+  if (ctx->rs == NULL) return OBC_GS_ERR_CODE_REED_SOL_INIT_ERR;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Releases the reed solomon decoder of a FEC context
+ *
+ * @param ctx FEC context to clean up
+ */
+void rsDestroyCtx(obc_gs_fec_ctx_t *ctx) {
+  if (ctx != NULL && ctx->rs != NULL) {
+    // The decoder lives in the context, so there's nothing to free
+    correct_reed_solomon_destroy(ctx->rs);
+    ctx->rs = NULL;
   }
 }
+
+/**
+ * @brief Encodes or decodes blocks of a batch job until there are none left to claim
+ *
+ * @param ctx FEC context owned by the calling thread
+ * @param job The batch job to work on
+ */
+static void rsBatchRun(obc_gs_fec_ctx_t *ctx, rs_batch_job_t *job) {
+  while (1) {
+    size_t first = __atomic_fetch_add(&job->nextBlock, RS_BATCH_BLOCKS_PER_CLAIM, __ATOMIC_RELAXED);
+    if (first >= job->numBlocks) return;
+
+    size_t last = first + RS_BATCH_BLOCKS_PER_CLAIM;
+    if (last > job->numBlocks) last = job->numBlocks;
+
+    for (size_t i = first; i < last; ++i) {
+      if (job->op == RS_BATCH_ENCODE) {
+        ssize_t len = correct_reed_solomon_encode_ccsds(&job->input[i * RS_DECODED_SIZE], RS_DECODED_SIZE,
+                                                        &job->output[i * RS_ENCODED_SIZE]);
+        job->blockStatus[i] = (len == RS_ENCODED_SIZE) ? OBC_GS_ERR_CODE_SUCCESS : OBC_GS_ERR_CODE_REED_SOL_ENC_ERR;
+      } else {
+        ssize_t len = correct_reed_solomon_decode_ccsds(ctx->rs, &job->input[i * RS_ENCODED_SIZE], RS_ENCODED_SIZE,
+                                                        &job->output[i * RS_DECODED_SIZE]);
+        job->blockStatus[i] = (len == RS_DECODED_SIZE) ? OBC_GS_ERR_CODE_SUCCESS : OBC_GS_ERR_CODE_REED_SOL_DEC_ERR;
+      }
+    }
+  }
+}
+
+#ifdef OBC_GS_FEC_THREAD_POOL
+static void *rsBatchWorker(void *arg) {
+  obc_gs_fec_ctx_t *ctx = (obc_gs_fec_ctx_t *)arg;
+
+  pthread_mutex_lock(&rsPool.lock);
+  // A job may already have been posted before this thread got to run, so start from the generation the pool was
+  // started at rather than the current one
+  uint32_t seenGeneration = rsPool.startGeneration;
+  while (1) {
+    while (!rsPool.stopping && rsPool.jobGeneration == seenGeneration) {
+      pthread_cond_wait(&rsPool.jobReady, &rsPool.lock);
+    }
+    if (rsPool.stopping) break;
+
+    seenGeneration = rsPool.jobGeneration;
+    rs_batch_job_t *job = rsPool.job;
+    pthread_mutex_unlock(&rsPool.lock);
+
+    rsBatchRun(ctx, job);
+
+    pthread_mutex_lock(&rsPool.lock);
+    if (--rsPool.busyWorkers == 0) {
+      pthread_cond_signal(&rsPool.jobDone);
+    }
+  }
+  pthread_mutex_unlock(&rsPool.lock);
+
+  return NULL;
+}
+
+obc_gs_error_code_t rsBatchStartWorkers(uint8_t numWorkers) {
+  if (numWorkers == 0 || numWorkers > RS_BATCH_MAX_WORKERS) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (rsPool.numWorkers != 0) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  rsPool.stopping = false;
+  rsPool.startGeneration = rsPool.jobGeneration;
+  for (uint8_t i = 0; i < numWorkers; ++i) {
+    if (rsInitCtx(&rsPool.fecCtxs[i]) != OBC_GS_ERR_CODE_SUCCESS ||
+        pthread_create(&rsPool.threads[i], NULL, rsBatchWorker, &rsPool.fecCtxs[i]) != 0) {
+      rsDestroyCtx(&rsPool.fecCtxs[i]);
+      rsBatchStopWorkers();
+      return OBC_GS_ERR_CODE_REED_SOL_WORKER_ERR;
+    }
+    rsPool.numWorkers++;
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+void rsBatchStopWorkers(void) {
+  pthread_mutex_lock(&rsPool.lock);
+  rsPool.stopping = true;
+  pthread_cond_broadcast(&rsPool.jobReady);
+  pthread_mutex_unlock(&rsPool.lock);
+
+  for (uint8_t i = 0; i < rsPool.numWorkers; ++i) {
+    pthread_join(rsPool.threads[i], NULL);
+    rsDestroyCtx(&rsPool.fecCtxs[i]);
+  }
+  rsPool.numWorkers = 0;
+}
+#endif
+
+/**
+ * @brief Runs a batch job, on the worker pool if there is one, it's free and the job is big enough to be worth
+ * splitting
+ *
+ * @param ctx FEC context owned by the calling thread
+ * @param job The batch job to run
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_SUCCESS if every block succeeded, otherwise the status of the first
+ * block that failed
+ */
+static obc_gs_error_code_t rsBatchDispatch(obc_gs_fec_ctx_t *ctx, rs_batch_job_t *job) {
+#ifdef OBC_GS_FEC_THREAD_POOL
+  bool usePool = false;
+  if (job->numBlocks > RS_BATCH_BLOCKS_PER_CLAIM) {
+    pthread_mutex_lock(&rsPool.lock);
+    // The pool works on one job at a time, so a batch started while it's busy runs on the calling thread alone
+    usePool = rsPool.numWorkers != 0 && rsPool.job == NULL;
+    if (usePool) {
+      rsPool.job = job;
+      rsPool.busyWorkers = rsPool.numWorkers;
+      rsPool.jobGeneration++;
+      pthread_cond_broadcast(&rsPool.jobReady);
+    }
+    pthread_mutex_unlock(&rsPool.lock);
+  }
+
+  // The calling thread works on the job too, using its own context
+  rsBatchRun(ctx, job);
+
+  if (usePool) {
+    pthread_mutex_lock(&rsPool.lock);
+    while (rsPool.busyWorkers != 0) {
+      pthread_cond_wait(&rsPool.jobDone, &rsPool.lock);
+    }
+    rsPool.job = NULL;
+    pthread_mutex_unlock(&rsPool.lock);
+  }
+#else
+  rsBatchRun(ctx, job);
+#endif
+
+  for (size_t i = 0; i < job->numBlocks; ++i) {
+    if (job->blockStatus[i] != OBC_GS_ERR_CODE_SUCCESS) return job->blockStatus[i];
+  }
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t rsEncodeBatch(const packed_telem_packet_t *telemData, packed_rs_packet_t *rsData,
+                                  size_t numBlocks, obc_gs_error_code_t *blockStatus) {
+  return rsEncodeBatchWithCtx(&defaultFecCtx, telemData, rsData, numBlocks, blockStatus);
+}
+
+obc_gs_error_code_t rsEncodeBatchWithCtx(obc_gs_fec_ctx_t *ctx, const packed_telem_packet_t *telemData,
+                                         packed_rs_packet_t *rsData, size_t numBlocks,
+                                         obc_gs_error_code_t *blockStatus) {
+  if (ctx == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (telemData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (blockStatus == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  rs_batch_job_t job = {
+      .op = RS_BATCH_ENCODE,
+      .input = (const uint8_t *)telemData,
+      .output = (uint8_t *)rsData,
+      .blockStatus = blockStatus,
+      .numBlocks = numBlocks,
+      .nextBlock = 0,
+  };
+
+  return rsBatchDispatch(ctx, &job);
+}
+
+obc_gs_error_code_t rsDecodeBatch(const packed_rs_packet_t *rsData, packed_telem_packet_t *decodedData,
+                                  size_t numBlocks, obc_gs_error_code_t *blockStatus) {
+  return rsDecodeBatchWithCtx(&defaultFecCtx, rsData, decodedData, numBlocks, blockStatus);
+}
+
+obc_gs_error_code_t rsDecodeBatchWithCtx(obc_gs_fec_ctx_t *ctx, const packed_rs_packet_t *rsData,
+                                         packed_telem_packet_t *decodedData, size_t numBlocks,
+                                         obc_gs_error_code_t *blockStatus) {
+  if (ctx == NULL || ctx->rs == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (rsData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (decodedData == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  if (blockStatus == NULL) return OBC_GS_ERR_CODE_INVALID_ARG;
+
+  rs_batch_job_t job = {
+      .op = RS_BATCH_DECODE,
+      .input = (const uint8_t *)rsData,
+      .output = (uint8_t *)decodedData,
+      .blockStatus = blockStatus,
+      .numBlocks = numBlocks,
+      .nextBlock = 0,
+  };
+
+  return rsBatchDispatch(ctx, &job);
+}
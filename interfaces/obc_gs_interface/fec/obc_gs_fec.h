@@ -3,12 +3,17 @@
 #include "obc_gs_errors.h"
 #include "correct.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #define RS_DECODED_SIZE 223U
 #define RS_ENCODED_SIZE 255U
+#define RS_PARITY_SIZE (RS_ENCODED_SIZE - RS_DECODED_SIZE)
 #define PACKED_TELEM_PACKET_SIZE RS_DECODED_SIZE
 
+// Maximum number of worker threads that rsBatchStartWorkers can start
+#define RS_BATCH_MAX_WORKERS 16U
+
 typedef struct {
   uint8_t data[RS_ENCODED_SIZE];
 } packed_rs_packet_t;
@@ -17,6 +22,17 @@ typedef struct {
   uint8_t data[PACKED_TELEM_PACKET_SIZE];
 } packed_telem_packet_t;
 
+/**
+ * @brief Reed Solomon decoder state. Each thread or task that decodes concurrently needs its own context
+ *
+ * @note The decoder lives inside the context and its tables are const, so contexts use no heap. A context must not be
+ * copied once it has been initialized since rs points into it.
+ */
+typedef struct {
+  correct_reed_solomon *rs;  // NULL until rsInitCtx, then points at codec
+  correct_reed_solomon_ccsds codec;
+} obc_gs_fec_ctx_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -24,13 +40,15 @@ extern "C" {
 /**
  * @brief takes in a packed telemtry array and encodes it using reed solomon
  *
+ * @note telemData may be rsData->data, in which case the parity is appended to the telemetry in place
+ *
  * @param telemData packed telemtry data array that needs to be encoded
  * @param rsData 255 byte array with the reed solomon encoded data
  */
 obc_gs_error_code_t rsEncode(uint8_t *telemData, packed_rs_packet_t *rsData);
 
 /**
- * @brief Decodes the reed solomon data
+ * @brief Decodes the reed solomon data using the default FEC context
  *
  * @param rsData 255 byte array that has encoded reed solomon data
  * @param decodedData pointer to a uint8_t array of size 223B
@@ -39,15 +57,153 @@ obc_gs_error_code_t rsEncode(uint8_t *telemData, packed_rs_packet_t *rsData);
 obc_gs_error_code_t rsDecode(packed_rs_packet_t *rsData, uint8_t *decodedData, uint8_t decodedDataLen);
 
 /**
- * @brief initializes the rs variable to be used for rs encryption and decryption
+ * @brief initializes the default FEC context used by rsDecode and the batch functions
+ *
+ * @note Must be called once, before any other task can use the default context. rsDecode and rsDecodeBatch don't
+ * initialize it themselves; they return OBC_GS_ERR_CODE_INVALID_ARG until this has been called.
  */
 void initRs(void);
 
 /**
- * @brief cleans up the memory allocated for the rs variable
+ * @brief cleans up the default FEC context
  */
 void destroyRs(void);
 
+/**
+ * @brief Creates the reed solomon decoder of a FEC context
+ *
+ * @note rsEncode needs no context and is safe to call from any thread
+ *
+ * @param ctx FEC context to initialize
+ */
+obc_gs_error_code_t rsInitCtx(obc_gs_fec_ctx_t *ctx);
+
+/**
+ * @brief Releases the reed solomon decoder of a FEC context
+ *
+ * @param ctx FEC context to clean up
+ */
+void rsDestroyCtx(obc_gs_fec_ctx_t *ctx);
+
+/**
+ * @brief Decodes the reed solomon data using the given FEC context
+ *
+ * @param ctx FEC context initialized with rsInitCtx
+ * @param rsData 255 byte array that has encoded reed solomon data
+ * @param decodedData pointer to a uint8_t array of size 223B
+ * @param decodedDataLen length of the decodedData array
+ */
+obc_gs_error_code_t rsDecodeWithCtx(obc_gs_fec_ctx_t *ctx, packed_rs_packet_t *rsData, uint8_t *decodedData,
+                                    uint8_t decodedDataLen);
+
+/**
+ * @brief Decodes the reed solomon data using the given FEC context, given the positions of bytes that are known to be
+ * unreliable (e.g. from a soft-decision demodulator)
+ *
+ * @note A block decodes as long as 2 * (errors outside the erasures) + numErasures <= RS_PARITY_SIZE, so up to 32
+ * erased bytes can be recovered where plain decoding stops at 16 errors. Uses only the scratch space in ctx.
+ *
+ * @param ctx FEC context initialized with rsInitCtx
+ * @param rsData 255 byte array that has encoded reed solomon data
+ * @param erasurePositions distinct byte offsets into rsData->data of the unreliable bytes
+ * @param numErasures number of entries in erasurePositions, at most RS_PARITY_SIZE
+ * @param decodedData pointer to a uint8_t array of size 223B
+ * @param decodedDataLen length of the decodedData array
+ *
+ * @return obc_gs_error_code_t - whether or not the data was successfully decoded
+ */
+obc_gs_error_code_t rsDecodeWithErasures(obc_gs_fec_ctx_t *ctx, packed_rs_packet_t *rsData,
+                                         const uint8_t *erasurePositions, uint8_t numErasures, uint8_t *decodedData,
+                                         uint8_t decodedDataLen);
+
+/**
+ * @brief Reed Solomon encodes an array of packed telemetry blocks
+ *
+ * @param telemData array of numBlocks packed telemetry blocks to encode
+ * @param rsData array of numBlocks blocks that the encoded data is written to
+ * @param numBlocks number of blocks to encode
+ * @param blockStatus array of numBlocks error codes, one for each block
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_SUCCESS if every block was encoded, otherwise the error code of the
+ * first block that failed
+ */
+obc_gs_error_code_t rsEncodeBatch(const packed_telem_packet_t *telemData, packed_rs_packet_t *rsData,
+                                  size_t numBlocks, obc_gs_error_code_t *blockStatus);
+
+/**
+ * @brief Decodes an array of reed solomon blocks
+ *
+ * @note Blocks that fail to decode don't stop the batch. Their status is set to OBC_GS_ERR_CODE_REED_SOL_DEC_ERR and
+ * the contents of their decodedData entry are unspecified. The calling thread uses the default FEC context, like
+ * rsDecode; use rsDecodeBatchWithCtx to decode batches from several threads at once.
+ *
+ * @param rsData array of numBlocks blocks of encoded reed solomon data
+ * @param decodedData array of numBlocks blocks that the decoded data is written to
+ * @param numBlocks number of blocks to decode
+ * @param blockStatus array of numBlocks error codes, one for each block
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_SUCCESS if every block was decoded, otherwise the error code of the
+ * first block that failed
+ */
+obc_gs_error_code_t rsDecodeBatch(const packed_rs_packet_t *rsData, packed_telem_packet_t *decodedData,
+                                  size_t numBlocks, obc_gs_error_code_t *blockStatus);
+
+/**
+ * @brief Reed Solomon encodes an array of packed telemetry blocks, with the calling thread using the given FEC context
+ *
+ * @note Safe to call from several threads at once as long as each one has its own context
+ *
+ * @param ctx FEC context owned by the calling thread
+ * @param telemData array of numBlocks packed telemetry blocks to encode
+ * @param rsData array of numBlocks blocks that the encoded data is written to
+ * @param numBlocks number of blocks to encode
+ * @param blockStatus array of numBlocks error codes, one for each block
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_SUCCESS if every block was encoded, otherwise the error code of the
+ * first block that failed
+ */
+obc_gs_error_code_t rsEncodeBatchWithCtx(obc_gs_fec_ctx_t *ctx, const packed_telem_packet_t *telemData,
+                                         packed_rs_packet_t *rsData, size_t numBlocks,
+                                         obc_gs_error_code_t *blockStatus);
+
+/**
+ * @brief Decodes an array of reed solomon blocks, with the calling thread using the given FEC context
+ *
+ * @note Safe to call from several threads at once as long as each one has its own context. Failing blocks are
+ * handled as in rsDecodeBatch
+ *
+ * @param ctx FEC context initialized with rsInitCtx, owned by the calling thread
+ * @param rsData array of numBlocks blocks of encoded reed solomon data
+ * @param decodedData array of numBlocks blocks that the decoded data is written to
+ * @param numBlocks number of blocks to decode
+ * @param blockStatus array of numBlocks error codes, one for each block
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_SUCCESS if every block was decoded, otherwise the error code of the
+ * first block that failed
+ */
+obc_gs_error_code_t rsDecodeBatchWithCtx(obc_gs_fec_ctx_t *ctx, const packed_rs_packet_t *rsData,
+                                         packed_telem_packet_t *decodedData, size_t numBlocks,
+                                         obc_gs_error_code_t *blockStatus);
+
+#ifdef OBC_GS_FEC_THREAD_POOL
+/**
+ * @brief Starts a pool of worker threads that rsEncodeBatch and rsDecodeBatch spread their blocks over
+ *
+ * @note The calling thread of a batch also works on it, so a batch runs on numWorkers + 1 threads. The workers take
+ * one batch at a time; a batch started while they're busy runs on its calling thread alone.
+ *
+ * @param numWorkers number of worker threads to start, at most RS_BATCH_MAX_WORKERS
+ *
+ * @return obc_gs_error_code_t - whether or not the workers were started
+ */
+obc_gs_error_code_t rsBatchStartWorkers(uint8_t numWorkers);
+
+/**
+ * @brief Stops the batch worker threads and frees their decoders. Batches run on the calling thread afterwards
+ */
+void rsBatchStopWorkers(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
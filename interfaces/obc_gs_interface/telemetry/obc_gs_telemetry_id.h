@@ -39,3 +39,5 @@ typedef enum {
   TELEM_NUM_CSP_PACKETS_RCVD,
   TELEM_PONG,
 } telemetry_data_id_t;
+
+#define TELEMETRY_NUM_IDS (TELEM_PONG + 1)
@@ -1,17 +1,30 @@
 #include "obc_gs_telemetry_pack.h"
 #include "obc_gs_telemetry_data.h"
 #include "obc_gs_telemetry_id.h"
+#include "obc_gs_telemetry_schema.h"
 #include "data_pack_utils.h"
 #include "obc_gs_errors.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+
+// Fixed-point values are limited to +/-2^30 steps so that the difference between two of them fits in 32 bits
+#define FIXED_POINT_MAX_STEPS 1073741824.0f
 
 /* Declare all pack functions for telemetry data */
 static void packObcTemp(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
 static void packObcState(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
 static void packPong(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset);
 
+/* Helpers for telemetry packets */
+static bool extendTelemetryRun(telemetry_packet_builder_t *builder, const telemetry_data_t *data);
+static uint32_t zigzagEncode(uint32_t delta);
+static void packVarint(uint32_t value, uint8_t *buffer, uint32_t *offset);
+static float telemetryFloatValue(const telemetry_data_t *data);
+static bool quantiseTelemetry(float value, float resolution, int32_t *steps);
+
 typedef void (*telemetry_pack_func_t)(const telemetry_data_t *, uint8_t *, uint32_t *);
 
 static const telemetry_pack_func_t telemPackFns[] = {
@@ -49,6 +62,182 @@ obc_gs_error_code_t packTelemetry(const telemetry_data_t *data, uint8_t *buffer,
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
+obc_gs_error_code_t initTelemetryPacket(telemetry_packet_builder_t *builder, uint8_t *buffer, size_t buffLen) {
+  if (builder == NULL || buffer == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (buffLen < TELEM_PACKET_HEADER_SIZE) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  memset(buffer, 0, buffLen);
+
+  builder->buffer = buffer;
+  builder->bufferLen = buffLen;
+  builder->len = 0;
+  builder->numSamples = 0;
+  builder->lastTimestamp = 0;
+  memset(builder->lastValues, 0, sizeof(builder->lastValues));
+  builder->canExtendRun = false;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t addTelemetryToPacket(telemetry_packet_builder_t *builder, const telemetry_data_t *data) {
+  if (builder == NULL || data == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  const telemetry_schema_t *schema = getTelemetrySchema(data->id);
+  if (schema == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (builder->numSamples == UINT32_MAX) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  if (schema->encoding == TELEM_ENCODING_STATE && extendTelemetryRun(builder, data)) {
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  // The first sample's timestamp is the base timestamp
+  size_t len = builder->len;
+  uint32_t lastTimestamp = builder->lastTimestamp;
+  if (builder->numSamples == 0) {
+    len = TELEM_PACKET_HEADER_SIZE;
+    lastTimestamp = data->timestamp;
+  }
+
+  uint8_t header = (uint8_t)data->id;
+  int32_t steps = 0;
+  if (schema->encoding == TELEM_ENCODING_FIXED_POINT &&
+      !quantiseTelemetry(telemetryFloatValue(data), schema->resolution, &steps)) {
+    header |= TELEM_RECORD_FLAG_RAW;
+  }
+
+  uint8_t record[TELEM_RECORD_MAX_SIZE];
+  uint32_t recordLen = 0;
+  packUint8(header, record, &recordLen);
+  packVarint(zigzagEncode(data->timestamp - lastTimestamp), record, &recordLen);
+
+  switch (schema->encoding) {
+    case TELEM_ENCODING_FIXED_POINT:
+      if (header & TELEM_RECORD_FLAG_RAW) {
+        packFloat(telemetryFloatValue(data), record, &recordLen);
+      } else {
+        packVarint(zigzagEncode((uint32_t)steps - (uint32_t)builder->lastValues[data->id]), record, &recordLen);
+      }
+      break;
+    case TELEM_ENCODING_STATE:
+      packUint8(data->obcState, record, &recordLen);
+      break;
+    case TELEM_ENCODING_UINT:
+      packVarint(data->numCspPacketsRcvd, record, &recordLen);
+      break;
+    case TELEM_ENCODING_NONE:
+      break;
+  }
+
+  if (len + recordLen > builder->bufferLen) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  if (builder->numSamples == 0) {
+    uint32_t offset = 0;
+    packUint32(data->timestamp, builder->buffer, &offset);
+  }
+  memcpy(&builder->buffer[len], record, recordLen);
+
+  builder->canExtendRun = schema->encoding == TELEM_ENCODING_STATE;
+  if (builder->canExtendRun) {
+    builder->runOffset = len;
+    builder->runPrevTimestamp = lastTimestamp;
+    builder->runFirstTimestamp = data->timestamp;
+    builder->runId = data->id;
+    builder->runValue = data->obcState;
+    builder->runLength = 0;
+    builder->runInterval = 0;
+  }
+
+  if (schema->encoding == TELEM_ENCODING_FIXED_POINT && !(header & TELEM_RECORD_FLAG_RAW)) {
+    builder->lastValues[data->id] = steps;
+  }
+
+  builder->len = len + recordLen;
+  builder->lastTimestamp = data->timestamp;
+  builder->numSamples++;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+static bool extendTelemetryRun(telemetry_packet_builder_t *builder, const telemetry_data_t *data) {
+  if (!builder->canExtendRun || data->id != builder->runId || data->obcState != builder->runValue ||
+      data->timestamp < builder->lastTimestamp) {
+    return false;
+  }
+
+  // Every sample in a run has to be the same time after the one before
+  uint32_t interval = data->timestamp - builder->lastTimestamp;
+  if (builder->runLength > 0 && interval != builder->runInterval) {
+    return false;
+  }
+
+  // The run's record is the last in the packet, so it can be rewritten in place
+  uint8_t record[TELEM_RECORD_MAX_SIZE];
+  uint32_t recordLen = 0;
+  packUint8((uint8_t)builder->runId | TELEM_RECORD_FLAG_RUN, record, &recordLen);
+  packVarint(zigzagEncode(builder->runFirstTimestamp - builder->runPrevTimestamp), record, &recordLen);
+  packUint8(builder->runValue, record, &recordLen);
+  packVarint(builder->runLength + 1, record, &recordLen);
+  packVarint(interval, record, &recordLen);
+
+  if (builder->runOffset + recordLen > builder->bufferLen) {
+    return false;
+  }
+
+  memcpy(&builder->buffer[builder->runOffset], record, recordLen);
+
+  builder->runLength++;
+  builder->runInterval = interval;
+  builder->len = builder->runOffset + recordLen;
+  builder->lastTimestamp = data->timestamp;
+  builder->numSamples++;
+
+  return true;
+}
+
+static uint32_t zigzagEncode(uint32_t delta) {
+  // Small negative differences (as two's complement) become small odd numbers, and small positive ones even numbers
+  return (delta << 1) ^ (0U - (delta >> 31));
+}
+
+static void packVarint(uint32_t value, uint8_t *buffer, uint32_t *offset) {
+  while (value >= 0x80U) {
+    packUint8((uint8_t)(value | 0x80U), buffer, offset);
+    value >>= 7;
+  }
+  packUint8((uint8_t)value, buffer, offset);
+}
+
+static float telemetryFloatValue(const telemetry_data_t *data) {
+  // Every float value is stored in the same place in the union
+  return data->obcTemp;
+}
+
+static bool quantiseTelemetry(float value, float resolution, int32_t *steps) {
+  float scaled = value / resolution;
+
+  // Also rejects NaN, which fails every comparison
+  if (!(scaled > -FIXED_POINT_MAX_STEPS && scaled < FIXED_POINT_MAX_STEPS)) {
+    return false;
+  }
+
+  *steps = (int32_t)(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+  return true;
+}
+
 static void packObcTemp(const telemetry_data_t *data, uint8_t *buffer, uint32_t *offset) {
   packFloat(data->obcTemp, buffer, offset);
 }
@@ -2,10 +2,35 @@
 
 #include "obc_gs_errors.h"
 #include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
+/**
+ * @brief A telemetry packet being filled, laid out as described in obc_gs_telemetry_schema.h
+ */
+typedef struct {
+  uint8_t *buffer;
+  size_t bufferLen;
+  size_t len;  // Bytes of the buffer used so far
+  uint32_t numSamples;
+
+  uint32_t lastTimestamp;
+  int32_t lastValues[TELEMETRY_NUM_IDS];  // In steps of each fixed-point ID's resolution
+
+  // Set if the last record is a state record that the next sample could extend into a run
+  bool canExtendRun;
+  size_t runOffset;
+  uint32_t runPrevTimestamp;  // The timestamp before the run's record
+  uint32_t runFirstTimestamp;
+  telemetry_data_id_t runId;
+  uint8_t runValue;
+  uint32_t runLength;
+  uint32_t runInterval;
+} telemetry_packet_builder_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -20,6 +45,25 @@ extern "C" {
  */
 obc_gs_error_code_t packTelemetry(const telemetry_data_t *data, uint8_t *buffer, size_t buffLen, uint32_t *numPacked);
 
+/**
+ * @brief Start an empty telemetry packet, clearing the buffer it's packed into
+ *
+ * @param builder The packet to start
+ * @param buffer The buffer to pack samples into
+ * @param buffLen The length of the buffer
+ */
+obc_gs_error_code_t initTelemetryPacket(telemetry_packet_builder_t *builder, uint8_t *buffer, size_t buffLen);
+
+/**
+ * @brief Add a sample to a telemetry packet if it fits
+ *
+ * @param builder The packet to add the sample to
+ * @param data The sample to add
+ * @return OBC_GS_ERR_CODE_SUCCESS if the sample was added, OBC_GS_ERR_CODE_BUFF_TOO_SMALL if it doesn't fit (the packet
+ * is left as it was), otherwise error code
+ */
+obc_gs_error_code_t addTelemetryToPacket(telemetry_packet_builder_t *builder, const telemetry_data_t *data);
+
 #ifdef __cplusplus
 }
 #endif
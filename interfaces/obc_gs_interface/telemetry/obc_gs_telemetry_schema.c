@@ -0,0 +1,62 @@
+#include "obc_gs_telemetry_schema.h"
+#include "obc_gs_telemetry_id.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TEMP_RESOLUTION 0.01f     // degrees C
+#define CURRENT_RESOLUTION 0.001f
+#define VOLTAGE_RESOLUTION 0.001f
+
+#define FIXED_POINT(res) \
+  { .encoding = TELEM_ENCODING_FIXED_POINT, .resolution = (res) }
+#define STATE \
+  { .encoding = TELEM_ENCODING_STATE }
+
+static const telemetry_schema_t telemSchemas[] = {
+    // Temperature values
+    [TELEM_CC1120_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_COMMS_CUSTOM_TRANSCEIVER_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_OBC_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_ADCS_MAG_BOARD_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_ADCS_SENSOR_BOARD_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_EPS_BOARD_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_SOLAR_PANEL_1_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_SOLAR_PANEL_2_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_SOLAR_PANEL_3_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+    [TELEM_SOLAR_PANEL_4_TEMP] = FIXED_POINT(TEMP_RESOLUTION),
+
+    // Current values
+    [TELEM_EPS_COMMS_5V_CURRENT] = FIXED_POINT(CURRENT_RESOLUTION),
+    [TELEM_EPS_COMMS_3V3_CURRENT] = FIXED_POINT(CURRENT_RESOLUTION),
+    [TELEM_EPS_MAGNETORQUER_8V_CURRENT] = FIXED_POINT(CURRENT_RESOLUTION),
+    [TELEM_EPS_ADCS_5V_CURRENT] = FIXED_POINT(CURRENT_RESOLUTION),
+    [TELEM_EPS_ADCS_3V3_CURRENT] = FIXED_POINT(CURRENT_RESOLUTION),
+    [TELEM_EPS_OBC_3V3_CURRENT] = FIXED_POINT(CURRENT_RESOLUTION),
+
+    // Voltage values
+    [TELEM_EPS_COMMS_5V_VOLTAGE] = FIXED_POINT(VOLTAGE_RESOLUTION),
+    [TELEM_EPS_COMMS_3V3_VOLTAGE] = FIXED_POINT(VOLTAGE_RESOLUTION),
+    [TELEM_EPS_MAGNETORQUER_8V_VOLTAGE] = FIXED_POINT(VOLTAGE_RESOLUTION),
+    [TELEM_EPS_ADCS_5V_VOLTAGE] = FIXED_POINT(VOLTAGE_RESOLUTION),
+    [TELEM_EPS_ADCS_3V3_VOLTAGE] = FIXED_POINT(VOLTAGE_RESOLUTION),
+    [TELEM_EPS_OBC_3V3_VOLTAGE] = FIXED_POINT(VOLTAGE_RESOLUTION),
+
+    [TELEM_OBC_STATE] = STATE,
+    [TELEM_EPS_STATE] = STATE,
+
+    [TELEM_NUM_CSP_PACKETS_RCVD] = {.encoding = TELEM_ENCODING_UINT},
+    [TELEM_PONG] = {.encoding = TELEM_ENCODING_NONE},
+};
+
+#define NUM_TELEM_SCHEMAS (sizeof(telemSchemas) / sizeof(telemSchemas[0]))
+
+_Static_assert(NUM_TELEM_SCHEMAS <= TELEM_RECORD_ID_MASK + 1U, "telemetry IDs don't fit in a record header");
+
+const telemetry_schema_t *getTelemetrySchema(telemetry_data_id_t id) {
+  if (id == TELEM_NONE || (uint32_t)id >= NUM_TELEM_SCHEMAS) {
+    return NULL;
+  }
+
+  return &telemSchemas[id];
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "obc_gs_telemetry_id.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Telemetry packets fit as many samples as they can into a fixed-size buffer (one RS block on the downlink):
+ *
+ *   | base timestamp (4B) | records | zero padding |
+ *
+ * Record: | flags (2 bits) + ID (6 bits) | timestamp delta | value | run length | run interval |
+ *
+ * The timestamp delta is the sample's timestamp minus the previous record's last timestamp (the base timestamp for the
+ * first record), zigzag coded since samples aren't always in time order. How the value is coded is set by the ID's
+ * schema:
+ *  - TELEM_ENCODING_NONE: no value
+ *  - TELEM_ENCODING_FIXED_POINT: the value in steps of the schema's resolution, as the zigzag coded difference from the
+ *    last value of the ID in the packet (0 for the first). A value that can't be quantised is sent as a big-endian
+ *    float instead, with TELEM_RECORD_FLAG_RAW set, and isn't used as the last value of the ID
+ *  - TELEM_ENCODING_STATE: 1 byte
+ *  - TELEM_ENCODING_UINT: the value as it is
+ * The run length and interval are only there if TELEM_RECORD_FLAG_RUN is set, which it can only be for states. The
+ * record then also stands for run length more samples of the same value, each run interval seconds after the one
+ * before. Integers other than the base timestamp are variable-length (7 bits per byte, least significant group first,
+ * top bit set on every byte but the last). A zero byte where a record would start ends the packet. */
+
+#define TELEM_PACKET_HEADER_SIZE 4U
+
+#define TELEM_RECORD_FLAG_RUN 0x80U
+#define TELEM_RECORD_FLAG_RAW 0x40U
+#define TELEM_RECORD_ID_MASK 0x3FU
+
+// Longest encoding of a uint32_t as a variable-length integer
+#define TELEM_VARINT_MAX_SIZE 5U
+
+// Header, timestamp delta, value, run length and run interval
+#define TELEM_RECORD_MAX_SIZE (1U + 4U * TELEM_VARINT_MAX_SIZE)
+
+typedef enum {
+  TELEM_ENCODING_NONE,
+  TELEM_ENCODING_FIXED_POINT,
+  TELEM_ENCODING_STATE,
+  TELEM_ENCODING_UINT,
+} telemetry_encoding_t;
+
+/**
+ * @brief How a telemetry ID's value is coded in telemetry packets
+ */
+typedef struct {
+  telemetry_encoding_t encoding;
+  float resolution;  // For TELEM_ENCODING_FIXED_POINT, the value of one step
+} telemetry_schema_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the schema of a telemetry ID
+ *
+ * @param id The telemetry ID
+ * @return const telemetry_schema_t* The ID's schema, or NULL if the ID can't be sent in telemetry packets
+ */
+const telemetry_schema_t *getTelemetrySchema(telemetry_data_id_t id);
+
+#ifdef __cplusplus
+}
+#endif
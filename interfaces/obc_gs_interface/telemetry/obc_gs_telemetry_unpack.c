@@ -1,17 +1,24 @@
 #include "obc_gs_telemetry_unpack.h"
 #include "obc_gs_telemetry_data.h"
 #include "obc_gs_telemetry_id.h"
+#include "obc_gs_telemetry_schema.h"
 #include "data_unpack_utils.h"
 #include "obc_gs_errors.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 /* Declare all unpack functions for telemetry data */
 static void unpackObcTemp(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
 static void unpackObcState(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
 static void unpackPong(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
 
+/* Helpers for telemetry packets */
+static obc_gs_error_code_t unpackVarint(telemetry_packet_reader_t *reader, uint32_t *value);
+static uint32_t zigzagDecode(uint32_t value);
+
 typedef void (*telemetry_unpack_func_t)(const uint8_t *, uint32_t *, telemetry_data_t *);
 
 static const telemetry_unpack_func_t telemUnpackFns[] = {
@@ -49,6 +56,149 @@ obc_gs_error_code_t unpackTelemetry(const uint8_t *buffer, uint32_t *offset, tel
   return OBC_GS_ERR_CODE_SUCCESS;
 }
 
+obc_gs_error_code_t initTelemetryPacketReader(telemetry_packet_reader_t *reader, const uint8_t *buffer,
+                                              size_t buffLen) {
+  if (reader == NULL || buffer == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (buffLen < TELEM_PACKET_HEADER_SIZE) {
+    return OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  uint32_t offset = 0;
+  reader->lastTimestamp = unpackUint32(buffer, &offset);
+
+  reader->buffer = buffer;
+  reader->len = buffLen;
+  reader->offset = offset;
+  memset(reader->lastValues, 0, sizeof(reader->lastValues));
+  reader->runSamplesLeft = 0;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t unpackNextTelemetryFromPacket(telemetry_packet_reader_t *reader, telemetry_data_t *data) {
+  obc_gs_error_code_t errCode;
+
+  if (reader == NULL || data == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  if (reader->runSamplesLeft > 0) {
+    reader->run.timestamp += reader->runInterval;
+    reader->runSamplesLeft--;
+    reader->lastTimestamp = reader->run.timestamp;
+    *data = reader->run;
+    return OBC_GS_ERR_CODE_SUCCESS;
+  }
+
+  if (reader->offset >= reader->len || reader->buffer[reader->offset] == 0) {
+    return OBC_GS_ERR_CODE_END_OF_PACKET;
+  }
+
+  uint8_t header = reader->buffer[reader->offset++];
+  telemetry_data_id_t id = (telemetry_data_id_t)(header & TELEM_RECORD_ID_MASK);
+
+  const telemetry_schema_t *schema = getTelemetrySchema(id);
+  if (schema == NULL) {
+    return OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET;
+  }
+
+  bool isRaw = (header & TELEM_RECORD_FLAG_RAW) != 0;
+  bool isRun = (header & TELEM_RECORD_FLAG_RUN) != 0;
+  if ((isRaw && schema->encoding != TELEM_ENCODING_FIXED_POINT) ||
+      (isRun && schema->encoding != TELEM_ENCODING_STATE)) {
+    return OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET;
+  }
+
+  uint32_t timestampDelta;
+  errCode = unpackVarint(reader, &timestampDelta);
+  if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+    return errCode;
+  }
+
+  telemetry_data_t unpacked = {0};
+  unpacked.id = id;
+  unpacked.timestamp = reader->lastTimestamp + zigzagDecode(timestampDelta);
+
+  uint32_t value = 0;
+  uint32_t offset = (uint32_t)reader->offset;
+  switch (schema->encoding) {
+    case TELEM_ENCODING_FIXED_POINT:
+      if (isRaw) {
+        if (reader->offset + sizeof(float) > reader->len) {
+          return OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET;
+        }
+        unpacked.obcTemp = unpackFloat(reader->buffer, &offset);
+        reader->offset = offset;
+        break;
+      }
+
+      errCode = unpackVarint(reader, &value);
+      if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+        return errCode;
+      }
+      reader->lastValues[id] = (int32_t)((uint32_t)reader->lastValues[id] + zigzagDecode(value));
+      unpacked.obcTemp = (float)reader->lastValues[id] * schema->resolution;
+      break;
+    case TELEM_ENCODING_STATE:
+      if (reader->offset >= reader->len) {
+        return OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET;
+      }
+      unpacked.obcState = unpackUint8(reader->buffer, &offset);
+      reader->offset = offset;
+      break;
+    case TELEM_ENCODING_UINT:
+      errCode = unpackVarint(reader, &unpacked.numCspPacketsRcvd);
+      if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+        return errCode;
+      }
+      break;
+    case TELEM_ENCODING_NONE:
+      break;
+  }
+
+  if (isRun) {
+    errCode = unpackVarint(reader, &reader->runSamplesLeft);
+    if (errCode == OBC_GS_ERR_CODE_SUCCESS) {
+      errCode = unpackVarint(reader, &reader->runInterval);
+    }
+    if (errCode != OBC_GS_ERR_CODE_SUCCESS) {
+      reader->runSamplesLeft = 0;
+      return errCode;
+    }
+    reader->run = unpacked;
+  }
+
+  reader->lastTimestamp = unpacked.timestamp;
+  *data = unpacked;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+static obc_gs_error_code_t unpackVarint(telemetry_packet_reader_t *reader, uint32_t *value) {
+  *value = 0;
+  for (uint8_t i = 0; i < TELEM_VARINT_MAX_SIZE; ++i) {
+    if (reader->offset >= reader->len) {
+      return OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET;
+    }
+
+    uint8_t byte = reader->buffer[reader->offset++];
+    *value |= (uint32_t)(byte & 0x7FU) << (7U * i);
+    if ((byte & 0x80U) == 0) {
+      return OBC_GS_ERR_CODE_SUCCESS;
+    }
+  }
+
+  return OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET;
+}
+
+static uint32_t zigzagDecode(uint32_t value) {
+  // Back to the two's complement difference
+  return (value >> 1) ^ (0U - (value & 1U));
+}
+
 static void unpackObcTemp(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data) {
   data->obcTemp = unpackFloat(buffer, offset);
 }
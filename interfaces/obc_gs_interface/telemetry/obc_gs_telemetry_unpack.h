@@ -2,10 +2,28 @@
 
 #include "obc_gs_errors.h"
 #include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
 
 #include <stdint.h>
 #include <stddef.h>
 
+/**
+ * @brief A telemetry packet being read, laid out as described in obc_gs_telemetry_schema.h
+ */
+typedef struct {
+  const uint8_t *buffer;
+  size_t len;
+  size_t offset;
+
+  uint32_t lastTimestamp;
+  int32_t lastValues[TELEMETRY_NUM_IDS];  // In steps of each fixed-point ID's resolution
+
+  // Samples of the last record's run that haven't been read yet
+  telemetry_data_t run;
+  uint32_t runSamplesLeft;
+  uint32_t runInterval;
+} telemetry_packet_reader_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -19,6 +37,25 @@ extern "C" {
  */
 obc_gs_error_code_t unpackTelemetry(const uint8_t *buffer, uint32_t *offset, telemetry_data_t *data);
 
+/**
+ * @brief Start reading the samples in a telemetry packet
+ *
+ * @param reader The reader to set up
+ * @param buffer The packet
+ * @param buffLen The length of the packet
+ */
+obc_gs_error_code_t initTelemetryPacketReader(telemetry_packet_reader_t *reader, const uint8_t *buffer, size_t buffLen);
+
+/**
+ * @brief Unpack the next sample in a telemetry packet
+ *
+ * @param reader The packet's reader
+ * @param data The telemetry data to unpack into
+ * @return OBC_GS_ERR_CODE_SUCCESS if a sample was unpacked, OBC_GS_ERR_CODE_END_OF_PACKET if every sample has been
+ * read, OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET if the rest of the packet can't be read, otherwise error code
+ */
+obc_gs_error_code_t unpackNextTelemetryFromPacket(telemetry_packet_reader_t *reader, telemetry_data_t *data);
+
 #ifdef __cplusplus
 }
 #endif
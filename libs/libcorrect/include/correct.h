@@ -1,5 +1,6 @@
 #ifndef CORRECT_H
 #define CORRECT_H
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifndef _MSC_VER
@@ -9,6 +10,10 @@
 typedef ptrdiff_t ssize_t;
 #endif
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 // Reed-Solomon
 
 struct correct_reed_solomon;
@@ -85,6 +90,48 @@ correct_reed_solomon *correct_reed_solomon_create(uint16_t primitive_polynomial,
                                                   uint8_t generator_root_gap,
                                                   size_t num_roots);
 
+#define CORRECT_RS_CCSDS_BLOCK_LENGTH 255
+#define CORRECT_RS_CCSDS_PARITY_LENGTH 32
+#define CORRECT_RS_CCSDS_MESSAGE_LENGTH (CORRECT_RS_CCSDS_BLOCK_LENGTH - CORRECT_RS_CCSDS_PARITY_LENGTH)
+
+/* correct_reed_solomon_ccsds is storage for a codec set up by
+ * correct_reed_solomon_ccsds_init. Its members only mirror the size
+ * and alignment of the real codec so that it can be declared
+ * statically; don't access them.
+ */
+typedef struct {
+    struct {
+        size_t dummy_lengths[3];
+        uint8_t dummy_roots[2];
+        const void *dummy_pointers[11];
+        struct {
+            void *dummy_coeff;
+            unsigned int dummy_order;
+        } dummy_polynomials[13];
+        void (*dummy_function)(void);
+        bool dummy_flags[2];
+    } dummy_rs;
+    uint8_t dummy_scratch[CORRECT_RS_CCSDS_BLOCK_LENGTH + 17 * CORRECT_RS_CCSDS_PARITY_LENGTH + 7];
+} correct_reed_solomon_ccsds;
+
+/* correct_reed_solomon_ccsds_init sets up the same (255, 223) code as
+ * correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32)
+ * inside codec, without using the heap.
+ *
+ * The field, generator and decoder lookup tables are precomputed into
+ * const tables shared by every codec, so codec only holds the
+ * decoder's scratch buffers, under 1k. The decoder is ready straight away rather than
+ * being built on the first block with errors.
+ *
+ * The returned instance lives inside codec and can be passed to any
+ * function taking an rs instance. correct_reed_solomon_encode with it
+ * uses the table-driven ccsds encoder. Passing it to
+ * correct_reed_solomon_destroy does nothing.
+ *
+ * This function returns NULL if codec is NULL.
+ */
+correct_reed_solomon *correct_reed_solomon_ccsds_init(correct_reed_solomon_ccsds *codec);
+
 /* correct_reed_solomon_encode uses the rs instance to encode
  * parity information onto a block of data. msg_length should be
  * no more than the payload size for one block e.g. no more
@@ -102,6 +149,25 @@ correct_reed_solomon *correct_reed_solomon_create(uint16_t primitive_polynomial,
 ssize_t correct_reed_solomon_encode(correct_reed_solomon *rs, const uint8_t *msg, size_t msg_length,
                                     uint8_t *encoded);
 
+/* correct_reed_solomon_encode_ccsds encodes a block for the fixed
+ * (255, 223) code created by
+ * correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32)
+ * and produces exactly the same output as correct_reed_solomon_encode
+ * with such an instance.
+ *
+ * It needs no rs instance. The generator products are precomputed
+ * into a const table, so no heap memory is used, no reversed copy of
+ * the message is made and the parity is written directly after the
+ * message in encoded.
+ *
+ * msg_length should be no more than 223. encoded should be at least
+ * msg_length + 32 bytes long. msg and encoded may be the same pointer.
+ *
+ * This function returns the number of bytes written to encoded, or
+ * -1 if msg_length is too long.
+ */
+ssize_t correct_reed_solomon_encode_ccsds(const uint8_t *msg, size_t msg_length, uint8_t *encoded);
+
 /* correct_reed_solomon_decode uses the rs instance to decode
  * a payload from a block containing payload and parity bytes.
  * This function can recover in spite of some bytes being corrupted.
@@ -152,11 +218,70 @@ ssize_t correct_reed_solomon_decode_with_erasures(correct_reed_solomon *rs, cons
                                                   const uint8_t *erasure_locations,
                                                   size_t erasure_length, uint8_t *msg);
 
+/* correct_reed_solomon_decode_ccsds decodes a block for the fixed
+ * (255, 223) code and produces exactly the same output as
+ * correct_reed_solomon_decode. rs must have been created with
+ * correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32).
+ *
+ * All 32 syndromes are found in a single pass over encoded, without
+ * copying or reversing it. If they are all zero the message is copied
+ * straight to msg and rs is not touched, so clean blocks never
+ * allocate the decoder tables. Otherwise the block is handed to the
+ * same error correction as correct_reed_solomon_decode.
+ *
+ * The syndrome pass uses the kernel chosen by
+ * correct_reed_solomon_ccsds_set_syndrome_kernel, which by default is
+ * the fastest one the cpu supports. rs keeps that kernel from then on.
+ *
+ * encoded_length should be between 32 and 255. msg and encoded may be
+ * the same pointer.
+ *
+ * This function returns a positive number of bytes written to msg
+ * if it has decoded or -1 if it has encountered an error.
+ */
+ssize_t correct_reed_solomon_decode_ccsds(correct_reed_solomon *rs, const uint8_t *encoded,
+                                          size_t encoded_length, uint8_t *msg);
+
+typedef enum {
+    CORRECT_RS_SYNDROME_KERNEL_AUTO = 0,
+    CORRECT_RS_SYNDROME_KERNEL_SCALAR,
+    CORRECT_RS_SYNDROME_KERNEL_SSSE3,
+    CORRECT_RS_SYNDROME_KERNEL_AVX2,
+} correct_rs_syndrome_kernel;
+
+/* correct_reed_solomon_ccsds_set_syndrome_kernel picks the syndrome
+ * kernel used by correct_reed_solomon_decode_ccsds.
+ * CORRECT_RS_SYNDROME_KERNEL_AUTO picks the fastest kernel the cpu
+ * supports at runtime. The SSSE3 and AVX2 kernels are only built for
+ * x86 targets.
+ *
+ * Each rs instance keeps the kernel that was selected when it was set
+ * up by correct_reed_solomon_ccsds_init, or when it first decoded a
+ * block with correct_reed_solomon_decode_ccsds if it came from
+ * correct_reed_solomon_create. Change the kernel before setting up the
+ * instances that should use it, and not while other threads are
+ * setting up instances.
+ *
+ * This function returns false and leaves the selection unchanged if
+ * the kernel isn't available on this cpu.
+ */
+bool correct_reed_solomon_ccsds_set_syndrome_kernel(correct_rs_syndrome_kernel kernel);
+
+/* correct_reed_solomon_ccsds_syndrome_kernel returns the kernel that
+ * rs instances set up from now on will use, never
+ * CORRECT_RS_SYNDROME_KERNEL_AUTO.
+ */
+correct_rs_syndrome_kernel correct_reed_solomon_ccsds_syndrome_kernel(void);
+
 /* correct_reed_solomon_destroy releases the resources
  * associated with rs. This pointer should not be
  * used for any functions after this call.
  */
 void correct_reed_solomon_destroy(correct_reed_solomon *rs);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
 
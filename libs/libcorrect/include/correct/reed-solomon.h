@@ -31,6 +31,10 @@ typedef struct {
     unsigned int order;
 } polynomial_t;
 
+// finds all CORRECT_RS_CCSDS_PARITY_LENGTH syndromes of a ccsds block, see decode_ccsds.c
+typedef void (*ccsds_syndrome_kernel_t)(field_t field, const uint8_t *encoded, size_t encoded_length,
+                                        field_element_t *syndromes);
+
 struct correct_reed_solomon {
     size_t block_length;
     size_t message_length;
@@ -41,9 +45,11 @@ struct correct_reed_solomon {
 
     field_t field;
 
+    // these are only read once built, so a ccsds codec can point them at the const tables
+    //   in tables_ccsds.c instead of building them on the heap
     polynomial_t generator;
-    field_element_t *generator_roots;
-    field_logarithm_t **generator_root_exp;
+    const field_element_t *generator_roots;
+    const field_logarithm_t *const *generator_root_exp;
 
     polynomial_t encoded_polynomial;
     polynomial_t encoded_remainder;
@@ -58,7 +64,7 @@ struct correct_reed_solomon {
     field_element_t *error_vals;
     field_logarithm_t *error_locations;
 
-    field_logarithm_t **element_exp;
+    const field_logarithm_t *const *element_exp;
 
     // scratch
     // (do no allocations at steady state)
@@ -70,7 +76,20 @@ struct correct_reed_solomon {
     polynomial_t error_evaluator;
     polynomial_t error_locator_derivative;
     polynomial_t init_from_roots_scratch[2];
+
+    // used during erasure decoding
+    field_element_t *syndrome_copy;
+    polynomial_t combined_locator;
+
+    // syndrome kernel used by correct_reed_solomon_decode_ccsds. correct_reed_solomon_ccsds_init
+    //   picks it up front; other codecs pick it on their first ccsds decode. the process wide
+    //   selection is only read then, so decoding never writes anything shared between codecs
+    ccsds_syndrome_kernel_t ccsds_find_syndromes;
+
     bool has_init_decode;
 
+    // set by correct_reed_solomon_ccsds_init. nothing above was allocated, so
+    //   correct_reed_solomon_destroy leaves it alone
+    bool has_static_storage;
 };
 #endif
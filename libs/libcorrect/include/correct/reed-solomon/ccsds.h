@@ -0,0 +1,45 @@
+#ifndef CORRECT_REED_SOLOMON_CCSDS
+#define CORRECT_REED_SOLOMON_CCSDS
+#include "correct/reed-solomon.h"
+
+#define CCSDS_RS_ROOTS CORRECT_RS_CCSDS_PARITY_LENGTH
+
+// the real layout behind correct_reed_solomon_ccsds
+// only the buffers that decoding writes to are here, sized for 32 roots. the
+//   field, generator and lookup tables are shared by every codec and are const,
+//   so on the OBC they stay in flash
+typedef struct {
+    correct_reed_solomon rs;
+
+    field_element_t syndromes[CCSDS_RS_ROOTS];
+    field_element_t modified_syndromes[2 * CCSDS_RS_ROOTS];
+    field_element_t received_polynomial[CORRECT_RS_CCSDS_BLOCK_LENGTH];
+    field_element_t error_locator[CCSDS_RS_ROOTS + 1];
+    field_element_t error_locator_log[CCSDS_RS_ROOTS + 1];
+    field_element_t erasure_locator[CCSDS_RS_ROOTS + 1];
+    field_element_t error_roots[2 * CCSDS_RS_ROOTS];
+    field_element_t error_vals[CCSDS_RS_ROOTS];
+    field_logarithm_t error_locations[CCSDS_RS_ROOTS];
+
+    field_element_t last_error_locator[CCSDS_RS_ROOTS + 1];
+    field_element_t error_evaluator[CCSDS_RS_ROOTS];
+    field_element_t error_locator_derivative[CCSDS_RS_ROOTS];
+    field_element_t init_from_roots_scratch[2][CCSDS_RS_ROOTS + 1];
+
+    field_element_t syndrome_copy[CCSDS_RS_ROOTS];
+    field_element_t combined_locator[CCSDS_RS_ROOTS + 1];
+} ccsds_rs_codec_t;
+
+// tables for correct_rs_primitive_polynomial_ccsds with first_consecutive_root = 1 and
+//   generator_root_gap = 1, laid out exactly as correct_reed_solomon_create and
+//   correct_reed_solomon_decoder_create build them. see tables_ccsds.c
+extern const field_element_t correct_rs_ccsds_exp[512];
+extern const field_logarithm_t correct_rs_ccsds_log[256];
+extern const field_element_t correct_rs_ccsds_generator[CCSDS_RS_ROOTS + 1];
+extern const field_element_t correct_rs_ccsds_generator_roots[CCSDS_RS_ROOTS];
+extern const field_logarithm_t *const correct_rs_ccsds_generator_root_exp[CCSDS_RS_ROOTS];
+extern const field_logarithm_t *const correct_rs_ccsds_element_exp[256];
+
+// the syndrome kernel picked by correct_reed_solomon_ccsds_set_syndrome_kernel. see decode_ccsds.c
+ccsds_syndrome_kernel_t correct_reed_solomon_ccsds_kernel_function(void);
+#endif
@@ -1,3 +1,10 @@
 #include "correct/reed-solomon.h"
 #include "correct/reed-solomon/field.h"
 #include "correct/reed-solomon/polynomial.h"
+
+void correct_reed_solomon_decoder_create(correct_reed_solomon *rs);
+
+// runs error location and correction on a block whose syndromes are already in rs->syndromes
+//   and whose reversed, zero padded coefficients are already in rs->received_polynomial
+// writes the corrected message to msg and returns its length, or -1 if the block can't be corrected
+ssize_t reed_solomon_correct_errors(correct_reed_solomon *rs, size_t encoded_length, uint8_t *msg);
@@ -1,3 +1,4 @@
+#include "correct/reed-solomon/decode.h"
 #include "correct/reed-solomon/encode.h"
 #include "sys_heap.h"
 
@@ -11,7 +12,8 @@
 //   these syndromes are all zero, then we can conclude the error polynomial is also
 //   zero. if they're nonzero, then we know our message received an error in transit.
 // returns true if syndromes are all zero
-static bool reed_solomon_find_syndromes(field_t field, polynomial_t msgpoly, field_logarithm_t **generator_root_exp,
+static bool reed_solomon_find_syndromes(field_t field, polynomial_t msgpoly,
+                                        const field_logarithm_t *const *generator_root_exp,
                                         field_element_t *syndromes, size_t min_distance) {
     bool all_zero = true;
     memset(syndromes, 0, min_distance * sizeof(field_element_t));
@@ -122,7 +124,7 @@ static unsigned int reed_solomon_find_error_locator(correct_reed_solomon *rs, si
 // find the roots of the error locator polynomial
 // Chien search
 bool reed_solomon_factorize_error_locator(field_t field, unsigned int num_skip, polynomial_t locator_log, field_element_t *roots,
-                                          field_logarithm_t **element_exp) {
+                                          const field_logarithm_t *const *element_exp) {
     // normally it'd be tricky to find all the roots
     // but, the finite field is awfully finite...
     // just brute force search across every field element
@@ -281,24 +283,31 @@ void correct_reed_solomon_decoder_create(correct_reed_solomon *rs) {
     // we would have to do this work in order to calculate the syndromes
     // if we save it, we can prevent the need to recalculate it on subsequent calls
     // total memory usage is min_distance * block_length bytes e.g. 32 * 255 ~= 8k
-    rs->generator_root_exp = sysMalloc(rs->min_distance * sizeof(field_logarithm_t *));
+    field_logarithm_t **generator_root_exp = sysMalloc(rs->min_distance * sizeof(field_logarithm_t *));
     for (unsigned int i = 0; i < rs->min_distance; i++) {
-        rs->generator_root_exp[i] = sysMalloc(rs->block_length * sizeof(field_logarithm_t));
-        polynomial_build_exp_lut(rs->field, rs->generator_roots[i], rs->block_length - 1, rs->generator_root_exp[i]);
+        generator_root_exp[i] = sysMalloc(rs->block_length * sizeof(field_logarithm_t));
+        polynomial_build_exp_lut(rs->field, rs->generator_roots[i], rs->block_length - 1, generator_root_exp[i]);
     }
+    rs->generator_root_exp = (const field_logarithm_t *const *)generator_root_exp;
 
     // calculate and store the first min_distance powers of every element in the field
     // we would have to do this for chien search anyway, and its size is only 256 * min_distance bytes
     // for min_distance = 32 this is 8k of memory, a pittance for the speedup we receive in exchange
     // we also get to reuse this work during error value calculation
-    rs->element_exp = sysMalloc(256 * sizeof(field_logarithm_t *));
+    field_logarithm_t **element_exp = sysMalloc(256 * sizeof(field_logarithm_t *));
     for (field_operation_t i = 0; i < 256; i++) {
-        rs->element_exp[i] = sysMalloc(rs->min_distance * sizeof(field_logarithm_t));
-        polynomial_build_exp_lut(rs->field, i, rs->min_distance - 1, rs->element_exp[i]);
+        element_exp[i] = sysMalloc(rs->min_distance * sizeof(field_logarithm_t));
+        polynomial_build_exp_lut(rs->field, i, rs->min_distance - 1, element_exp[i]);
     }
+    rs->element_exp = (const field_logarithm_t *const *)element_exp;
 
     rs->init_from_roots_scratch[0] = polynomial_create(rs->min_distance);
     rs->init_from_roots_scratch[1] = polynomial_create(rs->min_distance);
+
+    // the erasure locator times the error locator has at most min_distance roots,
+    //   otherwise it couldn't have been factorized
+    rs->syndrome_copy = sysMalloc(rs->min_distance * sizeof(field_element_t));
+    rs->combined_locator = polynomial_create(rs->min_distance);
 }
 
 ssize_t correct_reed_solomon_decode(correct_reed_solomon *rs, const uint8_t *encoded, size_t encoded_length,
@@ -346,6 +355,12 @@ ssize_t correct_reed_solomon_decode(correct_reed_solomon *rs, const uint8_t *enc
         return msg_length;
     }
 
+    return reed_solomon_correct_errors(rs, encoded_length, msg);
+}
+
+ssize_t reed_solomon_correct_errors(correct_reed_solomon *rs, size_t encoded_length, uint8_t *msg) {
+    size_t msg_length = encoded_length - rs->min_distance;
+
     unsigned int order = reed_solomon_find_error_locator(rs, 0);
     // XXX fix this vvvv
     rs->error_locator.order = order;
@@ -449,8 +464,7 @@ ssize_t correct_reed_solomon_decode_with_erasures(correct_reed_solomon *rs, cons
 
     reed_solomon_find_modified_syndromes(rs, rs->syndromes, rs->erasure_locator, rs->modified_syndromes);
 
-    field_element_t *syndrome_copy = sysMalloc(rs->min_distance * sizeof(field_element_t));
-    memcpy(syndrome_copy, rs->syndromes, rs->min_distance * sizeof(field_element_t));
+    memcpy(rs->syndrome_copy, rs->syndromes, rs->min_distance * sizeof(field_element_t));
 
     for (unsigned int i = erasure_length; i < rs->min_distance; i++) {
         rs->syndromes[i - erasure_length] = rs->modified_syndromes[i];
@@ -479,11 +493,11 @@ ssize_t correct_reed_solomon_decode_with_erasures(correct_reed_solomon *rs, cons
     if (!reed_solomon_factorize_error_locator(rs->field, erasure_length, rs->error_locator_log, rs->error_roots, rs->element_exp)) {
         // roots couldn't be found, so there were too many errors to deal with
         // RS has failed for this message
-        sysFreeMem(syndrome_copy);
         return -1;
     }
 
-    polynomial_t temp_poly = polynomial_create(rs->error_locator.order + erasure_length);
+    polynomial_t temp_poly = rs->combined_locator;
+    temp_poly.order = rs->error_locator.order + erasure_length;
     polynomial_mul(rs->field, rs->erasure_locator, rs->error_locator, temp_poly);
     polynomial_t placeholder_poly = rs->error_locator;
     rs->error_locator = temp_poly;
@@ -491,7 +505,7 @@ ssize_t correct_reed_solomon_decode_with_erasures(correct_reed_solomon *rs, cons
     reed_solomon_find_error_locations(rs->field, rs->generator_root_gap, rs->error_roots, rs->error_locations,
                                       rs->error_locator.order, erasure_length);
 
-    memcpy(rs->syndromes, syndrome_copy, rs->min_distance * sizeof(field_element_t));
+    memcpy(rs->syndromes, rs->syndrome_copy, rs->min_distance * sizeof(field_element_t));
 
     reed_solomon_find_error_values(rs);
 
@@ -506,8 +520,5 @@ ssize_t correct_reed_solomon_decode_with_erasures(correct_reed_solomon *rs, cons
         msg[i] = rs->received_polynomial.coeff[encoded_length - (i + 1)];
     }
 
-    polynomial_destroy(temp_poly);
-    sysFreeMem(syndrome_copy);
-
     return msg_length;
 }
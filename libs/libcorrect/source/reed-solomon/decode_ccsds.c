@@ -0,0 +1,761 @@
+#include "correct/reed-solomon/ccsds.h"
+#include "correct/reed-solomon/decode.h"
+
+// fast path decoder for the (255, 223) code built by
+//   correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32)
+//
+// the generic decoder reverses every block into rs->received_polynomial and then evaluates it
+//   once per syndrome, which is most of the cost of decoding a clean block. here all 32
+//   syndromes are found in one Horner pass straight over the encoded bytes
+//   (S_i = S_i * alpha^i + byte for i = 1..32), and a block with zero syndromes has its message
+//   copied straight out without touching the rs instance at all. only blocks with errors are
+//   copied into received_polynomial and handed to the generic error correction.
+//
+// on x86 hosts (the ground station) the pass is vectorised with SSSE3 or AVX2, selected at
+//   runtime from cpuid. each syndrome keeps a vector accumulator that is multiplied by
+//   alpha^(i * width) with PSHUFB lookups into split nibble product tables and xored with the
+//   next chunk of the block. the lanes are then folded together, multiplying by
+//   alpha^(i * width / 2), alpha^(i * width / 4) ... alpha^i, to give the syndrome.
+//   everywhere else the portable log/exp kernel is used.
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CCSDS_RS_HAVE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+static void ccsds_find_syndromes_scalar(field_t field, const uint8_t *encoded, size_t encoded_length,
+                                        field_element_t *syndromes) {
+    memset(syndromes, 0, CORRECT_RS_CCSDS_PARITY_LENGTH * sizeof(field_element_t));
+    for (size_t k = 0; k < encoded_length; k++) {
+        for (unsigned int i = 0; i < CORRECT_RS_CCSDS_PARITY_LENGTH; i++) {
+            field_element_t s = syndromes[i];
+            // log(s) + i + 1 is at most 286, which the 512 entry exp table covers without a mod
+            syndromes[i] = (s ? field.exp[field.log[s] + i + 1] : 0) ^ encoded[k];
+        }
+    }
+}
+
+#ifdef CCSDS_RS_HAVE_X86_KERNELS
+
+// ccsds_rs_nibble_product[e][0][n] = alpha^e * n and ccsds_rs_nibble_product[e][1][n] = alpha^e * (n << 4),
+//   so alpha^e * x = ccsds_rs_nibble_product[e][0][x & 0xf] ^ ccsds_rs_nibble_product[e][1][x >> 4]
+static const uint8_t ccsds_rs_nibble_product[255][2][16] = {
+    {{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F},
+     {0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0}},
+    {{0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E},
+     {0x00, 0x20, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xE0, 0x87, 0xA7, 0xC7, 0xE7, 0x07, 0x27, 0x47, 0x67}},
+    {{0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C},
+     {0x00, 0x40, 0x80, 0xC0, 0x87, 0xC7, 0x07, 0x47, 0x89, 0xC9, 0x09, 0x49, 0x0E, 0x4E, 0x8E, 0xCE}},
+    {{0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78},
+     {0x00, 0x80, 0x87, 0x07, 0x89, 0x09, 0x0E, 0x8E, 0x95, 0x15, 0x12, 0x92, 0x1C, 0x9C, 0x9B, 0x1B}},
+    {{0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0},
+     {0x00, 0x87, 0x89, 0x0E, 0x95, 0x12, 0x1C, 0x9B, 0xAD, 0x2A, 0x24, 0xA3, 0x38, 0xBF, 0xB1, 0x36}},
+    {{0x00, 0x20, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xE0, 0x87, 0xA7, 0xC7, 0xE7, 0x07, 0x27, 0x47, 0x67},
+     {0x00, 0x89, 0x95, 0x1C, 0xAD, 0x24, 0x38, 0xB1, 0xDD, 0x54, 0x48, 0xC1, 0x70, 0xF9, 0xE5, 0x6C}},
+    {{0x00, 0x40, 0x80, 0xC0, 0x87, 0xC7, 0x07, 0x47, 0x89, 0xC9, 0x09, 0x49, 0x0E, 0x4E, 0x8E, 0xCE},
+     {0x00, 0x95, 0xAD, 0x38, 0xDD, 0x48, 0x70, 0xE5, 0x3D, 0xA8, 0x90, 0x05, 0xE0, 0x75, 0x4D, 0xD8}},
+    {{0x00, 0x80, 0x87, 0x07, 0x89, 0x09, 0x0E, 0x8E, 0x95, 0x15, 0x12, 0x92, 0x1C, 0x9C, 0x9B, 0x1B},
+     {0x00, 0xAD, 0xDD, 0x70, 0x3D, 0x90, 0xE0, 0x4D, 0x7A, 0xD7, 0xA7, 0x0A, 0x47, 0xEA, 0x9A, 0x37}},
+    {{0x00, 0x87, 0x89, 0x0E, 0x95, 0x12, 0x1C, 0x9B, 0xAD, 0x2A, 0x24, 0xA3, 0x38, 0xBF, 0xB1, 0x36},
+     {0x00, 0xDD, 0x3D, 0xE0, 0x7A, 0xA7, 0x47, 0x9A, 0xF4, 0x29, 0xC9, 0x14, 0x8E, 0x53, 0xB3, 0x6E}},
+    {{0x00, 0x89, 0x95, 0x1C, 0xAD, 0x24, 0x38, 0xB1, 0xDD, 0x54, 0x48, 0xC1, 0x70, 0xF9, 0xE5, 0x6C},
+     {0x00, 0x3D, 0x7A, 0x47, 0xF4, 0xC9, 0x8E, 0xB3, 0x6F, 0x52, 0x15, 0x28, 0x9B, 0xA6, 0xE1, 0xDC}},
+    {{0x00, 0x95, 0xAD, 0x38, 0xDD, 0x48, 0x70, 0xE5, 0x3D, 0xA8, 0x90, 0x05, 0xE0, 0x75, 0x4D, 0xD8},
+     {0x00, 0x7A, 0xF4, 0x8E, 0x6F, 0x15, 0x9B, 0xE1, 0xDE, 0xA4, 0x2A, 0x50, 0xB1, 0xCB, 0x45, 0x3F}},
+    {{0x00, 0xAD, 0xDD, 0x70, 0x3D, 0x90, 0xE0, 0x4D, 0x7A, 0xD7, 0xA7, 0x0A, 0x47, 0xEA, 0x9A, 0x37},
+     {0x00, 0xF4, 0x6F, 0x9B, 0xDE, 0x2A, 0xB1, 0x45, 0x3B, 0xCF, 0x54, 0xA0, 0xE5, 0x11, 0x8A, 0x7E}},
+    {{0x00, 0xDD, 0x3D, 0xE0, 0x7A, 0xA7, 0x47, 0x9A, 0xF4, 0x29, 0xC9, 0x14, 0x8E, 0x53, 0xB3, 0x6E},
+     {0x00, 0x6F, 0xDE, 0xB1, 0x3B, 0x54, 0xE5, 0x8A, 0x76, 0x19, 0xA8, 0xC7, 0x4D, 0x22, 0x93, 0xFC}},
+    {{0x00, 0x3D, 0x7A, 0x47, 0xF4, 0xC9, 0x8E, 0xB3, 0x6F, 0x52, 0x15, 0x28, 0x9B, 0xA6, 0xE1, 0xDC},
+     {0x00, 0xDE, 0x3B, 0xE5, 0x76, 0xA8, 0x4D, 0x93, 0xEC, 0x32, 0xD7, 0x09, 0x9A, 0x44, 0xA1, 0x7F}},
+    {{0x00, 0x7A, 0xF4, 0x8E, 0x6F, 0x15, 0x9B, 0xE1, 0xDE, 0xA4, 0x2A, 0x50, 0xB1, 0xCB, 0x45, 0x3F},
+     {0x00, 0x3B, 0x76, 0x4D, 0xEC, 0xD7, 0x9A, 0xA1, 0x5F, 0x64, 0x29, 0x12, 0xB3, 0x88, 0xC5, 0xFE}},
+    {{0x00, 0xF4, 0x6F, 0x9B, 0xDE, 0x2A, 0xB1, 0x45, 0x3B, 0xCF, 0x54, 0xA0, 0xE5, 0x11, 0x8A, 0x7E},
+     {0x00, 0x76, 0xEC, 0x9A, 0x5F, 0x29, 0xB3, 0xC5, 0xBE, 0xC8, 0x52, 0x24, 0xE1, 0x97, 0x0D, 0x7B}},
+    {{0x00, 0x6F, 0xDE, 0xB1, 0x3B, 0x54, 0xE5, 0x8A, 0x76, 0x19, 0xA8, 0xC7, 0x4D, 0x22, 0x93, 0xFC},
+     {0x00, 0xEC, 0x5F, 0xB3, 0xBE, 0x52, 0xE1, 0x0D, 0xFB, 0x17, 0xA4, 0x48, 0x45, 0xA9, 0x1A, 0xF6}},
+    {{0x00, 0xDE, 0x3B, 0xE5, 0x76, 0xA8, 0x4D, 0x93, 0xEC, 0x32, 0xD7, 0x09, 0x9A, 0x44, 0xA1, 0x7F},
+     {0x00, 0x5F, 0xBE, 0xE1, 0xFB, 0xA4, 0x45, 0x1A, 0x71, 0x2E, 0xCF, 0x90, 0x8A, 0xD5, 0x34, 0x6B}},
+    {{0x00, 0x3B, 0x76, 0x4D, 0xEC, 0xD7, 0x9A, 0xA1, 0x5F, 0x64, 0x29, 0x12, 0xB3, 0x88, 0xC5, 0xFE},
+     {0x00, 0xBE, 0xFB, 0x45, 0x71, 0xCF, 0x8A, 0x34, 0xE2, 0x5C, 0x19, 0xA7, 0x93, 0x2D, 0x68, 0xD6}},
+    {{0x00, 0x76, 0xEC, 0x9A, 0x5F, 0x29, 0xB3, 0xC5, 0xBE, 0xC8, 0x52, 0x24, 0xE1, 0x97, 0x0D, 0x7B},
+     {0x00, 0xFB, 0x71, 0x8A, 0xE2, 0x19, 0x93, 0x68, 0x43, 0xB8, 0x32, 0xC9, 0xA1, 0x5A, 0xD0, 0x2B}},
+    {{0x00, 0xEC, 0x5F, 0xB3, 0xBE, 0x52, 0xE1, 0x0D, 0xFB, 0x17, 0xA4, 0x48, 0x45, 0xA9, 0x1A, 0xF6},
+     {0x00, 0x71, 0xE2, 0x93, 0x43, 0x32, 0xA1, 0xD0, 0x86, 0xF7, 0x64, 0x15, 0xC5, 0xB4, 0x27, 0x56}},
+    {{0x00, 0x5F, 0xBE, 0xE1, 0xFB, 0xA4, 0x45, 0x1A, 0x71, 0x2E, 0xCF, 0x90, 0x8A, 0xD5, 0x34, 0x6B},
+     {0x00, 0xE2, 0x43, 0xA1, 0x86, 0x64, 0xC5, 0x27, 0x8B, 0x69, 0xC8, 0x2A, 0x0D, 0xEF, 0x4E, 0xAC}},
+    {{0x00, 0xBE, 0xFB, 0x45, 0x71, 0xCF, 0x8A, 0x34, 0xE2, 0x5C, 0x19, 0xA7, 0x93, 0x2D, 0x68, 0xD6},
+     {0x00, 0x43, 0x86, 0xC5, 0x8B, 0xC8, 0x0D, 0x4E, 0x91, 0xD2, 0x17, 0x54, 0x1A, 0x59, 0x9C, 0xDF}},
+    {{0x00, 0xFB, 0x71, 0x8A, 0xE2, 0x19, 0x93, 0x68, 0x43, 0xB8, 0x32, 0xC9, 0xA1, 0x5A, 0xD0, 0x2B},
+     {0x00, 0x86, 0x8B, 0x0D, 0x91, 0x17, 0x1A, 0x9C, 0xA5, 0x23, 0x2E, 0xA8, 0x34, 0xB2, 0xBF, 0x39}},
+    {{0x00, 0x71, 0xE2, 0x93, 0x43, 0x32, 0xA1, 0xD0, 0x86, 0xF7, 0x64, 0x15, 0xC5, 0xB4, 0x27, 0x56},
+     {0x00, 0x8B, 0x91, 0x1A, 0xA5, 0x2E, 0x34, 0xBF, 0xCD, 0x46, 0x5C, 0xD7, 0x68, 0xE3, 0xF9, 0x72}},
+    {{0x00, 0xE2, 0x43, 0xA1, 0x86, 0x64, 0xC5, 0x27, 0x8B, 0x69, 0xC8, 0x2A, 0x0D, 0xEF, 0x4E, 0xAC},
+     {0x00, 0x91, 0xA5, 0x34, 0xCD, 0x5C, 0x68, 0xF9, 0x1D, 0x8C, 0xB8, 0x29, 0xD0, 0x41, 0x75, 0xE4}},
+    {{0x00, 0x43, 0x86, 0xC5, 0x8B, 0xC8, 0x0D, 0x4E, 0x91, 0xD2, 0x17, 0x54, 0x1A, 0x59, 0x9C, 0xDF},
+     {0x00, 0xA5, 0xCD, 0x68, 0x1D, 0xB8, 0xD0, 0x75, 0x3A, 0x9F, 0xF7, 0x52, 0x27, 0x82, 0xEA, 0x4F}},
+    {{0x00, 0x86, 0x8B, 0x0D, 0x91, 0x17, 0x1A, 0x9C, 0xA5, 0x23, 0x2E, 0xA8, 0x34, 0xB2, 0xBF, 0x39},
+     {0x00, 0xCD, 0x1D, 0xD0, 0x3A, 0xF7, 0x27, 0xEA, 0x74, 0xB9, 0x69, 0xA4, 0x4E, 0x83, 0x53, 0x9E}},
+    {{0x00, 0x8B, 0x91, 0x1A, 0xA5, 0x2E, 0x34, 0xBF, 0xCD, 0x46, 0x5C, 0xD7, 0x68, 0xE3, 0xF9, 0x72},
+     {0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB}},
+    {{0x00, 0x91, 0xA5, 0x34, 0xCD, 0x5C, 0x68, 0xF9, 0x1D, 0x8C, 0xB8, 0x29, 0xD0, 0x41, 0x75, 0xE4},
+     {0x00, 0x3A, 0x74, 0x4E, 0xE8, 0xD2, 0x9C, 0xA6, 0x57, 0x6D, 0x23, 0x19, 0xBF, 0x85, 0xCB, 0xF1}},
+    {{0x00, 0xA5, 0xCD, 0x68, 0x1D, 0xB8, 0xD0, 0x75, 0x3A, 0x9F, 0xF7, 0x52, 0x27, 0x82, 0xEA, 0x4F},
+     {0x00, 0x74, 0xE8, 0x9C, 0x57, 0x23, 0xBF, 0xCB, 0xAE, 0xDA, 0x46, 0x32, 0xF9, 0x8D, 0x11, 0x65}},
+    {{0x00, 0xCD, 0x1D, 0xD0, 0x3A, 0xF7, 0x27, 0xEA, 0x74, 0xB9, 0x69, 0xA4, 0x4E, 0x83, 0x53, 0x9E},
+     {0x00, 0xE8, 0x57, 0xBF, 0xAE, 0x46, 0xF9, 0x11, 0xDB, 0x33, 0x8C, 0x64, 0x75, 0x9D, 0x22, 0xCA}},
+    {{0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB},
+     {0x00, 0x57, 0xAE, 0xF9, 0xDB, 0x8C, 0x75, 0x22, 0x31, 0x66, 0x9F, 0xC8, 0xEA, 0xBD, 0x44, 0x13}},
+    {{0x00, 0x3A, 0x74, 0x4E, 0xE8, 0xD2, 0x9C, 0xA6, 0x57, 0x6D, 0x23, 0x19, 0xBF, 0x85, 0xCB, 0xF1},
+     {0x00, 0xAE, 0xDB, 0x75, 0x31, 0x9F, 0xEA, 0x44, 0x62, 0xCC, 0xB9, 0x17, 0x53, 0xFD, 0x88, 0x26}},
+    {{0x00, 0x74, 0xE8, 0x9C, 0x57, 0x23, 0xBF, 0xCB, 0xAE, 0xDA, 0x46, 0x32, 0xF9, 0x8D, 0x11, 0x65},
+     {0x00, 0xDB, 0x31, 0xEA, 0x62, 0xB9, 0x53, 0x88, 0xC4, 0x1F, 0xF5, 0x2E, 0xA6, 0x7D, 0x97, 0x4C}},
+    {{0x00, 0xE8, 0x57, 0xBF, 0xAE, 0x46, 0xF9, 0x11, 0xDB, 0x33, 0x8C, 0x64, 0x75, 0x9D, 0x22, 0xCA},
+     {0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0x0F, 0x3E, 0x6D, 0x5C, 0xCB, 0xFA, 0xA9, 0x98}},
+    {{0x00, 0x57, 0xAE, 0xF9, 0xDB, 0x8C, 0x75, 0x22, 0x31, 0x66, 0x9F, 0xC8, 0xEA, 0xBD, 0x44, 0x13},
+     {0x00, 0x62, 0xC4, 0xA6, 0x0F, 0x6D, 0xCB, 0xA9, 0x1E, 0x7C, 0xDA, 0xB8, 0x11, 0x73, 0xD5, 0xB7}},
+    {{0x00, 0xAE, 0xDB, 0x75, 0x31, 0x9F, 0xEA, 0x44, 0x62, 0xCC, 0xB9, 0x17, 0x53, 0xFD, 0x88, 0x26},
+     {0x00, 0xC4, 0x0F, 0xCB, 0x1E, 0xDA, 0x11, 0xD5, 0x3C, 0xF8, 0x33, 0xF7, 0x22, 0xE6, 0x2D, 0xE9}},
+    {{0x00, 0xDB, 0x31, 0xEA, 0x62, 0xB9, 0x53, 0x88, 0xC4, 0x1F, 0xF5, 0x2E, 0xA6, 0x7D, 0x97, 0x4C},
+     {0x00, 0x0F, 0x1E, 0x11, 0x3C, 0x33, 0x22, 0x2D, 0x78, 0x77, 0x66, 0x69, 0x44, 0x4B, 0x5A, 0x55}},
+    {{0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0x0F, 0x3E, 0x6D, 0x5C, 0xCB, 0xFA, 0xA9, 0x98},
+     {0x00, 0x1E, 0x3C, 0x22, 0x78, 0x66, 0x44, 0x5A, 0xF0, 0xEE, 0xCC, 0xD2, 0x88, 0x96, 0xB4, 0xAA}},
+    {{0x00, 0x62, 0xC4, 0xA6, 0x0F, 0x6D, 0xCB, 0xA9, 0x1E, 0x7C, 0xDA, 0xB8, 0x11, 0x73, 0xD5, 0xB7},
+     {0x00, 0x3C, 0x78, 0x44, 0xF0, 0xCC, 0x88, 0xB4, 0x67, 0x5B, 0x1F, 0x23, 0x97, 0xAB, 0xEF, 0xD3}},
+    {{0x00, 0xC4, 0x0F, 0xCB, 0x1E, 0xDA, 0x11, 0xD5, 0x3C, 0xF8, 0x33, 0xF7, 0x22, 0xE6, 0x2D, 0xE9},
+     {0x00, 0x78, 0xF0, 0x88, 0x67, 0x1F, 0x97, 0xEF, 0xCE, 0xB6, 0x3E, 0x46, 0xA9, 0xD1, 0x59, 0x21}},
+    {{0x00, 0x0F, 0x1E, 0x11, 0x3C, 0x33, 0x22, 0x2D, 0x78, 0x77, 0x66, 0x69, 0x44, 0x4B, 0x5A, 0x55},
+     {0x00, 0xF0, 0x67, 0x97, 0xCE, 0x3E, 0xA9, 0x59, 0x1B, 0xEB, 0x7C, 0x8C, 0xD5, 0x25, 0xB2, 0x42}},
+    {{0x00, 0x1E, 0x3C, 0x22, 0x78, 0x66, 0x44, 0x5A, 0xF0, 0xEE, 0xCC, 0xD2, 0x88, 0x96, 0xB4, 0xAA},
+     {0x00, 0x67, 0xCE, 0xA9, 0x1B, 0x7C, 0xD5, 0xB2, 0x36, 0x51, 0xF8, 0x9F, 0x2D, 0x4A, 0xE3, 0x84}},
+    {{0x00, 0x3C, 0x78, 0x44, 0xF0, 0xCC, 0x88, 0xB4, 0x67, 0x5B, 0x1F, 0x23, 0x97, 0xAB, 0xEF, 0xD3},
+     {0x00, 0xCE, 0x1B, 0xD5, 0x36, 0xF8, 0x2D, 0xE3, 0x6C, 0xA2, 0x77, 0xB9, 0x5A, 0x94, 0x41, 0x8F}},
+    {{0x00, 0x78, 0xF0, 0x88, 0x67, 0x1F, 0x97, 0xEF, 0xCE, 0xB6, 0x3E, 0x46, 0xA9, 0xD1, 0x59, 0x21},
+     {0x00, 0x1B, 0x36, 0x2D, 0x6C, 0x77, 0x5A, 0x41, 0xD8, 0xC3, 0xEE, 0xF5, 0xB4, 0xAF, 0x82, 0x99}},
+    {{0x00, 0xF0, 0x67, 0x97, 0xCE, 0x3E, 0xA9, 0x59, 0x1B, 0xEB, 0x7C, 0x8C, 0xD5, 0x25, 0xB2, 0x42},
+     {0x00, 0x36, 0x6C, 0x5A, 0xD8, 0xEE, 0xB4, 0x82, 0x37, 0x01, 0x5B, 0x6D, 0xEF, 0xD9, 0x83, 0xB5}},
+    {{0x00, 0x67, 0xCE, 0xA9, 0x1B, 0x7C, 0xD5, 0xB2, 0x36, 0x51, 0xF8, 0x9F, 0x2D, 0x4A, 0xE3, 0x84},
+     {0x00, 0x6C, 0xD8, 0xB4, 0x37, 0x5B, 0xEF, 0x83, 0x6E, 0x02, 0xB6, 0xDA, 0x59, 0x35, 0x81, 0xED}},
+    {{0x00, 0xCE, 0x1B, 0xD5, 0x36, 0xF8, 0x2D, 0xE3, 0x6C, 0xA2, 0x77, 0xB9, 0x5A, 0x94, 0x41, 0x8F},
+     {0x00, 0xD8, 0x37, 0xEF, 0x6E, 0xB6, 0x59, 0x81, 0xDC, 0x04, 0xEB, 0x33, 0xB2, 0x6A, 0x85, 0x5D}},
+    {{0x00, 0x1B, 0x36, 0x2D, 0x6C, 0x77, 0x5A, 0x41, 0xD8, 0xC3, 0xEE, 0xF5, 0xB4, 0xAF, 0x82, 0x99},
+     {0x00, 0x37, 0x6E, 0x59, 0xDC, 0xEB, 0xB2, 0x85, 0x3F, 0x08, 0x51, 0x66, 0xE3, 0xD4, 0x8D, 0xBA}},
+    {{0x00, 0x36, 0x6C, 0x5A, 0xD8, 0xEE, 0xB4, 0x82, 0x37, 0x01, 0x5B, 0x6D, 0xEF, 0xD9, 0x83, 0xB5},
+     {0x00, 0x6E, 0xDC, 0xB2, 0x3F, 0x51, 0xE3, 0x8D, 0x7E, 0x10, 0xA2, 0xCC, 0x41, 0x2F, 0x9D, 0xF3}},
+    {{0x00, 0x6C, 0xD8, 0xB4, 0x37, 0x5B, 0xEF, 0x83, 0x6E, 0x02, 0xB6, 0xDA, 0x59, 0x35, 0x81, 0xED},
+     {0x00, 0xDC, 0x3F, 0xE3, 0x7E, 0xA2, 0x41, 0x9D, 0xFC, 0x20, 0xC3, 0x1F, 0x82, 0x5E, 0xBD, 0x61}},
+    {{0x00, 0xD8, 0x37, 0xEF, 0x6E, 0xB6, 0x59, 0x81, 0xDC, 0x04, 0xEB, 0x33, 0xB2, 0x6A, 0x85, 0x5D},
+     {0x00, 0x3F, 0x7E, 0x41, 0xFC, 0xC3, 0x82, 0xBD, 0x7F, 0x40, 0x01, 0x3E, 0x83, 0xBC, 0xFD, 0xC2}},
+    {{0x00, 0x37, 0x6E, 0x59, 0xDC, 0xEB, 0xB2, 0x85, 0x3F, 0x08, 0x51, 0x66, 0xE3, 0xD4, 0x8D, 0xBA},
+     {0x00, 0x7E, 0xFC, 0x82, 0x7F, 0x01, 0x83, 0xFD, 0xFE, 0x80, 0x02, 0x7C, 0x81, 0xFF, 0x7D, 0x03}},
+    {{0x00, 0x6E, 0xDC, 0xB2, 0x3F, 0x51, 0xE3, 0x8D, 0x7E, 0x10, 0xA2, 0xCC, 0x41, 0x2F, 0x9D, 0xF3},
+     {0x00, 0xFC, 0x7F, 0x83, 0xFE, 0x02, 0x81, 0x7D, 0x7B, 0x87, 0x04, 0xF8, 0x85, 0x79, 0xFA, 0x06}},
+    {{0x00, 0xDC, 0x3F, 0xE3, 0x7E, 0xA2, 0x41, 0x9D, 0xFC, 0x20, 0xC3, 0x1F, 0x82, 0x5E, 0xBD, 0x61},
+     {0x00, 0x7F, 0xFE, 0x81, 0x7B, 0x04, 0x85, 0xFA, 0xF6, 0x89, 0x08, 0x77, 0x8D, 0xF2, 0x73, 0x0C}},
+    {{0x00, 0x3F, 0x7E, 0x41, 0xFC, 0xC3, 0x82, 0xBD, 0x7F, 0x40, 0x01, 0x3E, 0x83, 0xBC, 0xFD, 0xC2},
+     {0x00, 0xFE, 0x7B, 0x85, 0xF6, 0x08, 0x8D, 0x73, 0x6B, 0x95, 0x10, 0xEE, 0x9D, 0x63, 0xE6, 0x18}},
+    {{0x00, 0x7E, 0xFC, 0x82, 0x7F, 0x01, 0x83, 0xFD, 0xFE, 0x80, 0x02, 0x7C, 0x81, 0xFF, 0x7D, 0x03},
+     {0x00, 0x7B, 0xF6, 0x8D, 0x6B, 0x10, 0x9D, 0xE6, 0xD6, 0xAD, 0x20, 0x5B, 0xBD, 0xC6, 0x4B, 0x30}},
+    {{0x00, 0xFC, 0x7F, 0x83, 0xFE, 0x02, 0x81, 0x7D, 0x7B, 0x87, 0x04, 0xF8, 0x85, 0x79, 0xFA, 0x06},
+     {0x00, 0xF6, 0x6B, 0x9D, 0xD6, 0x20, 0xBD, 0x4B, 0x2B, 0xDD, 0x40, 0xB6, 0xFD, 0x0B, 0x96, 0x60}},
+    {{0x00, 0x7F, 0xFE, 0x81, 0x7B, 0x04, 0x85, 0xFA, 0xF6, 0x89, 0x08, 0x77, 0x8D, 0xF2, 0x73, 0x0C},
+     {0x00, 0x6B, 0xD6, 0xBD, 0x2B, 0x40, 0xFD, 0x96, 0x56, 0x3D, 0x80, 0xEB, 0x7D, 0x16, 0xAB, 0xC0}},
+    {{0x00, 0xFE, 0x7B, 0x85, 0xF6, 0x08, 0x8D, 0x73, 0x6B, 0x95, 0x10, 0xEE, 0x9D, 0x63, 0xE6, 0x18},
+     {0x00, 0xD6, 0x2B, 0xFD, 0x56, 0x80, 0x7D, 0xAB, 0xAC, 0x7A, 0x87, 0x51, 0xFA, 0x2C, 0xD1, 0x07}},
+    {{0x00, 0x7B, 0xF6, 0x8D, 0x6B, 0x10, 0x9D, 0xE6, 0xD6, 0xAD, 0x20, 0x5B, 0xBD, 0xC6, 0x4B, 0x30},
+     {0x00, 0x2B, 0x56, 0x7D, 0xAC, 0x87, 0xFA, 0xD1, 0xDF, 0xF4, 0x89, 0xA2, 0x73, 0x58, 0x25, 0x0E}},
+    {{0x00, 0xF6, 0x6B, 0x9D, 0xD6, 0x20, 0xBD, 0x4B, 0x2B, 0xDD, 0x40, 0xB6, 0xFD, 0x0B, 0x96, 0x60},
+     {0x00, 0x56, 0xAC, 0xFA, 0xDF, 0x89, 0x73, 0x25, 0x39, 0x6F, 0x95, 0xC3, 0xE6, 0xB0, 0x4A, 0x1C}},
+    {{0x00, 0x6B, 0xD6, 0xBD, 0x2B, 0x40, 0xFD, 0x96, 0x56, 0x3D, 0x80, 0xEB, 0x7D, 0x16, 0xAB, 0xC0},
+     {0x00, 0xAC, 0xDF, 0x73, 0x39, 0x95, 0xE6, 0x4A, 0x72, 0xDE, 0xAD, 0x01, 0x4B, 0xE7, 0x94, 0x38}},
+    {{0x00, 0xD6, 0x2B, 0xFD, 0x56, 0x80, 0x7D, 0xAB, 0xAC, 0x7A, 0x87, 0x51, 0xFA, 0x2C, 0xD1, 0x07},
+     {0x00, 0xDF, 0x39, 0xE6, 0x72, 0xAD, 0x4B, 0x94, 0xE4, 0x3B, 0xDD, 0x02, 0x96, 0x49, 0xAF, 0x70}},
+    {{0x00, 0x2B, 0x56, 0x7D, 0xAC, 0x87, 0xFA, 0xD1, 0xDF, 0xF4, 0x89, 0xA2, 0x73, 0x58, 0x25, 0x0E},
+     {0x00, 0x39, 0x72, 0x4B, 0xE4, 0xDD, 0x96, 0xAF, 0x4F, 0x76, 0x3D, 0x04, 0xAB, 0x92, 0xD9, 0xE0}},
+    {{0x00, 0x56, 0xAC, 0xFA, 0xDF, 0x89, 0x73, 0x25, 0x39, 0x6F, 0x95, 0xC3, 0xE6, 0xB0, 0x4A, 0x1C},
+     {0x00, 0x72, 0xE4, 0x96, 0x4F, 0x3D, 0xAB, 0xD9, 0x9E, 0xEC, 0x7A, 0x08, 0xD1, 0xA3, 0x35, 0x47}},
+    {{0x00, 0xAC, 0xDF, 0x73, 0x39, 0x95, 0xE6, 0x4A, 0x72, 0xDE, 0xAD, 0x01, 0x4B, 0xE7, 0x94, 0x38},
+     {0x00, 0xE4, 0x4F, 0xAB, 0x9E, 0x7A, 0xD1, 0x35, 0xBB, 0x5F, 0xF4, 0x10, 0x25, 0xC1, 0x6A, 0x8E}},
+    {{0x00, 0xDF, 0x39, 0xE6, 0x72, 0xAD, 0x4B, 0x94, 0xE4, 0x3B, 0xDD, 0x02, 0x96, 0x49, 0xAF, 0x70},
+     {0x00, 0x4F, 0x9E, 0xD1, 0xBB, 0xF4, 0x25, 0x6A, 0xF1, 0xBE, 0x6F, 0x20, 0x4A, 0x05, 0xD4, 0x9B}},
+    {{0x00, 0x39, 0x72, 0x4B, 0xE4, 0xDD, 0x96, 0xAF, 0x4F, 0x76, 0x3D, 0x04, 0xAB, 0x92, 0xD9, 0xE0},
+     {0x00, 0x9E, 0xBB, 0x25, 0xF1, 0x6F, 0x4A, 0xD4, 0x65, 0xFB, 0xDE, 0x40, 0x94, 0x0A, 0x2F, 0xB1}},
+    {{0x00, 0x72, 0xE4, 0x96, 0x4F, 0x3D, 0xAB, 0xD9, 0x9E, 0xEC, 0x7A, 0x08, 0xD1, 0xA3, 0x35, 0x47},
+     {0x00, 0xBB, 0xF1, 0x4A, 0x65, 0xDE, 0x94, 0x2F, 0xCA, 0x71, 0x3B, 0x80, 0xAF, 0x14, 0x5E, 0xE5}},
+    {{0x00, 0xE4, 0x4F, 0xAB, 0x9E, 0x7A, 0xD1, 0x35, 0xBB, 0x5F, 0xF4, 0x10, 0x25, 0xC1, 0x6A, 0x8E},
+     {0x00, 0xF1, 0x65, 0x94, 0xCA, 0x3B, 0xAF, 0x5E, 0x13, 0xE2, 0x76, 0x87, 0xD9, 0x28, 0xBC, 0x4D}},
+    {{0x00, 0x4F, 0x9E, 0xD1, 0xBB, 0xF4, 0x25, 0x6A, 0xF1, 0xBE, 0x6F, 0x20, 0x4A, 0x05, 0xD4, 0x9B},
+     {0x00, 0x65, 0xCA, 0xAF, 0x13, 0x76, 0xD9, 0xBC, 0x26, 0x43, 0xEC, 0x89, 0x35, 0x50, 0xFF, 0x9A}},
+    {{0x00, 0x9E, 0xBB, 0x25, 0xF1, 0x6F, 0x4A, 0xD4, 0x65, 0xFB, 0xDE, 0x40, 0x94, 0x0A, 0x2F, 0xB1},
+     {0x00, 0xCA, 0x13, 0xD9, 0x26, 0xEC, 0x35, 0xFF, 0x4C, 0x86, 0x5F, 0x95, 0x6A, 0xA0, 0x79, 0xB3}},
+    {{0x00, 0xBB, 0xF1, 0x4A, 0x65, 0xDE, 0x94, 0x2F, 0xCA, 0x71, 0x3B, 0x80, 0xAF, 0x14, 0x5E, 0xE5},
+     {0x00, 0x13, 0x26, 0x35, 0x4C, 0x5F, 0x6A, 0x79, 0x98, 0x8B, 0xBE, 0xAD, 0xD4, 0xC7, 0xF2, 0xE1}},
+    {{0x00, 0xF1, 0x65, 0x94, 0xCA, 0x3B, 0xAF, 0x5E, 0x13, 0xE2, 0x76, 0x87, 0xD9, 0x28, 0xBC, 0x4D},
+     {0x00, 0x26, 0x4C, 0x6A, 0x98, 0xBE, 0xD4, 0xF2, 0xB7, 0x91, 0xFB, 0xDD, 0x2F, 0x09, 0x63, 0x45}},
+    {{0x00, 0x65, 0xCA, 0xAF, 0x13, 0x76, 0xD9, 0xBC, 0x26, 0x43, 0xEC, 0x89, 0x35, 0x50, 0xFF, 0x9A},
+     {0x00, 0x4C, 0x98, 0xD4, 0xB7, 0xFB, 0x2F, 0x63, 0xE9, 0xA5, 0x71, 0x3D, 0x5E, 0x12, 0xC6, 0x8A}},
+    {{0x00, 0xCA, 0x13, 0xD9, 0x26, 0xEC, 0x35, 0xFF, 0x4C, 0x86, 0x5F, 0x95, 0x6A, 0xA0, 0x79, 0xB3},
+     {0x00, 0x98, 0xB7, 0x2F, 0xE9, 0x71, 0x5E, 0xC6, 0x55, 0xCD, 0xE2, 0x7A, 0xBC, 0x24, 0x0B, 0x93}},
+    {{0x00, 0x13, 0x26, 0x35, 0x4C, 0x5F, 0x6A, 0x79, 0x98, 0x8B, 0xBE, 0xAD, 0xD4, 0xC7, 0xF2, 0xE1},
+     {0x00, 0xB7, 0xE9, 0x5E, 0x55, 0xE2, 0xBC, 0x0B, 0xAA, 0x1D, 0x43, 0xF4, 0xFF, 0x48, 0x16, 0xA1}},
+    {{0x00, 0x26, 0x4C, 0x6A, 0x98, 0xBE, 0xD4, 0xF2, 0xB7, 0x91, 0xFB, 0xDD, 0x2F, 0x09, 0x63, 0x45},
+     {0x00, 0xE9, 0x55, 0xBC, 0xAA, 0x43, 0xFF, 0x16, 0xD3, 0x3A, 0x86, 0x6F, 0x79, 0x90, 0x2C, 0xC5}},
+    {{0x00, 0x4C, 0x98, 0xD4, 0xB7, 0xFB, 0x2F, 0x63, 0xE9, 0xA5, 0x71, 0x3D, 0x5E, 0x12, 0xC6, 0x8A},
+     {0x00, 0x55, 0xAA, 0xFF, 0xD3, 0x86, 0x79, 0x2C, 0x21, 0x74, 0x8B, 0xDE, 0xF2, 0xA7, 0x58, 0x0D}},
+    {{0x00, 0x98, 0xB7, 0x2F, 0xE9, 0x71, 0x5E, 0xC6, 0x55, 0xCD, 0xE2, 0x7A, 0xBC, 0x24, 0x0B, 0x93},
+     {0x00, 0xAA, 0xD3, 0x79, 0x21, 0x8B, 0xF2, 0x58, 0x42, 0xE8, 0x91, 0x3B, 0x63, 0xC9, 0xB0, 0x1A}},
+    {{0x00, 0xB7, 0xE9, 0x5E, 0x55, 0xE2, 0xBC, 0x0B, 0xAA, 0x1D, 0x43, 0xF4, 0xFF, 0x48, 0x16, 0xA1},
+     {0x00, 0xD3, 0x21, 0xF2, 0x42, 0x91, 0x63, 0xB0, 0x84, 0x57, 0xA5, 0x76, 0xC6, 0x15, 0xE7, 0x34}},
+    {{0x00, 0xE9, 0x55, 0xBC, 0xAA, 0x43, 0xFF, 0x16, 0xD3, 0x3A, 0x86, 0x6F, 0x79, 0x90, 0x2C, 0xC5},
+     {0x00, 0x21, 0x42, 0x63, 0x84, 0xA5, 0xC6, 0xE7, 0x8F, 0xAE, 0xCD, 0xEC, 0x0B, 0x2A, 0x49, 0x68}},
+    {{0x00, 0x55, 0xAA, 0xFF, 0xD3, 0x86, 0x79, 0x2C, 0x21, 0x74, 0x8B, 0xDE, 0xF2, 0xA7, 0x58, 0x0D},
+     {0x00, 0x42, 0x84, 0xC6, 0x8F, 0xCD, 0x0B, 0x49, 0x99, 0xDB, 0x1D, 0x5F, 0x16, 0x54, 0x92, 0xD0}},
+    {{0x00, 0xAA, 0xD3, 0x79, 0x21, 0x8B, 0xF2, 0x58, 0x42, 0xE8, 0x91, 0x3B, 0x63, 0xC9, 0xB0, 0x1A},
+     {0x00, 0x84, 0x8F, 0x0B, 0x99, 0x1D, 0x16, 0x92, 0xB5, 0x31, 0x3A, 0xBE, 0x2C, 0xA8, 0xA3, 0x27}},
+    {{0x00, 0xD3, 0x21, 0xF2, 0x42, 0x91, 0x63, 0xB0, 0x84, 0x57, 0xA5, 0x76, 0xC6, 0x15, 0xE7, 0x34},
+     {0x00, 0x8F, 0x99, 0x16, 0xB5, 0x3A, 0x2C, 0xA3, 0xED, 0x62, 0x74, 0xFB, 0x58, 0xD7, 0xC1, 0x4E}},
+    {{0x00, 0x21, 0x42, 0x63, 0x84, 0xA5, 0xC6, 0xE7, 0x8F, 0xAE, 0xCD, 0xEC, 0x0B, 0x2A, 0x49, 0x68},
+     {0x00, 0x99, 0xB5, 0x2C, 0xED, 0x74, 0x58, 0xC1, 0x5D, 0xC4, 0xE8, 0x71, 0xB0, 0x29, 0x05, 0x9C}},
+    {{0x00, 0x42, 0x84, 0xC6, 0x8F, 0xCD, 0x0B, 0x49, 0x99, 0xDB, 0x1D, 0x5F, 0x16, 0x54, 0x92, 0xD0},
+     {0x00, 0xB5, 0xED, 0x58, 0x5D, 0xE8, 0xB0, 0x05, 0xBA, 0x0F, 0x57, 0xE2, 0xE7, 0x52, 0x0A, 0xBF}},
+    {{0x00, 0x84, 0x8F, 0x0B, 0x99, 0x1D, 0x16, 0x92, 0xB5, 0x31, 0x3A, 0xBE, 0x2C, 0xA8, 0xA3, 0x27},
+     {0x00, 0xED, 0x5D, 0xB0, 0xBA, 0x57, 0xE7, 0x0A, 0xF3, 0x1E, 0xAE, 0x43, 0x49, 0xA4, 0x14, 0xF9}},
+    {{0x00, 0x8F, 0x99, 0x16, 0xB5, 0x3A, 0x2C, 0xA3, 0xED, 0x62, 0x74, 0xFB, 0x58, 0xD7, 0xC1, 0x4E},
+     {0x00, 0x5D, 0xBA, 0xE7, 0xF3, 0xAE, 0x49, 0x14, 0x61, 0x3C, 0xDB, 0x86, 0x92, 0xCF, 0x28, 0x75}},
+    {{0x00, 0x99, 0xB5, 0x2C, 0xED, 0x74, 0x58, 0xC1, 0x5D, 0xC4, 0xE8, 0x71, 0xB0, 0x29, 0x05, 0x9C},
+     {0x00, 0xBA, 0xF3, 0x49, 0x61, 0xDB, 0x92, 0x28, 0xC2, 0x78, 0x31, 0x8B, 0xA3, 0x19, 0x50, 0xEA}},
+    {{0x00, 0xB5, 0xED, 0x58, 0x5D, 0xE8, 0xB0, 0x05, 0xBA, 0x0F, 0x57, 0xE2, 0xE7, 0x52, 0x0A, 0xBF},
+     {0x00, 0xF3, 0x61, 0x92, 0xC2, 0x31, 0xA3, 0x50, 0x03, 0xF0, 0x62, 0x91, 0xC1, 0x32, 0xA0, 0x53}},
+    {{0x00, 0xED, 0x5D, 0xB0, 0xBA, 0x57, 0xE7, 0x0A, 0xF3, 0x1E, 0xAE, 0x43, 0x49, 0xA4, 0x14, 0xF9},
+     {0x00, 0x61, 0xC2, 0xA3, 0x03, 0x62, 0xC1, 0xA0, 0x06, 0x67, 0xC4, 0xA5, 0x05, 0x64, 0xC7, 0xA6}},
+    {{0x00, 0x5D, 0xBA, 0xE7, 0xF3, 0xAE, 0x49, 0x14, 0x61, 0x3C, 0xDB, 0x86, 0x92, 0xCF, 0x28, 0x75},
+     {0x00, 0xC2, 0x03, 0xC1, 0x06, 0xC4, 0x05, 0xC7, 0x0C, 0xCE, 0x0F, 0xCD, 0x0A, 0xC8, 0x09, 0xCB}},
+    {{0x00, 0xBA, 0xF3, 0x49, 0x61, 0xDB, 0x92, 0x28, 0xC2, 0x78, 0x31, 0x8B, 0xA3, 0x19, 0x50, 0xEA},
+     {0x00, 0x03, 0x06, 0x05, 0x0C, 0x0F, 0x0A, 0x09, 0x18, 0x1B, 0x1E, 0x1D, 0x14, 0x17, 0x12, 0x11}},
+    {{0x00, 0xF3, 0x61, 0x92, 0xC2, 0x31, 0xA3, 0x50, 0x03, 0xF0, 0x62, 0x91, 0xC1, 0x32, 0xA0, 0x53},
+     {0x00, 0x06, 0x0C, 0x0A, 0x18, 0x1E, 0x14, 0x12, 0x30, 0x36, 0x3C, 0x3A, 0x28, 0x2E, 0x24, 0x22}},
+    {{0x00, 0x61, 0xC2, 0xA3, 0x03, 0x62, 0xC1, 0xA0, 0x06, 0x67, 0xC4, 0xA5, 0x05, 0x64, 0xC7, 0xA6},
+     {0x00, 0x0C, 0x18, 0x14, 0x30, 0x3C, 0x28, 0x24, 0x60, 0x6C, 0x78, 0x74, 0x50, 0x5C, 0x48, 0x44}},
+    {{0x00, 0xC2, 0x03, 0xC1, 0x06, 0xC4, 0x05, 0xC7, 0x0C, 0xCE, 0x0F, 0xCD, 0x0A, 0xC8, 0x09, 0xCB},
+     {0x00, 0x18, 0x30, 0x28, 0x60, 0x78, 0x50, 0x48, 0xC0, 0xD8, 0xF0, 0xE8, 0xA0, 0xB8, 0x90, 0x88}},
+    {{0x00, 0x03, 0x06, 0x05, 0x0C, 0x0F, 0x0A, 0x09, 0x18, 0x1B, 0x1E, 0x1D, 0x14, 0x17, 0x12, 0x11},
+     {0x00, 0x30, 0x60, 0x50, 0xC0, 0xF0, 0xA0, 0x90, 0x07, 0x37, 0x67, 0x57, 0xC7, 0xF7, 0xA7, 0x97}},
+    {{0x00, 0x06, 0x0C, 0x0A, 0x18, 0x1E, 0x14, 0x12, 0x30, 0x36, 0x3C, 0x3A, 0x28, 0x2E, 0x24, 0x22},
+     {0x00, 0x60, 0xC0, 0xA0, 0x07, 0x67, 0xC7, 0xA7, 0x0E, 0x6E, 0xCE, 0xAE, 0x09, 0x69, 0xC9, 0xA9}},
+    {{0x00, 0x0C, 0x18, 0x14, 0x30, 0x3C, 0x28, 0x24, 0x60, 0x6C, 0x78, 0x74, 0x50, 0x5C, 0x48, 0x44},
+     {0x00, 0xC0, 0x07, 0xC7, 0x0E, 0xCE, 0x09, 0xC9, 0x1C, 0xDC, 0x1B, 0xDB, 0x12, 0xD2, 0x15, 0xD5}},
+    {{0x00, 0x18, 0x30, 0x28, 0x60, 0x78, 0x50, 0x48, 0xC0, 0xD8, 0xF0, 0xE8, 0xA0, 0xB8, 0x90, 0x88},
+     {0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D}},
+    {{0x00, 0x30, 0x60, 0x50, 0xC0, 0xF0, 0xA0, 0x90, 0x07, 0x37, 0x67, 0x57, 0xC7, 0xF7, 0xA7, 0x97},
+     {0x00, 0x0E, 0x1C, 0x12, 0x38, 0x36, 0x24, 0x2A, 0x70, 0x7E, 0x6C, 0x62, 0x48, 0x46, 0x54, 0x5A}},
+    {{0x00, 0x60, 0xC0, 0xA0, 0x07, 0x67, 0xC7, 0xA7, 0x0E, 0x6E, 0xCE, 0xAE, 0x09, 0x69, 0xC9, 0xA9},
+     {0x00, 0x1C, 0x38, 0x24, 0x70, 0x6C, 0x48, 0x54, 0xE0, 0xFC, 0xD8, 0xC4, 0x90, 0x8C, 0xA8, 0xB4}},
+    {{0x00, 0xC0, 0x07, 0xC7, 0x0E, 0xCE, 0x09, 0xC9, 0x1C, 0xDC, 0x1B, 0xDB, 0x12, 0xD2, 0x15, 0xD5},
+     {0x00, 0x38, 0x70, 0x48, 0xE0, 0xD8, 0x90, 0xA8, 0x47, 0x7F, 0x37, 0x0F, 0xA7, 0x9F, 0xD7, 0xEF}},
+    {{0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D},
+     {0x00, 0x70, 0xE0, 0x90, 0x47, 0x37, 0xA7, 0xD7, 0x8E, 0xFE, 0x6E, 0x1E, 0xC9, 0xB9, 0x29, 0x59}},
+    {{0x00, 0x0E, 0x1C, 0x12, 0x38, 0x36, 0x24, 0x2A, 0x70, 0x7E, 0x6C, 0x62, 0x48, 0x46, 0x54, 0x5A},
+     {0x00, 0xE0, 0x47, 0xA7, 0x8E, 0x6E, 0xC9, 0x29, 0x9B, 0x7B, 0xDC, 0x3C, 0x15, 0xF5, 0x52, 0xB2}},
+    {{0x00, 0x1C, 0x38, 0x24, 0x70, 0x6C, 0x48, 0x54, 0xE0, 0xFC, 0xD8, 0xC4, 0x90, 0x8C, 0xA8, 0xB4},
+     {0x00, 0x47, 0x8E, 0xC9, 0x9B, 0xDC, 0x15, 0x52, 0xB1, 0xF6, 0x3F, 0x78, 0x2A, 0x6D, 0xA4, 0xE3}},
+    {{0x00, 0x38, 0x70, 0x48, 0xE0, 0xD8, 0x90, 0xA8, 0x47, 0x7F, 0x37, 0x0F, 0xA7, 0x9F, 0xD7, 0xEF},
+     {0x00, 0x8E, 0x9B, 0x15, 0xB1, 0x3F, 0x2A, 0xA4, 0xE5, 0x6B, 0x7E, 0xF0, 0x54, 0xDA, 0xCF, 0x41}},
+    {{0x00, 0x70, 0xE0, 0x90, 0x47, 0x37, 0xA7, 0xD7, 0x8E, 0xFE, 0x6E, 0x1E, 0xC9, 0xB9, 0x29, 0x59},
+     {0x00, 0x9B, 0xB1, 0x2A, 0xE5, 0x7E, 0x54, 0xCF, 0x4D, 0xD6, 0xFC, 0x67, 0xA8, 0x33, 0x19, 0x82}},
+    {{0x00, 0xE0, 0x47, 0xA7, 0x8E, 0x6E, 0xC9, 0x29, 0x9B, 0x7B, 0xDC, 0x3C, 0x15, 0xF5, 0x52, 0xB2},
+     {0x00, 0xB1, 0xE5, 0x54, 0x4D, 0xFC, 0xA8, 0x19, 0x9A, 0x2B, 0x7F, 0xCE, 0xD7, 0x66, 0x32, 0x83}},
+    {{0x00, 0x47, 0x8E, 0xC9, 0x9B, 0xDC, 0x15, 0x52, 0xB1, 0xF6, 0x3F, 0x78, 0x2A, 0x6D, 0xA4, 0xE3},
+     {0x00, 0xE5, 0x4D, 0xA8, 0x9A, 0x7F, 0xD7, 0x32, 0xB3, 0x56, 0xFE, 0x1B, 0x29, 0xCC, 0x64, 0x81}},
+    {{0x00, 0x8E, 0x9B, 0x15, 0xB1, 0x3F, 0x2A, 0xA4, 0xE5, 0x6B, 0x7E, 0xF0, 0x54, 0xDA, 0xCF, 0x41},
+     {0x00, 0x4D, 0x9A, 0xD7, 0xB3, 0xFE, 0x29, 0x64, 0xE1, 0xAC, 0x7B, 0x36, 0x52, 0x1F, 0xC8, 0x85}},
+    {{0x00, 0x9B, 0xB1, 0x2A, 0xE5, 0x7E, 0x54, 0xCF, 0x4D, 0xD6, 0xFC, 0x67, 0xA8, 0x33, 0x19, 0x82},
+     {0x00, 0x9A, 0xB3, 0x29, 0xE1, 0x7B, 0x52, 0xC8, 0x45, 0xDF, 0xF6, 0x6C, 0xA4, 0x3E, 0x17, 0x8D}},
+    {{0x00, 0xB1, 0xE5, 0x54, 0x4D, 0xFC, 0xA8, 0x19, 0x9A, 0x2B, 0x7F, 0xCE, 0xD7, 0x66, 0x32, 0x83},
+     {0x00, 0xB3, 0xE1, 0x52, 0x45, 0xF6, 0xA4, 0x17, 0x8A, 0x39, 0x6B, 0xD8, 0xCF, 0x7C, 0x2E, 0x9D}},
+    {{0x00, 0xE5, 0x4D, 0xA8, 0x9A, 0x7F, 0xD7, 0x32, 0xB3, 0x56, 0xFE, 0x1B, 0x29, 0xCC, 0x64, 0x81},
+     {0x00, 0xE1, 0x45, 0xA4, 0x8A, 0x6B, 0xCF, 0x2E, 0x93, 0x72, 0xD6, 0x37, 0x19, 0xF8, 0x5C, 0xBD}},
+    {{0x00, 0x4D, 0x9A, 0xD7, 0xB3, 0xFE, 0x29, 0x64, 0xE1, 0xAC, 0x7B, 0x36, 0x52, 0x1F, 0xC8, 0x85},
+     {0x00, 0x45, 0x8A, 0xCF, 0x93, 0xD6, 0x19, 0x5C, 0xA1, 0xE4, 0x2B, 0x6E, 0x32, 0x77, 0xB8, 0xFD}},
+    {{0x00, 0x9A, 0xB3, 0x29, 0xE1, 0x7B, 0x52, 0xC8, 0x45, 0xDF, 0xF6, 0x6C, 0xA4, 0x3E, 0x17, 0x8D},
+     {0x00, 0x8A, 0x93, 0x19, 0xA1, 0x2B, 0x32, 0xB8, 0xC5, 0x4F, 0x56, 0xDC, 0x64, 0xEE, 0xF7, 0x7D}},
+    {{0x00, 0xB3, 0xE1, 0x52, 0x45, 0xF6, 0xA4, 0x17, 0x8A, 0x39, 0x6B, 0xD8, 0xCF, 0x7C, 0x2E, 0x9D},
+     {0x00, 0x93, 0xA1, 0x32, 0xC5, 0x56, 0x64, 0xF7, 0x0D, 0x9E, 0xAC, 0x3F, 0xC8, 0x5B, 0x69, 0xFA}},
+    {{0x00, 0xE1, 0x45, 0xA4, 0x8A, 0x6B, 0xCF, 0x2E, 0x93, 0x72, 0xD6, 0x37, 0x19, 0xF8, 0x5C, 0xBD},
+     {0x00, 0xA1, 0xC5, 0x64, 0x0D, 0xAC, 0xC8, 0x69, 0x1A, 0xBB, 0xDF, 0x7E, 0x17, 0xB6, 0xD2, 0x73}},
+    {{0x00, 0x45, 0x8A, 0xCF, 0x93, 0xD6, 0x19, 0x5C, 0xA1, 0xE4, 0x2B, 0x6E, 0x32, 0x77, 0xB8, 0xFD},
+     {0x00, 0xC5, 0x0D, 0xC8, 0x1A, 0xDF, 0x17, 0xD2, 0x34, 0xF1, 0x39, 0xFC, 0x2E, 0xEB, 0x23, 0xE6}},
+    {{0x00, 0x8A, 0x93, 0x19, 0xA1, 0x2B, 0x32, 0xB8, 0xC5, 0x4F, 0x56, 0xDC, 0x64, 0xEE, 0xF7, 0x7D},
+     {0x00, 0x0D, 0x1A, 0x17, 0x34, 0x39, 0x2E, 0x23, 0x68, 0x65, 0x72, 0x7F, 0x5C, 0x51, 0x46, 0x4B}},
+    {{0x00, 0x93, 0xA1, 0x32, 0xC5, 0x56, 0x64, 0xF7, 0x0D, 0x9E, 0xAC, 0x3F, 0xC8, 0x5B, 0x69, 0xFA},
+     {0x00, 0x1A, 0x34, 0x2E, 0x68, 0x72, 0x5C, 0x46, 0xD0, 0xCA, 0xE4, 0xFE, 0xB8, 0xA2, 0x8C, 0x96}},
+    {{0x00, 0xA1, 0xC5, 0x64, 0x0D, 0xAC, 0xC8, 0x69, 0x1A, 0xBB, 0xDF, 0x7E, 0x17, 0xB6, 0xD2, 0x73},
+     {0x00, 0x34, 0x68, 0x5C, 0xD0, 0xE4, 0xB8, 0x8C, 0x27, 0x13, 0x4F, 0x7B, 0xF7, 0xC3, 0x9F, 0xAB}},
+    {{0x00, 0xC5, 0x0D, 0xC8, 0x1A, 0xDF, 0x17, 0xD2, 0x34, 0xF1, 0x39, 0xFC, 0x2E, 0xEB, 0x23, 0xE6},
+     {0x00, 0x68, 0xD0, 0xB8, 0x27, 0x4F, 0xF7, 0x9F, 0x4E, 0x26, 0x9E, 0xF6, 0x69, 0x01, 0xB9, 0xD1}},
+    {{0x00, 0x0D, 0x1A, 0x17, 0x34, 0x39, 0x2E, 0x23, 0x68, 0x65, 0x72, 0x7F, 0x5C, 0x51, 0x46, 0x4B},
+     {0x00, 0xD0, 0x27, 0xF7, 0x4E, 0x9E, 0x69, 0xB9, 0x9C, 0x4C, 0xBB, 0x6B, 0xD2, 0x02, 0xF5, 0x25}},
+    {{0x00, 0x1A, 0x34, 0x2E, 0x68, 0x72, 0x5C, 0x46, 0xD0, 0xCA, 0xE4, 0xFE, 0xB8, 0xA2, 0x8C, 0x96},
+     {0x00, 0x27, 0x4E, 0x69, 0x9C, 0xBB, 0xD2, 0xF5, 0xBF, 0x98, 0xF1, 0xD6, 0x23, 0x04, 0x6D, 0x4A}},
+    {{0x00, 0x34, 0x68, 0x5C, 0xD0, 0xE4, 0xB8, 0x8C, 0x27, 0x13, 0x4F, 0x7B, 0xF7, 0xC3, 0x9F, 0xAB},
+     {0x00, 0x4E, 0x9C, 0xD2, 0xBF, 0xF1, 0x23, 0x6D, 0xF9, 0xB7, 0x65, 0x2B, 0x46, 0x08, 0xDA, 0x94}},
+    {{0x00, 0x68, 0xD0, 0xB8, 0x27, 0x4F, 0xF7, 0x9F, 0x4E, 0x26, 0x9E, 0xF6, 0x69, 0x01, 0xB9, 0xD1},
+     {0x00, 0x9C, 0xBF, 0x23, 0xF9, 0x65, 0x46, 0xDA, 0x75, 0xE9, 0xCA, 0x56, 0x8C, 0x10, 0x33, 0xAF}},
+    {{0x00, 0xD0, 0x27, 0xF7, 0x4E, 0x9E, 0x69, 0xB9, 0x9C, 0x4C, 0xBB, 0x6B, 0xD2, 0x02, 0xF5, 0x25},
+     {0x00, 0xBF, 0xF9, 0x46, 0x75, 0xCA, 0x8C, 0x33, 0xEA, 0x55, 0x13, 0xAC, 0x9F, 0x20, 0x66, 0xD9}},
+    {{0x00, 0x27, 0x4E, 0x69, 0x9C, 0xBB, 0xD2, 0xF5, 0xBF, 0x98, 0xF1, 0xD6, 0x23, 0x04, 0x6D, 0x4A},
+     {0x00, 0xF9, 0x75, 0x8C, 0xEA, 0x13, 0x9F, 0x66, 0x53, 0xAA, 0x26, 0xDF, 0xB9, 0x40, 0xCC, 0x35}},
+    {{0x00, 0x4E, 0x9C, 0xD2, 0xBF, 0xF1, 0x23, 0x6D, 0xF9, 0xB7, 0x65, 0x2B, 0x46, 0x08, 0xDA, 0x94},
+     {0x00, 0x75, 0xEA, 0x9F, 0x53, 0x26, 0xB9, 0xCC, 0xA6, 0xD3, 0x4C, 0x39, 0xF5, 0x80, 0x1F, 0x6A}},
+    {{0x00, 0x9C, 0xBF, 0x23, 0xF9, 0x65, 0x46, 0xDA, 0x75, 0xE9, 0xCA, 0x56, 0x8C, 0x10, 0x33, 0xAF},
+     {0x00, 0xEA, 0x53, 0xB9, 0xA6, 0x4C, 0xF5, 0x1F, 0xCB, 0x21, 0x98, 0x72, 0x6D, 0x87, 0x3E, 0xD4}},
+    {{0x00, 0xBF, 0xF9, 0x46, 0x75, 0xCA, 0x8C, 0x33, 0xEA, 0x55, 0x13, 0xAC, 0x9F, 0x20, 0x66, 0xD9},
+     {0x00, 0x53, 0xA6, 0xF5, 0xCB, 0x98, 0x6D, 0x3E, 0x11, 0x42, 0xB7, 0xE4, 0xDA, 0x89, 0x7C, 0x2F}},
+    {{0x00, 0xF9, 0x75, 0x8C, 0xEA, 0x13, 0x9F, 0x66, 0x53, 0xAA, 0x26, 0xDF, 0xB9, 0x40, 0xCC, 0x35},
+     {0x00, 0xA6, 0xCB, 0x6D, 0x11, 0xB7, 0xDA, 0x7C, 0x22, 0x84, 0xE9, 0x4F, 0x33, 0x95, 0xF8, 0x5E}},
+    {{0x00, 0x75, 0xEA, 0x9F, 0x53, 0x26, 0xB9, 0xCC, 0xA6, 0xD3, 0x4C, 0x39, 0xF5, 0x80, 0x1F, 0x6A},
+     {0x00, 0xCB, 0x11, 0xDA, 0x22, 0xE9, 0x33, 0xF8, 0x44, 0x8F, 0x55, 0x9E, 0x66, 0xAD, 0x77, 0xBC}},
+    {{0x00, 0xEA, 0x53, 0xB9, 0xA6, 0x4C, 0xF5, 0x1F, 0xCB, 0x21, 0x98, 0x72, 0x6D, 0x87, 0x3E, 0xD4},
+     {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF}},
+    {{0x00, 0x53, 0xA6, 0xF5, 0xCB, 0x98, 0x6D, 0x3E, 0x11, 0x42, 0xB7, 0xE4, 0xDA, 0x89, 0x7C, 0x2F},
+     {0x00, 0x22, 0x44, 0x66, 0x88, 0xAA, 0xCC, 0xEE, 0x97, 0xB5, 0xD3, 0xF1, 0x1F, 0x3D, 0x5B, 0x79}},
+    {{0x00, 0xA6, 0xCB, 0x6D, 0x11, 0xB7, 0xDA, 0x7C, 0x22, 0x84, 0xE9, 0x4F, 0x33, 0x95, 0xF8, 0x5E},
+     {0x00, 0x44, 0x88, 0xCC, 0x97, 0xD3, 0x1F, 0x5B, 0xA9, 0xED, 0x21, 0x65, 0x3E, 0x7A, 0xB6, 0xF2}},
+    {{0x00, 0xCB, 0x11, 0xDA, 0x22, 0xE9, 0x33, 0xF8, 0x44, 0x8F, 0x55, 0x9E, 0x66, 0xAD, 0x77, 0xBC},
+     {0x00, 0x88, 0x97, 0x1F, 0xA9, 0x21, 0x3E, 0xB6, 0xD5, 0x5D, 0x42, 0xCA, 0x7C, 0xF4, 0xEB, 0x63}},
+    {{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
+     {0x00, 0x97, 0xA9, 0x3E, 0xD5, 0x42, 0x7C, 0xEB, 0x2D, 0xBA, 0x84, 0x13, 0xF8, 0x6F, 0x51, 0xC6}},
+    {{0x00, 0x22, 0x44, 0x66, 0x88, 0xAA, 0xCC, 0xEE, 0x97, 0xB5, 0xD3, 0xF1, 0x1F, 0x3D, 0x5B, 0x79},
+     {0x00, 0xA9, 0xD5, 0x7C, 0x2D, 0x84, 0xF8, 0x51, 0x5A, 0xF3, 0x8F, 0x26, 0x77, 0xDE, 0xA2, 0x0B}},
+    {{0x00, 0x44, 0x88, 0xCC, 0x97, 0xD3, 0x1F, 0x5B, 0xA9, 0xED, 0x21, 0x65, 0x3E, 0x7A, 0xB6, 0xF2},
+     {0x00, 0xD5, 0x2D, 0xF8, 0x5A, 0x8F, 0x77, 0xA2, 0xB4, 0x61, 0x99, 0x4C, 0xEE, 0x3B, 0xC3, 0x16}},
+    {{0x00, 0x88, 0x97, 0x1F, 0xA9, 0x21, 0x3E, 0xB6, 0xD5, 0x5D, 0x42, 0xCA, 0x7C, 0xF4, 0xEB, 0x63},
+     {0x00, 0x2D, 0x5A, 0x77, 0xB4, 0x99, 0xEE, 0xC3, 0xEF, 0xC2, 0xB5, 0x98, 0x5B, 0x76, 0x01, 0x2C}},
+    {{0x00, 0x97, 0xA9, 0x3E, 0xD5, 0x42, 0x7C, 0xEB, 0x2D, 0xBA, 0x84, 0x13, 0xF8, 0x6F, 0x51, 0xC6},
+     {0x00, 0x5A, 0xB4, 0xEE, 0xEF, 0xB5, 0x5B, 0x01, 0x59, 0x03, 0xED, 0xB7, 0xB6, 0xEC, 0x02, 0x58}},
+    {{0x00, 0xA9, 0xD5, 0x7C, 0x2D, 0x84, 0xF8, 0x51, 0x5A, 0xF3, 0x8F, 0x26, 0x77, 0xDE, 0xA2, 0x0B},
+     {0x00, 0xB4, 0xEF, 0x5B, 0x59, 0xED, 0xB6, 0x02, 0xB2, 0x06, 0x5D, 0xE9, 0xEB, 0x5F, 0x04, 0xB0}},
+    {{0x00, 0xD5, 0x2D, 0xF8, 0x5A, 0x8F, 0x77, 0xA2, 0xB4, 0x61, 0x99, 0x4C, 0xEE, 0x3B, 0xC3, 0x16},
+     {0x00, 0xEF, 0x59, 0xB6, 0xB2, 0x5D, 0xEB, 0x04, 0xE3, 0x0C, 0xBA, 0x55, 0x51, 0xBE, 0x08, 0xE7}},
+    {{0x00, 0x2D, 0x5A, 0x77, 0xB4, 0x99, 0xEE, 0xC3, 0xEF, 0xC2, 0xB5, 0x98, 0x5B, 0x76, 0x01, 0x2C},
+     {0x00, 0x59, 0xB2, 0xEB, 0xE3, 0xBA, 0x51, 0x08, 0x41, 0x18, 0xF3, 0xAA, 0xA2, 0xFB, 0x10, 0x49}},
+    {{0x00, 0x5A, 0xB4, 0xEE, 0xEF, 0xB5, 0x5B, 0x01, 0x59, 0x03, 0xED, 0xB7, 0xB6, 0xEC, 0x02, 0x58},
+     {0x00, 0xB2, 0xE3, 0x51, 0x41, 0xF3, 0xA2, 0x10, 0x82, 0x30, 0x61, 0xD3, 0xC3, 0x71, 0x20, 0x92}},
+    {{0x00, 0xB4, 0xEF, 0x5B, 0x59, 0xED, 0xB6, 0x02, 0xB2, 0x06, 0x5D, 0xE9, 0xEB, 0x5F, 0x04, 0xB0},
+     {0x00, 0xE3, 0x41, 0xA2, 0x82, 0x61, 0xC3, 0x20, 0x83, 0x60, 0xC2, 0x21, 0x01, 0xE2, 0x40, 0xA3}},
+    {{0x00, 0xEF, 0x59, 0xB6, 0xB2, 0x5D, 0xEB, 0x04, 0xE3, 0x0C, 0xBA, 0x55, 0x51, 0xBE, 0x08, 0xE7},
+     {0x00, 0x41, 0x82, 0xC3, 0x83, 0xC2, 0x01, 0x40, 0x81, 0xC0, 0x03, 0x42, 0x02, 0x43, 0x80, 0xC1}},
+    {{0x00, 0x59, 0xB2, 0xEB, 0xE3, 0xBA, 0x51, 0x08, 0x41, 0x18, 0xF3, 0xAA, 0xA2, 0xFB, 0x10, 0x49},
+     {0x00, 0x82, 0x83, 0x01, 0x81, 0x03, 0x02, 0x80, 0x85, 0x07, 0x06, 0x84, 0x04, 0x86, 0x87, 0x05}},
+    {{0x00, 0xB2, 0xE3, 0x51, 0x41, 0xF3, 0xA2, 0x10, 0x82, 0x30, 0x61, 0xD3, 0xC3, 0x71, 0x20, 0x92},
+     {0x00, 0x83, 0x81, 0x02, 0x85, 0x06, 0x04, 0x87, 0x8D, 0x0E, 0x0C, 0x8F, 0x08, 0x8B, 0x89, 0x0A}},
+    {{0x00, 0xE3, 0x41, 0xA2, 0x82, 0x61, 0xC3, 0x20, 0x83, 0x60, 0xC2, 0x21, 0x01, 0xE2, 0x40, 0xA3},
+     {0x00, 0x81, 0x85, 0x04, 0x8D, 0x0C, 0x08, 0x89, 0x9D, 0x1C, 0x18, 0x99, 0x10, 0x91, 0x95, 0x14}},
+    {{0x00, 0x41, 0x82, 0xC3, 0x83, 0xC2, 0x01, 0x40, 0x81, 0xC0, 0x03, 0x42, 0x02, 0x43, 0x80, 0xC1},
+     {0x00, 0x85, 0x8D, 0x08, 0x9D, 0x18, 0x10, 0x95, 0xBD, 0x38, 0x30, 0xB5, 0x20, 0xA5, 0xAD, 0x28}},
+    {{0x00, 0x82, 0x83, 0x01, 0x81, 0x03, 0x02, 0x80, 0x85, 0x07, 0x06, 0x84, 0x04, 0x86, 0x87, 0x05},
+     {0x00, 0x8D, 0x9D, 0x10, 0xBD, 0x30, 0x20, 0xAD, 0xFD, 0x70, 0x60, 0xED, 0x40, 0xCD, 0xDD, 0x50}},
+    {{0x00, 0x83, 0x81, 0x02, 0x85, 0x06, 0x04, 0x87, 0x8D, 0x0E, 0x0C, 0x8F, 0x08, 0x8B, 0x89, 0x0A},
+     {0x00, 0x9D, 0xBD, 0x20, 0xFD, 0x60, 0x40, 0xDD, 0x7D, 0xE0, 0xC0, 0x5D, 0x80, 0x1D, 0x3D, 0xA0}},
+    {{0x00, 0x81, 0x85, 0x04, 0x8D, 0x0C, 0x08, 0x89, 0x9D, 0x1C, 0x18, 0x99, 0x10, 0x91, 0x95, 0x14},
+     {0x00, 0xBD, 0xFD, 0x40, 0x7D, 0xC0, 0x80, 0x3D, 0xFA, 0x47, 0x07, 0xBA, 0x87, 0x3A, 0x7A, 0xC7}},
+    {{0x00, 0x85, 0x8D, 0x08, 0x9D, 0x18, 0x10, 0x95, 0xBD, 0x38, 0x30, 0xB5, 0x20, 0xA5, 0xAD, 0x28},
+     {0x00, 0xFD, 0x7D, 0x80, 0xFA, 0x07, 0x87, 0x7A, 0x73, 0x8E, 0x0E, 0xF3, 0x89, 0x74, 0xF4, 0x09}},
+    {{0x00, 0x8D, 0x9D, 0x10, 0xBD, 0x30, 0x20, 0xAD, 0xFD, 0x70, 0x60, 0xED, 0x40, 0xCD, 0xDD, 0x50},
+     {0x00, 0x7D, 0xFA, 0x87, 0x73, 0x0E, 0x89, 0xF4, 0xE6, 0x9B, 0x1C, 0x61, 0x95, 0xE8, 0x6F, 0x12}},
+    {{0x00, 0x9D, 0xBD, 0x20, 0xFD, 0x60, 0x40, 0xDD, 0x7D, 0xE0, 0xC0, 0x5D, 0x80, 0x1D, 0x3D, 0xA0},
+     {0x00, 0xFA, 0x73, 0x89, 0xE6, 0x1C, 0x95, 0x6F, 0x4B, 0xB1, 0x38, 0xC2, 0xAD, 0x57, 0xDE, 0x24}},
+    {{0x00, 0xBD, 0xFD, 0x40, 0x7D, 0xC0, 0x80, 0x3D, 0xFA, 0x47, 0x07, 0xBA, 0x87, 0x3A, 0x7A, 0xC7},
+     {0x00, 0x73, 0xE6, 0x95, 0x4B, 0x38, 0xAD, 0xDE, 0x96, 0xE5, 0x70, 0x03, 0xDD, 0xAE, 0x3B, 0x48}},
+    {{0x00, 0xFD, 0x7D, 0x80, 0xFA, 0x07, 0x87, 0x7A, 0x73, 0x8E, 0x0E, 0xF3, 0x89, 0x74, 0xF4, 0x09},
+     {0x00, 0xE6, 0x4B, 0xAD, 0x96, 0x70, 0xDD, 0x3B, 0xAB, 0x4D, 0xE0, 0x06, 0x3D, 0xDB, 0x76, 0x90}},
+    {{0x00, 0x7D, 0xFA, 0x87, 0x73, 0x0E, 0x89, 0xF4, 0xE6, 0x9B, 0x1C, 0x61, 0x95, 0xE8, 0x6F, 0x12},
+     {0x00, 0x4B, 0x96, 0xDD, 0xAB, 0xE0, 0x3D, 0x76, 0xD1, 0x9A, 0x47, 0x0C, 0x7A, 0x31, 0xEC, 0xA7}},
+    {{0x00, 0xFA, 0x73, 0x89, 0xE6, 0x1C, 0x95, 0x6F, 0x4B, 0xB1, 0x38, 0xC2, 0xAD, 0x57, 0xDE, 0x24},
+     {0x00, 0x96, 0xAB, 0x3D, 0xD1, 0x47, 0x7A, 0xEC, 0x25, 0xB3, 0x8E, 0x18, 0xF4, 0x62, 0x5F, 0xC9}},
+    {{0x00, 0x73, 0xE6, 0x95, 0x4B, 0x38, 0xAD, 0xDE, 0x96, 0xE5, 0x70, 0x03, 0xDD, 0xAE, 0x3B, 0x48},
+     {0x00, 0xAB, 0xD1, 0x7A, 0x25, 0x8E, 0xF4, 0x5F, 0x4A, 0xE1, 0x9B, 0x30, 0x6F, 0xC4, 0xBE, 0x15}},
+    {{0x00, 0xE6, 0x4B, 0xAD, 0x96, 0x70, 0xDD, 0x3B, 0xAB, 0x4D, 0xE0, 0x06, 0x3D, 0xDB, 0x76, 0x90},
+     {0x00, 0xD1, 0x25, 0xF4, 0x4A, 0x9B, 0x6F, 0xBE, 0x94, 0x45, 0xB1, 0x60, 0xDE, 0x0F, 0xFB, 0x2A}},
+    {{0x00, 0x4B, 0x96, 0xDD, 0xAB, 0xE0, 0x3D, 0x76, 0xD1, 0x9A, 0x47, 0x0C, 0x7A, 0x31, 0xEC, 0xA7},
+     {0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB1, 0xDE, 0xFB, 0xAF, 0x8A, 0xE5, 0xC0, 0x3B, 0x1E, 0x71, 0x54}},
+    {{0x00, 0x96, 0xAB, 0x3D, 0xD1, 0x47, 0x7A, 0xEC, 0x25, 0xB3, 0x8E, 0x18, 0xF4, 0x62, 0x5F, 0xC9},
+     {0x00, 0x4A, 0x94, 0xDE, 0xAF, 0xE5, 0x3B, 0x71, 0xD9, 0x93, 0x4D, 0x07, 0x76, 0x3C, 0xE2, 0xA8}},
+    {{0x00, 0xAB, 0xD1, 0x7A, 0x25, 0x8E, 0xF4, 0x5F, 0x4A, 0xE1, 0x9B, 0x30, 0x6F, 0xC4, 0xBE, 0x15},
+     {0x00, 0x94, 0xAF, 0x3B, 0xD9, 0x4D, 0x76, 0xE2, 0x35, 0xA1, 0x9A, 0x0E, 0xEC, 0x78, 0x43, 0xD7}},
+    {{0x00, 0xD1, 0x25, 0xF4, 0x4A, 0x9B, 0x6F, 0xBE, 0x94, 0x45, 0xB1, 0x60, 0xDE, 0x0F, 0xFB, 0x2A},
+     {0x00, 0xAF, 0xD9, 0x76, 0x35, 0x9A, 0xEC, 0x43, 0x6A, 0xC5, 0xB3, 0x1C, 0x5F, 0xF0, 0x86, 0x29}},
+    {{0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB1, 0xDE, 0xFB, 0xAF, 0x8A, 0xE5, 0xC0, 0x3B, 0x1E, 0x71, 0x54},
+     {0x00, 0xD9, 0x35, 0xEC, 0x6A, 0xB3, 0x5F, 0x86, 0xD4, 0x0D, 0xE1, 0x38, 0xBE, 0x67, 0x8B, 0x52}},
+    {{0x00, 0x4A, 0x94, 0xDE, 0xAF, 0xE5, 0x3B, 0x71, 0xD9, 0x93, 0x4D, 0x07, 0x76, 0x3C, 0xE2, 0xA8},
+     {0x00, 0x35, 0x6A, 0x5F, 0xD4, 0xE1, 0xBE, 0x8B, 0x2F, 0x1A, 0x45, 0x70, 0xFB, 0xCE, 0x91, 0xA4}},
+    {{0x00, 0x94, 0xAF, 0x3B, 0xD9, 0x4D, 0x76, 0xE2, 0x35, 0xA1, 0x9A, 0x0E, 0xEC, 0x78, 0x43, 0xD7},
+     {0x00, 0x6A, 0xD4, 0xBE, 0x2F, 0x45, 0xFB, 0x91, 0x5E, 0x34, 0x8A, 0xE0, 0x71, 0x1B, 0xA5, 0xCF}},
+    {{0x00, 0xAF, 0xD9, 0x76, 0x35, 0x9A, 0xEC, 0x43, 0x6A, 0xC5, 0xB3, 0x1C, 0x5F, 0xF0, 0x86, 0x29},
+     {0x00, 0xD4, 0x2F, 0xFB, 0x5E, 0x8A, 0x71, 0xA5, 0xBC, 0x68, 0x93, 0x47, 0xE2, 0x36, 0xCD, 0x19}},
+    {{0x00, 0xD9, 0x35, 0xEC, 0x6A, 0xB3, 0x5F, 0x86, 0xD4, 0x0D, 0xE1, 0x38, 0xBE, 0x67, 0x8B, 0x52},
+     {0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0xFF, 0xD0, 0xA1, 0x8E, 0x43, 0x6C, 0x1D, 0x32}},
+    {{0x00, 0x35, 0x6A, 0x5F, 0xD4, 0xE1, 0xBE, 0x8B, 0x2F, 0x1A, 0x45, 0x70, 0xFB, 0xCE, 0x91, 0xA4},
+     {0x00, 0x5E, 0xBC, 0xE2, 0xFF, 0xA1, 0x43, 0x1D, 0x79, 0x27, 0xC5, 0x9B, 0x86, 0xD8, 0x3A, 0x64}},
+    {{0x00, 0x6A, 0xD4, 0xBE, 0x2F, 0x45, 0xFB, 0x91, 0x5E, 0x34, 0x8A, 0xE0, 0x71, 0x1B, 0xA5, 0xCF},
+     {0x00, 0xBC, 0xFF, 0x43, 0x79, 0xC5, 0x86, 0x3A, 0xF2, 0x4E, 0x0D, 0xB1, 0x8B, 0x37, 0x74, 0xC8}},
+    {{0x00, 0xD4, 0x2F, 0xFB, 0x5E, 0x8A, 0x71, 0xA5, 0xBC, 0x68, 0x93, 0x47, 0xE2, 0x36, 0xCD, 0x19},
+     {0x00, 0xFF, 0x79, 0x86, 0xF2, 0x0D, 0x8B, 0x74, 0x63, 0x9C, 0x1A, 0xE5, 0x91, 0x6E, 0xE8, 0x17}},
+    {{0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0xFF, 0xD0, 0xA1, 0x8E, 0x43, 0x6C, 0x1D, 0x32},
+     {0x00, 0x79, 0xF2, 0x8B, 0x63, 0x1A, 0x91, 0xE8, 0xC6, 0xBF, 0x34, 0x4D, 0xA5, 0xDC, 0x57, 0x2E}},
+    {{0x00, 0x5E, 0xBC, 0xE2, 0xFF, 0xA1, 0x43, 0x1D, 0x79, 0x27, 0xC5, 0x9B, 0x86, 0xD8, 0x3A, 0x64},
+     {0x00, 0xF2, 0x63, 0x91, 0xC6, 0x34, 0xA5, 0x57, 0x0B, 0xF9, 0x68, 0x9A, 0xCD, 0x3F, 0xAE, 0x5C}},
+    {{0x00, 0xBC, 0xFF, 0x43, 0x79, 0xC5, 0x86, 0x3A, 0xF2, 0x4E, 0x0D, 0xB1, 0x8B, 0x37, 0x74, 0xC8},
+     {0x00, 0x63, 0xC6, 0xA5, 0x0B, 0x68, 0xCD, 0xAE, 0x16, 0x75, 0xD0, 0xB3, 0x1D, 0x7E, 0xDB, 0xB8}},
+    {{0x00, 0xFF, 0x79, 0x86, 0xF2, 0x0D, 0x8B, 0x74, 0x63, 0x9C, 0x1A, 0xE5, 0x91, 0x6E, 0xE8, 0x17},
+     {0x00, 0xC6, 0x0B, 0xCD, 0x16, 0xD0, 0x1D, 0xDB, 0x2C, 0xEA, 0x27, 0xE1, 0x3A, 0xFC, 0x31, 0xF7}},
+    {{0x00, 0x79, 0xF2, 0x8B, 0x63, 0x1A, 0x91, 0xE8, 0xC6, 0xBF, 0x34, 0x4D, 0xA5, 0xDC, 0x57, 0x2E},
+     {0x00, 0x0B, 0x16, 0x1D, 0x2C, 0x27, 0x3A, 0x31, 0x58, 0x53, 0x4E, 0x45, 0x74, 0x7F, 0x62, 0x69}},
+    {{0x00, 0xF2, 0x63, 0x91, 0xC6, 0x34, 0xA5, 0x57, 0x0B, 0xF9, 0x68, 0x9A, 0xCD, 0x3F, 0xAE, 0x5C},
+     {0x00, 0x16, 0x2C, 0x3A, 0x58, 0x4E, 0x74, 0x62, 0xB0, 0xA6, 0x9C, 0x8A, 0xE8, 0xFE, 0xC4, 0xD2}},
+    {{0x00, 0x63, 0xC6, 0xA5, 0x0B, 0x68, 0xCD, 0xAE, 0x16, 0x75, 0xD0, 0xB3, 0x1D, 0x7E, 0xDB, 0xB8},
+     {0x00, 0x2C, 0x58, 0x74, 0xB0, 0x9C, 0xE8, 0xC4, 0xE7, 0xCB, 0xBF, 0x93, 0x57, 0x7B, 0x0F, 0x23}},
+    {{0x00, 0xC6, 0x0B, 0xCD, 0x16, 0xD0, 0x1D, 0xDB, 0x2C, 0xEA, 0x27, 0xE1, 0x3A, 0xFC, 0x31, 0xF7},
+     {0x00, 0x58, 0xB0, 0xE8, 0xE7, 0xBF, 0x57, 0x0F, 0x49, 0x11, 0xF9, 0xA1, 0xAE, 0xF6, 0x1E, 0x46}},
+    {{0x00, 0x0B, 0x16, 0x1D, 0x2C, 0x27, 0x3A, 0x31, 0x58, 0x53, 0x4E, 0x45, 0x74, 0x7F, 0x62, 0x69},
+     {0x00, 0xB0, 0xE7, 0x57, 0x49, 0xF9, 0xAE, 0x1E, 0x92, 0x22, 0x75, 0xC5, 0xDB, 0x6B, 0x3C, 0x8C}},
+    {{0x00, 0x16, 0x2C, 0x3A, 0x58, 0x4E, 0x74, 0x62, 0xB0, 0xA6, 0x9C, 0x8A, 0xE8, 0xFE, 0xC4, 0xD2},
+     {0x00, 0xE7, 0x49, 0xAE, 0x92, 0x75, 0xDB, 0x3C, 0xA3, 0x44, 0xEA, 0x0D, 0x31, 0xD6, 0x78, 0x9F}},
+    {{0x00, 0x2C, 0x58, 0x74, 0xB0, 0x9C, 0xE8, 0xC4, 0xE7, 0xCB, 0xBF, 0x93, 0x57, 0x7B, 0x0F, 0x23},
+     {0x00, 0x49, 0x92, 0xDB, 0xA3, 0xEA, 0x31, 0x78, 0xC1, 0x88, 0x53, 0x1A, 0x62, 0x2B, 0xF0, 0xB9}},
+    {{0x00, 0x58, 0xB0, 0xE8, 0xE7, 0xBF, 0x57, 0x0F, 0x49, 0x11, 0xF9, 0xA1, 0xAE, 0xF6, 0x1E, 0x46},
+     {0x00, 0x92, 0xA3, 0x31, 0xC1, 0x53, 0x62, 0xF0, 0x05, 0x97, 0xA6, 0x34, 0xC4, 0x56, 0x67, 0xF5}},
+    {{0x00, 0xB0, 0xE7, 0x57, 0x49, 0xF9, 0xAE, 0x1E, 0x92, 0x22, 0x75, 0xC5, 0xDB, 0x6B, 0x3C, 0x8C},
+     {0x00, 0xA3, 0xC1, 0x62, 0x05, 0xA6, 0xC4, 0x67, 0x0A, 0xA9, 0xCB, 0x68, 0x0F, 0xAC, 0xCE, 0x6D}},
+    {{0x00, 0xE7, 0x49, 0xAE, 0x92, 0x75, 0xDB, 0x3C, 0xA3, 0x44, 0xEA, 0x0D, 0x31, 0xD6, 0x78, 0x9F},
+     {0x00, 0xC1, 0x05, 0xC4, 0x0A, 0xCB, 0x0F, 0xCE, 0x14, 0xD5, 0x11, 0xD0, 0x1E, 0xDF, 0x1B, 0xDA}},
+    {{0x00, 0x49, 0x92, 0xDB, 0xA3, 0xEA, 0x31, 0x78, 0xC1, 0x88, 0x53, 0x1A, 0x62, 0x2B, 0xF0, 0xB9},
+     {0x00, 0x05, 0x0A, 0x0F, 0x14, 0x11, 0x1E, 0x1B, 0x28, 0x2D, 0x22, 0x27, 0x3C, 0x39, 0x36, 0x33}},
+    {{0x00, 0x92, 0xA3, 0x31, 0xC1, 0x53, 0x62, 0xF0, 0x05, 0x97, 0xA6, 0x34, 0xC4, 0x56, 0x67, 0xF5},
+     {0x00, 0x0A, 0x14, 0x1E, 0x28, 0x22, 0x3C, 0x36, 0x50, 0x5A, 0x44, 0x4E, 0x78, 0x72, 0x6C, 0x66}},
+    {{0x00, 0xA3, 0xC1, 0x62, 0x05, 0xA6, 0xC4, 0x67, 0x0A, 0xA9, 0xCB, 0x68, 0x0F, 0xAC, 0xCE, 0x6D},
+     {0x00, 0x14, 0x28, 0x3C, 0x50, 0x44, 0x78, 0x6C, 0xA0, 0xB4, 0x88, 0x9C, 0xF0, 0xE4, 0xD8, 0xCC}},
+    {{0x00, 0xC1, 0x05, 0xC4, 0x0A, 0xCB, 0x0F, 0xCE, 0x14, 0xD5, 0x11, 0xD0, 0x1E, 0xDF, 0x1B, 0xDA},
+     {0x00, 0x28, 0x50, 0x78, 0xA0, 0x88, 0xF0, 0xD8, 0xC7, 0xEF, 0x97, 0xBF, 0x67, 0x4F, 0x37, 0x1F}},
+    {{0x00, 0x05, 0x0A, 0x0F, 0x14, 0x11, 0x1E, 0x1B, 0x28, 0x2D, 0x22, 0x27, 0x3C, 0x39, 0x36, 0x33},
+     {0x00, 0x50, 0xA0, 0xF0, 0xC7, 0x97, 0x67, 0x37, 0x09, 0x59, 0xA9, 0xF9, 0xCE, 0x9E, 0x6E, 0x3E}},
+    {{0x00, 0x0A, 0x14, 0x1E, 0x28, 0x22, 0x3C, 0x36, 0x50, 0x5A, 0x44, 0x4E, 0x78, 0x72, 0x6C, 0x66},
+     {0x00, 0xA0, 0xC7, 0x67, 0x09, 0xA9, 0xCE, 0x6E, 0x12, 0xB2, 0xD5, 0x75, 0x1B, 0xBB, 0xDC, 0x7C}},
+    {{0x00, 0x14, 0x28, 0x3C, 0x50, 0x44, 0x78, 0x6C, 0xA0, 0xB4, 0x88, 0x9C, 0xF0, 0xE4, 0xD8, 0xCC},
+     {0x00, 0xC7, 0x09, 0xCE, 0x12, 0xD5, 0x1B, 0xDC, 0x24, 0xE3, 0x2D, 0xEA, 0x36, 0xF1, 0x3F, 0xF8}},
+    {{0x00, 0x28, 0x50, 0x78, 0xA0, 0x88, 0xF0, 0xD8, 0xC7, 0xEF, 0x97, 0xBF, 0x67, 0x4F, 0x37, 0x1F},
+     {0x00, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F, 0x48, 0x41, 0x5A, 0x53, 0x6C, 0x65, 0x7E, 0x77}},
+    {{0x00, 0x50, 0xA0, 0xF0, 0xC7, 0x97, 0x67, 0x37, 0x09, 0x59, 0xA9, 0xF9, 0xCE, 0x9E, 0x6E, 0x3E},
+     {0x00, 0x12, 0x24, 0x36, 0x48, 0x5A, 0x6C, 0x7E, 0x90, 0x82, 0xB4, 0xA6, 0xD8, 0xCA, 0xFC, 0xEE}},
+    {{0x00, 0xA0, 0xC7, 0x67, 0x09, 0xA9, 0xCE, 0x6E, 0x12, 0xB2, 0xD5, 0x75, 0x1B, 0xBB, 0xDC, 0x7C},
+     {0x00, 0x24, 0x48, 0x6C, 0x90, 0xB4, 0xD8, 0xFC, 0xA7, 0x83, 0xEF, 0xCB, 0x37, 0x13, 0x7F, 0x5B}},
+    {{0x00, 0xC7, 0x09, 0xCE, 0x12, 0xD5, 0x1B, 0xDC, 0x24, 0xE3, 0x2D, 0xEA, 0x36, 0xF1, 0x3F, 0xF8},
+     {0x00, 0x48, 0x90, 0xD8, 0xA7, 0xEF, 0x37, 0x7F, 0xC9, 0x81, 0x59, 0x11, 0x6E, 0x26, 0xFE, 0xB6}},
+    {{0x00, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F, 0x48, 0x41, 0x5A, 0x53, 0x6C, 0x65, 0x7E, 0x77},
+     {0x00, 0x90, 0xA7, 0x37, 0xC9, 0x59, 0x6E, 0xFE, 0x15, 0x85, 0xB2, 0x22, 0xDC, 0x4C, 0x7B, 0xEB}},
+    {{0x00, 0x12, 0x24, 0x36, 0x48, 0x5A, 0x6C, 0x7E, 0x90, 0x82, 0xB4, 0xA6, 0xD8, 0xCA, 0xFC, 0xEE},
+     {0x00, 0xA7, 0xC9, 0x6E, 0x15, 0xB2, 0xDC, 0x7B, 0x2A, 0x8D, 0xE3, 0x44, 0x3F, 0x98, 0xF6, 0x51}},
+    {{0x00, 0x24, 0x48, 0x6C, 0x90, 0xB4, 0xD8, 0xFC, 0xA7, 0x83, 0xEF, 0xCB, 0x37, 0x13, 0x7F, 0x5B},
+     {0x00, 0xC9, 0x15, 0xDC, 0x2A, 0xE3, 0x3F, 0xF6, 0x54, 0x9D, 0x41, 0x88, 0x7E, 0xB7, 0x6B, 0xA2}},
+    {{0x00, 0x48, 0x90, 0xD8, 0xA7, 0xEF, 0x37, 0x7F, 0xC9, 0x81, 0x59, 0x11, 0x6E, 0x26, 0xFE, 0xB6},
+     {0x00, 0x15, 0x2A, 0x3F, 0x54, 0x41, 0x7E, 0x6B, 0xA8, 0xBD, 0x82, 0x97, 0xFC, 0xE9, 0xD6, 0xC3}},
+    {{0x00, 0x90, 0xA7, 0x37, 0xC9, 0x59, 0x6E, 0xFE, 0x15, 0x85, 0xB2, 0x22, 0xDC, 0x4C, 0x7B, 0xEB},
+     {0x00, 0x2A, 0x54, 0x7E, 0xA8, 0x82, 0xFC, 0xD6, 0xD7, 0xFD, 0x83, 0xA9, 0x7F, 0x55, 0x2B, 0x01}},
+    {{0x00, 0xA7, 0xC9, 0x6E, 0x15, 0xB2, 0xDC, 0x7B, 0x2A, 0x8D, 0xE3, 0x44, 0x3F, 0x98, 0xF6, 0x51},
+     {0x00, 0x54, 0xA8, 0xFC, 0xD7, 0x83, 0x7F, 0x2B, 0x29, 0x7D, 0x81, 0xD5, 0xFE, 0xAA, 0x56, 0x02}},
+    {{0x00, 0xC9, 0x15, 0xDC, 0x2A, 0xE3, 0x3F, 0xF6, 0x54, 0x9D, 0x41, 0x88, 0x7E, 0xB7, 0x6B, 0xA2},
+     {0x00, 0xA8, 0xD7, 0x7F, 0x29, 0x81, 0xFE, 0x56, 0x52, 0xFA, 0x85, 0x2D, 0x7B, 0xD3, 0xAC, 0x04}},
+    {{0x00, 0x15, 0x2A, 0x3F, 0x54, 0x41, 0x7E, 0x6B, 0xA8, 0xBD, 0x82, 0x97, 0xFC, 0xE9, 0xD6, 0xC3},
+     {0x00, 0xD7, 0x29, 0xFE, 0x52, 0x85, 0x7B, 0xAC, 0xA4, 0x73, 0x8D, 0x5A, 0xF6, 0x21, 0xDF, 0x08}},
+    {{0x00, 0x2A, 0x54, 0x7E, 0xA8, 0x82, 0xFC, 0xD6, 0xD7, 0xFD, 0x83, 0xA9, 0x7F, 0x55, 0x2B, 0x01},
+     {0x00, 0x29, 0x52, 0x7B, 0xA4, 0x8D, 0xF6, 0xDF, 0xCF, 0xE6, 0x9D, 0xB4, 0x6B, 0x42, 0x39, 0x10}},
+    {{0x00, 0x54, 0xA8, 0xFC, 0xD7, 0x83, 0x7F, 0x2B, 0x29, 0x7D, 0x81, 0xD5, 0xFE, 0xAA, 0x56, 0x02},
+     {0x00, 0x52, 0xA4, 0xF6, 0xCF, 0x9D, 0x6B, 0x39, 0x19, 0x4B, 0xBD, 0xEF, 0xD6, 0x84, 0x72, 0x20}},
+    {{0x00, 0xA8, 0xD7, 0x7F, 0x29, 0x81, 0xFE, 0x56, 0x52, 0xFA, 0x85, 0x2D, 0x7B, 0xD3, 0xAC, 0x04},
+     {0x00, 0xA4, 0xCF, 0x6B, 0x19, 0xBD, 0xD6, 0x72, 0x32, 0x96, 0xFD, 0x59, 0x2B, 0x8F, 0xE4, 0x40}},
+    {{0x00, 0xD7, 0x29, 0xFE, 0x52, 0x85, 0x7B, 0xAC, 0xA4, 0x73, 0x8D, 0x5A, 0xF6, 0x21, 0xDF, 0x08},
+     {0x00, 0xCF, 0x19, 0xD6, 0x32, 0xFD, 0x2B, 0xE4, 0x64, 0xAB, 0x7D, 0xB2, 0x56, 0x99, 0x4F, 0x80}},
+    {{0x00, 0x29, 0x52, 0x7B, 0xA4, 0x8D, 0xF6, 0xDF, 0xCF, 0xE6, 0x9D, 0xB4, 0x6B, 0x42, 0x39, 0x10},
+     {0x00, 0x19, 0x32, 0x2B, 0x64, 0x7D, 0x56, 0x4F, 0xC8, 0xD1, 0xFA, 0xE3, 0xAC, 0xB5, 0x9E, 0x87}},
+    {{0x00, 0x52, 0xA4, 0xF6, 0xCF, 0x9D, 0x6B, 0x39, 0x19, 0x4B, 0xBD, 0xEF, 0xD6, 0x84, 0x72, 0x20},
+     {0x00, 0x32, 0x64, 0x56, 0xC8, 0xFA, 0xAC, 0x9E, 0x17, 0x25, 0x73, 0x41, 0xDF, 0xED, 0xBB, 0x89}},
+    {{0x00, 0xA4, 0xCF, 0x6B, 0x19, 0xBD, 0xD6, 0x72, 0x32, 0x96, 0xFD, 0x59, 0x2B, 0x8F, 0xE4, 0x40},
+     {0x00, 0x64, 0xC8, 0xAC, 0x17, 0x73, 0xDF, 0xBB, 0x2E, 0x4A, 0xE6, 0x82, 0x39, 0x5D, 0xF1, 0x95}},
+    {{0x00, 0xCF, 0x19, 0xD6, 0x32, 0xFD, 0x2B, 0xE4, 0x64, 0xAB, 0x7D, 0xB2, 0x56, 0x99, 0x4F, 0x80},
+     {0x00, 0xC8, 0x17, 0xDF, 0x2E, 0xE6, 0x39, 0xF1, 0x5C, 0x94, 0x4B, 0x83, 0x72, 0xBA, 0x65, 0xAD}},
+    {{0x00, 0x19, 0x32, 0x2B, 0x64, 0x7D, 0x56, 0x4F, 0xC8, 0xD1, 0xFA, 0xE3, 0xAC, 0xB5, 0x9E, 0x87},
+     {0x00, 0x17, 0x2E, 0x39, 0x5C, 0x4B, 0x72, 0x65, 0xB8, 0xAF, 0x96, 0x81, 0xE4, 0xF3, 0xCA, 0xDD}},
+    {{0x00, 0x32, 0x64, 0x56, 0xC8, 0xFA, 0xAC, 0x9E, 0x17, 0x25, 0x73, 0x41, 0xDF, 0xED, 0xBB, 0x89},
+     {0x00, 0x2E, 0x5C, 0x72, 0xB8, 0x96, 0xE4, 0xCA, 0xF7, 0xD9, 0xAB, 0x85, 0x4F, 0x61, 0x13, 0x3D}},
+    {{0x00, 0x64, 0xC8, 0xAC, 0x17, 0x73, 0xDF, 0xBB, 0x2E, 0x4A, 0xE6, 0x82, 0x39, 0x5D, 0xF1, 0x95},
+     {0x00, 0x5C, 0xB8, 0xE4, 0xF7, 0xAB, 0x4F, 0x13, 0x69, 0x35, 0xD1, 0x8D, 0x9E, 0xC2, 0x26, 0x7A}},
+    {{0x00, 0xC8, 0x17, 0xDF, 0x2E, 0xE6, 0x39, 0xF1, 0x5C, 0x94, 0x4B, 0x83, 0x72, 0xBA, 0x65, 0xAD},
+     {0x00, 0xB8, 0xF7, 0x4F, 0x69, 0xD1, 0x9E, 0x26, 0xD2, 0x6A, 0x25, 0x9D, 0xBB, 0x03, 0x4C, 0xF4}},
+    {{0x00, 0x17, 0x2E, 0x39, 0x5C, 0x4B, 0x72, 0x65, 0xB8, 0xAF, 0x96, 0x81, 0xE4, 0xF3, 0xCA, 0xDD},
+     {0x00, 0xF7, 0x69, 0x9E, 0xD2, 0x25, 0xBB, 0x4C, 0x23, 0xD4, 0x4A, 0xBD, 0xF1, 0x06, 0x98, 0x6F}},
+    {{0x00, 0x2E, 0x5C, 0x72, 0xB8, 0x96, 0xE4, 0xCA, 0xF7, 0xD9, 0xAB, 0x85, 0x4F, 0x61, 0x13, 0x3D},
+     {0x00, 0x69, 0xD2, 0xBB, 0x23, 0x4A, 0xF1, 0x98, 0x46, 0x2F, 0x94, 0xFD, 0x65, 0x0C, 0xB7, 0xDE}},
+    {{0x00, 0x5C, 0xB8, 0xE4, 0xF7, 0xAB, 0x4F, 0x13, 0x69, 0x35, 0xD1, 0x8D, 0x9E, 0xC2, 0x26, 0x7A},
+     {0x00, 0xD2, 0x23, 0xF1, 0x46, 0x94, 0x65, 0xB7, 0x8C, 0x5E, 0xAF, 0x7D, 0xCA, 0x18, 0xE9, 0x3B}},
+    {{0x00, 0xB8, 0xF7, 0x4F, 0x69, 0xD1, 0x9E, 0x26, 0xD2, 0x6A, 0x25, 0x9D, 0xBB, 0x03, 0x4C, 0xF4},
+     {0x00, 0x23, 0x46, 0x65, 0x8C, 0xAF, 0xCA, 0xE9, 0x9F, 0xBC, 0xD9, 0xFA, 0x13, 0x30, 0x55, 0x76}},
+    {{0x00, 0xF7, 0x69, 0x9E, 0xD2, 0x25, 0xBB, 0x4C, 0x23, 0xD4, 0x4A, 0xBD, 0xF1, 0x06, 0x98, 0x6F},
+     {0x00, 0x46, 0x8C, 0xCA, 0x9F, 0xD9, 0x13, 0x55, 0xB9, 0xFF, 0x35, 0x73, 0x26, 0x60, 0xAA, 0xEC}},
+    {{0x00, 0x69, 0xD2, 0xBB, 0x23, 0x4A, 0xF1, 0x98, 0x46, 0x2F, 0x94, 0xFD, 0x65, 0x0C, 0xB7, 0xDE},
+     {0x00, 0x8C, 0x9F, 0x13, 0xB9, 0x35, 0x26, 0xAA, 0xF5, 0x79, 0x6A, 0xE6, 0x4C, 0xC0, 0xD3, 0x5F}},
+    {{0x00, 0xD2, 0x23, 0xF1, 0x46, 0x94, 0x65, 0xB7, 0x8C, 0x5E, 0xAF, 0x7D, 0xCA, 0x18, 0xE9, 0x3B},
+     {0x00, 0x9F, 0xB9, 0x26, 0xF5, 0x6A, 0x4C, 0xD3, 0x6D, 0xF2, 0xD4, 0x4B, 0x98, 0x07, 0x21, 0xBE}},
+    {{0x00, 0x23, 0x46, 0x65, 0x8C, 0xAF, 0xCA, 0xE9, 0x9F, 0xBC, 0xD9, 0xFA, 0x13, 0x30, 0x55, 0x76},
+     {0x00, 0xB9, 0xF5, 0x4C, 0x6D, 0xD4, 0x98, 0x21, 0xDA, 0x63, 0x2F, 0x96, 0xB7, 0x0E, 0x42, 0xFB}},
+    {{0x00, 0x46, 0x8C, 0xCA, 0x9F, 0xD9, 0x13, 0x55, 0xB9, 0xFF, 0x35, 0x73, 0x26, 0x60, 0xAA, 0xEC},
+     {0x00, 0xF5, 0x6D, 0x98, 0xDA, 0x2F, 0xB7, 0x42, 0x33, 0xC6, 0x5E, 0xAB, 0xE9, 0x1C, 0x84, 0x71}},
+    {{0x00, 0x8C, 0x9F, 0x13, 0xB9, 0x35, 0x26, 0xAA, 0xF5, 0x79, 0x6A, 0xE6, 0x4C, 0xC0, 0xD3, 0x5F},
+     {0x00, 0x6D, 0xDA, 0xB7, 0x33, 0x5E, 0xE9, 0x84, 0x66, 0x0B, 0xBC, 0xD1, 0x55, 0x38, 0x8F, 0xE2}},
+    {{0x00, 0x9F, 0xB9, 0x26, 0xF5, 0x6A, 0x4C, 0xD3, 0x6D, 0xF2, 0xD4, 0x4B, 0x98, 0x07, 0x21, 0xBE},
+     {0x00, 0xDA, 0x33, 0xE9, 0x66, 0xBC, 0x55, 0x8F, 0xCC, 0x16, 0xFF, 0x25, 0xAA, 0x70, 0x99, 0x43}},
+    {{0x00, 0xB9, 0xF5, 0x4C, 0x6D, 0xD4, 0x98, 0x21, 0xDA, 0x63, 0x2F, 0x96, 0xB7, 0x0E, 0x42, 0xFB},
+     {0x00, 0x33, 0x66, 0x55, 0xCC, 0xFF, 0xAA, 0x99, 0x1F, 0x2C, 0x79, 0x4A, 0xD3, 0xE0, 0xB5, 0x86}},
+    {{0x00, 0xF5, 0x6D, 0x98, 0xDA, 0x2F, 0xB7, 0x42, 0x33, 0xC6, 0x5E, 0xAB, 0xE9, 0x1C, 0x84, 0x71},
+     {0x00, 0x66, 0xCC, 0xAA, 0x1F, 0x79, 0xD3, 0xB5, 0x3E, 0x58, 0xF2, 0x94, 0x21, 0x47, 0xED, 0x8B}},
+    {{0x00, 0x6D, 0xDA, 0xB7, 0x33, 0x5E, 0xE9, 0x84, 0x66, 0x0B, 0xBC, 0xD1, 0x55, 0x38, 0x8F, 0xE2},
+     {0x00, 0xCC, 0x1F, 0xD3, 0x3E, 0xF2, 0x21, 0xED, 0x7C, 0xB0, 0x63, 0xAF, 0x42, 0x8E, 0x5D, 0x91}},
+    {{0x00, 0xDA, 0x33, 0xE9, 0x66, 0xBC, 0x55, 0x8F, 0xCC, 0x16, 0xFF, 0x25, 0xAA, 0x70, 0x99, 0x43},
+     {0x00, 0x1F, 0x3E, 0x21, 0x7C, 0x63, 0x42, 0x5D, 0xF8, 0xE7, 0xC6, 0xD9, 0x84, 0x9B, 0xBA, 0xA5}},
+    {{0x00, 0x33, 0x66, 0x55, 0xCC, 0xFF, 0xAA, 0x99, 0x1F, 0x2C, 0x79, 0x4A, 0xD3, 0xE0, 0xB5, 0x86},
+     {0x00, 0x3E, 0x7C, 0x42, 0xF8, 0xC6, 0x84, 0xBA, 0x77, 0x49, 0x0B, 0x35, 0x8F, 0xB1, 0xF3, 0xCD}},
+    {{0x00, 0x66, 0xCC, 0xAA, 0x1F, 0x79, 0xD3, 0xB5, 0x3E, 0x58, 0xF2, 0x94, 0x21, 0x47, 0xED, 0x8B},
+     {0x00, 0x7C, 0xF8, 0x84, 0x77, 0x0B, 0x8F, 0xF3, 0xEE, 0x92, 0x16, 0x6A, 0x99, 0xE5, 0x61, 0x1D}},
+    {{0x00, 0xCC, 0x1F, 0xD3, 0x3E, 0xF2, 0x21, 0xED, 0x7C, 0xB0, 0x63, 0xAF, 0x42, 0x8E, 0x5D, 0x91},
+     {0x00, 0xF8, 0x77, 0x8F, 0xEE, 0x16, 0x99, 0x61, 0x5B, 0xA3, 0x2C, 0xD4, 0xB5, 0x4D, 0xC2, 0x3A}},
+    {{0x00, 0x1F, 0x3E, 0x21, 0x7C, 0x63, 0x42, 0x5D, 0xF8, 0xE7, 0xC6, 0xD9, 0x84, 0x9B, 0xBA, 0xA5},
+     {0x00, 0x77, 0xEE, 0x99, 0x5B, 0x2C, 0xB5, 0xC2, 0xB6, 0xC1, 0x58, 0x2F, 0xED, 0x9A, 0x03, 0x74}},
+    {{0x00, 0x3E, 0x7C, 0x42, 0xF8, 0xC6, 0x84, 0xBA, 0x77, 0x49, 0x0B, 0x35, 0x8F, 0xB1, 0xF3, 0xCD},
+     {0x00, 0xEE, 0x5B, 0xB5, 0xB6, 0x58, 0xED, 0x03, 0xEB, 0x05, 0xB0, 0x5E, 0x5D, 0xB3, 0x06, 0xE8}},
+    {{0x00, 0x7C, 0xF8, 0x84, 0x77, 0x0B, 0x8F, 0xF3, 0xEE, 0x92, 0x16, 0x6A, 0x99, 0xE5, 0x61, 0x1D},
+     {0x00, 0x5B, 0xB6, 0xED, 0xEB, 0xB0, 0x5D, 0x06, 0x51, 0x0A, 0xE7, 0xBC, 0xBA, 0xE1, 0x0C, 0x57}},
+    {{0x00, 0xF8, 0x77, 0x8F, 0xEE, 0x16, 0x99, 0x61, 0x5B, 0xA3, 0x2C, 0xD4, 0xB5, 0x4D, 0xC2, 0x3A},
+     {0x00, 0xB6, 0xEB, 0x5D, 0x51, 0xE7, 0xBA, 0x0C, 0xA2, 0x14, 0x49, 0xFF, 0xF3, 0x45, 0x18, 0xAE}},
+    {{0x00, 0x77, 0xEE, 0x99, 0x5B, 0x2C, 0xB5, 0xC2, 0xB6, 0xC1, 0x58, 0x2F, 0xED, 0x9A, 0x03, 0x74},
+     {0x00, 0xEB, 0x51, 0xBA, 0xA2, 0x49, 0xF3, 0x18, 0xC3, 0x28, 0x92, 0x79, 0x61, 0x8A, 0x30, 0xDB}},
+    {{0x00, 0xEE, 0x5B, 0xB5, 0xB6, 0x58, 0xED, 0x03, 0xEB, 0x05, 0xB0, 0x5E, 0x5D, 0xB3, 0x06, 0xE8},
+     {0x00, 0x51, 0xA2, 0xF3, 0xC3, 0x92, 0x61, 0x30, 0x01, 0x50, 0xA3, 0xF2, 0xC2, 0x93, 0x60, 0x31}},
+    {{0x00, 0x5B, 0xB6, 0xED, 0xEB, 0xB0, 0x5D, 0x06, 0x51, 0x0A, 0xE7, 0xBC, 0xBA, 0xE1, 0x0C, 0x57},
+     {0x00, 0xA2, 0xC3, 0x61, 0x01, 0xA3, 0xC2, 0x60, 0x02, 0xA0, 0xC1, 0x63, 0x03, 0xA1, 0xC0, 0x62}},
+    {{0x00, 0xB6, 0xEB, 0x5D, 0x51, 0xE7, 0xBA, 0x0C, 0xA2, 0x14, 0x49, 0xFF, 0xF3, 0x45, 0x18, 0xAE},
+     {0x00, 0xC3, 0x01, 0xC2, 0x02, 0xC1, 0x03, 0xC0, 0x04, 0xC7, 0x05, 0xC6, 0x06, 0xC5, 0x07, 0xC4}},
+    {{0x00, 0xEB, 0x51, 0xBA, 0xA2, 0x49, 0xF3, 0x18, 0xC3, 0x28, 0x92, 0x79, 0x61, 0x8A, 0x30, 0xDB},
+     {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F}},
+    {{0x00, 0x51, 0xA2, 0xF3, 0xC3, 0x92, 0x61, 0x30, 0x01, 0x50, 0xA3, 0xF2, 0xC2, 0x93, 0x60, 0x31},
+     {0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E}},
+    {{0x00, 0xA2, 0xC3, 0x61, 0x01, 0xA3, 0xC2, 0x60, 0x02, 0xA0, 0xC1, 0x63, 0x03, 0xA1, 0xC0, 0x62},
+     {0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C}},
+    {{0x00, 0xC3, 0x01, 0xC2, 0x02, 0xC1, 0x03, 0xC0, 0x04, 0xC7, 0x05, 0xC6, 0x06, 0xC5, 0x07, 0xC4},
+     {0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78}},
+};
+
+// exponent of alpha^(i * power) for the i-th syndrome (i counted from 0, so the root is alpha^(i + 1))
+static inline unsigned int ccsds_syndrome_power(unsigned int i, unsigned int power) {
+    return ((i + 1) * power) % 255;
+}
+
+__attribute__((target("ssse3"))) static inline __m128i ccsds_mul_128(__m128i x, unsigned int exponent) {
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    __m128i lo_table = _mm_loadu_si128((const __m128i *)ccsds_rs_nibble_product[exponent][0]);
+    __m128i hi_table = _mm_loadu_si128((const __m128i *)ccsds_rs_nibble_product[exponent][1]);
+    __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(x, nibble_mask));
+    __m128i hi = _mm_shuffle_epi8(hi_table, _mm_and_si128(_mm_srli_epi16(x, 4), nibble_mask));
+    return _mm_xor_si128(lo, hi);
+}
+
+// folds the 16 lanes of acc into one syndrome. lane 0 holds the highest order terms, so each step
+//   multiplies the high order half by alpha^(i * half width) and adds the low order half onto it
+__attribute__((target("ssse3"))) static inline field_element_t ccsds_fold_128(__m128i acc, unsigned int i) {
+    acc = _mm_xor_si128(ccsds_mul_128(acc, ccsds_syndrome_power(i, 8)), _mm_srli_si128(acc, 8));
+    acc = _mm_xor_si128(ccsds_mul_128(acc, ccsds_syndrome_power(i, 4)), _mm_srli_si128(acc, 4));
+    acc = _mm_xor_si128(ccsds_mul_128(acc, ccsds_syndrome_power(i, 2)), _mm_srli_si128(acc, 2));
+    acc = _mm_xor_si128(ccsds_mul_128(acc, ccsds_syndrome_power(i, 1)), _mm_srli_si128(acc, 1));
+    return (field_element_t)_mm_cvtsi128_si32(acc);
+}
+
+__attribute__((target("ssse3"))) static void ccsds_find_syndromes_ssse3(field_t field, const uint8_t *encoded,
+                                                                        size_t encoded_length,
+                                                                        field_element_t *syndromes) {
+    (void)field;
+    __m128i acc[CORRECT_RS_CCSDS_PARITY_LENGTH];
+
+    // the block is walked in 16 byte chunks. the leftover bytes go first, zero padded in
+    //   front, since leading zeros don't change the value of the polynomial
+    size_t head_length = encoded_length % 16;
+    uint8_t head[16] = {0};
+    memcpy(head + 16 - head_length, encoded, head_length);
+    __m128i chunk = _mm_loadu_si128((const __m128i *)head);
+    for (unsigned int i = 0; i < CORRECT_RS_CCSDS_PARITY_LENGTH; i++) {
+        acc[i] = chunk;
+    }
+
+    for (size_t k = head_length; k < encoded_length; k += 16) {
+        chunk = _mm_loadu_si128((const __m128i *)(encoded + k));
+        for (unsigned int i = 0; i < CORRECT_RS_CCSDS_PARITY_LENGTH; i++) {
+            acc[i] = _mm_xor_si128(ccsds_mul_128(acc[i], ccsds_syndrome_power(i, 16)), chunk);
+        }
+    }
+
+    for (unsigned int i = 0; i < CORRECT_RS_CCSDS_PARITY_LENGTH; i++) {
+        syndromes[i] = ccsds_fold_128(acc[i], i);
+    }
+}
+
+__attribute__((target("avx2"))) static inline __m256i ccsds_mul_256(__m256i x, unsigned int exponent) {
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+    __m256i lo_table =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ccsds_rs_nibble_product[exponent][0]));
+    __m256i hi_table =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ccsds_rs_nibble_product[exponent][1]));
+    __m256i lo = _mm256_shuffle_epi8(lo_table, _mm256_and_si256(x, nibble_mask));
+    __m256i hi = _mm256_shuffle_epi8(hi_table, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble_mask));
+    return _mm256_xor_si256(lo, hi);
+}
+
+__attribute__((target("avx2"))) static void ccsds_find_syndromes_avx2(field_t field, const uint8_t *encoded,
+                                                                      size_t encoded_length,
+                                                                      field_element_t *syndromes) {
+    (void)field;
+    __m256i acc[CORRECT_RS_CCSDS_PARITY_LENGTH];
+
+    // same as the ssse3 kernel with 32 byte chunks
+    size_t head_length = encoded_length % 32;
+    uint8_t head[32] = {0};
+    memcpy(head + 32 - head_length, encoded, head_length);
+    __m256i chunk = _mm256_loadu_si256((const __m256i *)head);
+    for (unsigned int i = 0; i < CORRECT_RS_CCSDS_PARITY_LENGTH; i++) {
+        acc[i] = chunk;
+    }
+
+    for (size_t k = head_length; k < encoded_length; k += 32) {
+        chunk = _mm256_loadu_si256((const __m256i *)(encoded + k));
+        for (unsigned int i = 0; i < CORRECT_RS_CCSDS_PARITY_LENGTH; i++) {
+            acc[i] = _mm256_xor_si256(ccsds_mul_256(acc[i], ccsds_syndrome_power(i, 32)), chunk);
+        }
+    }
+
+    for (unsigned int i = 0; i < CORRECT_RS_CCSDS_PARITY_LENGTH; i++) {
+        // fold the high order half onto the low order half, then finish on 16 lanes
+        __m128i high_order = _mm256_castsi256_si128(acc[i]);
+        __m128i low_order = _mm256_extracti128_si256(acc[i], 1);
+        __m128i folded = _mm_xor_si128(ccsds_mul_128(high_order, ccsds_syndrome_power(i, 16)), low_order);
+        syndromes[i] = ccsds_fold_128(folded, i);
+    }
+}
+
+#endif
+
+static correct_rs_syndrome_kernel ccsds_selected_kernel = CORRECT_RS_SYNDROME_KERNEL_AUTO;
+
+static bool ccsds_kernel_supported(correct_rs_syndrome_kernel kernel) {
+    switch (kernel) {
+        case CORRECT_RS_SYNDROME_KERNEL_AUTO:
+        case CORRECT_RS_SYNDROME_KERNEL_SCALAR:
+            return true;
+#ifdef CCSDS_RS_HAVE_X86_KERNELS
+        case CORRECT_RS_SYNDROME_KERNEL_SSSE3:
+            return __builtin_cpu_supports("ssse3");
+        case CORRECT_RS_SYNDROME_KERNEL_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+// resolves CORRECT_RS_SYNDROME_KERNEL_AUTO to the fastest kernel this cpu can run
+static correct_rs_syndrome_kernel ccsds_resolve_kernel(correct_rs_syndrome_kernel kernel) {
+    if (kernel != CORRECT_RS_SYNDROME_KERNEL_AUTO) {
+        return kernel;
+    }
+    if (ccsds_kernel_supported(CORRECT_RS_SYNDROME_KERNEL_AVX2)) {
+        return CORRECT_RS_SYNDROME_KERNEL_AVX2;
+    }
+    if (ccsds_kernel_supported(CORRECT_RS_SYNDROME_KERNEL_SSSE3)) {
+        return CORRECT_RS_SYNDROME_KERNEL_SSSE3;
+    }
+    return CORRECT_RS_SYNDROME_KERNEL_SCALAR;
+}
+
+static ccsds_syndrome_kernel_t ccsds_kernel_function(correct_rs_syndrome_kernel kernel) {
+    switch (ccsds_resolve_kernel(kernel)) {
+#ifdef CCSDS_RS_HAVE_X86_KERNELS
+        case CORRECT_RS_SYNDROME_KERNEL_SSSE3:
+            return ccsds_find_syndromes_ssse3;
+        case CORRECT_RS_SYNDROME_KERNEL_AVX2:
+            return ccsds_find_syndromes_avx2;
+#endif
+        default:
+            return ccsds_find_syndromes_scalar;
+    }
+}
+
+bool correct_reed_solomon_ccsds_set_syndrome_kernel(correct_rs_syndrome_kernel kernel) {
+    if (!ccsds_kernel_supported(kernel)) {
+        return false;
+    }
+    ccsds_selected_kernel = kernel;
+    return true;
+}
+
+correct_rs_syndrome_kernel correct_reed_solomon_ccsds_syndrome_kernel(void) {
+    return ccsds_resolve_kernel(ccsds_selected_kernel);
+}
+
+ccsds_syndrome_kernel_t correct_reed_solomon_ccsds_kernel_function(void) {
+    return ccsds_kernel_function(ccsds_selected_kernel);
+}
+
+ssize_t correct_reed_solomon_decode_ccsds(correct_reed_solomon *rs, const uint8_t *encoded, size_t encoded_length,
+                                          uint8_t *msg) {
+    if (encoded_length > CORRECT_RS_CCSDS_BLOCK_LENGTH || encoded_length < CORRECT_RS_CCSDS_PARITY_LENGTH) {
+        return -1;
+    }
+
+    size_t msg_length = encoded_length - CORRECT_RS_CCSDS_PARITY_LENGTH;
+
+    // only a codec from correct_reed_solomon_create gets here without a kernel. like the rest of
+    //   rs it belongs to the calling thread, so picking one now doesn't race with other codecs
+    if (!rs->ccsds_find_syndromes) {
+        rs->ccsds_find_syndromes = correct_reed_solomon_ccsds_kernel_function();
+    }
+
+    field_element_t syndromes[CORRECT_RS_CCSDS_PARITY_LENGTH];
+    rs->ccsds_find_syndromes(rs->field, encoded, encoded_length, syndromes);
+
+    bool all_zero = true;
+    for (unsigned int i = 0; i < CORRECT_RS_CCSDS_PARITY_LENGTH; i++) {
+        if (syndromes[i]) {
+            all_zero = false;
+            break;
+        }
+    }
+
+    if (all_zero) {
+        // clean block, the message is the front of the block as it stands
+        if (msg != encoded) {
+            memmove(msg, encoded, msg_length);
+        }
+        return msg_length;
+    }
+
+    if (!rs->has_init_decode) {
+        // initialize rs for decoding
+        correct_reed_solomon_decoder_create(rs);
+    }
+
+    // the generic error correction works on the reversed block, see correct_reed_solomon_decode
+    size_t pad_length = rs->block_length - encoded_length;
+    for (unsigned int i = 0; i < encoded_length; i++) {
+        rs->received_polynomial.coeff[i] = encoded[encoded_length - (i + 1)];
+    }
+    for (unsigned int i = 0; i < pad_length; i++) {
+        rs->received_polynomial.coeff[i + encoded_length] = 0;
+    }
+    memcpy(rs->syndromes, syndromes, sizeof(syndromes));
+
+    return reed_solomon_correct_errors(rs, encoded_length, msg);
+}
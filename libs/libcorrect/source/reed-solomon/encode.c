@@ -5,6 +5,14 @@ ssize_t correct_reed_solomon_encode(correct_reed_solomon *rs, const uint8_t *msg
         return -1;
     }
 
+    if (rs->has_static_storage) {
+        // a ccsds codec has no encoder polynomials, but the table-driven encoder gives the same parity
+        if (correct_reed_solomon_encode_ccsds(msg, msg_length, encoded) < 0) {
+            return -1;
+        }
+        return rs->block_length;
+    }
+
     size_t pad_length = rs->message_length - msg_length;
     for (unsigned int i = 0; i < msg_length; i++) {
         // message goes from high order to low order but libcorrect polynomials go low to high
@@ -0,0 +1,566 @@
+#include "correct/reed-solomon/encode.h"
+
+// specialised systematic encoder for the (255, 223) code built by
+//   correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32)
+//
+// instead of building a reversed copy of the message and running a general polynomial_mod,
+//   this runs the division as a 32 byte LFSR. for every message byte the feedback term
+//   (message byte xor leading parity byte) selects a row of precomputed products of the
+//   feedback with every generator coefficient, so there are no log/exp lookups at all.
+//
+// the parity register is held as 8 words of 4 bytes (highest order byte in the top bits of
+//   word 0) so each step is a one byte shift and xor across 8 words rather than 32 bytes.
+//   the table is const so it lives in flash on the OBC and needs no heap.
+
+#define CCSDS_RS_PARITY_WORDS (CORRECT_RS_CCSDS_PARITY_LENGTH / 4)
+
+// ccsds_rs_generator_product[fb][k] packs fb * g(31 - 4k) ... fb * g(28 - 4k), highest order byte first,
+//   where g(i) is the x^i coefficient of the generator (x + alpha^1)(x + alpha^2)...(x + alpha^32)
+static const uint32_t ccsds_rs_generator_product[256][CCSDS_RS_PARITY_WORDS] = {
+    {0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+     0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U},
+    {0x953F9E97U, 0xF23CB9E5U, 0x99B5AB37U, 0xB1FE0D82U,
+     0x850D54F2U, 0x4CE8ACC5U, 0xFBB3DBCDU, 0x7787B63BU},
+    {0xAD7EBBA9U, 0x6378F54DU, 0xB5EDD16EU, 0xE57B1A83U,
+     0x8D1AA863U, 0x9857DF0DU, 0x71E1311DU, 0xEE89EB76U},
+    {0x3841253EU, 0x91444CA8U, 0x2C587A59U, 0x54851701U,
+     0x0817FC91U, 0xD4BF73C8U, 0x8A52EAD0U, 0x990E5D4DU},
+    {0xDDFCF1D5U, 0xC6F06D9AU, 0xED5D25DCU, 0x4DF63481U,
+     0x9D34D7C6U, 0xB7AE391AU, 0xE245623AU, 0x5B9551ECU},
+    {0x48C36F42U, 0x34CCD47FU, 0x74E88EEBU, 0xFC083903U,
+     0x18398334U, 0xFB4695DFU, 0x19F6B9F7U, 0x2C12E7D7U},
+    {0x70824A7CU, 0xA58898D7U, 0x58B0F4B2U, 0xA88D2E02U,
+     0x102E7FA5U, 0x2FF9E617U, 0x93A45327U, 0xB51CBA9AU},
+    {0xE5BDD4EBU, 0x57B42132U, 0xC1055F85U, 0x19732380U,
+     0x95232B57U, 0x63114AD2U, 0x681788EAU, 0xC29B0CA1U},
+    {0x3D7F652DU, 0x0B67DAB3U, 0x5DBA4A3FU, 0x9A6B6885U,
+     0xBD68290BU, 0xE9DB7234U, 0x438AC474U, 0xB6ADA25FU},
+    {0xA840FBBAU, 0xF95B6356U, 0xC40FE108U, 0x2B956507U,
+     0x38657DF9U, 0xA533DEF1U, 0xB8391FB9U, 0xC12A1464U},
+    {0x9001DE84U, 0x681F2FFEU, 0xE8579B51U, 0x7F107206U,
+     0x30728168U, 0x718CAD39U, 0x326BF569U, 0x58244929U},
+    {0x053E4013U, 0x9A23961BU, 0x71E23066U, 0xCEEE7F84U,
+     0xB57FD59AU, 0x3D6401FCU, 0xC9D82EA4U, 0x2FA3FF12U},
+    {0xE08394F8U, 0xCD97B729U, 0xB0E76FE3U, 0xD79D5C04U,
+     0x205CFECDU, 0x5E754B2EU, 0xA1CFA64EU, 0xED38F3B3U},
+    {0x75BC0A6FU, 0x3FAB0ECCU, 0x2952C4D4U, 0x66635186U,
+     0xA551AA3FU, 0x129DE7EBU, 0x5A7C7D83U, 0x9ABF4588U},
+    {0x4DFD2F51U, 0xAEEF4264U, 0x050ABE8DU, 0x32E64687U,
+     0xAD4656AEU, 0xC6229423U, 0xD02E9753U, 0x03B118C5U},
+    {0xD8C2B1C6U, 0x5CD3FB81U, 0x9CBF15BAU, 0x83184B05U,
+     0x284B025CU, 0x8ACA38E6U, 0x2B9D4C9EU, 0x7436AEFEU},
+    {0x7AFECA5AU, 0x16CE33E1U, 0xBAF3947EU, 0xB3D6D08DU,
+     0xFDD05216U, 0x5531E468U, 0x86930FE8U, 0xEBDDC3BEU},
+    {0xEFC154CDU, 0xE4F28A04U, 0x23463F49U, 0x0228DD0FU,
+     0x78DD06E4U, 0x19D948ADU, 0x7D20D425U, 0x9C5A7585U},
+    {0xD78071F3U, 0x75B6C6ACU, 0x0F1E4510U, 0x56ADCA0EU,
+     0x70CAFA75U, 0xCD663B65U, 0xF7723EF5U, 0x055428C8U},
+    {0x42BFEF64U, 0x878A7F49U, 0x96ABEE27U, 0xE753C78CU,
+     0xF5C7AE87U, 0x818E97A0U, 0x0CC1E538U, 0x72D39EF3U},
+    {0xA7023B8FU, 0xD03E5E7BU, 0x57AEB1A2U, 0xFE20E40CU,
+     0x60E485D0U, 0xE29FDD72U, 0x64D66DD2U, 0xB0489252U},
+    {0x323DA518U, 0x2202E79EU, 0xCE1B1A95U, 0x4FDEE98EU,
+     0xE5E9D122U, 0xAE7771B7U, 0x9F65B61FU, 0xC7CF2469U},
+    {0x0A7C8026U, 0xB346AB36U, 0xE24360CCU, 0x1B5BFE8FU,
+     0xEDFE2DB3U, 0x7AC8027FU, 0x15375CCFU, 0x5EC17924U},
+    {0x9F431EB1U, 0x417A12D3U, 0x7BF6CBFBU, 0xAAA5F30DU,
+     0x68F37941U, 0x3620AEBAU, 0xEE848702U, 0x2946CF1FU},
+    {0x4781AF77U, 0x1DA9E952U, 0xE749DE41U, 0x29BDB808U,
+     0x40B87B1DU, 0xBCEA965CU, 0xC519CB9CU, 0x5D7061E1U},
+    {0xD2BE31E0U, 0xEF9550B7U, 0x7EFC7576U, 0x9843B58AU,
+     0xC5B52FEFU, 0xF0023A99U, 0x3EAA1051U, 0x2AF7D7DAU},
+    {0xEAFF14DEU, 0x7ED11C1FU, 0x52A40F2FU, 0xCCC6A28BU,
+     0xCDA2D37EU, 0x24BD4951U, 0xB4F8FA81U, 0xB3F98A97U},
+    {0x7FC08A49U, 0x8CEDA5FAU, 0xCB11A418U, 0x7D38AF09U,
+     0x48AF878CU, 0x6855E594U, 0x4F4B214CU, 0xC47E3CACU},
+    {0x9A7D5EA2U, 0xDB5984C8U, 0x0A14FB9DU, 0x644B8C89U,
+     0xDD8CACDBU, 0x0B44AF46U, 0x275CA9A6U, 0x06E5300DU},
+    {0x0F42C035U, 0x29653D2DU, 0x93A150AAU, 0xD5B5810BU,
+     0x5881F829U, 0x47AC0383U, 0xDCEF726BU, 0x71628636U},
+    {0x3703E50BU, 0xB8217185U, 0xBFF92AF3U, 0x8130960AU,
+     0x509604B8U, 0x9313704BU, 0x56BD98BBU, 0xE86CDB7BU},
+    {0xA23C7B9CU, 0x4A1DC860U, 0x264C81C4U, 0x30CE9B88U,
+     0xD59B504AU, 0xDFFBDC8EU, 0xAD0E4376U, 0x9FEB6D40U},
+    {0xF47B13B4U, 0x2C1B6645U, 0xF361AFFCU, 0xE12B279DU,
+     0x7D27A42CU, 0xAA624FD0U, 0x8BA11E57U, 0x513D01FBU},
+    {0x61448D23U, 0xDE27DFA0U, 0x6AD404CBU, 0x50D52A1FU,
+     0xF82AF0DEU, 0xE68AE315U, 0x7012C59AU, 0x26BAB7C0U},
+    {0x5905A81DU, 0x4F639308U, 0x468C7E92U, 0x04503D1EU,
+     0xF03D0C4FU, 0x323590DDU, 0xFA402F4AU, 0xBFB4EA8DU},
+    {0xCC3A368AU, 0xBD5F2AEDU, 0xDF39D5A5U, 0xB5AE309CU,
+     0x753058BDU, 0x7EDD3C18U, 0x01F3F487U, 0xC8335CB6U},
+    {0x2987E261U, 0xEAEB0BDFU, 0x1E3C8A20U, 0xACDD131CU,
+     0xE01373EAU, 0x1DCC76CAU, 0x69E47C6DU, 0x0AA85017U},
+    {0xBCB87CF6U, 0x18D7B23AU, 0x87892117U, 0x1D231E9EU,
+     0x651E2718U, 0x5124DA0FU, 0x9257A7A0U, 0x7D2FE62CU},
+    {0x84F959C8U, 0x8993FE92U, 0xABD15B4EU, 0x49A6099FU,
+     0x6D09DB89U, 0x859BA9C7U, 0x18054D70U, 0xE421BB61U},
+    {0x11C6C75FU, 0x7BAF4777U, 0x3264F079U, 0xF858041DU,
+     0xE8048F7BU, 0xC9730502U, 0xE3B696BDU, 0x93A60D5AU},
+    {0xC9047699U, 0x277CBCF6U, 0xAEDBE5C3U, 0x7B404F18U,
+     0xC04F8D27U, 0x43B93DE4U, 0xC82BDA23U, 0xE790A3A4U},
+    {0x5C3BE80EU, 0xD5400513U, 0x376E4EF4U, 0xCABE429AU,
+     0x4542D9D5U, 0x0F519121U, 0x339801EEU, 0x9017159FU},
+    {0x647ACD30U, 0x440449BBU, 0x1B3634ADU, 0x9E3B559BU,
+     0x4D552544U, 0xDBEEE2E9U, 0xB9CAEB3EU, 0x091948D2U},
+    {0xF14553A7U, 0xB638F05EU, 0x82839F9AU, 0x2FC55819U,
+     0xC85871B6U, 0x97064E2CU, 0x427930F3U, 0x7E9EFEE9U},
+    {0x14F8874CU, 0xE18CD16CU, 0x4386C01FU, 0x36B67B99U,
+     0x5D7B5AE1U, 0xF41704FEU, 0x2A6EB819U, 0xBC05F248U},
+    {0x81C719DBU, 0x13B06889U, 0xDA336B28U, 0x8748761BU,
+     0xD8760E13U, 0xB8FFA83BU, 0xD1DD63D4U, 0xCB824473U},
+    {0xB9863CE5U, 0x82F42421U, 0xF66B1171U, 0xD3CD611AU,
+     0xD061F282U, 0x6C40DBF3U, 0x5B8F8904U, 0x528C193EU},
+    {0x2CB9A272U, 0x70C89DC4U, 0x6FDEBA46U, 0x62336C98U,
+     0x556CA670U, 0x20A87736U, 0xA03C52C9U, 0x250BAF05U},
+    {0x8E85D9EEU, 0x3AD555A4U, 0x49923B82U, 0x52FDF710U,
+     0x80F7F63AU, 0xFF53ABB8U, 0x0D3211BFU, 0xBAE0C245U},
+    {0x1BBA4779U, 0xC8E9EC41U, 0xD02790B5U, 0xE303FA92U,
+     0x05FAA2C8U, 0xB3BB077DU, 0xF681CA72U, 0xCD67747EU},
+    {0x23FB6247U, 0x59ADA0E9U, 0xFC7FEAECU, 0xB786ED93U,
+     0x0DED5E59U, 0x670474B5U, 0x7CD320A2U, 0x54692933U},
+    {0xB6C4FCD0U, 0xAB91190CU, 0x65CA41DBU, 0x0678E011U,
+     0x88E00AABU, 0x2BECD870U, 0x8760FB6FU, 0x23EE9F08U},
+    {0x5379283BU, 0xFC25383EU, 0xA4CF1E5EU, 0x1F0BC391U,
+     0x1DC321FCU, 0x48FD92A2U, 0xEF777385U, 0xE17593A9U},
+    {0xC646B6ACU, 0x0E1981DBU, 0x3D7AB569U, 0xAEF5CE13U,
+     0x98CE750EU, 0x04153E67U, 0x14C4A848U, 0x96F22592U},
+    {0xFE079392U, 0x9F5DCD73U, 0x1122CF30U, 0xFA70D912U,
+     0x90D9899FU, 0xD0AA4DAFU, 0x9E964298U, 0x0FFC78DFU},
+    {0x6B380D05U, 0x6D617496U, 0x88976407U, 0x4B8ED490U,
+     0x15D4DD6DU, 0x9C42E16AU, 0x65259955U, 0x787BCEE4U},
+    {0xB3FABCC3U, 0x31B28F17U, 0x142871BDU, 0xC8969F95U,
+     0x3D9FDF31U, 0x1688D98CU, 0x4EB8D5CBU, 0x0C4D601AU},
+    {0x26C52254U, 0xC38E36F2U, 0x8D9DDA8AU, 0x79689217U,
+     0xB8928BC3U, 0x5A607549U, 0xB50B0E06U, 0x7BCAD621U},
+    {0x1E84076AU, 0x52CA7A5AU, 0xA1C5A0D3U, 0x2DED8516U,
+     0xB0857752U, 0x8EDF0681U, 0x3F59E4D6U, 0xE2C48B6CU},
+    {0x8BBB99FDU, 0xA0F6C3BFU, 0x38700BE4U, 0x9C138894U,
+     0x358823A0U, 0xC237AA44U, 0xC4EA3F1BU, 0x95433D57U},
+    {0x6E064D16U, 0xF742E28DU, 0xF9755461U, 0x8560AB14U,
+     0xA0AB08F7U, 0xA126E096U, 0xACFDB7F1U, 0x57D831F6U},
+    {0xFB39D381U, 0x057E5B68U, 0x60C0FF56U, 0x349EA696U,
+     0x25A65C05U, 0xEDCE4C53U, 0x574E6C3CU, 0x205F87CDU},
+    {0xC378F6BFU, 0x943A17C0U, 0x4C98850FU, 0x601BB197U,
+     0x2DB1A094U, 0x39713F9BU, 0xDD1C86ECU, 0xB951DA80U},
+    {0x56476828U, 0x6606AE25U, 0xD52D2E38U, 0xD1E5BC15U,
+     0xA8BCF466U, 0x7599935EU, 0x26AF5D21U, 0xCED66CBBU},
+    {0x6FF626EFU, 0x5836CC8AU, 0x61C2D97FU, 0x45564EBDU,
+     0xFA4ECF58U, 0xD3C49E27U, 0x91C53CAEU, 0xA27A0271U},
+    {0xFAC9B878U, 0xAA0A756FU, 0xF8777248U, 0xF4A8433FU,
+     0x7F439BAAU, 0x9F2C32E2U, 0x6A76E763U, 0xD5FDB44AU},
+    {0xC2889D46U, 0x3B4E39C7U, 0xD42F0811U, 0xA02D543EU,
+     0x7754673BU, 0x4B93412AU, 0xE0240DB3U, 0x4CF3E907U},
+    {0x57B703D1U, 0xC9728022U, 0x4D9AA326U, 0x11D359BCU,
+     0xF25933C9U, 0x077BEDEFU, 0x1B97D67EU, 0x3B745F3CU},
+    {0xB20AD73AU, 0x9EC6A110U, 0x8C9FFCA3U, 0x08A07A3CU,
+     0x677A189EU, 0x646AA73DU, 0x73805E94U, 0xF9EF539DU},
+    {0x273549ADU, 0x6CFA18F5U, 0x152A5794U, 0xB95E77BEU,
+     0xE2774C6CU, 0x28820BF8U, 0x88338559U, 0x8E68E5A6U},
+    {0x1F746C93U, 0xFDBE545DU, 0x39722DCDU, 0xEDDB60BFU,
+     0xEA60B0FDU, 0xFC3D7830U, 0x02616F89U, 0x1766B8EBU},
+    {0x8A4BF204U, 0x0F82EDB8U, 0xA0C786FAU, 0x5C256D3DU,
+     0x6F6DE40FU, 0xB0D5D4F5U, 0xF9D2B444U, 0x60E10ED0U},
+    {0x528943C2U, 0x53511639U, 0x3C789340U, 0xDF3D2638U,
+     0x4726E653U, 0x3A1FEC13U, 0xD24FF8DAU, 0x14D7A02EU},
+    {0xC7B6DD55U, 0xA16DAFDCU, 0xA5CD3877U, 0x6EC32BBAU,
+     0xC22BB2A1U, 0x76F740D6U, 0x29FC2317U, 0x63501615U},
+    {0xFFF7F86BU, 0x3029E374U, 0x8995422EU, 0x3A463CBBU,
+     0xCA3C4E30U, 0xA248331EU, 0xA3AEC9C7U, 0xFA5E4B58U},
+    {0x6AC866FCU, 0xC2155A91U, 0x1020E919U, 0x8BB83139U,
+     0x4F311AC2U, 0xEEA09FDBU, 0x581D120AU, 0x8DD9FD63U},
+    {0x8F75B217U, 0x95A17BA3U, 0xD125B69CU, 0x92CB12B9U,
+     0xDA123195U, 0x8DB1D509U, 0x300A9AE0U, 0x4F42F1C2U},
+    {0x1A4A2C80U, 0x679DC246U, 0x48901DABU, 0x23351F3BU,
+     0x5F1F6567U, 0xC15979CCU, 0xCBB9412DU, 0x38C547F9U},
+    {0x220B09BEU, 0xF6D98EEEU, 0x64C867F2U, 0x77B0083AU,
+     0x570899F6U, 0x15E60A04U, 0x41EBABFDU, 0xA1CB1AB4U},
+    {0xB7349729U, 0x04E5370BU, 0xFD7DCCC5U, 0xC64E05B8U,
+     0xD205CD04U, 0x590EA6C1U, 0xBA587030U, 0xD64CAC8FU},
+    {0x1508ECB5U, 0x4EF8FF6BU, 0xDB314D01U, 0xF6809E30U,
+     0x079E9D4EU, 0x86F57A4FU, 0x17563346U, 0x49A7C1CFU},
+    {0x80377222U, 0xBCC4468EU, 0x4284E636U, 0x477E93B2U,
+     0x8293C9BCU, 0xCA1DD68AU, 0xECE5E88BU, 0x3E2077F4U},
+    {0xB876571CU, 0x2D800A26U, 0x6EDC9C6FU, 0x13FB84B3U,
+     0x8A84352DU, 0x1EA2A542U, 0x66B7025BU, 0xA72E2AB9U},
+    {0x2D49C98BU, 0xDFBCB3C3U, 0xF7693758U, 0xA2058931U,
+     0x0F8961DFU, 0x524A0987U, 0x9D04D996U, 0xD0A99C82U},
+    {0xC8F41D60U, 0x880892F1U, 0x366C68DDU, 0xBB76AAB1U,
+     0x9AAA4A88U, 0x315B4355U, 0xF513517CU, 0x12329023U},
+    {0x5DCB83F7U, 0x7A342B14U, 0xAFD9C3EAU, 0x0A88A733U,
+     0x1FA71E7AU, 0x7DB3EF90U, 0x0EA08AB1U, 0x65B52618U},
+    {0x658AA6C9U, 0xEB7067BCU, 0x8381B9B3U, 0x5E0DB032U,
+     0x17B0E2EBU, 0xA90C9C58U, 0x84F26061U, 0xFCBB7B55U},
+    {0xF0B5385EU, 0x194CDE59U, 0x1A341284U, 0xEFF3BDB0U,
+     0x92BDB619U, 0xE5E4309DU, 0x7F41BBACU, 0x8B3CCD6EU},
+    {0x28778998U, 0x459F25D8U, 0x868B073EU, 0x6CEBF6B5U,
+     0xBAF6B445U, 0x6F2E087BU, 0x54DCF732U, 0xFF0A6390U},
+    {0xBD48170FU, 0xB7A39C3DU, 0x1F3EAC09U, 0xDD15FB37U,
+     0x3FFBE0B7U, 0x23C6A4BEU, 0xAF6F2CFFU, 0x888DD5ABU},
+    {0x85093231U, 0x26E7D095U, 0x3366D650U, 0x8990EC36U,
+     0x37EC1C26U, 0xF779D776U, 0x253DC62FU, 0x118388E6U},
+    {0x1036ACA6U, 0xD4DB6970U, 0xAAD37D67U, 0x386EE1B4U,
+     0xB2E148D4U, 0xBB917BB3U, 0xDE8E1DE2U, 0x66043EDDU},
+    {0xF58B784DU, 0x836F4842U, 0x6BD622E2U, 0x211DC234U,
+     0x27C26383U, 0xD8803161U, 0xB6999508U, 0xA49F327CU},
+    {0x60B4E6DAU, 0x7153F1A7U, 0xF26389D5U, 0x90E3CFB6U,
+     0xA2CF3771U, 0x94689DA4U, 0x4D2A4EC5U, 0xD3188447U},
+    {0x58F5C3E4U, 0xE017BD0FU, 0xDE3BF38CU, 0xC466D8B7U,
+     0xAAD8CBE0U, 0x40D7EE6CU, 0xC778A415U, 0x4A16D90AU},
+    {0xCDCA5D73U, 0x122B04EAU, 0x478E58BBU, 0x7598D535U,
+     0x2FD59F12U, 0x0C3F42A9U, 0x3CCB7FD8U, 0x3D916F31U},
+    {0x9B8D355BU, 0x742DAACFU, 0x92A37683U, 0xA47D6920U,
+     0x87696B74U, 0x79A6D1F7U, 0x1A6422F9U, 0xF347038AU},
+    {0x0EB2ABCCU, 0x8611132AU, 0x0B16DDB4U, 0x158364A2U,
+     0x02643F86U, 0x354E7D32U, 0xE1D7F934U, 0x84C0B5B1U},
+    {0x36F38EF2U, 0x17555F82U, 0x274EA7EDU, 0x410673A3U,
+     0x0A73C317U, 0xE1F10EFAU, 0x6B8513E4U, 0x1DCEE8FCU},
+    {0xA3CC1065U, 0xE569E667U, 0xBEFB0CDAU, 0xF0F87E21U,
+     0x8F7E97E5U, 0xAD19A23FU, 0x9036C829U, 0x6A495EC7U},
+    {0x4671C48EU, 0xB2DDC755U, 0x7FFE535FU, 0xE98B5DA1U,
+     0x1A5DBCB2U, 0xCE08E8EDU, 0xF82140C3U, 0xA8D25266U},
+    {0xD34E5A19U, 0x40E17EB0U, 0xE64BF868U, 0x58755023U,
+     0x9F50E840U, 0x82E04428U, 0x03929B0EU, 0xDF55E45DU},
+    {0xEB0F7F27U, 0xD1A53218U, 0xCA138231U, 0x0CF04722U,
+     0x974714D1U, 0x565F37E0U, 0x89C071DEU, 0x465BB910U},
+    {0x7E30E1B0U, 0x23998BFDU, 0x53A62906U, 0xBD0E4AA0U,
+     0x124A4023U, 0x1AB79B25U, 0x7273AA13U, 0x31DC0F2BU},
+    {0xA6F25076U, 0x7F4A707CU, 0xCF193CBCU, 0x3E1601A5U,
+     0x3A01427FU, 0x907DA3C3U, 0x59EEE68DU, 0x45EAA1D5U},
+    {0x33CDCEE1U, 0x8D76C999U, 0x56AC978BU, 0x8FE80C27U,
+     0xBF0C168DU, 0xDC950F06U, 0xA25D3D40U, 0x326D17EEU},
+    {0x0B8CEBDFU, 0x1C328531U, 0x7AF4EDD2U, 0xDB6D1B26U,
+     0xB71BEA1CU, 0x082A7CCEU, 0x280FD790U, 0xAB634AA3U},
+    {0x9EB37548U, 0xEE0E3CD4U, 0xE34146E5U, 0x6A9316A4U,
+     0x3216BEEEU, 0x44C2D00BU, 0xD3BC0C5DU, 0xDCE4FC98U},
+    {0x7B0EA1A3U, 0xB9BA1DE6U, 0x22441960U, 0x73E03524U,
+     0xA73595B9U, 0x27D39AD9U, 0xBBAB84B7U, 0x1E7FF039U},
+    {0xEE313F34U, 0x4B86A403U, 0xBBF1B257U, 0xC21E38A6U,
+     0x2238C14BU, 0x6B3B361CU, 0x40185F7AU, 0x69F84602U},
+    {0xD6701A0AU, 0xDAC2E8ABU, 0x97A9C80EU, 0x969B2FA7U,
+     0x2A2F3DDAU, 0xBF8445D4U, 0xCA4AB5AAU, 0xF0F61B4FU},
+    {0x434F849DU, 0x28FE514EU, 0x0E1C6339U, 0x27652225U,
+     0xAF226928U, 0xF36CE911U, 0x31F96E67U, 0x8771AD74U},
+    {0xE173FF01U, 0x62E3992EU, 0x2850E2FDU, 0x17ABB9ADU,
+     0x7AB93962U, 0x2C97359FU, 0x9CF72D11U, 0x189AC034U},
+    {0x744C6196U, 0x90DF20CBU, 0xB1E549CAU, 0xA655B42FU,
+     0xFFB46D90U, 0x607F995AU, 0x6744F6DCU, 0x6F1D760FU},
+    {0x4C0D44A8U, 0x019B6C63U, 0x9DBD3393U, 0xF2D0A32EU,
+     0xF7A39101U, 0xB4C0EA92U, 0xED161C0CU, 0xF6132B42U},
+    {0xD932DA3FU, 0xF3A7D586U, 0x040898A4U, 0x432EAEACU,
+     0x72AEC5F3U, 0xF8284657U, 0x16A5C7C1U, 0x81949D79U},
+    {0x3C8F0ED4U, 0xA413F4B4U, 0xC50DC721U, 0x5A5D8D2CU,
+     0xE78DEEA4U, 0x9B390C85U, 0x7EB24F2BU, 0x430F91D8U},
+    {0xA9B09043U, 0x562F4D51U, 0x5CB86C16U, 0xEBA380AEU,
+     0x6280BA56U, 0xD7D1A040U, 0x850194E6U, 0x348827E3U},
+    {0x91F1B57DU, 0xC76B01F9U, 0x70E0164FU, 0xBF2697AFU,
+     0x6A9746C7U, 0x036ED388U, 0x0F537E36U, 0xAD867AAEU},
+    {0x04CE2BEAU, 0x3557B81CU, 0xE955BD78U, 0x0ED89A2DU,
+     0xEF9A1235U, 0x4F867F4DU, 0xF4E0A5FBU, 0xDA01CC95U},
+    {0xDC0C9A2CU, 0x6984439DU, 0x75EAA8C2U, 0x8DC0D128U,
+     0xC7D11069U, 0xC54C47ABU, 0xDF7DE965U, 0xAE37626BU},
+    {0x493304BBU, 0x9BB8FA78U, 0xEC5F03F5U, 0x3C3EDCAAU,
+     0x42DC449BU, 0x89A4EB6EU, 0x24CE32A8U, 0xD9B0D450U},
+    {0x71722185U, 0x0AFCB6D0U, 0xC00779ACU, 0x68BBCBABU,
+     0x4ACBB80AU, 0x5D1B98A6U, 0xAE9CD878U, 0x40BE891DU},
+    {0xE44DBF12U, 0xF8C00F35U, 0x59B2D29BU, 0xD945C629U,
+     0xCFC6ECF8U, 0x11F33463U, 0x552F03B5U, 0x37393F26U},
+    {0x01F06BF9U, 0xAF742E07U, 0x98B78D1EU, 0xC036E5A9U,
+     0x5AE5C7AFU, 0x72E27EB1U, 0x3D388B5FU, 0xF5A23387U},
+    {0x94CFF56EU, 0x5D4897E2U, 0x01022629U, 0x71C8E82BU,
+     0xDFE8935DU, 0x3E0AD274U, 0xC68B5092U, 0x822585BCU},
+    {0xAC8ED050U, 0xCC0CDB4AU, 0x2D5A5C70U, 0x254DFF2AU,
+     0xD7FF6FCCU, 0xEAB5A1BCU, 0x4CD9BA42U, 0x1B2BD8F1U},
+    {0x39B14EC7U, 0x3E3062AFU, 0xB4EFF747U, 0x94B3F2A8U,
+     0x52F23B3EU, 0xA65D0D79U, 0xB76A618FU, 0x6CAC6ECAU},
+    {0xDE6B4C59U, 0xB06C1F93U, 0xC20335FEU, 0x8AAC9CFDU,
+     0x739C19B0U, 0x210FBB4EU, 0xA50D78DBU, 0xC3F404E2U},
+    {0x4B54D2CEU, 0x4250A676U, 0x5BB69EC9U, 0x3B52917FU,
+     0xF6914D42U, 0x6DE7178BU, 0x5EBEA316U, 0xB473B2D9U},
+    {0x7315F7F0U, 0xD314EADEU, 0x77EEE490U, 0x6FD7867EU,
+     0xFE86B1D3U, 0xB9586443U, 0xD4EC49C6U, 0x2D7DEF94U},
+    {0xE62A6967U, 0x2128533BU, 0xEE5B4FA7U, 0xDE298BFCU,
+     0x7B8BE521U, 0xF5B0C886U, 0x2F5F920BU, 0x5AFA59AFU},
+    {0x0397BD8CU, 0x769C7209U, 0x2F5E1022U, 0xC75AA87CU,
+     0xEEA8CE76U, 0x96A18254U, 0x47481AE1U, 0x9861550EU},
+    {0x96A8231BU, 0x84A0CBECU, 0xB6EBBB15U, 0x76A4A5FEU,
+     0x6BA59A84U, 0xDA492E91U, 0xBCFBC12CU, 0xEFE6E335U},
+    {0xAEE90625U, 0x15E48744U, 0x9AB3C14CU, 0x2221B2FFU,
+     0x63B26615U, 0x0EF65D59U, 0x36A92BFCU, 0x76E8BE78U},
+    {0x3BD698B2U, 0xE7D83EA1U, 0x03066A7BU, 0x93DFBF7DU,
+     0xE6BF32E7U, 0x421EF19CU, 0xCD1AF031U, 0x016F0843U},
+    {0xE3142974U, 0xBB0BC520U, 0x9FB97FC1U, 0x10C7F478U,
+     0xCEF430BBU, 0xC8D4C97AU, 0xE687BCAFU, 0x7559A6BDU},
+    {0x762BB7E3U, 0x49377CC5U, 0x060CD4F6U, 0xA139F9FAU,
+     0x4BF96449U, 0x843C65BFU, 0x1D346762U, 0x02DE1086U},
+    {0x4E6A92DDU, 0xD873306DU, 0x2A54AEAFU, 0xF5BCEEFBU,
+     0x43EE98D8U, 0x50831677U, 0x97668DB2U, 0x9BD04DCBU},
+    {0xDB550C4AU, 0x2A4F8988U, 0xB3E10598U, 0x4442E379U,
+     0xC6E3CC2AU, 0x1C6BBAB2U, 0x6CD5567FU, 0xEC57FBF0U},
+    {0x3EE8D8A1U, 0x7DFBA8BAU, 0x72E45A1DU, 0x5D31C0F9U,
+     0x53C0E77DU, 0x7F7AF060U, 0x04C2DE95U, 0x2ECCF751U},
+    {0xABD74636U, 0x8FC7115FU, 0xEB51F12AU, 0xECCFCD7BU,
+     0xD6CDB38FU, 0x33925CA5U, 0xFF710558U, 0x594B416AU},
+    {0x93966308U, 0x1E835DF7U, 0xC7098B73U, 0xB84ADA7AU,
+     0xDEDA4F1EU, 0xE72D2F6DU, 0x7523EF88U, 0xC0451C27U},
+    {0x06A9FD9FU, 0xECBFE412U, 0x5EBC2044U, 0x09B4D7F8U,
+     0x5BD71BECU, 0xABC583A8U, 0x8E903445U, 0xB7C2AA1CU},
+    {0xA4958603U, 0xA6A22C72U, 0x78F0A180U, 0x397A4C70U,
+     0x8E4C4BA6U, 0x743E5F26U, 0x239E7733U, 0x2829C75CU},
+    {0x31AA1894U, 0x549E9597U, 0xE1450AB7U, 0x888441F2U,
+     0x0B411F54U, 0x38D6F3E3U, 0xD82DACFEU, 0x5FAE7167U},
+    {0x09EB3DAAU, 0xC5DAD93FU, 0xCD1D70EEU, 0xDC0156F3U,
+     0x0356E3C5U, 0xEC69802BU, 0x527F462EU, 0xC6A02C2AU},
+    {0x9CD4A33DU, 0x37E660DAU, 0x54A8DBD9U, 0x6DFF5B71U,
+     0x865BB737U, 0xA0812CEEU, 0xA9CC9DE3U, 0xB1279A11U},
+    {0x796977D6U, 0x605241E8U, 0x95AD845CU, 0x748C78F1U,
+     0x13789C60U, 0xC390663CU, 0xC1DB1509U, 0x73BC96B0U},
+    {0xEC56E941U, 0x926EF80DU, 0x0C182F6BU, 0xC5727573U,
+     0x9675C892U, 0x8F78CAF9U, 0x3A68CEC4U, 0x043B208BU},
+    {0xD417CC7FU, 0x032AB4A5U, 0x20405532U, 0x91F76272U,
+     0x9E623403U, 0x5BC7B931U, 0xB03A2414U, 0x9D357DC6U},
+    {0x412852E8U, 0xF1160D40U, 0xB9F5FE05U, 0x20096FF0U,
+     0x1B6F60F1U, 0x172F15F4U, 0x4B89FFD9U, 0xEAB2CBFDU},
+    {0x99EAE32EU, 0xADC5F6C1U, 0x254AEBBFU, 0xA31124F5U,
+     0x332462ADU, 0x9DE52D12U, 0x6014B347U, 0x9E846503U},
+    {0x0CD57DB9U, 0x5FF94F24U, 0xBCFF4088U, 0x12EF2977U,
+     0xB629365FU, 0xD10D81D7U, 0x9BA7688AU, 0xE903D338U},
+    {0x34945887U, 0xCEBD038CU, 0x90A73AD1U, 0x466A3E76U,
+     0xBE3ECACEU, 0x05B2F21FU, 0x11F5825AU, 0x700D8E75U},
+    {0xA1ABC610U, 0x3C81BA69U, 0x091291E6U, 0xF79433F4U,
+     0x3B339E3CU, 0x495A5EDAU, 0xEA465997U, 0x078A384EU},
+    {0x441612FBU, 0x6B359B5BU, 0xC817CE63U, 0xEEE71074U,
+     0xAE10B56BU, 0x2A4B1408U, 0x8251D17DU, 0xC51134EFU},
+    {0xD1298C6CU, 0x990922BEU, 0x51A26554U, 0x5F191DF6U,
+     0x2B1DE199U, 0x66A3B8CDU, 0x79E20AB0U, 0xB29682D4U},
+    {0xE968A952U, 0x084D6E16U, 0x7DFA1F0DU, 0x0B9C0AF7U,
+     0x230A1D08U, 0xB21CCB05U, 0xF3B0E060U, 0x2B98DF99U},
+    {0x7C5737C5U, 0xFA71D7F3U, 0xE44FB43AU, 0xBA620775U,
+     0xA60749FAU, 0xFEF467C0U, 0x08033BADU, 0x5C1F69A2U},
+    {0x2A105FEDU, 0x9C7779D6U, 0x31629A02U, 0x6B87BB60U,
+     0x0EBBBD9CU, 0x8B6DF49EU, 0x2EAC668CU, 0x92C90519U},
+    {0xBF2FC17AU, 0x6E4BC033U, 0xA8D73135U, 0xDA79B6E2U,
+     0x8BB6E96EU, 0xC785585BU, 0xD51FBD41U, 0xE54EB322U},
+    {0x876EE444U, 0xFF0F8C9BU, 0x848F4B6CU, 0x8EFCA1E3U,
+     0x83A115FFU, 0x133A2B93U, 0x5F4D5791U, 0x7C40EE6FU},
+    {0x12517AD3U, 0x0D33357EU, 0x1D3AE05BU, 0x3F02AC61U,
+     0x06AC410DU, 0x5FD28756U, 0xA4FE8C5CU, 0x0BC75854U},
+    {0xF7ECAE38U, 0x5A87144CU, 0xDC3FBFDEU, 0x26718FE1U,
+     0x938F6A5AU, 0x3CC3CD84U, 0xCCE904B6U, 0xC95C54F5U},
+    {0x62D330AFU, 0xA8BBADA9U, 0x458A14E9U, 0x978F8263U,
+     0x16823EA8U, 0x702B6141U, 0x375ADF7BU, 0xBEDBE2CEU},
+    {0x5A921591U, 0x39FFE101U, 0x69D26EB0U, 0xC30A9562U,
+     0x1E95C239U, 0xA4941289U, 0xBD0835ABU, 0x27D5BF83U},
+    {0xCFAD8B06U, 0xCBC358E4U, 0xF067C587U, 0x72F498E0U,
+     0x9B9896CBU, 0xE87CBE4CU, 0x46BBEE66U, 0x505209B8U},
+    {0x176F3AC0U, 0x9710A365U, 0x6CD8D03DU, 0xF1ECD3E5U,
+     0xB3D39497U, 0x62B686AAU, 0x6D26A2F8U, 0x2464A746U},
+    {0x8250A457U, 0x652C1A80U, 0xF56D7B0AU, 0x4012DE67U,
+     0x36DEC065U, 0x2E5E2A6FU, 0x96957935U, 0x53E3117DU},
+    {0xBA118169U, 0xF4685628U, 0xD9350153U, 0x1497C966U,
+     0x3EC93CF4U, 0xFAE159A7U, 0x1CC793E5U, 0xCAED4C30U},
+    {0x2F2E1FFEU, 0x0654EFCDU, 0x4080AA64U, 0xA569C4E4U,
+     0xBBC46806U, 0xB609F562U, 0xE7744828U, 0xBD6AFA0BU},
+    {0xCA93CB15U, 0x51E0CEFFU, 0x8185F5E1U, 0xBC1AE764U,
+     0x2EE74351U, 0xD518BFB0U, 0x8F63C0C2U, 0x7FF1F6AAU},
+    {0x5FAC5582U, 0xA3DC771AU, 0x18305ED6U, 0x0DE4EAE6U,
+     0xABEA17A3U, 0x99F01375U, 0x74D01B0FU, 0x08764091U},
+    {0x67ED70BCU, 0x32983BB2U, 0x3468248FU, 0x5961FDE7U,
+     0xA3FDEB32U, 0x4D4F60BDU, 0xFE82F1DFU, 0x91781DDCU},
+    {0xF2D2EE2BU, 0xC0A48257U, 0xADDD8FB8U, 0xE89FF065U,
+     0x26F0BFC0U, 0x01A7CC78U, 0x05312A12U, 0xE6FFABE7U},
+    {0x50EE95B7U, 0x8AB94A37U, 0x8B910E7CU, 0xD8516BEDU,
+     0xF36BEF8AU, 0xDE5C10F6U, 0xA83F6964U, 0x7914C6A7U},
+    {0xC5D10B20U, 0x7885F3D2U, 0x1224A54BU, 0x69AF666FU,
+     0x7666BB78U, 0x92B4BC33U, 0x538CB2A9U, 0x0E93709CU},
+    {0xFD902E1EU, 0xE9C1BF7AU, 0x3E7CDF12U, 0x3D2A716EU,
+     0x7E7147E9U, 0x460BCFFBU, 0xD9DE5879U, 0x979D2DD1U},
+    {0x68AFB089U, 0x1BFD069FU, 0xA7C97425U, 0x8CD47CECU,
+     0xFB7C131BU, 0x0AE3633EU, 0x226D83B4U, 0xE01A9BEAU},
+    {0x8D126462U, 0x4C4927ADU, 0x66CC2BA0U, 0x95A75F6CU,
+     0x6E5F384CU, 0x69F229ECU, 0x4A7A0B5EU, 0x2281974BU},
+    {0x182DFAF5U, 0xBE759E48U, 0xFF798097U, 0x245952EEU,
+     0xEB526CBEU, 0x251A8529U, 0xB1C9D093U, 0x55062170U},
+    {0x206CDFCBU, 0x2F31D2E0U, 0xD321FACEU, 0x70DC45EFU,
+     0xE345902FU, 0xF1A5F6E1U, 0x3B9B3A43U, 0xCC087C3DU},
+    {0xB553415CU, 0xDD0D6B05U, 0x4A9451F9U, 0xC122486DU,
+     0x6648C4DDU, 0xBD4D5A24U, 0xC028E18EU, 0xBB8FCA06U},
+    {0x6D91F09AU, 0x81DE9084U, 0xD62B4443U, 0x423A0368U,
+     0x4E03C681U, 0x378762C2U, 0xEBB5AD10U, 0xCFB964F8U},
+    {0xF8AE6E0DU, 0x73E22961U, 0x4F9EEF74U, 0xF3C40EEAU,
+     0xCB0E9273U, 0x7B6FCE07U, 0x100676DDU, 0xB83ED2C3U},
+    {0xC0EF4B33U, 0xE2A665C9U, 0x63C6952DU, 0xA74119EBU,
+     0xC3196EE2U, 0xAFD0BDCFU, 0x9A549C0DU, 0x21308F8EU},
+    {0x55D0D5A4U, 0x109ADC2CU, 0xFA733E1AU, 0x16BF1469U,
+     0x46143A10U, 0xE338110AU, 0x61E747C0U, 0x56B739B5U},
+    {0xB06D014FU, 0x472EFD1EU, 0x3B76619FU, 0x0FCC37E9U,
+     0xD3371147U, 0x80295BD8U, 0x09F0CF2AU, 0x942C3514U},
+    {0x25529FD8U, 0xB51244FBU, 0xA2C3CAA8U, 0xBE323A6BU,
+     0x563A45B5U, 0xCCC1F71DU, 0xF24314E7U, 0xE3AB832FU},
+    {0x1D13BAE6U, 0x24560853U, 0x8E9BB0F1U, 0xEAB72D6AU,
+     0x5E2DB924U, 0x187E84D5U, 0x7811FE37U, 0x7AA5DE62U},
+    {0x882C2471U, 0xD66AB1B6U, 0x172E1BC6U, 0x5B4920E8U,
+     0xDB20EDD6U, 0x54962810U, 0x83A225FAU, 0x0D226859U},
+    {0xB19D6AB6U, 0xE85AD319U, 0xA3C1EC81U, 0xCFFAD240U,
+     0x89D2D6E8U, 0xF2CB2569U, 0x34C84475U, 0x618E0693U},
+    {0x24A2F421U, 0x1A666AFCU, 0x3A7447B6U, 0x7E04DFC2U,
+     0x0CDF821AU, 0xBE2389ACU, 0xCF7B9FB8U, 0x1609B0A8U},
+    {0x1CE3D11FU, 0x8B222654U, 0x162C3DEFU, 0x2A81C8C3U,
+     0x04C87E8BU, 0x6A9CFA64U, 0x45297568U, 0x8F07EDE5U},
+    {0x89DC4F88U, 0x791E9FB1U, 0x8F9996D8U, 0x9B7FC541U,
+     0x81C52A79U, 0x267456A1U, 0xBE9AAEA5U, 0xF8805BDEU},
+    {0x6C619B63U, 0x2EAABE83U, 0x4E9CC95DU, 0x820CE6C1U,
+     0x14E6012EU, 0x45651C73U, 0xD68D264FU, 0x3A1B577FU},
+    {0xF95E05F4U, 0xDC960766U, 0xD729626AU, 0x33F2EB43U,
+     0x91EB55DCU, 0x098DB0B6U, 0x2D3EFD82U, 0x4D9CE144U},
+    {0xC11F20CAU, 0x4DD24BCEU, 0xFB711833U, 0x6777FC42U,
+     0x99FCA94DU, 0xDD32C37EU, 0xA76C1752U, 0xD492BC09U},
+    {0x5420BE5DU, 0xBFEEF22BU, 0x62C4B304U, 0xD689F1C0U,
+     0x1CF1FDBFU, 0x91DA6FBBU, 0x5CDFCC9FU, 0xA3150A32U},
+    {0x8CE20F9BU, 0xE33D09AAU, 0xFE7BA6BEU, 0x5591BAC5U,
+     0x34BAFFE3U, 0x1B10575DU, 0x77428001U, 0xD723A4CCU},
+    {0x19DD910CU, 0x1101B04FU, 0x67CE0D89U, 0xE46FB747U,
+     0xB1B7AB11U, 0x57F8FB98U, 0x8CF15BCCU, 0xA0A412F7U},
+    {0x219CB432U, 0x8045FCE7U, 0x4B9677D0U, 0xB0EAA046U,
+     0xB9A05780U, 0x83478850U, 0x06A3B11CU, 0x39AA4FBAU},
+    {0xB4A32AA5U, 0x72794502U, 0xD223DCE7U, 0x0114ADC4U,
+     0x3CAD0372U, 0xCFAF2495U, 0xFD106AD1U, 0x4E2DF981U},
+    {0x511EFE4EU, 0x25CD6430U, 0x13268362U, 0x18678E44U,
+     0xA98E2825U, 0xACBE6E47U, 0x9507E23BU, 0x8CB6F520U},
+    {0xC42160D9U, 0xD7F1DDD5U, 0x8A932855U, 0xA99983C6U,
+     0x2C837CD7U, 0xE056C282U, 0x6EB439F6U, 0xFB31431BU},
+    {0xFC6045E7U, 0x46B5917DU, 0xA6CB520CU, 0xFD1C94C7U,
+     0x24948046U, 0x34E9B14AU, 0xE4E6D326U, 0x623F1E56U},
+    {0x695FDB70U, 0xB4892898U, 0x3F7EF93BU, 0x4CE29945U,
+     0xA199D4B4U, 0x78011D8FU, 0x1F5508EBU, 0x15B8A86DU},
+    {0xCB63A0ECU, 0xFE94E0F8U, 0x193278FFU, 0x7C2C02CDU,
+     0x740284FEU, 0xA7FAC101U, 0xB25B4B9DU, 0x8A53C52DU},
+    {0x5E5C3E7BU, 0x0CA8591DU, 0x8087D3C8U, 0xCDD20F4FU,
+     0xF10FD00CU, 0xEB126DC4U, 0x49E89050U, 0xFDD47316U},
+    {0x661D1B45U, 0x9DEC15B5U, 0xACDFA991U, 0x9957184EU,
+     0xF9182C9DU, 0x3FAD1E0CU, 0xC3BA7A80U, 0x64DA2E5BU},
+    {0xF32285D2U, 0x6FD0AC50U, 0x356A02A6U, 0x28A915CCU,
+     0x7C15786FU, 0x7345B2C9U, 0x3809A14DU, 0x135D9860U},
+    {0x169F5139U, 0x38648D62U, 0xF46F5D23U, 0x31DA364CU,
+     0xE9365338U, 0x1054F81BU, 0x501E29A7U, 0xD1C694C1U},
+    {0x83A0CFAEU, 0xCA583487U, 0x6DDAF614U, 0x80243BCEU,
+     0x6C3B07CAU, 0x5CBC54DEU, 0xABADF26AU, 0xA64122FAU},
+    {0xBBE1EA90U, 0x5B1C782FU, 0x41828C4DU, 0xD4A12CCFU,
+     0x642CFB5BU, 0x88032716U, 0x21FF18BAU, 0x3F4F7FB7U},
+    {0x2EDE7407U, 0xA920C1CAU, 0xD837277AU, 0x655F214DU,
+     0xE121AFA9U, 0xC4EB8BD3U, 0xDA4CC377U, 0x48C8C98CU},
+    {0xF61CC5C1U, 0xF5F33A4BU, 0x448832C0U, 0xE6476A48U,
+     0xC96AADF5U, 0x4E21B335U, 0xF1D18FE9U, 0x3CFE6772U},
+    {0x63235B56U, 0x07CF83AEU, 0xDD3D99F7U, 0x57B967CAU,
+     0x4C67F907U, 0x02C91FF0U, 0x0A625424U, 0x4B79D149U},
+    {0x5B627E68U, 0x968BCF06U, 0xF165E3AEU, 0x033C70CBU,
+     0x44700596U, 0xD6766C38U, 0x8030BEF4U, 0xD2778C04U},
+    {0xCE5DE0FFU, 0x64B776E3U, 0x68D04899U, 0xB2C27D49U,
+     0xC17D5164U, 0x9A9EC0FDU, 0x7B836539U, 0xA5F03A3FU},
+    {0x2BE03414U, 0x330357D1U, 0xA9D5171CU, 0xABB15EC9U,
+     0x545E7A33U, 0xF98F8A2FU, 0x1394EDD3U, 0x676B369EU},
+    {0xBEDFAA83U, 0xC13FEE34U, 0x3060BC2BU, 0x1A4F534BU,
+     0xD1532EC1U, 0xB56726EAU, 0xE827361EU, 0x10EC80A5U},
+    {0x869E8FBDU, 0x507BA29CU, 0x1C38C672U, 0x4ECA444AU,
+     0xD944D250U, 0x61D85522U, 0x6275DCCEU, 0x89E2DDE8U},
+    {0x13A1112AU, 0xA2471B79U, 0x858D6D45U, 0xFF3449C8U,
+     0x5C4986A2U, 0x2D30F9E7U, 0x99C60703U, 0xFE656BD3U},
+    {0x45E67902U, 0xC441B55CU, 0x50A0437DU, 0x2ED1F5DDU,
+     0xF4F572C4U, 0x58A96AB9U, 0xBF695A22U, 0x30B30768U},
+    {0xD0D9E795U, 0x367D0CB9U, 0xC915E84AU, 0x9F2FF85FU,
+     0x71F82636U, 0x1441C67CU, 0x44DA81EFU, 0x4734B153U},
+    {0xE898C2ABU, 0xA7394011U, 0xE54D9213U, 0xCBAAEF5EU,
+     0x79EFDAA7U, 0xC0FEB5B4U, 0xCE886B3FU, 0xDE3AEC1EU},
+    {0x7DA75C3CU, 0x5505F9F4U, 0x7CF83924U, 0x7A54E2DCU,
+     0xFCE28E55U, 0x8C161971U, 0x353BB0F2U, 0xA9BD5A25U},
+    {0x981A88D7U, 0x02B1D8C6U, 0xBDFD66A1U, 0x6327C15CU,
+     0x69C1A502U, 0xEF0753A3U, 0x5D2C3818U, 0x6B265684U},
+    {0x0D251640U, 0xF08D6123U, 0x2448CD96U, 0xD2D9CCDEU,
+     0xECCCF1F0U, 0xA3EFFF66U, 0xA69FE3D5U, 0x1CA1E0BFU},
+    {0x3564337EU, 0x61C92D8BU, 0x0810B7CFU, 0x865CDBDFU,
+     0xE4DB0D61U, 0x77508CAEU, 0x2CCD0905U, 0x85AFBDF2U},
+    {0xA05BADE9U, 0x93F5946EU, 0x91A51CF8U, 0x37A2D65DU,
+     0x61D65993U, 0x3BB8206BU, 0xD77ED2C8U, 0xF2280BC9U},
+    {0x78991C2FU, 0xCF266FEFU, 0x0D1A0942U, 0xB4BA9D58U,
+     0x499D5BCFU, 0xB172188DU, 0xFCE39E56U, 0x861EA537U},
+    {0xEDA682B8U, 0x3D1AD60AU, 0x94AFA275U, 0x054490DAU,
+     0xCC900F3DU, 0xFD9AB448U, 0x0750459BU, 0xF199130CU},
+    {0xD5E7A786U, 0xAC5E9AA2U, 0xB8F7D82CU, 0x51C187DBU,
+     0xC487F3ACU, 0x2925C780U, 0x8D02AF4BU, 0x68974E41U},
+    {0x40D83911U, 0x5E622347U, 0x2142731BU, 0xE03F8A59U,
+     0x418AA75EU, 0x65CD6B45U, 0x76B17486U, 0x1F10F87AU},
+    {0xA565EDFAU, 0x09D60275U, 0xE0472C9EU, 0xF94CA9D9U,
+     0xD4A98C09U, 0x06DC2197U, 0x1EA6FC6CU, 0xDD8BF4DBU},
+    {0x305A736DU, 0xFBEABB90U, 0x79F287A9U, 0x48B2A45BU,
+     0x51A4D8FBU, 0x4A348D52U, 0xE51527A1U, 0xAA0C42E0U},
+    {0x081B5653U, 0x6AAEF738U, 0x55AAFDF0U, 0x1C37B35AU,
+     0x59B3246AU, 0x9E8BFE9AU, 0x6F47CD71U, 0x33021FADU},
+    {0x9D24C8C4U, 0x98924EDDU, 0xCC1F56C7U, 0xADC9BED8U,
+     0xDCBE7098U, 0xD263525FU, 0x94F416BCU, 0x4485A996U},
+    {0x3F18B358U, 0xD28F86BDU, 0xEA53D703U, 0x9D072550U,
+     0x092520D2U, 0x0D988ED1U, 0x39FA55CAU, 0xDB6EC4D6U},
+    {0xAA272DCFU, 0x20B33F58U, 0x73E67C34U, 0x2CF928D2U,
+     0x8C287420U, 0x41702214U, 0xC2498E07U, 0xACE972EDU},
+    {0x926608F1U, 0xB1F773F0U, 0x5FBE066DU, 0x787C3FD3U,
+     0x843F88B1U, 0x95CF51DCU, 0x481B64D7U, 0x35E72FA0U},
+    {0x07599666U, 0x43CBCA15U, 0xC60BAD5AU, 0xC9823251U,
+     0x0132DC43U, 0xD927FD19U, 0xB3A8BF1AU, 0x4260999BU},
+    {0xE2E4428DU, 0x147FEB27U, 0x070EF2DFU, 0xD0F111D1U,
+     0x9411F714U, 0xBA36B7CBU, 0xDBBF37F0U, 0x80FB953AU},
+    {0x77DBDC1AU, 0xE64352C2U, 0x9EBB59E8U, 0x610F1C53U,
+     0x111CA3E6U, 0xF6DE1B0EU, 0x200CEC3DU, 0xF77C2301U},
+    {0x4F9AF924U, 0x77071E6AU, 0xB2E323B1U, 0x358A0B52U,
+     0x190B5F77U, 0x226168C6U, 0xAA5E06EDU, 0x6E727E4CU},
+    {0xDAA567B3U, 0x853BA78FU, 0x2B568886U, 0x847406D0U,
+     0x9C060B85U, 0x6E89C403U, 0x51EDDD20U, 0x19F5C877U},
+    {0x0267D675U, 0xD9E85C0EU, 0xB7E99D3CU, 0x076C4DD5U,
+     0xB44D09D9U, 0xE443FCE5U, 0x7A7091BEU, 0x6DC36689U},
+    {0x975848E2U, 0x2BD4E5EBU, 0x2E5C360BU, 0xB6924057U,
+     0x31405D2BU, 0xA8AB5020U, 0x81C34A73U, 0x1A44D0B2U},
+    {0xAF196DDCU, 0xBA90A943U, 0x02044C52U, 0xE2175756U,
+     0x3957A1BAU, 0x7C1423E8U, 0x0B91A0A3U, 0x834A8DFFU},
+    {0x3A26F34BU, 0x48AC10A6U, 0x9BB1E765U, 0x53E95AD4U,
+     0xBC5AF548U, 0x30FC8F2DU, 0xF0227B6EU, 0xF4CD3BC4U},
+    {0xDF9B27A0U, 0x1F183194U, 0x5AB4B8E0U, 0x4A9A7954U,
+     0x2979DE1FU, 0x53EDC5FFU, 0x9835F384U, 0x36563765U},
+    {0x4AA4B937U, 0xED248871U, 0xC30113D7U, 0xFB6474D6U,
+     0xAC748AEDU, 0x1F05693AU, 0x63862849U, 0x41D1815EU},
+    {0x72E59C09U, 0x7C60C4D9U, 0xEF59698EU, 0xAFE163D7U,
+     0xA463767CU, 0xCBBA1AF2U, 0xE9D4C299U, 0xD8DFDC13U},
+    {0xE7DA029EU, 0x8E5C7D3CU, 0x76ECC2B9U, 0x1E1F6E55U,
+     0x216E228EU, 0x8752B637U, 0x12671954U, 0xAF586A28U}
+};
+
+ssize_t correct_reed_solomon_encode_ccsds(const uint8_t *msg, size_t msg_length, uint8_t *encoded) {
+    if (msg_length > CORRECT_RS_CCSDS_MESSAGE_LENGTH) {
+        return -1;
+    }
+
+    uint32_t parity[CCSDS_RS_PARITY_WORDS] = {0};
+
+    // shorter blocks have virtual leading zero padding, which leaves the register at 0,
+    //   so only the real message bytes need to be clocked through
+    for (size_t i = 0; i < msg_length; i++) {
+        uint8_t feedback = msg[i] ^ (uint8_t)(parity[0] >> 24);
+        const uint32_t *product = ccsds_rs_generator_product[feedback];
+        for (unsigned int k = 0; k < CCSDS_RS_PARITY_WORDS - 1; k++) {
+            parity[k] = ((parity[k] << 8) | (parity[k + 1] >> 24)) ^ product[k];
+        }
+        parity[CCSDS_RS_PARITY_WORDS - 1] = (parity[CCSDS_RS_PARITY_WORDS - 1] << 8) ^ product[CCSDS_RS_PARITY_WORDS - 1];
+    }
+
+    // msg and encoded are allowed to be the same buffer
+    if (encoded != msg) {
+        memmove(encoded, msg, msg_length);
+    }
+
+    uint8_t *parity_out = encoded + msg_length;
+    for (unsigned int k = 0; k < CCSDS_RS_PARITY_WORDS; k++) {
+        parity_out[4 * k] = (uint8_t)(parity[k] >> 24);
+        parity_out[4 * k + 1] = (uint8_t)(parity[k] >> 16);
+        parity_out[4 * k + 2] = (uint8_t)(parity[k] >> 8);
+        parity_out[4 * k + 3] = (uint8_t)parity[k];
+    }
+
+    return msg_length + CORRECT_RS_CCSDS_PARITY_LENGTH;
+}
@@ -25,9 +25,9 @@ correct_reed_solomon *correct_reed_solomon_create(field_operation_t primitive_po
     rs->first_consecutive_root = first_consecutive_root;
     rs->generator_root_gap = generator_root_gap;
 
-    rs->generator_roots = sysMalloc(rs->min_distance * sizeof(field_element_t));
-
-    rs->generator = reed_solomon_build_generator(rs->field, rs->min_distance, rs->first_consecutive_root, rs->generator_root_gap, rs->generator, rs->generator_roots);
+    field_element_t *generator_roots = sysMalloc(rs->min_distance * sizeof(field_element_t));
+    rs->generator = reed_solomon_build_generator(rs->field, rs->min_distance, rs->first_consecutive_root, rs->generator_root_gap, rs->generator, generator_roots);
+    rs->generator_roots = generator_roots;
 
     rs->encoded_polynomial = polynomial_create(rs->block_length - 1);
     rs->encoded_remainder = polynomial_create(rs->block_length - 1);
@@ -38,9 +38,12 @@ correct_reed_solomon *correct_reed_solomon_create(field_operation_t primitive_po
 }
 
 void correct_reed_solomon_destroy(correct_reed_solomon *rs) {
+    if (rs->has_static_storage) {
+        return;
+    }
     field_destroy(rs->field);
     polynomial_destroy(rs->generator);
-    sysFreeMem(rs->generator_roots);
+    sysFreeMem((void *)rs->generator_roots);
     polynomial_destroy(rs->encoded_polynomial);
     polynomial_destroy(rs->encoded_remainder);
     if (rs->has_init_decode) {
@@ -57,15 +60,17 @@ void correct_reed_solomon_destroy(correct_reed_solomon *rs) {
         polynomial_destroy(rs->error_evaluator);
         polynomial_destroy(rs->error_locator_derivative);
         for (unsigned int i = 0; i < rs->min_distance; i++) {
-            sysFreeMem(rs->generator_root_exp[i]);
+            sysFreeMem((void *)rs->generator_root_exp[i]);
         }
-        sysFreeMem(rs->generator_root_exp);
+        sysFreeMem((void *)rs->generator_root_exp);
         for (field_operation_t i = 0; i < 256; i++) {
-            sysFreeMem(rs->element_exp[i]);
+            sysFreeMem((void *)rs->element_exp[i]);
         }
-        sysFreeMem(rs->element_exp);
+        sysFreeMem((void *)rs->element_exp);
         polynomial_destroy(rs->init_from_roots_scratch[0]);
         polynomial_destroy(rs->init_from_roots_scratch[1]);
+        sysFreeMem(rs->syndrome_copy);
+        polynomial_destroy(rs->combined_locator);
     }
     sysFreeMem(rs);
 }
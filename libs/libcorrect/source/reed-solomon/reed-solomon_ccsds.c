@@ -0,0 +1,72 @@
+#include "correct/reed-solomon/ccsds.h"
+
+// sets up a (255, 223) codec in caller provided storage. everything correct_reed_solomon_create
+//   and correct_reed_solomon_decoder_create would allocate either points into the const tables
+//   in tables_ccsds.c or into the scratch buffers in ccsds_rs_codec_t.
+//   built separately from those tables so that tools/gen_ccsds_rs_tables.c can link without them
+
+_Static_assert(sizeof(correct_reed_solomon_ccsds) == sizeof(ccsds_rs_codec_t),
+               "correct_reed_solomon_ccsds must mirror ccsds_rs_codec_t");
+_Static_assert(_Alignof(correct_reed_solomon_ccsds) == _Alignof(ccsds_rs_codec_t),
+               "correct_reed_solomon_ccsds must mirror ccsds_rs_codec_t");
+
+correct_reed_solomon *correct_reed_solomon_ccsds_init(correct_reed_solomon_ccsds *storage) {
+    if (!storage) {
+        return NULL;
+    }
+
+    ccsds_rs_codec_t *codec = (ccsds_rs_codec_t *)storage;
+
+    correct_reed_solomon *rs = &codec->rs;
+    memset(rs, 0, sizeof(correct_reed_solomon));
+    rs->field.exp = correct_rs_ccsds_exp;
+    rs->field.log = correct_rs_ccsds_log;
+
+    rs->block_length = CORRECT_RS_CCSDS_BLOCK_LENGTH;
+    rs->min_distance = CCSDS_RS_ROOTS;
+    rs->message_length = CORRECT_RS_CCSDS_MESSAGE_LENGTH;
+
+    rs->first_consecutive_root = 1;
+    rs->generator_root_gap = 1;
+
+    // the generator is never written after it's built, the cast only satisfies polynomial_t
+    rs->generator.coeff = (field_element_t *)correct_rs_ccsds_generator;
+    rs->generator.order = CCSDS_RS_ROOTS;
+    rs->generator_roots = correct_rs_ccsds_generator_roots;
+
+    // encoded_polynomial and encoded_remainder are left empty since
+    //   correct_reed_solomon_encode hands this codec to correct_reed_solomon_encode_ccsds
+
+    // the decoder is ready up front, so the first corrupted block takes as long as any other
+    rs->syndromes = codec->syndromes;
+    rs->modified_syndromes = codec->modified_syndromes;
+    rs->received_polynomial = (polynomial_t){codec->received_polynomial, CORRECT_RS_CCSDS_BLOCK_LENGTH - 1};
+    rs->error_locator = (polynomial_t){codec->error_locator, CCSDS_RS_ROOTS};
+    rs->error_locator_log = (polynomial_t){codec->error_locator_log, CCSDS_RS_ROOTS};
+    rs->erasure_locator = (polynomial_t){codec->erasure_locator, CCSDS_RS_ROOTS};
+    rs->error_roots = codec->error_roots;
+    rs->error_vals = codec->error_vals;
+    rs->error_locations = codec->error_locations;
+    rs->last_error_locator = (polynomial_t){codec->last_error_locator, CCSDS_RS_ROOTS};
+    rs->error_evaluator = (polynomial_t){codec->error_evaluator, CCSDS_RS_ROOTS - 1};
+    rs->error_locator_derivative = (polynomial_t){codec->error_locator_derivative, CCSDS_RS_ROOTS - 1};
+    rs->init_from_roots_scratch[0] = (polynomial_t){codec->init_from_roots_scratch[0], CCSDS_RS_ROOTS};
+    rs->init_from_roots_scratch[1] = (polynomial_t){codec->init_from_roots_scratch[1], CCSDS_RS_ROOTS};
+    rs->syndrome_copy = codec->syndrome_copy;
+    rs->combined_locator = (polynomial_t){codec->combined_locator, CCSDS_RS_ROOTS};
+    memset(codec->syndromes, 0, sizeof(codec->syndromes));
+    memset(codec->modified_syndromes, 0, sizeof(codec->modified_syndromes));
+    memset(codec->error_roots, 0, sizeof(codec->error_roots));
+
+    rs->generator_root_exp = correct_rs_ccsds_generator_root_exp;
+    rs->element_exp = correct_rs_ccsds_element_exp;
+
+    // resolved here rather than on the first block, so threads decoding with their own codec
+    //   never write the kernel selection
+    rs->ccsds_find_syndromes = correct_reed_solomon_ccsds_kernel_function();
+
+    rs->has_init_decode = true;
+    rs->has_static_storage = true;
+
+    return rs;
+}
@@ -0,0 +1,1971 @@
+#include "correct/reed-solomon/ccsds.h"
+
+// generated by tools/gen_ccsds_rs_tables.c, do not edit
+//
+// these are the tables correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32)
+//   and correct_reed_solomon_decoder_create would otherwise build on the heap
+
+const field_element_t correct_rs_ccsds_exp[512] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xAD, 0xDD, 0x3D, 0x7A, 0xF4,
+    0x6F, 0xDE, 0x3B, 0x76, 0xEC, 0x5F, 0xBE, 0xFB, 0x71, 0xE2, 0x43, 0x86, 0x8B, 0x91, 0xA5, 0xCD,
+    0x1D, 0x3A, 0x74, 0xE8, 0x57, 0xAE, 0xDB, 0x31, 0x62, 0xC4, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0x67,
+    0xCE, 0x1B, 0x36, 0x6C, 0xD8, 0x37, 0x6E, 0xDC, 0x3F, 0x7E, 0xFC, 0x7F, 0xFE, 0x7B, 0xF6, 0x6B,
+    0xD6, 0x2B, 0x56, 0xAC, 0xDF, 0x39, 0x72, 0xE4, 0x4F, 0x9E, 0xBB, 0xF1, 0x65, 0xCA, 0x13, 0x26,
+    0x4C, 0x98, 0xB7, 0xE9, 0x55, 0xAA, 0xD3, 0x21, 0x42, 0x84, 0x8F, 0x99, 0xB5, 0xED, 0x5D, 0xBA,
+    0xF3, 0x61, 0xC2, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0,
+    0x47, 0x8E, 0x9B, 0xB1, 0xE5, 0x4D, 0x9A, 0xB3, 0xE1, 0x45, 0x8A, 0x93, 0xA1, 0xC5, 0x0D, 0x1A,
+    0x34, 0x68, 0xD0, 0x27, 0x4E, 0x9C, 0xBF, 0xF9, 0x75, 0xEA, 0x53, 0xA6, 0xCB, 0x11, 0x22, 0x44,
+    0x88, 0x97, 0xA9, 0xD5, 0x2D, 0x5A, 0xB4, 0xEF, 0x59, 0xB2, 0xE3, 0x41, 0x82, 0x83, 0x81, 0x85,
+    0x8D, 0x9D, 0xBD, 0xFD, 0x7D, 0xFA, 0x73, 0xE6, 0x4B, 0x96, 0xAB, 0xD1, 0x25, 0x4A, 0x94, 0xAF,
+    0xD9, 0x35, 0x6A, 0xD4, 0x2F, 0x5E, 0xBC, 0xFF, 0x79, 0xF2, 0x63, 0xC6, 0x0B, 0x16, 0x2C, 0x58,
+    0xB0, 0xE7, 0x49, 0x92, 0xA3, 0xC1, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0xC7, 0x09, 0x12, 0x24,
+    0x48, 0x90, 0xA7, 0xC9, 0x15, 0x2A, 0x54, 0xA8, 0xD7, 0x29, 0x52, 0xA4, 0xCF, 0x19, 0x32, 0x64,
+    0xC8, 0x17, 0x2E, 0x5C, 0xB8, 0xF7, 0x69, 0xD2, 0x23, 0x46, 0x8C, 0x9F, 0xB9, 0xF5, 0x6D, 0xDA,
+    0x33, 0x66, 0xCC, 0x1F, 0x3E, 0x7C, 0xF8, 0x77, 0xEE, 0x5B, 0xB6, 0xEB, 0x51, 0xA2, 0xC3, 0x01,
+    0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xAD, 0xDD, 0x3D, 0x7A, 0xF4, 0x6F,
+    0xDE, 0x3B, 0x76, 0xEC, 0x5F, 0xBE, 0xFB, 0x71, 0xE2, 0x43, 0x86, 0x8B, 0x91, 0xA5, 0xCD, 0x1D,
+    0x3A, 0x74, 0xE8, 0x57, 0xAE, 0xDB, 0x31, 0x62, 0xC4, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0x67, 0xCE,
+    0x1B, 0x36, 0x6C, 0xD8, 0x37, 0x6E, 0xDC, 0x3F, 0x7E, 0xFC, 0x7F, 0xFE, 0x7B, 0xF6, 0x6B, 0xD6,
+    0x2B, 0x56, 0xAC, 0xDF, 0x39, 0x72, 0xE4, 0x4F, 0x9E, 0xBB, 0xF1, 0x65, 0xCA, 0x13, 0x26, 0x4C,
+    0x98, 0xB7, 0xE9, 0x55, 0xAA, 0xD3, 0x21, 0x42, 0x84, 0x8F, 0x99, 0xB5, 0xED, 0x5D, 0xBA, 0xF3,
+    0x61, 0xC2, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0x47,
+    0x8E, 0x9B, 0xB1, 0xE5, 0x4D, 0x9A, 0xB3, 0xE1, 0x45, 0x8A, 0x93, 0xA1, 0xC5, 0x0D, 0x1A, 0x34,
+    0x68, 0xD0, 0x27, 0x4E, 0x9C, 0xBF, 0xF9, 0x75, 0xEA, 0x53, 0xA6, 0xCB, 0x11, 0x22, 0x44, 0x88,
+    0x97, 0xA9, 0xD5, 0x2D, 0x5A, 0xB4, 0xEF, 0x59, 0xB2, 0xE3, 0x41, 0x82, 0x83, 0x81, 0x85, 0x8D,
+    0x9D, 0xBD, 0xFD, 0x7D, 0xFA, 0x73, 0xE6, 0x4B, 0x96, 0xAB, 0xD1, 0x25, 0x4A, 0x94, 0xAF, 0xD9,
+    0x35, 0x6A, 0xD4, 0x2F, 0x5E, 0xBC, 0xFF, 0x79, 0xF2, 0x63, 0xC6, 0x0B, 0x16, 0x2C, 0x58, 0xB0,
+    0xE7, 0x49, 0x92, 0xA3, 0xC1, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0xC7, 0x09, 0x12, 0x24, 0x48,
+    0x90, 0xA7, 0xC9, 0x15, 0x2A, 0x54, 0xA8, 0xD7, 0x29, 0x52, 0xA4, 0xCF, 0x19, 0x32, 0x64, 0xC8,
+    0x17, 0x2E, 0x5C, 0xB8, 0xF7, 0x69, 0xD2, 0x23, 0x46, 0x8C, 0x9F, 0xB9, 0xF5, 0x6D, 0xDA, 0x33,
+    0x66, 0xCC, 0x1F, 0x3E, 0x7C, 0xF8, 0x77, 0xEE, 0x5B, 0xB6, 0xEB, 0x51, 0xA2, 0xC3, 0x01, 0x02,
+};
+
+const field_logarithm_t correct_rs_ccsds_log[256] = {
+    0x00, 0xFF, 0x01, 0x63, 0x02, 0xC6, 0x64, 0x6A, 0x03, 0xCD, 0xC7, 0xBC, 0x65, 0x7E, 0x6B, 0x2A,
+    0x04, 0x8D, 0xCE, 0x4E, 0xC8, 0xD4, 0xBD, 0xE1, 0x66, 0xDD, 0x7F, 0x31, 0x6C, 0x20, 0x2B, 0xF3,
+    0x05, 0x57, 0x8E, 0xE8, 0xCF, 0xAC, 0x4F, 0x83, 0xC9, 0xD9, 0xD5, 0x41, 0xBE, 0x94, 0xE2, 0xB4,
+    0x67, 0x27, 0xDE, 0xF0, 0x80, 0xB1, 0x32, 0x35, 0x6D, 0x45, 0x21, 0x12, 0x2C, 0x0D, 0xF4, 0x38,
+    0x06, 0x9B, 0x58, 0x1A, 0x8F, 0x79, 0xE9, 0x70, 0xD0, 0xC2, 0xAD, 0xA8, 0x50, 0x75, 0x84, 0x48,
+    0xCA, 0xFC, 0xDA, 0x8A, 0xD6, 0x54, 0x42, 0x24, 0xBF, 0x98, 0x95, 0xF9, 0xE3, 0x5E, 0xB5, 0x15,
+    0x68, 0x61, 0x28, 0xBA, 0xDF, 0x4C, 0xF1, 0x2F, 0x81, 0xE6, 0xB2, 0x3F, 0x33, 0xEE, 0x36, 0x10,
+    0x6E, 0x18, 0x46, 0xA6, 0x22, 0x88, 0x13, 0xF7, 0x2D, 0xB8, 0x0E, 0x3D, 0xF5, 0xA4, 0x39, 0x3B,
+    0x07, 0x9E, 0x9C, 0x9D, 0x59, 0x9F, 0x1B, 0x08, 0x90, 0x09, 0x7A, 0x1C, 0xEA, 0xA0, 0x71, 0x5A,
+    0xD1, 0x1D, 0xC3, 0x7B, 0xAE, 0x0A, 0xA9, 0x91, 0x51, 0x5B, 0x76, 0x72, 0x85, 0xA1, 0x49, 0xEB,
+    0xCB, 0x7C, 0xFD, 0xC4, 0xDB, 0x1E, 0x8B, 0xD2, 0xD7, 0x92, 0x55, 0xAA, 0x43, 0x0B, 0x25, 0xAF,
+    0xC0, 0x73, 0x99, 0x77, 0x96, 0x5C, 0xFA, 0x52, 0xE4, 0xEC, 0x5F, 0x4A, 0xB6, 0xA2, 0x16, 0x86,
+    0x69, 0xC5, 0x62, 0xFE, 0x29, 0x7D, 0xBB, 0xCC, 0xE0, 0xD3, 0x4D, 0x8C, 0xF2, 0x1F, 0x30, 0xDC,
+    0x82, 0xAB, 0xE7, 0x56, 0xB3, 0x93, 0x40, 0xD8, 0x34, 0xB0, 0xEF, 0x26, 0x37, 0x0C, 0x11, 0x44,
+    0x6F, 0x78, 0x19, 0x9A, 0x47, 0x74, 0xA7, 0xC1, 0x23, 0x53, 0x89, 0xFB, 0x14, 0x5D, 0xF8, 0x97,
+    0x2E, 0x4B, 0xB9, 0x60, 0x0F, 0xED, 0x3E, 0xE5, 0xF6, 0x87, 0xA5, 0x17, 0x3A, 0xA3, 0x3C, 0xB7,
+};
+
+const field_element_t correct_rs_ccsds_generator[CCSDS_RS_ROOTS + 1] = {
+    0x3B, 0xB6, 0x87, 0x77, 0xCD, 0xDB, 0xB3, 0xFB, 0xC5, 0xAC, 0xE8, 0x4C, 0xF2, 0x54, 0x0D, 0x85,
+    0x82, 0x0D, 0xFE, 0xB1, 0x37, 0xAB, 0xB5, 0x99, 0xE5, 0xB9, 0x3C, 0xF2, 0x97, 0x9E, 0x3F, 0x95,
+    0x01,
+};
+
+const field_element_t correct_rs_ccsds_generator_roots[CCSDS_RS_ROOTS] = {
+    0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xAD, 0xDD, 0x3D, 0x7A, 0xF4, 0x6F,
+    0xDE, 0x3B, 0x76, 0xEC, 0x5F, 0xBE, 0xFB, 0x71, 0xE2, 0x43, 0x86, 0x8B, 0x91, 0xA5, 0xCD, 0x1D,
+};
+
+static const field_logarithm_t ccsds_generator_root_exp_rows[32][255] = {
+    {
+        0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+        0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+        0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+        0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+        0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+        0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+        0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+        0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE,
+    },
+    {
+        0xFF, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E,
+        0x20, 0x22, 0x24, 0x26, 0x28, 0x2A, 0x2C, 0x2E, 0x30, 0x32, 0x34, 0x36, 0x38, 0x3A, 0x3C, 0x3E,
+        0x40, 0x42, 0x44, 0x46, 0x48, 0x4A, 0x4C, 0x4E, 0x50, 0x52, 0x54, 0x56, 0x58, 0x5A, 0x5C, 0x5E,
+        0x60, 0x62, 0x64, 0x66, 0x68, 0x6A, 0x6C, 0x6E, 0x70, 0x72, 0x74, 0x76, 0x78, 0x7A, 0x7C, 0x7E,
+        0x80, 0x82, 0x84, 0x86, 0x88, 0x8A, 0x8C, 0x8E, 0x90, 0x92, 0x94, 0x96, 0x98, 0x9A, 0x9C, 0x9E,
+        0xA0, 0xA2, 0xA4, 0xA6, 0xA8, 0xAA, 0xAC, 0xAE, 0xB0, 0xB2, 0xB4, 0xB6, 0xB8, 0xBA, 0xBC, 0xBE,
+        0xC0, 0xC2, 0xC4, 0xC6, 0xC8, 0xCA, 0xCC, 0xCE, 0xD0, 0xD2, 0xD4, 0xD6, 0xD8, 0xDA, 0xDC, 0xDE,
+        0xE0, 0xE2, 0xE4, 0xE6, 0xE8, 0xEA, 0xEC, 0xEE, 0xF0, 0xF2, 0xF4, 0xF6, 0xF8, 0xFA, 0xFC, 0xFE,
+        0x01, 0x03, 0x05, 0x07, 0x09, 0x0B, 0x0D, 0x0F, 0x11, 0x13, 0x15, 0x17, 0x19, 0x1B, 0x1D, 0x1F,
+        0x21, 0x23, 0x25, 0x27, 0x29, 0x2B, 0x2D, 0x2F, 0x31, 0x33, 0x35, 0x37, 0x39, 0x3B, 0x3D, 0x3F,
+        0x41, 0x43, 0x45, 0x47, 0x49, 0x4B, 0x4D, 0x4F, 0x51, 0x53, 0x55, 0x57, 0x59, 0x5B, 0x5D, 0x5F,
+        0x61, 0x63, 0x65, 0x67, 0x69, 0x6B, 0x6D, 0x6F, 0x71, 0x73, 0x75, 0x77, 0x79, 0x7B, 0x7D, 0x7F,
+        0x81, 0x83, 0x85, 0x87, 0x89, 0x8B, 0x8D, 0x8F, 0x91, 0x93, 0x95, 0x97, 0x99, 0x9B, 0x9D, 0x9F,
+        0xA1, 0xA3, 0xA5, 0xA7, 0xA9, 0xAB, 0xAD, 0xAF, 0xB1, 0xB3, 0xB5, 0xB7, 0xB9, 0xBB, 0xBD, 0xBF,
+        0xC1, 0xC3, 0xC5, 0xC7, 0xC9, 0xCB, 0xCD, 0xCF, 0xD1, 0xD3, 0xD5, 0xD7, 0xD9, 0xDB, 0xDD, 0xDF,
+        0xE1, 0xE3, 0xE5, 0xE7, 0xE9, 0xEB, 0xED, 0xEF, 0xF1, 0xF3, 0xF5, 0xF7, 0xF9, 0xFB, 0xFD,
+    },
+    {
+        0xFF, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x12, 0x15, 0x18, 0x1B, 0x1E, 0x21, 0x24, 0x27, 0x2A, 0x2D,
+        0x30, 0x33, 0x36, 0x39, 0x3C, 0x3F, 0x42, 0x45, 0x48, 0x4B, 0x4E, 0x51, 0x54, 0x57, 0x5A, 0x5D,
+        0x60, 0x63, 0x66, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x78, 0x7B, 0x7E, 0x81, 0x84, 0x87, 0x8A, 0x8D,
+        0x90, 0x93, 0x96, 0x99, 0x9C, 0x9F, 0xA2, 0xA5, 0xA8, 0xAB, 0xAE, 0xB1, 0xB4, 0xB7, 0xBA, 0xBD,
+        0xC0, 0xC3, 0xC6, 0xC9, 0xCC, 0xCF, 0xD2, 0xD5, 0xD8, 0xDB, 0xDE, 0xE1, 0xE4, 0xE7, 0xEA, 0xED,
+        0xF0, 0xF3, 0xF6, 0xF9, 0xFC, 0xFF, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x12, 0x15, 0x18, 0x1B, 0x1E,
+        0x21, 0x24, 0x27, 0x2A, 0x2D, 0x30, 0x33, 0x36, 0x39, 0x3C, 0x3F, 0x42, 0x45, 0x48, 0x4B, 0x4E,
+        0x51, 0x54, 0x57, 0x5A, 0x5D, 0x60, 0x63, 0x66, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x78, 0x7B, 0x7E,
+        0x81, 0x84, 0x87, 0x8A, 0x8D, 0x90, 0x93, 0x96, 0x99, 0x9C, 0x9F, 0xA2, 0xA5, 0xA8, 0xAB, 0xAE,
+        0xB1, 0xB4, 0xB7, 0xBA, 0xBD, 0xC0, 0xC3, 0xC6, 0xC9, 0xCC, 0xCF, 0xD2, 0xD5, 0xD8, 0xDB, 0xDE,
+        0xE1, 0xE4, 0xE7, 0xEA, 0xED, 0xF0, 0xF3, 0xF6, 0xF9, 0xFC, 0xFF, 0x03, 0x06, 0x09, 0x0C, 0x0F,
+        0x12, 0x15, 0x18, 0x1B, 0x1E, 0x21, 0x24, 0x27, 0x2A, 0x2D, 0x30, 0x33, 0x36, 0x39, 0x3C, 0x3F,
+        0x42, 0x45, 0x48, 0x4B, 0x4E, 0x51, 0x54, 0x57, 0x5A, 0x5D, 0x60, 0x63, 0x66, 0x69, 0x6C, 0x6F,
+        0x72, 0x75, 0x78, 0x7B, 0x7E, 0x81, 0x84, 0x87, 0x8A, 0x8D, 0x90, 0x93, 0x96, 0x99, 0x9C, 0x9F,
+        0xA2, 0xA5, 0xA8, 0xAB, 0xAE, 0xB1, 0xB4, 0xB7, 0xBA, 0xBD, 0xC0, 0xC3, 0xC6, 0xC9, 0xCC, 0xCF,
+        0xD2, 0xD5, 0xD8, 0xDB, 0xDE, 0xE1, 0xE4, 0xE7, 0xEA, 0xED, 0xF0, 0xF3, 0xF6, 0xF9, 0xFC,
+    },
+    {
+        0xFF, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C,
+        0x40, 0x44, 0x48, 0x4C, 0x50, 0x54, 0x58, 0x5C, 0x60, 0x64, 0x68, 0x6C, 0x70, 0x74, 0x78, 0x7C,
+        0x80, 0x84, 0x88, 0x8C, 0x90, 0x94, 0x98, 0x9C, 0xA0, 0xA4, 0xA8, 0xAC, 0xB0, 0xB4, 0xB8, 0xBC,
+        0xC0, 0xC4, 0xC8, 0xCC, 0xD0, 0xD4, 0xD8, 0xDC, 0xE0, 0xE4, 0xE8, 0xEC, 0xF0, 0xF4, 0xF8, 0xFC,
+        0x01, 0x05, 0x09, 0x0D, 0x11, 0x15, 0x19, 0x1D, 0x21, 0x25, 0x29, 0x2D, 0x31, 0x35, 0x39, 0x3D,
+        0x41, 0x45, 0x49, 0x4D, 0x51, 0x55, 0x59, 0x5D, 0x61, 0x65, 0x69, 0x6D, 0x71, 0x75, 0x79, 0x7D,
+        0x81, 0x85, 0x89, 0x8D, 0x91, 0x95, 0x99, 0x9D, 0xA1, 0xA5, 0xA9, 0xAD, 0xB1, 0xB5, 0xB9, 0xBD,
+        0xC1, 0xC5, 0xC9, 0xCD, 0xD1, 0xD5, 0xD9, 0xDD, 0xE1, 0xE5, 0xE9, 0xED, 0xF1, 0xF5, 0xF9, 0xFD,
+        0x02, 0x06, 0x0A, 0x0E, 0x12, 0x16, 0x1A, 0x1E, 0x22, 0x26, 0x2A, 0x2E, 0x32, 0x36, 0x3A, 0x3E,
+        0x42, 0x46, 0x4A, 0x4E, 0x52, 0x56, 0x5A, 0x5E, 0x62, 0x66, 0x6A, 0x6E, 0x72, 0x76, 0x7A, 0x7E,
+        0x82, 0x86, 0x8A, 0x8E, 0x92, 0x96, 0x9A, 0x9E, 0xA2, 0xA6, 0xAA, 0xAE, 0xB2, 0xB6, 0xBA, 0xBE,
+        0xC2, 0xC6, 0xCA, 0xCE, 0xD2, 0xD6, 0xDA, 0xDE, 0xE2, 0xE6, 0xEA, 0xEE, 0xF2, 0xF6, 0xFA, 0xFE,
+        0x03, 0x07, 0x0B, 0x0F, 0x13, 0x17, 0x1B, 0x1F, 0x23, 0x27, 0x2B, 0x2F, 0x33, 0x37, 0x3B, 0x3F,
+        0x43, 0x47, 0x4B, 0x4F, 0x53, 0x57, 0x5B, 0x5F, 0x63, 0x67, 0x6B, 0x6F, 0x73, 0x77, 0x7B, 0x7F,
+        0x83, 0x87, 0x8B, 0x8F, 0x93, 0x97, 0x9B, 0x9F, 0xA3, 0xA7, 0xAB, 0xAF, 0xB3, 0xB7, 0xBB, 0xBF,
+        0xC3, 0xC7, 0xCB, 0xCF, 0xD3, 0xD7, 0xDB, 0xDF, 0xE3, 0xE7, 0xEB, 0xEF, 0xF3, 0xF7, 0xFB,
+    },
+    {
+        0xFF, 0x05, 0x0A, 0x0F, 0x14, 0x19, 0x1E, 0x23, 0x28, 0x2D, 0x32, 0x37, 0x3C, 0x41, 0x46, 0x4B,
+        0x50, 0x55, 0x5A, 0x5F, 0x64, 0x69, 0x6E, 0x73, 0x78, 0x7D, 0x82, 0x87, 0x8C, 0x91, 0x96, 0x9B,
+        0xA0, 0xA5, 0xAA, 0xAF, 0xB4, 0xB9, 0xBE, 0xC3, 0xC8, 0xCD, 0xD2, 0xD7, 0xDC, 0xE1, 0xE6, 0xEB,
+        0xF0, 0xF5, 0xFA, 0xFF, 0x05, 0x0A, 0x0F, 0x14, 0x19, 0x1E, 0x23, 0x28, 0x2D, 0x32, 0x37, 0x3C,
+        0x41, 0x46, 0x4B, 0x50, 0x55, 0x5A, 0x5F, 0x64, 0x69, 0x6E, 0x73, 0x78, 0x7D, 0x82, 0x87, 0x8C,
+        0x91, 0x96, 0x9B, 0xA0, 0xA5, 0xAA, 0xAF, 0xB4, 0xB9, 0xBE, 0xC3, 0xC8, 0xCD, 0xD2, 0xD7, 0xDC,
+        0xE1, 0xE6, 0xEB, 0xF0, 0xF5, 0xFA, 0xFF, 0x05, 0x0A, 0x0F, 0x14, 0x19, 0x1E, 0x23, 0x28, 0x2D,
+        0x32, 0x37, 0x3C, 0x41, 0x46, 0x4B, 0x50, 0x55, 0x5A, 0x5F, 0x64, 0x69, 0x6E, 0x73, 0x78, 0x7D,
+        0x82, 0x87, 0x8C, 0x91, 0x96, 0x9B, 0xA0, 0xA5, 0xAA, 0xAF, 0xB4, 0xB9, 0xBE, 0xC3, 0xC8, 0xCD,
+        0xD2, 0xD7, 0xDC, 0xE1, 0xE6, 0xEB, 0xF0, 0xF5, 0xFA, 0xFF, 0x05, 0x0A, 0x0F, 0x14, 0x19, 0x1E,
+        0x23, 0x28, 0x2D, 0x32, 0x37, 0x3C, 0x41, 0x46, 0x4B, 0x50, 0x55, 0x5A, 0x5F, 0x64, 0x69, 0x6E,
+        0x73, 0x78, 0x7D, 0x82, 0x87, 0x8C, 0x91, 0x96, 0x9B, 0xA0, 0xA5, 0xAA, 0xAF, 0xB4, 0xB9, 0xBE,
+        0xC3, 0xC8, 0xCD, 0xD2, 0xD7, 0xDC, 0xE1, 0xE6, 0xEB, 0xF0, 0xF5, 0xFA, 0xFF, 0x05, 0x0A, 0x0F,
+        0x14, 0x19, 0x1E, 0x23, 0x28, 0x2D, 0x32, 0x37, 0x3C, 0x41, 0x46, 0x4B, 0x50, 0x55, 0x5A, 0x5F,
+        0x64, 0x69, 0x6E, 0x73, 0x78, 0x7D, 0x82, 0x87, 0x8C, 0x91, 0x96, 0x9B, 0xA0, 0xA5, 0xAA, 0xAF,
+        0xB4, 0xB9, 0xBE, 0xC3, 0xC8, 0xCD, 0xD2, 0xD7, 0xDC, 0xE1, 0xE6, 0xEB, 0xF0, 0xF5, 0xFA,
+    },
+    {
+        0xFF, 0x06, 0x0C, 0x12, 0x18, 0x1E, 0x24, 0x2A, 0x30, 0x36, 0x3C, 0x42, 0x48, 0x4E, 0x54, 0x5A,
+        0x60, 0x66, 0x6C, 0x72, 0x78, 0x7E, 0x84, 0x8A, 0x90, 0x96, 0x9C, 0xA2, 0xA8, 0xAE, 0xB4, 0xBA,
+        0xC0, 0xC6, 0xCC, 0xD2, 0xD8, 0xDE, 0xE4, 0xEA, 0xF0, 0xF6, 0xFC, 0x03, 0x09, 0x0F, 0x15, 0x1B,
+        0x21, 0x27, 0x2D, 0x33, 0x39, 0x3F, 0x45, 0x4B, 0x51, 0x57, 0x5D, 0x63, 0x69, 0x6F, 0x75, 0x7B,
+        0x81, 0x87, 0x8D, 0x93, 0x99, 0x9F, 0xA5, 0xAB, 0xB1, 0xB7, 0xBD, 0xC3, 0xC9, 0xCF, 0xD5, 0xDB,
+        0xE1, 0xE7, 0xED, 0xF3, 0xF9, 0xFF, 0x06, 0x0C, 0x12, 0x18, 0x1E, 0x24, 0x2A, 0x30, 0x36, 0x3C,
+        0x42, 0x48, 0x4E, 0x54, 0x5A, 0x60, 0x66, 0x6C, 0x72, 0x78, 0x7E, 0x84, 0x8A, 0x90, 0x96, 0x9C,
+        0xA2, 0xA8, 0xAE, 0xB4, 0xBA, 0xC0, 0xC6, 0xCC, 0xD2, 0xD8, 0xDE, 0xE4, 0xEA, 0xF0, 0xF6, 0xFC,
+        0x03, 0x09, 0x0F, 0x15, 0x1B, 0x21, 0x27, 0x2D, 0x33, 0x39, 0x3F, 0x45, 0x4B, 0x51, 0x57, 0x5D,
+        0x63, 0x69, 0x6F, 0x75, 0x7B, 0x81, 0x87, 0x8D, 0x93, 0x99, 0x9F, 0xA5, 0xAB, 0xB1, 0xB7, 0xBD,
+        0xC3, 0xC9, 0xCF, 0xD5, 0xDB, 0xE1, 0xE7, 0xED, 0xF3, 0xF9, 0xFF, 0x06, 0x0C, 0x12, 0x18, 0x1E,
+        0x24, 0x2A, 0x30, 0x36, 0x3C, 0x42, 0x48, 0x4E, 0x54, 0x5A, 0x60, 0x66, 0x6C, 0x72, 0x78, 0x7E,
+        0x84, 0x8A, 0x90, 0x96, 0x9C, 0xA2, 0xA8, 0xAE, 0xB4, 0xBA, 0xC0, 0xC6, 0xCC, 0xD2, 0xD8, 0xDE,
+        0xE4, 0xEA, 0xF0, 0xF6, 0xFC, 0x03, 0x09, 0x0F, 0x15, 0x1B, 0x21, 0x27, 0x2D, 0x33, 0x39, 0x3F,
+        0x45, 0x4B, 0x51, 0x57, 0x5D, 0x63, 0x69, 0x6F, 0x75, 0x7B, 0x81, 0x87, 0x8D, 0x93, 0x99, 0x9F,
+        0xA5, 0xAB, 0xB1, 0xB7, 0xBD, 0xC3, 0xC9, 0xCF, 0xD5, 0xDB, 0xE1, 0xE7, 0xED, 0xF3, 0xF9,
+    },
+    {
+        0xFF, 0x07, 0x0E, 0x15, 0x1C, 0x23, 0x2A, 0x31, 0x38, 0x3F, 0x46, 0x4D, 0x54, 0x5B, 0x62, 0x69,
+        0x70, 0x77, 0x7E, 0x85, 0x8C, 0x93, 0x9A, 0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9,
+        0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x04, 0x0B, 0x12, 0x19, 0x20, 0x27, 0x2E, 0x35, 0x3C, 0x43, 0x4A,
+        0x51, 0x58, 0x5F, 0x66, 0x6D, 0x74, 0x7B, 0x82, 0x89, 0x90, 0x97, 0x9E, 0xA5, 0xAC, 0xB3, 0xBA,
+        0xC1, 0xC8, 0xCF, 0xD6, 0xDD, 0xE4, 0xEB, 0xF2, 0xF9, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x24, 0x2B,
+        0x32, 0x39, 0x40, 0x47, 0x4E, 0x55, 0x5C, 0x63, 0x6A, 0x71, 0x78, 0x7F, 0x86, 0x8D, 0x94, 0x9B,
+        0xA2, 0xA9, 0xB0, 0xB7, 0xBE, 0xC5, 0xCC, 0xD3, 0xDA, 0xE1, 0xE8, 0xEF, 0xF6, 0xFD, 0x05, 0x0C,
+        0x13, 0x1A, 0x21, 0x28, 0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52, 0x59, 0x60, 0x67, 0x6E, 0x75, 0x7C,
+        0x83, 0x8A, 0x91, 0x98, 0x9F, 0xA6, 0xAD, 0xB4, 0xBB, 0xC2, 0xC9, 0xD0, 0xD7, 0xDE, 0xE5, 0xEC,
+        0xF3, 0xFA, 0x02, 0x09, 0x10, 0x17, 0x1E, 0x25, 0x2C, 0x33, 0x3A, 0x41, 0x48, 0x4F, 0x56, 0x5D,
+        0x64, 0x6B, 0x72, 0x79, 0x80, 0x87, 0x8E, 0x95, 0x9C, 0xA3, 0xAA, 0xB1, 0xB8, 0xBF, 0xC6, 0xCD,
+        0xD4, 0xDB, 0xE2, 0xE9, 0xF0, 0xF7, 0xFE, 0x06, 0x0D, 0x14, 0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E,
+        0x45, 0x4C, 0x53, 0x5A, 0x61, 0x68, 0x6F, 0x76, 0x7D, 0x84, 0x8B, 0x92, 0x99, 0xA0, 0xA7, 0xAE,
+        0xB5, 0xBC, 0xC3, 0xCA, 0xD1, 0xD8, 0xDF, 0xE6, 0xED, 0xF4, 0xFB, 0x03, 0x0A, 0x11, 0x18, 0x1F,
+        0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F,
+        0x96, 0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8,
+    },
+    {
+        0xFF, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78,
+        0x80, 0x88, 0x90, 0x98, 0xA0, 0xA8, 0xB0, 0xB8, 0xC0, 0xC8, 0xD0, 0xD8, 0xE0, 0xE8, 0xF0, 0xF8,
+        0x01, 0x09, 0x11, 0x19, 0x21, 0x29, 0x31, 0x39, 0x41, 0x49, 0x51, 0x59, 0x61, 0x69, 0x71, 0x79,
+        0x81, 0x89, 0x91, 0x99, 0xA1, 0xA9, 0xB1, 0xB9, 0xC1, 0xC9, 0xD1, 0xD9, 0xE1, 0xE9, 0xF1, 0xF9,
+        0x02, 0x0A, 0x12, 0x1A, 0x22, 0x2A, 0x32, 0x3A, 0x42, 0x4A, 0x52, 0x5A, 0x62, 0x6A, 0x72, 0x7A,
+        0x82, 0x8A, 0x92, 0x9A, 0xA2, 0xAA, 0xB2, 0xBA, 0xC2, 0xCA, 0xD2, 0xDA, 0xE2, 0xEA, 0xF2, 0xFA,
+        0x03, 0x0B, 0x13, 0x1B, 0x23, 0x2B, 0x33, 0x3B, 0x43, 0x4B, 0x53, 0x5B, 0x63, 0x6B, 0x73, 0x7B,
+        0x83, 0x8B, 0x93, 0x9B, 0xA3, 0xAB, 0xB3, 0xBB, 0xC3, 0xCB, 0xD3, 0xDB, 0xE3, 0xEB, 0xF3, 0xFB,
+        0x04, 0x0C, 0x14, 0x1C, 0x24, 0x2C, 0x34, 0x3C, 0x44, 0x4C, 0x54, 0x5C, 0x64, 0x6C, 0x74, 0x7C,
+        0x84, 0x8C, 0x94, 0x9C, 0xA4, 0xAC, 0xB4, 0xBC, 0xC4, 0xCC, 0xD4, 0xDC, 0xE4, 0xEC, 0xF4, 0xFC,
+        0x05, 0x0D, 0x15, 0x1D, 0x25, 0x2D, 0x35, 0x3D, 0x45, 0x4D, 0x55, 0x5D, 0x65, 0x6D, 0x75, 0x7D,
+        0x85, 0x8D, 0x95, 0x9D, 0xA5, 0xAD, 0xB5, 0xBD, 0xC5, 0xCD, 0xD5, 0xDD, 0xE5, 0xED, 0xF5, 0xFD,
+        0x06, 0x0E, 0x16, 0x1E, 0x26, 0x2E, 0x36, 0x3E, 0x46, 0x4E, 0x56, 0x5E, 0x66, 0x6E, 0x76, 0x7E,
+        0x86, 0x8E, 0x96, 0x9E, 0xA6, 0xAE, 0xB6, 0xBE, 0xC6, 0xCE, 0xD6, 0xDE, 0xE6, 0xEE, 0xF6, 0xFE,
+        0x07, 0x0F, 0x17, 0x1F, 0x27, 0x2F, 0x37, 0x3F, 0x47, 0x4F, 0x57, 0x5F, 0x67, 0x6F, 0x77, 0x7F,
+        0x87, 0x8F, 0x97, 0x9F, 0xA7, 0xAF, 0xB7, 0xBF, 0xC7, 0xCF, 0xD7, 0xDF, 0xE7, 0xEF, 0xF7,
+    },
+    {
+        0xFF, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F, 0x48, 0x51, 0x5A, 0x63, 0x6C, 0x75, 0x7E, 0x87,
+        0x90, 0x99, 0xA2, 0xAB, 0xB4, 0xBD, 0xC6, 0xCF, 0xD8, 0xE1, 0xEA, 0xF3, 0xFC, 0x06, 0x0F, 0x18,
+        0x21, 0x2A, 0x33, 0x3C, 0x45, 0x4E, 0x57, 0x60, 0x69, 0x72, 0x7B, 0x84, 0x8D, 0x96, 0x9F, 0xA8,
+        0xB1, 0xBA, 0xC3, 0xCC, 0xD5, 0xDE, 0xE7, 0xF0, 0xF9, 0x03, 0x0C, 0x15, 0x1E, 0x27, 0x30, 0x39,
+        0x42, 0x4B, 0x54, 0x5D, 0x66, 0x6F, 0x78, 0x81, 0x8A, 0x93, 0x9C, 0xA5, 0xAE, 0xB7, 0xC0, 0xC9,
+        0xD2, 0xDB, 0xE4, 0xED, 0xF6, 0xFF, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F, 0x48, 0x51, 0x5A,
+        0x63, 0x6C, 0x75, 0x7E, 0x87, 0x90, 0x99, 0xA2, 0xAB, 0xB4, 0xBD, 0xC6, 0xCF, 0xD8, 0xE1, 0xEA,
+        0xF3, 0xFC, 0x06, 0x0F, 0x18, 0x21, 0x2A, 0x33, 0x3C, 0x45, 0x4E, 0x57, 0x60, 0x69, 0x72, 0x7B,
+        0x84, 0x8D, 0x96, 0x9F, 0xA8, 0xB1, 0xBA, 0xC3, 0xCC, 0xD5, 0xDE, 0xE7, 0xF0, 0xF9, 0x03, 0x0C,
+        0x15, 0x1E, 0x27, 0x30, 0x39, 0x42, 0x4B, 0x54, 0x5D, 0x66, 0x6F, 0x78, 0x81, 0x8A, 0x93, 0x9C,
+        0xA5, 0xAE, 0xB7, 0xC0, 0xC9, 0xD2, 0xDB, 0xE4, 0xED, 0xF6, 0xFF, 0x09, 0x12, 0x1B, 0x24, 0x2D,
+        0x36, 0x3F, 0x48, 0x51, 0x5A, 0x63, 0x6C, 0x75, 0x7E, 0x87, 0x90, 0x99, 0xA2, 0xAB, 0xB4, 0xBD,
+        0xC6, 0xCF, 0xD8, 0xE1, 0xEA, 0xF3, 0xFC, 0x06, 0x0F, 0x18, 0x21, 0x2A, 0x33, 0x3C, 0x45, 0x4E,
+        0x57, 0x60, 0x69, 0x72, 0x7B, 0x84, 0x8D, 0x96, 0x9F, 0xA8, 0xB1, 0xBA, 0xC3, 0xCC, 0xD5, 0xDE,
+        0xE7, 0xF0, 0xF9, 0x03, 0x0C, 0x15, 0x1E, 0x27, 0x30, 0x39, 0x42, 0x4B, 0x54, 0x5D, 0x66, 0x6F,
+        0x78, 0x81, 0x8A, 0x93, 0x9C, 0xA5, 0xAE, 0xB7, 0xC0, 0xC9, 0xD2, 0xDB, 0xE4, 0xED, 0xF6,
+    },
+    {
+        0xFF, 0x0A, 0x14, 0x1E, 0x28, 0x32, 0x3C, 0x46, 0x50, 0x5A, 0x64, 0x6E, 0x78, 0x82, 0x8C, 0x96,
+        0xA0, 0xAA, 0xB4, 0xBE, 0xC8, 0xD2, 0xDC, 0xE6, 0xF0, 0xFA, 0x05, 0x0F, 0x19, 0x23, 0x2D, 0x37,
+        0x41, 0x4B, 0x55, 0x5F, 0x69, 0x73, 0x7D, 0x87, 0x91, 0x9B, 0xA5, 0xAF, 0xB9, 0xC3, 0xCD, 0xD7,
+        0xE1, 0xEB, 0xF5, 0xFF, 0x0A, 0x14, 0x1E, 0x28, 0x32, 0x3C, 0x46, 0x50, 0x5A, 0x64, 0x6E, 0x78,
+        0x82, 0x8C, 0x96, 0xA0, 0xAA, 0xB4, 0xBE, 0xC8, 0xD2, 0xDC, 0xE6, 0xF0, 0xFA, 0x05, 0x0F, 0x19,
+        0x23, 0x2D, 0x37, 0x41, 0x4B, 0x55, 0x5F, 0x69, 0x73, 0x7D, 0x87, 0x91, 0x9B, 0xA5, 0xAF, 0xB9,
+        0xC3, 0xCD, 0xD7, 0xE1, 0xEB, 0xF5, 0xFF, 0x0A, 0x14, 0x1E, 0x28, 0x32, 0x3C, 0x46, 0x50, 0x5A,
+        0x64, 0x6E, 0x78, 0x82, 0x8C, 0x96, 0xA0, 0xAA, 0xB4, 0xBE, 0xC8, 0xD2, 0xDC, 0xE6, 0xF0, 0xFA,
+        0x05, 0x0F, 0x19, 0x23, 0x2D, 0x37, 0x41, 0x4B, 0x55, 0x5F, 0x69, 0x73, 0x7D, 0x87, 0x91, 0x9B,
+        0xA5, 0xAF, 0xB9, 0xC3, 0xCD, 0xD7, 0xE1, 0xEB, 0xF5, 0xFF, 0x0A, 0x14, 0x1E, 0x28, 0x32, 0x3C,
+        0x46, 0x50, 0x5A, 0x64, 0x6E, 0x78, 0x82, 0x8C, 0x96, 0xA0, 0xAA, 0xB4, 0xBE, 0xC8, 0xD2, 0xDC,
+        0xE6, 0xF0, 0xFA, 0x05, 0x0F, 0x19, 0x23, 0x2D, 0x37, 0x41, 0x4B, 0x55, 0x5F, 0x69, 0x73, 0x7D,
+        0x87, 0x91, 0x9B, 0xA5, 0xAF, 0xB9, 0xC3, 0xCD, 0xD7, 0xE1, 0xEB, 0xF5, 0xFF, 0x0A, 0x14, 0x1E,
+        0x28, 0x32, 0x3C, 0x46, 0x50, 0x5A, 0x64, 0x6E, 0x78, 0x82, 0x8C, 0x96, 0xA0, 0xAA, 0xB4, 0xBE,
+        0xC8, 0xD2, 0xDC, 0xE6, 0xF0, 0xFA, 0x05, 0x0F, 0x19, 0x23, 0x2D, 0x37, 0x41, 0x4B, 0x55, 0x5F,
+        0x69, 0x73, 0x7D, 0x87, 0x91, 0x9B, 0xA5, 0xAF, 0xB9, 0xC3, 0xCD, 0xD7, 0xE1, 0xEB, 0xF5,
+    },
+    {
+        0xFF, 0x0B, 0x16, 0x21, 0x2C, 0x37, 0x42, 0x4D, 0x58, 0x63, 0x6E, 0x79, 0x84, 0x8F, 0x9A, 0xA5,
+        0xB0, 0xBB, 0xC6, 0xD1, 0xDC, 0xE7, 0xF2, 0xFD, 0x09, 0x14, 0x1F, 0x2A, 0x35, 0x40, 0x4B, 0x56,
+        0x61, 0x6C, 0x77, 0x82, 0x8D, 0x98, 0xA3, 0xAE, 0xB9, 0xC4, 0xCF, 0xDA, 0xE5, 0xF0, 0xFB, 0x07,
+        0x12, 0x1D, 0x28, 0x33, 0x3E, 0x49, 0x54, 0x5F, 0x6A, 0x75, 0x80, 0x8B, 0x96, 0xA1, 0xAC, 0xB7,
+        0xC2, 0xCD, 0xD8, 0xE3, 0xEE, 0xF9, 0x05, 0x10, 0x1B, 0x26, 0x31, 0x3C, 0x47, 0x52, 0x5D, 0x68,
+        0x73, 0x7E, 0x89, 0x94, 0x9F, 0xAA, 0xB5, 0xC0, 0xCB, 0xD6, 0xE1, 0xEC, 0xF7, 0x03, 0x0E, 0x19,
+        0x24, 0x2F, 0x3A, 0x45, 0x50, 0x5B, 0x66, 0x71, 0x7C, 0x87, 0x92, 0x9D, 0xA8, 0xB3, 0xBE, 0xC9,
+        0xD4, 0xDF, 0xEA, 0xF5, 0x01, 0x0C, 0x17, 0x22, 0x2D, 0x38, 0x43, 0x4E, 0x59, 0x64, 0x6F, 0x7A,
+        0x85, 0x90, 0x9B, 0xA6, 0xB1, 0xBC, 0xC7, 0xD2, 0xDD, 0xE8, 0xF3, 0xFE, 0x0A, 0x15, 0x20, 0x2B,
+        0x36, 0x41, 0x4C, 0x57, 0x62, 0x6D, 0x78, 0x83, 0x8E, 0x99, 0xA4, 0xAF, 0xBA, 0xC5, 0xD0, 0xDB,
+        0xE6, 0xF1, 0xFC, 0x08, 0x13, 0x1E, 0x29, 0x34, 0x3F, 0x4A, 0x55, 0x60, 0x6B, 0x76, 0x81, 0x8C,
+        0x97, 0xA2, 0xAD, 0xB8, 0xC3, 0xCE, 0xD9, 0xE4, 0xEF, 0xFA, 0x06, 0x11, 0x1C, 0x27, 0x32, 0x3D,
+        0x48, 0x53, 0x5E, 0x69, 0x74, 0x7F, 0x8A, 0x95, 0xA0, 0xAB, 0xB6, 0xC1, 0xCC, 0xD7, 0xE2, 0xED,
+        0xF8, 0x04, 0x0F, 0x1A, 0x25, 0x30, 0x3B, 0x46, 0x51, 0x5C, 0x67, 0x72, 0x7D, 0x88, 0x93, 0x9E,
+        0xA9, 0xB4, 0xBF, 0xCA, 0xD5, 0xE0, 0xEB, 0xF6, 0x02, 0x0D, 0x18, 0x23, 0x2E, 0x39, 0x44, 0x4F,
+        0x5A, 0x65, 0x70, 0x7B, 0x86, 0x91, 0x9C, 0xA7, 0xB2, 0xBD, 0xC8, 0xD3, 0xDE, 0xE9, 0xF4,
+    },
+    {
+        0xFF, 0x0C, 0x18, 0x24, 0x30, 0x3C, 0x48, 0x54, 0x60, 0x6C, 0x78, 0x84, 0x90, 0x9C, 0xA8, 0xB4,
+        0xC0, 0xCC, 0xD8, 0xE4, 0xF0, 0xFC, 0x09, 0x15, 0x21, 0x2D, 0x39, 0x45, 0x51, 0x5D, 0x69, 0x75,
+        0x81, 0x8D, 0x99, 0xA5, 0xB1, 0xBD, 0xC9, 0xD5, 0xE1, 0xED, 0xF9, 0x06, 0x12, 0x1E, 0x2A, 0x36,
+        0x42, 0x4E, 0x5A, 0x66, 0x72, 0x7E, 0x8A, 0x96, 0xA2, 0xAE, 0xBA, 0xC6, 0xD2, 0xDE, 0xEA, 0xF6,
+        0x03, 0x0F, 0x1B, 0x27, 0x33, 0x3F, 0x4B, 0x57, 0x63, 0x6F, 0x7B, 0x87, 0x93, 0x9F, 0xAB, 0xB7,
+        0xC3, 0xCF, 0xDB, 0xE7, 0xF3, 0xFF, 0x0C, 0x18, 0x24, 0x30, 0x3C, 0x48, 0x54, 0x60, 0x6C, 0x78,
+        0x84, 0x90, 0x9C, 0xA8, 0xB4, 0xC0, 0xCC, 0xD8, 0xE4, 0xF0, 0xFC, 0x09, 0x15, 0x21, 0x2D, 0x39,
+        0x45, 0x51, 0x5D, 0x69, 0x75, 0x81, 0x8D, 0x99, 0xA5, 0xB1, 0xBD, 0xC9, 0xD5, 0xE1, 0xED, 0xF9,
+        0x06, 0x12, 0x1E, 0x2A, 0x36, 0x42, 0x4E, 0x5A, 0x66, 0x72, 0x7E, 0x8A, 0x96, 0xA2, 0xAE, 0xBA,
+        0xC6, 0xD2, 0xDE, 0xEA, 0xF6, 0x03, 0x0F, 0x1B, 0x27, 0x33, 0x3F, 0x4B, 0x57, 0x63, 0x6F, 0x7B,
+        0x87, 0x93, 0x9F, 0xAB, 0xB7, 0xC3, 0xCF, 0xDB, 0xE7, 0xF3, 0xFF, 0x0C, 0x18, 0x24, 0x30, 0x3C,
+        0x48, 0x54, 0x60, 0x6C, 0x78, 0x84, 0x90, 0x9C, 0xA8, 0xB4, 0xC0, 0xCC, 0xD8, 0xE4, 0xF0, 0xFC,
+        0x09, 0x15, 0x21, 0x2D, 0x39, 0x45, 0x51, 0x5D, 0x69, 0x75, 0x81, 0x8D, 0x99, 0xA5, 0xB1, 0xBD,
+        0xC9, 0xD5, 0xE1, 0xED, 0xF9, 0x06, 0x12, 0x1E, 0x2A, 0x36, 0x42, 0x4E, 0x5A, 0x66, 0x72, 0x7E,
+        0x8A, 0x96, 0xA2, 0xAE, 0xBA, 0xC6, 0xD2, 0xDE, 0xEA, 0xF6, 0x03, 0x0F, 0x1B, 0x27, 0x33, 0x3F,
+        0x4B, 0x57, 0x63, 0x6F, 0x7B, 0x87, 0x93, 0x9F, 0xAB, 0xB7, 0xC3, 0xCF, 0xDB, 0xE7, 0xF3,
+    },
+    {
+        0xFF, 0x0D, 0x1A, 0x27, 0x34, 0x41, 0x4E, 0x5B, 0x68, 0x75, 0x82, 0x8F, 0x9C, 0xA9, 0xB6, 0xC3,
+        0xD0, 0xDD, 0xEA, 0xF7, 0x05, 0x12, 0x1F, 0x2C, 0x39, 0x46, 0x53, 0x60, 0x6D, 0x7A, 0x87, 0x94,
+        0xA1, 0xAE, 0xBB, 0xC8, 0xD5, 0xE2, 0xEF, 0xFC, 0x0A, 0x17, 0x24, 0x31, 0x3E, 0x4B, 0x58, 0x65,
+        0x72, 0x7F, 0x8C, 0x99, 0xA6, 0xB3, 0xC0, 0xCD, 0xDA, 0xE7, 0xF4, 0x02, 0x0F, 0x1C, 0x29, 0x36,
+        0x43, 0x50, 0x5D, 0x6A, 0x77, 0x84, 0x91, 0x9E, 0xAB, 0xB8, 0xC5, 0xD2, 0xDF, 0xEC, 0xF9, 0x07,
+        0x14, 0x21, 0x2E, 0x3B, 0x48, 0x55, 0x62, 0x6F, 0x7C, 0x89, 0x96, 0xA3, 0xB0, 0xBD, 0xCA, 0xD7,
+        0xE4, 0xF1, 0xFE, 0x0C, 0x19, 0x26, 0x33, 0x40, 0x4D, 0x5A, 0x67, 0x74, 0x81, 0x8E, 0x9B, 0xA8,
+        0xB5, 0xC2, 0xCF, 0xDC, 0xE9, 0xF6, 0x04, 0x11, 0x1E, 0x2B, 0x38, 0x45, 0x52, 0x5F, 0x6C, 0x79,
+        0x86, 0x93, 0xA0, 0xAD, 0xBA, 0xC7, 0xD4, 0xE1, 0xEE, 0xFB, 0x09, 0x16, 0x23, 0x30, 0x3D, 0x4A,
+        0x57, 0x64, 0x71, 0x7E, 0x8B, 0x98, 0xA5, 0xB2, 0xBF, 0xCC, 0xD9, 0xE6, 0xF3, 0x01, 0x0E, 0x1B,
+        0x28, 0x35, 0x42, 0x4F, 0x5C, 0x69, 0x76, 0x83, 0x90, 0x9D, 0xAA, 0xB7, 0xC4, 0xD1, 0xDE, 0xEB,
+        0xF8, 0x06, 0x13, 0x20, 0x2D, 0x3A, 0x47, 0x54, 0x61, 0x6E, 0x7B, 0x88, 0x95, 0xA2, 0xAF, 0xBC,
+        0xC9, 0xD6, 0xE3, 0xF0, 0xFD, 0x0B, 0x18, 0x25, 0x32, 0x3F, 0x4C, 0x59, 0x66, 0x73, 0x80, 0x8D,
+        0x9A, 0xA7, 0xB4, 0xC1, 0xCE, 0xDB, 0xE8, 0xF5, 0x03, 0x10, 0x1D, 0x2A, 0x37, 0x44, 0x51, 0x5E,
+        0x6B, 0x78, 0x85, 0x92, 0x9F, 0xAC, 0xB9, 0xC6, 0xD3, 0xE0, 0xED, 0xFA, 0x08, 0x15, 0x22, 0x2F,
+        0x3C, 0x49, 0x56, 0x63, 0x70, 0x7D, 0x8A, 0x97, 0xA4, 0xB1, 0xBE, 0xCB, 0xD8, 0xE5, 0xF2,
+    },
+    {
+        0xFF, 0x0E, 0x1C, 0x2A, 0x38, 0x46, 0x54, 0x62, 0x70, 0x7E, 0x8C, 0x9A, 0xA8, 0xB6, 0xC4, 0xD2,
+        0xE0, 0xEE, 0xFC, 0x0B, 0x19, 0x27, 0x35, 0x43, 0x51, 0x5F, 0x6D, 0x7B, 0x89, 0x97, 0xA5, 0xB3,
+        0xC1, 0xCF, 0xDD, 0xEB, 0xF9, 0x08, 0x16, 0x24, 0x32, 0x40, 0x4E, 0x5C, 0x6A, 0x78, 0x86, 0x94,
+        0xA2, 0xB0, 0xBE, 0xCC, 0xDA, 0xE8, 0xF6, 0x05, 0x13, 0x21, 0x2F, 0x3D, 0x4B, 0x59, 0x67, 0x75,
+        0x83, 0x91, 0x9F, 0xAD, 0xBB, 0xC9, 0xD7, 0xE5, 0xF3, 0x02, 0x10, 0x1E, 0x2C, 0x3A, 0x48, 0x56,
+        0x64, 0x72, 0x80, 0x8E, 0x9C, 0xAA, 0xB8, 0xC6, 0xD4, 0xE2, 0xF0, 0xFE, 0x0D, 0x1B, 0x29, 0x37,
+        0x45, 0x53, 0x61, 0x6F, 0x7D, 0x8B, 0x99, 0xA7, 0xB5, 0xC3, 0xD1, 0xDF, 0xED, 0xFB, 0x0A, 0x18,
+        0x26, 0x34, 0x42, 0x50, 0x5E, 0x6C, 0x7A, 0x88, 0x96, 0xA4, 0xB2, 0xC0, 0xCE, 0xDC, 0xEA, 0xF8,
+        0x07, 0x15, 0x23, 0x31, 0x3F, 0x4D, 0x5B, 0x69, 0x77, 0x85, 0x93, 0xA1, 0xAF, 0xBD, 0xCB, 0xD9,
+        0xE7, 0xF5, 0x04, 0x12, 0x20, 0x2E, 0x3C, 0x4A, 0x58, 0x66, 0x74, 0x82, 0x90, 0x9E, 0xAC, 0xBA,
+        0xC8, 0xD6, 0xE4, 0xF2, 0x01, 0x0F, 0x1D, 0x2B, 0x39, 0x47, 0x55, 0x63, 0x71, 0x7F, 0x8D, 0x9B,
+        0xA9, 0xB7, 0xC5, 0xD3, 0xE1, 0xEF, 0xFD, 0x0C, 0x1A, 0x28, 0x36, 0x44, 0x52, 0x60, 0x6E, 0x7C,
+        0x8A, 0x98, 0xA6, 0xB4, 0xC2, 0xD0, 0xDE, 0xEC, 0xFA, 0x09, 0x17, 0x25, 0x33, 0x41, 0x4F, 0x5D,
+        0x6B, 0x79, 0x87, 0x95, 0xA3, 0xB1, 0xBF, 0xCD, 0xDB, 0xE9, 0xF7, 0x06, 0x14, 0x22, 0x30, 0x3E,
+        0x4C, 0x5A, 0x68, 0x76, 0x84, 0x92, 0xA0, 0xAE, 0xBC, 0xCA, 0xD8, 0xE6, 0xF4, 0x03, 0x11, 0x1F,
+        0x2D, 0x3B, 0x49, 0x57, 0x65, 0x73, 0x81, 0x8F, 0x9D, 0xAB, 0xB9, 0xC7, 0xD5, 0xE3, 0xF1,
+    },
+    {
+        0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1,
+        0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2,
+        0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3,
+        0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4,
+        0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5,
+        0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96,
+        0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87,
+        0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78,
+        0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69,
+        0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A,
+        0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B,
+        0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C,
+        0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E, 0x2D,
+        0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F, 0x1E,
+        0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0xFF, 0x0F,
+        0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0,
+    },
+    {
+        0xFF, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0,
+        0x01, 0x11, 0x21, 0x31, 0x41, 0x51, 0x61, 0x71, 0x81, 0x91, 0xA1, 0xB1, 0xC1, 0xD1, 0xE1, 0xF1,
+        0x02, 0x12, 0x22, 0x32, 0x42, 0x52, 0x62, 0x72, 0x82, 0x92, 0xA2, 0xB2, 0xC2, 0xD2, 0xE2, 0xF2,
+        0x03, 0x13, 0x23, 0x33, 0x43, 0x53, 0x63, 0x73, 0x83, 0x93, 0xA3, 0xB3, 0xC3, 0xD3, 0xE3, 0xF3,
+        0x04, 0x14, 0x24, 0x34, 0x44, 0x54, 0x64, 0x74, 0x84, 0x94, 0xA4, 0xB4, 0xC4, 0xD4, 0xE4, 0xF4,
+        0x05, 0x15, 0x25, 0x35, 0x45, 0x55, 0x65, 0x75, 0x85, 0x95, 0xA5, 0xB5, 0xC5, 0xD5, 0xE5, 0xF5,
+        0x06, 0x16, 0x26, 0x36, 0x46, 0x56, 0x66, 0x76, 0x86, 0x96, 0xA6, 0xB6, 0xC6, 0xD6, 0xE6, 0xF6,
+        0x07, 0x17, 0x27, 0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xA7, 0xB7, 0xC7, 0xD7, 0xE7, 0xF7,
+        0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xA8, 0xB8, 0xC8, 0xD8, 0xE8, 0xF8,
+        0x09, 0x19, 0x29, 0x39, 0x49, 0x59, 0x69, 0x79, 0x89, 0x99, 0xA9, 0xB9, 0xC9, 0xD9, 0xE9, 0xF9,
+        0x0A, 0x1A, 0x2A, 0x3A, 0x4A, 0x5A, 0x6A, 0x7A, 0x8A, 0x9A, 0xAA, 0xBA, 0xCA, 0xDA, 0xEA, 0xFA,
+        0x0B, 0x1B, 0x2B, 0x3B, 0x4B, 0x5B, 0x6B, 0x7B, 0x8B, 0x9B, 0xAB, 0xBB, 0xCB, 0xDB, 0xEB, 0xFB,
+        0x0C, 0x1C, 0x2C, 0x3C, 0x4C, 0x5C, 0x6C, 0x7C, 0x8C, 0x9C, 0xAC, 0xBC, 0xCC, 0xDC, 0xEC, 0xFC,
+        0x0D, 0x1D, 0x2D, 0x3D, 0x4D, 0x5D, 0x6D, 0x7D, 0x8D, 0x9D, 0xAD, 0xBD, 0xCD, 0xDD, 0xED, 0xFD,
+        0x0E, 0x1E, 0x2E, 0x3E, 0x4E, 0x5E, 0x6E, 0x7E, 0x8E, 0x9E, 0xAE, 0xBE, 0xCE, 0xDE, 0xEE, 0xFE,
+        0x0F, 0x1F, 0x2F, 0x3F, 0x4F, 0x5F, 0x6F, 0x7F, 0x8F, 0x9F, 0xAF, 0xBF, 0xCF, 0xDF, 0xEF,
+    },
+    {
+        0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF,
+        0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11,
+        0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22,
+        0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33,
+        0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44,
+        0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55,
+        0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66,
+        0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88,
+        0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99,
+        0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA,
+        0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB,
+        0xCC, 0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC,
+        0xDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD,
+        0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE,
+        0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE,
+    },
+    {
+        0xFF, 0x12, 0x24, 0x36, 0x48, 0x5A, 0x6C, 0x7E, 0x90, 0xA2, 0xB4, 0xC6, 0xD8, 0xEA, 0xFC, 0x0F,
+        0x21, 0x33, 0x45, 0x57, 0x69, 0x7B, 0x8D, 0x9F, 0xB1, 0xC3, 0xD5, 0xE7, 0xF9, 0x0C, 0x1E, 0x30,
+        0x42, 0x54, 0x66, 0x78, 0x8A, 0x9C, 0xAE, 0xC0, 0xD2, 0xE4, 0xF6, 0x09, 0x1B, 0x2D, 0x3F, 0x51,
+        0x63, 0x75, 0x87, 0x99, 0xAB, 0xBD, 0xCF, 0xE1, 0xF3, 0x06, 0x18, 0x2A, 0x3C, 0x4E, 0x60, 0x72,
+        0x84, 0x96, 0xA8, 0xBA, 0xCC, 0xDE, 0xF0, 0x03, 0x15, 0x27, 0x39, 0x4B, 0x5D, 0x6F, 0x81, 0x93,
+        0xA5, 0xB7, 0xC9, 0xDB, 0xED, 0xFF, 0x12, 0x24, 0x36, 0x48, 0x5A, 0x6C, 0x7E, 0x90, 0xA2, 0xB4,
+        0xC6, 0xD8, 0xEA, 0xFC, 0x0F, 0x21, 0x33, 0x45, 0x57, 0x69, 0x7B, 0x8D, 0x9F, 0xB1, 0xC3, 0xD5,
+        0xE7, 0xF9, 0x0C, 0x1E, 0x30, 0x42, 0x54, 0x66, 0x78, 0x8A, 0x9C, 0xAE, 0xC0, 0xD2, 0xE4, 0xF6,
+        0x09, 0x1B, 0x2D, 0x3F, 0x51, 0x63, 0x75, 0x87, 0x99, 0xAB, 0xBD, 0xCF, 0xE1, 0xF3, 0x06, 0x18,
+        0x2A, 0x3C, 0x4E, 0x60, 0x72, 0x84, 0x96, 0xA8, 0xBA, 0xCC, 0xDE, 0xF0, 0x03, 0x15, 0x27, 0x39,
+        0x4B, 0x5D, 0x6F, 0x81, 0x93, 0xA5, 0xB7, 0xC9, 0xDB, 0xED, 0xFF, 0x12, 0x24, 0x36, 0x48, 0x5A,
+        0x6C, 0x7E, 0x90, 0xA2, 0xB4, 0xC6, 0xD8, 0xEA, 0xFC, 0x0F, 0x21, 0x33, 0x45, 0x57, 0x69, 0x7B,
+        0x8D, 0x9F, 0xB1, 0xC3, 0xD5, 0xE7, 0xF9, 0x0C, 0x1E, 0x30, 0x42, 0x54, 0x66, 0x78, 0x8A, 0x9C,
+        0xAE, 0xC0, 0xD2, 0xE4, 0xF6, 0x09, 0x1B, 0x2D, 0x3F, 0x51, 0x63, 0x75, 0x87, 0x99, 0xAB, 0xBD,
+        0xCF, 0xE1, 0xF3, 0x06, 0x18, 0x2A, 0x3C, 0x4E, 0x60, 0x72, 0x84, 0x96, 0xA8, 0xBA, 0xCC, 0xDE,
+        0xF0, 0x03, 0x15, 0x27, 0x39, 0x4B, 0x5D, 0x6F, 0x81, 0x93, 0xA5, 0xB7, 0xC9, 0xDB, 0xED,
+    },
+    {
+        0xFF, 0x13, 0x26, 0x39, 0x4C, 0x5F, 0x72, 0x85, 0x98, 0xAB, 0xBE, 0xD1, 0xE4, 0xF7, 0x0B, 0x1E,
+        0x31, 0x44, 0x57, 0x6A, 0x7D, 0x90, 0xA3, 0xB6, 0xC9, 0xDC, 0xEF, 0x03, 0x16, 0x29, 0x3C, 0x4F,
+        0x62, 0x75, 0x88, 0x9B, 0xAE, 0xC1, 0xD4, 0xE7, 0xFA, 0x0E, 0x21, 0x34, 0x47, 0x5A, 0x6D, 0x80,
+        0x93, 0xA6, 0xB9, 0xCC, 0xDF, 0xF2, 0x06, 0x19, 0x2C, 0x3F, 0x52, 0x65, 0x78, 0x8B, 0x9E, 0xB1,
+        0xC4, 0xD7, 0xEA, 0xFD, 0x11, 0x24, 0x37, 0x4A, 0x5D, 0x70, 0x83, 0x96, 0xA9, 0xBC, 0xCF, 0xE2,
+        0xF5, 0x09, 0x1C, 0x2F, 0x42, 0x55, 0x68, 0x7B, 0x8E, 0xA1, 0xB4, 0xC7, 0xDA, 0xED, 0x01, 0x14,
+        0x27, 0x3A, 0x4D, 0x60, 0x73, 0x86, 0x99, 0xAC, 0xBF, 0xD2, 0xE5, 0xF8, 0x0C, 0x1F, 0x32, 0x45,
+        0x58, 0x6B, 0x7E, 0x91, 0xA4, 0xB7, 0xCA, 0xDD, 0xF0, 0x04, 0x17, 0x2A, 0x3D, 0x50, 0x63, 0x76,
+        0x89, 0x9C, 0xAF, 0xC2, 0xD5, 0xE8, 0xFB, 0x0F, 0x22, 0x35, 0x48, 0x5B, 0x6E, 0x81, 0x94, 0xA7,
+        0xBA, 0xCD, 0xE0, 0xF3, 0x07, 0x1A, 0x2D, 0x40, 0x53, 0x66, 0x79, 0x8C, 0x9F, 0xB2, 0xC5, 0xD8,
+        0xEB, 0xFE, 0x12, 0x25, 0x38, 0x4B, 0x5E, 0x71, 0x84, 0x97, 0xAA, 0xBD, 0xD0, 0xE3, 0xF6, 0x0A,
+        0x1D, 0x30, 0x43, 0x56, 0x69, 0x7C, 0x8F, 0xA2, 0xB5, 0xC8, 0xDB, 0xEE, 0x02, 0x15, 0x28, 0x3B,
+        0x4E, 0x61, 0x74, 0x87, 0x9A, 0xAD, 0xC0, 0xD3, 0xE6, 0xF9, 0x0D, 0x20, 0x33, 0x46, 0x59, 0x6C,
+        0x7F, 0x92, 0xA5, 0xB8, 0xCB, 0xDE, 0xF1, 0x05, 0x18, 0x2B, 0x3E, 0x51, 0x64, 0x77, 0x8A, 0x9D,
+        0xB0, 0xC3, 0xD6, 0xE9, 0xFC, 0x10, 0x23, 0x36, 0x49, 0x5C, 0x6F, 0x82, 0x95, 0xA8, 0xBB, 0xCE,
+        0xE1, 0xF4, 0x08, 0x1B, 0x2E, 0x41, 0x54, 0x67, 0x7A, 0x8D, 0xA0, 0xB3, 0xC6, 0xD9, 0xEC,
+    },
+    {
+        0xFF, 0x14, 0x28, 0x3C, 0x50, 0x64, 0x78, 0x8C, 0xA0, 0xB4, 0xC8, 0xDC, 0xF0, 0x05, 0x19, 0x2D,
+        0x41, 0x55, 0x69, 0x7D, 0x91, 0xA5, 0xB9, 0xCD, 0xE1, 0xF5, 0x0A, 0x1E, 0x32, 0x46, 0x5A, 0x6E,
+        0x82, 0x96, 0xAA, 0xBE, 0xD2, 0xE6, 0xFA, 0x0F, 0x23, 0x37, 0x4B, 0x5F, 0x73, 0x87, 0x9B, 0xAF,
+        0xC3, 0xD7, 0xEB, 0xFF, 0x14, 0x28, 0x3C, 0x50, 0x64, 0x78, 0x8C, 0xA0, 0xB4, 0xC8, 0xDC, 0xF0,
+        0x05, 0x19, 0x2D, 0x41, 0x55, 0x69, 0x7D, 0x91, 0xA5, 0xB9, 0xCD, 0xE1, 0xF5, 0x0A, 0x1E, 0x32,
+        0x46, 0x5A, 0x6E, 0x82, 0x96, 0xAA, 0xBE, 0xD2, 0xE6, 0xFA, 0x0F, 0x23, 0x37, 0x4B, 0x5F, 0x73,
+        0x87, 0x9B, 0xAF, 0xC3, 0xD7, 0xEB, 0xFF, 0x14, 0x28, 0x3C, 0x50, 0x64, 0x78, 0x8C, 0xA0, 0xB4,
+        0xC8, 0xDC, 0xF0, 0x05, 0x19, 0x2D, 0x41, 0x55, 0x69, 0x7D, 0x91, 0xA5, 0xB9, 0xCD, 0xE1, 0xF5,
+        0x0A, 0x1E, 0x32, 0x46, 0x5A, 0x6E, 0x82, 0x96, 0xAA, 0xBE, 0xD2, 0xE6, 0xFA, 0x0F, 0x23, 0x37,
+        0x4B, 0x5F, 0x73, 0x87, 0x9B, 0xAF, 0xC3, 0xD7, 0xEB, 0xFF, 0x14, 0x28, 0x3C, 0x50, 0x64, 0x78,
+        0x8C, 0xA0, 0xB4, 0xC8, 0xDC, 0xF0, 0x05, 0x19, 0x2D, 0x41, 0x55, 0x69, 0x7D, 0x91, 0xA5, 0xB9,
+        0xCD, 0xE1, 0xF5, 0x0A, 0x1E, 0x32, 0x46, 0x5A, 0x6E, 0x82, 0x96, 0xAA, 0xBE, 0xD2, 0xE6, 0xFA,
+        0x0F, 0x23, 0x37, 0x4B, 0x5F, 0x73, 0x87, 0x9B, 0xAF, 0xC3, 0xD7, 0xEB, 0xFF, 0x14, 0x28, 0x3C,
+        0x50, 0x64, 0x78, 0x8C, 0xA0, 0xB4, 0xC8, 0xDC, 0xF0, 0x05, 0x19, 0x2D, 0x41, 0x55, 0x69, 0x7D,
+        0x91, 0xA5, 0xB9, 0xCD, 0xE1, 0xF5, 0x0A, 0x1E, 0x32, 0x46, 0x5A, 0x6E, 0x82, 0x96, 0xAA, 0xBE,
+        0xD2, 0xE6, 0xFA, 0x0F, 0x23, 0x37, 0x4B, 0x5F, 0x73, 0x87, 0x9B, 0xAF, 0xC3, 0xD7, 0xEB,
+    },
+    {
+        0xFF, 0x15, 0x2A, 0x3F, 0x54, 0x69, 0x7E, 0x93, 0xA8, 0xBD, 0xD2, 0xE7, 0xFC, 0x12, 0x27, 0x3C,
+        0x51, 0x66, 0x7B, 0x90, 0xA5, 0xBA, 0xCF, 0xE4, 0xF9, 0x0F, 0x24, 0x39, 0x4E, 0x63, 0x78, 0x8D,
+        0xA2, 0xB7, 0xCC, 0xE1, 0xF6, 0x0C, 0x21, 0x36, 0x4B, 0x60, 0x75, 0x8A, 0x9F, 0xB4, 0xC9, 0xDE,
+        0xF3, 0x09, 0x1E, 0x33, 0x48, 0x5D, 0x72, 0x87, 0x9C, 0xB1, 0xC6, 0xDB, 0xF0, 0x06, 0x1B, 0x30,
+        0x45, 0x5A, 0x6F, 0x84, 0x99, 0xAE, 0xC3, 0xD8, 0xED, 0x03, 0x18, 0x2D, 0x42, 0x57, 0x6C, 0x81,
+        0x96, 0xAB, 0xC0, 0xD5, 0xEA, 0xFF, 0x15, 0x2A, 0x3F, 0x54, 0x69, 0x7E, 0x93, 0xA8, 0xBD, 0xD2,
+        0xE7, 0xFC, 0x12, 0x27, 0x3C, 0x51, 0x66, 0x7B, 0x90, 0xA5, 0xBA, 0xCF, 0xE4, 0xF9, 0x0F, 0x24,
+        0x39, 0x4E, 0x63, 0x78, 0x8D, 0xA2, 0xB7, 0xCC, 0xE1, 0xF6, 0x0C, 0x21, 0x36, 0x4B, 0x60, 0x75,
+        0x8A, 0x9F, 0xB4, 0xC9, 0xDE, 0xF3, 0x09, 0x1E, 0x33, 0x48, 0x5D, 0x72, 0x87, 0x9C, 0xB1, 0xC6,
+        0xDB, 0xF0, 0x06, 0x1B, 0x30, 0x45, 0x5A, 0x6F, 0x84, 0x99, 0xAE, 0xC3, 0xD8, 0xED, 0x03, 0x18,
+        0x2D, 0x42, 0x57, 0x6C, 0x81, 0x96, 0xAB, 0xC0, 0xD5, 0xEA, 0xFF, 0x15, 0x2A, 0x3F, 0x54, 0x69,
+        0x7E, 0x93, 0xA8, 0xBD, 0xD2, 0xE7, 0xFC, 0x12, 0x27, 0x3C, 0x51, 0x66, 0x7B, 0x90, 0xA5, 0xBA,
+        0xCF, 0xE4, 0xF9, 0x0F, 0x24, 0x39, 0x4E, 0x63, 0x78, 0x8D, 0xA2, 0xB7, 0xCC, 0xE1, 0xF6, 0x0C,
+        0x21, 0x36, 0x4B, 0x60, 0x75, 0x8A, 0x9F, 0xB4, 0xC9, 0xDE, 0xF3, 0x09, 0x1E, 0x33, 0x48, 0x5D,
+        0x72, 0x87, 0x9C, 0xB1, 0xC6, 0xDB, 0xF0, 0x06, 0x1B, 0x30, 0x45, 0x5A, 0x6F, 0x84, 0x99, 0xAE,
+        0xC3, 0xD8, 0xED, 0x03, 0x18, 0x2D, 0x42, 0x57, 0x6C, 0x81, 0x96, 0xAB, 0xC0, 0xD5, 0xEA,
+    },
+    {
+        0xFF, 0x16, 0x2C, 0x42, 0x58, 0x6E, 0x84, 0x9A, 0xB0, 0xC6, 0xDC, 0xF2, 0x09, 0x1F, 0x35, 0x4B,
+        0x61, 0x77, 0x8D, 0xA3, 0xB9, 0xCF, 0xE5, 0xFB, 0x12, 0x28, 0x3E, 0x54, 0x6A, 0x80, 0x96, 0xAC,
+        0xC2, 0xD8, 0xEE, 0x05, 0x1B, 0x31, 0x47, 0x5D, 0x73, 0x89, 0x9F, 0xB5, 0xCB, 0xE1, 0xF7, 0x0E,
+        0x24, 0x3A, 0x50, 0x66, 0x7C, 0x92, 0xA8, 0xBE, 0xD4, 0xEA, 0x01, 0x17, 0x2D, 0x43, 0x59, 0x6F,
+        0x85, 0x9B, 0xB1, 0xC7, 0xDD, 0xF3, 0x0A, 0x20, 0x36, 0x4C, 0x62, 0x78, 0x8E, 0xA4, 0xBA, 0xD0,
+        0xE6, 0xFC, 0x13, 0x29, 0x3F, 0x55, 0x6B, 0x81, 0x97, 0xAD, 0xC3, 0xD9, 0xEF, 0x06, 0x1C, 0x32,
+        0x48, 0x5E, 0x74, 0x8A, 0xA0, 0xB6, 0xCC, 0xE2, 0xF8, 0x0F, 0x25, 0x3B, 0x51, 0x67, 0x7D, 0x93,
+        0xA9, 0xBF, 0xD5, 0xEB, 0x02, 0x18, 0x2E, 0x44, 0x5A, 0x70, 0x86, 0x9C, 0xB2, 0xC8, 0xDE, 0xF4,
+        0x0B, 0x21, 0x37, 0x4D, 0x63, 0x79, 0x8F, 0xA5, 0xBB, 0xD1, 0xE7, 0xFD, 0x14, 0x2A, 0x40, 0x56,
+        0x6C, 0x82, 0x98, 0xAE, 0xC4, 0xDA, 0xF0, 0x07, 0x1D, 0x33, 0x49, 0x5F, 0x75, 0x8B, 0xA1, 0xB7,
+        0xCD, 0xE3, 0xF9, 0x10, 0x26, 0x3C, 0x52, 0x68, 0x7E, 0x94, 0xAA, 0xC0, 0xD6, 0xEC, 0x03, 0x19,
+        0x2F, 0x45, 0x5B, 0x71, 0x87, 0x9D, 0xB3, 0xC9, 0xDF, 0xF5, 0x0C, 0x22, 0x38, 0x4E, 0x64, 0x7A,
+        0x90, 0xA6, 0xBC, 0xD2, 0xE8, 0xFE, 0x15, 0x2B, 0x41, 0x57, 0x6D, 0x83, 0x99, 0xAF, 0xC5, 0xDB,
+        0xF1, 0x08, 0x1E, 0x34, 0x4A, 0x60, 0x76, 0x8C, 0xA2, 0xB8, 0xCE, 0xE4, 0xFA, 0x11, 0x27, 0x3D,
+        0x53, 0x69, 0x7F, 0x95, 0xAB, 0xC1, 0xD7, 0xED, 0x04, 0x1A, 0x30, 0x46, 0x5C, 0x72, 0x88, 0x9E,
+        0xB4, 0xCA, 0xE0, 0xF6, 0x0D, 0x23, 0x39, 0x4F, 0x65, 0x7B, 0x91, 0xA7, 0xBD, 0xD3, 0xE9,
+    },
+    {
+        0xFF, 0x17, 0x2E, 0x45, 0x5C, 0x73, 0x8A, 0xA1, 0xB8, 0xCF, 0xE6, 0xFD, 0x15, 0x2C, 0x43, 0x5A,
+        0x71, 0x88, 0x9F, 0xB6, 0xCD, 0xE4, 0xFB, 0x13, 0x2A, 0x41, 0x58, 0x6F, 0x86, 0x9D, 0xB4, 0xCB,
+        0xE2, 0xF9, 0x11, 0x28, 0x3F, 0x56, 0x6D, 0x84, 0x9B, 0xB2, 0xC9, 0xE0, 0xF7, 0x0F, 0x26, 0x3D,
+        0x54, 0x6B, 0x82, 0x99, 0xB0, 0xC7, 0xDE, 0xF5, 0x0D, 0x24, 0x3B, 0x52, 0x69, 0x80, 0x97, 0xAE,
+        0xC5, 0xDC, 0xF3, 0x0B, 0x22, 0x39, 0x50, 0x67, 0x7E, 0x95, 0xAC, 0xC3, 0xDA, 0xF1, 0x09, 0x20,
+        0x37, 0x4E, 0x65, 0x7C, 0x93, 0xAA, 0xC1, 0xD8, 0xEF, 0x07, 0x1E, 0x35, 0x4C, 0x63, 0x7A, 0x91,
+        0xA8, 0xBF, 0xD6, 0xED, 0x05, 0x1C, 0x33, 0x4A, 0x61, 0x78, 0x8F, 0xA6, 0xBD, 0xD4, 0xEB, 0x03,
+        0x1A, 0x31, 0x48, 0x5F, 0x76, 0x8D, 0xA4, 0xBB, 0xD2, 0xE9, 0x01, 0x18, 0x2F, 0x46, 0x5D, 0x74,
+        0x8B, 0xA2, 0xB9, 0xD0, 0xE7, 0xFE, 0x16, 0x2D, 0x44, 0x5B, 0x72, 0x89, 0xA0, 0xB7, 0xCE, 0xE5,
+        0xFC, 0x14, 0x2B, 0x42, 0x59, 0x70, 0x87, 0x9E, 0xB5, 0xCC, 0xE3, 0xFA, 0x12, 0x29, 0x40, 0x57,
+        0x6E, 0x85, 0x9C, 0xB3, 0xCA, 0xE1, 0xF8, 0x10, 0x27, 0x3E, 0x55, 0x6C, 0x83, 0x9A, 0xB1, 0xC8,
+        0xDF, 0xF6, 0x0E, 0x25, 0x3C, 0x53, 0x6A, 0x81, 0x98, 0xAF, 0xC6, 0xDD, 0xF4, 0x0C, 0x23, 0x3A,
+        0x51, 0x68, 0x7F, 0x96, 0xAD, 0xC4, 0xDB, 0xF2, 0x0A, 0x21, 0x38, 0x4F, 0x66, 0x7D, 0x94, 0xAB,
+        0xC2, 0xD9, 0xF0, 0x08, 0x1F, 0x36, 0x4D, 0x64, 0x7B, 0x92, 0xA9, 0xC0, 0xD7, 0xEE, 0x06, 0x1D,
+        0x34, 0x4B, 0x62, 0x79, 0x90, 0xA7, 0xBE, 0xD5, 0xEC, 0x04, 0x1B, 0x32, 0x49, 0x60, 0x77, 0x8E,
+        0xA5, 0xBC, 0xD3, 0xEA, 0x02, 0x19, 0x30, 0x47, 0x5E, 0x75, 0x8C, 0xA3, 0xBA, 0xD1, 0xE8,
+    },
+    {
+        0xFF, 0x18, 0x30, 0x48, 0x60, 0x78, 0x90, 0xA8, 0xC0, 0xD8, 0xF0, 0x09, 0x21, 0x39, 0x51, 0x69,
+        0x81, 0x99, 0xB1, 0xC9, 0xE1, 0xF9, 0x12, 0x2A, 0x42, 0x5A, 0x72, 0x8A, 0xA2, 0xBA, 0xD2, 0xEA,
+        0x03, 0x1B, 0x33, 0x4B, 0x63, 0x7B, 0x93, 0xAB, 0xC3, 0xDB, 0xF3, 0x0C, 0x24, 0x3C, 0x54, 0x6C,
+        0x84, 0x9C, 0xB4, 0xCC, 0xE4, 0xFC, 0x15, 0x2D, 0x45, 0x5D, 0x75, 0x8D, 0xA5, 0xBD, 0xD5, 0xED,
+        0x06, 0x1E, 0x36, 0x4E, 0x66, 0x7E, 0x96, 0xAE, 0xC6, 0xDE, 0xF6, 0x0F, 0x27, 0x3F, 0x57, 0x6F,
+        0x87, 0x9F, 0xB7, 0xCF, 0xE7, 0xFF, 0x18, 0x30, 0x48, 0x60, 0x78, 0x90, 0xA8, 0xC0, 0xD8, 0xF0,
+        0x09, 0x21, 0x39, 0x51, 0x69, 0x81, 0x99, 0xB1, 0xC9, 0xE1, 0xF9, 0x12, 0x2A, 0x42, 0x5A, 0x72,
+        0x8A, 0xA2, 0xBA, 0xD2, 0xEA, 0x03, 0x1B, 0x33, 0x4B, 0x63, 0x7B, 0x93, 0xAB, 0xC3, 0xDB, 0xF3,
+        0x0C, 0x24, 0x3C, 0x54, 0x6C, 0x84, 0x9C, 0xB4, 0xCC, 0xE4, 0xFC, 0x15, 0x2D, 0x45, 0x5D, 0x75,
+        0x8D, 0xA5, 0xBD, 0xD5, 0xED, 0x06, 0x1E, 0x36, 0x4E, 0x66, 0x7E, 0x96, 0xAE, 0xC6, 0xDE, 0xF6,
+        0x0F, 0x27, 0x3F, 0x57, 0x6F, 0x87, 0x9F, 0xB7, 0xCF, 0xE7, 0xFF, 0x18, 0x30, 0x48, 0x60, 0x78,
+        0x90, 0xA8, 0xC0, 0xD8, 0xF0, 0x09, 0x21, 0x39, 0x51, 0x69, 0x81, 0x99, 0xB1, 0xC9, 0xE1, 0xF9,
+        0x12, 0x2A, 0x42, 0x5A, 0x72, 0x8A, 0xA2, 0xBA, 0xD2, 0xEA, 0x03, 0x1B, 0x33, 0x4B, 0x63, 0x7B,
+        0x93, 0xAB, 0xC3, 0xDB, 0xF3, 0x0C, 0x24, 0x3C, 0x54, 0x6C, 0x84, 0x9C, 0xB4, 0xCC, 0xE4, 0xFC,
+        0x15, 0x2D, 0x45, 0x5D, 0x75, 0x8D, 0xA5, 0xBD, 0xD5, 0xED, 0x06, 0x1E, 0x36, 0x4E, 0x66, 0x7E,
+        0x96, 0xAE, 0xC6, 0xDE, 0xF6, 0x0F, 0x27, 0x3F, 0x57, 0x6F, 0x87, 0x9F, 0xB7, 0xCF, 0xE7,
+    },
+    {
+        0xFF, 0x19, 0x32, 0x4B, 0x64, 0x7D, 0x96, 0xAF, 0xC8, 0xE1, 0xFA, 0x14, 0x2D, 0x46, 0x5F, 0x78,
+        0x91, 0xAA, 0xC3, 0xDC, 0xF5, 0x0F, 0x28, 0x41, 0x5A, 0x73, 0x8C, 0xA5, 0xBE, 0xD7, 0xF0, 0x0A,
+        0x23, 0x3C, 0x55, 0x6E, 0x87, 0xA0, 0xB9, 0xD2, 0xEB, 0x05, 0x1E, 0x37, 0x50, 0x69, 0x82, 0x9B,
+        0xB4, 0xCD, 0xE6, 0xFF, 0x19, 0x32, 0x4B, 0x64, 0x7D, 0x96, 0xAF, 0xC8, 0xE1, 0xFA, 0x14, 0x2D,
+        0x46, 0x5F, 0x78, 0x91, 0xAA, 0xC3, 0xDC, 0xF5, 0x0F, 0x28, 0x41, 0x5A, 0x73, 0x8C, 0xA5, 0xBE,
+        0xD7, 0xF0, 0x0A, 0x23, 0x3C, 0x55, 0x6E, 0x87, 0xA0, 0xB9, 0xD2, 0xEB, 0x05, 0x1E, 0x37, 0x50,
+        0x69, 0x82, 0x9B, 0xB4, 0xCD, 0xE6, 0xFF, 0x19, 0x32, 0x4B, 0x64, 0x7D, 0x96, 0xAF, 0xC8, 0xE1,
+        0xFA, 0x14, 0x2D, 0x46, 0x5F, 0x78, 0x91, 0xAA, 0xC3, 0xDC, 0xF5, 0x0F, 0x28, 0x41, 0x5A, 0x73,
+        0x8C, 0xA5, 0xBE, 0xD7, 0xF0, 0x0A, 0x23, 0x3C, 0x55, 0x6E, 0x87, 0xA0, 0xB9, 0xD2, 0xEB, 0x05,
+        0x1E, 0x37, 0x50, 0x69, 0x82, 0x9B, 0xB4, 0xCD, 0xE6, 0xFF, 0x19, 0x32, 0x4B, 0x64, 0x7D, 0x96,
+        0xAF, 0xC8, 0xE1, 0xFA, 0x14, 0x2D, 0x46, 0x5F, 0x78, 0x91, 0xAA, 0xC3, 0xDC, 0xF5, 0x0F, 0x28,
+        0x41, 0x5A, 0x73, 0x8C, 0xA5, 0xBE, 0xD7, 0xF0, 0x0A, 0x23, 0x3C, 0x55, 0x6E, 0x87, 0xA0, 0xB9,
+        0xD2, 0xEB, 0x05, 0x1E, 0x37, 0x50, 0x69, 0x82, 0x9B, 0xB4, 0xCD, 0xE6, 0xFF, 0x19, 0x32, 0x4B,
+        0x64, 0x7D, 0x96, 0xAF, 0xC8, 0xE1, 0xFA, 0x14, 0x2D, 0x46, 0x5F, 0x78, 0x91, 0xAA, 0xC3, 0xDC,
+        0xF5, 0x0F, 0x28, 0x41, 0x5A, 0x73, 0x8C, 0xA5, 0xBE, 0xD7, 0xF0, 0x0A, 0x23, 0x3C, 0x55, 0x6E,
+        0x87, 0xA0, 0xB9, 0xD2, 0xEB, 0x05, 0x1E, 0x37, 0x50, 0x69, 0x82, 0x9B, 0xB4, 0xCD, 0xE6,
+    },
+    {
+        0xFF, 0x1A, 0x34, 0x4E, 0x68, 0x82, 0x9C, 0xB6, 0xD0, 0xEA, 0x05, 0x1F, 0x39, 0x53, 0x6D, 0x87,
+        0xA1, 0xBB, 0xD5, 0xEF, 0x0A, 0x24, 0x3E, 0x58, 0x72, 0x8C, 0xA6, 0xC0, 0xDA, 0xF4, 0x0F, 0x29,
+        0x43, 0x5D, 0x77, 0x91, 0xAB, 0xC5, 0xDF, 0xF9, 0x14, 0x2E, 0x48, 0x62, 0x7C, 0x96, 0xB0, 0xCA,
+        0xE4, 0xFE, 0x19, 0x33, 0x4D, 0x67, 0x81, 0x9B, 0xB5, 0xCF, 0xE9, 0x04, 0x1E, 0x38, 0x52, 0x6C,
+        0x86, 0xA0, 0xBA, 0xD4, 0xEE, 0x09, 0x23, 0x3D, 0x57, 0x71, 0x8B, 0xA5, 0xBF, 0xD9, 0xF3, 0x0E,
+        0x28, 0x42, 0x5C, 0x76, 0x90, 0xAA, 0xC4, 0xDE, 0xF8, 0x13, 0x2D, 0x47, 0x61, 0x7B, 0x95, 0xAF,
+        0xC9, 0xE3, 0xFD, 0x18, 0x32, 0x4C, 0x66, 0x80, 0x9A, 0xB4, 0xCE, 0xE8, 0x03, 0x1D, 0x37, 0x51,
+        0x6B, 0x85, 0x9F, 0xB9, 0xD3, 0xED, 0x08, 0x22, 0x3C, 0x56, 0x70, 0x8A, 0xA4, 0xBE, 0xD8, 0xF2,
+        0x0D, 0x27, 0x41, 0x5B, 0x75, 0x8F, 0xA9, 0xC3, 0xDD, 0xF7, 0x12, 0x2C, 0x46, 0x60, 0x7A, 0x94,
+        0xAE, 0xC8, 0xE2, 0xFC, 0x17, 0x31, 0x4B, 0x65, 0x7F, 0x99, 0xB3, 0xCD, 0xE7, 0x02, 0x1C, 0x36,
+        0x50, 0x6A, 0x84, 0x9E, 0xB8, 0xD2, 0xEC, 0x07, 0x21, 0x3B, 0x55, 0x6F, 0x89, 0xA3, 0xBD, 0xD7,
+        0xF1, 0x0C, 0x26, 0x40, 0x5A, 0x74, 0x8E, 0xA8, 0xC2, 0xDC, 0xF6, 0x11, 0x2B, 0x45, 0x5F, 0x79,
+        0x93, 0xAD, 0xC7, 0xE1, 0xFB, 0x16, 0x30, 0x4A, 0x64, 0x7E, 0x98, 0xB2, 0xCC, 0xE6, 0x01, 0x1B,
+        0x35, 0x4F, 0x69, 0x83, 0x9D, 0xB7, 0xD1, 0xEB, 0x06, 0x20, 0x3A, 0x54, 0x6E, 0x88, 0xA2, 0xBC,
+        0xD6, 0xF0, 0x0B, 0x25, 0x3F, 0x59, 0x73, 0x8D, 0xA7, 0xC1, 0xDB, 0xF5, 0x10, 0x2A, 0x44, 0x5E,
+        0x78, 0x92, 0xAC, 0xC6, 0xE0, 0xFA, 0x15, 0x2F, 0x49, 0x63, 0x7D, 0x97, 0xB1, 0xCB, 0xE5,
+    },
+    {
+        0xFF, 0x1B, 0x36, 0x51, 0x6C, 0x87, 0xA2, 0xBD, 0xD8, 0xF3, 0x0F, 0x2A, 0x45, 0x60, 0x7B, 0x96,
+        0xB1, 0xCC, 0xE7, 0x03, 0x1E, 0x39, 0x54, 0x6F, 0x8A, 0xA5, 0xC0, 0xDB, 0xF6, 0x12, 0x2D, 0x48,
+        0x63, 0x7E, 0x99, 0xB4, 0xCF, 0xEA, 0x06, 0x21, 0x3C, 0x57, 0x72, 0x8D, 0xA8, 0xC3, 0xDE, 0xF9,
+        0x15, 0x30, 0x4B, 0x66, 0x81, 0x9C, 0xB7, 0xD2, 0xED, 0x09, 0x24, 0x3F, 0x5A, 0x75, 0x90, 0xAB,
+        0xC6, 0xE1, 0xFC, 0x18, 0x33, 0x4E, 0x69, 0x84, 0x9F, 0xBA, 0xD5, 0xF0, 0x0C, 0x27, 0x42, 0x5D,
+        0x78, 0x93, 0xAE, 0xC9, 0xE4, 0xFF, 0x1B, 0x36, 0x51, 0x6C, 0x87, 0xA2, 0xBD, 0xD8, 0xF3, 0x0F,
+        0x2A, 0x45, 0x60, 0x7B, 0x96, 0xB1, 0xCC, 0xE7, 0x03, 0x1E, 0x39, 0x54, 0x6F, 0x8A, 0xA5, 0xC0,
+        0xDB, 0xF6, 0x12, 0x2D, 0x48, 0x63, 0x7E, 0x99, 0xB4, 0xCF, 0xEA, 0x06, 0x21, 0x3C, 0x57, 0x72,
+        0x8D, 0xA8, 0xC3, 0xDE, 0xF9, 0x15, 0x30, 0x4B, 0x66, 0x81, 0x9C, 0xB7, 0xD2, 0xED, 0x09, 0x24,
+        0x3F, 0x5A, 0x75, 0x90, 0xAB, 0xC6, 0xE1, 0xFC, 0x18, 0x33, 0x4E, 0x69, 0x84, 0x9F, 0xBA, 0xD5,
+        0xF0, 0x0C, 0x27, 0x42, 0x5D, 0x78, 0x93, 0xAE, 0xC9, 0xE4, 0xFF, 0x1B, 0x36, 0x51, 0x6C, 0x87,
+        0xA2, 0xBD, 0xD8, 0xF3, 0x0F, 0x2A, 0x45, 0x60, 0x7B, 0x96, 0xB1, 0xCC, 0xE7, 0x03, 0x1E, 0x39,
+        0x54, 0x6F, 0x8A, 0xA5, 0xC0, 0xDB, 0xF6, 0x12, 0x2D, 0x48, 0x63, 0x7E, 0x99, 0xB4, 0xCF, 0xEA,
+        0x06, 0x21, 0x3C, 0x57, 0x72, 0x8D, 0xA8, 0xC3, 0xDE, 0xF9, 0x15, 0x30, 0x4B, 0x66, 0x81, 0x9C,
+        0xB7, 0xD2, 0xED, 0x09, 0x24, 0x3F, 0x5A, 0x75, 0x90, 0xAB, 0xC6, 0xE1, 0xFC, 0x18, 0x33, 0x4E,
+        0x69, 0x84, 0x9F, 0xBA, 0xD5, 0xF0, 0x0C, 0x27, 0x42, 0x5D, 0x78, 0x93, 0xAE, 0xC9, 0xE4,
+    },
+    {
+        0xFF, 0x1C, 0x38, 0x54, 0x70, 0x8C, 0xA8, 0xC4, 0xE0, 0xFC, 0x19, 0x35, 0x51, 0x6D, 0x89, 0xA5,
+        0xC1, 0xDD, 0xF9, 0x16, 0x32, 0x4E, 0x6A, 0x86, 0xA2, 0xBE, 0xDA, 0xF6, 0x13, 0x2F, 0x4B, 0x67,
+        0x83, 0x9F, 0xBB, 0xD7, 0xF3, 0x10, 0x2C, 0x48, 0x64, 0x80, 0x9C, 0xB8, 0xD4, 0xF0, 0x0D, 0x29,
+        0x45, 0x61, 0x7D, 0x99, 0xB5, 0xD1, 0xED, 0x0A, 0x26, 0x42, 0x5E, 0x7A, 0x96, 0xB2, 0xCE, 0xEA,
+        0x07, 0x23, 0x3F, 0x5B, 0x77, 0x93, 0xAF, 0xCB, 0xE7, 0x04, 0x20, 0x3C, 0x58, 0x74, 0x90, 0xAC,
+        0xC8, 0xE4, 0x01, 0x1D, 0x39, 0x55, 0x71, 0x8D, 0xA9, 0xC5, 0xE1, 0xFD, 0x1A, 0x36, 0x52, 0x6E,
+        0x8A, 0xA6, 0xC2, 0xDE, 0xFA, 0x17, 0x33, 0x4F, 0x6B, 0x87, 0xA3, 0xBF, 0xDB, 0xF7, 0x14, 0x30,
+        0x4C, 0x68, 0x84, 0xA0, 0xBC, 0xD8, 0xF4, 0x11, 0x2D, 0x49, 0x65, 0x81, 0x9D, 0xB9, 0xD5, 0xF1,
+        0x0E, 0x2A, 0x46, 0x62, 0x7E, 0x9A, 0xB6, 0xD2, 0xEE, 0x0B, 0x27, 0x43, 0x5F, 0x7B, 0x97, 0xB3,
+        0xCF, 0xEB, 0x08, 0x24, 0x40, 0x5C, 0x78, 0x94, 0xB0, 0xCC, 0xE8, 0x05, 0x21, 0x3D, 0x59, 0x75,
+        0x91, 0xAD, 0xC9, 0xE5, 0x02, 0x1E, 0x3A, 0x56, 0x72, 0x8E, 0xAA, 0xC6, 0xE2, 0xFE, 0x1B, 0x37,
+        0x53, 0x6F, 0x8B, 0xA7, 0xC3, 0xDF, 0xFB, 0x18, 0x34, 0x50, 0x6C, 0x88, 0xA4, 0xC0, 0xDC, 0xF8,
+        0x15, 0x31, 0x4D, 0x69, 0x85, 0xA1, 0xBD, 0xD9, 0xF5, 0x12, 0x2E, 0x4A, 0x66, 0x82, 0x9E, 0xBA,
+        0xD6, 0xF2, 0x0F, 0x2B, 0x47, 0x63, 0x7F, 0x9B, 0xB7, 0xD3, 0xEF, 0x0C, 0x28, 0x44, 0x60, 0x7C,
+        0x98, 0xB4, 0xD0, 0xEC, 0x09, 0x25, 0x41, 0x5D, 0x79, 0x95, 0xB1, 0xCD, 0xE9, 0x06, 0x22, 0x3E,
+        0x5A, 0x76, 0x92, 0xAE, 0xCA, 0xE6, 0x03, 0x1F, 0x3B, 0x57, 0x73, 0x8F, 0xAB, 0xC7, 0xE3,
+    },
+    {
+        0xFF, 0x1D, 0x3A, 0x57, 0x74, 0x91, 0xAE, 0xCB, 0xE8, 0x06, 0x23, 0x40, 0x5D, 0x7A, 0x97, 0xB4,
+        0xD1, 0xEE, 0x0C, 0x29, 0x46, 0x63, 0x80, 0x9D, 0xBA, 0xD7, 0xF4, 0x12, 0x2F, 0x4C, 0x69, 0x86,
+        0xA3, 0xC0, 0xDD, 0xFA, 0x18, 0x35, 0x52, 0x6F, 0x8C, 0xA9, 0xC6, 0xE3, 0x01, 0x1E, 0x3B, 0x58,
+        0x75, 0x92, 0xAF, 0xCC, 0xE9, 0x07, 0x24, 0x41, 0x5E, 0x7B, 0x98, 0xB5, 0xD2, 0xEF, 0x0D, 0x2A,
+        0x47, 0x64, 0x81, 0x9E, 0xBB, 0xD8, 0xF5, 0x13, 0x30, 0x4D, 0x6A, 0x87, 0xA4, 0xC1, 0xDE, 0xFB,
+        0x19, 0x36, 0x53, 0x70, 0x8D, 0xAA, 0xC7, 0xE4, 0x02, 0x1F, 0x3C, 0x59, 0x76, 0x93, 0xB0, 0xCD,
+        0xEA, 0x08, 0x25, 0x42, 0x5F, 0x7C, 0x99, 0xB6, 0xD3, 0xF0, 0x0E, 0x2B, 0x48, 0x65, 0x82, 0x9F,
+        0xBC, 0xD9, 0xF6, 0x14, 0x31, 0x4E, 0x6B, 0x88, 0xA5, 0xC2, 0xDF, 0xFC, 0x1A, 0x37, 0x54, 0x71,
+        0x8E, 0xAB, 0xC8, 0xE5, 0x03, 0x20, 0x3D, 0x5A, 0x77, 0x94, 0xB1, 0xCE, 0xEB, 0x09, 0x26, 0x43,
+        0x60, 0x7D, 0x9A, 0xB7, 0xD4, 0xF1, 0x0F, 0x2C, 0x49, 0x66, 0x83, 0xA0, 0xBD, 0xDA, 0xF7, 0x15,
+        0x32, 0x4F, 0x6C, 0x89, 0xA6, 0xC3, 0xE0, 0xFD, 0x1B, 0x38, 0x55, 0x72, 0x8F, 0xAC, 0xC9, 0xE6,
+        0x04, 0x21, 0x3E, 0x5B, 0x78, 0x95, 0xB2, 0xCF, 0xEC, 0x0A, 0x27, 0x44, 0x61, 0x7E, 0x9B, 0xB8,
+        0xD5, 0xF2, 0x10, 0x2D, 0x4A, 0x67, 0x84, 0xA1, 0xBE, 0xDB, 0xF8, 0x16, 0x33, 0x50, 0x6D, 0x8A,
+        0xA7, 0xC4, 0xE1, 0xFE, 0x1C, 0x39, 0x56, 0x73, 0x90, 0xAD, 0xCA, 0xE7, 0x05, 0x22, 0x3F, 0x5C,
+        0x79, 0x96, 0xB3, 0xD0, 0xED, 0x0B, 0x28, 0x45, 0x62, 0x7F, 0x9C, 0xB9, 0xD6, 0xF3, 0x11, 0x2E,
+        0x4B, 0x68, 0x85, 0xA2, 0xBF, 0xDC, 0xF9, 0x17, 0x34, 0x51, 0x6E, 0x8B, 0xA8, 0xC5, 0xE2,
+    },
+    {
+        0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3,
+        0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5,
+        0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87,
+        0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69,
+        0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B,
+        0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D,
+        0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F,
+        0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0,
+        0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2,
+        0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4,
+        0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96,
+        0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78,
+        0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C, 0x5A,
+        0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E, 0x3C,
+        0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1, 0xFF, 0x1E,
+        0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3, 0xE1,
+    },
+    {
+        0xFF, 0x1F, 0x3E, 0x5D, 0x7C, 0x9B, 0xBA, 0xD9, 0xF8, 0x18, 0x37, 0x56, 0x75, 0x94, 0xB3, 0xD2,
+        0xF1, 0x11, 0x30, 0x4F, 0x6E, 0x8D, 0xAC, 0xCB, 0xEA, 0x0A, 0x29, 0x48, 0x67, 0x86, 0xA5, 0xC4,
+        0xE3, 0x03, 0x22, 0x41, 0x60, 0x7F, 0x9E, 0xBD, 0xDC, 0xFB, 0x1B, 0x3A, 0x59, 0x78, 0x97, 0xB6,
+        0xD5, 0xF4, 0x14, 0x33, 0x52, 0x71, 0x90, 0xAF, 0xCE, 0xED, 0x0D, 0x2C, 0x4B, 0x6A, 0x89, 0xA8,
+        0xC7, 0xE6, 0x06, 0x25, 0x44, 0x63, 0x82, 0xA1, 0xC0, 0xDF, 0xFE, 0x1E, 0x3D, 0x5C, 0x7B, 0x9A,
+        0xB9, 0xD8, 0xF7, 0x17, 0x36, 0x55, 0x74, 0x93, 0xB2, 0xD1, 0xF0, 0x10, 0x2F, 0x4E, 0x6D, 0x8C,
+        0xAB, 0xCA, 0xE9, 0x09, 0x28, 0x47, 0x66, 0x85, 0xA4, 0xC3, 0xE2, 0x02, 0x21, 0x40, 0x5F, 0x7E,
+        0x9D, 0xBC, 0xDB, 0xFA, 0x1A, 0x39, 0x58, 0x77, 0x96, 0xB5, 0xD4, 0xF3, 0x13, 0x32, 0x51, 0x70,
+        0x8F, 0xAE, 0xCD, 0xEC, 0x0C, 0x2B, 0x4A, 0x69, 0x88, 0xA7, 0xC6, 0xE5, 0x05, 0x24, 0x43, 0x62,
+        0x81, 0xA0, 0xBF, 0xDE, 0xFD, 0x1D, 0x3C, 0x5B, 0x7A, 0x99, 0xB8, 0xD7, 0xF6, 0x16, 0x35, 0x54,
+        0x73, 0x92, 0xB1, 0xD0, 0xEF, 0x0F, 0x2E, 0x4D, 0x6C, 0x8B, 0xAA, 0xC9, 0xE8, 0x08, 0x27, 0x46,
+        0x65, 0x84, 0xA3, 0xC2, 0xE1, 0x01, 0x20, 0x3F, 0x5E, 0x7D, 0x9C, 0xBB, 0xDA, 0xF9, 0x19, 0x38,
+        0x57, 0x76, 0x95, 0xB4, 0xD3, 0xF2, 0x12, 0x31, 0x50, 0x6F, 0x8E, 0xAD, 0xCC, 0xEB, 0x0B, 0x2A,
+        0x49, 0x68, 0x87, 0xA6, 0xC5, 0xE4, 0x04, 0x23, 0x42, 0x61, 0x80, 0x9F, 0xBE, 0xDD, 0xFC, 0x1C,
+        0x3B, 0x5A, 0x79, 0x98, 0xB7, 0xD6, 0xF5, 0x15, 0x34, 0x53, 0x72, 0x91, 0xB0, 0xCF, 0xEE, 0x0E,
+        0x2D, 0x4C, 0x6B, 0x8A, 0xA9, 0xC8, 0xE7, 0x07, 0x26, 0x45, 0x64, 0x83, 0xA2, 0xC1, 0xE0,
+    },
+    {
+        0xFF, 0x20, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xE0, 0x01, 0x21, 0x41, 0x61, 0x81, 0xA1, 0xC1, 0xE1,
+        0x02, 0x22, 0x42, 0x62, 0x82, 0xA2, 0xC2, 0xE2, 0x03, 0x23, 0x43, 0x63, 0x83, 0xA3, 0xC3, 0xE3,
+        0x04, 0x24, 0x44, 0x64, 0x84, 0xA4, 0xC4, 0xE4, 0x05, 0x25, 0x45, 0x65, 0x85, 0xA5, 0xC5, 0xE5,
+        0x06, 0x26, 0x46, 0x66, 0x86, 0xA6, 0xC6, 0xE6, 0x07, 0x27, 0x47, 0x67, 0x87, 0xA7, 0xC7, 0xE7,
+        0x08, 0x28, 0x48, 0x68, 0x88, 0xA8, 0xC8, 0xE8, 0x09, 0x29, 0x49, 0x69, 0x89, 0xA9, 0xC9, 0xE9,
+        0x0A, 0x2A, 0x4A, 0x6A, 0x8A, 0xAA, 0xCA, 0xEA, 0x0B, 0x2B, 0x4B, 0x6B, 0x8B, 0xAB, 0xCB, 0xEB,
+        0x0C, 0x2C, 0x4C, 0x6C, 0x8C, 0xAC, 0xCC, 0xEC, 0x0D, 0x2D, 0x4D, 0x6D, 0x8D, 0xAD, 0xCD, 0xED,
+        0x0E, 0x2E, 0x4E, 0x6E, 0x8E, 0xAE, 0xCE, 0xEE, 0x0F, 0x2F, 0x4F, 0x6F, 0x8F, 0xAF, 0xCF, 0xEF,
+        0x10, 0x30, 0x50, 0x70, 0x90, 0xB0, 0xD0, 0xF0, 0x11, 0x31, 0x51, 0x71, 0x91, 0xB1, 0xD1, 0xF1,
+        0x12, 0x32, 0x52, 0x72, 0x92, 0xB2, 0xD2, 0xF2, 0x13, 0x33, 0x53, 0x73, 0x93, 0xB3, 0xD3, 0xF3,
+        0x14, 0x34, 0x54, 0x74, 0x94, 0xB4, 0xD4, 0xF4, 0x15, 0x35, 0x55, 0x75, 0x95, 0xB5, 0xD5, 0xF5,
+        0x16, 0x36, 0x56, 0x76, 0x96, 0xB6, 0xD6, 0xF6, 0x17, 0x37, 0x57, 0x77, 0x97, 0xB7, 0xD7, 0xF7,
+        0x18, 0x38, 0x58, 0x78, 0x98, 0xB8, 0xD8, 0xF8, 0x19, 0x39, 0x59, 0x79, 0x99, 0xB9, 0xD9, 0xF9,
+        0x1A, 0x3A, 0x5A, 0x7A, 0x9A, 0xBA, 0xDA, 0xFA, 0x1B, 0x3B, 0x5B, 0x7B, 0x9B, 0xBB, 0xDB, 0xFB,
+        0x1C, 0x3C, 0x5C, 0x7C, 0x9C, 0xBC, 0xDC, 0xFC, 0x1D, 0x3D, 0x5D, 0x7D, 0x9D, 0xBD, 0xDD, 0xFD,
+        0x1E, 0x3E, 0x5E, 0x7E, 0x9E, 0xBE, 0xDE, 0xFE, 0x1F, 0x3F, 0x5F, 0x7F, 0x9F, 0xBF, 0xDF,
+    },
+};
+
+const field_logarithm_t *const correct_rs_ccsds_generator_root_exp[CCSDS_RS_ROOTS] = {
+    ccsds_generator_root_exp_rows[0],
+    ccsds_generator_root_exp_rows[1],
+    ccsds_generator_root_exp_rows[2],
+    ccsds_generator_root_exp_rows[3],
+    ccsds_generator_root_exp_rows[4],
+    ccsds_generator_root_exp_rows[5],
+    ccsds_generator_root_exp_rows[6],
+    ccsds_generator_root_exp_rows[7],
+    ccsds_generator_root_exp_rows[8],
+    ccsds_generator_root_exp_rows[9],
+    ccsds_generator_root_exp_rows[10],
+    ccsds_generator_root_exp_rows[11],
+    ccsds_generator_root_exp_rows[12],
+    ccsds_generator_root_exp_rows[13],
+    ccsds_generator_root_exp_rows[14],
+    ccsds_generator_root_exp_rows[15],
+    ccsds_generator_root_exp_rows[16],
+    ccsds_generator_root_exp_rows[17],
+    ccsds_generator_root_exp_rows[18],
+    ccsds_generator_root_exp_rows[19],
+    ccsds_generator_root_exp_rows[20],
+    ccsds_generator_root_exp_rows[21],
+    ccsds_generator_root_exp_rows[22],
+    ccsds_generator_root_exp_rows[23],
+    ccsds_generator_root_exp_rows[24],
+    ccsds_generator_root_exp_rows[25],
+    ccsds_generator_root_exp_rows[26],
+    ccsds_generator_root_exp_rows[27],
+    ccsds_generator_root_exp_rows[28],
+    ccsds_generator_root_exp_rows[29],
+    ccsds_generator_root_exp_rows[30],
+    ccsds_generator_root_exp_rows[31],
+};
+
+static const field_logarithm_t ccsds_element_exp_rows[256][32] = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    {
+        0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    },
+    {
+        0xFF, 0x63, 0xC6, 0x2A, 0x8D, 0xF0, 0x54, 0xB7, 0x1B, 0x7E, 0xE1, 0x45, 0xA8, 0x0C, 0x6F, 0xD2,
+        0x36, 0x99, 0xFC, 0x60, 0xC3, 0x27, 0x8A, 0xED, 0x51, 0xB4, 0x18, 0x7B, 0xDE, 0x42, 0xA5, 0x09,
+    },
+    {
+        0xFF, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E,
+        0x20, 0x22, 0x24, 0x26, 0x28, 0x2A, 0x2C, 0x2E, 0x30, 0x32, 0x34, 0x36, 0x38, 0x3A, 0x3C, 0x3E,
+    },
+    {
+        0xFF, 0xC6, 0x8D, 0x54, 0x1B, 0xE1, 0xA8, 0x6F, 0x36, 0xFC, 0xC3, 0x8A, 0x51, 0x18, 0xDE, 0xA5,
+        0x6C, 0x33, 0xF9, 0xC0, 0x87, 0x4E, 0x15, 0xDB, 0xA2, 0x69, 0x30, 0xF6, 0xBD, 0x84, 0x4B, 0x12,
+    },
+    {
+        0xFF, 0x64, 0xC8, 0x2D, 0x91, 0xF5, 0x5A, 0xBE, 0x23, 0x87, 0xEB, 0x50, 0xB4, 0x19, 0x7D, 0xE1,
+        0x46, 0xAA, 0x0F, 0x73, 0xD7, 0x3C, 0xA0, 0x05, 0x69, 0xCD, 0x32, 0x96, 0xFA, 0x5F, 0xC3, 0x28,
+    },
+    {
+        0xFF, 0x6A, 0xD4, 0x3F, 0xA9, 0x14, 0x7E, 0xE8, 0x53, 0xBD, 0x28, 0x92, 0xFC, 0x67, 0xD1, 0x3C,
+        0xA6, 0x11, 0x7B, 0xE5, 0x50, 0xBA, 0x25, 0x8F, 0xF9, 0x64, 0xCE, 0x39, 0xA3, 0x0E, 0x78, 0xE2,
+    },
+    {
+        0xFF, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x12, 0x15, 0x18, 0x1B, 0x1E, 0x21, 0x24, 0x27, 0x2A, 0x2D,
+        0x30, 0x33, 0x36, 0x39, 0x3C, 0x3F, 0x42, 0x45, 0x48, 0x4B, 0x4E, 0x51, 0x54, 0x57, 0x5A, 0x5D,
+    },
+    {
+        0xFF, 0xCD, 0x9B, 0x69, 0x37, 0x05, 0xD2, 0xA0, 0x6E, 0x3C, 0x0A, 0xD7, 0xA5, 0x73, 0x41, 0x0F,
+        0xDC, 0xAA, 0x78, 0x46, 0x14, 0xE1, 0xAF, 0x7D, 0x4B, 0x19, 0xE6, 0xB4, 0x82, 0x50, 0x1E, 0xEB,
+    },
+    {
+        0xFF, 0xC7, 0x8F, 0x57, 0x1F, 0xE6, 0xAE, 0x76, 0x3E, 0x06, 0xCD, 0x95, 0x5D, 0x25, 0xEC, 0xB4,
+        0x7C, 0x44, 0x0C, 0xD3, 0x9B, 0x63, 0x2B, 0xF2, 0xBA, 0x82, 0x4A, 0x12, 0xD9, 0xA1, 0x69, 0x31,
+    },
+    {
+        0xFF, 0xBC, 0x79, 0x36, 0xF2, 0xAF, 0x6C, 0x29, 0xE5, 0xA2, 0x5F, 0x1C, 0xD8, 0x95, 0x52, 0x0F,
+        0xCB, 0x88, 0x45, 0x02, 0xBE, 0x7B, 0x38, 0xF4, 0xB1, 0x6E, 0x2B, 0xE7, 0xA4, 0x61, 0x1E, 0xDA,
+    },
+    {
+        0xFF, 0x65, 0xCA, 0x30, 0x95, 0xFA, 0x60, 0xC5, 0x2B, 0x90, 0xF5, 0x5B, 0xC0, 0x26, 0x8B, 0xF0,
+        0x56, 0xBB, 0x21, 0x86, 0xEB, 0x51, 0xB6, 0x1C, 0x81, 0xE6, 0x4C, 0xB1, 0x17, 0x7C, 0xE1, 0x47,
+    },
+    {
+        0xFF, 0x7E, 0xFC, 0x7B, 0xF9, 0x78, 0xF6, 0x75, 0xF3, 0x72, 0xF0, 0x6F, 0xED, 0x6C, 0xEA, 0x69,
+        0xE7, 0x66, 0xE4, 0x63, 0xE1, 0x60, 0xDE, 0x5D, 0xDB, 0x5A, 0xD8, 0x57, 0xD5, 0x54, 0xD2, 0x51,
+    },
+    {
+        0xFF, 0x6B, 0xD6, 0x42, 0xAD, 0x19, 0x84, 0xEF, 0x5B, 0xC6, 0x32, 0x9D, 0x09, 0x74, 0xDF, 0x4B,
+        0xB6, 0x22, 0x8D, 0xF8, 0x64, 0xCF, 0x3B, 0xA6, 0x12, 0x7D, 0xE8, 0x54, 0xBF, 0x2B, 0x96, 0x02,
+    },
+    {
+        0xFF, 0x2A, 0x54, 0x7E, 0xA8, 0xD2, 0xFC, 0x27, 0x51, 0x7B, 0xA5, 0xCF, 0xF9, 0x24, 0x4E, 0x78,
+        0xA2, 0xCC, 0xF6, 0x21, 0x4B, 0x75, 0x9F, 0xC9, 0xF3, 0x1E, 0x48, 0x72, 0x9C, 0xC6, 0xF0, 0x1B,
+    },
+    {
+        0xFF, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C,
+        0x40, 0x44, 0x48, 0x4C, 0x50, 0x54, 0x58, 0x5C, 0x60, 0x64, 0x68, 0x6C, 0x70, 0x74, 0x78, 0x7C,
+    },
+    {
+        0xFF, 0x8D, 0x1B, 0xA8, 0x36, 0xC3, 0x51, 0xDE, 0x6C, 0xF9, 0x87, 0x15, 0xA2, 0x30, 0xBD, 0x4B,
+        0xD8, 0x66, 0xF3, 0x81, 0x0F, 0x9C, 0x2A, 0xB7, 0x45, 0xD2, 0x60, 0xED, 0x7B, 0x09, 0x96, 0x24,
+    },
+    {
+        0xFF, 0xCE, 0x9D, 0x6C, 0x3B, 0x0A, 0xD8, 0xA7, 0x76, 0x45, 0x14, 0xE2, 0xB1, 0x80, 0x4F, 0x1E,
+        0xEC, 0xBB, 0x8A, 0x59, 0x28, 0xF6, 0xC5, 0x94, 0x63, 0x32, 0x01, 0xCF, 0x9E, 0x6D, 0x3C, 0x0B,
+    },
+    {
+        0xFF, 0x4E, 0x9C, 0xEA, 0x39, 0x87, 0xD5, 0x24, 0x72, 0xC0, 0x0F, 0x5D, 0xAB, 0xF9, 0x48, 0x96,
+        0xE4, 0x33, 0x81, 0xCF, 0x1E, 0x6C, 0xBA, 0x09, 0x57, 0xA5, 0xF3, 0x42, 0x90, 0xDE, 0x2D, 0x7B,
+    },
+    {
+        0xFF, 0xC8, 0x91, 0x5A, 0x23, 0xEB, 0xB4, 0x7D, 0x46, 0x0F, 0xD7, 0xA0, 0x69, 0x32, 0xFA, 0xC3,
+        0x8C, 0x55, 0x1E, 0xE6, 0xAF, 0x78, 0x41, 0x0A, 0xD2, 0x9B, 0x64, 0x2D, 0xF5, 0xBE, 0x87, 0x50,
+    },
+    {
+        0xFF, 0xD4, 0xA9, 0x7E, 0x53, 0x28, 0xFC, 0xD1, 0xA6, 0x7B, 0x50, 0x25, 0xF9, 0xCE, 0xA3, 0x78,
+        0x4D, 0x22, 0xF6, 0xCB, 0xA0, 0x75, 0x4A, 0x1F, 0xF3, 0xC8, 0x9D, 0x72, 0x47, 0x1C, 0xF0, 0xC5,
+    },
+    {
+        0xFF, 0xBD, 0x7B, 0x39, 0xF6, 0xB4, 0x72, 0x30, 0xED, 0xAB, 0x69, 0x27, 0xE4, 0xA2, 0x60, 0x1E,
+        0xDB, 0x99, 0x57, 0x15, 0xD2, 0x90, 0x4E, 0x0C, 0xC9, 0x87, 0x45, 0x03, 0xC0, 0x7E, 0x3C, 0xF9,
+    },
+    {
+        0xFF, 0xE1, 0xC3, 0xA5, 0x87, 0x69, 0x4B, 0x2D, 0x0F, 0xF0, 0xD2, 0xB4, 0x96, 0x78, 0x5A, 0x3C,
+        0x1E, 0xFF, 0xE1, 0xC3, 0xA5, 0x87, 0x69, 0x4B, 0x2D, 0x0F, 0xF0, 0xD2, 0xB4, 0x96, 0x78, 0x5A,
+    },
+    {
+        0xFF, 0x66, 0xCC, 0x33, 0x99, 0xFF, 0x66, 0xCC, 0x33, 0x99, 0xFF, 0x66, 0xCC, 0x33, 0x99, 0xFF,
+        0x66, 0xCC, 0x33, 0x99, 0xFF, 0x66, 0xCC, 0x33, 0x99, 0xFF, 0x66, 0xCC, 0x33, 0x99, 0xFF, 0x66,
+    },
+    {
+        0xFF, 0xDD, 0xBB, 0x99, 0x77, 0x55, 0x33, 0x11, 0xEE, 0xCC, 0xAA, 0x88, 0x66, 0x44, 0x22, 0xFF,
+        0xDD, 0xBB, 0x99, 0x77, 0x55, 0x33, 0x11, 0xEE, 0xCC, 0xAA, 0x88, 0x66, 0x44, 0x22, 0xFF, 0xDD,
+    },
+    {
+        0xFF, 0x7F, 0xFE, 0x7E, 0xFD, 0x7D, 0xFC, 0x7C, 0xFB, 0x7B, 0xFA, 0x7A, 0xF9, 0x79, 0xF8, 0x78,
+        0xF7, 0x77, 0xF6, 0x76, 0xF5, 0x75, 0xF4, 0x74, 0xF3, 0x73, 0xF2, 0x72, 0xF1, 0x71, 0xF0, 0x70,
+    },
+    {
+        0xFF, 0x31, 0x62, 0x93, 0xC4, 0xF5, 0x27, 0x58, 0x89, 0xBA, 0xEB, 0x1D, 0x4E, 0x7F, 0xB0, 0xE1,
+        0x13, 0x44, 0x75, 0xA6, 0xD7, 0x09, 0x3A, 0x6B, 0x9C, 0xCD, 0xFE, 0x30, 0x61, 0x92, 0xC3, 0xF4,
+    },
+    {
+        0xFF, 0x6C, 0xD8, 0x45, 0xB1, 0x1E, 0x8A, 0xF6, 0x63, 0xCF, 0x3C, 0xA8, 0x15, 0x81, 0xED, 0x5A,
+        0xC6, 0x33, 0x9F, 0x0C, 0x78, 0xE4, 0x51, 0xBD, 0x2A, 0x96, 0x03, 0x6F, 0xDB, 0x48, 0xB4, 0x21,
+    },
+    {
+        0xFF, 0x20, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xE0, 0x01, 0x21, 0x41, 0x61, 0x81, 0xA1, 0xC1, 0xE1,
+        0x02, 0x22, 0x42, 0x62, 0x82, 0xA2, 0xC2, 0xE2, 0x03, 0x23, 0x43, 0x63, 0x83, 0xA3, 0xC3, 0xE3,
+    },
+    {
+        0xFF, 0x2B, 0x56, 0x81, 0xAC, 0xD7, 0x03, 0x2E, 0x59, 0x84, 0xAF, 0xDA, 0x06, 0x31, 0x5C, 0x87,
+        0xB2, 0xDD, 0x09, 0x34, 0x5F, 0x8A, 0xB5, 0xE0, 0x0C, 0x37, 0x62, 0x8D, 0xB8, 0xE3, 0x0F, 0x3A,
+    },
+    {
+        0xFF, 0xF3, 0xE7, 0xDB, 0xCF, 0xC3, 0xB7, 0xAB, 0x9F, 0x93, 0x87, 0x7B, 0x6F, 0x63, 0x57, 0x4B,
+        0x3F, 0x33, 0x27, 0x1B, 0x0F, 0x03, 0xF6, 0xEA, 0xDE, 0xD2, 0xC6, 0xBA, 0xAE, 0xA2, 0x96, 0x8A,
+    },
+    {
+        0xFF, 0x05, 0x0A, 0x0F, 0x14, 0x19, 0x1E, 0x23, 0x28, 0x2D, 0x32, 0x37, 0x3C, 0x41, 0x46, 0x4B,
+        0x50, 0x55, 0x5A, 0x5F, 0x64, 0x69, 0x6E, 0x73, 0x78, 0x7D, 0x82, 0x87, 0x8C, 0x91, 0x96, 0x9B,
+    },
+    {
+        0xFF, 0x57, 0xAE, 0x06, 0x5D, 0xB4, 0x0C, 0x63, 0xBA, 0x12, 0x69, 0xC0, 0x18, 0x6F, 0xC6, 0x1E,
+        0x75, 0xCC, 0x24, 0x7B, 0xD2, 0x2A, 0x81, 0xD8, 0x30, 0x87, 0xDE, 0x36, 0x8D, 0xE4, 0x3C, 0x93,
+    },
+    {
+        0xFF, 0x8E, 0x1D, 0xAB, 0x3A, 0xC8, 0x57, 0xE5, 0x74, 0x03, 0x91, 0x20, 0xAE, 0x3D, 0xCB, 0x5A,
+        0xE8, 0x77, 0x06, 0x94, 0x23, 0xB1, 0x40, 0xCE, 0x5D, 0xEB, 0x7A, 0x09, 0x97, 0x26, 0xB4, 0x43,
+    },
+    {
+        0xFF, 0xE8, 0xD1, 0xBA, 0xA3, 0x8C, 0x75, 0x5E, 0x47, 0x30, 0x19, 0x02, 0xEA, 0xD3, 0xBC, 0xA5,
+        0x8E, 0x77, 0x60, 0x49, 0x32, 0x1B, 0x04, 0xEC, 0xD5, 0xBE, 0xA7, 0x90, 0x79, 0x62, 0x4B, 0x34,
+    },
+    {
+        0xFF, 0xCF, 0x9F, 0x6F, 0x3F, 0x0F, 0xDE, 0xAE, 0x7E, 0x4E, 0x1E, 0xED, 0xBD, 0x8D, 0x5D, 0x2D,
+        0xFC, 0xCC, 0x9C, 0x6C, 0x3C, 0x0C, 0xDB, 0xAB, 0x7B, 0x4B, 0x1B, 0xEA, 0xBA, 0x8A, 0x5A, 0x2A,
+    },
+    {
+        0xFF, 0xAC, 0x59, 0x06, 0xB2, 0x5F, 0x0C, 0xB8, 0x65, 0x12, 0xBE, 0x6B, 0x18, 0xC4, 0x71, 0x1E,
+        0xCA, 0x77, 0x24, 0xD0, 0x7D, 0x2A, 0xD6, 0x83, 0x30, 0xDC, 0x89, 0x36, 0xE2, 0x8F, 0x3C, 0xE8,
+    },
+    {
+        0xFF, 0x4F, 0x9E, 0xED, 0x3D, 0x8C, 0xDB, 0x2B, 0x7A, 0xC9, 0x19, 0x68, 0xB7, 0x07, 0x56, 0xA5,
+        0xF4, 0x44, 0x93, 0xE2, 0x32, 0x81, 0xD0, 0x20, 0x6F, 0xBE, 0x0E, 0x5D, 0xAC, 0xFB, 0x4B, 0x9A,
+    },
+    {
+        0xFF, 0x83, 0x07, 0x8A, 0x0E, 0x91, 0x15, 0x98, 0x1C, 0x9F, 0x23, 0xA6, 0x2A, 0xAD, 0x31, 0xB4,
+        0x38, 0xBB, 0x3F, 0xC2, 0x46, 0xC9, 0x4D, 0xD0, 0x54, 0xD7, 0x5B, 0xDE, 0x62, 0xE5, 0x69, 0xEC,
+    },
+    {
+        0xFF, 0xC9, 0x93, 0x5D, 0x27, 0xF0, 0xBA, 0x84, 0x4E, 0x18, 0xE1, 0xAB, 0x75, 0x3F, 0x09, 0xD2,
+        0x9C, 0x66, 0x30, 0xF9, 0xC3, 0x8D, 0x57, 0x21, 0xEA, 0xB4, 0x7E, 0x48, 0x12, 0xDB, 0xA5, 0x6F,
+    },
+    {
+        0xFF, 0xD9, 0xB3, 0x8D, 0x67, 0x41, 0x1B, 0xF4, 0xCE, 0xA8, 0x82, 0x5C, 0x36, 0x10, 0xE9, 0xC3,
+        0x9D, 0x77, 0x51, 0x2B, 0x05, 0xDE, 0xB8, 0x92, 0x6C, 0x46, 0x20, 0xF9, 0xD3, 0xAD, 0x87, 0x61,
+    },
+    {
+        0xFF, 0xD5, 0xAB, 0x81, 0x57, 0x2D, 0x03, 0xD8, 0xAE, 0x84, 0x5A, 0x30, 0x06, 0xDB, 0xB1, 0x87,
+        0x5D, 0x33, 0x09, 0xDE, 0xB4, 0x8A, 0x60, 0x36, 0x0C, 0xE1, 0xB7, 0x8D, 0x63, 0x39, 0x0F, 0xE4,
+    },
+    {
+        0xFF, 0x41, 0x82, 0xC3, 0x05, 0x46, 0x87, 0xC8, 0x0A, 0x4B, 0x8C, 0xCD, 0x0F, 0x50, 0x91, 0xD2,
+        0x14, 0x55, 0x96, 0xD7, 0x19, 0x5A, 0x9B, 0xDC, 0x1E, 0x5F, 0xA0, 0xE1, 0x23, 0x64, 0xA5, 0xE6,
+    },
+    {
+        0xFF, 0xBE, 0x7D, 0x3C, 0xFA, 0xB9, 0x78, 0x37, 0xF5, 0xB4, 0x73, 0x32, 0xF0, 0xAF, 0x6E, 0x2D,
+        0xEB, 0xAA, 0x69, 0x28, 0xE6, 0xA5, 0x64, 0x23, 0xE1, 0xA0, 0x5F, 0x1E, 0xDC, 0x9B, 0x5A, 0x19,
+    },
+    {
+        0xFF, 0x94, 0x29, 0xBD, 0x52, 0xE6, 0x7B, 0x10, 0xA4, 0x39, 0xCD, 0x62, 0xF6, 0x8B, 0x20, 0xB4,
+        0x49, 0xDD, 0x72, 0x07, 0x9B, 0x30, 0xC4, 0x59, 0xED, 0x82, 0x17, 0xAB, 0x40, 0xD4, 0x69, 0xFD,
+    },
+    {
+        0xFF, 0xE2, 0xC5, 0xA8, 0x8B, 0x6E, 0x51, 0x34, 0x17, 0xF9, 0xDC, 0xBF, 0xA2, 0x85, 0x68, 0x4B,
+        0x2E, 0x11, 0xF3, 0xD6, 0xB9, 0x9C, 0x7F, 0x62, 0x45, 0x28, 0x0B, 0xED, 0xD0, 0xB3, 0x96, 0x79,
+    },
+    {
+        0xFF, 0xB4, 0x69, 0x1E, 0xD2, 0x87, 0x3C, 0xF0, 0xA5, 0x5A, 0x0F, 0xC3, 0x78, 0x2D, 0xE1, 0x96,
+        0x4B, 0xFF, 0xB4, 0x69, 0x1E, 0xD2, 0x87, 0x3C, 0xF0, 0xA5, 0x5A, 0x0F, 0xC3, 0x78, 0x2D, 0xE1,
+    },
+    {
+        0xFF, 0x67, 0xCE, 0x36, 0x9D, 0x05, 0x6C, 0xD3, 0x3B, 0xA2, 0x0A, 0x71, 0xD8, 0x40, 0xA7, 0x0F,
+        0x76, 0xDD, 0x45, 0xAC, 0x14, 0x7B, 0xE2, 0x4A, 0xB1, 0x19, 0x80, 0xE7, 0x4F, 0xB6, 0x1E, 0x85,
+    },
+    {
+        0xFF, 0x27, 0x4E, 0x75, 0x9C, 0xC3, 0xEA, 0x12, 0x39, 0x60, 0x87, 0xAE, 0xD5, 0xFC, 0x24, 0x4B,
+        0x72, 0x99, 0xC0, 0xE7, 0x0F, 0x36, 0x5D, 0x84, 0xAB, 0xD2, 0xF9, 0x21, 0x48, 0x6F, 0x96, 0xBD,
+    },
+    {
+        0xFF, 0xDE, 0xBD, 0x9C, 0x7B, 0x5A, 0x39, 0x18, 0xF6, 0xD5, 0xB4, 0x93, 0x72, 0x51, 0x30, 0x0F,
+        0xED, 0xCC, 0xAB, 0x8A, 0x69, 0x48, 0x27, 0x06, 0xE4, 0xC3, 0xA2, 0x81, 0x60, 0x3F, 0x1E, 0xFC,
+    },
+    {
+        0xFF, 0xF0, 0xE1, 0xD2, 0xC3, 0xB4, 0xA5, 0x96, 0x87, 0x78, 0x69, 0x5A, 0x4B, 0x3C, 0x2D, 0x1E,
+        0x0F, 0xFF, 0xF0, 0xE1, 0xD2, 0xC3, 0xB4, 0xA5, 0x96, 0x87, 0x78, 0x69, 0x5A, 0x4B, 0x3C, 0x2D,
+    },
+    {
+        0xFF, 0x80, 0x01, 0x81, 0x02, 0x82, 0x03, 0x83, 0x04, 0x84, 0x05, 0x85, 0x06, 0x86, 0x07, 0x87,
+        0x08, 0x88, 0x09, 0x89, 0x0A, 0x8A, 0x0B, 0x8B, 0x0C, 0x8C, 0x0D, 0x8D, 0x0E, 0x8E, 0x0F, 0x8F,
+    },
+    {
+        0xFF, 0xB1, 0x63, 0x15, 0xC6, 0x78, 0x2A, 0xDB, 0x8D, 0x3F, 0xF0, 0xA2, 0x54, 0x06, 0xB7, 0x69,
+        0x1B, 0xCC, 0x7E, 0x30, 0xE1, 0x93, 0x45, 0xF6, 0xA8, 0x5A, 0x0C, 0xBD, 0x6F, 0x21, 0xD2, 0x84,
+    },
+    {
+        0xFF, 0x32, 0x64, 0x96, 0xC8, 0xFA, 0x2D, 0x5F, 0x91, 0xC3, 0xF5, 0x28, 0x5A, 0x8C, 0xBE, 0xF0,
+        0x23, 0x55, 0x87, 0xB9, 0xEB, 0x1E, 0x50, 0x82, 0xB4, 0xE6, 0x19, 0x4B, 0x7D, 0xAF, 0xE1, 0x14,
+    },
+    {
+        0xFF, 0x35, 0x6A, 0x9F, 0xD4, 0x0A, 0x3F, 0x74, 0xA9, 0xDE, 0x14, 0x49, 0x7E, 0xB3, 0xE8, 0x1E,
+        0x53, 0x88, 0xBD, 0xF2, 0x28, 0x5D, 0x92, 0xC7, 0xFC, 0x32, 0x67, 0x9C, 0xD1, 0x07, 0x3C, 0x71,
+    },
+    {
+        0xFF, 0x6D, 0xDA, 0x48, 0xB5, 0x23, 0x90, 0xFD, 0x6B, 0xD8, 0x46, 0xB3, 0x21, 0x8E, 0xFB, 0x69,
+        0xD6, 0x44, 0xB1, 0x1F, 0x8C, 0xF9, 0x67, 0xD4, 0x42, 0xAF, 0x1D, 0x8A, 0xF7, 0x65, 0xD2, 0x40,
+    },
+    {
+        0xFF, 0x45, 0x8A, 0xCF, 0x15, 0x5A, 0x9F, 0xE4, 0x2A, 0x6F, 0xB4, 0xF9, 0x3F, 0x84, 0xC9, 0x0F,
+        0x54, 0x99, 0xDE, 0x24, 0x69, 0xAE, 0xF3, 0x39, 0x7E, 0xC3, 0x09, 0x4E, 0x93, 0xD8, 0x1E, 0x63,
+    },
+    {
+        0xFF, 0x21, 0x42, 0x63, 0x84, 0xA5, 0xC6, 0xE7, 0x09, 0x2A, 0x4B, 0x6C, 0x8D, 0xAE, 0xCF, 0xF0,
+        0x12, 0x33, 0x54, 0x75, 0x96, 0xB7, 0xD8, 0xF9, 0x1B, 0x3C, 0x5D, 0x7E, 0x9F, 0xC0, 0xE1, 0x03,
+    },
+    {
+        0xFF, 0x12, 0x24, 0x36, 0x48, 0x5A, 0x6C, 0x7E, 0x90, 0xA2, 0xB4, 0xC6, 0xD8, 0xEA, 0xFC, 0x0F,
+        0x21, 0x33, 0x45, 0x57, 0x69, 0x7B, 0x8D, 0x9F, 0xB1, 0xC3, 0xD5, 0xE7, 0xF9, 0x0C, 0x1E, 0x30,
+    },
+    {
+        0xFF, 0x2C, 0x58, 0x84, 0xB0, 0xDC, 0x09, 0x35, 0x61, 0x8D, 0xB9, 0xE5, 0x12, 0x3E, 0x6A, 0x96,
+        0xC2, 0xEE, 0x1B, 0x47, 0x73, 0x9F, 0xCB, 0xF7, 0x24, 0x50, 0x7C, 0xA8, 0xD4, 0x01, 0x2D, 0x59,
+    },
+    {
+        0xFF, 0x0D, 0x1A, 0x27, 0x34, 0x41, 0x4E, 0x5B, 0x68, 0x75, 0x82, 0x8F, 0x9C, 0xA9, 0xB6, 0xC3,
+        0xD0, 0xDD, 0xEA, 0xF7, 0x05, 0x12, 0x1F, 0x2C, 0x39, 0x46, 0x53, 0x60, 0x6D, 0x7A, 0x87, 0x94,
+    },
+    {
+        0xFF, 0xF4, 0xE9, 0xDE, 0xD3, 0xC8, 0xBD, 0xB2, 0xA7, 0x9C, 0x91, 0x86, 0x7B, 0x70, 0x65, 0x5A,
+        0x4F, 0x44, 0x39, 0x2E, 0x23, 0x18, 0x0D, 0x02, 0xF6, 0xEB, 0xE0, 0xD5, 0xCA, 0xBF, 0xB4, 0xA9,
+    },
+    {
+        0xFF, 0x38, 0x70, 0xA8, 0xE0, 0x19, 0x51, 0x89, 0xC1, 0xF9, 0x32, 0x6A, 0xA2, 0xDA, 0x13, 0x4B,
+        0x83, 0xBB, 0xF3, 0x2C, 0x64, 0x9C, 0xD4, 0x0D, 0x45, 0x7D, 0xB5, 0xED, 0x26, 0x5E, 0x96, 0xCE,
+    },
+    {
+        0xFF, 0x06, 0x0C, 0x12, 0x18, 0x1E, 0x24, 0x2A, 0x30, 0x36, 0x3C, 0x42, 0x48, 0x4E, 0x54, 0x5A,
+        0x60, 0x66, 0x6C, 0x72, 0x78, 0x7E, 0x84, 0x8A, 0x90, 0x96, 0x9C, 0xA2, 0xA8, 0xAE, 0xB4, 0xBA,
+    },
+    {
+        0xFF, 0x9B, 0x37, 0xD2, 0x6E, 0x0A, 0xA5, 0x41, 0xDC, 0x78, 0x14, 0xAF, 0x4B, 0xE6, 0x82, 0x1E,
+        0xB9, 0x55, 0xF0, 0x8C, 0x28, 0xC3, 0x5F, 0xFA, 0x96, 0x32, 0xCD, 0x69, 0x05, 0xA0, 0x3C, 0xD7,
+    },
+    {
+        0xFF, 0x58, 0xB0, 0x09, 0x61, 0xB9, 0x12, 0x6A, 0xC2, 0x1B, 0x73, 0xCB, 0x24, 0x7C, 0xD4, 0x2D,
+        0x85, 0xDD, 0x36, 0x8E, 0xE6, 0x3F, 0x97, 0xEF, 0x48, 0xA0, 0xF8, 0x51, 0xA9, 0x02, 0x5A, 0xB2,
+    },
+    {
+        0xFF, 0x1A, 0x34, 0x4E, 0x68, 0x82, 0x9C, 0xB6, 0xD0, 0xEA, 0x05, 0x1F, 0x39, 0x53, 0x6D, 0x87,
+        0xA1, 0xBB, 0xD5, 0xEF, 0x0A, 0x24, 0x3E, 0x58, 0x72, 0x8C, 0xA6, 0xC0, 0xDA, 0xF4, 0x0F, 0x29,
+    },
+    {
+        0xFF, 0x8F, 0x1F, 0xAE, 0x3E, 0xCD, 0x5D, 0xEC, 0x7C, 0x0C, 0x9B, 0x2B, 0xBA, 0x4A, 0xD9, 0x69,
+        0xF8, 0x88, 0x18, 0xA7, 0x37, 0xC6, 0x56, 0xE5, 0x75, 0x05, 0x94, 0x24, 0xB3, 0x43, 0xD2, 0x62,
+    },
+    {
+        0xFF, 0x79, 0xF2, 0x6C, 0xE5, 0x5F, 0xD8, 0x52, 0xCB, 0x45, 0xBE, 0x38, 0xB1, 0x2B, 0xA4, 0x1E,
+        0x97, 0x11, 0x8A, 0x04, 0x7D, 0xF6, 0x70, 0xE9, 0x63, 0xDC, 0x56, 0xCF, 0x49, 0xC2, 0x3C, 0xB5,
+    },
+    {
+        0xFF, 0xE9, 0xD3, 0xBD, 0xA7, 0x91, 0x7B, 0x65, 0x4F, 0x39, 0x23, 0x0D, 0xF6, 0xE0, 0xCA, 0xB4,
+        0x9E, 0x88, 0x72, 0x5C, 0x46, 0x30, 0x1A, 0x04, 0xED, 0xD7, 0xC1, 0xAB, 0x95, 0x7F, 0x69, 0x53,
+    },
+    {
+        0xFF, 0x70, 0xE0, 0x51, 0xC1, 0x32, 0xA2, 0x13, 0x83, 0xF3, 0x64, 0xD4, 0x45, 0xB5, 0x26, 0x96,
+        0x07, 0x77, 0xE7, 0x58, 0xC8, 0x39, 0xA9, 0x1A, 0x8A, 0xFA, 0x6B, 0xDB, 0x4C, 0xBC, 0x2D, 0x9D,
+    },
+    {
+        0xFF, 0xD0, 0xA1, 0x72, 0x43, 0x14, 0xE4, 0xB5, 0x86, 0x57, 0x28, 0xF8, 0xC9, 0x9A, 0x6B, 0x3C,
+        0x0D, 0xDD, 0xAE, 0x7F, 0x50, 0x21, 0xF1, 0xC2, 0x93, 0x64, 0x35, 0x06, 0xD6, 0xA7, 0x78, 0x49,
+    },
+    {
+        0xFF, 0xC2, 0x85, 0x48, 0x0B, 0xCD, 0x90, 0x53, 0x16, 0xD8, 0x9B, 0x5E, 0x21, 0xE3, 0xA6, 0x69,
+        0x2C, 0xEE, 0xB1, 0x74, 0x37, 0xF9, 0xBC, 0x7F, 0x42, 0x05, 0xC7, 0x8A, 0x4D, 0x10, 0xD2, 0x95,
+    },
+    {
+        0xFF, 0xAD, 0x5B, 0x09, 0xB6, 0x64, 0x12, 0xBF, 0x6D, 0x1B, 0xC8, 0x76, 0x24, 0xD1, 0x7F, 0x2D,
+        0xDA, 0x88, 0x36, 0xE3, 0x91, 0x3F, 0xEC, 0x9A, 0x48, 0xF5, 0xA3, 0x51, 0xFE, 0xAC, 0x5A, 0x08,
+    },
+    {
+        0xFF, 0xA8, 0x51, 0xF9, 0xA2, 0x4B, 0xF3, 0x9C, 0x45, 0xED, 0x96, 0x3F, 0xE7, 0x90, 0x39, 0xE1,
+        0x8A, 0x33, 0xDB, 0x84, 0x2D, 0xD5, 0x7E, 0x27, 0xCF, 0x78, 0x21, 0xC9, 0x72, 0x1B, 0xC3, 0x6C,
+    },
+    {
+        0xFF, 0x50, 0xA0, 0xF0, 0x41, 0x91, 0xE1, 0x32, 0x82, 0xD2, 0x23, 0x73, 0xC3, 0x14, 0x64, 0xB4,
+        0x05, 0x55, 0xA5, 0xF5, 0x46, 0x96, 0xE6, 0x37, 0x87, 0xD7, 0x28, 0x78, 0xC8, 0x19, 0x69, 0xB9,
+    },
+    {
+        0xFF, 0x75, 0xEA, 0x60, 0xD5, 0x4B, 0xC0, 0x36, 0xAB, 0x21, 0x96, 0x0C, 0x81, 0xF6, 0x6C, 0xE1,
+        0x57, 0xCC, 0x42, 0xB7, 0x2D, 0xA2, 0x18, 0x8D, 0x03, 0x78, 0xED, 0x63, 0xD8, 0x4E, 0xC3, 0x39,
+    },
+    {
+        0xFF, 0x84, 0x09, 0x8D, 0x12, 0x96, 0x1B, 0x9F, 0x24, 0xA8, 0x2D, 0xB1, 0x36, 0xBA, 0x3F, 0xC3,
+        0x48, 0xCC, 0x51, 0xD5, 0x5A, 0xDE, 0x63, 0xE7, 0x6C, 0xF0, 0x75, 0xF9, 0x7E, 0x03, 0x87, 0x0C,
+    },
+    {
+        0xFF, 0x48, 0x90, 0xD8, 0x21, 0x69, 0xB1, 0xF9, 0x42, 0x8A, 0xD2, 0x1B, 0x63, 0xAB, 0xF3, 0x3C,
+        0x84, 0xCC, 0x15, 0x5D, 0xA5, 0xED, 0x36, 0x7E, 0xC6, 0x0F, 0x57, 0x9F, 0xE7, 0x30, 0x78, 0xC0,
+    },
+    {
+        0xFF, 0xCA, 0x95, 0x60, 0x2B, 0xF5, 0xC0, 0x8B, 0x56, 0x21, 0xEB, 0xB6, 0x81, 0x4C, 0x17, 0xE1,
+        0xAC, 0x77, 0x42, 0x0D, 0xD7, 0xA2, 0x6D, 0x38, 0x03, 0xCD, 0x98, 0x63, 0x2E, 0xF8, 0xC3, 0x8E,
+    },
+    {
+        0xFF, 0xFC, 0xF9, 0xF6, 0xF3, 0xF0, 0xED, 0xEA, 0xE7, 0xE4, 0xE1, 0xDE, 0xDB, 0xD8, 0xD5, 0xD2,
+        0xCF, 0xCC, 0xC9, 0xC6, 0xC3, 0xC0, 0xBD, 0xBA, 0xB7, 0xB4, 0xB1, 0xAE, 0xAB, 0xA8, 0xA5, 0xA2,
+    },
+    {
+        0xFF, 0xDA, 0xB5, 0x90, 0x6B, 0x46, 0x21, 0xFB, 0xD6, 0xB1, 0x8C, 0x67, 0x42, 0x1D, 0xF7, 0xD2,
+        0xAD, 0x88, 0x63, 0x3E, 0x19, 0xF3, 0xCE, 0xA9, 0x84, 0x5F, 0x3A, 0x15, 0xEF, 0xCA, 0xA5, 0x80,
+    },
+    {
+        0xFF, 0x8A, 0x15, 0x9F, 0x2A, 0xB4, 0x3F, 0xC9, 0x54, 0xDE, 0x69, 0xF3, 0x7E, 0x09, 0x93, 0x1E,
+        0xA8, 0x33, 0xBD, 0x48, 0xD2, 0x5D, 0xE7, 0x72, 0xFC, 0x87, 0x12, 0x9C, 0x27, 0xB1, 0x3C, 0xC6,
+    },
+    {
+        0xFF, 0xD6, 0xAD, 0x84, 0x5B, 0x32, 0x09, 0xDF, 0xB6, 0x8D, 0x64, 0x3B, 0x12, 0xE8, 0xBF, 0x96,
+        0x6D, 0x44, 0x1B, 0xF1, 0xC8, 0x9F, 0x76, 0x4D, 0x24, 0xFA, 0xD1, 0xA8, 0x7F, 0x56, 0x2D, 0x04,
+    },
+    {
+        0xFF, 0x54, 0xA8, 0xFC, 0x51, 0xA5, 0xF9, 0x4E, 0xA2, 0xF6, 0x4B, 0x9F, 0xF3, 0x48, 0x9C, 0xF0,
+        0x45, 0x99, 0xED, 0x42, 0x96, 0xEA, 0x3F, 0x93, 0xE7, 0x3C, 0x90, 0xE4, 0x39, 0x8D, 0xE1, 0x36,
+    },
+    {
+        0xFF, 0x42, 0x84, 0xC6, 0x09, 0x4B, 0x8D, 0xCF, 0x12, 0x54, 0x96, 0xD8, 0x1B, 0x5D, 0x9F, 0xE1,
+        0x24, 0x66, 0xA8, 0xEA, 0x2D, 0x6F, 0xB1, 0xF3, 0x36, 0x78, 0xBA, 0xFC, 0x3F, 0x81, 0xC3, 0x06,
+    },
+    {
+        0xFF, 0x24, 0x48, 0x6C, 0x90, 0xB4, 0xD8, 0xFC, 0x21, 0x45, 0x69, 0x8D, 0xB1, 0xD5, 0xF9, 0x1E,
+        0x42, 0x66, 0x8A, 0xAE, 0xD2, 0xF6, 0x1B, 0x3F, 0x63, 0x87, 0xAB, 0xCF, 0xF3, 0x18, 0x3C, 0x60,
+    },
+    {
+        0xFF, 0xBF, 0x7F, 0x3F, 0xFE, 0xBE, 0x7E, 0x3E, 0xFD, 0xBD, 0x7D, 0x3D, 0xFC, 0xBC, 0x7C, 0x3C,
+        0xFB, 0xBB, 0x7B, 0x3B, 0xFA, 0xBA, 0x7A, 0x3A, 0xF9, 0xB9, 0x79, 0x39, 0xF8, 0xB8, 0x78, 0x38,
+    },
+    {
+        0xFF, 0x98, 0x31, 0xC9, 0x62, 0xFA, 0x93, 0x2C, 0xC4, 0x5D, 0xF5, 0x8E, 0x27, 0xBF, 0x58, 0xF0,
+        0x89, 0x22, 0xBA, 0x53, 0xEB, 0x84, 0x1D, 0xB5, 0x4E, 0xE6, 0x7F, 0x18, 0xB0, 0x49, 0xE1, 0x7A,
+    },
+    {
+        0xFF, 0x95, 0x2B, 0xC0, 0x56, 0xEB, 0x81, 0x17, 0xAC, 0x42, 0xD7, 0x6D, 0x03, 0x98, 0x2E, 0xC3,
+        0x59, 0xEE, 0x84, 0x1A, 0xAF, 0x45, 0xDA, 0x70, 0x06, 0x9B, 0x31, 0xC6, 0x5C, 0xF1, 0x87, 0x1D,
+    },
+    {
+        0xFF, 0xF9, 0xF3, 0xED, 0xE7, 0xE1, 0xDB, 0xD5, 0xCF, 0xC9, 0xC3, 0xBD, 0xB7, 0xB1, 0xAB, 0xA5,
+        0x9F, 0x99, 0x93, 0x8D, 0x87, 0x81, 0x7B, 0x75, 0x6F, 0x69, 0x63, 0x5D, 0x57, 0x51, 0x4B, 0x45,
+    },
+    {
+        0xFF, 0xE3, 0xC7, 0xAB, 0x8F, 0x73, 0x57, 0x3B, 0x1F, 0x03, 0xE6, 0xCA, 0xAE, 0x92, 0x76, 0x5A,
+        0x3E, 0x22, 0x06, 0xE9, 0xCD, 0xB1, 0x95, 0x79, 0x5D, 0x41, 0x25, 0x09, 0xEC, 0xD0, 0xB4, 0x98,
+    },
+    {
+        0xFF, 0x5E, 0xBC, 0x1B, 0x79, 0xD7, 0x36, 0x94, 0xF2, 0x51, 0xAF, 0x0E, 0x6C, 0xCA, 0x29, 0x87,
+        0xE5, 0x44, 0xA2, 0x01, 0x5F, 0xBD, 0x1C, 0x7A, 0xD8, 0x37, 0x95, 0xF3, 0x52, 0xB0, 0x0F, 0x6D,
+    },
+    {
+        0xFF, 0xB5, 0x6B, 0x21, 0xD6, 0x8C, 0x42, 0xF7, 0xAD, 0x63, 0x19, 0xCE, 0x84, 0x3A, 0xEF, 0xA5,
+        0x5B, 0x11, 0xC6, 0x7C, 0x32, 0xE7, 0x9D, 0x53, 0x09, 0xBE, 0x74, 0x2A, 0xDF, 0x95, 0x4B, 0x01,
+    },
+    {
+        0xFF, 0x15, 0x2A, 0x3F, 0x54, 0x69, 0x7E, 0x93, 0xA8, 0xBD, 0xD2, 0xE7, 0xFC, 0x12, 0x27, 0x3C,
+        0x51, 0x66, 0x7B, 0x90, 0xA5, 0xBA, 0xCF, 0xE4, 0xF9, 0x0F, 0x24, 0x39, 0x4E, 0x63, 0x78, 0x8D,
+    },
+    {
+        0xFF, 0x68, 0xD0, 0x39, 0xA1, 0x0A, 0x72, 0xDA, 0x43, 0xAB, 0x14, 0x7C, 0xE4, 0x4D, 0xB5, 0x1E,
+        0x86, 0xEE, 0x57, 0xBF, 0x28, 0x90, 0xF8, 0x61, 0xC9, 0x32, 0x9A, 0x03, 0x6B, 0xD3, 0x3C, 0xA4,
+    },
+    {
+        0xFF, 0x61, 0xC2, 0x24, 0x85, 0xE6, 0x48, 0xA9, 0x0B, 0x6C, 0xCD, 0x2F, 0x90, 0xF1, 0x53, 0xB4,
+        0x16, 0x77, 0xD8, 0x3A, 0x9B, 0xFC, 0x5E, 0xBF, 0x21, 0x82, 0xE3, 0x45, 0xA6, 0x08, 0x69, 0xCA,
+    },
+    {
+        0xFF, 0x28, 0x50, 0x78, 0xA0, 0xC8, 0xF0, 0x19, 0x41, 0x69, 0x91, 0xB9, 0xE1, 0x0A, 0x32, 0x5A,
+        0x82, 0xAA, 0xD2, 0xFA, 0x23, 0x4B, 0x73, 0x9B, 0xC3, 0xEB, 0x14, 0x3C, 0x64, 0x8C, 0xB4, 0xDC,
+    },
+    {
+        0xFF, 0xBA, 0x75, 0x30, 0xEA, 0xA5, 0x60, 0x1B, 0xD5, 0x90, 0x4B, 0x06, 0xC0, 0x7B, 0x36, 0xF0,
+        0xAB, 0x66, 0x21, 0xDB, 0x96, 0x51, 0x0C, 0xC6, 0x81, 0x3C, 0xF6, 0xB1, 0x6C, 0x27, 0xE1, 0x9C,
+    },
+    {
+        0xFF, 0xDF, 0xBF, 0x9F, 0x7F, 0x5F, 0x3F, 0x1F, 0xFE, 0xDE, 0xBE, 0x9E, 0x7E, 0x5E, 0x3E, 0x1E,
+        0xFD, 0xDD, 0xBD, 0x9D, 0x7D, 0x5D, 0x3D, 0x1D, 0xFC, 0xDC, 0xBC, 0x9C, 0x7C, 0x5C, 0x3C, 0x1C,
+    },
+    {
+        0xFF, 0x4C, 0x98, 0xE4, 0x31, 0x7D, 0xC9, 0x16, 0x62, 0xAE, 0xFA, 0x47, 0x93, 0xDF, 0x2C, 0x78,
+        0xC4, 0x11, 0x5D, 0xA9, 0xF5, 0x42, 0x8E, 0xDA, 0x27, 0x73, 0xBF, 0x0C, 0x58, 0xA4, 0xF0, 0x3D,
+    },
+    {
+        0xFF, 0xF1, 0xE3, 0xD5, 0xC7, 0xB9, 0xAB, 0x9D, 0x8F, 0x81, 0x73, 0x65, 0x57, 0x49, 0x3B, 0x2D,
+        0x1F, 0x11, 0x03, 0xF4, 0xE6, 0xD8, 0xCA, 0xBC, 0xAE, 0xA0, 0x92, 0x84, 0x76, 0x68, 0x5A, 0x4C,
+    },
+    {
+        0xFF, 0x2F, 0x5E, 0x8D, 0xBC, 0xEB, 0x1B, 0x4A, 0x79, 0xA8, 0xD7, 0x07, 0x36, 0x65, 0x94, 0xC3,
+        0xF2, 0x22, 0x51, 0x80, 0xAF, 0xDE, 0x0E, 0x3D, 0x6C, 0x9B, 0xCA, 0xF9, 0x29, 0x58, 0x87, 0xB6,
+    },
+    {
+        0xFF, 0x81, 0x03, 0x84, 0x06, 0x87, 0x09, 0x8A, 0x0C, 0x8D, 0x0F, 0x90, 0x12, 0x93, 0x15, 0x96,
+        0x18, 0x99, 0x1B, 0x9C, 0x1E, 0x9F, 0x21, 0xA2, 0x24, 0xA5, 0x27, 0xA8, 0x2A, 0xAB, 0x2D, 0xAE,
+    },
+    {
+        0xFF, 0xE6, 0xCD, 0xB4, 0x9B, 0x82, 0x69, 0x50, 0x37, 0x1E, 0x05, 0xEB, 0xD2, 0xB9, 0xA0, 0x87,
+        0x6E, 0x55, 0x3C, 0x23, 0x0A, 0xF0, 0xD7, 0xBE, 0xA5, 0x8C, 0x73, 0x5A, 0x41, 0x28, 0x0F, 0xF5,
+    },
+    {
+        0xFF, 0xB2, 0x65, 0x18, 0xCA, 0x7D, 0x30, 0xE2, 0x95, 0x48, 0xFA, 0xAD, 0x60, 0x13, 0xC5, 0x78,
+        0x2B, 0xDD, 0x90, 0x43, 0xF5, 0xA8, 0x5B, 0x0E, 0xC0, 0x73, 0x26, 0xD8, 0x8B, 0x3E, 0xF0, 0xA3,
+    },
+    {
+        0xFF, 0x3F, 0x7E, 0xBD, 0xFC, 0x3C, 0x7B, 0xBA, 0xF9, 0x39, 0x78, 0xB7, 0xF6, 0x36, 0x75, 0xB4,
+        0xF3, 0x33, 0x72, 0xB1, 0xF0, 0x30, 0x6F, 0xAE, 0xED, 0x2D, 0x6C, 0xAB, 0xEA, 0x2A, 0x69, 0xA8,
+    },
+    {
+        0xFF, 0x33, 0x66, 0x99, 0xCC, 0xFF, 0x33, 0x66, 0x99, 0xCC, 0xFF, 0x33, 0x66, 0x99, 0xCC, 0xFF,
+        0x33, 0x66, 0x99, 0xCC, 0xFF, 0x33, 0x66, 0x99, 0xCC, 0xFF, 0x33, 0x66, 0x99, 0xCC, 0xFF, 0x33,
+    },
+    {
+        0xFF, 0xEE, 0xDD, 0xCC, 0xBB, 0xAA, 0x99, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0xFF,
+        0xEE, 0xDD, 0xCC, 0xBB, 0xAA, 0x99, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0xFF, 0xEE,
+    },
+    {
+        0xFF, 0x36, 0x6C, 0xA2, 0xD8, 0x0F, 0x45, 0x7B, 0xB1, 0xE7, 0x1E, 0x54, 0x8A, 0xC0, 0xF6, 0x2D,
+        0x63, 0x99, 0xCF, 0x06, 0x3C, 0x72, 0xA8, 0xDE, 0x15, 0x4B, 0x81, 0xB7, 0xED, 0x24, 0x5A, 0x90,
+    },
+    {
+        0xFF, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0,
+        0x01, 0x11, 0x21, 0x31, 0x41, 0x51, 0x61, 0x71, 0x81, 0x91, 0xA1, 0xB1, 0xC1, 0xD1, 0xE1, 0xF1,
+    },
+    {
+        0xFF, 0x6E, 0xDC, 0x4B, 0xB9, 0x28, 0x96, 0x05, 0x73, 0xE1, 0x50, 0xBE, 0x2D, 0x9B, 0x0A, 0x78,
+        0xE6, 0x55, 0xC3, 0x32, 0xA0, 0x0F, 0x7D, 0xEB, 0x5A, 0xC8, 0x37, 0xA5, 0x14, 0x82, 0xF0, 0x5F,
+    },
+    {
+        0xFF, 0x18, 0x30, 0x48, 0x60, 0x78, 0x90, 0xA8, 0xC0, 0xD8, 0xF0, 0x09, 0x21, 0x39, 0x51, 0x69,
+        0x81, 0x99, 0xB1, 0xC9, 0xE1, 0xF9, 0x12, 0x2A, 0x42, 0x5A, 0x72, 0x8A, 0xA2, 0xBA, 0xD2, 0xEA,
+    },
+    {
+        0xFF, 0x46, 0x8C, 0xD2, 0x19, 0x5F, 0xA5, 0xEB, 0x32, 0x78, 0xBE, 0x05, 0x4B, 0x91, 0xD7, 0x1E,
+        0x64, 0xAA, 0xF0, 0x37, 0x7D, 0xC3, 0x0A, 0x50, 0x96, 0xDC, 0x23, 0x69, 0xAF, 0xF5, 0x3C, 0x82,
+    },
+    {
+        0xFF, 0xA6, 0x4D, 0xF3, 0x9A, 0x41, 0xE7, 0x8E, 0x35, 0xDB, 0x82, 0x29, 0xCF, 0x76, 0x1D, 0xC3,
+        0x6A, 0x11, 0xB7, 0x5E, 0x05, 0xAB, 0x52, 0xF8, 0x9F, 0x46, 0xEC, 0x93, 0x3A, 0xE0, 0x87, 0x2E,
+    },
+    {
+        0xFF, 0x22, 0x44, 0x66, 0x88, 0xAA, 0xCC, 0xEE, 0x11, 0x33, 0x55, 0x77, 0x99, 0xBB, 0xDD, 0xFF,
+        0x22, 0x44, 0x66, 0x88, 0xAA, 0xCC, 0xEE, 0x11, 0x33, 0x55, 0x77, 0x99, 0xBB, 0xDD, 0xFF, 0x22,
+    },
+    {
+        0xFF, 0x88, 0x11, 0x99, 0x22, 0xAA, 0x33, 0xBB, 0x44, 0xCC, 0x55, 0xDD, 0x66, 0xEE, 0x77, 0xFF,
+        0x88, 0x11, 0x99, 0x22, 0xAA, 0x33, 0xBB, 0x44, 0xCC, 0x55, 0xDD, 0x66, 0xEE, 0x77, 0xFF, 0x88,
+    },
+    {
+        0xFF, 0x13, 0x26, 0x39, 0x4C, 0x5F, 0x72, 0x85, 0x98, 0xAB, 0xBE, 0xD1, 0xE4, 0xF7, 0x0B, 0x1E,
+        0x31, 0x44, 0x57, 0x6A, 0x7D, 0x90, 0xA3, 0xB6, 0xC9, 0xDC, 0xEF, 0x03, 0x16, 0x29, 0x3C, 0x4F,
+    },
+    {
+        0xFF, 0xF7, 0xEF, 0xE7, 0xDF, 0xD7, 0xCF, 0xC7, 0xBF, 0xB7, 0xAF, 0xA7, 0x9F, 0x97, 0x8F, 0x87,
+        0x7F, 0x77, 0x6F, 0x67, 0x5F, 0x57, 0x4F, 0x47, 0x3F, 0x37, 0x2F, 0x27, 0x1F, 0x17, 0x0F, 0x07,
+    },
+    {
+        0xFF, 0x2D, 0x5A, 0x87, 0xB4, 0xE1, 0x0F, 0x3C, 0x69, 0x96, 0xC3, 0xF0, 0x1E, 0x4B, 0x78, 0xA5,
+        0xD2, 0xFF, 0x2D, 0x5A, 0x87, 0xB4, 0xE1, 0x0F, 0x3C, 0x69, 0x96, 0xC3, 0xF0, 0x1E, 0x4B, 0x78,
+    },
+    {
+        0xFF, 0xB8, 0x71, 0x2A, 0xE2, 0x9B, 0x54, 0x0D, 0xC5, 0x7E, 0x37, 0xEF, 0xA8, 0x61, 0x1A, 0xD2,
+        0x8B, 0x44, 0xFC, 0xB5, 0x6E, 0x27, 0xDF, 0x98, 0x51, 0x0A, 0xC2, 0x7B, 0x34, 0xEC, 0xA5, 0x5E,
+    },
+    {
+        0xFF, 0x0E, 0x1C, 0x2A, 0x38, 0x46, 0x54, 0x62, 0x70, 0x7E, 0x8C, 0x9A, 0xA8, 0xB6, 0xC4, 0xD2,
+        0xE0, 0xEE, 0xFC, 0x0B, 0x19, 0x27, 0x35, 0x43, 0x51, 0x5F, 0x6D, 0x7B, 0x89, 0x97, 0xA5, 0xB3,
+    },
+    {
+        0xFF, 0x3D, 0x7A, 0xB7, 0xF4, 0x32, 0x6F, 0xAC, 0xE9, 0x27, 0x64, 0xA1, 0xDE, 0x1C, 0x59, 0x96,
+        0xD3, 0x11, 0x4E, 0x8B, 0xC8, 0x06, 0x43, 0x80, 0xBD, 0xFA, 0x38, 0x75, 0xB2, 0xEF, 0x2D, 0x6A,
+    },
+    {
+        0xFF, 0xF5, 0xEB, 0xE1, 0xD7, 0xCD, 0xC3, 0xB9, 0xAF, 0xA5, 0x9B, 0x91, 0x87, 0x7D, 0x73, 0x69,
+        0x5F, 0x55, 0x4B, 0x41, 0x37, 0x2D, 0x23, 0x19, 0x0F, 0x05, 0xFA, 0xF0, 0xE6, 0xDC, 0xD2, 0xC8,
+    },
+    {
+        0xFF, 0xA4, 0x49, 0xED, 0x92, 0x37, 0xDB, 0x80, 0x25, 0xC9, 0x6E, 0x13, 0xB7, 0x5C, 0x01, 0xA5,
+        0x4A, 0xEE, 0x93, 0x38, 0xDC, 0x81, 0x26, 0xCA, 0x6F, 0x14, 0xB8, 0x5D, 0x02, 0xA6, 0x4B, 0xEF,
+    },
+    {
+        0xFF, 0x39, 0x72, 0xAB, 0xE4, 0x1E, 0x57, 0x90, 0xC9, 0x03, 0x3C, 0x75, 0xAE, 0xE7, 0x21, 0x5A,
+        0x93, 0xCC, 0x06, 0x3F, 0x78, 0xB1, 0xEA, 0x24, 0x5D, 0x96, 0xCF, 0x09, 0x42, 0x7B, 0xB4, 0xED,
+    },
+    {
+        0xFF, 0x3B, 0x76, 0xB1, 0xEC, 0x28, 0x63, 0x9E, 0xD9, 0x15, 0x50, 0x8B, 0xC6, 0x02, 0x3D, 0x78,
+        0xB3, 0xEE, 0x2A, 0x65, 0xA0, 0xDB, 0x17, 0x52, 0x8D, 0xC8, 0x04, 0x3F, 0x7A, 0xB5, 0xF0, 0x2C,
+    },
+    {
+        0xFF, 0x07, 0x0E, 0x15, 0x1C, 0x23, 0x2A, 0x31, 0x38, 0x3F, 0x46, 0x4D, 0x54, 0x5B, 0x62, 0x69,
+        0x70, 0x77, 0x7E, 0x85, 0x8C, 0x93, 0x9A, 0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9,
+    },
+    {
+        0xFF, 0x9E, 0x3D, 0xDB, 0x7A, 0x19, 0xB7, 0x56, 0xF4, 0x93, 0x32, 0xD0, 0x6F, 0x0E, 0xAC, 0x4B,
+        0xE9, 0x88, 0x27, 0xC5, 0x64, 0x03, 0xA1, 0x40, 0xDE, 0x7D, 0x1C, 0xBA, 0x59, 0xF7, 0x96, 0x35,
+    },
+    {
+        0xFF, 0x9C, 0x39, 0xD5, 0x72, 0x0F, 0xAB, 0x48, 0xE4, 0x81, 0x1E, 0xBA, 0x57, 0xF3, 0x90, 0x2D,
+        0xC9, 0x66, 0x03, 0x9F, 0x3C, 0xD8, 0x75, 0x12, 0xAE, 0x4B, 0xE7, 0x84, 0x21, 0xBD, 0x5A, 0xF6,
+    },
+    {
+        0xFF, 0x9D, 0x3B, 0xD8, 0x76, 0x14, 0xB1, 0x4F, 0xEC, 0x8A, 0x28, 0xC5, 0x63, 0x01, 0x9E, 0x3C,
+        0xD9, 0x77, 0x15, 0xB2, 0x50, 0xED, 0x8B, 0x29, 0xC6, 0x64, 0x02, 0x9F, 0x3D, 0xDA, 0x78, 0x16,
+    },
+    {
+        0xFF, 0x59, 0xB2, 0x0C, 0x65, 0xBE, 0x18, 0x71, 0xCA, 0x24, 0x7D, 0xD6, 0x30, 0x89, 0xE2, 0x3C,
+        0x95, 0xEE, 0x48, 0xA1, 0xFA, 0x54, 0xAD, 0x07, 0x60, 0xB9, 0x13, 0x6C, 0xC5, 0x1F, 0x78, 0xD1,
+    },
+    {
+        0xFF, 0x9F, 0x3F, 0xDE, 0x7E, 0x1E, 0xBD, 0x5D, 0xFC, 0x9C, 0x3C, 0xDB, 0x7B, 0x1B, 0xBA, 0x5A,
+        0xF9, 0x99, 0x39, 0xD8, 0x78, 0x18, 0xB7, 0x57, 0xF6, 0x96, 0x36, 0xD5, 0x75, 0x15, 0xB4, 0x54,
+    },
+    {
+        0xFF, 0x1B, 0x36, 0x51, 0x6C, 0x87, 0xA2, 0xBD, 0xD8, 0xF3, 0x0F, 0x2A, 0x45, 0x60, 0x7B, 0x96,
+        0xB1, 0xCC, 0xE7, 0x03, 0x1E, 0x39, 0x54, 0x6F, 0x8A, 0xA5, 0xC0, 0xDB, 0xF6, 0x12, 0x2D, 0x48,
+    },
+    {
+        0xFF, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78,
+        0x80, 0x88, 0x90, 0x98, 0xA0, 0xA8, 0xB0, 0xB8, 0xC0, 0xC8, 0xD0, 0xD8, 0xE0, 0xE8, 0xF0, 0xF8,
+    },
+    {
+        0xFF, 0x90, 0x21, 0xB1, 0x42, 0xD2, 0x63, 0xF3, 0x84, 0x15, 0xA5, 0x36, 0xC6, 0x57, 0xE7, 0x78,
+        0x09, 0x99, 0x2A, 0xBA, 0x4B, 0xDB, 0x6C, 0xFC, 0x8D, 0x1E, 0xAE, 0x3F, 0xCF, 0x60, 0xF0, 0x81,
+    },
+    {
+        0xFF, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F, 0x48, 0x51, 0x5A, 0x63, 0x6C, 0x75, 0x7E, 0x87,
+        0x90, 0x99, 0xA2, 0xAB, 0xB4, 0xBD, 0xC6, 0xCF, 0xD8, 0xE1, 0xEA, 0xF3, 0xFC, 0x06, 0x0F, 0x18,
+    },
+    {
+        0xFF, 0x7A, 0xF4, 0x6F, 0xE9, 0x64, 0xDE, 0x59, 0xD3, 0x4E, 0xC8, 0x43, 0xBD, 0x38, 0xB2, 0x2D,
+        0xA7, 0x22, 0x9C, 0x17, 0x91, 0x0C, 0x86, 0x01, 0x7B, 0xF5, 0x70, 0xEA, 0x65, 0xDF, 0x5A, 0xD4,
+    },
+    {
+        0xFF, 0x1C, 0x38, 0x54, 0x70, 0x8C, 0xA8, 0xC4, 0xE0, 0xFC, 0x19, 0x35, 0x51, 0x6D, 0x89, 0xA5,
+        0xC1, 0xDD, 0xF9, 0x16, 0x32, 0x4E, 0x6A, 0x86, 0xA2, 0xBE, 0xDA, 0xF6, 0x13, 0x2F, 0x4B, 0x67,
+    },
+    {
+        0xFF, 0xEA, 0xD5, 0xC0, 0xAB, 0x96, 0x81, 0x6C, 0x57, 0x42, 0x2D, 0x18, 0x03, 0xED, 0xD8, 0xC3,
+        0xAE, 0x99, 0x84, 0x6F, 0x5A, 0x45, 0x30, 0x1B, 0x06, 0xF0, 0xDB, 0xC6, 0xB1, 0x9C, 0x87, 0x72,
+    },
+    {
+        0xFF, 0xA0, 0x41, 0xE1, 0x82, 0x23, 0xC3, 0x64, 0x05, 0xA5, 0x46, 0xE6, 0x87, 0x28, 0xC8, 0x69,
+        0x0A, 0xAA, 0x4B, 0xEB, 0x8C, 0x2D, 0xCD, 0x6E, 0x0F, 0xAF, 0x50, 0xF0, 0x91, 0x32, 0xD2, 0x73,
+    },
+    {
+        0xFF, 0x71, 0xE2, 0x54, 0xC5, 0x37, 0xA8, 0x1A, 0x8B, 0xFC, 0x6E, 0xDF, 0x51, 0xC2, 0x34, 0xA5,
+        0x17, 0x88, 0xF9, 0x6B, 0xDC, 0x4E, 0xBF, 0x31, 0xA2, 0x14, 0x85, 0xF6, 0x68, 0xD9, 0x4B, 0xBC,
+    },
+    {
+        0xFF, 0x5A, 0xB4, 0x0F, 0x69, 0xC3, 0x1E, 0x78, 0xD2, 0x2D, 0x87, 0xE1, 0x3C, 0x96, 0xF0, 0x4B,
+        0xA5, 0xFF, 0x5A, 0xB4, 0x0F, 0x69, 0xC3, 0x1E, 0x78, 0xD2, 0x2D, 0x87, 0xE1, 0x3C, 0x96, 0xF0,
+    },
+    {
+        0xFF, 0xD1, 0xA3, 0x75, 0x47, 0x19, 0xEA, 0xBC, 0x8E, 0x60, 0x32, 0x04, 0xD5, 0xA7, 0x79, 0x4B,
+        0x1D, 0xEE, 0xC0, 0x92, 0x64, 0x36, 0x08, 0xD9, 0xAB, 0x7D, 0x4F, 0x21, 0xF2, 0xC4, 0x96, 0x68,
+    },
+    {
+        0xFF, 0x1D, 0x3A, 0x57, 0x74, 0x91, 0xAE, 0xCB, 0xE8, 0x06, 0x23, 0x40, 0x5D, 0x7A, 0x97, 0xB4,
+        0xD1, 0xEE, 0x0C, 0x29, 0x46, 0x63, 0x80, 0x9D, 0xBA, 0xD7, 0xF4, 0x12, 0x2F, 0x4C, 0x69, 0x86,
+    },
+    {
+        0xFF, 0xC3, 0x87, 0x4B, 0x0F, 0xD2, 0x96, 0x5A, 0x1E, 0xE1, 0xA5, 0x69, 0x2D, 0xF0, 0xB4, 0x78,
+        0x3C, 0xFF, 0xC3, 0x87, 0x4B, 0x0F, 0xD2, 0x96, 0x5A, 0x1E, 0xE1, 0xA5, 0x69, 0x2D, 0xF0, 0xB4,
+    },
+    {
+        0xFF, 0x7B, 0xF6, 0x72, 0xED, 0x69, 0xE4, 0x60, 0xDB, 0x57, 0xD2, 0x4E, 0xC9, 0x45, 0xC0, 0x3C,
+        0xB7, 0x33, 0xAE, 0x2A, 0xA5, 0x21, 0x9C, 0x18, 0x93, 0x0F, 0x8A, 0x06, 0x81, 0xFC, 0x78, 0xF3,
+    },
+    {
+        0xFF, 0xAE, 0x5D, 0x0C, 0xBA, 0x69, 0x18, 0xC6, 0x75, 0x24, 0xD2, 0x81, 0x30, 0xDE, 0x8D, 0x3C,
+        0xEA, 0x99, 0x48, 0xF6, 0xA5, 0x54, 0x03, 0xB1, 0x60, 0x0F, 0xBD, 0x6C, 0x1B, 0xC9, 0x78, 0x27,
+    },
+    {
+        0xFF, 0x0A, 0x14, 0x1E, 0x28, 0x32, 0x3C, 0x46, 0x50, 0x5A, 0x64, 0x6E, 0x78, 0x82, 0x8C, 0x96,
+        0xA0, 0xAA, 0xB4, 0xBE, 0xC8, 0xD2, 0xDC, 0xE6, 0xF0, 0xFA, 0x05, 0x0F, 0x19, 0x23, 0x2D, 0x37,
+    },
+    {
+        0xFF, 0xA9, 0x53, 0xFC, 0xA6, 0x50, 0xF9, 0xA3, 0x4D, 0xF6, 0xA0, 0x4A, 0xF3, 0x9D, 0x47, 0xF0,
+        0x9A, 0x44, 0xED, 0x97, 0x41, 0xEA, 0x94, 0x3E, 0xE7, 0x91, 0x3B, 0xE4, 0x8E, 0x38, 0xE1, 0x8B,
+    },
+    {
+        0xFF, 0x91, 0x23, 0xB4, 0x46, 0xD7, 0x69, 0xFA, 0x8C, 0x1E, 0xAF, 0x41, 0xD2, 0x64, 0xF5, 0x87,
+        0x19, 0xAA, 0x3C, 0xCD, 0x5F, 0xF0, 0x82, 0x14, 0xA5, 0x37, 0xC8, 0x5A, 0xEB, 0x7D, 0x0F, 0xA0,
+    },
+    {
+        0xFF, 0x51, 0xA2, 0xF3, 0x45, 0x96, 0xE7, 0x39, 0x8A, 0xDB, 0x2D, 0x7E, 0xCF, 0x21, 0x72, 0xC3,
+        0x15, 0x66, 0xB7, 0x09, 0x5A, 0xAB, 0xFC, 0x4E, 0x9F, 0xF0, 0x42, 0x93, 0xE4, 0x36, 0x87, 0xD8,
+    },
+    {
+        0xFF, 0x5B, 0xB6, 0x12, 0x6D, 0xC8, 0x24, 0x7F, 0xDA, 0x36, 0x91, 0xEC, 0x48, 0xA3, 0xFE, 0x5A,
+        0xB5, 0x11, 0x6C, 0xC7, 0x23, 0x7E, 0xD9, 0x35, 0x90, 0xEB, 0x47, 0xA2, 0xFD, 0x59, 0xB4, 0x10,
+    },
+    {
+        0xFF, 0x76, 0xEC, 0x63, 0xD9, 0x50, 0xC6, 0x3D, 0xB3, 0x2A, 0xA0, 0x17, 0x8D, 0x04, 0x7A, 0xF0,
+        0x67, 0xDD, 0x54, 0xCA, 0x41, 0xB7, 0x2E, 0xA4, 0x1B, 0x91, 0x08, 0x7E, 0xF4, 0x6B, 0xE1, 0x58,
+    },
+    {
+        0xFF, 0x72, 0xE4, 0x57, 0xC9, 0x3C, 0xAE, 0x21, 0x93, 0x06, 0x78, 0xEA, 0x5D, 0xCF, 0x42, 0xB4,
+        0x27, 0x99, 0x0C, 0x7E, 0xF0, 0x63, 0xD5, 0x48, 0xBA, 0x2D, 0x9F, 0x12, 0x84, 0xF6, 0x69, 0xDB,
+    },
+    {
+        0xFF, 0x85, 0x0B, 0x90, 0x16, 0x9B, 0x21, 0xA6, 0x2C, 0xB1, 0x37, 0xBC, 0x42, 0xC7, 0x4D, 0xD2,
+        0x58, 0xDD, 0x63, 0xE8, 0x6E, 0xF3, 0x79, 0xFE, 0x84, 0x0A, 0x8F, 0x15, 0x9A, 0x20, 0xA5, 0x2B,
+    },
+    {
+        0xFF, 0xA1, 0x43, 0xE4, 0x86, 0x28, 0xC9, 0x6B, 0x0D, 0xAE, 0x50, 0xF1, 0x93, 0x35, 0xD6, 0x78,
+        0x1A, 0xBB, 0x5D, 0xFE, 0xA0, 0x42, 0xE3, 0x85, 0x27, 0xC8, 0x6A, 0x0C, 0xAD, 0x4F, 0xF0, 0x92,
+    },
+    {
+        0xFF, 0x49, 0x92, 0xDB, 0x25, 0x6E, 0xB7, 0x01, 0x4A, 0x93, 0xDC, 0x26, 0x6F, 0xB8, 0x02, 0x4B,
+        0x94, 0xDD, 0x27, 0x70, 0xB9, 0x03, 0x4C, 0x95, 0xDE, 0x28, 0x71, 0xBA, 0x04, 0x4D, 0x96, 0xDF,
+    },
+    {
+        0xFF, 0xEB, 0xD7, 0xC3, 0xAF, 0x9B, 0x87, 0x73, 0x5F, 0x4B, 0x37, 0x23, 0x0F, 0xFA, 0xE6, 0xD2,
+        0xBE, 0xAA, 0x96, 0x82, 0x6E, 0x5A, 0x46, 0x32, 0x1E, 0x0A, 0xF5, 0xE1, 0xCD, 0xB9, 0xA5, 0x91,
+    },
+    {
+        0xFF, 0xCB, 0x97, 0x63, 0x2F, 0xFA, 0xC6, 0x92, 0x5E, 0x2A, 0xF5, 0xC1, 0x8D, 0x59, 0x25, 0xF0,
+        0xBC, 0x88, 0x54, 0x20, 0xEB, 0xB7, 0x83, 0x4F, 0x1B, 0xE6, 0xB2, 0x7E, 0x4A, 0x16, 0xE1, 0xAD,
+    },
+    {
+        0xFF, 0x7C, 0xF8, 0x75, 0xF1, 0x6E, 0xEA, 0x67, 0xE3, 0x60, 0xDC, 0x59, 0xD5, 0x52, 0xCE, 0x4B,
+        0xC7, 0x44, 0xC0, 0x3D, 0xB9, 0x36, 0xB2, 0x2F, 0xAB, 0x28, 0xA4, 0x21, 0x9D, 0x1A, 0x96, 0x13,
+    },
+    {
+        0xFF, 0xFD, 0xFB, 0xF9, 0xF7, 0xF5, 0xF3, 0xF1, 0xEF, 0xED, 0xEB, 0xE9, 0xE7, 0xE5, 0xE3, 0xE1,
+        0xDF, 0xDD, 0xDB, 0xD9, 0xD7, 0xD5, 0xD3, 0xD1, 0xCF, 0xCD, 0xCB, 0xC9, 0xC7, 0xC5, 0xC3, 0xC1,
+    },
+    {
+        0xFF, 0xC4, 0x89, 0x4E, 0x13, 0xD7, 0x9C, 0x61, 0x26, 0xEA, 0xAF, 0x74, 0x39, 0xFD, 0xC2, 0x87,
+        0x4C, 0x11, 0xD5, 0x9A, 0x5F, 0x24, 0xE8, 0xAD, 0x72, 0x37, 0xFB, 0xC0, 0x85, 0x4A, 0x0F, 0xD3,
+    },
+    {
+        0xFF, 0xDB, 0xB7, 0x93, 0x6F, 0x4B, 0x27, 0x03, 0xDE, 0xBA, 0x96, 0x72, 0x4E, 0x2A, 0x06, 0xE1,
+        0xBD, 0x99, 0x75, 0x51, 0x2D, 0x09, 0xE4, 0xC0, 0x9C, 0x78, 0x54, 0x30, 0x0C, 0xE7, 0xC3, 0x9F,
+    },
+    {
+        0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5, 0xC3,
+        0xE1, 0xFF, 0x1E, 0x3C, 0x5A, 0x78, 0x96, 0xB4, 0xD2, 0xF0, 0x0F, 0x2D, 0x4B, 0x69, 0x87, 0xA5,
+    },
+    {
+        0xFF, 0x8B, 0x17, 0xA2, 0x2E, 0xB9, 0x45, 0xD0, 0x5C, 0xE7, 0x73, 0xFE, 0x8A, 0x16, 0xA1, 0x2D,
+        0xB8, 0x44, 0xCF, 0x5B, 0xE6, 0x72, 0xFD, 0x89, 0x15, 0xA0, 0x2C, 0xB7, 0x43, 0xCE, 0x5A, 0xE5,
+    },
+    {
+        0xFF, 0xD2, 0xA5, 0x78, 0x4B, 0x1E, 0xF0, 0xC3, 0x96, 0x69, 0x3C, 0x0F, 0xE1, 0xB4, 0x87, 0x5A,
+        0x2D, 0xFF, 0xD2, 0xA5, 0x78, 0x4B, 0x1E, 0xF0, 0xC3, 0x96, 0x69, 0x3C, 0x0F, 0xE1, 0xB4, 0x87,
+    },
+    {
+        0xFF, 0xD7, 0xAF, 0x87, 0x5F, 0x37, 0x0F, 0xE6, 0xBE, 0x96, 0x6E, 0x46, 0x1E, 0xF5, 0xCD, 0xA5,
+        0x7D, 0x55, 0x2D, 0x05, 0xDC, 0xB4, 0x8C, 0x64, 0x3C, 0x14, 0xEB, 0xC3, 0x9B, 0x73, 0x4B, 0x23,
+    },
+    {
+        0xFF, 0x92, 0x25, 0xB7, 0x4A, 0xDC, 0x6F, 0x02, 0x94, 0x27, 0xB9, 0x4C, 0xDE, 0x71, 0x04, 0x96,
+        0x29, 0xBB, 0x4E, 0xE0, 0x73, 0x06, 0x98, 0x2B, 0xBD, 0x50, 0xE2, 0x75, 0x08, 0x9A, 0x2D, 0xBF,
+    },
+    {
+        0xFF, 0x55, 0xAA, 0xFF, 0x55, 0xAA, 0xFF, 0x55, 0xAA, 0xFF, 0x55, 0xAA, 0xFF, 0x55, 0xAA, 0xFF,
+        0x55, 0xAA, 0xFF, 0x55, 0xAA, 0xFF, 0x55, 0xAA, 0xFF, 0x55, 0xAA, 0xFF, 0x55, 0xAA, 0xFF, 0x55,
+    },
+    {
+        0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x55, 0xFF,
+        0xAA, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA,
+    },
+    {
+        0xFF, 0x43, 0x86, 0xC9, 0x0D, 0x50, 0x93, 0xD6, 0x1A, 0x5D, 0xA0, 0xE3, 0x27, 0x6A, 0xAD, 0xF0,
+        0x34, 0x77, 0xBA, 0xFD, 0x41, 0x84, 0xC7, 0x0B, 0x4E, 0x91, 0xD4, 0x18, 0x5B, 0x9E, 0xE1, 0x25,
+    },
+    {
+        0xFF, 0x0B, 0x16, 0x21, 0x2C, 0x37, 0x42, 0x4D, 0x58, 0x63, 0x6E, 0x79, 0x84, 0x8F, 0x9A, 0xA5,
+        0xB0, 0xBB, 0xC6, 0xD1, 0xDC, 0xE7, 0xF2, 0xFD, 0x09, 0x14, 0x1F, 0x2A, 0x35, 0x40, 0x4B, 0x56,
+    },
+    {
+        0xFF, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x08, 0x2D,
+        0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x10, 0x35, 0x5A, 0x7F,
+    },
+    {
+        0xFF, 0xAF, 0x5F, 0x0F, 0xBE, 0x6E, 0x1E, 0xCD, 0x7D, 0x2D, 0xDC, 0x8C, 0x3C, 0xEB, 0x9B, 0x4B,
+        0xFA, 0xAA, 0x5A, 0x0A, 0xB9, 0x69, 0x19, 0xC8, 0x78, 0x28, 0xD7, 0x87, 0x37, 0xE6, 0x96, 0x46,
+    },
+    {
+        0xFF, 0xC0, 0x81, 0x42, 0x03, 0xC3, 0x84, 0x45, 0x06, 0xC6, 0x87, 0x48, 0x09, 0xC9, 0x8A, 0x4B,
+        0x0C, 0xCC, 0x8D, 0x4E, 0x0F, 0xCF, 0x90, 0x51, 0x12, 0xD2, 0x93, 0x54, 0x15, 0xD5, 0x96, 0x57,
+    },
+    {
+        0xFF, 0x73, 0xE6, 0x5A, 0xCD, 0x41, 0xB4, 0x28, 0x9B, 0x0F, 0x82, 0xF5, 0x69, 0xDC, 0x50, 0xC3,
+        0x37, 0xAA, 0x1E, 0x91, 0x05, 0x78, 0xEB, 0x5F, 0xD2, 0x46, 0xB9, 0x2D, 0xA0, 0x14, 0x87, 0xFA,
+    },
+    {
+        0xFF, 0x99, 0x33, 0xCC, 0x66, 0xFF, 0x99, 0x33, 0xCC, 0x66, 0xFF, 0x99, 0x33, 0xCC, 0x66, 0xFF,
+        0x99, 0x33, 0xCC, 0x66, 0xFF, 0x99, 0x33, 0xCC, 0x66, 0xFF, 0x99, 0x33, 0xCC, 0x66, 0xFF, 0x99,
+    },
+    {
+        0xFF, 0x77, 0xEE, 0x66, 0xDD, 0x55, 0xCC, 0x44, 0xBB, 0x33, 0xAA, 0x22, 0x99, 0x11, 0x88, 0xFF,
+        0x77, 0xEE, 0x66, 0xDD, 0x55, 0xCC, 0x44, 0xBB, 0x33, 0xAA, 0x22, 0x99, 0x11, 0x88, 0xFF, 0x77,
+    },
+    {
+        0xFF, 0x96, 0x2D, 0xC3, 0x5A, 0xF0, 0x87, 0x1E, 0xB4, 0x4B, 0xE1, 0x78, 0x0F, 0xA5, 0x3C, 0xD2,
+        0x69, 0xFF, 0x96, 0x2D, 0xC3, 0x5A, 0xF0, 0x87, 0x1E, 0xB4, 0x4B, 0xE1, 0x78, 0x0F, 0xA5, 0x3C,
+    },
+    {
+        0xFF, 0x5C, 0xB8, 0x15, 0x71, 0xCD, 0x2A, 0x86, 0xE2, 0x3F, 0x9B, 0xF7, 0x54, 0xB0, 0x0D, 0x69,
+        0xC5, 0x22, 0x7E, 0xDA, 0x37, 0x93, 0xEF, 0x4C, 0xA8, 0x05, 0x61, 0xBD, 0x1A, 0x76, 0xD2, 0x2F,
+    },
+    {
+        0xFF, 0xFA, 0xF5, 0xF0, 0xEB, 0xE6, 0xE1, 0xDC, 0xD7, 0xD2, 0xCD, 0xC8, 0xC3, 0xBE, 0xB9, 0xB4,
+        0xAF, 0xAA, 0xA5, 0xA0, 0x9B, 0x96, 0x91, 0x8C, 0x87, 0x82, 0x7D, 0x78, 0x73, 0x6E, 0x69, 0x64,
+    },
+    {
+        0xFF, 0x52, 0xA4, 0xF6, 0x49, 0x9B, 0xED, 0x40, 0x92, 0xE4, 0x37, 0x89, 0xDB, 0x2E, 0x80, 0xD2,
+        0x25, 0x77, 0xC9, 0x1C, 0x6E, 0xC0, 0x13, 0x65, 0xB7, 0x0A, 0x5C, 0xAE, 0x01, 0x53, 0xA5, 0xF7,
+    },
+    {
+        0xFF, 0xE4, 0xC9, 0xAE, 0x93, 0x78, 0x5D, 0x42, 0x27, 0x0C, 0xF0, 0xD5, 0xBA, 0x9F, 0x84, 0x69,
+        0x4E, 0x33, 0x18, 0xFC, 0xE1, 0xC6, 0xAB, 0x90, 0x75, 0x5A, 0x3F, 0x24, 0x09, 0xED, 0xD2, 0xB7,
+    },
+    {
+        0xFF, 0xEC, 0xD9, 0xC6, 0xB3, 0xA0, 0x8D, 0x7A, 0x67, 0x54, 0x41, 0x2E, 0x1B, 0x08, 0xF4, 0xE1,
+        0xCE, 0xBB, 0xA8, 0x95, 0x82, 0x6F, 0x5C, 0x49, 0x36, 0x23, 0x10, 0xFC, 0xE9, 0xD6, 0xC3, 0xB0,
+    },
+    {
+        0xFF, 0x5F, 0xBE, 0x1E, 0x7D, 0xDC, 0x3C, 0x9B, 0xFA, 0x5A, 0xB9, 0x19, 0x78, 0xD7, 0x37, 0x96,
+        0xF5, 0x55, 0xB4, 0x14, 0x73, 0xD2, 0x32, 0x91, 0xF0, 0x50, 0xAF, 0x0F, 0x6E, 0xCD, 0x2D, 0x8C,
+    },
+    {
+        0xFF, 0x4A, 0x94, 0xDE, 0x29, 0x73, 0xBD, 0x08, 0x52, 0x9C, 0xE6, 0x31, 0x7B, 0xC5, 0x10, 0x5A,
+        0xA4, 0xEE, 0x39, 0x83, 0xCD, 0x18, 0x62, 0xAC, 0xF6, 0x41, 0x8B, 0xD5, 0x20, 0x6A, 0xB4, 0xFE,
+    },
+    {
+        0xFF, 0xB6, 0x6D, 0x24, 0xDA, 0x91, 0x48, 0xFE, 0xB5, 0x6C, 0x23, 0xD9, 0x90, 0x47, 0xFD, 0xB4,
+        0x6B, 0x22, 0xD8, 0x8F, 0x46, 0xFC, 0xB3, 0x6A, 0x21, 0xD7, 0x8E, 0x45, 0xFB, 0xB2, 0x69, 0x20,
+    },
+    {
+        0xFF, 0xA2, 0x45, 0xE7, 0x8A, 0x2D, 0xCF, 0x72, 0x15, 0xB7, 0x5A, 0xFC, 0x9F, 0x42, 0xE4, 0x87,
+        0x2A, 0xCC, 0x6F, 0x12, 0xB4, 0x57, 0xF9, 0x9C, 0x3F, 0xE1, 0x84, 0x27, 0xC9, 0x6C, 0x0F, 0xB1,
+    },
+    {
+        0xFF, 0x16, 0x2C, 0x42, 0x58, 0x6E, 0x84, 0x9A, 0xB0, 0xC6, 0xDC, 0xF2, 0x09, 0x1F, 0x35, 0x4B,
+        0x61, 0x77, 0x8D, 0xA3, 0xB9, 0xCF, 0xE5, 0xFB, 0x12, 0x28, 0x3E, 0x54, 0x6A, 0x80, 0x96, 0xAC,
+    },
+    {
+        0xFF, 0x86, 0x0D, 0x93, 0x1A, 0xA0, 0x27, 0xAD, 0x34, 0xBA, 0x41, 0xC7, 0x4E, 0xD4, 0x5B, 0xE1,
+        0x68, 0xEE, 0x75, 0xFB, 0x82, 0x09, 0x8F, 0x16, 0x9C, 0x23, 0xA9, 0x30, 0xB6, 0x3D, 0xC3, 0x4A,
+    },
+    {
+        0xFF, 0x69, 0xD2, 0x3C, 0xA5, 0x0F, 0x78, 0xE1, 0x4B, 0xB4, 0x1E, 0x87, 0xF0, 0x5A, 0xC3, 0x2D,
+        0x96, 0xFF, 0x69, 0xD2, 0x3C, 0xA5, 0x0F, 0x78, 0xE1, 0x4B, 0xB4, 0x1E, 0x87, 0xF0, 0x5A, 0xC3,
+    },
+    {
+        0xFF, 0xC5, 0x8B, 0x51, 0x17, 0xDC, 0xA2, 0x68, 0x2E, 0xF3, 0xB9, 0x7F, 0x45, 0x0B, 0xD0, 0x96,
+        0x5C, 0x22, 0xE7, 0xAD, 0x73, 0x39, 0xFE, 0xC4, 0x8A, 0x50, 0x16, 0xDB, 0xA1, 0x67, 0x2D, 0xF2,
+    },
+    {
+        0xFF, 0x62, 0xC4, 0x27, 0x89, 0xEB, 0x4E, 0xB0, 0x13, 0x75, 0xD7, 0x3A, 0x9C, 0xFE, 0x61, 0xC3,
+        0x26, 0x88, 0xEA, 0x4D, 0xAF, 0x12, 0x74, 0xD6, 0x39, 0x9B, 0xFD, 0x60, 0xC2, 0x25, 0x87, 0xE9,
+    },
+    {
+        0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xF9, 0xF8, 0xF7, 0xF6, 0xF5, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0,
+        0xEF, 0xEE, 0xED, 0xEC, 0xEB, 0xEA, 0xE9, 0xE8, 0xE7, 0xE6, 0xE5, 0xE4, 0xE3, 0xE2, 0xE1, 0xE0,
+    },
+    {
+        0xFF, 0x29, 0x52, 0x7B, 0xA4, 0xCD, 0xF6, 0x20, 0x49, 0x72, 0x9B, 0xC4, 0xED, 0x17, 0x40, 0x69,
+        0x92, 0xBB, 0xE4, 0x0E, 0x37, 0x60, 0x89, 0xB2, 0xDB, 0x05, 0x2E, 0x57, 0x80, 0xA9, 0xD2, 0xFB,
+    },
+    {
+        0xFF, 0x7D, 0xFA, 0x78, 0xF5, 0x73, 0xF0, 0x6E, 0xEB, 0x69, 0xE6, 0x64, 0xE1, 0x5F, 0xDC, 0x5A,
+        0xD7, 0x55, 0xD2, 0x50, 0xCD, 0x4B, 0xC8, 0x46, 0xC3, 0x41, 0xBE, 0x3C, 0xB9, 0x37, 0xB4, 0x32,
+    },
+    {
+        0xFF, 0xBB, 0x77, 0x33, 0xEE, 0xAA, 0x66, 0x22, 0xDD, 0x99, 0x55, 0x11, 0xCC, 0x88, 0x44, 0xFF,
+        0xBB, 0x77, 0x33, 0xEE, 0xAA, 0x66, 0x22, 0xDD, 0x99, 0x55, 0x11, 0xCC, 0x88, 0x44, 0xFF, 0xBB,
+    },
+    {
+        0xFF, 0xCC, 0x99, 0x66, 0x33, 0xFF, 0xCC, 0x99, 0x66, 0x33, 0xFF, 0xCC, 0x99, 0x66, 0x33, 0xFF,
+        0xCC, 0x99, 0x66, 0x33, 0xFF, 0xCC, 0x99, 0x66, 0x33, 0xFF, 0xCC, 0x99, 0x66, 0x33, 0xFF, 0xCC,
+    },
+    {
+        0xFF, 0xE0, 0xC1, 0xA2, 0x83, 0x64, 0x45, 0x26, 0x07, 0xE7, 0xC8, 0xA9, 0x8A, 0x6B, 0x4C, 0x2D,
+        0x0E, 0xEE, 0xCF, 0xB0, 0x91, 0x72, 0x53, 0x34, 0x15, 0xF5, 0xD6, 0xB7, 0x98, 0x79, 0x5A, 0x3B,
+    },
+    {
+        0xFF, 0xD3, 0xA7, 0x7B, 0x4F, 0x23, 0xF6, 0xCA, 0x9E, 0x72, 0x46, 0x1A, 0xED, 0xC1, 0x95, 0x69,
+        0x3D, 0x11, 0xE4, 0xB8, 0x8C, 0x60, 0x34, 0x08, 0xDB, 0xAF, 0x83, 0x57, 0x2B, 0xFE, 0xD2, 0xA6,
+    },
+    {
+        0xFF, 0x4D, 0x9A, 0xE7, 0x35, 0x82, 0xCF, 0x1D, 0x6A, 0xB7, 0x05, 0x52, 0x9F, 0xEC, 0x3A, 0x87,
+        0xD4, 0x22, 0x6F, 0xBC, 0x0A, 0x57, 0xA4, 0xF1, 0x3F, 0x8C, 0xD9, 0x27, 0x74, 0xC1, 0x0F, 0x5C,
+    },
+    {
+        0xFF, 0x8C, 0x19, 0xA5, 0x32, 0xBE, 0x4B, 0xD7, 0x64, 0xF0, 0x7D, 0x0A, 0x96, 0x23, 0xAF, 0x3C,
+        0xC8, 0x55, 0xE1, 0x6E, 0xFA, 0x87, 0x14, 0xA0, 0x2D, 0xB9, 0x46, 0xD2, 0x5F, 0xEB, 0x78, 0x05,
+    },
+    {
+        0xFF, 0xF2, 0xE5, 0xD8, 0xCB, 0xBE, 0xB1, 0xA4, 0x97, 0x8A, 0x7D, 0x70, 0x63, 0x56, 0x49, 0x3C,
+        0x2F, 0x22, 0x15, 0x08, 0xFA, 0xED, 0xE0, 0xD3, 0xC6, 0xB9, 0xAC, 0x9F, 0x92, 0x85, 0x78, 0x6B,
+    },
+    {
+        0xFF, 0x1F, 0x3E, 0x5D, 0x7C, 0x9B, 0xBA, 0xD9, 0xF8, 0x18, 0x37, 0x56, 0x75, 0x94, 0xB3, 0xD2,
+        0xF1, 0x11, 0x30, 0x4F, 0x6E, 0x8D, 0xAC, 0xCB, 0xEA, 0x0A, 0x29, 0x48, 0x67, 0x86, 0xA5, 0xC4,
+    },
+    {
+        0xFF, 0x30, 0x60, 0x90, 0xC0, 0xF0, 0x21, 0x51, 0x81, 0xB1, 0xE1, 0x12, 0x42, 0x72, 0xA2, 0xD2,
+        0x03, 0x33, 0x63, 0x93, 0xC3, 0xF3, 0x24, 0x54, 0x84, 0xB4, 0xE4, 0x15, 0x45, 0x75, 0xA5, 0xD5,
+    },
+    {
+        0xFF, 0xDC, 0xB9, 0x96, 0x73, 0x50, 0x2D, 0x0A, 0xE6, 0xC3, 0xA0, 0x7D, 0x5A, 0x37, 0x14, 0xF0,
+        0xCD, 0xAA, 0x87, 0x64, 0x41, 0x1E, 0xFA, 0xD7, 0xB4, 0x91, 0x6E, 0x4B, 0x28, 0x05, 0xE1, 0xBE,
+    },
+    {
+        0xFF, 0x82, 0x05, 0x87, 0x0A, 0x8C, 0x0F, 0x91, 0x14, 0x96, 0x19, 0x9B, 0x1E, 0xA0, 0x23, 0xA5,
+        0x28, 0xAA, 0x2D, 0xAF, 0x32, 0xB4, 0x37, 0xB9, 0x3C, 0xBE, 0x41, 0xC3, 0x46, 0xC8, 0x4B, 0xCD,
+    },
+    {
+        0xFF, 0xAB, 0x57, 0x03, 0xAE, 0x5A, 0x06, 0xB1, 0x5D, 0x09, 0xB4, 0x60, 0x0C, 0xB7, 0x63, 0x0F,
+        0xBA, 0x66, 0x12, 0xBD, 0x69, 0x15, 0xC0, 0x6C, 0x18, 0xC3, 0x6F, 0x1B, 0xC6, 0x72, 0x1E, 0xC9,
+    },
+    {
+        0xFF, 0xE7, 0xCF, 0xB7, 0x9F, 0x87, 0x6F, 0x57, 0x3F, 0x27, 0x0F, 0xF6, 0xDE, 0xC6, 0xAE, 0x96,
+        0x7E, 0x66, 0x4E, 0x36, 0x1E, 0x06, 0xED, 0xD5, 0xBD, 0xA5, 0x8D, 0x75, 0x5D, 0x45, 0x2D, 0x15,
+    },
+    {
+        0xFF, 0x56, 0xAC, 0x03, 0x59, 0xAF, 0x06, 0x5C, 0xB2, 0x09, 0x5F, 0xB5, 0x0C, 0x62, 0xB8, 0x0F,
+        0x65, 0xBB, 0x12, 0x68, 0xBE, 0x15, 0x6B, 0xC1, 0x18, 0x6E, 0xC4, 0x1B, 0x71, 0xC7, 0x1E, 0x74,
+    },
+    {
+        0xFF, 0xB3, 0x67, 0x1B, 0xCE, 0x82, 0x36, 0xE9, 0x9D, 0x51, 0x05, 0xB8, 0x6C, 0x20, 0xD3, 0x87,
+        0x3B, 0xEE, 0xA2, 0x56, 0x0A, 0xBD, 0x71, 0x25, 0xD8, 0x8C, 0x40, 0xF3, 0xA7, 0x5B, 0x0F, 0xC2,
+    },
+    {
+        0xFF, 0x93, 0x27, 0xBA, 0x4E, 0xE1, 0x75, 0x09, 0x9C, 0x30, 0xC3, 0x57, 0xEA, 0x7E, 0x12, 0xA5,
+        0x39, 0xCC, 0x60, 0xF3, 0x87, 0x1B, 0xAE, 0x42, 0xD5, 0x69, 0xFC, 0x90, 0x24, 0xB7, 0x4B, 0xDE,
+    },
+    {
+        0xFF, 0x40, 0x80, 0xC0, 0x01, 0x41, 0x81, 0xC1, 0x02, 0x42, 0x82, 0xC2, 0x03, 0x43, 0x83, 0xC3,
+        0x04, 0x44, 0x84, 0xC4, 0x05, 0x45, 0x85, 0xC5, 0x06, 0x46, 0x86, 0xC6, 0x07, 0x47, 0x87, 0xC7,
+    },
+    {
+        0xFF, 0xD8, 0xB1, 0x8A, 0x63, 0x3C, 0x15, 0xED, 0xC6, 0x9F, 0x78, 0x51, 0x2A, 0x03, 0xDB, 0xB4,
+        0x8D, 0x66, 0x3F, 0x18, 0xF0, 0xC9, 0xA2, 0x7B, 0x54, 0x2D, 0x06, 0xDE, 0xB7, 0x90, 0x69, 0x42,
+    },
+    {
+        0xFF, 0x34, 0x68, 0x9C, 0xD0, 0x05, 0x39, 0x6D, 0xA1, 0xD5, 0x0A, 0x3E, 0x72, 0xA6, 0xDA, 0x0F,
+        0x43, 0x77, 0xAB, 0xDF, 0x14, 0x48, 0x7C, 0xB0, 0xE4, 0x19, 0x4D, 0x81, 0xB5, 0xE9, 0x1E, 0x52,
+    },
+    {
+        0xFF, 0xB0, 0x61, 0x12, 0xC2, 0x73, 0x24, 0xD4, 0x85, 0x36, 0xE6, 0x97, 0x48, 0xF8, 0xA9, 0x5A,
+        0x0B, 0xBB, 0x6C, 0x1D, 0xCD, 0x7E, 0x2F, 0xDF, 0x90, 0x41, 0xF1, 0xA2, 0x53, 0x04, 0xB4, 0x65,
+    },
+    {
+        0xFF, 0xEF, 0xDF, 0xCF, 0xBF, 0xAF, 0x9F, 0x8F, 0x7F, 0x6F, 0x5F, 0x4F, 0x3F, 0x2F, 0x1F, 0x0F,
+        0xFE, 0xEE, 0xDE, 0xCE, 0xBE, 0xAE, 0x9E, 0x8E, 0x7E, 0x6E, 0x5E, 0x4E, 0x3E, 0x2E, 0x1E, 0x0E,
+    },
+    {
+        0xFF, 0x26, 0x4C, 0x72, 0x98, 0xBE, 0xE4, 0x0B, 0x31, 0x57, 0x7D, 0xA3, 0xC9, 0xEF, 0x16, 0x3C,
+        0x62, 0x88, 0xAE, 0xD4, 0xFA, 0x21, 0x47, 0x6D, 0x93, 0xB9, 0xDF, 0x06, 0x2C, 0x52, 0x78, 0x9E,
+    },
+    {
+        0xFF, 0x37, 0x6E, 0xA5, 0xDC, 0x14, 0x4B, 0x82, 0xB9, 0xF0, 0x28, 0x5F, 0x96, 0xCD, 0x05, 0x3C,
+        0x73, 0xAA, 0xE1, 0x19, 0x50, 0x87, 0xBE, 0xF5, 0x2D, 0x64, 0x9B, 0xD2, 0x0A, 0x41, 0x78, 0xAF,
+    },
+    {
+        0xFF, 0x0C, 0x18, 0x24, 0x30, 0x3C, 0x48, 0x54, 0x60, 0x6C, 0x78, 0x84, 0x90, 0x9C, 0xA8, 0xB4,
+        0xC0, 0xCC, 0xD8, 0xE4, 0xF0, 0xFC, 0x09, 0x15, 0x21, 0x2D, 0x39, 0x45, 0x51, 0x5D, 0x69, 0x75,
+    },
+    {
+        0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF,
+        0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x11,
+    },
+    {
+        0xFF, 0x44, 0x88, 0xCC, 0x11, 0x55, 0x99, 0xDD, 0x22, 0x66, 0xAA, 0xEE, 0x33, 0x77, 0xBB, 0xFF,
+        0x44, 0x88, 0xCC, 0x11, 0x55, 0x99, 0xDD, 0x22, 0x66, 0xAA, 0xEE, 0x33, 0x77, 0xBB, 0xFF, 0x44,
+    },
+    {
+        0xFF, 0x6F, 0xDE, 0x4E, 0xBD, 0x2D, 0x9C, 0x0C, 0x7B, 0xEA, 0x5A, 0xC9, 0x39, 0xA8, 0x18, 0x87,
+        0xF6, 0x66, 0xD5, 0x45, 0xB4, 0x24, 0x93, 0x03, 0x72, 0xE1, 0x51, 0xC0, 0x30, 0x9F, 0x0F, 0x7E,
+    },
+    {
+        0xFF, 0x78, 0xF0, 0x69, 0xE1, 0x5A, 0xD2, 0x4B, 0xC3, 0x3C, 0xB4, 0x2D, 0xA5, 0x1E, 0x96, 0x0F,
+        0x87, 0xFF, 0x78, 0xF0, 0x69, 0xE1, 0x5A, 0xD2, 0x4B, 0xC3, 0x3C, 0xB4, 0x2D, 0xA5, 0x1E, 0x96,
+    },
+    {
+        0xFF, 0x19, 0x32, 0x4B, 0x64, 0x7D, 0x96, 0xAF, 0xC8, 0xE1, 0xFA, 0x14, 0x2D, 0x46, 0x5F, 0x78,
+        0x91, 0xAA, 0xC3, 0xDC, 0xF5, 0x0F, 0x28, 0x41, 0x5A, 0x73, 0x8C, 0xA5, 0xBE, 0xD7, 0xF0, 0x0A,
+    },
+    {
+        0xFF, 0x9A, 0x35, 0xCF, 0x6A, 0x05, 0x9F, 0x3A, 0xD4, 0x6F, 0x0A, 0xA4, 0x3F, 0xD9, 0x74, 0x0F,
+        0xA9, 0x44, 0xDE, 0x79, 0x14, 0xAE, 0x49, 0xE3, 0x7E, 0x19, 0xB3, 0x4E, 0xE8, 0x83, 0x1E, 0xB8,
+    },
+    {
+        0xFF, 0x47, 0x8E, 0xD5, 0x1D, 0x64, 0xAB, 0xF2, 0x3A, 0x81, 0xC8, 0x10, 0x57, 0x9E, 0xE5, 0x2D,
+        0x74, 0xBB, 0x03, 0x4A, 0x91, 0xD8, 0x20, 0x67, 0xAE, 0xF5, 0x3D, 0x84, 0xCB, 0x13, 0x5A, 0xA1,
+    },
+    {
+        0xFF, 0x74, 0xE8, 0x5D, 0xD1, 0x46, 0xBA, 0x2F, 0xA3, 0x18, 0x8C, 0x01, 0x75, 0xE9, 0x5E, 0xD2,
+        0x47, 0xBB, 0x30, 0xA4, 0x19, 0x8D, 0x02, 0x76, 0xEA, 0x5F, 0xD3, 0x48, 0xBC, 0x31, 0xA5, 0x1A,
+    },
+    {
+        0xFF, 0xA7, 0x4F, 0xF6, 0x9E, 0x46, 0xED, 0x95, 0x3D, 0xE4, 0x8C, 0x34, 0xDB, 0x83, 0x2B, 0xD2,
+        0x7A, 0x22, 0xC9, 0x71, 0x19, 0xC0, 0x68, 0x10, 0xB7, 0x5F, 0x07, 0xAE, 0x56, 0xFD, 0xA5, 0x4D,
+    },
+    {
+        0xFF, 0xC1, 0x83, 0x45, 0x07, 0xC8, 0x8A, 0x4C, 0x0E, 0xCF, 0x91, 0x53, 0x15, 0xD6, 0x98, 0x5A,
+        0x1C, 0xDD, 0x9F, 0x61, 0x23, 0xE4, 0xA6, 0x68, 0x2A, 0xEB, 0xAD, 0x6F, 0x31, 0xF2, 0xB4, 0x76,
+    },
+    {
+        0xFF, 0x23, 0x46, 0x69, 0x8C, 0xAF, 0xD2, 0xF5, 0x19, 0x3C, 0x5F, 0x82, 0xA5, 0xC8, 0xEB, 0x0F,
+        0x32, 0x55, 0x78, 0x9B, 0xBE, 0xE1, 0x05, 0x28, 0x4B, 0x6E, 0x91, 0xB4, 0xD7, 0xFA, 0x1E, 0x41,
+    },
+    {
+        0xFF, 0x53, 0xA6, 0xF9, 0x4D, 0xA0, 0xF3, 0x47, 0x9A, 0xED, 0x41, 0x94, 0xE7, 0x3B, 0x8E, 0xE1,
+        0x35, 0x88, 0xDB, 0x2F, 0x82, 0xD5, 0x29, 0x7C, 0xCF, 0x23, 0x76, 0xC9, 0x1D, 0x70, 0xC3, 0x17,
+    },
+    {
+        0xFF, 0x89, 0x13, 0x9C, 0x26, 0xAF, 0x39, 0xC2, 0x4C, 0xD5, 0x5F, 0xE8, 0x72, 0xFB, 0x85, 0x0F,
+        0x98, 0x22, 0xAB, 0x35, 0xBE, 0x48, 0xD1, 0x5B, 0xE4, 0x6E, 0xF7, 0x81, 0x0B, 0x94, 0x1E, 0xA7,
+    },
+    {
+        0xFF, 0xFB, 0xF7, 0xF3, 0xEF, 0xEB, 0xE7, 0xE3, 0xDF, 0xDB, 0xD7, 0xD3, 0xCF, 0xCB, 0xC7, 0xC3,
+        0xBF, 0xBB, 0xB7, 0xB3, 0xAF, 0xAB, 0xA7, 0xA3, 0x9F, 0x9B, 0x97, 0x93, 0x8F, 0x8B, 0x87, 0x83,
+    },
+    {
+        0xFF, 0x14, 0x28, 0x3C, 0x50, 0x64, 0x78, 0x8C, 0xA0, 0xB4, 0xC8, 0xDC, 0xF0, 0x05, 0x19, 0x2D,
+        0x41, 0x55, 0x69, 0x7D, 0x91, 0xA5, 0xB9, 0xCD, 0xE1, 0xF5, 0x0A, 0x1E, 0x32, 0x46, 0x5A, 0x6E,
+    },
+    {
+        0xFF, 0x5D, 0xBA, 0x18, 0x75, 0xD2, 0x30, 0x8D, 0xEA, 0x48, 0xA5, 0x03, 0x60, 0xBD, 0x1B, 0x78,
+        0xD5, 0x33, 0x90, 0xED, 0x4B, 0xA8, 0x06, 0x63, 0xC0, 0x1E, 0x7B, 0xD8, 0x36, 0x93, 0xF0, 0x4E,
+    },
+    {
+        0xFF, 0xF8, 0xF1, 0xEA, 0xE3, 0xDC, 0xD5, 0xCE, 0xC7, 0xC0, 0xB9, 0xB2, 0xAB, 0xA4, 0x9D, 0x96,
+        0x8F, 0x88, 0x81, 0x7A, 0x73, 0x6C, 0x65, 0x5E, 0x57, 0x50, 0x49, 0x42, 0x3B, 0x34, 0x2D, 0x26,
+    },
+    {
+        0xFF, 0x97, 0x2F, 0xC6, 0x5E, 0xF5, 0x8D, 0x25, 0xBC, 0x54, 0xEB, 0x83, 0x1B, 0xB2, 0x4A, 0xE1,
+        0x79, 0x11, 0xA8, 0x40, 0xD7, 0x6F, 0x07, 0x9E, 0x36, 0xCD, 0x65, 0xFC, 0x94, 0x2C, 0xC3, 0x5B,
+    },
+    {
+        0xFF, 0x2E, 0x5C, 0x8A, 0xB8, 0xE6, 0x15, 0x43, 0x71, 0x9F, 0xCD, 0xFB, 0x2A, 0x58, 0x86, 0xB4,
+        0xE2, 0x11, 0x3F, 0x6D, 0x9B, 0xC9, 0xF7, 0x26, 0x54, 0x82, 0xB0, 0xDE, 0x0D, 0x3B, 0x69, 0x97,
+    },
+    {
+        0xFF, 0x4B, 0x96, 0xE1, 0x2D, 0x78, 0xC3, 0x0F, 0x5A, 0xA5, 0xF0, 0x3C, 0x87, 0xD2, 0x1E, 0x69,
+        0xB4, 0xFF, 0x4B, 0x96, 0xE1, 0x2D, 0x78, 0xC3, 0x0F, 0x5A, 0xA5, 0xF0, 0x3C, 0x87, 0xD2, 0x1E,
+    },
+    {
+        0xFF, 0xB9, 0x73, 0x2D, 0xE6, 0xA0, 0x5A, 0x14, 0xCD, 0x87, 0x41, 0xFA, 0xB4, 0x6E, 0x28, 0xE1,
+        0x9B, 0x55, 0x0F, 0xC8, 0x82, 0x3C, 0xF5, 0xAF, 0x69, 0x23, 0xDC, 0x96, 0x50, 0x0A, 0xC3, 0x7D,
+    },
+    {
+        0xFF, 0x60, 0xC0, 0x21, 0x81, 0xE1, 0x42, 0xA2, 0x03, 0x63, 0xC3, 0x24, 0x84, 0xE4, 0x45, 0xA5,
+        0x06, 0x66, 0xC6, 0x27, 0x87, 0xE7, 0x48, 0xA8, 0x09, 0x69, 0xC9, 0x2A, 0x8A, 0xEA, 0x4B, 0xAB,
+    },
+    {
+        0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1,
+        0xF0, 0xFF, 0x0F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78, 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2,
+    },
+    {
+        0xFF, 0xED, 0xDB, 0xC9, 0xB7, 0xA5, 0x93, 0x81, 0x6F, 0x5D, 0x4B, 0x39, 0x27, 0x15, 0x03, 0xF0,
+        0xDE, 0xCC, 0xBA, 0xA8, 0x96, 0x84, 0x72, 0x60, 0x4E, 0x3C, 0x2A, 0x18, 0x06, 0xF3, 0xE1, 0xCF,
+    },
+    {
+        0xFF, 0x3E, 0x7C, 0xBA, 0xF8, 0x37, 0x75, 0xB3, 0xF1, 0x30, 0x6E, 0xAC, 0xEA, 0x29, 0x67, 0xA5,
+        0xE3, 0x22, 0x60, 0x9E, 0xDC, 0x1B, 0x59, 0x97, 0xD5, 0x14, 0x52, 0x90, 0xCE, 0x0D, 0x4B, 0x89,
+    },
+    {
+        0xFF, 0xE5, 0xCB, 0xB1, 0x97, 0x7D, 0x63, 0x49, 0x2F, 0x15, 0xFA, 0xE0, 0xC6, 0xAC, 0x92, 0x78,
+        0x5E, 0x44, 0x2A, 0x10, 0xF5, 0xDB, 0xC1, 0xA7, 0x8D, 0x73, 0x59, 0x3F, 0x25, 0x0B, 0xF0, 0xD6,
+    },
+    {
+        0xFF, 0xF6, 0xED, 0xE4, 0xDB, 0xD2, 0xC9, 0xC0, 0xB7, 0xAE, 0xA5, 0x9C, 0x93, 0x8A, 0x81, 0x78,
+        0x6F, 0x66, 0x5D, 0x54, 0x4B, 0x42, 0x39, 0x30, 0x27, 0x1E, 0x15, 0x0C, 0x03, 0xF9, 0xF0, 0xE7,
+    },
+    {
+        0xFF, 0x87, 0x0F, 0x96, 0x1E, 0xA5, 0x2D, 0xB4, 0x3C, 0xC3, 0x4B, 0xD2, 0x5A, 0xE1, 0x69, 0xF0,
+        0x78, 0xFF, 0x87, 0x0F, 0x96, 0x1E, 0xA5, 0x2D, 0xB4, 0x3C, 0xC3, 0x4B, 0xD2, 0x5A, 0xE1, 0x69,
+    },
+    {
+        0xFF, 0xA5, 0x4B, 0xF0, 0x96, 0x3C, 0xE1, 0x87, 0x2D, 0xD2, 0x78, 0x1E, 0xC3, 0x69, 0x0F, 0xB4,
+        0x5A, 0xFF, 0xA5, 0x4B, 0xF0, 0x96, 0x3C, 0xE1, 0x87, 0x2D, 0xD2, 0x78, 0x1E, 0xC3, 0x69, 0x0F,
+    },
+    {
+        0xFF, 0x17, 0x2E, 0x45, 0x5C, 0x73, 0x8A, 0xA1, 0xB8, 0xCF, 0xE6, 0xFD, 0x15, 0x2C, 0x43, 0x5A,
+        0x71, 0x88, 0x9F, 0xB6, 0xCD, 0xE4, 0xFB, 0x13, 0x2A, 0x41, 0x58, 0x6F, 0x86, 0x9D, 0xB4, 0xCB,
+    },
+    {
+        0xFF, 0x3A, 0x74, 0xAE, 0xE8, 0x23, 0x5D, 0x97, 0xD1, 0x0C, 0x46, 0x80, 0xBA, 0xF4, 0x2F, 0x69,
+        0xA3, 0xDD, 0x18, 0x52, 0x8C, 0xC6, 0x01, 0x3B, 0x75, 0xAF, 0xE9, 0x24, 0x5E, 0x98, 0xD2, 0x0D,
+    },
+    {
+        0xFF, 0xA3, 0x47, 0xEA, 0x8E, 0x32, 0xD5, 0x79, 0x1D, 0xC0, 0x64, 0x08, 0xAB, 0x4F, 0xF2, 0x96,
+        0x3A, 0xDD, 0x81, 0x25, 0xC8, 0x6C, 0x10, 0xB3, 0x57, 0xFA, 0x9E, 0x42, 0xE5, 0x89, 0x2D, 0xD0,
+    },
+    {
+        0xFF, 0x3C, 0x78, 0xB4, 0xF0, 0x2D, 0x69, 0xA5, 0xE1, 0x1E, 0x5A, 0x96, 0xD2, 0x0F, 0x4B, 0x87,
+        0xC3, 0xFF, 0x3C, 0x78, 0xB4, 0xF0, 0x2D, 0x69, 0xA5, 0xE1, 0x1E, 0x5A, 0x96, 0xD2, 0x0F, 0x4B,
+    },
+    {
+        0xFF, 0xB7, 0x6F, 0x27, 0xDE, 0x96, 0x4E, 0x06, 0xBD, 0x75, 0x2D, 0xE4, 0x9C, 0x54, 0x0C, 0xC3,
+        0x7B, 0x33, 0xEA, 0xA2, 0x5A, 0x12, 0xC9, 0x81, 0x39, 0xF0, 0xA8, 0x60, 0x18, 0xCF, 0x87, 0x3F,
+    },
+};
+
+const field_logarithm_t *const correct_rs_ccsds_element_exp[256] = {
+    ccsds_element_exp_rows[0],
+    ccsds_element_exp_rows[1],
+    ccsds_element_exp_rows[2],
+    ccsds_element_exp_rows[3],
+    ccsds_element_exp_rows[4],
+    ccsds_element_exp_rows[5],
+    ccsds_element_exp_rows[6],
+    ccsds_element_exp_rows[7],
+    ccsds_element_exp_rows[8],
+    ccsds_element_exp_rows[9],
+    ccsds_element_exp_rows[10],
+    ccsds_element_exp_rows[11],
+    ccsds_element_exp_rows[12],
+    ccsds_element_exp_rows[13],
+    ccsds_element_exp_rows[14],
+    ccsds_element_exp_rows[15],
+    ccsds_element_exp_rows[16],
+    ccsds_element_exp_rows[17],
+    ccsds_element_exp_rows[18],
+    ccsds_element_exp_rows[19],
+    ccsds_element_exp_rows[20],
+    ccsds_element_exp_rows[21],
+    ccsds_element_exp_rows[22],
+    ccsds_element_exp_rows[23],
+    ccsds_element_exp_rows[24],
+    ccsds_element_exp_rows[25],
+    ccsds_element_exp_rows[26],
+    ccsds_element_exp_rows[27],
+    ccsds_element_exp_rows[28],
+    ccsds_element_exp_rows[29],
+    ccsds_element_exp_rows[30],
+    ccsds_element_exp_rows[31],
+    ccsds_element_exp_rows[32],
+    ccsds_element_exp_rows[33],
+    ccsds_element_exp_rows[34],
+    ccsds_element_exp_rows[35],
+    ccsds_element_exp_rows[36],
+    ccsds_element_exp_rows[37],
+    ccsds_element_exp_rows[38],
+    ccsds_element_exp_rows[39],
+    ccsds_element_exp_rows[40],
+    ccsds_element_exp_rows[41],
+    ccsds_element_exp_rows[42],
+    ccsds_element_exp_rows[43],
+    ccsds_element_exp_rows[44],
+    ccsds_element_exp_rows[45],
+    ccsds_element_exp_rows[46],
+    ccsds_element_exp_rows[47],
+    ccsds_element_exp_rows[48],
+    ccsds_element_exp_rows[49],
+    ccsds_element_exp_rows[50],
+    ccsds_element_exp_rows[51],
+    ccsds_element_exp_rows[52],
+    ccsds_element_exp_rows[53],
+    ccsds_element_exp_rows[54],
+    ccsds_element_exp_rows[55],
+    ccsds_element_exp_rows[56],
+    ccsds_element_exp_rows[57],
+    ccsds_element_exp_rows[58],
+    ccsds_element_exp_rows[59],
+    ccsds_element_exp_rows[60],
+    ccsds_element_exp_rows[61],
+    ccsds_element_exp_rows[62],
+    ccsds_element_exp_rows[63],
+    ccsds_element_exp_rows[64],
+    ccsds_element_exp_rows[65],
+    ccsds_element_exp_rows[66],
+    ccsds_element_exp_rows[67],
+    ccsds_element_exp_rows[68],
+    ccsds_element_exp_rows[69],
+    ccsds_element_exp_rows[70],
+    ccsds_element_exp_rows[71],
+    ccsds_element_exp_rows[72],
+    ccsds_element_exp_rows[73],
+    ccsds_element_exp_rows[74],
+    ccsds_element_exp_rows[75],
+    ccsds_element_exp_rows[76],
+    ccsds_element_exp_rows[77],
+    ccsds_element_exp_rows[78],
+    ccsds_element_exp_rows[79],
+    ccsds_element_exp_rows[80],
+    ccsds_element_exp_rows[81],
+    ccsds_element_exp_rows[82],
+    ccsds_element_exp_rows[83],
+    ccsds_element_exp_rows[84],
+    ccsds_element_exp_rows[85],
+    ccsds_element_exp_rows[86],
+    ccsds_element_exp_rows[87],
+    ccsds_element_exp_rows[88],
+    ccsds_element_exp_rows[89],
+    ccsds_element_exp_rows[90],
+    ccsds_element_exp_rows[91],
+    ccsds_element_exp_rows[92],
+    ccsds_element_exp_rows[93],
+    ccsds_element_exp_rows[94],
+    ccsds_element_exp_rows[95],
+    ccsds_element_exp_rows[96],
+    ccsds_element_exp_rows[97],
+    ccsds_element_exp_rows[98],
+    ccsds_element_exp_rows[99],
+    ccsds_element_exp_rows[100],
+    ccsds_element_exp_rows[101],
+    ccsds_element_exp_rows[102],
+    ccsds_element_exp_rows[103],
+    ccsds_element_exp_rows[104],
+    ccsds_element_exp_rows[105],
+    ccsds_element_exp_rows[106],
+    ccsds_element_exp_rows[107],
+    ccsds_element_exp_rows[108],
+    ccsds_element_exp_rows[109],
+    ccsds_element_exp_rows[110],
+    ccsds_element_exp_rows[111],
+    ccsds_element_exp_rows[112],
+    ccsds_element_exp_rows[113],
+    ccsds_element_exp_rows[114],
+    ccsds_element_exp_rows[115],
+    ccsds_element_exp_rows[116],
+    ccsds_element_exp_rows[117],
+    ccsds_element_exp_rows[118],
+    ccsds_element_exp_rows[119],
+    ccsds_element_exp_rows[120],
+    ccsds_element_exp_rows[121],
+    ccsds_element_exp_rows[122],
+    ccsds_element_exp_rows[123],
+    ccsds_element_exp_rows[124],
+    ccsds_element_exp_rows[125],
+    ccsds_element_exp_rows[126],
+    ccsds_element_exp_rows[127],
+    ccsds_element_exp_rows[128],
+    ccsds_element_exp_rows[129],
+    ccsds_element_exp_rows[130],
+    ccsds_element_exp_rows[131],
+    ccsds_element_exp_rows[132],
+    ccsds_element_exp_rows[133],
+    ccsds_element_exp_rows[134],
+    ccsds_element_exp_rows[135],
+    ccsds_element_exp_rows[136],
+    ccsds_element_exp_rows[137],
+    ccsds_element_exp_rows[138],
+    ccsds_element_exp_rows[139],
+    ccsds_element_exp_rows[140],
+    ccsds_element_exp_rows[141],
+    ccsds_element_exp_rows[142],
+    ccsds_element_exp_rows[143],
+    ccsds_element_exp_rows[144],
+    ccsds_element_exp_rows[145],
+    ccsds_element_exp_rows[146],
+    ccsds_element_exp_rows[147],
+    ccsds_element_exp_rows[148],
+    ccsds_element_exp_rows[149],
+    ccsds_element_exp_rows[150],
+    ccsds_element_exp_rows[151],
+    ccsds_element_exp_rows[152],
+    ccsds_element_exp_rows[153],
+    ccsds_element_exp_rows[154],
+    ccsds_element_exp_rows[155],
+    ccsds_element_exp_rows[156],
+    ccsds_element_exp_rows[157],
+    ccsds_element_exp_rows[158],
+    ccsds_element_exp_rows[159],
+    ccsds_element_exp_rows[160],
+    ccsds_element_exp_rows[161],
+    ccsds_element_exp_rows[162],
+    ccsds_element_exp_rows[163],
+    ccsds_element_exp_rows[164],
+    ccsds_element_exp_rows[165],
+    ccsds_element_exp_rows[166],
+    ccsds_element_exp_rows[167],
+    ccsds_element_exp_rows[168],
+    ccsds_element_exp_rows[169],
+    ccsds_element_exp_rows[170],
+    ccsds_element_exp_rows[171],
+    ccsds_element_exp_rows[172],
+    ccsds_element_exp_rows[173],
+    ccsds_element_exp_rows[174],
+    ccsds_element_exp_rows[175],
+    ccsds_element_exp_rows[176],
+    ccsds_element_exp_rows[177],
+    ccsds_element_exp_rows[178],
+    ccsds_element_exp_rows[179],
+    ccsds_element_exp_rows[180],
+    ccsds_element_exp_rows[181],
+    ccsds_element_exp_rows[182],
+    ccsds_element_exp_rows[183],
+    ccsds_element_exp_rows[184],
+    ccsds_element_exp_rows[185],
+    ccsds_element_exp_rows[186],
+    ccsds_element_exp_rows[187],
+    ccsds_element_exp_rows[188],
+    ccsds_element_exp_rows[189],
+    ccsds_element_exp_rows[190],
+    ccsds_element_exp_rows[191],
+    ccsds_element_exp_rows[192],
+    ccsds_element_exp_rows[193],
+    ccsds_element_exp_rows[194],
+    ccsds_element_exp_rows[195],
+    ccsds_element_exp_rows[196],
+    ccsds_element_exp_rows[197],
+    ccsds_element_exp_rows[198],
+    ccsds_element_exp_rows[199],
+    ccsds_element_exp_rows[200],
+    ccsds_element_exp_rows[201],
+    ccsds_element_exp_rows[202],
+    ccsds_element_exp_rows[203],
+    ccsds_element_exp_rows[204],
+    ccsds_element_exp_rows[205],
+    ccsds_element_exp_rows[206],
+    ccsds_element_exp_rows[207],
+    ccsds_element_exp_rows[208],
+    ccsds_element_exp_rows[209],
+    ccsds_element_exp_rows[210],
+    ccsds_element_exp_rows[211],
+    ccsds_element_exp_rows[212],
+    ccsds_element_exp_rows[213],
+    ccsds_element_exp_rows[214],
+    ccsds_element_exp_rows[215],
+    ccsds_element_exp_rows[216],
+    ccsds_element_exp_rows[217],
+    ccsds_element_exp_rows[218],
+    ccsds_element_exp_rows[219],
+    ccsds_element_exp_rows[220],
+    ccsds_element_exp_rows[221],
+    ccsds_element_exp_rows[222],
+    ccsds_element_exp_rows[223],
+    ccsds_element_exp_rows[224],
+    ccsds_element_exp_rows[225],
+    ccsds_element_exp_rows[226],
+    ccsds_element_exp_rows[227],
+    ccsds_element_exp_rows[228],
+    ccsds_element_exp_rows[229],
+    ccsds_element_exp_rows[230],
+    ccsds_element_exp_rows[231],
+    ccsds_element_exp_rows[232],
+    ccsds_element_exp_rows[233],
+    ccsds_element_exp_rows[234],
+    ccsds_element_exp_rows[235],
+    ccsds_element_exp_rows[236],
+    ccsds_element_exp_rows[237],
+    ccsds_element_exp_rows[238],
+    ccsds_element_exp_rows[239],
+    ccsds_element_exp_rows[240],
+    ccsds_element_exp_rows[241],
+    ccsds_element_exp_rows[242],
+    ccsds_element_exp_rows[243],
+    ccsds_element_exp_rows[244],
+    ccsds_element_exp_rows[245],
+    ccsds_element_exp_rows[246],
+    ccsds_element_exp_rows[247],
+    ccsds_element_exp_rows[248],
+    ccsds_element_exp_rows[249],
+    ccsds_element_exp_rows[250],
+    ccsds_element_exp_rows[251],
+    ccsds_element_exp_rows[252],
+    ccsds_element_exp_rows[253],
+    ccsds_element_exp_rows[254],
+    ccsds_element_exp_rows[255],
+};
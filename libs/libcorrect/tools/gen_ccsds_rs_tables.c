@@ -0,0 +1,78 @@
+#include "correct/reed-solomon.h"
+#include "correct/reed-solomon/ccsds.h"
+#include "correct/reed-solomon/decode.h"
+
+// prints source/reed-solomon/tables_ccsds.c
+// the tables are read straight out of a codec built the usual way, so they match
+//   correct_reed_solomon_create and correct_reed_solomon_decoder_create exactly
+//
+// build it from libs/libcorrect with every library source except reed-solomon_ccsds.c,
+//   decode_ccsds.c and tables_ccsds.c, plus any sysMalloc, e.g.
+//   cd source/reed-solomon && cc -I../../include ../../tools/gen_ccsds_rs_tables.c reed-solomon.c encode.c
+//     encode_ccsds.c decode.c polynomial.c ../../../../test/mocks/mock_heap.c && ./a.out > tables_ccsds.c
+
+#define VALUES_PER_LINE 16
+
+static void print_values(const uint8_t *values, size_t length, const char *indent) {
+    for (size_t i = 0; i < length; i++) {
+        if (i % VALUES_PER_LINE == 0) {
+            printf("%s", indent);
+        }
+        printf("0x%02X,", values[i]);
+        putchar((i % VALUES_PER_LINE == VALUES_PER_LINE - 1 || i == length - 1) ? '\n' : ' ');
+    }
+}
+
+static void print_table(const char *declaration, const uint8_t *values, size_t length) {
+    printf("\n%s = {\n", declaration);
+    print_values(values, length, "    ");
+    printf("};\n");
+}
+
+static void print_rows(const char *rows_name, const char *table_declaration, const field_logarithm_t *const *rows,
+                       size_t num_rows, size_t row_length) {
+    printf("\nstatic const field_logarithm_t %s[%zu][%zu] = {\n", rows_name, num_rows, row_length);
+    for (size_t r = 0; r < num_rows; r++) {
+        printf("    {\n");
+        print_values(rows[r], row_length, "        ");
+        printf("    },\n");
+    }
+    printf("};\n");
+
+    printf("\n%s = {\n", table_declaration);
+    for (size_t r = 0; r < num_rows; r++) {
+        printf("    %s[%zu],\n", rows_name, r);
+    }
+    printf("};\n");
+}
+
+int main() {
+    correct_reed_solomon *rs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1,
+                                                           CCSDS_RS_ROOTS);
+    correct_reed_solomon_decoder_create(rs);
+
+    printf("#include \"correct/reed-solomon/ccsds.h\"\n\n");
+    printf("// generated by tools/gen_ccsds_rs_tables.c, do not edit\n");
+    printf("//\n");
+    printf("// these are the tables correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32)\n");
+    printf("//   and correct_reed_solomon_decoder_create would otherwise build on the heap\n");
+
+    print_table("const field_element_t correct_rs_ccsds_exp[512]", rs->field.exp, 512);
+    print_table("const field_logarithm_t correct_rs_ccsds_log[256]", rs->field.log, 256);
+    print_table("const field_element_t correct_rs_ccsds_generator[CCSDS_RS_ROOTS + 1]", rs->generator.coeff,
+                CCSDS_RS_ROOTS + 1);
+    print_table("const field_element_t correct_rs_ccsds_generator_roots[CCSDS_RS_ROOTS]", rs->generator_roots,
+                CCSDS_RS_ROOTS);
+
+    // powers 0 to 254 of every generator root, used to find the syndromes
+    print_rows("ccsds_generator_root_exp_rows",
+               "const field_logarithm_t *const correct_rs_ccsds_generator_root_exp[CCSDS_RS_ROOTS]",
+               rs->generator_root_exp, CCSDS_RS_ROOTS, CORRECT_RS_CCSDS_BLOCK_LENGTH);
+
+    // powers 0 to 31 of every field element, used by the chien search and forney algorithm
+    print_rows("ccsds_element_exp_rows", "const field_logarithm_t *const correct_rs_ccsds_element_exp[256]",
+               rs->element_exp, 256, CCSDS_RS_ROOTS);
+
+    correct_reed_solomon_destroy(rs);
+    return 0;
+}
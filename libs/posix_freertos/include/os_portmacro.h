@@ -102,6 +102,9 @@ extern void vPortExitCritical(void);
 #define portENTER_CRITICAL() vPortEnterCritical()
 #define portEXIT_CRITICAL() vPortExitCritical()
 
+/* There are no privilege levels, tasks always run as if privileged. */
+#define portSWITCH_TO_USER_MODE()
+
 /*-----------------------------------------------------------*/
 
 extern void vPortThreadDying(void *pxTaskToDelete, volatile BaseType_t *pxPendYield);
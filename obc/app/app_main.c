@@ -2,6 +2,9 @@
 #include "obc_sci_io.h"
 #include "obc_i2c_io.h"
 #include "obc_spi_io.h"
+#include "obc_spi_dma.h"
+#include "cc1120_fifo_dma.h"
+#include "obc_board_config.h"
 #include "obc_reset.h"
 #include "obc_scheduler_config.h"
 #include "state_mgr.h"
@@ -15,6 +18,7 @@
 #include <sci.h>
 #include <i2c.h>
 #include <spi.h>
+#include <sys_dma.h>
 #include <can.h>
 #include <het.h>
 
@@ -41,6 +45,20 @@ int main(void) {
   initI2CMutex();
   initSpiMutex();
 
+  // The SD card driver moves sectors by DMA
+  dmaEnable();
+  initDmaSpiSemaphores();
+  spiDmaInit(SDC_SPI_REG);
+
+#if CC1120_FIFO_DMA_MODE == 1
+  // The CC1120's FIFO threshold interrupts move its FIFOs by DMA
+  initCc1120FifoDma();
+#endif
+
+  // Started before any other task so that every SPI user can queue transactions to it
+  obcSchedulerInitTask(OBC_SCHEDULER_CONFIG_ID_SPI_ENGINE);
+  obcSchedulerCreateTask(OBC_SCHEDULER_CONFIG_ID_SPI_ENGINE);
+
   // The state_mgr is the only task running initially.
   obcSchedulerInitTask(OBC_SCHEDULER_CONFIG_ID_STATE_MGR);
   obcSchedulerCreateTask(OBC_SCHEDULER_CONFIG_ID_STATE_MGR);
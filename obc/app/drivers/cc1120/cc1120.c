@@ -11,6 +11,39 @@
 #define CHIP_READY 0
 #define CHIP_STATE 0b1110000
 
+#define FIFO_ACCESS_NUM_ATTEMPTS 5U
+
+/**
+ * @brief - Runs a FIFO access as one transaction on the SPI engine, so that it doesn't wait behind other SPI traffic.
+ *
+ * @param header - The header byte of the access.
+ * @param outBytes - The bytes to write after the header, or NULL to read.
+ * @param inBytes - Buffer to store the bytes read after the header, or NULL to write.
+ * @param len - The number of bytes after the header.
+ * @return OBC_ERR_CODE_SUCCESS - If the access was successful.
+ * @return An error code - If the errCode byte is invalid.
+ */
+static obc_error_code_t cc1120FifoTransact(uint8_t header, const uint8_t *outBytes, uint8_t *inBytes, uint8_t len) {
+  obc_error_code_t errCode;
+  uint8_t ccStatus;
+
+  const spi_segment_t segments[] = {
+      {.outBytes = &header, .inBytes = &ccStatus, .numBytes = 1},
+      {.outBytes = outBytes, .inBytes = inBytes, .numBytes = len},
+  };
+
+  // A transaction can't wait on the status byte part way through like cc1120SendByteReceiveStatus does, so the whole
+  // access is repeated until the chip is ready
+  for (uint8_t i = 0; i < FIFO_ACCESS_NUM_ATTEMPTS; i++) {
+    RETURN_IF_ERROR_CODE(mcuCC1120SpiTransact(segments, sizeof(segments) / sizeof(segments[0])));
+    if ((ccStatus & CHIP_READY_MASK) == CHIP_READY) {
+      return OBC_ERR_CODE_SUCCESS;
+    }
+  }
+
+  return OBC_ERR_CODE_CC1120_INVALID_STATUS_BYTE;
+}
+
 static const register_setting_t cc1120SettingsStd[] = {
     // Set GPIO 0 to RXFIFO_THR_PKT
     {CC1120_REGS_IOCFG0, 0x01U},
@@ -247,12 +280,7 @@ obc_error_code_t cc1120ReadFifo(uint8_t data[], uint8_t len) {
   uint8_t header =
       (len > 1) ? (READ_BIT | BURST_BIT | CC1120_REGS_FIFO_ACCESS_STD) : (READ_BIT | CC1120_REGS_FIFO_ACCESS_STD);
 
-  RETURN_IF_ERROR_CODE(mcuCC1120CSAssert());
-  CC1120_DEASSERT_RETURN_IF_ERROR_CODE(cc1120SendByteReceiveStatus(header));
-
-  for (uint8_t i = 0; i < len; i++) CC1120_DEASSERT_RETURN_IF_ERROR_CODE(mcuCC1120SpiTransfer(0x00, &data[i]));
-
-  RETURN_IF_ERROR_CODE(mcuCC1120CSDeassert());
+  RETURN_IF_ERROR_CODE(cc1120FifoTransact(header, NULL, data, len));
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -274,13 +302,7 @@ obc_error_code_t cc1120WriteFifo(uint8_t data[], uint8_t len) {
 
   uint8_t header = (len > 1) ? (BURST_BIT | CC1120_REGS_FIFO_ACCESS_STD) : CC1120_REGS_FIFO_ACCESS_STD;
 
-  RETURN_IF_ERROR_CODE(mcuCC1120CSAssert());
-  CC1120_DEASSERT_RETURN_IF_ERROR_CODE(cc1120SendByteReceiveStatus(header));
-
-  uint8_t ignore;
-  for (uint8_t i = 0; i < len; i++) CC1120_DEASSERT_RETURN_IF_ERROR_CODE(mcuCC1120SpiTransfer(data[i], &ignore));
-
-  RETURN_IF_ERROR_CODE(mcuCC1120CSDeassert());
+  RETURN_IF_ERROR_CODE(cc1120FifoTransact(header, data, NULL, len));
 
   return OBC_ERR_CODE_SUCCESS;
 }
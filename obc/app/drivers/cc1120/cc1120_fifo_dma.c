@@ -0,0 +1,306 @@
+#include "cc1120_fifo_dma.h"
+#include "cc1120_mcu.h"
+#include "cc1120.h"
+#include "cc1120_defs.h"
+#include "obc_spi_io.h"
+#include "obc_spi_dma.h"
+#include "obc_privilege.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+#include <os_semphr.h>
+
+#include <gio.h>
+#include <spi.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define FIFO_BURST_WRITE_HEADER ((1U << 6) | CC1120_REGS_FIFO_ACCESS_STD)              // Burst bit
+#define FIFO_BURST_READ_HEADER ((1U << 7) | (1U << 6) | CC1120_REGS_FIFO_ACCESS_STD)  // Read and burst bits
+
+// Status byte sent back for the header (see section 3.1.2 in the datasheet)
+#define STATUS_CHIP_READY_MASK (1U << 7)
+#define STATUS_STATE_MASK (0x7U << 4)
+#define STATUS_STATE_RX_FIFO_ERROR (0x6U << 4)
+#define STATUS_STATE_TX_FIFO_ERROR (0x7U << 4)
+
+#define CS_ASSERTED 0
+#define CS_DEASSERTED 1
+
+// A burst of TXRX_INTERRUPT_THRESHOLD bytes takes well under a tick at any SPI clock we use
+#define FIFO_BURST_TIMEOUT pdMS_TO_TICKS(10)
+
+typedef enum {
+  FIFO_STREAM_IDLE,
+  FIFO_STREAM_TX,
+  FIFO_STREAM_RX,
+} fifo_stream_dir_t;
+
+/* Stream state, shared with the threshold and DMA interrupts. Only the task changes dir, and only while no burst is
+ * in flight or with interrupts disabled. */
+static volatile fifo_stream_dir_t streamDir = FIFO_STREAM_IDLE;
+static const uint8_t *streamTxData;
+static uint8_t *streamRxBuffer;
+static uint32_t streamLen;
+static volatile uint32_t streamBytesMoved;
+static volatile obc_error_code_t streamErrCode;
+
+// The next burst is prepared in these as soon as the previous one has finished, header first
+static uint16_t burstTxWords[1 + TXRX_INTERRUPT_THRESHOLD];
+static uint16_t burstRxWords[1 + TXRX_INTERRUPT_THRESHOLD];
+static volatile uint32_t burstLen;  // FIFO bytes in the prepared burst; 0 if there's nothing left to move
+static volatile bool burstInFlight;
+static volatile bool kickPending;  // A threshold was crossed while a burst was in flight
+
+// Given when the stream has moved all of its bytes, or stopped on an error
+static SemaphoreHandle_t streamDoneSemaphore = NULL;
+static StaticSemaphore_t streamDoneSemaphoreBuffer;
+
+/**
+ * @brief Lay out the stream's next burst in the burst buffers
+ */
+static void prepareBurst(void);
+
+/**
+ * @brief Assert chip select and start the prepared burst. Interrupts must be disabled or the caller must be an ISR.
+ */
+static void startBurst(void);
+
+/**
+ * @brief Start a stream
+ */
+static obc_error_code_t startStream(fifo_stream_dir_t dir, const uint8_t *txData, uint8_t *rxBuffer, uint32_t len);
+
+obc_error_code_t initCc1120FifoDma(void) {
+  obc_error_code_t errCode;
+
+  if (streamDoneSemaphore == NULL) {
+    streamDoneSemaphore = xSemaphoreCreateBinaryStatic(&streamDoneSemaphoreBuffer);
+  }
+
+  RETURN_IF_ERROR_CODE(spiDmaInit(CC1120_SPI_REG));
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t cc1120FifoDmaStartTx(const uint8_t *data, uint32_t len) {
+  obc_error_code_t errCode;
+
+  if (data == NULL || len == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(startStream(FIFO_STREAM_TX, data, NULL, len));
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t cc1120FifoDmaStartRx(uint8_t *buffer, uint32_t len) {
+  obc_error_code_t errCode;
+
+  // Bursts only read whole chunks, since the threshold only says that there are at least that many bytes
+  len -= len % TXRX_INTERRUPT_THRESHOLD;
+
+  if (buffer == NULL || len == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(startStream(FIFO_STREAM_RX, NULL, buffer, len));
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t cc1120FifoDmaWait(TickType_t idleTimeoutTicks) {
+  if (streamDir == FIFO_STREAM_IDLE) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  uint32_t lastBytesMoved = streamBytesMoved;
+  while (xSemaphoreTake(streamDoneSemaphore, idleTimeoutTicks) != pdPASS) {
+    // Keep waiting as long as chunks are still being moved
+    uint32_t bytesMoved = streamBytesMoved;
+    if (bytesMoved == lastBytesMoved) {
+      return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+    }
+    lastBytesMoved = bytesMoved;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t cc1120FifoDmaStop(uint32_t *numBytesMoved) {
+  obc_error_code_t errCode;
+
+  if (streamDir == FIFO_STREAM_IDLE) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  // No new bursts are started once the stream is idle
+  taskENTER_CRITICAL();
+  streamDir = FIFO_STREAM_IDLE;
+  kickPending = false;
+  taskEXIT_CRITICAL();
+
+  TickType_t startTick = xTaskGetTickCount();
+  while (burstInFlight && (xTaskGetTickCount() - startTick) < FIFO_BURST_TIMEOUT) {
+    vTaskDelay(1);
+  }
+
+  if (burstInFlight) {
+    // The DMA never finished the burst, so end it here
+    BaseType_t xRunningPrivileged = prvRaisePrivilege();
+    dmaSpiEndTransferFromISR(CC1120_SPI_REG);
+    portRESET_PRIVILEGE(xRunningPrivileged);
+
+    gioSetBit(CC1120_SPI_PORT, CC1120_SPI_CS, CS_DEASSERTED);
+    burstInFlight = false;
+
+    if (streamErrCode == OBC_ERR_CODE_SUCCESS) {
+      streamErrCode = OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+    }
+  }
+
+  if (numBytesMoved != NULL) {
+    *numBytesMoved = streamBytesMoved;
+  }
+
+  obc_error_code_t stopErrCode = streamErrCode;
+
+  RETURN_IF_ERROR_CODE(spiReleaseBusMutex(CC1120_SPI_REG));
+
+  if (stopErrCode != OBC_ERR_CODE_SUCCESS) {
+    LOG_ERROR_CODE(stopErrCode);
+  }
+  return stopErrCode;
+}
+
+bool cc1120FifoDmaKickFromISR(void) {
+  if (streamDir == FIFO_STREAM_IDLE || burstLen == 0) {
+    return false;
+  }
+
+  if (burstInFlight) {
+    kickPending = true;
+  } else {
+    startBurst();
+  }
+
+  return true;
+}
+
+void cc1120FifoDmaFinishedCallback(void) {
+  dmaSpiEndTransferFromISR(CC1120_SPI_REG);
+  gioSetBit(CC1120_SPI_PORT, CC1120_SPI_CS, CS_DEASSERTED);
+  burstInFlight = false;
+
+  bool isStreamDone = false;
+
+  uint16_t status = burstRxWords[0];
+  uint16_t state = status & STATUS_STATE_MASK;
+  if ((status & STATUS_CHIP_READY_MASK) != 0 || state == STATUS_STATE_RX_FIFO_ERROR ||
+      state == STATUS_STATE_TX_FIFO_ERROR) {
+    streamErrCode = OBC_ERR_CODE_CC1120_INVALID_STATUS_BYTE;
+    burstLen = 0;
+    isStreamDone = true;
+  } else {
+    // Checked by buffer rather than direction, since the stream may have been stopped while the burst was in flight
+    if (streamRxBuffer != NULL) {
+      for (uint32_t i = 0; i < burstLen; i++) {
+        streamRxBuffer[streamBytesMoved + i] = (uint8_t)(burstRxWords[1 + i] & 0xFFU);
+      }
+    }
+    streamBytesMoved += burstLen;
+
+    prepareBurst();
+    if (burstLen == 0) {
+      isStreamDone = true;
+    } else if (kickPending && streamDir != FIFO_STREAM_IDLE) {
+      kickPending = false;
+      startBurst();
+    }
+  }
+
+  if (isStreamDone) {
+    BaseType_t xHigherPriorityTaskAwoken = pdFALSE;
+    xSemaphoreGiveFromISR(streamDoneSemaphore, &xHigherPriorityTaskAwoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskAwoken);
+  }
+}
+
+static obc_error_code_t startStream(fifo_stream_dir_t dir, const uint8_t *txData, uint8_t *rxBuffer, uint32_t len) {
+  obc_error_code_t errCode;
+
+  if (streamDoneSemaphore == NULL) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  if (streamDir != FIFO_STREAM_IDLE) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  // Held until the stream is stopped, so nothing else uses the bus while the interrupts run bursts on it
+  RETURN_IF_ERROR_CODE(spiTakeBusMutex(CC1120_SPI_REG));
+
+  // Clear a completion left over from a stream that was stopped early
+  xSemaphoreTake(streamDoneSemaphore, 0);
+
+  streamTxData = txData;
+  streamRxBuffer = rxBuffer;
+  streamLen = len;
+  streamBytesMoved = 0;
+  streamErrCode = OBC_ERR_CODE_SUCCESS;
+  burstInFlight = false;
+  kickPending = false;
+
+  // SPIDAT0, which the DMA writes, sends with the data format last written to SPIDAT1. Sending a no-op strobe sets it
+  // to the CC1120's.
+  uint8_t ignore;
+  errCode = mcuCC1120CSAssert();
+  if (errCode == OBC_ERR_CODE_SUCCESS) {
+    errCode = mcuCC1120SpiTransfer(CC1120_STROBE_SNOP, &ignore);
+    LOG_IF_ERROR_CODE(mcuCC1120CSDeassert());
+  }
+  if (errCode != OBC_ERR_CODE_SUCCESS) {
+    LOG_ERROR_CODE(errCode);
+    spiReleaseBusMutex(CC1120_SPI_REG);
+    return errCode;
+  }
+
+  streamDir = dir;
+  prepareBurst();
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static void prepareBurst(void) {
+  uint32_t remaining = streamLen - streamBytesMoved;
+  uint32_t len = (remaining < TXRX_INTERRUPT_THRESHOLD) ? remaining : TXRX_INTERRUPT_THRESHOLD;
+
+  if (streamDir == FIFO_STREAM_TX) {
+    burstTxWords[0] = FIFO_BURST_WRITE_HEADER;
+    for (uint32_t i = 0; i < len; i++) {
+      burstTxWords[1 + i] = (uint16_t)streamTxData[streamBytesMoved + i];
+    }
+  } else {
+    burstTxWords[0] = FIFO_BURST_READ_HEADER;
+    for (uint32_t i = 0; i < len; i++) {
+      burstTxWords[1 + i] = 0x00U;
+    }
+  }
+
+  burstLen = len;
+}
+
+static void startBurst(void) {
+  gioSetBit(CC1120_SPI_PORT, CC1120_SPI_CS, CS_ASSERTED);
+  burstInFlight = true;
+
+  if (dmaSpiStartTransferFromISR(CC1120_SPI_REG, burstTxWords, burstRxWords, 1 + burstLen) != OBC_ERR_CODE_SUCCESS) {
+    gioSetBit(CC1120_SPI_PORT, CC1120_SPI_CS, CS_DEASSERTED);
+    burstInFlight = false;
+    burstLen = 0;
+    streamErrCode = OBC_ERR_CODE_SPI_FAILURE;
+    xSemaphoreGiveFromISR(streamDoneSemaphore, NULL);
+  }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+
+/* In FIFO DMA mode, the FIFO threshold interrupts move the next chunk of a packet between the CC1120's FIFO and RAM
+ * themselves, as a DMA burst prepared when the previous one finished. The task that started the stream is only woken
+ * once the whole stream has been moved, instead of at every threshold crossing.
+ *
+ * The task holds the CC1120's bus from cc1120FifoDmaStartTx/Rx until cc1120FifoDmaStop. Only the FIFO bursts run on
+ * the bus in between, so the task must not access the CC1120 itself until the stream has stopped. */
+
+// Set to 1 to move the CC1120's FIFOs by DMA from the threshold interrupts
+#ifndef CC1120_FIFO_DMA_MODE
+#define CC1120_FIFO_DMA_MODE 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Set up the DMA for the CC1120's bus. Must be called in privileged mode, before the scheduler starts.
+ *
+ * @return obc_error_code_t - whether or not the initialization was successful
+ */
+obc_error_code_t initCc1120FifoDma(void);
+
+/**
+ * @brief Stream bytes to the TX FIFO, one chunk each time the TX FIFO drains below the threshold
+ *
+ * @param data - The bytes to write; must stay valid until the stream is stopped
+ * @param len - The number of bytes to write
+ * @return obc_error_code_t - whether or not the stream was started
+ */
+obc_error_code_t cc1120FifoDmaStartTx(const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Stream bytes from the RX FIFO, one chunk each time the RX FIFO fills above the threshold
+ *
+ * @param buffer - Buffer to store the bytes in; must stay valid until the stream is stopped
+ * @param len - The number of bytes to read, rounded down to a multiple of TXRX_INTERRUPT_THRESHOLD
+ * @return obc_error_code_t - whether or not the stream was started
+ */
+obc_error_code_t cc1120FifoDmaStartRx(uint8_t *buffer, uint32_t len);
+
+/**
+ * @brief Wait for the stream to move all of its bytes
+ *
+ * @param idleTimeoutTicks - How long to wait for the next chunk to be moved before giving up
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if all of the bytes were moved, OBC_ERR_CODE_SEMAPHORE_TIMEOUT if
+ * no chunk was moved for idleTimeoutTicks (e.g. because the uplink ended)
+ */
+obc_error_code_t cc1120FifoDmaWait(TickType_t idleTimeoutTicks);
+
+/**
+ * @brief Stop the stream and release the CC1120's bus
+ *
+ * @param numBytesMoved - Buffer to store the number of bytes moved in, may be NULL
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS, or the error that stopped a burst part way through the stream
+ */
+obc_error_code_t cc1120FifoDmaStop(uint32_t *numBytesMoved);
+
+/**
+ * @brief Start the stream's next burst, to be called from the FIFO threshold interrupts
+ *
+ * @return bool - true if the threshold crossing was used by a stream, false if the task should handle it
+ */
+bool cc1120FifoDmaKickFromISR(void);
+
+/**
+ * @brief callback function to be called from ISR when the DMA has finished a FIFO burst
+ */
+void cc1120FifoDmaFinishedCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
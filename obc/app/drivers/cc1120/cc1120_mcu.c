@@ -3,6 +3,13 @@
 
 static const spiDAT1_t spiConfig = {.CS_HOLD = false, .WDEL = false, .DFSEL = CC1120_SPI_FMT, .CSNR = SPI_CS_NONE};
 
+static const spi_device_t cc1120Device = {
+    .spiReg = CC1120_SPI_REG,
+    .csPort = CC1120_SPI_PORT,
+    .csPin = CC1120_SPI_CS,
+    .dataFormat = {.CS_HOLD = false, .WDEL = false, .DFSEL = CC1120_SPI_FMT, .CSNR = SPI_CS_NONE},
+};
+
 /**
  * @brief Simultaneously sends and receives a byte over CC1120 SPI interface
  *
@@ -37,3 +44,25 @@ obc_error_code_t mcuCC1120CSDeassert(void) {
   RETURN_IF_ERROR_CODE(deassertChipSelect(CC1120_SPI_PORT, CC1120_SPI_CS));
   return OBC_ERR_CODE_SUCCESS;
 }
+
+/**
+ * @brief Runs segments on the CC1120 as an urgent transaction on the SPI engine, and waits for them to finish.
+ *
+ * @param segments - The segments to run
+ * @param numSegments - The number of segments
+ * @return error code - An error code from obc_errors.h
+ */
+obc_error_code_t mcuCC1120SpiTransact(const spi_segment_t segments[], uint8_t numSegments) {
+  obc_error_code_t errCode;
+
+  // The radio's FIFOs over- or underflow if they wait behind storage traffic
+  spi_transaction_t transaction = {
+      .device = &cc1120Device,
+      .segments = segments,
+      .numSegments = numSegments,
+      .priority = SPI_TRANSACTION_PRIORITY_URGENT,
+  };
+
+  RETURN_IF_ERROR_CODE(spiTransact(&transaction));
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -3,6 +3,7 @@
 #include "obc_errors.h"
 #include "obc_logging.h"
 #include "obc_spi_io.h"
+#include "obc_spi_transaction.h"
 #include <stdint.h>
 
 #define CC1120_SPI_REG spiREG4
@@ -34,3 +35,12 @@ obc_error_code_t mcuCC1120CSAssert(void);
  * @return error code - An error code from obc_errors.h
  */
 obc_error_code_t mcuCC1120CSDeassert(void);
+
+/**
+ * @brief Runs segments on the CC1120 as an urgent transaction on the SPI engine, and waits for them to finish.
+ *
+ * @param segments - The segments to run
+ * @param numSegments - The number of segments
+ * @return error code - An error code from obc_errors.h
+ */
+obc_error_code_t mcuCC1120SpiTransact(const spi_segment_t segments[], uint8_t numSegments);
@@ -4,6 +4,7 @@
 
 #include "spi.h"
 #include "obc_spi_io.h"
+#include "obc_spi_transaction.h"
 #include "obc_logging.h"
 #include "obc_errors.h"
 #include "obc_board_config.h"
@@ -12,6 +13,13 @@
 // SPI values
 static spiDAT1_t framSPIDataFmt = {.CS_HOLD = 0, .CSNR = SPI_CS_NONE, .DFSEL = FRAM_spiFMT, .WDEL = 0};
 
+static const spi_device_t framDevice = {
+    .spiReg = FRAM_spiREG,
+    .csPort = FRAM_spiPORT,
+    .csPin = FRAM_CS,
+    .dataFormat = {.CS_HOLD = 0, .CSNR = SPI_CS_NONE, .DFSEL = FRAM_spiFMT, .WDEL = 0},
+};
+
 // FRAM OPCODES
 #define OP_WRITE_ENABLE 0x06U
 #define OP_WRITE_RESET 0x04U
@@ -25,6 +33,9 @@ static spiDAT1_t framSPIDataFmt = {.CS_HOLD = 0, .CSNR = SPI_CS_NONE, .DFSEL = F
 #define OP_SLEEP 0xB9U
 #define OP_GET_ID 0x9FU
 
+#define FRAM_ADDRESS_LEN 3U
+#define FRAM_DUMMY_BYTE 0xFFU
+
 #define FRAM_WAKE_BUSY_WAIT \
   99000U  // Assume RM46 clk is 220 MHz, value for wait loop should give ~450us delay (datasheet pg.15)
 #define FRAM_WAKE_TIME_MS \
@@ -45,7 +56,9 @@ typedef enum cmd {
 
 // Function Declarations
 static obc_error_code_t framTransmitOpCode(cmd_t cmd);
-static obc_error_code_t framTransmitAddress(uint32_t addr);
+static obc_error_code_t framTransact(const spi_segment_t *segments, uint8_t numSegments);
+static obc_error_code_t framCheckAwake(const spi_transaction_t *transaction);
+static size_t framPackCommand(uint8_t opCode, uint32_t addr, uint8_t *command);
 
 // CS assumed to be asserted
 static obc_error_code_t framTransmitOpCode(cmd_t cmd) {
@@ -86,266 +99,123 @@ static obc_error_code_t framTransmitOpCode(cmd_t cmd) {
   return errCode;
 }
 
-// CS assumed to be asserted
-static obc_error_code_t framTransmitAddress(uint32_t addr) {
-  obc_error_code_t errCode;
-  if (addr > FRAM_MAX_ADDRESS) {
-    return OBC_ERR_CODE_FRAM_ADDRESS_OUT_OF_RANGE;
-  }
+// Runs the segments as one transaction on the FRAM, which must be awake
+static obc_error_code_t framTransact(const spi_segment_t *segments, uint8_t numSegments) {
+  spi_transaction_t transaction = {
+      .device = &framDevice,
+      .segments = segments,
+      .numSegments = numSegments,
+      .priority = SPI_TRANSACTION_PRIORITY_NORMAL,
+      .check = framCheckAwake,
+  };
+
+  return spiTransact(&transaction);
+}
+
+// isAsleep is only changed with the bus mutex held, which the transaction holds while this runs
+static obc_error_code_t framCheckAwake(const spi_transaction_t *transaction) {
+  (void)transaction;
+  return isAsleep ? OBC_ERR_CODE_FRAM_IS_ASLEEP : OBC_ERR_CODE_SUCCESS;
+}
 
-  // Send last 3 bytes MSB first
-  for (int i = 2; i >= 0; i--) {
-    uint8_t byte = (addr >> (i * 8)) & (0xFF);
-    RETURN_IF_ERROR_CODE(spiTransmitByte(FRAM_spiREG, &framSPIDataFmt, byte));
+// Lays out an opcode followed by the last 3 bytes of addr MSB first, returning the number of bytes
+static size_t framPackCommand(uint8_t opCode, uint32_t addr, uint8_t *command) {
+  command[0] = opCode;
+  for (size_t i = 0; i < FRAM_ADDRESS_LEN; i++) {
+    command[1 + i] = (addr >> ((FRAM_ADDRESS_LEN - 1 - i) * 8)) & 0xFFU;
   }
-  return OBC_ERR_CODE_SUCCESS;
+  return 1 + FRAM_ADDRESS_LEN;
 }
 
 void initFRAM(void) { isAsleep = false; }
 
 obc_error_code_t framReadStatusReg(uint8_t *status) {
-  obc_error_code_t errCode;
   if (status == NULL) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
-  // Recursive take mutex
-  RETURN_IF_ERROR_CODE(spiTakeBusMutex(FRAM_spiREG));
-
-  if (isAsleep) {
-    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
-    errCode = OBC_ERR_CODE_FRAM_IS_ASLEEP;
-  }
-
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(assertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
 
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitOpCode(FRAM_READ_STATUS_REG));
-  }
+  static const uint8_t opCode = OP_READ_STAT_REG;
+  const spi_segment_t segments[] = {
+      {.outBytes = &opCode, .numBytes = 1},
+      {.inBytes = status, .numBytes = 1},
+  };
 
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(spiReceiveByte(FRAM_spiREG, &framSPIDataFmt, status));
-  }
-  obc_error_code_t prev_errCode = errCode;
-  if (errCode != OBC_ERR_CODE_FRAM_IS_ASLEEP) {
-    // Do not deassert since never asserted in the first place
-    RETURN_IF_ERROR_CODE(deassertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  RETURN_IF_ERROR_CODE(spiReleaseBusMutex(FRAM_spiREG));
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  return errCode;
+  return framTransact(segments, sizeof(segments) / sizeof(segments[0]));
 }
 
 obc_error_code_t framWriteStatusReg(uint8_t status) {
-  obc_error_code_t errCode;
-  // Recursive take mutex
-  RETURN_IF_ERROR_CODE(spiTakeBusMutex(FRAM_spiREG));
-
-  if (isAsleep) {
-    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
-    errCode = OBC_ERR_CODE_FRAM_IS_ASLEEP;
-  }
-
-  // Send WREN
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(assertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitOpCode(FRAM_WRITE_EN));
-  }
+  static const uint8_t writeEnable = OP_WRITE_ENABLE;
+  const uint8_t command[] = {OP_WRITE_STAT_REG, status};
 
   // Deassert and assert needed for write operations (datasheet pg. 9)
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(deassertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(assertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
+  const spi_segment_t segments[] = {
+      {.outBytes = &writeEnable, .numBytes = 1, .deassertCsAfter = true},
+      {.outBytes = command, .numBytes = sizeof(command)},
+  };
 
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitOpCode(FRAM_WRITE_STATUS_REG));
-  }
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(spiTransmitByte(FRAM_spiREG, &framSPIDataFmt, status));
-  }
-
-  obc_error_code_t prev_errCode = errCode;
-  if (errCode != OBC_ERR_CODE_FRAM_IS_ASLEEP) {
-    // Do not deassert since never asserted in the first place
-    RETURN_IF_ERROR_CODE(deassertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  RETURN_IF_ERROR_CODE(spiReleaseBusMutex(FRAM_spiREG));
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  return errCode;
+  return framTransact(segments, sizeof(segments) / sizeof(segments[0]));
 }
 
 obc_error_code_t framFastRead(uint32_t addr, uint8_t *buffer, size_t nBytes) {
-  obc_error_code_t errCode;
   if (buffer == NULL) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
-
-  // Recursive take mutex
-  RETURN_IF_ERROR_CODE(spiTakeBusMutex(FRAM_spiREG));
-
-  if (isAsleep) {
-    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
-    errCode = OBC_ERR_CODE_FRAM_IS_ASLEEP;
-  }
-
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(assertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitOpCode(FRAM_FAST_READ));
-  }
-
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitAddress(addr));
+  if (addr > FRAM_MAX_ADDRESS) {
+    return OBC_ERR_CODE_FRAM_ADDRESS_OUT_OF_RANGE;
   }
 
-  // Send dummy byte
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(spiTransmitByte(FRAM_spiREG, &framSPIDataFmt, 0xFF));
-  }
+  // Opcode, address and a dummy byte
+  uint8_t command[1 + FRAM_ADDRESS_LEN + 1];
+  size_t commandLen = framPackCommand(OP_FREAD, addr, command);
+  command[commandLen++] = FRAM_DUMMY_BYTE;
 
-  for (uint32_t i = 0; i < nBytes; i++) {
-    if (errCode == OBC_ERR_CODE_SUCCESS) {
-      uint8_t receiveByte;
-      LOG_IF_ERROR_CODE(spiReceiveByte(FRAM_spiREG, &framSPIDataFmt, &receiveByte));
-      buffer[i] = receiveByte;
-    } else {
-      break;
-    }
-  }
+  const spi_segment_t segments[] = {
+      {.outBytes = command, .numBytes = commandLen},
+      {.inBytes = buffer, .numBytes = nBytes},
+  };
 
-  obc_error_code_t prev_errCode = errCode;
-  if (errCode != OBC_ERR_CODE_FRAM_IS_ASLEEP) {
-    // Do not deassert since never asserted in the first place
-    RETURN_IF_ERROR_CODE(deassertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  RETURN_IF_ERROR_CODE(spiReleaseBusMutex(FRAM_spiREG));
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  return errCode;
+  return framTransact(segments, sizeof(segments) / sizeof(segments[0]));
 }
 
 obc_error_code_t framRead(uint32_t addr, uint8_t *buffer, size_t nBytes) {
-  obc_error_code_t errCode;
   if (buffer == NULL) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
-
-  // Recursive take mutex
-  RETURN_IF_ERROR_CODE(spiTakeBusMutex(FRAM_spiREG));
-
-  if (isAsleep) {
-    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
-    errCode = OBC_ERR_CODE_FRAM_IS_ASLEEP;
-  }
-
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(assertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitOpCode(FRAM_READ));
+  if (addr > FRAM_MAX_ADDRESS) {
+    return OBC_ERR_CODE_FRAM_ADDRESS_OUT_OF_RANGE;
   }
 
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitAddress(addr));
-  }
+  uint8_t command[1 + FRAM_ADDRESS_LEN];
+  size_t commandLen = framPackCommand(OP_READ, addr, command);
 
-  for (uint32_t i = 0; i < nBytes; i++) {
-    if (errCode == OBC_ERR_CODE_SUCCESS) {
-      uint8_t receiveByte;
-      LOG_IF_ERROR_CODE(spiReceiveByte(FRAM_spiREG, &framSPIDataFmt, &receiveByte));
-      buffer[i] = receiveByte;
-    } else {
-      break;
-    }
-  }
+  const spi_segment_t segments[] = {
+      {.outBytes = command, .numBytes = commandLen},
+      {.inBytes = buffer, .numBytes = nBytes},
+  };
 
-  obc_error_code_t prev_errCode = errCode;
-  if (errCode != OBC_ERR_CODE_FRAM_IS_ASLEEP) {
-    // Do not deassert since never asserted in the first place
-    RETURN_IF_ERROR_CODE(deassertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  RETURN_IF_ERROR_CODE(spiReleaseBusMutex(FRAM_spiREG));
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  return errCode;
+  return framTransact(segments, sizeof(segments) / sizeof(segments[0]));
 }
 
 obc_error_code_t framWrite(uint32_t addr, const uint8_t *data, size_t nBytes) {
-  obc_error_code_t errCode;
   if (data == NULL) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
-
-  // Recursive take mutex
-  RETURN_IF_ERROR_CODE(spiTakeBusMutex(FRAM_spiREG));
-
-  if (isAsleep) {
-    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
-    errCode = OBC_ERR_CODE_FRAM_IS_ASLEEP;
-  }
-
-  // Send WREN
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(assertChipSelect(FRAM_spiPORT, FRAM_CS));
+  if (addr > FRAM_MAX_ADDRESS) {
+    return OBC_ERR_CODE_FRAM_ADDRESS_OUT_OF_RANGE;
   }
 
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitOpCode(FRAM_WRITE_EN));
-  }
+  static const uint8_t writeEnable = OP_WRITE_ENABLE;
+  uint8_t command[1 + FRAM_ADDRESS_LEN];
+  size_t commandLen = framPackCommand(OP_WRITE, addr, command);
 
   // Deassert and assert needed for write operations (datasheet pg. 9)
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(deassertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(assertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitOpCode(FRAM_WRITE));
-  }
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitAddress(addr));
-  }
-
-  for (uint32_t i = 0; i < nBytes; i++) {
-    if (errCode == OBC_ERR_CODE_SUCCESS) {
-      LOG_IF_ERROR_CODE(spiTransmitByte(FRAM_spiREG, &framSPIDataFmt, data[i]));
-    } else {
-      break;
-    }
-  }
+  const spi_segment_t segments[] = {
+      {.outBytes = &writeEnable, .numBytes = 1, .deassertCsAfter = true},
+      {.outBytes = command, .numBytes = commandLen},
+      {.outBytes = data, .numBytes = nBytes},
+  };
 
-  obc_error_code_t prev_errCode = errCode;
-  if (errCode != OBC_ERR_CODE_FRAM_IS_ASLEEP) {
-    // Do not deassert since never asserted in the first place
-    RETURN_IF_ERROR_CODE(deassertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  RETURN_IF_ERROR_CODE(spiReleaseBusMutex(FRAM_spiREG));
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  return errCode;
+  return framTransact(segments, sizeof(segments) / sizeof(segments[0]));
 }
 
 obc_error_code_t framSleep(void) {
@@ -389,41 +259,15 @@ obc_error_code_t framWakeUp(void) {
 }
 
 obc_error_code_t framReadID(uint8_t *id, size_t nBytes) {
-  obc_error_code_t errCode;
   if (id == NULL) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
-  RETURN_IF_ERROR_CODE(spiTakeBusMutex(FRAM_spiREG));
-  if (isAsleep) {
-    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
-    errCode = OBC_ERR_CODE_FRAM_IS_ASLEEP;
-  }
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(assertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  if (errCode == OBC_ERR_CODE_SUCCESS) {
-    LOG_IF_ERROR_CODE(framTransmitOpCode(FRAM_READ_ID));
-  }
 
-  for (uint32_t i = 0; i < nBytes && i < FRAM_ID_LEN; i++) {
-    if (errCode == OBC_ERR_CODE_SUCCESS) {
-      uint8_t receiveByte;
-      LOG_IF_ERROR_CODE(spiReceiveByte(FRAM_spiREG, &framSPIDataFmt, &receiveByte));
-      id[i] = receiveByte;
-    } else {
-      break;
-    }
-  }
+  static const uint8_t opCode = OP_GET_ID;
+  const spi_segment_t segments[] = {
+      {.outBytes = &opCode, .numBytes = 1},
+      {.inBytes = id, .numBytes = (nBytes < FRAM_ID_LEN) ? nBytes : FRAM_ID_LEN},
+  };
 
-  obc_error_code_t prev_errCode = errCode;
-  if (errCode != OBC_ERR_CODE_FRAM_IS_ASLEEP) {
-    // Do not deassert since never asserted in the first place
-    RETURN_IF_ERROR_CODE(deassertChipSelect(FRAM_spiPORT, FRAM_CS));
-  }
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  RETURN_IF_ERROR_CODE(spiReleaseBusMutex(FRAM_spiREG));
-  // Reset overwritten error code
-  errCode = prev_errCode;
-  return errCode;
+  return framTransact(segments, sizeof(segments) / sizeof(segments[0]));
 }
@@ -1,5 +1,6 @@
 #include "obc_dma.h"
 #include "obc_spi_dma.h"
+#include "cc1120_fifo_dma.h"
 
 #include <sys_dma.h>
 
@@ -17,7 +18,13 @@ void dmaGroupANotification(dmaInterrupt_t inttype, uint32 channel) {
         case DMA_SPI_3_RX_CHANNEL:
           dmaSpi3FinishedCallback();
           break;
+        case DMA_SPI_4_RX_CHANNEL:
+          // SPI4 is only moved by DMA for the CC1120's FIFO bursts
+          cc1120FifoDmaFinishedCallback();
+          break;
       }
+      break;
     case HBC:
+      break;
   }
 }
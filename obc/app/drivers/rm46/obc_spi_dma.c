@@ -17,6 +17,15 @@ static StaticSemaphore_t dmaSpi1FinishedSemaphoreBuffer;
 static SemaphoreHandle_t dmaSpi3FinishedSemaphore = NULL;
 static StaticSemaphore_t dmaSpi3FinishedSemaphoreBuffer;
 
+static bool dmaSpi1Enabled = false;
+static bool dmaSpi3Enabled = false;
+
+// Bytes are widened into these for dmaSpiTransferBytes; the bus mutex keeps them to one transfer at a time
+static uint16_t dmaSpi1TxWords[SPI_DMA_MAX_BURST_WORDS];
+static uint16_t dmaSpi1RxWords[SPI_DMA_MAX_BURST_WORDS];
+static uint16_t dmaSpi3TxWords[SPI_DMA_MAX_BURST_WORDS];
+static uint16_t dmaSpi3RxWords[SPI_DMA_MAX_BURST_WORDS];
+
 /**
  * @brief configures DMA for a single spi transmission
  *
@@ -72,6 +81,7 @@ obc_error_code_t spiDmaInit(spiBASE_t *spiReg) {
       dmaEnableInterrupt(DMA_SPI_1_RX_CHANNEL, BTC);  // Set DMA to trigger interrupt after a block transfer is complete
       dmaSetChEnable(DMA_SPI_1_RX_CHANNEL, DMA_HW);   // SPI1 RX, hardware triggering
       dmaSetChEnable(DMA_SPI_1_TX_CHANNEL, DMA_HW);   // SPI1 TX, hardware triggering
+      dmaSpi1Enabled = true;
       break;
     case (uint32_t)spiREG3:
       dmaReqAssign(DMA_SPI_3_RX_CHANNEL,
@@ -81,6 +91,16 @@ obc_error_code_t spiDmaInit(spiBASE_t *spiReg) {
       dmaEnableInterrupt(DMA_SPI_3_RX_CHANNEL, BTC);  // Set DMA to trigger interrupt after a block transfer is complete
       dmaSetChEnable(DMA_SPI_3_RX_CHANNEL, DMA_HW);   // SPI3 RX, hardware triggering
       dmaSetChEnable(DMA_SPI_3_TX_CHANNEL, DMA_HW);   // SPI3 TX, hardware triggering
+      dmaSpi3Enabled = true;
+      break;
+    case (uint32_t)spiREG4:
+      dmaReqAssign(DMA_SPI_4_RX_CHANNEL,
+                   DMA_SPI4_RX_REQ_LINE);  // Assign SPI4 RX to DMA channel 4 (See Table 6-33 in datasheet)
+      dmaReqAssign(DMA_SPI_4_TX_CHANNEL,
+                   DMA_SPI4_TX_REQ_LINE);             // Assign SPI4 TX to DMA channel 5 (See Table 6-33 in datasheet)
+      dmaEnableInterrupt(DMA_SPI_4_RX_CHANNEL, BTC);  // Set DMA to trigger interrupt after a block transfer is complete
+      dmaSetChEnable(DMA_SPI_4_RX_CHANNEL, DMA_HW);   // SPI4 RX, hardware triggering
+      dmaSetChEnable(DMA_SPI_4_TX_CHANNEL, DMA_HW);   // SPI4 TX, hardware triggering
       break;
     // Add more cases as we start to implement different spi buses with DMA
     default:
@@ -122,6 +142,9 @@ static obc_error_code_t spiDmaRxConfig(spiBASE_t *spiReg, uint32_t rxDataAddr, s
     case (uint32_t)spiREG3:
       dmaSetCtrlPacket(DMA_SPI_3_RX_CHANNEL, dmaCtrlPktRx);
       break;
+    case (uint32_t)spiREG4:
+      dmaSetCtrlPacket(DMA_SPI_4_RX_CHANNEL, dmaCtrlPktRx);
+      break;
     default:
       return OBC_ERR_CODE_INVALID_ARG;
   }
@@ -162,6 +185,9 @@ static obc_error_code_t spiDmaTxConfig(spiBASE_t *spiReg, uint32_t txDataAddr, s
     case (uint32_t)spiREG3:
       dmaSetCtrlPacket(DMA_SPI_3_TX_CHANNEL, dmaCtrlPktTx);
       break;
+    case (uint32_t)spiREG4:
+      dmaSetCtrlPacket(DMA_SPI_4_TX_CHANNEL, dmaCtrlPktTx);
+      break;
     default:
       return OBC_ERR_CODE_INVALID_ARG;
   }
@@ -191,33 +217,128 @@ obc_error_code_t dmaSpiTransmitandReceiveBytes(spiBASE_t *spiReg, uint16_t *txDa
   if (!isSpiBusOwner(spiMutex)) {
     return OBC_ERR_CODE_NOT_MUTEX_OWNER;
   }
+
+  SemaphoreHandle_t finishedSemaphore;
+  switch ((uint32_t)spiReg) {
+    case (uint32_t)spiREG1:
+      finishedSemaphore = dmaSpi1FinishedSemaphore;
+      break;
+    case (uint32_t)spiREG3:
+      finishedSemaphore = dmaSpi3FinishedSemaphore;
+      break;
+    default:
+      return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  // Clear a completion left over from a transfer that timed out, so it isn't taken for this one's
+  xSemaphoreTake(finishedSemaphore, 0);
+
   BaseType_t xRunningPrivileged = prvRaisePrivilege();
   /* START PRIVILEGED SECTION */
   /* The following code causes hard fault if not done in priveleged mode */
 
+  errCode = spiDmaRxConfig(spiReg, (uint32_t)rxData, dataLen);
+  if (errCode == OBC_ERR_CODE_SUCCESS) {
+    errCode = spiDmaTxConfig(spiReg, (uint32_t)txData, dataLen);
+  }
+  if (errCode == OBC_ERR_CODE_SUCCESS) {
+    spiEnableNotification(spiReg, SPI_NOTIFICATION_DMA_REQ);
+  }
+
+  /* END PRIVILEGED SECTION */
+  portRESET_PRIVILEGE(xRunningPrivileged);
+
+  RETURN_IF_ERROR_CODE(errCode);
+
+  if (xSemaphoreTake(finishedSemaphore, pdMS_TO_TICKS(transferCompleteTimeoutMs)) != pdPASS) {
+    errCode = OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+  }
+
+  // Left enabled, DMA requests would restart the transfer on the next word sent over the bus without DMA
+  xRunningPrivileged = prvRaisePrivilege();
+  spiDisableNotification(spiReg, SPI_NOTIFICATION_DMA_REQ);
+  portRESET_PRIVILEGE(xRunningPrivileged);
+
+  RETURN_IF_ERROR_CODE(errCode);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t dmaSpiStartTransferFromISR(spiBASE_t *spiReg, uint16_t *txData, uint16_t *rxData, size_t dataLen) {
+  obc_error_code_t errCode;
+
+  if (spiReg == NULL || txData == NULL || rxData == NULL || dataLen == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
   RETURN_IF_ERROR_CODE(spiDmaRxConfig(spiReg, (uint32_t)rxData, dataLen));
   RETURN_IF_ERROR_CODE(spiDmaTxConfig(spiReg, (uint32_t)txData, dataLen));
-
   spiEnableNotification(spiReg, SPI_NOTIFICATION_DMA_REQ);
 
-  /* END PRIVILEGED SECTION */
-  portRESET_PRIVILEGE(xRunningPrivileged);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+void dmaSpiEndTransferFromISR(spiBASE_t *spiReg) {
+  if (spiReg == NULL) {
+    return;
+  }
 
+  spiDisableNotification(spiReg, SPI_NOTIFICATION_DMA_REQ);
+}
+
+bool isSpiDmaEnabled(spiBASE_t *spiReg) {
   switch ((uint32_t)spiReg) {
     case (uint32_t)spiREG1:
-      if (xSemaphoreTake(dmaSpi1FinishedSemaphore, pdMS_TO_TICKS(transferCompleteTimeoutMs)) != pdPASS) {
-        return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
-      }
+      return dmaSpi1Enabled && (dmaSpi1FinishedSemaphore != NULL);
+    case (uint32_t)spiREG3:
+      return dmaSpi3Enabled && (dmaSpi3FinishedSemaphore != NULL);
+    default:
+      return false;
+  }
+}
+
+obc_error_code_t dmaSpiTransferBytes(spiBASE_t *spiReg, const uint8_t *outBytes, uint8_t *inBytes, size_t numBytes,
+                                     uint32_t transferCompleteTimeoutMs) {
+  obc_error_code_t errCode;
+
+  uint16_t *txWords;
+  uint16_t *rxWords;
+  switch ((uint32_t)spiReg) {
+    case (uint32_t)spiREG1:
+      txWords = dmaSpi1TxWords;
+      rxWords = dmaSpi1RxWords;
       break;
     case (uint32_t)spiREG3:
-      if (xSemaphoreTake(dmaSpi3FinishedSemaphore, pdMS_TO_TICKS(transferCompleteTimeoutMs)) != pdPASS) {
-        return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
-      }
+      txWords = dmaSpi3TxWords;
+      rxWords = dmaSpi3RxWords;
       break;
     default:
       return OBC_ERR_CODE_INVALID_ARG;
   }
 
+  while (numBytes > 0) {
+    size_t numWords = (numBytes < SPI_DMA_MAX_BURST_WORDS) ? numBytes : SPI_DMA_MAX_BURST_WORDS;
+
+    // The SPI takes 16-bit words, but we're using 8-bit word size
+    for (size_t i = 0; i < numWords; i++) {
+      txWords[i] = (outBytes == NULL) ? 0U : (uint16_t)outBytes[i];
+    }
+
+    RETURN_IF_ERROR_CODE(
+        dmaSpiTransmitandReceiveBytes(spiReg, txWords, rxWords, numWords, 0, transferCompleteTimeoutMs));
+
+    if (inBytes != NULL) {
+      for (size_t i = 0; i < numWords; i++) {
+        inBytes[i] = (uint8_t)(rxWords[i] & 0xFFU);
+      }
+      inBytes += numWords;
+    }
+    if (outBytes != NULL) {
+      outBytes += numWords;
+    }
+    numBytes -= numWords;
+  }
+
   return OBC_ERR_CODE_SUCCESS;
 }
 
@@ -3,8 +3,13 @@
 #include "obc_errors.h"
 #include "spi.h"
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+// Largest number of words moved by one DMA transfer in dmaSpiTransferBytes
+#define SPI_DMA_MAX_BURST_WORDS 128U
+
 /**
  * @brief initalizes DMA for facilitating spi transfers for spiReg
  *
@@ -34,6 +39,52 @@ void initDmaSpiSemaphores(void);
 obc_error_code_t dmaSpiTransmitandReceiveBytes(spiBASE_t *spiReg, uint16_t *txData, uint16_t *rxData, size_t dataLen,
                                                uint32_t spiMutexTimeoutMs, uint32_t transferCompleteTimeoutMs);
 
+/**
+ * @brief Start a DMA transfer over SPI without waiting for it to finish
+ *
+ * For buses whose DMA completion is handled by a driver instead of dmaSpiTransmitandReceiveBytes (see
+ * dmaGroupANotification). Must be called in privileged mode, e.g. from an ISR, and the transfer must be ended with
+ * dmaSpiEndTransferFromISR once the DMA has finished.
+ *
+ * @param spiReg the SPI bus to use for the transfer
+ * @param txData array of uint16_t to be sent over the SPI bus
+ * @param rxData buffer of atleast dataLen size to hold the received bytes
+ * @param dataLen number of uint16_t to send
+ *
+ * @return obc_error_code_t - whether or not the transfer was started
+ */
+obc_error_code_t dmaSpiStartTransferFromISR(spiBASE_t *spiReg, uint16_t *txData, uint16_t *rxData, size_t dataLen);
+
+/**
+ * @brief Stop the SPI from making DMA requests after a transfer started by dmaSpiStartTransferFromISR
+ *
+ * @param spiReg the SPI bus the transfer was on
+ */
+void dmaSpiEndTransferFromISR(spiBASE_t *spiReg);
+
+/**
+ * @brief Check whether the DMA has been set up for transfers on spiReg
+ *
+ * @param spiReg the SPI bus to check
+ *
+ * @return bool - true if spiDmaInit and initDmaSpiSemaphores have been called for the bus
+ */
+bool isSpiDmaEnabled(spiBASE_t *spiReg);
+
+/**
+ * @brief Uses the DMA to transmit and receive bytes over SPI, through word buffers kept for the bus
+ *
+ * @param spiReg the SPI bus to use for the transfer
+ * @param outBytes bytes to send, or NULL to send zeros
+ * @param inBytes buffer of atleast numBytes size to hold the received bytes, or NULL to discard them
+ * @param numBytes number of bytes to send; transfers longer than SPI_DMA_MAX_BURST_WORDS are split up
+ * @param transferCompleteTimeoutMs time to wait for each DMA transfer to finish
+ *
+ * @return obc_error_code_t - whether or not the transfer was successful
+ */
+obc_error_code_t dmaSpiTransferBytes(spiBASE_t *spiReg, const uint8_t *outBytes, uint8_t *inBytes, size_t numBytes,
+                                     uint32_t transferCompleteTimeoutMs);
+
 /**
  * @brief callback function to be called from ISR when DMA Block transfer is complete for SPI1
  */
@@ -1,4 +1,5 @@
 #include "obc_spi_io.h"
+#include "obc_spi_dma.h"
 #include "obc_errors.h"
 #include "obc_logging.h"
 
@@ -9,6 +10,7 @@
 #include <gio.h>
 #include <spi.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 
 // This includes SPI2 which isn't available on the RM46 PGE package
@@ -23,6 +25,17 @@
 #define SPI_FLAG_DESYNC 0x08U     // Desynchronization error
 #define SPI_FLAG_BITERR 0x10U     // Bit error
 #define SPI_FLAG_RXOVRNINT 0x40U  // Receive overrun interrupt flag
+#define SPI_FLAG_RXINT 0x100U     // Received word ready in SPIBUF
+
+// SPIDAT1 control fields
+#define SPI_DAT1_CSHOLD 0x10000000U
+#define SPI_DAT1_WDEL 0x04000000U
+#define SPI_DAT1_DFSEL_SHIFT 24U
+#define SPI_DAT1_CSNR_SHIFT 16U
+
+// Bursts at least this long are moved by the DMA on buses it's set up for
+#define SPI_DMA_THRESHOLD_BYTES 32U
+#define SPI_DMA_TRANSFER_TIMEOUT_MS 100U
 
 #define SPI_BLOCKING_TIMEOUT pdMS_TO_TICKS(1000)
 
@@ -35,6 +48,26 @@
  */
 static void spiLogErrors(uint32_t spiErr);
 
+/**
+ * @brief Move a burst of bytes over SPI, holding chip select between all of them.
+ * @param spiReg The SPI register to use. The caller must own its mutex.
+ * @param spiDataFormat The SPI data format options.
+ * @param outBytes The bytes to send, or NULL to send zeros.
+ * @param inBytes Buffer to store the received bytes, or NULL to discard them.
+ * @param numBytes The number of bytes to send and receive.
+ * @return OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t spiTransferBurst(spiBASE_t *spiReg, spiDAT1_t *spiDataFormat, const uint8_t *outBytes,
+                                         uint8_t *inBytes, size_t numBytes);
+
+/**
+ * @brief Write bytes straight to SPIDAT1, one word after the other.
+ * @param holdLast Whether to keep chip select held after the last byte.
+ * @return uint32_t The SPIFLG error bits.
+ */
+static uint32_t spiStreamWords(spiBASE_t *spiReg, spiDAT1_t *spiDataFormat, const uint8_t *outBytes, uint8_t *inBytes,
+                               size_t numBytes, bool holdLast);
+
 // TODO: Deprecate this once codebase is refactored to allow non-SPI pins to be used as chip selects
 static spiBASE_t *portToReg(gioPORT_t *port);
 
@@ -63,6 +96,19 @@ obc_error_code_t spiTakeBusMutex(spiBASE_t *spi) {
   return OBC_ERR_CODE_MUTEX_TIMEOUT;
 }
 
+obc_error_code_t spiTryTakeBusMutex(spiBASE_t *spi) {
+  obc_error_code_t errCode;
+
+  SemaphoreHandle_t spiMutex;
+  RETURN_IF_ERROR_CODE(getSpiMutex(spi, &spiMutex));
+
+  if (xSemaphoreTakeRecursive(spiMutex, 0) == pdTRUE) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  return OBC_ERR_CODE_MUTEX_TIMEOUT;
+}
+
 obc_error_code_t spiReleaseBusMutex(spiBASE_t *spi) {
   obc_error_code_t errCode;
 
@@ -156,19 +202,7 @@ obc_error_code_t spiTransmitBytes(spiBASE_t *spiReg, spiDAT1_t *spiDataFormat, u
     return OBC_ERR_CODE_NOT_MUTEX_OWNER;
   }
 
-  uint16_t spiWordOut;
-  for (size_t i = 0; i < numBytes; i++) {
-    // The SPI HAL functions take 16-bit arguments, but we're using 8-bit word size
-    spiWordOut = (uint16_t)outBytes[i];
-
-    uint32_t spiErr = spiTransmitData(spiReg, spiDataFormat, 1, &spiWordOut) & SPI_FLAG_ERR_MASK;
-
-    if (spiErr != SPI_FLAG_SUCCESS) {
-      spiLogErrors(spiErr);
-      return OBC_ERR_CODE_SPI_FAILURE;
-    }
-  }
-
+  RETURN_IF_ERROR_CODE(spiTransferBurst(spiReg, spiDataFormat, outBytes, NULL, numBytes));
   return OBC_ERR_CODE_SUCCESS;
 }
 
@@ -186,21 +220,7 @@ obc_error_code_t spiReceiveBytes(spiBASE_t *spiReg, spiDAT1_t *spiDataFormat, ui
     return OBC_ERR_CODE_NOT_MUTEX_OWNER;
   }
 
-  uint16_t spiWordIn;
-  for (size_t i = 0; i < numBytes; i++) {
-    // The SPI HAL functions take 16-bit arguments, but we're using 8-bit word size
-    spiWordIn = (uint16_t)inBytes[i];
-
-    uint32_t spiErr = spiReceiveData(spiReg, spiDataFormat, 1, &spiWordIn) & SPI_FLAG_ERR_MASK;
-
-    if (spiErr != SPI_FLAG_SUCCESS) {
-      spiLogErrors(spiErr);
-      return OBC_ERR_CODE_SPI_FAILURE;
-    }
-
-    inBytes[i] = (uint8_t)(spiWordIn & 0xFFU);
-  }
-
+  RETURN_IF_ERROR_CODE(spiTransferBurst(spiReg, spiDataFormat, NULL, inBytes, numBytes));
   return OBC_ERR_CODE_SUCCESS;
 }
 
@@ -219,25 +239,85 @@ obc_error_code_t spiTransmitAndReceiveBytes(spiBASE_t *spiReg, spiDAT1_t *spiDat
     return OBC_ERR_CODE_NOT_MUTEX_OWNER;
   }
 
-  uint16_t spiWordOut;
-  uint16_t spiWordIn;
-  for (size_t i = 0; i < numBytes; i++) {
-    // The SPI HAL functions take 16-bit arguments, but we're using 8-bit word size
-    spiWordOut = (uint16_t)outBytes[i];
+  RETURN_IF_ERROR_CODE(spiTransferBurst(spiReg, spiDataFormat, outBytes, inBytes, numBytes));
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t spiTransferBurst(spiBASE_t *spiReg, spiDAT1_t *spiDataFormat, const uint8_t *outBytes,
+                                         uint8_t *inBytes, size_t numBytes) {
+  obc_error_code_t errCode;
 
-    uint32_t spiErr = spiTransmitAndReceiveData(spiReg, spiDataFormat, 1, &spiWordOut, &spiWordIn) & SPI_FLAG_ERR_MASK;
+  if (numBytes == 0) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
 
+  uint32_t spiErr;
+  if (numBytes < SPI_DMA_THRESHOLD_BYTES || !isSpiDmaEnabled(spiReg)) {
+    spiErr = spiStreamWords(spiReg, spiDataFormat, outBytes, inBytes, numBytes, false);
     if (spiErr != SPI_FLAG_SUCCESS) {
       spiLogErrors(spiErr);
       return OBC_ERR_CODE_SPI_FAILURE;
     }
+    return OBC_ERR_CODE_SUCCESS;
+  }
 
-    inBytes[i] = (uint8_t)(spiWordIn & 0xFFU);
+  // The DMA writes SPIDAT0, which sends with the control fields last written to SPIDAT1. The first byte goes through
+  // SPIDAT1 to set them for this burst (with chip select held), and the last one to release chip select.
+  spiErr = spiStreamWords(spiReg, spiDataFormat, outBytes, inBytes, 1, true);
+  if (spiErr != SPI_FLAG_SUCCESS) {
+    spiLogErrors(spiErr);
+    return OBC_ERR_CODE_SPI_FAILURE;
+  }
+
+  size_t numDmaBytes = numBytes - 2;
+  RETURN_IF_ERROR_CODE(dmaSpiTransferBytes(spiReg, (outBytes == NULL) ? NULL : &outBytes[1],
+                                           (inBytes == NULL) ? NULL : &inBytes[1], numDmaBytes,
+                                           SPI_DMA_TRANSFER_TIMEOUT_MS));
+
+  size_t last = numBytes - 1;
+  spiErr = spiStreamWords(spiReg, spiDataFormat, (outBytes == NULL) ? NULL : &outBytes[last],
+                          (inBytes == NULL) ? NULL : &inBytes[last], 1, false);
+  if (spiErr != SPI_FLAG_SUCCESS) {
+    spiLogErrors(spiErr);
+    return OBC_ERR_CODE_SPI_FAILURE;
   }
 
   return OBC_ERR_CODE_SUCCESS;
 }
 
+static uint32_t spiStreamWords(spiBASE_t *spiReg, spiDAT1_t *spiDataFormat, const uint8_t *outBytes, uint8_t *inBytes,
+                               size_t numBytes, bool holdLast) {
+  // Same as what the HAL's spiTransmitData/spiReceiveData write, but worked out once for the whole burst
+  uint32_t control = ((uint32_t)spiDataFormat->DFSEL << SPI_DAT1_DFSEL_SHIFT) |
+                     ((uint32_t)spiDataFormat->CSNR << SPI_DAT1_CSNR_SHIFT) |
+                     (spiDataFormat->WDEL ? SPI_DAT1_WDEL : 0U);
+
+  for (size_t i = 0; i < numBytes; i++) {
+    uint32_t spiErr = spiReg->FLG & SPI_FLAG_ERR_MASK;
+    if (spiErr != SPI_FLAG_SUCCESS) {
+      return spiErr;
+    }
+
+    // Chip select stays asserted until the burst's last byte has been sent
+    uint32_t csHold = (holdLast || (i + 1 < numBytes)) ? SPI_DAT1_CSHOLD : 0U;
+
+    // The SPI takes 16-bit words, but we're using 8-bit word size
+    uint32_t spiWordOut = (outBytes == NULL) ? 0U : (uint32_t)outBytes[i];
+    spiReg->DAT1 = control | csHold | spiWordOut;
+
+    while ((spiReg->FLG & SPI_FLAG_RXINT) == 0U) {
+    }
+
+    // Always read SPIBUF so that a transmit-only burst doesn't overrun the receiver
+    uint8_t spiWordIn = (uint8_t)(spiReg->BUF & 0xFFU);
+    if (inBytes != NULL) {
+      inBytes[i] = spiWordIn;
+    }
+  }
+
+  return spiReg->FLG & SPI_FLAG_ERR_MASK;
+}
+
 static void spiLogErrors(uint32_t spiErr) {
   if (spiErr & SPI_FLAG_DLENERR) LOG_ERROR_CODE(OBC_ERR_CODE_SPI_DATA_LENGTH_ERROR);
   if (spiErr & SPI_FLAG_TIMEOUT) LOG_ERROR_CODE(OBC_ERR_CODE_SPI_TIMEOUT);
@@ -52,6 +52,16 @@ obc_error_code_t assertChipSelect(gioPORT_t *spiPort, uint8_t csNum);
  */
 obc_error_code_t spiTakeBusMutex(spiBASE_t *spiReg);
 
+/**
+ * @brief Take the mutex for the specified SPI port if nothing else holds it, without waiting.
+ *
+ * @param spiReg The SPI register to use.
+ *
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the mutex was taken, OBC_ERR_CODE_MUTEX_TIMEOUT if another task
+ * holds it, error code otherwise.
+ */
+obc_error_code_t spiTryTakeBusMutex(spiBASE_t *spiReg);
+
 /**
  * @brief Release the mutex for the specified SPI port and chip select pin.
  *
@@ -75,6 +85,9 @@ obc_error_code_t spiTransmitByte(spiBASE_t *spiReg, spiDAT1_t *spiDataFormat, ui
 
 /**
  * @brief Send multiple bytes via SPI.
+ *
+ * The bytes are sent as one burst with chip select held between them. Bursts of SPI_DMA_THRESHOLD_BYTES or more
+ * are moved by the DMA on buses it has been set up for.
  * @param spiReg The SPI register to use.
  * @param spiDataFormat The SPI data format options.
  * @param outBytes The bytes to send.
@@ -94,6 +107,9 @@ obc_error_code_t spiReceiveByte(spiBASE_t *spiReg, spiDAT1_t *spiDataFormat, uin
 
 /**
  * @brief Receive multiple bytes via SPI.
+ *
+ * The bytes are sent as one burst with chip select held between them. Bursts of SPI_DMA_THRESHOLD_BYTES or more
+ * are moved by the DMA on buses it has been set up for.
  * @param spiReg The SPI register to use.
  * @param spiDataFormat The SPI data format options.
  * @param inBytes Buffer to store the received byte.
@@ -114,6 +130,9 @@ obc_error_code_t spiTransmitAndReceiveByte(spiBASE_t *spiReg, spiDAT1_t *spiData
 
 /**
  * @brief Send and receive multiple bytes via SPI.
+ *
+ * The bytes are sent as one burst with chip select held between them. Bursts of SPI_DMA_THRESHOLD_BYTES or more
+ * are moved by the DMA on buses it has been set up for.
  * @param spiReg The SPI register to use.
  * @param spiDataFormat The SPI data format options.
  * @param outBytes The byte to send.
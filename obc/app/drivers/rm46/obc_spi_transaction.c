@@ -0,0 +1,321 @@
+#include "obc_spi_transaction.h"
+#include "obc_spi_io.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+#include "obc_assert.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+#include <os_queue.h>
+#include <os_semphr.h>
+
+#include <gio.h>
+#include <spi.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CS_ASSERTED 0
+#define CS_DEASSERTED 1
+
+static QueueHandle_t transactionQueues[SPI_TRANSACTION_NUM_PRIORITIES];
+static StaticQueue_t transactionQueueBuffers[SPI_TRANSACTION_NUM_PRIORITIES];
+static uint8_t transactionQueueStorage[SPI_TRANSACTION_NUM_PRIORITIES]
+                                      [SPI_TRANSACTION_QUEUE_LENGTH * sizeof(spi_transaction_t *)];
+
+// Given whenever a transaction is queued. The engine checks every queue after taking it, so one give can stand for
+// any number of transactions.
+static SemaphoreHandle_t transactionQueuedSemaphore = NULL;
+static StaticSemaphore_t transactionQueuedSemaphoreBuffer;
+
+static TaskHandle_t spiEngineTask = NULL;
+
+// Transactions taken off the queues while a task outside the engine (e.g. the SD card driver) held their bus, oldest
+// first. They wait here for their bus while the engine runs transactions for the other buses.
+#define SPI_TRANSACTION_MAX_PARKED SPI_TRANSACTION_QUEUE_LENGTH
+static spi_transaction_t *parkedTransactions[SPI_TRANSACTION_MAX_PARKED];
+static uint8_t numParkedTransactions = 0;
+
+// Nothing signals the engine when another task releases a bus, so parked transactions are retried this often
+#define SPI_PARKED_TRANSACTION_RETRY_PERIOD 1U
+
+/**
+ * @brief Run a transaction on the calling task.
+ * @param transaction The transaction to run.
+ * @return OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t runTransaction(const spi_transaction_t *transaction);
+
+/**
+ * @brief Run a transaction whose bus mutex is already taken, releasing the mutex afterwards.
+ * @param transaction The transaction to run.
+ * @return OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t runTransactionOnTakenBus(const spi_transaction_t *transaction);
+
+/**
+ * @brief Run a transaction's segments, with the bus mutex already taken.
+ */
+static obc_error_code_t runSegments(const spi_transaction_t *transaction);
+
+/**
+ * @brief Record a transaction's result and tell whoever is waiting for it.
+ */
+static void finishTransaction(spi_transaction_t *transaction, obc_error_code_t result);
+
+/**
+ * @brief Take the oldest transaction of the highest priority waiting whose bus is free, and take its bus mutex.
+ *
+ * Transactions found with their bus held are parked, and transactions on a bus with older ones parked are parked
+ * behind them, so each bus still runs its transactions in order.
+ *
+ * @return The transaction, or NULL if none can run now
+ */
+static spi_transaction_t *takeNextTransaction(void);
+
+/**
+ * @brief Take the oldest parked transaction of a priority whose bus is free, and take its bus mutex.
+ * @param priority The priority to look for.
+ * @return The transaction, or NULL if none can run now
+ */
+static spi_transaction_t *takeParkedTransaction(spi_transaction_priority_t priority);
+
+/**
+ * @brief Check whether a transaction is parked for a bus.
+ */
+static bool isBusParked(const spiBASE_t *spiReg);
+
+void obcTaskInitSpiEngine(void) {
+  for (uint8_t i = 0; i < SPI_TRANSACTION_NUM_PRIORITIES; i++) {
+    transactionQueues[i] = xQueueCreateStatic(SPI_TRANSACTION_QUEUE_LENGTH, sizeof(spi_transaction_t *),
+                                              transactionQueueStorage[i], &transactionQueueBuffers[i]);
+    ASSERT(transactionQueues[i] != NULL);
+  }
+
+  transactionQueuedSemaphore = xSemaphoreCreateBinaryStatic(&transactionQueuedSemaphoreBuffer);
+  ASSERT(transactionQueuedSemaphore != NULL);
+}
+
+void obcTaskFunctionSpiEngine(void *pvParameters) {
+  (void)pvParameters;
+
+  spiEngineTask = xTaskGetCurrentTaskHandle();
+
+  while (1) {
+    spi_transaction_t *transaction = takeNextTransaction();
+    if (transaction == NULL) {
+      TickType_t waitTicks = (numParkedTransactions > 0) ? SPI_PARKED_TRANSACTION_RETRY_PERIOD : portMAX_DELAY;
+      xSemaphoreTake(transactionQueuedSemaphore, waitTicks);
+      continue;
+    }
+
+    finishTransaction(transaction, runTransactionOnTakenBus(transaction));
+  }
+}
+
+obc_error_code_t spiSubmitTransaction(spi_transaction_t *transaction) {
+  if (transaction == NULL || transaction->device == NULL || transaction->segments == NULL ||
+      transaction->numSegments == 0 || transaction->priority >= SPI_TRANSACTION_NUM_PRIORITIES) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (transactionQueuedSemaphore == NULL) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  if (xQueueSend(transactionQueues[transaction->priority], &transaction, 0) != pdPASS) {
+    return OBC_ERR_CODE_QUEUE_FULL;
+  }
+
+  xSemaphoreGive(transactionQueuedSemaphore);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t spiTransact(spi_transaction_t *transaction) {
+  obc_error_code_t errCode;
+
+  if (transaction == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  const bool engineIsRunning =
+      (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) && (spiEngineTask != NULL);
+
+  if (!engineIsRunning || xTaskGetCurrentTaskHandle() == spiEngineTask) {
+    transaction->notifyTask = NULL;
+    finishTransaction(transaction, runTransaction(transaction));
+    return transaction->result;
+  }
+
+  transaction->notifyTask = xTaskGetCurrentTaskHandle();
+  RETURN_IF_ERROR_CODE(spiSubmitTransaction(transaction));
+
+  // Transactions always finish, since every step in them has a timeout. Waiting any less would leave the engine
+  // with a transaction on a stack frame that's gone.
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+  return transaction->result;
+}
+
+static spi_transaction_t *takeNextTransaction(void) {
+  for (uint8_t priority = 0; priority < SPI_TRANSACTION_NUM_PRIORITIES; priority++) {
+    spi_transaction_t *transaction = takeParkedTransaction((spi_transaction_priority_t)priority);
+    if (transaction != NULL) {
+      return transaction;
+    }
+
+    // Once there's nowhere to park transactions, the rest stay queued until a bus frees up
+    while (numParkedTransactions < SPI_TRANSACTION_MAX_PARKED &&
+           xQueueReceive(transactionQueues[priority], &transaction, 0) == pdPASS) {
+      spiBASE_t *spiReg = transaction->device->spiReg;
+      if (!isBusParked(spiReg)) {
+        obc_error_code_t errCode = spiTryTakeBusMutex(spiReg);
+        if (errCode == OBC_ERR_CODE_SUCCESS) {
+          return transaction;
+        }
+        if (errCode != OBC_ERR_CODE_MUTEX_TIMEOUT) {
+          finishTransaction(transaction, errCode);
+          continue;
+        }
+      }
+
+      parkedTransactions[numParkedTransactions++] = transaction;
+    }
+  }
+
+  return NULL;
+}
+
+static spi_transaction_t *takeParkedTransaction(spi_transaction_priority_t priority) {
+  for (uint8_t i = 0; i < numParkedTransactions; i++) {
+    spi_transaction_t *transaction = parkedTransactions[i];
+    if (transaction->priority != priority) {
+      continue;
+    }
+
+    // An older transaction on the same bus of at least this priority goes first
+    bool isBehindOlder = false;
+    for (uint8_t j = 0; j < i && !isBehindOlder; j++) {
+      isBehindOlder = parkedTransactions[j]->device->spiReg == transaction->device->spiReg &&
+                      parkedTransactions[j]->priority <= priority;
+    }
+    if (isBehindOlder) {
+      continue;
+    }
+
+    obc_error_code_t errCode = spiTryTakeBusMutex(transaction->device->spiReg);
+    if (errCode == OBC_ERR_CODE_MUTEX_TIMEOUT) {
+      continue;
+    }
+
+    for (uint8_t j = i + 1; j < numParkedTransactions; j++) {
+      parkedTransactions[j - 1] = parkedTransactions[j];
+    }
+    numParkedTransactions--;
+
+    if (errCode != OBC_ERR_CODE_SUCCESS) {
+      finishTransaction(transaction, errCode);
+      return takeParkedTransaction(priority);
+    }
+    return transaction;
+  }
+
+  return NULL;
+}
+
+static bool isBusParked(const spiBASE_t *spiReg) {
+  for (uint8_t i = 0; i < numParkedTransactions; i++) {
+    if (parkedTransactions[i]->device->spiReg == spiReg) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static obc_error_code_t runTransaction(const spi_transaction_t *transaction) {
+  obc_error_code_t errCode;
+
+  if (transaction->device == NULL || transaction->segments == NULL || transaction->numSegments == 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(spiTakeBusMutex(transaction->device->spiReg));
+
+  return runTransactionOnTakenBus(transaction);
+}
+
+static obc_error_code_t runTransactionOnTakenBus(const spi_transaction_t *transaction) {
+  obc_error_code_t errCode;
+
+  obc_error_code_t transactionErrCode = OBC_ERR_CODE_SUCCESS;
+  if (transaction->check != NULL) {
+    transactionErrCode = transaction->check(transaction);
+  }
+  if (transactionErrCode == OBC_ERR_CODE_SUCCESS) {
+    transactionErrCode = runSegments(transaction);
+  }
+
+  // Chip select is never left asserted, even if a segment failed
+  gioSetBit(transaction->device->csPort, transaction->device->csPin, CS_DEASSERTED);
+
+  RETURN_IF_ERROR_CODE(spiReleaseBusMutex(transaction->device->spiReg));
+
+  return transactionErrCode;
+}
+
+static obc_error_code_t runSegments(const spi_transaction_t *transaction) {
+  obc_error_code_t errCode;
+
+  const spi_device_t *device = transaction->device;
+  spiDAT1_t dataFormat = device->dataFormat;
+
+  bool csAsserted = false;
+  for (uint8_t i = 0; i < transaction->numSegments; i++) {
+    const spi_segment_t *segment = &transaction->segments[i];
+
+    if (!csAsserted) {
+      gioSetBit(device->csPort, device->csPin, CS_ASSERTED);
+      csAsserted = true;
+    }
+
+    if (segment->numBytes > 0) {
+      // The burst functions don't modify the bytes they send
+      if (segment->outBytes != NULL && segment->inBytes != NULL) {
+        RETURN_IF_ERROR_CODE(spiTransmitAndReceiveBytes(device->spiReg, &dataFormat, (uint8_t *)segment->outBytes,
+                                                        segment->inBytes, segment->numBytes));
+      } else if (segment->outBytes != NULL) {
+        RETURN_IF_ERROR_CODE(
+            spiTransmitBytes(device->spiReg, &dataFormat, (uint8_t *)segment->outBytes, segment->numBytes));
+      } else if (segment->inBytes != NULL) {
+        RETURN_IF_ERROR_CODE(spiReceiveBytes(device->spiReg, &dataFormat, segment->inBytes, segment->numBytes));
+      } else {
+        return OBC_ERR_CODE_INVALID_ARG;
+      }
+    }
+
+    if (segment->deassertCsAfter) {
+      gioSetBit(device->csPort, device->csPin, CS_DEASSERTED);
+      csAsserted = false;
+    }
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static void finishTransaction(spi_transaction_t *transaction, obc_error_code_t result) {
+  if (result != OBC_ERR_CODE_SUCCESS) {
+    LOG_ERROR_CODE(result);
+  }
+
+  transaction->result = result;
+
+  if (transaction->callback != NULL) {
+    transaction->callback(transaction);
+  }
+
+  // Last, since the waiting task may reuse the transaction as soon as it's notified
+  if (transaction->notifyTask != NULL) {
+    xTaskNotifyGive(transaction->notifyTask);
+  }
+}
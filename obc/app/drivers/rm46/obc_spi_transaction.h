@@ -0,0 +1,112 @@
+#pragma once
+
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <spi.h>
+#include <gio.h>
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+/* SPI transactions are queued to the SPI engine task, which runs them one after the other. Before each transaction it
+ * picks the oldest one of the highest priority waiting, so an urgent transaction (e.g. a radio FIFO refill) only ever
+ * waits for the transaction already running, however much storage traffic is queued. Long segments are moved by the
+ * DMA on buses it's set up for (see spiTransmitAndReceiveBytes).
+ *
+ * The engine takes the bus mutex around each transaction, so drivers that still take the mutex and drive chip select
+ * themselves can share a bus with it. The SD card driver is one of those, since its multi-block transfers keep chip
+ * select asserted while polling for tokens between sectors, which a fixed list of segments can't express. The engine
+ * never waits for such a driver: a transaction whose bus is held (e.g. the FRAM's, behind an SD card write) is parked
+ * until the bus is free, while transactions for other buses carry on. */
+
+#define SPI_TRANSACTION_QUEUE_LENGTH 8U
+
+typedef enum {
+  SPI_TRANSACTION_PRIORITY_URGENT,  // Latency bound, e.g. radio FIFOs
+  SPI_TRANSACTION_PRIORITY_NORMAL,
+  SPI_TRANSACTION_PRIORITY_BULK,  // Traffic that can wait behind everything else, e.g. bulk storage transfers
+  SPI_TRANSACTION_NUM_PRIORITIES,
+} spi_transaction_priority_t;
+
+/**
+ * @brief A device on a SPI bus
+ */
+typedef struct {
+  spiBASE_t *spiReg;
+  gioPORT_t *csPort;
+  uint8_t csPin;
+  spiDAT1_t dataFormat;
+} spi_device_t;
+
+/**
+ * @brief Part of a transaction with chip select asserted
+ */
+typedef struct {
+  const uint8_t *outBytes;  // NULL to send zeros
+  uint8_t *inBytes;         // NULL to discard the received bytes
+  size_t numBytes;
+  bool deassertCsAfter;  // Deassert chip select after this segment; it always is after the last one
+} spi_segment_t;
+
+struct spi_transaction;
+
+/**
+ * @brief Called from the SPI engine task when a transaction has finished; must not block
+ */
+typedef void (*spi_transaction_callback_t)(struct spi_transaction *transaction);
+
+/**
+ * @brief Called with the bus mutex held before a transaction's first segment; must not block
+ * @return OBC_ERR_CODE_SUCCESS to run the segments, otherwise the error code the transaction fails with
+ */
+typedef obc_error_code_t (*spi_transaction_check_t)(const struct spi_transaction *transaction);
+
+/**
+ * @brief A list of segments to run on a device without other traffic on the bus in between
+ *
+ * The transaction and everything it points to must stay valid until it has finished.
+ */
+typedef struct spi_transaction {
+  const spi_device_t *device;
+  const spi_segment_t *segments;
+  uint8_t numSegments;
+  spi_transaction_priority_t priority;
+
+  spi_transaction_check_t check;        // Optional; for device state that's guarded by the bus mutex
+  spi_transaction_callback_t callback;  // Optional
+  void *context;                        // For the check and callback
+  TaskHandle_t notifyTask;              // Optional; sent a task notification when the transaction has finished
+
+  obc_error_code_t result;  // Set before the callback and notification
+} spi_transaction_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Queue a transaction to the SPI engine task without waiting for it.
+ * @param transaction The transaction to queue. Its result, callback and notifyTask report when it has finished.
+ * @return OBC_ERR_CODE_SUCCESS if the transaction was queued, OBC_ERR_CODE_QUEUE_FULL if its priority's queue is full,
+ * otherwise error code
+ */
+obc_error_code_t spiSubmitTransaction(spi_transaction_t *transaction);
+
+/**
+ * @brief Run a transaction and wait for it to finish.
+ *
+ * The transaction is run by the caller if the SPI engine task isn't running (e.g. before the scheduler starts), or if
+ * the caller is the SPI engine task itself. Otherwise, it's queued and the caller blocks on a task notification.
+ * The caller must not hold the bus mutex, since the engine needs it to run the transaction.
+ *
+ * @param transaction The transaction to run. Its notifyTask is overwritten.
+ * @return The transaction's result
+ */
+obc_error_code_t spiTransact(spi_transaction_t *transaction);
+
+#ifdef __cplusplus
+}
+#endif
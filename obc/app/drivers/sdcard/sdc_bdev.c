@@ -11,6 +11,7 @@
 #include "sdc_diskio.h"
 #include "sdc_rm46.h"
 #include "obc_spi_io.h"
+#include "obc_spi_dma.h"
 #include "obc_logging.h"
 #include "obc_assert.h"
 #include "obc_board_config.h"
@@ -75,6 +76,10 @@ STATIC_ASSERT(SDC_ACTION_NUM_ATTEMPTS_DEFAULT <= 255, "SDC_ACTION_NUM_ATTEMPTS_D
 
 #define SDC_MOSI_HIGH 0xFFU  // Keep MOSI high during read operations
 
+// A sector takes well under a millisecond at any SPI clock the card runs at
+#define SDC_DMA_SPI_MUTEX_TIMEOUT_MS 100U
+#define SDC_DMA_TRANSFER_TIMEOUT_MS 100U
+
 /*---------------------------------------------*/
 /* Global Variables                            */
 /*---------------------------------------------*/
@@ -92,6 +97,13 @@ static volatile DSTATUS stat = STA_NOINIT; /* Disk status */
 static uint8_t cardType;                   /* Card type flags: b0:MMC, b1:SDC, b2:Block addressing */
 static sdc_power_t powerFlag = POWER_OFF;  /* indicates if "power" is on */
 
+// Sectors are clocked in and out by DMA, which moves one 16-bit SPI word per byte
+static uint16_t sdcDmaTxWords[SD_SECTOR_SIZE];
+static uint16_t sdcDmaRxWords[SD_SECTOR_SIZE];
+static bool sdcDmaTxWordsAreIdle = false;  // Whether sdcDmaTxWords holds only SDC_MOSI_HIGH, as reads send
+
+static sdc_transfer_stats_t sdcTransferStats;
+
 /*---------------------------------------------*/
 /* SD Card Private Functions                   */
 /*---------------------------------------------*/
@@ -159,6 +171,65 @@ static void turnOffSDC(void) { powerFlag = POWER_OFF; }
  */
 static sdc_power_t checkPower(void) { return powerFlag; }
 
+/**
+ * @brief Clock a sector's worth of SPI words between sdcDmaTxWords and sdcDmaRxWords by DMA. The calling task blocks
+ * until the transfer is done, leaving the CPU to other tasks.
+ *
+ * @return bool True if the transfer finished, false otherwise.
+ */
+static bool transferSectorByDma(void) {
+  obc_error_code_t errCode;
+
+  // Assume CS is already asserted
+
+  TickType_t startTicks = xTaskGetTickCount();
+  LOG_IF_ERROR_CODE(dmaSpiTransmitandReceiveBytes(SDC_SPI_REG, sdcDmaTxWords, sdcDmaRxWords, SD_SECTOR_SIZE,
+                                                  SDC_DMA_SPI_MUTEX_TIMEOUT_MS, SDC_DMA_TRANSFER_TIMEOUT_MS));
+  sdcTransferStats.dmaWaitTicks += xTaskGetTickCount() - startTicks;
+
+  return errCode == OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Receive a sector's data from the SD card by DMA.
+ * @param buff Buffer of SD_SECTOR_SIZE bytes to store the received data.
+ * @return bool True if the data was received successfully, false otherwise.
+ */
+static bool rcvSectorByDma(uint8_t *buff) {
+  if (!sdcDmaTxWordsAreIdle) {
+    for (uint32_t i = 0; i < SD_SECTOR_SIZE; i++) {
+      sdcDmaTxWords[i] = SDC_MOSI_HIGH;
+    }
+    sdcDmaTxWordsAreIdle = true;
+  }
+
+  if (!transferSectorByDma()) return false;
+
+  for (uint32_t i = 0; i < SD_SECTOR_SIZE; i++) {
+    buff[i] = (uint8_t)sdcDmaRxWords[i];
+  }
+
+  return true;
+}
+
+#if _READONLY == 0
+
+/**
+ * @brief Send a sector's data to the SD card by DMA.
+ * @param buff Buffer of SD_SECTOR_SIZE bytes to send.
+ * @return bool True if the data was sent successfully, false otherwise.
+ */
+static bool sendSectorByDma(const uint8_t *buff) {
+  for (uint32_t i = 0; i < SD_SECTOR_SIZE; i++) {
+    sdcDmaTxWords[i] = buff[i];
+  }
+  sdcDmaTxWordsAreIdle = false;
+
+  return transferSectorByDma();
+}
+
+#endif /* _READONLY */
+
 /**
  * @brief Receive a data packet from the SD card.
  * @param buff Buffer to store the received data.
@@ -185,11 +256,15 @@ static bool rcvDataBlock(uint8_t *buff, uint32_t btr) {
   /* If not valid data token, return with error */
   if (token != SDC_CMD17_DATA_TOKEN) return false;
 
-  /* Receive the data block into buffer */
-  while (btr) {
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, buff++));
-    LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, buff++));
-    btr -= 2;
+  /* Receive the data block into buffer; sectors by DMA, and short blocks such as the CSD a byte at a time */
+  if (btr == SD_SECTOR_SIZE) {
+    if (!rcvSectorByDma(buff)) return false;
+  } else {
+    while (btr) {
+      LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, buff++));
+      LOG_IF_ERROR_CODE(spiTransmitAndReceiveByte(SDC_SPI_REG, &sdcSpiConfig, SDC_MOSI_HIGH, buff++));
+      btr -= 2;
+    }
   }
 
   /* Discard CRC */
@@ -218,10 +293,8 @@ static bool sendDataBlock(const uint8_t *buff, uint8_t token) {
   LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, token));  // Send token
 
   if (token != SD_STOP_TRANSMISSION) {
-    for (unsigned int wc = 0; wc < SD_SECTOR_SIZE; wc++) {
-      // Send the data block
-      LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, *buff++));
-    }
+    // Send the data block
+    if (!sendSectorByDma(buff)) return false;
 
     // Send dummy CRC
     LOG_IF_ERROR_CODE(spiTransmitByte(SDC_SPI_REG, &sdcSpiConfig, 0xFF));
@@ -465,6 +538,9 @@ DRESULT disk_read(uint8_t pdrv, uint8_t *buff, uint32_t sector, uint32_t count)
 
   if (!(cardType & CARD_TYPE_BLOCK_ADDR_MASK)) sector *= SD_SECTOR_SIZE; /* Convert to uint8_t address if needed */
 
+  TickType_t startTicks = xTaskGetTickCount();
+  uint32_t numSectors = count;
+
   // Recursive take done so we can send byte when CS is high at the end of transaction
   LOG_IF_ERROR_CODE(spiTakeBusMutex(SDC_SPI_REG));
   if (errCode != OBC_ERR_CODE_SUCCESS) {
@@ -497,6 +573,9 @@ DRESULT disk_read(uint8_t pdrv, uint8_t *buff, uint32_t sector, uint32_t count)
   }
   LOG_IF_ERROR_CODE(spiReleaseBusMutex(SDC_SPI_REG));
 
+  sdcTransferStats.numSectorsRead += numSectors - count;
+  sdcTransferStats.transferTicks += xTaskGetTickCount() - startTicks;
+
   return count ? RES_ERROR : RES_OK;
 }
 
@@ -518,6 +597,9 @@ DRESULT disk_write(uint8_t pdrv, const uint8_t *buff, uint32_t sector, uint32_t
 
   if (!(cardType & (CARD_TYPE_BLOCK_ADDR_MASK))) sector *= SD_SECTOR_SIZE; /* Convert to uint8_t address if needed */
 
+  TickType_t startTicks = xTaskGetTickCount();
+  uint32_t numSectors = count;
+
   // Recursive take done so we can send byte when CS is high at the end of transaction
   LOG_IF_ERROR_CODE(spiTakeBusMutex(SDC_SPI_REG));
   if (errCode != OBC_ERR_CODE_SUCCESS) {
@@ -557,6 +639,9 @@ DRESULT disk_write(uint8_t pdrv, const uint8_t *buff, uint32_t sector, uint32_t
   }
   LOG_IF_ERROR_CODE(spiReleaseBusMutex(SDC_SPI_REG));
 
+  sdcTransferStats.numSectorsWritten += numSectors - count;
+  sdcTransferStats.transferTicks += xTaskGetTickCount() - startTicks;
+
   return count ? RES_ERROR : RES_OK;
 }
 #endif /* _READONLY */
@@ -662,3 +747,13 @@ DRESULT disk_ioctl(uint8_t pdrv, uint8_t ctrl, void *buff) {
 
   return res;
 }
+
+obc_error_code_t getSdcTransferStats(sdc_transfer_stats_t *stats) {
+  if (stats == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  *stats = sdcTransferStats;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -1,6 +1,31 @@
 #pragma once
 
+#include "obc_errors.h"
+
+#include <stdint.h>
+
 typedef enum {
   POWER_OFF,
   POWER_ON,
 } sdc_power_t;
+
+/**
+ * @brief Counts of the SD card driver's transfers since startup, for working out throughput and CPU time left free
+ *
+ * Tick counts are differences of the tick count, so each one only counts the tick interrupts a transfer spanned. Summed
+ * over many transfers they still average out to the time spent.
+ */
+typedef struct {
+  uint32_t numSectorsRead;
+  uint32_t numSectorsWritten;
+  uint32_t transferTicks;  // Ticks spent in disk_read and disk_write
+  uint32_t dmaWaitTicks;   // Ticks of those the calling task spent blocked on sector DMA, with the CPU free
+} sdc_transfer_stats_t;
+
+/**
+ * @brief Get counts of the SD card driver's transfers since startup
+ *
+ * @param stats Buffer to store the counts in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, error code otherwise
+ */
+obc_error_code_t getSdcTransferStats(sdc_transfer_stats_t *stats);
@@ -91,3 +91,24 @@ obc_error_code_t downlinkTelemCmdCallback(cmd_msg_t *cmd) {
 
   return OBC_ERR_CODE_SUCCESS;
 }
+
+obc_error_code_t downlinkTelemQueryCmdCallback(cmd_msg_t *cmd) {
+  obc_error_code_t errCode;
+
+  if (cmd == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (cmd->downlinkTelemQuery.startTime > cmd->downlinkTelemQuery.endTime) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  telemetry_query_t query = {.idMask = cmd->downlinkTelemQuery.idMask,
+                             .startTime = cmd->downlinkTelemQuery.startTime,
+                             .endTime = cmd->downlinkTelemQuery.endTime,
+                             .maxSamplesPerId = cmd->downlinkTelemQuery.maxSamplesPerId};
+
+  RETURN_IF_ERROR_CODE(setTelemetryManagerDownlinkQuery(&query));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -3,6 +3,7 @@
 #include "cc1120_mcu.h"
 #include "cc1120.h"
 #include "cc1120_defs.h"
+#include "cc1120_fifo_dma.h"
 #include "obc_math.h"
 #include "obc_board_config.h"
 
@@ -22,8 +23,6 @@
   (((TXRX_INTERRUPT_THRESHOLD - 1) * 8) / 9600)  // number of bits divided by cc1120 baudrate
 #define TX_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(5000)
 #define RX_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(100)
-#define TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(5000)
-#define SYNC_EVENT_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(30000)
 
 static SemaphoreHandle_t rxSemaphore = NULL;
 static StaticSemaphore_t rxSemaphoreBuffer;
@@ -34,6 +33,17 @@ static StaticSemaphore_t txFifoEmptySemaphoreBuffer;
 static SemaphoreHandle_t syncReceivedSemaphore = NULL;
 static StaticSemaphore_t syncReceivedSemaphoreBuffer;
 
+#if CC1120_FIFO_DMA_MODE == 1
+// Uplinks are streamed here by the RX FIFO threshold interrupt, and passed to the decode task once they've ended
+static uint8_t rxStreamBuffer[((COMMS_MAX_UPLINK_BYTES + TXRX_INTERRUPT_THRESHOLD - 1) / TXRX_INTERRUPT_THRESHOLD) *
+                              TXRX_INTERRUPT_THRESHOLD];
+
+static obc_error_code_t startTxAndStreamFifo(uint8_t *data, uint32_t len);
+
+static obc_error_code_t startRxAndStreamFifo(uint8_t *buffer, uint32_t len, TickType_t syncWordTimeoutTicks,
+                                             uint8_t *numChunks);
+#endif
+
 static obc_error_code_t cc1120SendVariablePktMode(uint8_t *data, uint32_t len);
 
 static obc_error_code_t cc1120SendInifinitePktMode(uint8_t *data, uint32_t len);
@@ -122,6 +132,13 @@ static obc_error_code_t cc1120SendVariablePktMode(uint8_t *data, uint32_t len) {
   uint8_t variableDataLen = (uint8_t)len;
   RETURN_IF_ERROR_CODE(cc1120WriteFifo(&variableDataLen, 1));  // Write packet size
 
+#if CC1120_FIFO_DMA_MODE == 1
+  // Write TXRX_INTERRUPT_THRESHOLD bytes to TX fifo, then let the TX FIFO threshold interrupt write the rest
+  uint32_t firstChunkLen = uint32Min(len, (uint32_t)TXRX_INTERRUPT_THRESHOLD);
+  RETURN_IF_ERROR_CODE(writeFifoBlocking(data, firstChunkLen));
+  RETURN_IF_ERROR_CODE(startTxAndStreamFifo(data + firstChunkLen, len - firstChunkLen));
+  return OBC_ERR_CODE_SUCCESS;
+#else
   // Write TXRX_INTERRUPT_THRESHOLD bytes to TX fifo and activate TX mode
   RETURN_IF_ERROR_CODE(writeFifoBlocking(data, uint32Min(len, (uint32_t)TXRX_INTERRUPT_THRESHOLD)));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_STX));
@@ -141,6 +158,7 @@ static obc_error_code_t cc1120SendVariablePktMode(uint8_t *data, uint32_t len) {
                                            len - groupsOfBytesWritten * TXRX_INTERRUPT_THRESHOLD));
   }
   return OBC_ERR_CODE_SUCCESS;
+#endif
 }
 
 /**
@@ -164,6 +182,16 @@ static obc_error_code_t cc1120SendInifinitePktMode(uint8_t *data, uint32_t len)
 
   // Write TXRX_INTERRUPT_THRESHOLD bytes to TX fifo and activate TX mode
   RETURN_IF_ERROR_CODE(writeFifoBlocking(data, TXRX_INTERRUPT_THRESHOLD));
+#if CC1120_FIFO_DMA_MODE == 1
+  // The TX FIFO threshold interrupt writes the chunks the loop below would, stopping before the last one so that the
+  // packet length mode can be switched back in time
+  uint32_t groupsOfBytesWritten = (len - 1) / TXRX_INTERRUPT_THRESHOLD;
+  if (groupsOfBytesWritten < 1) {
+    groupsOfBytesWritten = 1;
+  }
+  RETURN_IF_ERROR_CODE(startTxAndStreamFifo(data + TXRX_INTERRUPT_THRESHOLD,
+                                            (groupsOfBytesWritten - 1) * TXRX_INTERRUPT_THRESHOLD));
+#else
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_STX));
 
   // Continously wait for the tx fifo to drop below (128 - TXRX_INTERRUPT_THRESHOLD) bytes before writing
@@ -175,6 +203,7 @@ static obc_error_code_t cc1120SendInifinitePktMode(uint8_t *data, uint32_t len)
     RETURN_IF_ERROR_CODE(
         writeFifoBlocking(data + groupsOfBytesWritten * TXRX_INTERRUPT_THRESHOLD, TXRX_INTERRUPT_THRESHOLD));
   }
+#endif
 
   // switch back to fixed packet length mode so that transmission is able to properly end once the remaining bytes are
   // sent
@@ -210,6 +239,95 @@ static obc_error_code_t writeFifoBlocking(uint8_t *data, uint32_t len) {
   return OBC_ERR_CODE_SUCCESS;
 }
 
+#if CC1120_FIFO_DMA_MODE == 1
+/**
+ * @brief Activates TX mode and has the TX FIFO threshold interrupt write data to the TX FIFO, returning once it has
+ * all been written
+ *
+ * @param data - The bytes to write after the ones already in the TX FIFO
+ * @param len - The number of bytes to write
+ * @return obc_error_code_t
+ */
+static obc_error_code_t startTxAndStreamFifo(uint8_t *data, uint32_t len) {
+  obc_error_code_t errCode;
+
+  if (len == 0) {
+    RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_STX));
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  // Started before TX mode so that the first threshold crossing can't be missed. The STX strobe is sent within the
+  // stream's hold on the bus, which is fine since no bursts can start before transmission does.
+  RETURN_IF_ERROR_CODE(cc1120FifoDmaStartTx(data, len));
+
+  obc_error_code_t streamErrCode = cc1120StrobeSpi(CC1120_STROBE_STX);
+  if (streamErrCode == OBC_ERR_CODE_SUCCESS) {
+    streamErrCode = cc1120FifoDmaWait(TX_SEMAPHORE_TIMEOUT);
+  }
+
+  RETURN_IF_ERROR_CODE(cc1120FifoDmaStop(NULL));
+
+  if (streamErrCode != OBC_ERR_CODE_SUCCESS) {
+    LOG_ERROR_CODE(streamErrCode);
+  }
+  return streamErrCode;
+}
+
+/**
+ * @brief Activates RX mode and has the RX FIFO threshold interrupt read the uplink out of the RX FIFO, returning once
+ * the buffer is full or the uplink has stopped
+ *
+ * @param buffer - The buffer to store the received chunks in
+ * @param len - Length of buffer
+ * @param syncWordTimeoutTicks - The amount of time to wait for the syncReceivedSemaphore to become available
+ * @param numChunks - Buffer to store the number of TXRX_INTERRUPT_THRESHOLD byte chunks read out in
+ * @return obc_error_code_t
+ */
+static obc_error_code_t startRxAndStreamFifo(uint8_t *buffer, uint32_t len, TickType_t syncWordTimeoutTicks,
+                                             uint8_t *numChunks) {
+  obc_error_code_t errCode;
+
+  *numChunks = 0;
+
+  if (len < TXRX_INTERRUPT_THRESHOLD) {
+    // Not even one chunk fits, so leave it all in the RX FIFO
+    RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SRX));
+    if (xSemaphoreTake(syncReceivedSemaphore, syncWordTimeoutTicks) != pdPASS) {
+      LOG_ERROR_CODE(OBC_ERR_CODE_SEMAPHORE_TIMEOUT);
+      return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+    }
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  // Started before RX mode so that the first threshold crossing can't be missed
+  RETURN_IF_ERROR_CODE(cc1120FifoDmaStartRx(buffer, len));
+
+  obc_error_code_t streamErrCode = cc1120StrobeSpi(CC1120_STROBE_SRX);
+
+  // wait to receive sync word before continuing
+  if (streamErrCode == OBC_ERR_CODE_SUCCESS && xSemaphoreTake(syncReceivedSemaphore, syncWordTimeoutTicks) != pdPASS) {
+    streamErrCode = OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+  }
+
+  if (streamErrCode == OBC_ERR_CODE_SUCCESS) {
+    // Times out once no chunk has been received for RX_SEMAPHORE_TIMEOUT, since that means we are no longer
+    // receiving. That's how uplinks shorter than the buffer end, so it isn't an error.
+    (void)cc1120FifoDmaWait(RX_SEMAPHORE_TIMEOUT);
+  }
+
+  uint32_t numBytesMoved = 0;
+  RETURN_IF_ERROR_CODE(cc1120FifoDmaStop(&numBytesMoved));
+
+  if (streamErrCode != OBC_ERR_CODE_SUCCESS) {
+    LOG_ERROR_CODE(streamErrCode);
+    return streamErrCode;
+  }
+
+  *numChunks = (uint8_t)(numBytesMoved / TXRX_INTERRUPT_THRESHOLD);
+  return OBC_ERR_CODE_SUCCESS;
+}
+#endif
+
 /**
  * @brief Switches the cc1120 to RX mode to continuously receive bytes and send them to the decode task
  * @param syncWordTimeoutTicks - The amount of time to wait for the syncReceivedSemaphore to become available
@@ -239,20 +357,30 @@ obc_error_code_t cc1120ReceiveToDecodeTask(TickType_t syncWordTimeoutTicks) {
   spiTransferData = INFINITE_PACKET_LENGTH_MODE;
   RETURN_IF_ERROR_CODE(cc1120WriteSpi(CC1120_REGS_PKT_CFG0, &spiTransferData, 1));
 
+  uint8_t dataBuffer[TXRX_INTERRUPT_THRESHOLD];
+
+  // See chapters 8.1, 8.4, 8.5
+  // If we do not stop receiving data, continue looping until COMMS_MAX_UPLINK_BYTES rounded up to the nearest multiple
+  // of TXRX_INTERRUPT_THRESHOLD bytes are received
+  uint8_t rxFifoReadCycles;  // number of times we receive TXRX_INTERRUPT_THRESHOLD bytes and read them out
+#if CC1120_FIFO_DMA_MODE == 1
+  RETURN_IF_ERROR_CODE(
+      startRxAndStreamFifo(rxStreamBuffer, sizeof(rxStreamBuffer), syncWordTimeoutTicks, &rxFifoReadCycles));
+
+  for (uint8_t i = 0; i < rxFifoReadCycles; ++i) {
+    LOG_IF_ERROR_CODE(
+        sendToDecodeDataQueue(rxStreamBuffer + i * TXRX_INTERRUPT_THRESHOLD, TXRX_INTERRUPT_THRESHOLD));
+  }
+#else
   // Switch cc1120 to receive mode
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SRX));
 
-  uint8_t dataBuffer[TXRX_INTERRUPT_THRESHOLD];
-
   // wait to receive sync word before continuing
   if (xSemaphoreTake(syncReceivedSemaphore, syncWordTimeoutTicks) != pdPASS) {
     LOG_ERROR_CODE(OBC_ERR_CODE_SEMAPHORE_TIMEOUT);
     return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
   }
-  // See chapters 8.1, 8.4, 8.5
-  // If we do not stop receiving data, continue looping until COMMS_MAX_UPLINK_BYTES rounded up to the nearest multiple
-  // of TXRX_INTERRUPT_THRESHOLD bytes are received
-  uint8_t rxFifoReadCycles;  // number of times we receive TXRX_INTERRUPT_THRESHOLD bytes and read them out
+
   for (rxFifoReadCycles = 0;
        rxFifoReadCycles < (COMMS_MAX_UPLINK_BYTES + TXRX_INTERRUPT_THRESHOLD - 1) / TXRX_INTERRUPT_THRESHOLD;
        ++rxFifoReadCycles) {
@@ -262,10 +390,9 @@ obc_error_code_t cc1120ReceiveToDecodeTask(TickType_t syncWordTimeoutTicks) {
       break;
     }
     RETURN_IF_ERROR_CODE(cc1120ReadFifo(dataBuffer, TXRX_INTERRUPT_THRESHOLD));
-    for (uint8_t i = 0; i < TXRX_INTERRUPT_THRESHOLD; ++i) {
-      sendToDecodeDataQueue(&dataBuffer[i]);
-    }
+    LOG_IF_ERROR_CODE(sendToDecodeDataQueue(dataBuffer, TXRX_INTERRUPT_THRESHOLD));
   }
+#endif
 
   uint8_t numBytesInRxFifo;
 
@@ -278,8 +405,8 @@ obc_error_code_t cc1120ReceiveToDecodeTask(TickType_t syncWordTimeoutTicks) {
   }
 
   // send the bytes read (if any) to decode data queue
-  for (uint8_t i = 0; i < numBytesInRxFifo; ++i) {
-    sendToDecodeDataQueue(&dataBuffer[i]);
+  if (numBytesInRxFifo != 0) {
+    LOG_IF_ERROR_CODE(sendToDecodeDataQueue(dataBuffer, numBytesInRxFifo));
   }
 
   if (rxFifoReadCycles == (COMMS_MAX_UPLINK_BYTES + TXRX_INTERRUPT_THRESHOLD - 1) / TXRX_INTERRUPT_THRESHOLD) {
@@ -325,6 +452,13 @@ obc_error_code_t cc1120Receive(uint8_t *recvBuf, uint16_t recvBufLen, TickType_t
   spiTransferData = INFINITE_PACKET_LENGTH_MODE;
   RETURN_IF_ERROR_CODE(cc1120WriteSpi(CC1120_REGS_PKT_CFG0, &spiTransferData, 1));
 
+  // See chapters 8.1, 8.4, 8.5
+  // If we do not stop receiving data, continue looping until COMMS_MAX_UPLINK_BYTES rounded up to the nearest multiple
+  // of TXRX_INTERRUPT_THRESHOLD bytes are received
+  uint8_t rxFifoReadCycles;  // number of times we receive TXRX_INTERRUPT_THRESHOLD bytes and read them out
+#if CC1120_FIFO_DMA_MODE == 1
+  RETURN_IF_ERROR_CODE(startRxAndStreamFifo(recvBuf, recvBufLen, syncWordTimeoutTicks, &rxFifoReadCycles));
+#else
   // Switch cc1120 to receive mode
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SRX));
 
@@ -333,10 +467,7 @@ obc_error_code_t cc1120Receive(uint8_t *recvBuf, uint16_t recvBufLen, TickType_t
     LOG_ERROR_CODE(OBC_ERR_CODE_SEMAPHORE_TIMEOUT);
     return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
   }
-  // See chapters 8.1, 8.4, 8.5
-  // If we do not stop receiving data, continue looping until COMMS_MAX_UPLINK_BYTES rounded up to the nearest multiple
-  // of TXRX_INTERRUPT_THRESHOLD bytes are received
-  uint8_t rxFifoReadCycles;  // number of times we receive TXRX_INTERRUPT_THRESHOLD bytes and read them out
+
   for (rxFifoReadCycles = 0; rxFifoReadCycles < recvBufLen / TXRX_INTERRUPT_THRESHOLD; ++rxFifoReadCycles) {
     // wait until we have not received more than TXRX_INTERRUPT_THRESHOLD bytes for more than rxTimeout
     // before exiting this loop since that means we are no longer transmitting
@@ -346,6 +477,7 @@ obc_error_code_t cc1120Receive(uint8_t *recvBuf, uint16_t recvBufLen, TickType_t
     RETURN_IF_ERROR_CODE(
         cc1120ReadFifo(recvBuf + rxFifoReadCycles * TXRX_INTERRUPT_THRESHOLD, TXRX_INTERRUPT_THRESHOLD));
   }
+#endif
 
   if (rxFifoReadCycles == 0) {
     // if we never entered the for loop due to recvLen < TXRX_INTERRUPT_THRESHOLD, then block to allow cc1120 to receive
@@ -376,7 +508,7 @@ obc_error_code_t cc1120Receive(uint8_t *recvBuf, uint16_t recvBufLen, TickType_t
  * @return obc_error_code_t - whether the tx fifo empty semaphore became available without timing out or not
  */
 obc_error_code_t txFifoEmptyCheckBlocking(void) {
-  if (xSemaphoreTake(txFifoEmptySemaphore, TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT) != pdPASS) {
+  if (xSemaphoreTake(txFifoEmptySemaphore, CC1120_TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT) != pdPASS) {
     return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
   }
   xSemaphoreGive(txFifoEmptySemaphore);
@@ -384,6 +516,13 @@ obc_error_code_t txFifoEmptyCheckBlocking(void) {
 }
 
 void txFifoReadyCallback(void) {
+#if CC1120_FIFO_DMA_MODE == 1
+  // A running stream moves the next chunk itself instead of waking the task
+  if (cc1120FifoDmaKickFromISR()) {
+    return;
+  }
+#endif
+
   BaseType_t xHigherPriorityTaskAwoken = pdFALSE;
   // give semaphore and set xHigherPriorityTaskAwoken to pdTRUE if this unblocks a higher priority task than the current
   // one
@@ -396,6 +535,13 @@ void txFifoReadyCallback(void) {
 }
 
 void rxFifoReadyCallback(void) {
+#if CC1120_FIFO_DMA_MODE == 1
+  // A running stream moves the next chunk itself instead of waking the task
+  if (cc1120FifoDmaKickFromISR()) {
+    return;
+  }
+#endif
+
   BaseType_t xHigherPriorityTaskAwoken = pdFALSE;
   // give semaphore and set xHigherPriorityTaskAwoken to pdTRUE if this unblocks a higher priority task than the current
   // one
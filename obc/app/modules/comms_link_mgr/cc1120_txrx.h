@@ -7,6 +7,11 @@
 #include <FreeRTOS.h>
 #include <os_semphr.h>
 
+// How long cc1120Send waits for the TX FIFO to drain
+#define CC1120_TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(5000)
+// How long to listen for the sync word at the start of an uplink
+#define CC1120_SYNC_EVENT_SEMAPHORE_TIMEOUT pdMS_TO_TICKS(30000)
+
 /**
  * @brief Initializes all of the semaphores that will be used by cc1120Send and cc1120Receive
  *
@@ -14,6 +14,7 @@
 #include "telemetry_manager.h"
 #include "cc1120_txrx.h"
 #include "cc1120.h"
+#include "cc1120_defs.h"
 #include "rffm6404.h"
 #include "obc_privilege.h"
 
@@ -53,6 +54,38 @@ static QueueHandle_t cc1120TransmitQueueHandle = NULL;
 static StaticQueue_t cc1120TransmitQueue;
 static uint8_t cc1120TransmitQueueStack[CC1120_TRANSMIT_QUEUE_LENGTH * CC1120_TRANSMIT_QUEUE_ITEM_SIZE];
 
+/* Stuffed frames waiting to be transmitted. The downlink encoder stuffs straight into a free slot and only the slot
+   index goes through the transmit queue, so frames are never copied on their way to the CC1120 */
+#define CC1120_TX_FREE_SLOT_QUEUE_LENGTH CC1120_TX_SLOT_COUNT
+#define CC1120_TX_FREE_SLOT_QUEUE_ITEM_SIZE sizeof(uint8_t)
+#define CC1120_TX_FREE_SLOT_QUEUE_RX_WAIT_PERIOD portMAX_DELAY
+#define CC1120_TX_FREE_SLOT_QUEUE_TX_WAIT_PERIOD 0U
+
+static packed_ax25_i_frame_t cc1120TxSlots[CC1120_TX_SLOT_COUNT];
+
+static QueueHandle_t cc1120TxFreeSlotQueueHandle = NULL;
+static StaticQueue_t cc1120TxFreeSlotQueue;
+static uint8_t cc1120TxFreeSlotQueueStack[CC1120_TX_FREE_SLOT_QUEUE_LENGTH * CC1120_TX_FREE_SLOT_QUEUE_ITEM_SIZE];
+
+/* S frames received from the ground station during a downlink, forwarded by the decode task. Enough for an SREJ for
+   every frame in the window followed by the final RR */
+#define DOWNLINK_ACK_QUEUE_LENGTH (AX25_ARQ_WINDOW_SIZE + 1U)
+#define DOWNLINK_ACK_QUEUE_ITEM_SIZE sizeof(ax25_s_frame_info_t)
+#define DOWNLINK_ACK_QUEUE_RX_WAIT_PERIOD pdMS_TO_TICKS(500)
+#define DOWNLINK_ACK_QUEUE_TX_WAIT_PERIOD pdMS_TO_TICKS(10)
+
+static QueueHandle_t downlinkAckQueueHandle = NULL;
+static StaticQueue_t downlinkAckQueue;
+static uint8_t downlinkAckQueueStack[DOWNLINK_ACK_QUEUE_LENGTH * DOWNLINK_ACK_QUEUE_ITEM_SIZE];
+
+// How long to wait for the ground station to start answering a poll
+#define DOWNLINK_ACK_SYNC_WORD_TIMEOUT pdMS_TO_TICKS(2000)
+// Number of polls in a row that may go without any frame being acknowledged before the downlink is abandoned
+#define DOWNLINK_MAX_CHECKPOINT_RETRIES 3U
+
+// Downlinked frames that the ground station hasn't acknowledged yet, kept for selective retransmission
+static ax25_arq_tx_window_t downlinkArqWindow;
+
 static const uint8_t TEMP_STATIC_KEY[AES_KEY_SIZE] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
                                                       0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
 
@@ -90,6 +123,39 @@ static obc_error_code_t handleEnterEmergencyState(void);
 static obc_error_code_t handleEmergUplinkState(void);
 /* COMMS STATE HANDLER FUNCTIONS END */
 
+/**
+ * @brief Transmits a stuffed frame over the downlink
+ *
+ * @param data - The stuffed frame, including both flags
+ * @param len - Number of bytes in data
+ * @return obc_error_code_t - whether or not the frame was sent
+ */
+static obc_error_code_t sendDownlinkBytes(const uint8_t *data, uint16_t len);
+
+/**
+ * @brief Polls the ground station for acknowledgements, then resends the frames it asked for
+ *
+ * @return obc_error_code_t - whether or not the poll and any retransmissions were sent
+ */
+static obc_error_code_t downlinkCheckpoint(void);
+
+/**
+ * @brief Runs checkpoints until no more than maxOutstanding downlinked frames are unacknowledged
+ *
+ * @param maxOutstanding - Number of frames that may still be unacknowledged on return
+ * @return obc_error_code_t - OBC_ERR_CODE_DOWNLINK_NOT_ACKED if the ground station stopped acknowledging frames
+ */
+static obc_error_code_t awaitDownlinkAcks(uint8_t maxOutstanding);
+
+#if COMMS_PHY == COMMS_PHY_UART
+/**
+ * @brief Reads bytes from the UART until the uplink stops and sends them to the decode task in chunks
+ *
+ * @return obc_error_code_t - the UART read error that ended the uplink, or any error sending to the decode task
+ */
+static obc_error_code_t uartReceiveToDecodeTask(void);
+#endif
+
 typedef obc_error_code_t (*comms_state_func_t)(void);
 
 static const comms_state_func_t commsStateFns[] = {
@@ -120,6 +186,22 @@ void obcTaskInitCommsMgr(void) {
                                                    cc1120TransmitQueueStack, &cc1120TransmitQueue);
   }
 
+  ASSERT((cc1120TxFreeSlotQueueStack != NULL) && (&cc1120TxFreeSlotQueue != NULL));
+  if (cc1120TxFreeSlotQueueHandle == NULL) {
+    cc1120TxFreeSlotQueueHandle =
+        xQueueCreateStatic(CC1120_TX_FREE_SLOT_QUEUE_LENGTH, CC1120_TX_FREE_SLOT_QUEUE_ITEM_SIZE,
+                           cc1120TxFreeSlotQueueStack, &cc1120TxFreeSlotQueue);
+    for (uint8_t i = 0; i < CC1120_TX_SLOT_COUNT; ++i) {
+      xQueueSend(cc1120TxFreeSlotQueueHandle, &i, CC1120_TX_FREE_SLOT_QUEUE_TX_WAIT_PERIOD);
+    }
+  }
+
+  ASSERT((downlinkAckQueueStack != NULL) && (&downlinkAckQueue != NULL));
+  if (downlinkAckQueueHandle == NULL) {
+    downlinkAckQueueHandle = xQueueCreateStatic(DOWNLINK_ACK_QUEUE_LENGTH, DOWNLINK_ACK_QUEUE_ITEM_SIZE,
+                                                downlinkAckQueueStack, &downlinkAckQueue);
+  }
+
   // TODO: Implement a key exchange algorithm instead of using Pre-Shared/static key
   initializeAesCtx(TEMP_STATIC_KEY);
   initRs();
@@ -330,10 +412,10 @@ void obcTaskFunctionCommsMgr(void *pvParameters) {
 }
 
 /**
- * @brief Sends an AX.25 packet to the CC1120 transmit queue
+ * @brief Sends an event to the CC1120 transmit queue
  *
- * @param ax25Pkt - Pointer to the AX.25 packet to send
- * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the packet was sent to the queue
+ * @param event - Pointer to the transmit event to send
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the event was sent to the queue
  */
 obc_error_code_t sendToCC1120TransmitQueue(transmit_event_t *event) {
   ASSERT(cc1120TransmitQueueHandle != NULL);
@@ -342,6 +424,10 @@ obc_error_code_t sendToCC1120TransmitQueue(transmit_event_t *event) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
 
+  if (event->eventID == DOWNLINK_PACKET && event->txSlot >= CC1120_TX_SLOT_COUNT) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
   if (xQueueSend(cc1120TransmitQueueHandle, (void *)event, CC1120_TRANSMIT_QUEUE_TX_WAIT_PERIOD) == pdPASS) {
     return OBC_ERR_CODE_SUCCESS;
   }
@@ -349,35 +435,191 @@ obc_error_code_t sendToCC1120TransmitQueue(transmit_event_t *event) {
   return OBC_ERR_CODE_QUEUE_FULL;
 }
 
-static obc_error_code_t handleDisconnectedState(void) {
+/**
+ * @brief Waits for a free TX slot that a stuffed AX.25 frame can be written into for transmission
+ *
+ * @param txSlot - Set to the index of the slot, to be passed along in a DOWNLINK_PACKET transmit event
+ * @param frame - Set to the frame buffer of the slot
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if a slot was acquired
+ */
+obc_error_code_t acquireCC1120TxSlot(uint8_t *txSlot, packed_ax25_i_frame_t **frame) {
+  ASSERT(cc1120TxFreeSlotQueueHandle != NULL);
+
+  if (txSlot == NULL || frame == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (xQueueReceive(cc1120TxFreeSlotQueueHandle, txSlot, CC1120_TX_FREE_SLOT_QUEUE_RX_WAIT_PERIOD) != pdPASS) {
+    return OBC_ERR_CODE_QUEUE_EMPTY;
+  }
+
+  *frame = &cc1120TxSlots[*txSlot];
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Returns a TX slot to the free pool, either after it was transmitted or if it won't be sent after all
+ *
+ * @param txSlot - Index of the slot to release
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the slot was released
+ */
+obc_error_code_t releaseCC1120TxSlot(uint8_t txSlot) {
+  ASSERT(cc1120TxFreeSlotQueueHandle != NULL);
+
+  if (txSlot >= CC1120_TX_SLOT_COUNT) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  // The queue holds every slot, so this can only fail if a slot is released twice
+  if (xQueueSend(cc1120TxFreeSlotQueueHandle, &txSlot, CC1120_TX_FREE_SLOT_QUEUE_TX_WAIT_PERIOD) != pdPASS) {
+    return OBC_ERR_CODE_QUEUE_FULL;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Passes an S frame received from the ground station to the comms manager, which uses it to acknowledge and
+ * retransmit downlinked frames
+ *
+ * @param sFrameInfo - Pointer to the contents of the received S frame
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the S frame was sent to the queue
+ */
+obc_error_code_t sendToDownlinkAckQueue(ax25_s_frame_info_t *sFrameInfo) {
+  ASSERT(downlinkAckQueueHandle != NULL);
+
+  if (sFrameInfo == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (xQueueSend(downlinkAckQueueHandle, (void *)sFrameInfo, DOWNLINK_ACK_QUEUE_TX_WAIT_PERIOD) == pdPASS) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  return OBC_ERR_CODE_QUEUE_FULL;
+}
+
+static obc_error_code_t sendDownlinkBytes(const uint8_t *data, uint16_t len) {
+  // The drivers take non-const buffers but only read from them
+#if COMMS_PHY == COMMS_PHY_UART
+  return sciSendBytes((uint8_t *)data, len, portMAX_DELAY, UART_PRINT_REG);
+#else
+  return cc1120Send((uint8_t *)data, len, CC1120_TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT);
+#endif
+}
+
+static obc_error_code_t downlinkCheckpoint(void) {
   obc_error_code_t errCode;
-  clearCurrentLinkDestAddress();
-  RETURN_IF_ERROR_CODE(rffm6404PowerOff());
+
+  // The link is half-duplex, so the ground station only answers once asked to with the poll bit
+  ax25ArqTxStartCheckpoint(&downlinkArqWindow);
+  packed_ax25_s_frame_t pollFrame = {0};
+  if (ax25SendSFrame(&pollFrame, AX25_S_FRAME_RR_CONTROL, 0, 1) != OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_AX25_ENCODE_FAILURE;
+  }
+  RETURN_IF_ERROR_CODE(sendDownlinkBytes(pollFrame.data, pollFrame.length));
+
+  // Listen for the SREJs and final RR, which the decode task forwards to the downlink ack queue. A missed answer is
+  // not an error, the poll is just repeated
+#if COMMS_PHY == COMMS_PHY_UART
+  LOG_IF_ERROR_CODE(uartReceiveToDecodeTask());
+#else
+  RETURN_IF_ERROR_CODE(rffm6404ActivateRx());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(DOWNLINK_ACK_SYNC_WORD_TIMEOUT));
+  RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
+  RETURN_IF_ERROR_CODE(rffm6404ActivateTx(RFFM6404_VAPC_REGULAR_POWER_VAL));
+#endif
+
+  ax25_s_frame_info_t sFrameInfo;
+  while (xQueueReceive(downlinkAckQueueHandle, &sFrameInfo, DOWNLINK_ACK_QUEUE_RX_WAIT_PERIOD) == pdPASS) {
+    if (ax25ArqTxHandleSFrame(&downlinkArqWindow, &sFrameInfo) != OBC_GS_ERR_CODE_SUCCESS) {
+      LOG_ERROR_CODE(OBC_ERR_CODE_INVALID_AX25_PACKET);
+    }
+    if (sFrameInfo.pollFinal) {
+      break;
+    }
+  }
+
+  const packed_ax25_i_frame_t *frame;
+  while (ax25ArqTxNextRetransmission(&downlinkArqWindow, &frame)) {
+    RETURN_IF_ERROR_CODE(sendDownlinkBytes(frame->data, frame->length));
+  }
+
   return OBC_ERR_CODE_SUCCESS;
 }
 
-static obc_error_code_t handleAwaitingConnState(void) {
-  /* Once cc1120Recv is decoupled from decode task this function should be changed to handle this in comms manager and
-   * bypass decode task to allow for retries */
+static obc_error_code_t awaitDownlinkAcks(uint8_t maxOutstanding) {
   obc_error_code_t errCode;
+  uint8_t checkpointsWithoutProgress = 0;
+
+  while (ax25ArqTxOutstanding(&downlinkArqWindow) > maxOutstanding) {
+    if (checkpointsWithoutProgress >= DOWNLINK_MAX_CHECKPOINT_RETRIES) {
+      return OBC_ERR_CODE_DOWNLINK_NOT_ACKED;
+    }
+
+    uint8_t outstanding = ax25ArqTxOutstanding(&downlinkArqWindow);
+    RETURN_IF_ERROR_CODE(downlinkCheckpoint());
+
+    if (ax25ArqTxOutstanding(&downlinkArqWindow) < outstanding) {
+      checkpointsWithoutProgress = 0;
+    } else {
+      ++checkpointsWithoutProgress;
+    }
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
 #if COMMS_PHY == COMMS_PHY_UART
-  uint8_t rxByte;
+static obc_error_code_t uartReceiveToDecodeTask(void) {
+  obc_error_code_t errCode;
+  uint8_t rxBuffer[TXRX_INTERRUPT_THRESHOLD];
+  uint16_t rxBufferLen = 0;
 
   // Read first byte
-  RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(1000), UART_READ_REG));
-
-  RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
+  RETURN_IF_ERROR_CODE(sciReadBytes(rxBuffer, 1, portMAX_DELAY, pdMS_TO_TICKS(1000), UART_READ_REG));
+  rxBufferLen = 1;
 
-  // Read the rest of the bytes until we stop uplinking
+  // Read the rest of the bytes until we stop uplinking, handing them to the decode task a chunk at a time
+  obc_error_code_t readErrCode = OBC_ERR_CODE_SUCCESS;
   for (uint16_t i = 0; i < AX25_MAXIMUM_PKT_LEN; ++i) {
-    RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(10), UART_READ_REG));
+    readErrCode = sciReadBytes(rxBuffer + rxBufferLen, 1, portMAX_DELAY, pdMS_TO_TICKS(10), UART_READ_REG);
+    if (readErrCode != OBC_ERR_CODE_SUCCESS) {
+      break;
+    }
+
+    if (++rxBufferLen == sizeof(rxBuffer)) {
+      RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(rxBuffer, rxBufferLen));
+      rxBufferLen = 0;
+    }
+  }
 
-    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
+  // Flush whatever was read before the uplink stopped
+  if (rxBufferLen != 0) {
+    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(rxBuffer, rxBufferLen));
   }
+
+  return readErrCode;
+}
+#endif
+
+static obc_error_code_t handleDisconnectedState(void) {
+  obc_error_code_t errCode;
+  clearCurrentLinkDestAddress();
+  RETURN_IF_ERROR_CODE(rffm6404PowerOff());
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+static obc_error_code_t handleAwaitingConnState(void) {
+  /* Once cc1120Recv is decoupled from decode task this function should be changed to handle this in comms manager and
+   * bypass decode task to allow for retries */
+  obc_error_code_t errCode;
+#if COMMS_PHY == COMMS_PHY_UART
+  RETURN_IF_ERROR_CODE(uartReceiveToDecodeTask());
 #else
   // switch cc1120 to receive mode and start receiving all the bytes for one continuous transmission
   RETURN_IF_ERROR_CODE(rffm6404ActivateRx());
-  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(CC1120_SYNC_EVENT_SEMAPHORE_TIMEOUT));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
 #endif
   return OBC_ERR_CODE_SUCCESS;
@@ -444,23 +686,11 @@ static obc_error_code_t handleAwaitingAckDiscState(void) {
    * bypass decode task to allow for retries */
   obc_error_code_t errCode;
 #if COMMS_PHY == COMMS_PHY_UART
-  uint8_t rxByte;
-
-  // Read first byte
-  RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(1000), UART_READ_REG));
-
-  RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-
-  // Read the rest of the bytes until we stop uplinking
-  for (uint16_t i = 0; i < AX25_MAXIMUM_PKT_LEN; ++i) {
-    RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(10), UART_READ_REG));
-
-    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-  }
+  RETURN_IF_ERROR_CODE(uartReceiveToDecodeTask());
 #else
   // switch cc1120 to receive mode and start receiving all the bytes for one continuous transmission
   RETURN_IF_ERROR_CODE(rffm6404ActivateRx());
-  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(CC1120_SYNC_EVENT_SEMAPHORE_TIMEOUT));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
 #endif
   return OBC_ERR_CODE_SUCCESS;
@@ -471,23 +701,11 @@ static obc_error_code_t handleAwaitingAckConnState(void) {
    * bypass decode task to allow for retries */
   obc_error_code_t errCode;
 #if COMMS_PHY == COMMS_PHY_UART
-  uint8_t rxByte;
-
-  // Read first byte
-  RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(1000), UART_READ_REG));
-
-  RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-
-  // Read the rest of the bytes until we stop uplinking
-  for (uint16_t i = 0; i < AX25_MAXIMUM_PKT_LEN; ++i) {
-    RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(10), UART_READ_REG));
-
-    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-  }
+  RETURN_IF_ERROR_CODE(uartReceiveToDecodeTask());
 #else
   // switch cc1120 to receive mode and start receiving all the bytes for one continuous transmission
   RETURN_IF_ERROR_CODE(rffm6404ActivateRx());
-  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(CC1120_SYNC_EVENT_SEMAPHORE_TIMEOUT));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
 #endif
   return OBC_ERR_CODE_SUCCESS;
@@ -496,22 +714,10 @@ static obc_error_code_t handleAwaitingAckConnState(void) {
 static obc_error_code_t handleUplinkingState(void) {
   obc_error_code_t errCode;
 #if COMMS_PHY == COMMS_PHY_UART
-  uint8_t rxByte;
-
-  // Read first byte
-  RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(1000), UART_READ_REG));
-
-  RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-
-  // Read the rest of the bytes until we stop uplinking
-  for (uint16_t i = 0; i < AX25_MAXIMUM_PKT_LEN; ++i) {
-    RETURN_IF_ERROR_CODE(sciReadBytes(&rxByte, 1, portMAX_DELAY, pdMS_TO_TICKS(10), UART_READ_REG));
-
-    RETURN_IF_ERROR_CODE(sendToDecodeDataQueue(&rxByte));
-  }
+  RETURN_IF_ERROR_CODE(uartReceiveToDecodeTask());
 #else
   // switch cc1120 to receive mode and start receiving all the bytes for one continuous transmission
-  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask());
+  LOG_IF_ERROR_CODE(cc1120ReceiveToDecodeTask(CC1120_SYNC_EVENT_SEMAPHORE_TIMEOUT));
   RETURN_IF_ERROR_CODE(cc1120StrobeSpi(CC1120_STROBE_SFSTXON));
 #endif
   comms_event_t uplinkFinishedEvent = {.eventID = COMMS_EVENT_UPLINK_FINISHED};
@@ -524,21 +730,35 @@ static obc_error_code_t handleDownlinkingState(void) {
 #if COMMS_PHY != COMMS_PHY_UART
   RETURN_IF_ERROR_CODE(rffm6404ActivateTx(RFFM6404_VAPC_REGULAR_POWER_VAL));
 #endif
+  // The downlink encoder numbers the frames of each downlink from 0, and anything left from an earlier one is stale
+  ax25ArqTxReset(&downlinkArqWindow);
+  xQueueReset(downlinkAckQueueHandle);
+
   for (uint16_t i = 0; i < COMMS_MAX_DOWNLINK_FRAMES; ++i) {
     transmit_event_t transmitEvent;
     // poll the transmit queue
     if (xQueueReceive(cc1120TransmitQueueHandle, &transmitEvent, CC1120_TRANSMIT_QUEUE_RX_WAIT_PERIOD) != pdPASS) {
       LOG_ERROR_CODE(OBC_ERR_CODE_QUEUE_EMPTY);
+      continue;
     }
     if (transmitEvent.eventID == DOWNLINK_PACKET) {
-#if COMMS_PHY == COMMS_PHY_UART
-      RETURN_IF_ERROR_CODE(sciSendBytes((uint8_t *)transmitEvent.ax25Pkt.data, transmitEvent.ax25Pkt.length,
-                                        portMAX_DELAY, UART_PRINT_REG));
-#else
-      RETURN_IF_ERROR_CODE(cc1120Send((uint8_t *)transmitEvent.ax25Pkt.data, transmitEvent.ax25Pkt.length,
-                                      CC1120_TX_FIFO_EMPTY_SEMAPHORE_TIMEOUT));
-#endif
+      // Wait for room in the ARQ window, then keep a copy of the frame there until the ground station acknowledges it
+      packed_ax25_i_frame_t *frame = &cc1120TxSlots[transmitEvent.txSlot];
+      obc_error_code_t sendErrCode = awaitDownlinkAcks(AX25_ARQ_WINDOW_SIZE - 1);
+      if (sendErrCode == OBC_ERR_CODE_SUCCESS &&
+          ax25ArqTxStore(&downlinkArqWindow, frame, transmitEvent.sendSeqNum) != OBC_GS_ERR_CODE_SUCCESS) {
+        sendErrCode = OBC_ERR_CODE_INVALID_STATE;
+      }
+
+      // Send straight out of the TX slot, then give the slot back to the downlink encoder
+      if (sendErrCode == OBC_ERR_CODE_SUCCESS) {
+        sendErrCode = sendDownlinkBytes(frame->data, frame->length);
+      }
+      RETURN_IF_ERROR_CODE(releaseCC1120TxSlot(transmitEvent.txSlot));
+      RETURN_IF_ERROR_CODE(sendErrCode);
     } else if (transmitEvent.eventID == END_DOWNLINK) {
+      // Don't finish until every frame has been acknowledged
+      RETURN_IF_ERROR_CODE(awaitDownlinkAcks(0));
       break;
     } else {
       LOG_ERROR_CODE(OBC_ERR_CODE_UNSUPPORTED_EVENT);
@@ -44,11 +44,15 @@ typedef struct {
   comms_event_id_t eventID;
 } comms_event_t;
 
+// Number of stuffed AX.25 frames that can be waiting to be transmitted at once
+#define CC1120_TX_SLOT_COUNT 3U
+
 typedef enum { DOWNLINK_PACKET, END_DOWNLINK } transmit_event_id_t;
 
 typedef struct {
   transmit_event_id_t eventID;
-  packed_ax25_i_frame_t ax25Pkt;
+  uint8_t txSlot;      // For DOWNLINK_PACKET, the TX slot holding the stuffed frame to send
+  uint8_t sendSeqNum;  // For DOWNLINK_PACKET, N(S) of the frame, so it can be kept until the ground station acks it
 } transmit_event_t;
 
 typedef enum {
@@ -82,9 +86,38 @@ obc_error_code_t sendToCommsManagerQueue(comms_event_t *event);
 obc_error_code_t sendToFrontCommsManagerQueue(comms_event_t *event);
 
 /**
- * @brief Sends an AX.25 packet to the CC1120 transmit queue
+ * @brief Sends an event to the CC1120 transmit queue
+ *
+ * @note For DOWNLINK_PACKET events the TX slot in event->txSlot is handed over to the transmitter, which releases it
+ * once the frame has been sent
  *
- * @param ax25Pkt - Pointer to the AX.25 packet to send
- * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the packet was sent to the queue
+ * @param event - Pointer to the transmit event to send
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the event was sent to the queue
  */
 obc_error_code_t sendToCC1120TransmitQueue(transmit_event_t *event);
+
+/**
+ * @brief Waits for a free TX slot that a stuffed AX.25 frame can be written into for transmission
+ *
+ * @param txSlot - Set to the index of the slot, to be passed along in a DOWNLINK_PACKET transmit event
+ * @param frame - Set to the frame buffer of the slot
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if a slot was acquired
+ */
+obc_error_code_t acquireCC1120TxSlot(uint8_t *txSlot, packed_ax25_i_frame_t **frame);
+
+/**
+ * @brief Returns a TX slot to the free pool, either after it was transmitted or if it won't be sent after all
+ *
+ * @param txSlot - Index of the slot to release
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the slot was released
+ */
+obc_error_code_t releaseCC1120TxSlot(uint8_t txSlot);
+
+/**
+ * @brief Passes an S frame received from the ground station to the comms manager, which uses it to acknowledge and
+ * retransmit downlinked frames
+ *
+ * @param sFrameInfo - Pointer to the contents of the received S frame
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the S frame was sent to the queue
+ */
+obc_error_code_t sendToDownlinkAckQueue(ax25_s_frame_info_t *sFrameInfo);
@@ -17,35 +17,177 @@
 #include <os_portmacro.h>
 #include <os_queue.h>
 #include <os_task.h>
+#include <os_semphr.h>
 
 #include <sys_common.h>
 #include <gio.h>
 
-#define COMMS_TELEM_ENCODE_QUEUE_LENGTH 2U
-#define COMMS_TELEM_ENCODE_QUEUE_ITEM_SIZE sizeof(encode_event_t)  // Size of the telemetry batch ID
-#define COMMS_TELEM_ENCODE_QUEUE_RX_WAIT_PERIOD portMAX_DELAY
-#define COMMS_TELEM_ENCODE_QUEUE_TX_WAIT_PERIOD portMAX_DELAY
+#define COMMS_DOWNLINK_CLASS_QUEUE_LENGTH 2U
+#define COMMS_DOWNLINK_CLASS_QUEUE_ITEM_SIZE sizeof(encode_event_t)
+#define COMMS_DOWNLINK_CLASS_QUEUE_TX_WAIT_PERIOD pdMS_TO_TICKS(10)
+#define COMMS_DOWNLINK_SUBMISSION_WAIT_PERIOD portMAX_DELAY
 
-static QueueHandle_t telemEncodeQueueHandle = NULL;
-static StaticQueue_t telemEncodeQueue;
-static uint8_t telemEncodeQueueStack[COMMS_TELEM_ENCODE_QUEUE_LENGTH * COMMS_TELEM_ENCODE_QUEUE_ITEM_SIZE];
+/* Bytes of telemetry packets each priority class can send per pass. A class that has used up its budget waits for the
+   next pass, which starts with the next submission, so a bulk downlink can't take up the whole pass. Together the
+   budgets stay under the comms manager's limit of 1000 frames per downlink */
+#define COMMS_DOWNLINK_CRITICAL_PASS_BUDGET (50UL * PACKED_TELEM_PACKET_SIZE)
+#define COMMS_DOWNLINK_LIVE_PASS_BUDGET (250UL * PACKED_TELEM_PACKET_SIZE)
+#define COMMS_DOWNLINK_BULK_PASS_BUDGET (650UL * PACKED_TELEM_PACKET_SIZE)
 
 /**
- * @brief Sends data from a telemetry buffer to the CC1120 transmit queue
+ * @brief A downlink event being sent, which can be put on hold between any two packets
+ */
+typedef struct {
+  encode_event_t event;
+
+  // For telemetry files and queries. The file being read, or -1 if there isn't one open. The reader's index is
+  // downlinkFileIndex, which has to be reloaded if another job used it since
+  telemetry_file_reader_t reader;
+  int32_t fd;
+
+  // For telemetry queries. Batches are searched from newest to oldest
+  uint32_t nextTelemetryBatchId;
+  bool hasNextBatch;
+  bool hasStartedQuery;
+
+  // For data buffers
+  uint8_t nextBufferIndex;
+
+  // Data point that was read but didn't fit in the last packet
+  telemetry_data_t pendingTelem;
+  bool hasPendingTelem;
+} downlink_job_t;
+
+/**
+ * @brief Downlink events of one priority class: those waiting to be sent, and the one being sent
+ */
+typedef struct {
+  QueueHandle_t queueHandle;
+  StaticQueue_t queue;
+  uint8_t queueStack[COMMS_DOWNLINK_CLASS_QUEUE_LENGTH * COMMS_DOWNLINK_CLASS_QUEUE_ITEM_SIZE];
+
+  uint32_t passBudget;
+  uint32_t bytesSentThisPass;
+
+  bool hasJob;
+  downlink_job_t job;
+} downlink_class_t;
+
+static downlink_class_t downlinkClasses[NUM_DOWNLINK_PRIORITIES] = {
+    [DOWNLINK_PRIORITY_CRITICAL] = {.passBudget = COMMS_DOWNLINK_CRITICAL_PASS_BUDGET},
+    [DOWNLINK_PRIORITY_LIVE] = {.passBudget = COMMS_DOWNLINK_LIVE_PASS_BUDGET},
+    [DOWNLINK_PRIORITY_BULK] = {.passBudget = COMMS_DOWNLINK_BULK_PASS_BUDGET},
+};
+
+// Index of the file being read by whichever job last read one, so the classes don't each need a copy. Only one job
+// sends at a time, and the others only read their files again once they're picked to send their next packet
+static telemetry_file_index_t downlinkFileIndex;
+static const downlink_job_t *downlinkFileIndexOwner = NULL;
+
+static const downlink_priority_t eventPriorities[] = {
+    [DOWNLINK_TELEMETRY_FILE] = DOWNLINK_PRIORITY_BULK,
+    [DOWNLINK_DATA_BUFFER] = DOWNLINK_PRIORITY_CRITICAL,
+    [DOWNLINK_TELEMETRY_QUERY] = DOWNLINK_PRIORITY_LIVE,
+};
+
+#define NUM_ENCODE_EVENTS (sizeof(eventPriorities) / sizeof(eventPriorities[0]))
+
+// Given after every submission, so the encoder can sleep until there's something to send. Since it's binary, several
+// submissions can wake the encoder once, which is fine because it checks every class's queue before sleeping again
+static SemaphoreHandle_t downlinkSubmitted = NULL;
+static StaticSemaphore_t downlinkSubmittedBuffer;
+
+// Frame currently being built. Telemetry is packed straight into its info field, which is then AX.25 framed and
+// RS encoded in place before being stuffed into a CC1120 TX slot
+static unstuffed_ax25_i_frame_t downlinkFrame;
+
+// Packs samples into the telemetry packet in downlinkFrame
+static telemetry_packet_builder_t downlinkPacketBuilder;
+
+/**
+ * @brief Returns the info field of the downlink frame as the telemetry packet to fill, which initTelemetryPacket clears
  *
- * @param telemetryDataBuffer - Pointer to the telemetry_data_t buffer
- * @param numTelemetryData - Number of telemetry data points in the buffer
- * @return obc_error_code_t
+ * @return packed_telem_packet_t* - The first 223B of the downlink frame's info field
  */
-static obc_error_code_t sendTelemetryBuffer(telemetry_data_t *telemetryDataBuffer, uint8_t numTelemetryData);
+static packed_telem_packet_t *getDownlinkTelemPacket(void);
 
 /**
- * @brief Reads chunks of telemetry out of a file and sends it into the CC1120 transmit queue
+ * @brief Finds the highest priority class that can send a packet this pass, starting its next job if it needs one
  *
- * @param telemetryBatchId - ID of the telemetry batch to send
- * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if all telemetry data was sent successfully
+ * @param priority - Pointer to store the class's priority in
+ * @return bool - True if a class can send a packet, false if there's nothing to send until the next pass
+ */
+static bool getNextDownlinkPriority(downlink_priority_t *priority);
+
+/**
+ * @brief Checks whether any class has a job or a queued event left, whatever its budget
+ *
+ * @return bool - True if there's something to send in the next pass
+ */
+static bool hasDownlinkWork(void);
+
+/**
+ * @brief Sends the next packet of a priority class's job, finishing the job if that was its last packet
+ *
+ * @param priority - The class to send from; must have a job
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the packet was sent successfully
+ */
+static obc_error_code_t sendNextDownlinkPacket(downlink_priority_t priority);
+
+/**
+ * @brief Makes sure downlinkFileIndex holds the index of the file a job is reading, reloading it if it doesn't
+ *
+ * @param job - The job about to read its file
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the job's reader can be used
+ */
+static obc_error_code_t claimDownlinkFileIndex(downlink_job_t *job);
+
+/**
+ * @brief Prepares to send a downlink event
+ *
+ * @param job - The job to set up
+ * @param event - The event to send
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the event can be sent
+ */
+static obc_error_code_t startDownlinkJob(downlink_job_t *job, const encode_event_t *event);
+
+/**
+ * @brief Closes anything a job still has open
+ *
+ * @param job - The job that's finished
  */
-static obc_error_code_t sendTelemetryFile(uint32_t telemetryBatchId);
+static void endDownlinkJob(downlink_job_t *job);
+
+/**
+ * @brief Packs data points from a job into a telemetry packet until the packet is full or the job runs out
+ *
+ * @param job - The job to take data points from
+ * @param packetBuilder - The telemetry packet to fill
+ * @param isJobDone - Pointer to store whether the job has no data points left in
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if successful
+ */
+static obc_error_code_t fillDownlinkPacket(downlink_job_t *job, telemetry_packet_builder_t *packetBuilder,
+                                           bool *isJobDone);
+
+/**
+ * @brief Gets the next data point a job has to send
+ *
+ * @param job - The job
+ * @param telemData - Pointer to store the data point in
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_REACHED_EOF if the job has no data points
+ * left, otherwise error code
+ */
+static obc_error_code_t getNextJobTelemetry(downlink_job_t *job, telemetry_data_t *telemData);
+
+/**
+ * @brief Gets the next data point selected by a telemetry query job, moving on to older batches as each one runs out
+ *
+ * @param job - The telemetry query job
+ * @param telemData - Pointer to store the data point in
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_REACHED_EOF if no batches are left,
+ * otherwise error code
+ */
+static obc_error_code_t getNextQueriedTelemetry(downlink_job_t *job, telemetry_data_t *telemData);
 
 /**
  * @brief Get the file descriptor object for the telemetry file
@@ -65,163 +207,333 @@ static obc_error_code_t getFileDescriptor(uint32_t telemetryBatchId, int32_t *fd
 static obc_error_code_t sendTelemetryPacket(packed_telem_packet_t *telemPacket);
 
 /**
- * @brief Either sends a single piece of telemetry or packs it into the current telemetry packet
+ * @brief Packs a single piece of telemetry into the current telemetry packet if it fits
  *
  * @param singleTelem - A single piece of telemetry_data_t
- * @param telemPacket - A complete telemetry packet of size 223B
- * @param telemPacketOffset - Pointer to number of bytes already filled in telemPacket
- * @return obc_error_code_t
+ * @param packetBuilder - The telemetry packet being filled
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if it was packed, OBC_ERR_CODE_BUFF_TOO_SMALL if the packet is full
  */
-static obc_error_code_t sendOrPackNextTelemetry(telemetry_data_t *singleTelem, packed_telem_packet_t *telemPacket,
-                                                size_t *telemPacketOffset);
+static obc_error_code_t packNextTelemetry(const telemetry_data_t *singleTelem,
+                                          telemetry_packet_builder_t *packetBuilder);
 
 void obcTaskInitCommsDownlinkEncoder(void) {
-  if (telemEncodeQueueHandle == NULL) {
-    telemEncodeQueueHandle = xQueueCreateStatic(COMMS_TELEM_ENCODE_QUEUE_LENGTH, COMMS_TELEM_ENCODE_QUEUE_ITEM_SIZE,
-                                                telemEncodeQueueStack, &telemEncodeQueue);
+  for (uint8_t i = 0; i < NUM_DOWNLINK_PRIORITIES; ++i) {
+    downlink_class_t *downlinkClass = &downlinkClasses[i];
+    if (downlinkClass->queueHandle == NULL) {
+      downlinkClass->queueHandle =
+          xQueueCreateStatic(COMMS_DOWNLINK_CLASS_QUEUE_LENGTH, COMMS_DOWNLINK_CLASS_QUEUE_ITEM_SIZE,
+                             downlinkClass->queueStack, &downlinkClass->queue);
+    }
+  }
+
+  if (downlinkSubmitted == NULL) {
+    downlinkSubmitted = xSemaphoreCreateBinaryStatic(&downlinkSubmittedBuffer);
   }
 }
 
 /**
- * @brief Sends downlink data to encoding task queue
+ * @brief Submits downlink data to the encoding task, to be sent with the priority of its event ID
  *
- * @param queueMsg - Includes command ID, and either a telemetry batch ID or a telemetry_data_t array
- * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the telemetry batch ID was successfully sent to the queue
+ * @param queueMsg - Includes command ID, and either a telemetry batch ID, a telemetry_data_t array or a query
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the event was successfully sent to its priority class's queue,
+ * OBC_ERR_CODE_QUEUE_FULL if the queue is still full after a short wait
  */
 obc_error_code_t sendToDownlinkEncodeQueue(encode_event_t *queueMsg) {
-  ASSERT(telemEncodeQueueHandle != NULL);
+  ASSERT(downlinkSubmitted != NULL);
 
-  if (xQueueSend(telemEncodeQueueHandle, (void *)queueMsg, COMMS_TELEM_ENCODE_QUEUE_TX_WAIT_PERIOD) == pdPASS) {
-    return OBC_ERR_CODE_SUCCESS;
+  if (queueMsg == NULL || (size_t)queueMsg->eventID >= NUM_ENCODE_EVENTS) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  downlink_class_t *downlinkClass = &downlinkClasses[eventPriorities[queueMsg->eventID]];
+  if (xQueueSend(downlinkClass->queueHandle, (void *)queueMsg, COMMS_DOWNLINK_CLASS_QUEUE_TX_WAIT_PERIOD) != pdPASS) {
+    return OBC_ERR_CODE_QUEUE_FULL;
   }
 
-  return OBC_ERR_CODE_QUEUE_FULL;
+  // Fails if the encoder hasn't woken up for an earlier submission yet, in which case it'll see this one too
+  xSemaphoreGive(downlinkSubmitted);
+
+  return OBC_ERR_CODE_SUCCESS;
 }
 
 void obcTaskFunctionCommsDownlinkEncoder(void *pvParameters) {
   obc_error_code_t errCode;
 
+  bool isPassActive = false;
+
   while (1) {
-    encode_event_t queueMsg;
+    downlink_priority_t priority;
+    if (!getNextDownlinkPriority(&priority)) {
+      if (isPassActive) {
+        transmit_event_t transmitEvent = {.eventID = END_DOWNLINK};
+        LOG_IF_ERROR_CODE(sendToCC1120TransmitQueue(&transmitEvent));
+
+        for (uint8_t i = 0; i < NUM_DOWNLINK_PRIORITIES; ++i) {
+          downlinkClasses[i].bytesSentThisPass = 0;
+        }
+        isPassActive = false;
 
-    // Wait for a telemetry downlink event
-    if (xQueueReceive(telemEncodeQueueHandle, &queueMsg, COMMS_TELEM_ENCODE_QUEUE_RX_WAIT_PERIOD) != pdPASS) {
-      // TODO: Handle this if necessary
+        // Jobs cut short by their budget carry on in the next pass, which no submission may come along to start
+        if (hasDownlinkWork()) {
+          continue;
+        }
+      }
+
+      // Wait for a downlink event
+      xSemaphoreTake(downlinkSubmitted, COMMS_DOWNLINK_SUBMISSION_WAIT_PERIOD);
       continue;
     }
-    transmit_event_t transmitEvent = {0};
-    switch (queueMsg.eventID) {
-      case DOWNLINK_TELEMETRY_FILE:
-        setCurrentLinkDestAddress(&groundStationCallsign);
-        LOG_IF_ERROR_CODE(sendTelemetryFile(queueMsg.telemetryBatchId));
-        transmitEvent.eventID = END_DOWNLINK;
-        LOG_IF_ERROR_CODE(sendToCC1120TransmitQueue(&transmitEvent));
-        break;
-      case DOWNLINK_DATA_BUFFER:
-        setCurrentLinkDestAddress(&groundStationCallsign);
-        LOG_IF_ERROR_CODE(
-            sendTelemetryBuffer(queueMsg.telemetryDataBuffer.telemData, queueMsg.telemetryDataBuffer.bufferSize));
-        transmitEvent.eventID = END_DOWNLINK;
-        LOG_IF_ERROR_CODE(sendToCC1120TransmitQueue(&transmitEvent));
-        break;
-      default:
-        LOG_ERROR_CODE(OBC_ERR_CODE_INVALID_ARG);
-        break;
+
+    // Frames of a pass are numbered from 0, whichever classes they come from
+    if (!isPassActive) {
+      setCurrentLinkDestAddress(&groundStationCallsign);
+      ax25ResetSendSequenceNumber();
+      isPassActive = true;
     }
+
+    LOG_IF_ERROR_CODE(sendNextDownlinkPacket(priority));
   }
 }
 
-/**
- * @brief Sends data from a telemetry buffer to the CC1120 transmit queue
- *
- * @param telemetryDataBuffer - Pointer to the telemetry_data_t buffer
- * @param numTelemetryData - Number of telemetry data points in the buffer
- * @return obc_error_code_t
- */
-static obc_error_code_t sendTelemetryBuffer(telemetry_data_t *telemetryDataBuffer, uint8_t numTelemetryData) {
+static bool getNextDownlinkPriority(downlink_priority_t *priority) {
   obc_error_code_t errCode;
 
-  if (telemetryDataBuffer == NULL) {
-    return OBC_ERR_CODE_INVALID_ARG;
+  for (uint8_t i = 0; i < NUM_DOWNLINK_PRIORITIES; ++i) {
+    downlink_class_t *downlinkClass = &downlinkClasses[i];
+    if (downlinkClass->bytesSentThisPass >= downlinkClass->passBudget) {
+      continue;
+    }
+
+    encode_event_t event;
+    while (!downlinkClass->hasJob && xQueueReceive(downlinkClass->queueHandle, &event, 0) == pdPASS) {
+      LOG_IF_ERROR_CODE(startDownlinkJob(&downlinkClass->job, &event));
+      downlinkClass->hasJob = errCode == OBC_ERR_CODE_SUCCESS;
+    }
+
+    if (downlinkClass->hasJob) {
+      *priority = (downlink_priority_t)i;
+      return true;
+    }
   }
 
-  if (numTelemetryData == 0) {
-    return OBC_ERR_CODE_INVALID_ARG;
+  return false;
+}
+
+static bool hasDownlinkWork(void) {
+  for (uint8_t i = 0; i < NUM_DOWNLINK_PRIORITIES; ++i) {
+    const downlink_class_t *downlinkClass = &downlinkClasses[i];
+    if (downlinkClass->hasJob || uxQueueMessagesWaiting(downlinkClass->queueHandle) > 0) {
+      return true;
+    }
   }
 
-  // Initialize important variables related to packing and queueing the telemetry to be sen
-  packed_telem_packet_t telemPacket = {0};  // Holds 223B of "raw" telemetry data.
-                                            // Zero initialized because telem IDs of 0 are ignored at the ground station
-  size_t telemPacketOffset = 0;             // Number of bytes filled in telemPacket
+  return false;
+}
 
-  // Loop through all telemetry data in the buffer
-  for (uint8_t i = 0; i < numTelemetryData; i++) {
-    RETURN_IF_ERROR_CODE(sendOrPackNextTelemetry(telemetryDataBuffer + i, &telemPacket, &telemPacketOffset));
+static obc_error_code_t sendNextDownlinkPacket(downlink_priority_t priority) {
+  obc_error_code_t errCode;
+
+  downlink_class_t *downlinkClass = &downlinkClasses[priority];
+
+  packed_telem_packet_t *telemPacket = getDownlinkTelemPacket();  // Holds 223B of packed telemetry samples
+  if (initTelemetryPacket(&downlinkPacketBuilder, telemPacket->data, PACKED_TELEM_PACKET_SIZE) !=
+      OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_FAILED_PACK;
   }
 
-  // Send the last packet if it is not empty
-  if (telemPacketOffset == 0) return OBC_ERR_CODE_SUCCESS;
+  bool isJobDone = false;
+  obc_error_code_t fillErrCode = fillDownlinkPacket(&downlinkClass->job, &downlinkPacketBuilder, &isJobDone);
 
-  RETURN_IF_ERROR_CODE(sendTelemetryPacket(&telemPacket));
+  // Whatever made it into the packet is still worth sending if the job failed part way
+  errCode = OBC_ERR_CODE_SUCCESS;
+  if (downlinkPacketBuilder.numSamples > 0) {
+    errCode = sendTelemetryPacket(telemPacket);
+    downlinkClass->bytesSentThisPass += PACKED_TELEM_PACKET_SIZE;
+  }
+
+  if (isJobDone || fillErrCode != OBC_ERR_CODE_SUCCESS || errCode != OBC_ERR_CODE_SUCCESS) {
+    endDownlinkJob(&downlinkClass->job);
+    downlinkClass->hasJob = false;
+  }
+
+  RETURN_IF_ERROR_CODE(fillErrCode);
+  RETURN_IF_ERROR_CODE(errCode);
 
   return OBC_ERR_CODE_SUCCESS;
 }
 
-/**
- * @brief Reads chunks of telemetry out of a file and sends it into the CC1120 transmit queue
- *
- * @param telemetryBatchId - ID of the telemetry batch to send
- * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if all telemetry data was sent successfully
- */
-static obc_error_code_t sendTelemetryFile(uint32_t telemetryBatchId) {
+static obc_error_code_t startDownlinkJob(downlink_job_t *job, const encode_event_t *event) {
   obc_error_code_t errCode;
 
-  // Get the file descriptor for the telemetry file
-  int32_t fd;
-  RETURN_IF_ERROR_CODE(getFileDescriptor(telemetryBatchId, &fd));
+  job->event = *event;
+  job->fd = -1;
+  job->hasPendingTelem = false;
+
+  switch (event->eventID) {
+    case DOWNLINK_TELEMETRY_FILE:
+      RETURN_IF_ERROR_CODE(getFileDescriptor(event->telemetryBatchId, &job->fd));
+
+      // Whoever had the index loses it, even if loading this file's index fails part way
+      downlinkFileIndexOwner = NULL;
+      errCode = initTelemetryFileReader(&job->reader, &downlinkFileIndex, job->fd, NULL);
+      if (errCode == OBC_ERR_CODE_SUCCESS) {
+        downlinkFileIndexOwner = job;
+      } else {
+        LOG_ERROR_CODE(errCode);
+        endDownlinkJob(job);
+        return errCode;
+      }
+      break;
+    case DOWNLINK_TELEMETRY_QUERY:
+      job->nextTelemetryBatchId = event->telemetryQuery.newestTelemetryBatchId;
+      job->hasNextBatch = true;
+      job->hasStartedQuery = false;
+      break;
+    case DOWNLINK_DATA_BUFFER:
+      if (event->telemetryDataBuffer.bufferSize == 0 ||
+          event->telemetryDataBuffer.bufferSize > MAX_DOWNLINK_TELEM_BUFFER_SIZE) {
+        return OBC_ERR_CODE_INVALID_ARG;
+      }
+      job->nextBufferIndex = 0;
+      break;
+    default:
+      return OBC_ERR_CODE_INVALID_ARG;
+  }
 
-  // Initialize important variables related to packing and queueing the telemetry to be sent
-  telemetry_data_t singleTelem;  // Holds a single piece of telemetry from getNextTelemetry()
+  return OBC_ERR_CODE_SUCCESS;
+}
 
-  packed_telem_packet_t telemPacket = {0};  // Holds 223B of "raw" telemetry data.
-                                            // Zero initialized because telem IDs of 0 are ignored at the ground station
-  size_t telemPacketOffset = 0;             // Number of bytes filled in telemPacket
+static void endDownlinkJob(downlink_job_t *job) {
+  obc_error_code_t errCode;
 
-  // Read a single piece of telemetry from the file
-  while ((errCode = readNextTelemetryFromFile(fd, &singleTelem)) == OBC_ERR_CODE_SUCCESS) {
-    errCode = sendOrPackNextTelemetry(&singleTelem, &telemPacket, &telemPacketOffset);
-    if (errCode != OBC_ERR_CODE_SUCCESS) {
-      LOG_ERROR_CODE(errCode);
-      RETURN_IF_ERROR_CODE(closeTelemetryFile(fd));
-      return errCode;
-    }
+  if (job->fd >= 0) {
+    LOG_IF_ERROR_CODE(closeTelemetryFile(job->fd));
+    job->fd = -1;
   }
 
-  if (errCode == OBC_ERR_CODE_REACHED_EOF) {
-    LOG_DEBUG("Reached end of telemetry file");
-    errCode = OBC_ERR_CODE_SUCCESS;
-  } else {
-    LOG_ERROR_CODE(errCode);  // If the error wasn't an EOF error, return
-    RETURN_IF_ERROR_CODE(closeTelemetryFile(fd));
-    return errCode;
+  // The class's next job reuses this one's memory, and must not take the index for its own
+  if (downlinkFileIndexOwner == job) {
+    downlinkFileIndexOwner = NULL;
   }
+}
 
-  // If there's no data left to send, return
-  if (telemPacketOffset == 0) return OBC_ERR_CODE_SUCCESS;
+static obc_error_code_t claimDownlinkFileIndex(downlink_job_t *job) {
+  obc_error_code_t errCode;
 
-  errCode = sendTelemetryPacket(&telemPacket);
-  if (errCode != OBC_ERR_CODE_SUCCESS) {
-    LOG_ERROR_CODE(errCode);
-    RETURN_IF_ERROR_CODE(closeTelemetryFile(fd));
-    return errCode;
+  if (downlinkFileIndexOwner == job) {
+    return OBC_ERR_CODE_SUCCESS;
   }
 
-  // Close telemetry file
-  RETURN_IF_ERROR_CODE(closeTelemetryFile(fd));
+  downlinkFileIndexOwner = NULL;
+  RETURN_IF_ERROR_CODE(reloadTelemetryFileIndex(&job->reader));
+  downlinkFileIndexOwner = job;
 
   return OBC_ERR_CODE_SUCCESS;
 }
 
+static obc_error_code_t fillDownlinkPacket(downlink_job_t *job, telemetry_packet_builder_t *packetBuilder,
+                                           bool *isJobDone) {
+  obc_error_code_t errCode;
+
+  *isJobDone = false;
+
+  while (1) {
+    telemetry_data_t singleTelem;
+    errCode = getNextJobTelemetry(job, &singleTelem);
+    if (errCode == OBC_ERR_CODE_REACHED_EOF) {
+      *isJobDone = true;
+      return OBC_ERR_CODE_SUCCESS;
+    }
+    RETURN_IF_ERROR_CODE(errCode);
+
+    // Packet is full; the data point starts the job's next packet
+    errCode = packNextTelemetry(&singleTelem, packetBuilder);
+    if (errCode == OBC_ERR_CODE_BUFF_TOO_SMALL) {
+      job->pendingTelem = singleTelem;
+      job->hasPendingTelem = true;
+      return OBC_ERR_CODE_SUCCESS;
+    }
+    RETURN_IF_ERROR_CODE(errCode);
+  }
+}
+
+static obc_error_code_t getNextJobTelemetry(downlink_job_t *job, telemetry_data_t *telemData) {
+  obc_error_code_t errCode;
+
+  if (job->hasPendingTelem) {
+    *telemData = job->pendingTelem;
+    job->hasPendingTelem = false;
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  switch (job->event.eventID) {
+    case DOWNLINK_TELEMETRY_FILE:
+      RETURN_IF_ERROR_CODE(claimDownlinkFileIndex(job));
+      errCode = readNextTelemetryFromFile(&job->reader, telemData);
+      if (errCode == OBC_ERR_CODE_REACHED_EOF) {
+        LOG_DEBUG("Reached end of telemetry file");
+      }
+      return errCode;
+    case DOWNLINK_TELEMETRY_QUERY:
+      return getNextQueriedTelemetry(job, telemData);
+    case DOWNLINK_DATA_BUFFER:
+      if (job->nextBufferIndex >= job->event.telemetryDataBuffer.bufferSize) {
+        return OBC_ERR_CODE_REACHED_EOF;
+      }
+      *telemData = job->event.telemetryDataBuffer.telemData[job->nextBufferIndex++];
+      return OBC_ERR_CODE_SUCCESS;
+    default:
+      return OBC_ERR_CODE_INVALID_ARG;
+  }
+}
+
+static obc_error_code_t getNextQueriedTelemetry(downlink_job_t *job, telemetry_data_t *telemData) {
+  obc_error_code_t errCode;
+
+  while (1) {
+    if (job->fd >= 0) {
+      RETURN_IF_ERROR_CODE(claimDownlinkFileIndex(job));
+      errCode = readNextTelemetryFromFile(&job->reader, telemData);
+      if (errCode != OBC_ERR_CODE_REACHED_EOF) {
+        return errCode;
+      }
+
+      LOG_IF_ERROR_CODE(closeTelemetryFile(job->fd));
+      job->fd = -1;
+
+      // Every ID has its newest maxSamplesPerId data points, so older batches have nothing more to give
+      if (isTelemetryFileQueryDone(&job->reader)) {
+        job->hasNextBatch = false;
+      }
+    }
+
+    if (!job->hasNextBatch) {
+      return OBC_ERR_CODE_REACHED_EOF;
+    }
+
+    uint32_t telemetryBatchId = job->nextTelemetryBatchId;
+    job->hasNextBatch = telemetryBatchId > 0;
+    job->nextTelemetryBatchId = telemetryBatchId - 1;
+
+    // Batches that can't be opened are skipped so that one bad file doesn't cost the rest of the query
+    if (getFileDescriptor(telemetryBatchId, &job->fd) != OBC_ERR_CODE_SUCCESS) {
+      job->fd = -1;
+      continue;
+    }
+
+    // Each file's trailer says which of its blocks can hold selected data points, so the others are never read
+    downlinkFileIndexOwner = NULL;
+    if (job->hasStartedQuery) {
+      errCode = continueTelemetryFileQuery(&job->reader, job->fd);
+    } else {
+      errCode = initTelemetryFileReader(&job->reader, &downlinkFileIndex, job->fd, &job->event.telemetryQuery.query);
+      job->hasStartedQuery = true;
+    }
+    RETURN_IF_ERROR_CODE(errCode);
+    downlinkFileIndexOwner = job;
+  }
+}
+
 /**
  * @brief Get the file descriptor object for the telemetry file
  *
@@ -262,80 +574,82 @@ static obc_error_code_t getFileDescriptor(uint32_t telemetryBatchId, int32_t *fd
 }
 
 /**
- * @brief Either sends a single piece of telemetry or packs it into the current telemetry packet
+ * @brief Packs a single piece of telemetry into the current telemetry packet if it fits
  *
  * @param singleTelem - A single piece of telemetry_data_t
- * @param telemPacket - A complete telemetry packet of size 223B
- * @param telemPacketOffset - Pointer to number of bytes already filled in telemPacket
- * @return obc_error_code_t
+ * @param packetBuilder - The telemetry packet being filled
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if it was packed, OBC_ERR_CODE_BUFF_TOO_SMALL if the packet is full
  */
-static obc_error_code_t sendOrPackNextTelemetry(telemetry_data_t *singleTelem, packed_telem_packet_t *telemPacket,
-                                                size_t *telemPacketOffset) {
-  obc_error_code_t errCode;
+static obc_error_code_t packNextTelemetry(const telemetry_data_t *singleTelem,
+                                          telemetry_packet_builder_t *packetBuilder) {
+  obc_gs_error_code_t interfaceErr = addTelemetryToPacket(packetBuilder, singleTelem);
 
-  uint8_t packedSingleTelem[MAX_TELEMETRY_DATA_SIZE];  // Holds a serialized version of the current piece of telemetry
-  uint32_t packedSingleTelemSize = 0;                  // Size of the packed single telemetry
-
-  // Pack the single telemetry into a uint8_t array
-  if (packTelemetry(singleTelem, packedSingleTelem, sizeof(packedSingleTelem) / sizeof(uint8_t),
-                    &packedSingleTelemSize) != OBC_GS_ERR_CODE_SUCCESS) {
-    return OBC_ERR_CODE_FAILED_PACK;
+  // If the single telemetry doesn't fit in what's left of the packet, it goes in the next one
+  if (interfaceErr == OBC_GS_ERR_CODE_BUFF_TOO_SMALL) {
+    return OBC_ERR_CODE_BUFF_TOO_SMALL;
   }
 
-  // If the single telemetry is too large to continue adding to the telemPacket, send the telemPacket
-  if ((*telemPacketOffset) + packedSingleTelemSize > PACKED_TELEM_PACKET_SIZE) {
-    RETURN_IF_ERROR_CODE(sendTelemetryPacket(telemPacket));
-    // Reset the packedTelem struct and offset
-    *telemPacket = (packed_telem_packet_t){0};
-    *telemPacketOffset = 0;
+  if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_FAILED_PACK;
   }
 
-  // Copy the telemetry data into the packedTelem struct
-  memcpy(telemPacket->data + (*telemPacketOffset), packedSingleTelem, packedSingleTelemSize);
-  *telemPacketOffset += packedSingleTelemSize;
-
   return OBC_ERR_CODE_SUCCESS;
 }
 
+/**
+ * @brief Returns the info field of the downlink frame as the telemetry packet to fill, which initTelemetryPacket clears
+ *
+ * @return packed_telem_packet_t* - The first 223B of the downlink frame's info field
+ */
+static packed_telem_packet_t *getDownlinkTelemPacket(void) {
+  return (packed_telem_packet_t *)(downlinkFrame.data + AX25_INFO_FIELD_POSITION);
+}
+
 /**
  * @brief Sends a telemetry packet, applying FEC and AX.25 framing
  *
- * @param telemPacket - A complete telemetry packet of size 223B
+ * @param telemPacket - A complete telemetry packet of size 223B, in the info field of downlinkFrame
  * @return obc_error_code_t
  */
 static obc_error_code_t sendTelemetryPacket(packed_telem_packet_t *telemPacket) {
-  packed_rs_packet_t fecPkt = {0};  // Holds a 255B RS packet
-  unstuffed_ax25_i_frame_t unstuffedAx25Pkt = {0};
-  transmit_event_t transmitEvent = {.eventID = DOWNLINK_PACKET};
-
+  obc_error_code_t errCode;
   obc_gs_error_code_t interfaceErr;
 
-  // Perform AX.25 framing
-  interfaceErr = ax25SendIFrame(telemPacket->data, RS_DECODED_SIZE, &unstuffedAx25Pkt);
+  // Perform AX.25 framing around the telemetry, which is already in place in the info field
+  interfaceErr = ax25SendIFrame(telemPacket->data, RS_DECODED_SIZE, &downlinkFrame);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
     return OBC_ERR_CODE_AX25_ENCODE_FAILURE;
   }
 
-  // Apply Reed Solomon FEC
-  interfaceErr = rsEncode(unstuffedAx25Pkt.data + AX25_INFO_FIELD_POSITION, &fecPkt);
+  // Apply Reed Solomon FEC in place, the parity fills the rest of the info field
+  packed_rs_packet_t *fecPkt = (packed_rs_packet_t *)(downlinkFrame.data + AX25_INFO_FIELD_POSITION);
+  interfaceErr = rsEncode(fecPkt->data, fecPkt);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
     return OBC_ERR_CODE_FEC_ENCODE_FAILURE;
   }
 
-  memcpy(unstuffedAx25Pkt.data + AX25_INFO_FIELD_POSITION, fecPkt.data, RS_ENCODED_SIZE);
+  // Stuff straight into a TX slot, which is handed to the transmitter without being copied
+  uint8_t txSlot;
+  packed_ax25_i_frame_t *txFrame;
+  RETURN_IF_ERROR_CODE(acquireCC1120TxSlot(&txSlot, &txFrame));
 
-  interfaceErr = ax25Stuff(unstuffedAx25Pkt.data, unstuffedAx25Pkt.length, transmitEvent.ax25Pkt.data,
-                           &transmitEvent.ax25Pkt.length);
+  interfaceErr = ax25Stuff(downlinkFrame.data, downlinkFrame.length, txFrame->data, &txFrame->length);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
+    LOG_IF_ERROR_CODE(releaseCC1120TxSlot(txSlot));
     return OBC_ERR_CODE_AX25_BIT_STUFF_FAILURE;
   }
 
-  transmitEvent.ax25Pkt.data[0] = AX25_FLAG;
-  transmitEvent.ax25Pkt.data[transmitEvent.ax25Pkt.length - 1] = AX25_FLAG;
+  txFrame->data[0] = AX25_FLAG;
+  txFrame->data[txFrame->length - 1] = AX25_FLAG;
 
-  // Send into CC1120 transmit queue
-  obc_error_code_t errCode;
-  RETURN_IF_ERROR_CODE(sendToCC1120TransmitQueue(&transmitEvent));
+  // Send the slot index into CC1120 transmit queue, along with N(S) for the comms manager's ARQ window
+  transmit_event_t transmitEvent = {
+      .eventID = DOWNLINK_PACKET, .txSlot = txSlot, .sendSeqNum = ax25GetIFrameSendSeqNum(&downlinkFrame)};
+  obc_error_code_t sendErrCode = sendToCC1120TransmitQueue(&transmitEvent);
+  if (sendErrCode != OBC_ERR_CODE_SUCCESS) {
+    LOG_IF_ERROR_CODE(releaseCC1120TxSlot(txSlot));
+    return sendErrCode;
+  }
 
   return OBC_ERR_CODE_SUCCESS;
 }
@@ -5,26 +5,44 @@
 
 #include "obc_errors.h"
 #include "comms_manager.h"
+#include "telemetry_file_index.h"
 
-typedef enum { DOWNLINK_TELEMETRY_FILE, DOWNLINK_DATA_BUFFER } encode_event_id_t;
+typedef enum { DOWNLINK_TELEMETRY_FILE, DOWNLINK_DATA_BUFFER, DOWNLINK_TELEMETRY_QUERY } encode_event_id_t;
+
+/* Downlink events are scheduled by priority class. After every packet, the encoder moves on to the highest priority
+ * class that has something to send and hasn't used up its byte budget for the pass, so a bulk downlink only holds up
+ * a command response or pong for one packet. Each event ID always goes to the same class. */
+typedef enum {
+  DOWNLINK_PRIORITY_CRITICAL,  // Data buffers, e.g. pongs and command responses
+  DOWNLINK_PRIORITY_LIVE,      // Telemetry queries, which the operator is waiting on
+  DOWNLINK_PRIORITY_BULK,      // Whole telemetry files
+  NUM_DOWNLINK_PRIORITIES,
+} downlink_priority_t;
 
 typedef struct {
   telemetry_data_t telemData[MAX_DOWNLINK_TELEM_BUFFER_SIZE];
   uint8_t bufferSize;
 } telemetry_data_buffer_t;
 
+typedef struct {
+  telemetry_query_t query;
+  uint32_t newestTelemetryBatchId;  // Batches are searched from this one back to the first
+} telemetry_query_downlink_t;
+
 typedef struct {
   encode_event_id_t eventID;
   union {
     uint32_t telemetryBatchId;
     telemetry_data_buffer_t telemetryDataBuffer;
+    telemetry_query_downlink_t telemetryQuery;
   };
 } encode_event_t;
 
 /**
- * @brief Sends downlink data to encoding task queue
+ * @brief Submits downlink data to the encoding task, to be sent with the priority of its event ID
  *
- * @param queueMsg - Includes command ID, and either a telemetry batch ID or a telemetry_data_t array
- * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the telemetry batch ID was successfully sent to the queue
+ * @param queueMsg - Includes command ID, and either a telemetry batch ID, a telemetry_data_t array or a query
+ * @return obc_error_code_t - OBC_ERR_CODE_SUCCESS if the event was successfully sent to its priority class's queue,
+ * OBC_ERR_CODE_QUEUE_FULL if the queue is still full after a short wait
  */
 obc_error_code_t sendToDownlinkEncodeQueue(encode_event_t *queueMsg);
@@ -27,10 +27,19 @@
 #include <stdint.h>
 #include <string.h>
 
-// decode data queue length should be double TXRX_INTERRUPT_THRESHOLD for safety to avoid cc1120 getting blocked
+// Received bytes are passed to the decoder in chunks of up to one RX FIFO read, so the queue is only touched once per
+// chunk rather than once per byte
+#define DECODE_DATA_CHUNK_SIZE TXRX_INTERRUPT_THRESHOLD
+
+typedef struct {
+  uint16_t length;
+  uint8_t data[DECODE_DATA_CHUNK_SIZE];
+} decode_data_chunk_t;
+
+// decode data queue should hold at least two FIFO reads for safety to avoid cc1120 getting blocked
 // can be reduced later depending on memory limitations
-#define DECODE_DATA_QUEUE_LENGTH 2 * TXRX_INTERRUPT_THRESHOLD
-#define DECODE_DATA_QUEUE_ITEM_SIZE sizeof(uint8_t)
+#define DECODE_DATA_QUEUE_LENGTH 2U
+#define DECODE_DATA_QUEUE_ITEM_SIZE sizeof(decode_data_chunk_t)
 #define DECODE_DATA_QUEUE_RX_WAIT_PERIOD portMAX_DELAY
 #define DECODE_DATA_QUEUE_TX_WAIT_PERIOD portMAX_DELAY
 #define AX25_TIMEOUT_MILLISECONDS 330000
@@ -44,7 +53,13 @@ static QueueHandle_t decodeDataQueueHandle = NULL;
 static StaticQueue_t decodeDataQueue;
 static uint8_t decodeDataQueueStack[DECODE_DATA_QUEUE_LENGTH * DECODE_DATA_QUEUE_ITEM_SIZE];
 
-static obc_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_packet_t *rsData, aes_data_t *aesData);
+// Splits the received byte stream into frames, kept out of the task stack since it holds a whole stuffed frame
+static ax25_deframer_t uplinkDeframer;
+
+static obc_error_code_t decodePacket(const uint8_t *ax25Data, uint16_t ax25DataLen, packed_rs_packet_t *rsData,
+                                     aes_data_t *aesData);
+
+static void decodeFrameCallback(const uint8_t *frame, uint16_t frameLen, void *userData);
 
 /**
  * @brief parses the completely decoded data and sends it to the command manager and detects end of transmission
@@ -88,82 +103,70 @@ void obcTaskInitCommsUplinkDecoder(void) {
     decodeDataQueueHandle = xQueueCreateStatic(DECODE_DATA_QUEUE_LENGTH, DECODE_DATA_QUEUE_ITEM_SIZE,
                                                decodeDataQueueStack, &decodeDataQueue);
   }
+
+  // Only fails on NULL arguments
+  ax25DeframerInit(&uplinkDeframer, decodeFrameCallback, NULL);
 }
 
 void obcTaskFunctionCommsUplinkDecoder(void *pvParameters) {
   StaticTimer_t timerBuffer = {0};
   TimerHandle_t flagTimeoutTimer = xTimerCreateStatic(TIMER_NAME, pdMS_TO_TICKS(AX25_TIMEOUT_MILLISECONDS), pdFALSE,
                                                       (void *)0, flagTimeoutCallback, &timerBuffer);
-  obc_error_code_t errCode;
-  uint8_t byte = 0;
+  decode_data_chunk_t chunk;
 
-  packed_ax25_i_frame_t axData = {0};
-  uint16_t axDataIndex = 0;
+  while (1) {
+    if (xQueueReceive(decodeDataQueueHandle, &chunk, DECODE_DATA_QUEUE_RX_WAIT_PERIOD) != pdPASS) {
+      continue;
+    }
 
-  bool startFlagReceived = false;
+    bool startFlagReceived = uplinkDeframer.inFrame;
 
-  while (1) {
-    if (xQueueReceive(decodeDataQueueHandle, &byte, DECODE_DATA_QUEUE_RX_WAIT_PERIOD) == pdPASS) {
-      if (axDataIndex >= sizeof(axData.data)) {
-        LOG_ERROR_CODE(OBC_ERR_CODE_BUFF_OVERFLOW);
-
-        // Restart the decoding process
-        memset(&axData, 0, sizeof(axData));
-        axDataIndex = 0;
-        startFlagReceived = false;
-      }
+    // Complete frames are decoded by decodeFrameCallback as the deframer finds them
+    if (ax25DeframerPush(&uplinkDeframer, chunk.data, chunk.length) != OBC_GS_ERR_CODE_SUCCESS) {
+      LOG_ERROR_CODE(OBC_ERR_CODE_BUFF_OVERFLOW);
+    }
 
-      if (byte == AX25_FLAG) {
-        axData.data[axDataIndex++] = byte;
-
-        // Decode packet if we have start flag, end flag, and at least 1 byte of data
-        // During idling, multiple AX25_FLAGs may be sent in a row, so we enforce that
-        // axData.data[1] must be something other than AX25_FLAG
-        if (axDataIndex > 2) {
-          axData.length = axDataIndex;
-
-          packed_rs_packet_t rsData = {0};
-          aes_data_t aesData = {0};
-          LOG_IF_ERROR_CODE(decodePacket(&axData, &rsData, &aesData));
-
-          // Restart the decoding process
-          memset(&axData, 0, sizeof(axData));
-          axDataIndex = 0;
-          axData.data[axDataIndex++] = AX25_FLAG;
-        } else {
-          if (!startFlagReceived) {
-            if (xTimerStart(flagTimeoutTimer, pdMS_TO_TICKS(TIMER_QUEUE_TX_TIMEOUT_MILLISECONDS)) != pdPASS) {
-              LOG_ERROR_CODE(OBC_ERR_CODE_QUEUE_FULL);
-            }
-          }
-          startFlagReceived = true;
-          axDataIndex = 1;
-        }
-        continue;
-      }
-      if (startFlagReceived) {
-        axData.data[axDataIndex++] = byte;
+    if (!startFlagReceived && uplinkDeframer.inFrame) {
+      if (xTimerStart(flagTimeoutTimer, pdMS_TO_TICKS(TIMER_QUEUE_TX_TIMEOUT_MILLISECONDS)) != pdPASS) {
+        LOG_ERROR_CODE(OBC_ERR_CODE_QUEUE_FULL);
       }
     }
   }
 }
 
+/**
+ * @brief decodes a complete frame found by the uplink deframer
+ *
+ * @param frame the stuffed ax.25 frame, including both flags
+ * @param frameLen number of bytes in frame
+ * @param userData unused
+ */
+static void decodeFrameCallback(const uint8_t *frame, uint16_t frameLen, void *userData) {
+  obc_error_code_t errCode;
+
+  packed_rs_packet_t rsData = {0};
+  aes_data_t aesData = {0};
+  LOG_IF_ERROR_CODE(decodePacket(frame, frameLen, &rsData, &aesData));
+}
+
 /**
  * @brief completely decode a recieved packet
  *
- * @param data - packed ax25 packet with received data
+ * @param ax25Data - packed ax25 packet with received data
+ * @param ax25DataLen - number of bytes in ax25Data
  * @param rsData - holds packed reed solomon data
  * @param aesData - pointer to an aes_data_t type, which holds the data to decrypt & the IV
  * @param decryptedData - holds the decrypted data from the aesBlock
  *
  * @return obc_error_code_t - whether or not the data was completely decoded successfully
  */
-static obc_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_packet_t *rsData, aes_data_t *aesData) {
+static obc_error_code_t decodePacket(const uint8_t *ax25Data, uint16_t ax25DataLen, packed_rs_packet_t *rsData,
+                                     aes_data_t *aesData) {
   obc_gs_error_code_t interfaceErr;
 
   // perform bit unstuffing
   unstuffed_ax25_i_frame_t unstuffedPacket = {0};
-  interfaceErr = ax25Unstuff(ax25Data->data, ax25Data->length, unstuffedPacket.data, &unstuffedPacket.length);
+  interfaceErr = ax25Unstuff(ax25Data, ax25DataLen, unstuffedPacket.data, &unstuffedPacket.length);
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
     return OBC_ERR_CODE_AX25_DECODE_FAILURE;
   }
@@ -188,6 +191,14 @@ static obc_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_
   if (interfaceErr != OBC_GS_ERR_CODE_SUCCESS) {
     return OBC_ERR_CODE_INVALID_AX25_PACKET;
   }
+
+  // S frames acknowledge downlinked frames or ask for them to be resent, which is up to the comms manager
+  ax25_s_frame_info_t sFrameInfo;
+  if (ax25GetSFrameInfo(&unstuffedPacket, &sFrameInfo) == OBC_GS_ERR_CODE_SUCCESS) {
+    RETURN_IF_ERROR_CODE(sendToDownlinkAckQueue(&sFrameInfo));
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
   if (unstuffedPacket.length != AX25_MINIMUM_I_FRAME_LEN) {
     if (recievedCmd == U_FRAME_CMD_CONN) {
       comms_event_t connEvent = {.eventID = COMMS_EVENT_CONN_RECEIVED};
@@ -224,13 +235,14 @@ static obc_error_code_t decodePacket(packed_ax25_i_frame_t *ax25Data, packed_rs_
 }
 
 /**
- * @brief send a received packet to the decode data pipeline to be sent to command manager
+ * @brief send received bytes to the decode data pipeline to be sent to command manager
  *
- * @param data pointer to a single byte
+ * @param data pointer to the received bytes
+ * @param len number of bytes in data
  *
- * @return obc_error_code_t - whether or not the packet was successfully sent to the queue
+ * @return obc_error_code_t - whether or not the bytes were successfully sent to the queue
  */
-obc_error_code_t sendToDecodeDataQueue(uint8_t *data) {
+obc_error_code_t sendToDecodeDataQueue(uint8_t *data, uint16_t len) {
   if (decodeDataQueueHandle == NULL) {
     return OBC_ERR_CODE_INVALID_STATE;
   }
@@ -239,9 +251,15 @@ obc_error_code_t sendToDecodeDataQueue(uint8_t *data) {
     return OBC_ERR_CODE_INVALID_ARG;
   }
 
-  if (xQueueSend(decodeDataQueueHandle, (void *)data, DECODE_DATA_QUEUE_TX_WAIT_PERIOD) == pdPASS) {
-    return OBC_ERR_CODE_SUCCESS;
+  decode_data_chunk_t chunk;
+  for (uint16_t sent = 0; sent < len; sent += chunk.length) {
+    chunk.length = ((len - sent) < DECODE_DATA_CHUNK_SIZE) ? (len - sent) : DECODE_DATA_CHUNK_SIZE;
+    memcpy(chunk.data, data + sent, chunk.length);
+
+    if (xQueueSend(decodeDataQueueHandle, (void *)&chunk, DECODE_DATA_QUEUE_TX_WAIT_PERIOD) != pdPASS) {
+      return OBC_ERR_CODE_QUEUE_FULL;
+    }
   }
 
-  return OBC_ERR_CODE_QUEUE_FULL;
+  return OBC_ERR_CODE_SUCCESS;
 }
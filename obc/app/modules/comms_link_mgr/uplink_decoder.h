@@ -15,10 +15,11 @@
 obc_error_code_t handleCommands(uint8_t *cmdBytes);
 
 /**
- * @brief send a received packet to the decode data pipeline to be sent to command manager
+ * @brief send received bytes to the decode data pipeline to be sent to command manager
  *
- * @param data pointer to a single byte
+ * @param data pointer to the received bytes
+ * @param len number of bytes in data
  *
- * @return obc_error_code_t - whether or not the packet was successfully sent to the queue
+ * @return obc_error_code_t - whether or not the bytes were successfully sent to the queue
  */
-obc_error_code_t sendToDecodeDataQueue(uint8_t *data);
+obc_error_code_t sendToDecodeDataQueue(uint8_t *data, uint16_t len);
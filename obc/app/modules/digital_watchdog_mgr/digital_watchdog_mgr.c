@@ -29,10 +29,11 @@
 #define TASK_LOGGER_WATCHDOG_TIMEOUT portMAX_DELAY
 #define TASK_DIGITAL_WATCHDOG_MGR_WATCHDOG_TIMEOUT portMAX_DELAY
 #define TASK_GNC_MGR_WATCHDOG_TIMEOUT pdMS_TO_TICKS(100)
+#define TASK_SPI_ENGINE_WATCHDOG_TIMEOUT portMAX_DELAY
 
 typedef struct {
-  uint32_t taskTimeoutTicks;
-  uint32_t taskLastCheckInTick;
+  TickType_t taskTimeoutTicks;
+  TickType_t taskLastCheckInTick;
 } watchdog_task_info_t;
 
 static watchdog_task_info_t watchdogTaskArray[] = {
@@ -88,6 +89,10 @@ static watchdog_task_info_t watchdogTaskArray[] = {
         {
             .taskTimeoutTicks = TASK_GNC_MGR_WATCHDOG_TIMEOUT,
         },
+    [OBC_SCHEDULER_CONFIG_ID_SPI_ENGINE] =
+        {
+            .taskTimeoutTicks = TASK_SPI_ENGINE_WATCHDOG_TIMEOUT,
+        },
 
 #if ENABLE_TASK_STATS_COLLECTOR == 1
     [OBC_SCHEDULER_CONFIG_ID_STATS_COLLECTOR] =
@@ -117,10 +122,11 @@ void obcTaskFunctionSwWatchdog(void *params) {
     TickType_t currentTick = xTaskGetTickCount();
     uint8_t i;
     for (i = 0; i < OBC_SCHEDULER_TASK_COUNT; i++) {
+      // Calculate the tick between last checkin and current tick
       TickType_t ticksSinceLastCheckin = (currentTick >= watchdogTaskArray[i].taskLastCheckInTick)
                                              ? (currentTick - watchdogTaskArray[i].taskLastCheckInTick)
-                                             : ((UINT32_MAX - watchdogTaskArray[i].taskLastCheckInTick) + currentTick +
-                                                1);  // Calculate the tick between last checkin and current tick
+                                             : ((portMAX_DELAY - watchdogTaskArray[i].taskLastCheckInTick) +
+                                                currentTick + 1);
 
       // The task does not respond after timeout period
       if (ticksSinceLastCheckin > watchdogTaskArray[i].taskTimeoutTicks) {
@@ -4,9 +4,15 @@
 #include "obc_print.h"
 #include "obc_privilege.h"
 #include "obc_logging.h"
+#include "telemetry_manager.h"
+#include "sdc_rm46.h"
+
+#include <stdio.h>
 
 #define TASK_STATS_BUFFER_SIZE 1000U
 #define UART_MUTEX_BLOCK_TIME portMAX_DELAY
+#define TELEMETRY_STATS_BUFFER_SIZE 100U
+#define SDC_STATS_BUFFER_SIZE 120U
 
 static char taskTableHeaderStr[] =
     "***********************************************\r\nTask           State   Prio    Stack    "
@@ -29,6 +35,33 @@ void obcTaskFunctionStatsCollector(void *pvParameters) {
     LOG_IF_ERROR_CODE(
         sciPrintText((unsigned char *)taskTableHeaderStr, strlen(taskTableHeaderStr), UART_MUTEX_BLOCK_TIME));
     LOG_IF_ERROR_CODE(sciPrintText((unsigned char *)taskStatsString, TASK_STATS_BUFFER_SIZE, UART_MUTEX_BLOCK_TIME));
+
+    // Printed alongside the run time stats so that the telemetry manager's file writes can be compared to its CPU time
+    telemetry_manager_stats_t telemetryStats;
+    LOG_IF_ERROR_CODE(getTelemetryManagerStats(&telemetryStats));
+    if (errCode == OBC_ERR_CODE_SUCCESS) {
+      char telemetryStatsString[TELEMETRY_STATS_BUFFER_SIZE] = {0};
+      int len = snprintf(telemetryStatsString, TELEMETRY_STATS_BUFFER_SIZE,
+                         "Telemetry: %lu staged, %lu file writes, %lu commits\r\n", telemetryStats.numTelemetryStaged,
+                         telemetryStats.numFileWrites, telemetryStats.numCommits);
+      if (len > 0) {
+        LOG_IF_ERROR_CODE(sciPrintText((unsigned char *)telemetryStatsString, (uint32_t)len, UART_MUTEX_BLOCK_TIME));
+      }
+    }
+
+    // The DMA wait ticks are CPU time the SD card driver left to other tasks, to compare with the run time stats
+    sdc_transfer_stats_t sdcStats;
+    LOG_IF_ERROR_CODE(getSdcTransferStats(&sdcStats));
+    if (errCode == OBC_ERR_CODE_SUCCESS) {
+      char sdcStatsString[SDC_STATS_BUFFER_SIZE] = {0};
+      int len = snprintf(sdcStatsString, SDC_STATS_BUFFER_SIZE,
+                         "SD card: %lu sectors read, %lu sectors written, %lu transfer ticks, %lu DMA wait ticks\r\n",
+                         sdcStats.numSectorsRead, sdcStats.numSectorsWritten, sdcStats.transferTicks,
+                         sdcStats.dmaWaitTicks);
+      if (len > 0) {
+        LOG_IF_ERROR_CODE(sciPrintText((unsigned char *)sdcStatsString, (uint32_t)len, UART_MUTEX_BLOCK_TIME));
+      }
+    }
   }
 }
 #endif
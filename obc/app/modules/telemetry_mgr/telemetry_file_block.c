@@ -0,0 +1,232 @@
+#include "telemetry_file_block.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define TELEMETRY_BLOCK_ID_POSITION 0U
+#define TELEMETRY_BLOCK_NUM_SAMPLES_POSITION 1U
+#define TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION 2U
+
+#define VARINT_GROUP_BITS 7U
+#define VARINT_GROUP_MASK 0x7FU
+#define VARINT_CONTINUE_BIT 0x80U
+
+/**
+ * @brief Encode a timestamp delta as a variable-length integer
+ *
+ * @param delta The delta to encode
+ * @param buffer Buffer of at least TELEMETRY_TIMESTAMP_DELTA_MAX_SIZE bytes
+ * @return size_t Number of bytes used
+ */
+static size_t encodeTimestampDelta(uint32_t delta, uint8_t *buffer) {
+  size_t len = 0;
+  while (delta > VARINT_GROUP_MASK) {
+    buffer[len++] = (uint8_t)(delta & VARINT_GROUP_MASK) | VARINT_CONTINUE_BIT;
+    delta >>= VARINT_GROUP_BITS;
+  }
+  buffer[len++] = (uint8_t)delta;
+  return len;
+}
+
+/**
+ * @brief Decode a variable-length timestamp delta, without reading past the end of the buffer
+ *
+ * @param buffer Buffer to decode from
+ * @param bufferLen Number of bytes in the buffer
+ * @param offset Offset of the delta in the buffer; advanced past it
+ * @param delta Buffer to store the delta in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_FAILED_FILE_READ if the delta is cut off
+ */
+static obc_error_code_t decodeTimestampDelta(const uint8_t *buffer, size_t bufferLen, size_t *offset,
+                                             uint32_t *delta) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < TELEMETRY_TIMESTAMP_DELTA_MAX_SIZE && *offset < bufferLen; ++i) {
+    uint8_t byte = buffer[(*offset)++];
+    value |= (uint32_t)(byte & VARINT_GROUP_MASK) << (VARINT_GROUP_BITS * i);
+
+    if ((byte & VARINT_CONTINUE_BIT) == 0) {
+      *delta = value;
+      return OBC_ERR_CODE_SUCCESS;
+    }
+  }
+
+  return OBC_ERR_CODE_FAILED_FILE_READ;
+}
+
+obc_error_code_t telemetryValueSize(telemetry_data_id_t id, size_t *valueSize) {
+  if (valueSize == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (id >= TELEM_CC1120_TEMP && id <= TELEM_EPS_OBC_3V3_VOLTAGE) {
+    *valueSize = sizeof(float);
+  } else if (id == TELEM_OBC_STATE || id == TELEM_EPS_STATE) {
+    *valueSize = sizeof(uint8_t);
+  } else if (id == TELEM_NUM_CSP_PACKETS_RCVD) {
+    *valueSize = sizeof(uint32_t);
+  } else if (id == TELEM_PONG) {
+    *valueSize = 0;
+  } else {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t initTelemetryBlock(telemetry_block_builder_t *builder, telemetry_data_id_t id) {
+  obc_error_code_t errCode;
+
+  if (builder == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  size_t valueSize;
+  RETURN_IF_ERROR_CODE(telemetryValueSize(id, &valueSize));
+
+  builder->id = id;
+  builder->numSamples = 0;
+  builder->firstTimestamp = 0;
+  builder->lastTimestamp = 0;
+  builder->valuesLen = 0;
+  builder->timestampDeltasLen = 0;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t addToTelemetryBlock(telemetry_block_builder_t *builder, const telemetry_data_t *telemetryData) {
+  obc_error_code_t errCode;
+
+  if (builder == NULL || telemetryData == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (telemetryData->id != builder->id) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  size_t valueSize;
+  RETURN_IF_ERROR_CODE(telemetryValueSize(builder->id, &valueSize));
+
+  uint8_t timestampDelta[TELEMETRY_TIMESTAMP_DELTA_MAX_SIZE];
+  size_t timestampDeltaLen = 0;
+
+  if (builder->numSamples > 0) {
+    // Deltas are unsigned, so a sample from before the last one (e.g. after the RTC was synced) starts a new block
+    if (telemetryData->timestamp < builder->lastTimestamp) {
+      return OBC_ERR_CODE_BUFF_TOO_SMALL;
+    }
+
+    timestampDeltaLen = encodeTimestampDelta(telemetryData->timestamp - builder->lastTimestamp, timestampDelta);
+  }
+
+  if (builder->numSamples == UINT8_MAX ||
+      builder->valuesLen + valueSize + builder->timestampDeltasLen + timestampDeltaLen >
+          TELEMETRY_FILE_BLOCK_SIZE - TELEMETRY_FILE_BLOCK_HEADER_SIZE) {
+    return OBC_ERR_CODE_BUFF_TOO_SMALL;
+  }
+
+  if (builder->numSamples == 0) {
+    builder->firstTimestamp = telemetryData->timestamp;
+  }
+
+  // Every member of the union starts at its beginning, so the value is its first valueSize bytes
+  memcpy(&builder->values[builder->valuesLen], telemetryData, valueSize);
+  builder->valuesLen += valueSize;
+
+  memcpy(&builder->timestampDeltas[builder->timestampDeltasLen], timestampDelta, timestampDeltaLen);
+  builder->timestampDeltasLen += timestampDeltaLen;
+
+  builder->lastTimestamp = telemetryData->timestamp;
+  builder->numSamples++;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t serializeTelemetryBlock(const telemetry_block_builder_t *builder, uint8_t *buffer) {
+  if (builder == NULL || buffer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  memset(buffer, 0, TELEMETRY_FILE_BLOCK_SIZE);
+
+  buffer[TELEMETRY_BLOCK_ID_POSITION] = (uint8_t)builder->id;
+  buffer[TELEMETRY_BLOCK_NUM_SAMPLES_POSITION] = builder->numSamples;
+  buffer[TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION] = (uint8_t)(builder->firstTimestamp >> 24);
+  buffer[TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION + 1] = (uint8_t)(builder->firstTimestamp >> 16);
+  buffer[TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION + 2] = (uint8_t)(builder->firstTimestamp >> 8);
+  buffer[TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION + 3] = (uint8_t)builder->firstTimestamp;
+
+  memcpy(&buffer[TELEMETRY_FILE_BLOCK_HEADER_SIZE], builder->values, builder->valuesLen);
+  memcpy(&buffer[TELEMETRY_FILE_BLOCK_HEADER_SIZE + builder->valuesLen], builder->timestampDeltas,
+         builder->timestampDeltasLen);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t startTelemetryBlock(telemetry_block_reader_t *reader) {
+  if (reader == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  const uint8_t *block = reader->block;
+
+  size_t valueSize;
+  if (telemetryValueSize((telemetry_data_id_t)block[TELEMETRY_BLOCK_ID_POSITION], &valueSize) !=
+      OBC_ERR_CODE_SUCCESS) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  uint8_t numSamples = block[TELEMETRY_BLOCK_NUM_SAMPLES_POSITION];
+  if (numSamples == 0 ||
+      (size_t)numSamples * valueSize > TELEMETRY_FILE_BLOCK_SIZE - TELEMETRY_FILE_BLOCK_HEADER_SIZE) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  reader->nextSample = 0;
+  reader->valuesOffset = TELEMETRY_FILE_BLOCK_HEADER_SIZE;
+  reader->timestampDeltasOffset = TELEMETRY_FILE_BLOCK_HEADER_SIZE + numSamples * valueSize;
+  reader->lastTimestamp = ((uint32_t)block[TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION] << 24) |
+                          ((uint32_t)block[TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION + 1] << 16) |
+                          ((uint32_t)block[TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION + 2] << 8) |
+                          (uint32_t)block[TELEMETRY_BLOCK_FIRST_TIMESTAMP_POSITION + 3];
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t readNextTelemetryFromBlock(telemetry_block_reader_t *reader, telemetry_data_t *telemetryData) {
+  obc_error_code_t errCode;
+
+  if (reader == NULL || telemetryData == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (reader->nextSample >= reader->block[TELEMETRY_BLOCK_NUM_SAMPLES_POSITION]) {
+    return OBC_ERR_CODE_REACHED_EOF;
+  }
+
+  telemetry_data_id_t id = (telemetry_data_id_t)reader->block[TELEMETRY_BLOCK_ID_POSITION];
+  size_t valueSize;
+  RETURN_IF_ERROR_CODE(telemetryValueSize(id, &valueSize));
+
+  uint32_t timestamp = reader->lastTimestamp;
+  if (reader->nextSample > 0) {
+    uint32_t timestampDelta;
+    RETURN_IF_ERROR_CODE(decodeTimestampDelta(reader->block, TELEMETRY_FILE_BLOCK_SIZE,
+                                              &reader->timestampDeltasOffset, &timestampDelta));
+    timestamp += timestampDelta;
+  }
+
+  memset(telemetryData, 0, sizeof(telemetry_data_t));
+  memcpy(telemetryData, &reader->block[reader->valuesOffset], valueSize);
+  telemetryData->id = id;
+  telemetryData->timestamp = timestamp;
+
+  reader->valuesOffset += valueSize;
+  reader->lastTimestamp = timestamp;
+  reader->nextSample++;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
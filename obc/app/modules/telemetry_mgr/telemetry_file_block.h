@@ -0,0 +1,113 @@
+#pragma once
+
+#include "obc_errors.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Telemetry files are a sequence of fixed-size blocks, each holding samples of a single telemetry ID:
+ *
+ *   | ID (1B) | number of samples (1B) | first timestamp (4B) | values | timestamp deltas | zero padding |
+ *
+ * The values column stores only as many bytes of each sample's value as its ID needs (see telemetryValueSize). The
+ * timestamps column stores each sample's timestamp as the difference from the previous sample's, as a variable-length
+ * integer (7 bits per byte, least significant group first, top bit set on every byte but the last). Since a block is
+ * always written and read whole, a file is written with one write per block and can be streamed one block at a time. */
+
+#define TELEMETRY_FILE_BLOCK_SIZE 128U
+#define TELEMETRY_FILE_BLOCK_HEADER_SIZE 6U
+
+// Longest encoding of a uint32_t timestamp delta
+#define TELEMETRY_TIMESTAMP_DELTA_MAX_SIZE 5U
+
+/**
+ * @brief Samples of one telemetry ID being collected into a block
+ */
+typedef struct {
+  telemetry_data_id_t id;
+  uint8_t numSamples;
+  uint32_t firstTimestamp;
+  uint32_t lastTimestamp;
+
+  uint8_t values[TELEMETRY_FILE_BLOCK_SIZE - TELEMETRY_FILE_BLOCK_HEADER_SIZE];
+  size_t valuesLen;
+
+  uint8_t timestampDeltas[TELEMETRY_FILE_BLOCK_SIZE - TELEMETRY_FILE_BLOCK_HEADER_SIZE];
+  size_t timestampDeltasLen;
+} telemetry_block_builder_t;
+
+/**
+ * @brief A block read back from a file, and the position of the next sample in it
+ */
+typedef struct {
+  uint8_t block[TELEMETRY_FILE_BLOCK_SIZE];
+  uint8_t nextSample;
+  size_t valuesOffset;
+  size_t timestampDeltasOffset;
+  uint32_t lastTimestamp;
+} telemetry_block_reader_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the number of bytes a telemetry ID's value takes up in a block
+ *
+ * @param id The telemetry ID
+ * @param valueSize Buffer to store the number of bytes in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_INVALID_ARG if the ID isn't stored
+ */
+obc_error_code_t telemetryValueSize(telemetry_data_id_t id, size_t *valueSize);
+
+/**
+ * @brief Start a new, empty block for a telemetry ID
+ *
+ * @param builder The block to reset
+ * @param id The telemetry ID the block holds samples of
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+obc_error_code_t initTelemetryBlock(telemetry_block_builder_t *builder, telemetry_data_id_t id);
+
+/**
+ * @brief Add a sample to a block
+ *
+ * @param builder The block to add the sample to
+ * @param telemetryData The sample to add; its ID must match the block's
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the sample was added, OBC_ERR_CODE_BUFF_TOO_SMALL if it needs a new
+ * block (the block is full, or the sample is older than the last one), otherwise error code
+ */
+obc_error_code_t addToTelemetryBlock(telemetry_block_builder_t *builder, const telemetry_data_t *telemetryData);
+
+/**
+ * @brief Lay a block out as it's stored in a file
+ *
+ * @param builder The block to serialize
+ * @param buffer Buffer of TELEMETRY_FILE_BLOCK_SIZE bytes to store the block in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+obc_error_code_t serializeTelemetryBlock(const telemetry_block_builder_t *builder, uint8_t *buffer);
+
+/**
+ * @brief Check a block read from a file and prepare to read its samples
+ *
+ * @param reader Reader whose block has just been filled from the file
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the block is valid, OBC_ERR_CODE_FAILED_FILE_READ otherwise
+ */
+obc_error_code_t startTelemetryBlock(telemetry_block_reader_t *reader);
+
+/**
+ * @brief Get the next sample from a block
+ *
+ * @param reader The block to read from, prepared with startTelemetryBlock
+ * @param telemetryData Buffer to store the sample in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_REACHED_EOF if every sample in the block
+ * has been read, otherwise error code
+ */
+obc_error_code_t readNextTelemetryFromBlock(telemetry_block_reader_t *reader, telemetry_data_t *telemetryData);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,226 @@
+#include "telemetry_file_index.h"
+#include "telemetry_file_block.h"
+#include "obc_errors.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+static const uint8_t footerMagic[] = {'T', 'I', 'D', 'X'};
+
+static void writeUint16(uint16_t value, uint8_t *buffer) {
+  buffer[0] = (uint8_t)(value >> 8);
+  buffer[1] = (uint8_t)value;
+}
+
+static void writeUint32(uint32_t value, uint8_t *buffer) {
+  buffer[0] = (uint8_t)(value >> 24);
+  buffer[1] = (uint8_t)(value >> 16);
+  buffer[2] = (uint8_t)(value >> 8);
+  buffer[3] = (uint8_t)value;
+}
+
+static uint16_t readUint16(const uint8_t *buffer) { return (uint16_t)(((uint16_t)buffer[0] << 8) | buffer[1]); }
+
+static uint32_t readUint32(const uint8_t *buffer) {
+  return ((uint32_t)buffer[0] << 24) | ((uint32_t)buffer[1] << 16) | ((uint32_t)buffer[2] << 8) | (uint32_t)buffer[3];
+}
+
+static bool isStoredTelemetryId(uint8_t id) {
+  size_t valueSize;
+  return telemetryValueSize((telemetry_data_id_t)id, &valueSize) == OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t initTelemetryQueryAll(telemetry_query_t *query) {
+  if (query == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  query->idMask = UINT32_MAX;
+  query->startTime = 0;
+  query->endTime = UINT32_MAX;
+  query->maxSamplesPerId = 0;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+bool telemetryMatchesQuery(const telemetry_query_t *query, telemetry_data_id_t id, uint32_t timestamp) {
+  if ((uint32_t)id >= 32U || (query->idMask & (1UL << id)) == 0) {
+    return false;
+  }
+
+  return timestamp >= query->startTime && timestamp <= query->endTime;
+}
+
+bool telemetryBlockMatchesQuery(const telemetry_query_t *query, const telemetry_block_index_entry_t *entry) {
+  if (entry->id >= 32U || (query->idMask & (1UL << entry->id)) == 0) {
+    return false;
+  }
+
+  return entry->lastTimestamp >= query->startTime && entry->firstTimestamp <= query->endTime;
+}
+
+obc_error_code_t initTelemetryFileIndex(telemetry_file_index_t *index) {
+  if (index == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  index->numBlocks = 0;
+  index->numIndexedBlocks = 0;
+  index->firstEntry = 0;
+  index->hasIdSummaries = true;
+  memset(index->ids, 0, sizeof(index->ids));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t addBlockToTelemetryFileIndex(telemetry_file_index_t *index, const telemetry_block_builder_t *builder) {
+  if (index == NULL || builder == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (builder->numSamples == 0 || builder->id >= TELEMETRY_NUM_IDS) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  telemetry_block_index_entry_t *entry;
+  if (index->numIndexedBlocks < TELEMETRY_FILE_INDEX_MAX_BLOCKS) {
+    entry = &index->blocks[(index->firstEntry + index->numIndexedBlocks) % TELEMETRY_FILE_INDEX_MAX_BLOCKS];
+    index->numIndexedBlocks++;
+  } else {
+    // Readers start from the newest block, so the oldest entry is the one to lose
+    entry = &index->blocks[index->firstEntry];
+    index->firstEntry = (index->firstEntry + 1) % TELEMETRY_FILE_INDEX_MAX_BLOCKS;
+  }
+  entry->id = (uint8_t)builder->id;
+  entry->numSamples = builder->numSamples;
+  entry->firstTimestamp = builder->firstTimestamp;
+  entry->lastTimestamp = builder->lastTimestamp;
+  index->numBlocks++;
+
+  // A block's first timestamp is its earliest, but a later block can start earlier if the clock was set back, so the
+  // summary tracks the earliest and latest rather than the first and last
+  telemetry_id_summary_t *summary = &index->ids[builder->id];
+  if (summary->numSamples == 0 || builder->firstTimestamp < summary->firstTimestamp) {
+    summary->firstTimestamp = builder->firstTimestamp;
+  }
+  if (summary->numSamples == 0 || builder->lastTimestamp > summary->lastTimestamp) {
+    summary->lastTimestamp = builder->lastTimestamp;
+  }
+  summary->numSamples += builder->numSamples;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+const telemetry_block_index_entry_t *getTelemetryBlockIndexEntry(const telemetry_file_index_t *index,
+                                                                 uint32_t blockNum) {
+  uint32_t firstIndexedBlock = index->numBlocks - index->numIndexedBlocks;
+  if (blockNum < firstIndexedBlock || blockNum >= index->numBlocks) {
+    return NULL;
+  }
+
+  return &index->blocks[(index->firstEntry + (blockNum - firstIndexedBlock)) % TELEMETRY_FILE_INDEX_MAX_BLOCKS];
+}
+
+void serializeTelemetryIndexEntry(const telemetry_block_index_entry_t *entry, uint8_t *buffer) {
+  buffer[0] = entry->id;
+  buffer[1] = entry->numSamples;
+  writeUint32(entry->firstTimestamp, &buffer[2]);
+  writeUint32(entry->lastTimestamp, &buffer[6]);
+}
+
+void serializeTelemetryIdSummary(telemetry_data_id_t id, const telemetry_id_summary_t *summary, uint8_t *buffer) {
+  buffer[0] = (uint8_t)id;
+  writeUint32(summary->numSamples, &buffer[1]);
+  writeUint32(summary->firstTimestamp, &buffer[5]);
+  writeUint32(summary->lastTimestamp, &buffer[9]);
+}
+
+uint8_t telemetryFileNumIdSummaries(const telemetry_file_index_t *index) {
+  uint8_t numIdSummaries = 0;
+  for (uint8_t id = 0; id < TELEMETRY_NUM_IDS; ++id) {
+    if (index->ids[id].numSamples > 0) {
+      numIdSummaries++;
+    }
+  }
+  return numIdSummaries;
+}
+
+void serializeTelemetryFileFooter(const telemetry_file_index_t *index, uint8_t *buffer) {
+  memcpy(buffer, footerMagic, sizeof(footerMagic));
+  writeUint32(index->numBlocks, &buffer[4]);
+  writeUint16(index->numIndexedBlocks, &buffer[8]);
+  buffer[10] = telemetryFileNumIdSummaries(index);
+  buffer[11] = 0;
+}
+
+obc_error_code_t parseTelemetryFileFooter(const uint8_t *buffer, size_t fileSize, telemetry_file_index_t *index,
+                                          uint8_t *numIdSummaries) {
+  if (buffer == NULL || index == NULL || numIdSummaries == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (memcmp(buffer, footerMagic, sizeof(footerMagic)) != 0) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  uint32_t numBlocks = readUint32(&buffer[4]);
+  uint16_t numIndexedBlocks = readUint16(&buffer[8]);
+  uint8_t numIds = buffer[10];
+
+  if (numIndexedBlocks > numBlocks || numIndexedBlocks > TELEMETRY_FILE_INDEX_MAX_BLOCKS ||
+      numIds > TELEMETRY_NUM_IDS) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  // Data that happened to end in the magic number wouldn't also add up to the file's size
+  if ((uint64_t)numBlocks * TELEMETRY_FILE_BLOCK_SIZE + (uint64_t)numIndexedBlocks * TELEMETRY_FILE_INDEX_ENTRY_SIZE +
+          (uint64_t)numIds * TELEMETRY_FILE_ID_SUMMARY_SIZE + TELEMETRY_FILE_FOOTER_SIZE !=
+      fileSize) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  index->numBlocks = numBlocks;
+  index->numIndexedBlocks = numIndexedBlocks;
+  index->firstEntry = 0;
+  index->hasIdSummaries = true;
+  memset(index->ids, 0, sizeof(index->ids));
+  *numIdSummaries = numIds;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t parseTelemetryIndexEntry(const uint8_t *buffer, telemetry_block_index_entry_t *entry) {
+  if (buffer == NULL || entry == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (!isStoredTelemetryId(buffer[0]) || buffer[1] == 0) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  entry->id = buffer[0];
+  entry->numSamples = buffer[1];
+  entry->firstTimestamp = readUint32(&buffer[2]);
+  entry->lastTimestamp = readUint32(&buffer[6]);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t parseTelemetryIdSummary(const uint8_t *buffer, telemetry_file_index_t *index) {
+  if (buffer == NULL || index == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (!isStoredTelemetryId(buffer[0])) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  telemetry_id_summary_t *summary = &index->ids[buffer[0]];
+  summary->numSamples = readUint32(&buffer[1]);
+  summary->firstTimestamp = readUint32(&buffer[5]);
+  summary->lastTimestamp = readUint32(&buffer[9]);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "obc_errors.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
+#include "telemetry_file_block.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/* When a telemetry file is finished, a trailer is written after its last block so that readers can find the data
+ * they want without reading the whole file:
+ *
+ *   | blocks | block entries | ID summaries | footer |
+ *
+ * Block entry (one per indexed block, in file order): | ID (1B) | number of samples (1B) | first timestamp (4B) |
+ *                                                     | last timestamp (4B) |
+ * ID summary (one per ID with samples in the file):   | ID (1B) | number of samples (4B) | first timestamp (4B) |
+ *                                                     | last timestamp (4B) |
+ * Footer:                                             | "TIDX" | number of blocks (4B) | number of block entries (2B) |
+ *                                                     | number of ID summaries (1B) | reserved (1B) |
+ *
+ * Multi-byte fields are big-endian. Block N starts at byte N * TELEMETRY_FILE_BLOCK_SIZE. Only the last
+ * TELEMETRY_FILE_INDEX_MAX_BLOCKS blocks get an entry, since readers go through a file newest first; blocks before
+ * those have to be read to find out what's in them. A file without a trailer (e.g. one that was never closed properly)
+ * is read as if it had no block entries. */
+
+// Blocks whose entries are kept in RAM by the writer, and loaded by readers. Each entry takes 12 B of the index, which
+// the writer and every reader hold one of.
+#define TELEMETRY_FILE_INDEX_MAX_BLOCKS 64U
+
+#define TELEMETRY_FILE_INDEX_ENTRY_SIZE 10U
+#define TELEMETRY_FILE_ID_SUMMARY_SIZE 13U
+#define TELEMETRY_FILE_FOOTER_SIZE 12U
+
+/**
+ * @brief Where a block's samples are, and the time they cover
+ */
+typedef struct {
+  uint8_t id;
+  uint8_t numSamples;
+  uint32_t firstTimestamp;
+  uint32_t lastTimestamp;
+} telemetry_block_index_entry_t;
+
+/**
+ * @brief Samples of one telemetry ID across a file
+ */
+typedef struct {
+  uint32_t numSamples;
+  uint32_t firstTimestamp;
+  uint32_t lastTimestamp;
+} telemetry_id_summary_t;
+
+/**
+ * @brief Index of a telemetry file, as kept by the writer and loaded by readers
+ */
+typedef struct {
+  uint32_t numBlocks;
+  uint16_t numIndexedBlocks;  // Blocks [numBlocks - numIndexedBlocks, numBlocks) have an entry
+
+  // Ring of block entries, oldest at firstEntry; use getTelemetryBlockIndexEntry to look one up
+  uint16_t firstEntry;
+  telemetry_block_index_entry_t blocks[TELEMETRY_FILE_INDEX_MAX_BLOCKS];
+
+  // Only valid if hasIdSummaries is set, which it isn't for files without a trailer
+  bool hasIdSummaries;
+  telemetry_id_summary_t ids[TELEMETRY_NUM_IDS];
+} telemetry_file_index_t;
+
+/**
+ * @brief Selects samples from telemetry files
+ */
+typedef struct {
+  uint32_t idMask;           // Bit N set to include samples with telemetry_data_id_t N
+  uint32_t startTime;        // Earliest timestamp to include
+  uint32_t endTime;          // Latest timestamp to include
+  uint16_t maxSamplesPerId;  // Only the newest maxSamplesPerId samples of each ID are included; 0 for no limit
+} telemetry_query_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Set up a query for every sample
+ *
+ * @param query The query to set up
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+obc_error_code_t initTelemetryQueryAll(telemetry_query_t *query);
+
+/**
+ * @brief Check whether a sample is selected by a query, ignoring maxSamplesPerId
+ */
+bool telemetryMatchesQuery(const telemetry_query_t *query, telemetry_data_id_t id, uint32_t timestamp);
+
+/**
+ * @brief Check whether a block could hold samples selected by a query, ignoring maxSamplesPerId
+ */
+bool telemetryBlockMatchesQuery(const telemetry_query_t *query, const telemetry_block_index_entry_t *entry);
+
+/**
+ * @brief Start an empty index
+ *
+ * @param index The index to reset
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+obc_error_code_t initTelemetryFileIndex(telemetry_file_index_t *index);
+
+/**
+ * @brief Record a block that's just been written after the others in the file
+ *
+ * If the index is full, the entry of its oldest block is dropped to make room.
+ *
+ * @param index The file's index
+ * @param builder The block that was written
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+obc_error_code_t addBlockToTelemetryFileIndex(telemetry_file_index_t *index, const telemetry_block_builder_t *builder);
+
+/**
+ * @brief Get a block's entry in an index
+ *
+ * @param index The file's index
+ * @param blockNum The block's position in the file
+ * @return The block's entry, or NULL if the block doesn't have one
+ */
+const telemetry_block_index_entry_t *getTelemetryBlockIndexEntry(const telemetry_file_index_t *index,
+                                                                 uint32_t blockNum);
+
+/**
+ * @brief Lay a block entry out as it's stored in a trailer
+ *
+ * @param entry The entry to serialize
+ * @param buffer Buffer of TELEMETRY_FILE_INDEX_ENTRY_SIZE bytes
+ */
+void serializeTelemetryIndexEntry(const telemetry_block_index_entry_t *entry, uint8_t *buffer);
+
+/**
+ * @brief Lay an ID summary out as it's stored in a trailer
+ *
+ * @param id The telemetry ID the summary is for
+ * @param summary The summary to serialize
+ * @param buffer Buffer of TELEMETRY_FILE_ID_SUMMARY_SIZE bytes
+ */
+void serializeTelemetryIdSummary(telemetry_data_id_t id, const telemetry_id_summary_t *summary, uint8_t *buffer);
+
+/**
+ * @brief Lay a trailer's footer out
+ *
+ * @param index The file's index
+ * @param buffer Buffer of TELEMETRY_FILE_FOOTER_SIZE bytes
+ */
+void serializeTelemetryFileFooter(const telemetry_file_index_t *index, uint8_t *buffer);
+
+/**
+ * @brief Get the number of ID summaries in a file's trailer
+ */
+uint8_t telemetryFileNumIdSummaries(const telemetry_file_index_t *index);
+
+/**
+ * @brief Read a trailer's footer, checking it against the size of the file
+ *
+ * @param buffer The last TELEMETRY_FILE_FOOTER_SIZE bytes of the file
+ * @param fileSize Size of the file in bytes
+ * @param index Index to store the number of blocks and block entries in; the entries are to be loaded into
+ * index->blocks in file order
+ * @param numIdSummaries Buffer to store the number of ID summaries in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the file has a valid trailer, OBC_ERR_CODE_FAILED_FILE_READ if not
+ */
+obc_error_code_t parseTelemetryFileFooter(const uint8_t *buffer, size_t fileSize, telemetry_file_index_t *index,
+                                          uint8_t *numIdSummaries);
+
+/**
+ * @brief Read a block entry from a trailer
+ *
+ * @param buffer TELEMETRY_FILE_INDEX_ENTRY_SIZE bytes of the trailer
+ * @param entry Buffer to store the entry in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_FAILED_FILE_READ if the entry is invalid
+ */
+obc_error_code_t parseTelemetryIndexEntry(const uint8_t *buffer, telemetry_block_index_entry_t *entry);
+
+/**
+ * @brief Read an ID summary from a trailer into an index
+ *
+ * @param buffer TELEMETRY_FILE_ID_SUMMARY_SIZE bytes of the trailer
+ * @param index The index to store the summary in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_FAILED_FILE_READ if the summary is invalid
+ */
+obc_error_code_t parseTelemetryIdSummary(const uint8_t *buffer, telemetry_file_index_t *index);
+
+#ifdef __cplusplus
+}
+#endif
@@ -10,6 +10,8 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
 
 obc_error_code_t mkTelemetryDir(void) {
   obc_error_code_t errCode;
@@ -120,35 +122,501 @@ obc_error_code_t constructTelemetryFilePath(uint32_t telemBatchId, char *buff, s
   return OBC_ERR_CODE_SUCCESS;
 }
 
-obc_error_code_t writeTelemetryToFile(int32_t telFileId, telemetry_data_t telemetryData) {
-  // Assume file is open and valid
+/**
+ * @brief Write a block to the end of a writer's telemetry file
+ *
+ * @param writer The writer for the file
+ * @param builder The block to write
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t writeTelemetryBlock(telemetry_file_writer_t *writer, const telemetry_block_builder_t *builder) {
+  obc_error_code_t errCode;
+
+  // A block only ends up empty if its first data point couldn't be added
+  if (builder->numSamples == 0) {
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  uint8_t block[TELEMETRY_FILE_BLOCK_SIZE];
+  RETURN_IF_ERROR_CODE(serializeTelemetryBlock(builder, block));
+  RETURN_IF_ERROR_CODE(writeFile(writer->telemFileId, block, TELEMETRY_FILE_BLOCK_SIZE));
+  writer->numBlocksWritten++;
+
+  RETURN_IF_ERROR_CODE(addBlockToTelemetryFileIndex(&writer->index, builder));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Get the block that data points with the given ID are being added to, opening one if there isn't one
+ *
+ * @param writer The writer for the file
+ * @param id The telemetry ID
+ * @param builder Buffer to store a pointer to the block in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t getTelemetryBlock(telemetry_file_writer_t *writer, telemetry_data_id_t id,
+                                          telemetry_block_builder_t **builder) {
+  obc_error_code_t errCode;
+
+  for (uint8_t i = 0; i < writer->numOpenBlocks; ++i) {
+    if (writer->blocks[i].id == id) {
+      *builder = &writer->blocks[i];
+      return OBC_ERR_CODE_SUCCESS;
+    }
+  }
+
+  if (writer->numOpenBlocks < TELEMETRY_FILE_OPEN_BLOCKS) {
+    *builder = &writer->blocks[writer->numOpenBlocks];
+    RETURN_IF_ERROR_CODE(initTelemetryBlock(*builder, id));
+    writer->numOpenBlocks++;
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  // Every block is in use, so write out the one that wastes the least space
+  telemetry_block_builder_t *fullest = &writer->blocks[0];
+  for (uint8_t i = 1; i < TELEMETRY_FILE_OPEN_BLOCKS; ++i) {
+    if (writer->blocks[i].valuesLen + writer->blocks[i].timestampDeltasLen >
+        fullest->valuesLen + fullest->timestampDeltasLen) {
+      fullest = &writer->blocks[i];
+    }
+  }
+
+  RETURN_IF_ERROR_CODE(writeTelemetryBlock(writer, fullest));
+  RETURN_IF_ERROR_CODE(initTelemetryBlock(fullest, id));
+  *builder = fullest;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Write out a partly-filled chunk of a trailer if the next item won't fit in it
+ *
+ * @param telemFileId File descriptor given by Reliance Edge
+ * @param chunk The chunk, TELEMETRY_FILE_BLOCK_SIZE bytes
+ * @param chunkLen Number of bytes filled in the chunk; reset if it's written out
+ * @param itemSize Size of the next item to go in the chunk
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t makeRoomInTrailerChunk(int32_t telemFileId, const uint8_t *chunk, size_t *chunkLen,
+                                               size_t itemSize) {
   obc_error_code_t errCode;
 
-  RETURN_IF_ERROR_CODE(writeFile(telFileId, &telemetryData, sizeof(telemetry_data_t)));
+  if (*chunkLen + itemSize > TELEMETRY_FILE_BLOCK_SIZE) {
+    RETURN_IF_ERROR_CODE(writeFile(telemFileId, chunk, *chunkLen));
+    *chunkLen = 0;
+  }
 
   return OBC_ERR_CODE_SUCCESS;
 }
 
-obc_error_code_t readNextTelemetryFromFile(int32_t telemFileId, telemetry_data_t *telemData) {
+obc_error_code_t initTelemetryFileWriter(telemetry_file_writer_t *writer, int32_t telemFileId) {
+  obc_error_code_t errCode;
+
+  if (writer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  writer->telemFileId = telemFileId;
+  writer->numOpenBlocks = 0;
+  RETURN_IF_ERROR_CODE(initTelemetryFileIndex(&writer->index));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t writeTelemetryToFile(telemetry_file_writer_t *writer, const telemetry_data_t *telemetryData) {
   // Assume file is open and valid
   obc_error_code_t errCode;
 
-  // TODO: Read the file in reverse and filter out excess state data
-  // We're only sending X past states per downlink, so we should only need to read
-  // the last X states
+  if (writer == NULL || telemetryData == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
 
-  size_t bytesRead = 0;
-  RETURN_IF_ERROR_CODE(readFile(telemFileId, telemData, sizeof(telemetry_data_t), &bytesRead));
+  telemetry_block_builder_t *builder;
+  RETURN_IF_ERROR_CODE(getTelemetryBlock(writer, telemetryData->id, &builder));
+
+  errCode = addToTelemetryBlock(builder, telemetryData);
+  if (errCode != OBC_ERR_CODE_BUFF_TOO_SMALL) {
+    return errCode;
+  }
+
+  // The data point doesn't fit, so the block is done; it goes at the start of the next one
+  RETURN_IF_ERROR_CODE(writeTelemetryBlock(writer, builder));
+  RETURN_IF_ERROR_CODE(initTelemetryBlock(builder, telemetryData->id));
+  RETURN_IF_ERROR_CODE(addToTelemetryBlock(builder, telemetryData));
 
-  if (bytesRead == 0) {
-    return OBC_ERR_CODE_REACHED_EOF;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t flushTelemetryFileWriter(telemetry_file_writer_t *writer) {
+  obc_error_code_t errCode;
+
+  if (writer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  for (uint8_t i = 0; i < writer->numOpenBlocks; ++i) {
+    RETURN_IF_ERROR_CODE(writeTelemetryBlock(writer, &writer->blocks[i]));
+  }
+
+  writer->numOpenBlocks = 0;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t finishTelemetryFile(telemetry_file_writer_t *writer) {
+  obc_error_code_t errCode;
+
+  if (writer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(flushTelemetryFileWriter(writer));
+
+  // The trailer is built up in block-sized chunks so that it takes a handful of writes
+  const telemetry_file_index_t *index = &writer->index;
+  uint8_t chunk[TELEMETRY_FILE_BLOCK_SIZE];
+  size_t chunkLen = 0;
+
+  for (uint32_t blockNum = index->numBlocks - index->numIndexedBlocks; blockNum < index->numBlocks; ++blockNum) {
+    RETURN_IF_ERROR_CODE(
+        makeRoomInTrailerChunk(writer->telemFileId, chunk, &chunkLen, TELEMETRY_FILE_INDEX_ENTRY_SIZE));
+    serializeTelemetryIndexEntry(getTelemetryBlockIndexEntry(index, blockNum), &chunk[chunkLen]);
+    chunkLen += TELEMETRY_FILE_INDEX_ENTRY_SIZE;
+  }
+
+  for (uint8_t id = 0; id < TELEMETRY_NUM_IDS; ++id) {
+    if (index->ids[id].numSamples == 0) {
+      continue;
+    }
+
+    RETURN_IF_ERROR_CODE(makeRoomInTrailerChunk(writer->telemFileId, chunk, &chunkLen, TELEMETRY_FILE_ID_SUMMARY_SIZE));
+    serializeTelemetryIdSummary((telemetry_data_id_t)id, &index->ids[id], &chunk[chunkLen]);
+    chunkLen += TELEMETRY_FILE_ID_SUMMARY_SIZE;
   }
 
-  // Since we only write the telemetry data struct, the number of bytes in the file
-  // should be a multiple of the size of the struct.
-  if (bytesRead != sizeof(telemetry_data_t)) {
+  RETURN_IF_ERROR_CODE(makeRoomInTrailerChunk(writer->telemFileId, chunk, &chunkLen, TELEMETRY_FILE_FOOTER_SIZE));
+  serializeTelemetryFileFooter(index, &chunk[chunkLen]);
+  chunkLen += TELEMETRY_FILE_FOOTER_SIZE;
+
+  RETURN_IF_ERROR_CODE(writeFile(writer->telemFileId, chunk, chunkLen));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Read exactly len bytes from the given position in a file
+ *
+ * @param telemFileId File descriptor given by Reliance Edge
+ * @param offset Position to read from
+ * @param buffer Buffer to read into
+ * @param len Number of bytes to read
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t readTelemetryFileAt(int32_t telemFileId, size_t offset, uint8_t *buffer, size_t len) {
+  obc_error_code_t errCode;
+
+  RETURN_IF_ERROR_CODE(seekFile(telemFileId, offset));
+
+  size_t bytesRead = 0;
+  RETURN_IF_ERROR_CODE(readFile(telemFileId, buffer, len, &bytesRead));
+  if (bytesRead != len) {
     return OBC_ERR_CODE_FAILED_FILE_READ;
   }
 
   return OBC_ERR_CODE_SUCCESS;
 }
+
+/**
+ * @brief Load the index from a telemetry file's trailer
+ *
+ * @param reader The reader for the file
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t loadTelemetryFileIndex(telemetry_file_reader_t *reader) {
+  obc_error_code_t errCode;
+
+  telemetry_file_index_t *index = reader->index;
+
+  size_t fileSize;
+  RETURN_IF_ERROR_CODE(getFileSize(reader->telemFileId, &fileSize));
+
+  uint8_t chunk[TELEMETRY_FILE_BLOCK_SIZE];
+  uint8_t numIdSummaries = 0;
+  bool hasTrailer = false;
+  if (fileSize >= TELEMETRY_FILE_FOOTER_SIZE) {
+    RETURN_IF_ERROR_CODE(readTelemetryFileAt(reader->telemFileId, fileSize - TELEMETRY_FILE_FOOTER_SIZE, chunk,
+                                             TELEMETRY_FILE_FOOTER_SIZE));
+    hasTrailer = parseTelemetryFileFooter(chunk, fileSize, index, &numIdSummaries) == OBC_ERR_CODE_SUCCESS;
+  }
+
+  if (!hasTrailer) {
+    // The blocks can still be read; there's just nothing to say what's in them without reading them
+    index->numBlocks = fileSize / TELEMETRY_FILE_BLOCK_SIZE;
+    index->numIndexedBlocks = 0;
+    index->firstEntry = 0;
+    index->hasIdSummaries = false;
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  // The block entries and ID summaries are read in block-sized chunks
+  size_t offset = index->numBlocks * TELEMETRY_FILE_BLOCK_SIZE;
+  uint16_t numEntriesLoaded = 0;
+  while (numEntriesLoaded < index->numIndexedBlocks) {
+    uint16_t numEntries = TELEMETRY_FILE_BLOCK_SIZE / TELEMETRY_FILE_INDEX_ENTRY_SIZE;
+    if (numEntries > index->numIndexedBlocks - numEntriesLoaded) {
+      numEntries = index->numIndexedBlocks - numEntriesLoaded;
+    }
+
+    RETURN_IF_ERROR_CODE(
+        readTelemetryFileAt(reader->telemFileId, offset, chunk, numEntries * TELEMETRY_FILE_INDEX_ENTRY_SIZE));
+    for (uint16_t i = 0; i < numEntries; ++i) {
+      RETURN_IF_ERROR_CODE(parseTelemetryIndexEntry(&chunk[i * TELEMETRY_FILE_INDEX_ENTRY_SIZE],
+                                                    &index->blocks[numEntriesLoaded + i]));
+    }
+
+    numEntriesLoaded += numEntries;
+    offset += numEntries * TELEMETRY_FILE_INDEX_ENTRY_SIZE;
+  }
+
+  uint8_t numIdSummariesLoaded = 0;
+  while (numIdSummariesLoaded < numIdSummaries) {
+    uint8_t numSummaries = TELEMETRY_FILE_BLOCK_SIZE / TELEMETRY_FILE_ID_SUMMARY_SIZE;
+    if (numSummaries > numIdSummaries - numIdSummariesLoaded) {
+      numSummaries = numIdSummaries - numIdSummariesLoaded;
+    }
+
+    RETURN_IF_ERROR_CODE(
+        readTelemetryFileAt(reader->telemFileId, offset, chunk, numSummaries * TELEMETRY_FILE_ID_SUMMARY_SIZE));
+    for (uint8_t i = 0; i < numSummaries; ++i) {
+      RETURN_IF_ERROR_CODE(parseTelemetryIdSummary(&chunk[i * TELEMETRY_FILE_ID_SUMMARY_SIZE], index));
+    }
+
+    numIdSummariesLoaded += numSummaries;
+    offset += numSummaries * TELEMETRY_FILE_ID_SUMMARY_SIZE;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Move on to the next block, newest first, that holds data points selected by the reader's query
+ *
+ * Blocks with an entry in the index are skipped without being read if they can't hold any selected data points.
+ *
+ * @param reader The reader for the file
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if there's a block to read, OBC_ERR_CODE_REACHED_EOF if there are no
+ * more, otherwise error code
+ */
+static obc_error_code_t loadNextTelemetryBlock(telemetry_file_reader_t *reader) {
+  obc_error_code_t errCode;
+
+  const telemetry_query_t *query = &reader->query;
+  bool isLimited = query->maxSamplesPerId > 0;
+
+  while (reader->numBlocksLeft > 0) {
+    // Every ID has all the data points it can have
+    if (isLimited && reader->numIdsLeft == 0) {
+      break;
+    }
+
+    uint32_t blockNum = --reader->numBlocksLeft;
+    const telemetry_block_index_entry_t *entry = getTelemetryBlockIndexEntry(reader->index, blockNum);
+    if (entry != NULL) {
+      if (!telemetryBlockMatchesQuery(query, entry) || (isLimited && reader->numSamplesLeft[entry->id] == 0)) {
+        continue;
+      }
+    }
+
+    RETURN_IF_ERROR_CODE(readTelemetryFileAt(reader->telemFileId, blockNum * TELEMETRY_FILE_BLOCK_SIZE,
+                                             reader->block.block, TELEMETRY_FILE_BLOCK_SIZE));
+    RETURN_IF_ERROR_CODE(startTelemetryBlock(&reader->block));
+
+    // Count the selected data points, so that only the newest ones are read if there are more than the limit
+    uint16_t numSelected = 0;
+    telemetry_data_t telemData;
+    while ((errCode = readNextTelemetryFromBlock(&reader->block, &telemData)) == OBC_ERR_CODE_SUCCESS) {
+      if (telemetryMatchesQuery(query, telemData.id, telemData.timestamp)) {
+        numSelected++;
+      }
+    }
+    if (errCode != OBC_ERR_CODE_REACHED_EOF) {
+      return errCode;
+    }
+
+    if (numSelected == 0) {
+      continue;
+    }
+
+    reader->numSelectedToSkip = 0;
+    if (isLimited) {
+      uint16_t numSamplesLeft = reader->numSamplesLeft[telemData.id];
+      if (numSamplesLeft == 0) {
+        continue;
+      }
+      if (numSelected > numSamplesLeft) {
+        reader->numSelectedToSkip = numSelected - numSamplesLeft;
+      }
+    }
+
+    // Back to the start of the block for readNextTelemetryFromFile
+    RETURN_IF_ERROR_CODE(startTelemetryBlock(&reader->block));
+    return OBC_ERR_CODE_SUCCESS;
+  }
+
+  return OBC_ERR_CODE_REACHED_EOF;
+}
+
+/**
+ * @brief Open a file for a query, without touching the reader's sample limits
+ *
+ * @param reader The reader to set up
+ * @param telemFileId File descriptor given by Reliance Edge
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+static obc_error_code_t openTelemetryFileForQuery(telemetry_file_reader_t *reader, int32_t telemFileId) {
+  obc_error_code_t errCode;
+
+  reader->telemFileId = telemFileId;
+
+  RETURN_IF_ERROR_CODE(loadTelemetryFileIndex(reader));
+  reader->numBlocksLeft = reader->index->numBlocks;
+
+  // An empty block, so that the first read goes to the file
+  memset(&reader->block, 0, sizeof(reader->block));
+  reader->numSelectedToSkip = 0;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Stop waiting for data points of IDs that the file's summaries say it has none of
+ *
+ * @param reader The reader, with its file's index loaded
+ */
+static void updateTelemetrySamplesLeft(telemetry_file_reader_t *reader) {
+  reader->numIdsLeft = 0;
+  for (uint8_t id = 0; id < TELEMETRY_NUM_IDS; ++id) {
+    const telemetry_id_summary_t *summary = &reader->index->ids[id];
+    if (reader->index->hasIdSummaries &&
+        (summary->numSamples == 0 || summary->lastTimestamp < reader->query.startTime ||
+         summary->firstTimestamp > reader->query.endTime)) {
+      continue;
+    }
+
+    if (reader->numSamplesLeft[id] > 0) {
+      reader->numIdsLeft++;
+    }
+  }
+}
+
+obc_error_code_t initTelemetryFileReader(telemetry_file_reader_t *reader, telemetry_file_index_t *index,
+                                         int32_t telemFileId, const telemetry_query_t *query) {
+  obc_error_code_t errCode;
+
+  if (reader == NULL || index == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  reader->index = index;
+
+  if (query == NULL) {
+    RETURN_IF_ERROR_CODE(initTelemetryQueryAll(&reader->query));
+  } else {
+    reader->query = *query;
+  }
+
+  for (uint8_t id = 0; id < TELEMETRY_NUM_IDS; ++id) {
+    reader->numSamplesLeft[id] = (reader->query.idMask & (1UL << id)) != 0 ? reader->query.maxSamplesPerId : 0;
+  }
+
+  RETURN_IF_ERROR_CODE(openTelemetryFileForQuery(reader, telemFileId));
+  updateTelemetrySamplesLeft(reader);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t continueTelemetryFileQuery(telemetry_file_reader_t *reader, int32_t telemFileId) {
+  obc_error_code_t errCode;
+
+  if (reader == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(openTelemetryFileForQuery(reader, telemFileId));
+  updateTelemetrySamplesLeft(reader);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t reloadTelemetryFileIndex(telemetry_file_reader_t *reader) {
+  obc_error_code_t errCode;
+
+  if (reader == NULL || reader->index == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(loadTelemetryFileIndex(reader));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+bool isTelemetryFileQueryDone(const telemetry_file_reader_t *reader) {
+  if (reader == NULL) {
+    return true;
+  }
+
+  // A file that ends before the query's start time doesn't mean older batches do too, since the clock can be set back
+  // between batches. The index already keeps such a file's blocks from being read, so the scan just carries on
+  if (reader->query.maxSamplesPerId == 0) {
+    return false;
+  }
+
+  for (uint8_t id = 0; id < TELEMETRY_NUM_IDS; ++id) {
+    if (reader->numSamplesLeft[id] > 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+obc_error_code_t readNextTelemetryFromFile(telemetry_file_reader_t *reader, telemetry_data_t *telemData) {
+  // Assume file is open and valid
+  obc_error_code_t errCode;
+
+  if (reader == NULL || telemData == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  while (true) {
+    errCode = readNextTelemetryFromBlock(&reader->block, telemData);
+    if (errCode == OBC_ERR_CODE_REACHED_EOF) {
+      errCode = loadNextTelemetryBlock(reader);
+      if (errCode != OBC_ERR_CODE_SUCCESS) {
+        return errCode;
+      }
+      continue;
+    }
+
+    if (errCode != OBC_ERR_CODE_SUCCESS) {
+      return errCode;
+    }
+
+    if (!telemetryMatchesQuery(&reader->query, telemData->id, telemData->timestamp)) {
+      continue;
+    }
+
+    // Older than the newest maxSamplesPerId
+    if (reader->numSelectedToSkip > 0) {
+      reader->numSelectedToSkip--;
+      continue;
+    }
+
+    if (reader->query.maxSamplesPerId > 0 && --reader->numSamplesLeft[telemData->id] == 0) {
+      reader->numIdsLeft--;
+    }
+
+    return OBC_ERR_CODE_SUCCESS;
+  }
+}
@@ -2,9 +2,12 @@
 
 #include "obc_errors.h"
 #include "telemetry_manager.h"
+#include "telemetry_file_block.h"
+#include "telemetry_file_index.h"
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 
 /* Telemetry file path config */
 #define TELEMETRY_FILE_DIRECTORY "/telemetry/"
@@ -15,6 +18,51 @@
   sizeof(TELEMETRY_FILE_DIRECTORY) + sizeof(TELEMETRY_FILE_PREFIX) + sizeof(TELEMETRY_FILE_EXTENSION) + \
       TELEMETRY_FILE_NAME_MAX_LENGTH - 3 + 1  // -3 for the 3 %s in the format string, +1 for the null terminator
 
+// Number of telemetry IDs whose blocks can be filling up at once. If more IDs are being collected, the fullest block is
+// written out early to make room
+#define TELEMETRY_FILE_OPEN_BLOCKS 4U
+
+/**
+ * @brief Telemetry file being written, and the blocks of samples that haven't been written to it yet
+ */
+typedef struct {
+  int32_t telemFileId;
+  telemetry_block_builder_t blocks[TELEMETRY_FILE_OPEN_BLOCKS];
+  uint8_t numOpenBlocks;
+  telemetry_file_index_t index;
+
+  // Blocks written to any file by this writer. Not reset by initTelemetryFileWriter, so it keeps counting across files
+  uint32_t numBlocksWritten;
+} telemetry_file_writer_t;
+
+/**
+ * @brief Telemetry file being read, and the block the next data point comes from
+ */
+typedef struct {
+  int32_t telemFileId;
+  telemetry_query_t query;
+
+  // Given by initTelemetryFileReader. Readers that take turns can share one, reloading it with reloadTelemetryFileIndex
+  // whenever they take it back
+  telemetry_file_index_t *index;
+
+  // Blocks are read newest first, so the next block to read is numBlocksLeft - 1
+  uint32_t numBlocksLeft;
+  telemetry_block_reader_t block;
+
+  // Selected data points at the start of the current block that are older than the newest maxSamplesPerId
+  uint8_t numSelectedToSkip;
+
+  // Only used if the query has a maxSamplesPerId. Data points each ID can still have, counted across every file of the
+  // query, and the number of IDs in the current file that can still have some
+  uint16_t numSamplesLeft[TELEMETRY_NUM_IDS];
+  uint8_t numIdsLeft;
+} telemetry_file_reader_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * @brief Create the telemetry directory.
  *
@@ -67,25 +115,101 @@ obc_error_code_t closeTelemetryFile(int32_t telemFileId);
  */
 obc_error_code_t constructTelemetryFilePath(uint32_t telemBatchId, char *buff, size_t buffSize);
 
+/**
+ * @brief Start writing telemetry to a file.
+ *
+ * @param writer The writer to set up
+ * @param telemFileId File descriptor given by Reliance Edge
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ * @note File must already be opened for writing
+ */
+obc_error_code_t initTelemetryFileWriter(telemetry_file_writer_t *writer, int32_t telemFileId);
+
 /**
  * @brief Write telemetry data to file.
  *
- * @param telFileId File descriptor given by Reliance Edge
+ * The data point is added to the block for its telemetry ID, and the block is only written to the file once it's full.
+ *
+ * @param writer The writer for the file
  * @param telemetryData Telemetry data to write to file
  * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
- * @note File must already be opened for writing
  */
-obc_error_code_t writeTelemetryToFile(int32_t telFileId, telemetry_data_t telemetryData);
+obc_error_code_t writeTelemetryToFile(telemetry_file_writer_t *writer, const telemetry_data_t *telemetryData);
 
 /**
- * @brief Get the next telemetry data point from the given telemetry file
+ * @brief Write the blocks that haven't filled up yet to the file.
  *
- * @param telemFileId The telemetry file descriptor
- * @param telemData Buffer to store the telemetry data point in
- * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, error code otherwise
+ * @param writer The writer for the file
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ * @note Must be called before the file is closed, or the data points in those blocks are lost
+ */
+obc_error_code_t flushTelemetryFileWriter(telemetry_file_writer_t *writer);
+
+/**
+ * @brief Write the blocks that haven't filled up yet, then the file's index as a trailer.
+ *
+ * @param writer The writer for the file
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ * @note Nothing more can be written to the file afterwards; call this right before closing it
+ */
+obc_error_code_t finishTelemetryFile(telemetry_file_writer_t *writer);
+
+/**
+ * @brief Start reading telemetry from a file.
+ *
+ * @param reader The reader to set up
+ * @param index Where to load the file's index; used by the reader until it's set up again
+ * @param telemFileId File descriptor given by Reliance Edge
+ * @param query The data points to read, or NULL for all of them
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ * @note File must already be opened for reading
+ */
+obc_error_code_t initTelemetryFileReader(telemetry_file_reader_t *reader, telemetry_file_index_t *index,
+                                         int32_t telemFileId, const telemetry_query_t *query);
+
+/**
+ * @brief Load the index of a reader's current file again, after something else used the reader's index.
+ *
+ * @param reader The reader, whose file is still open
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+obc_error_code_t reloadTelemetryFileIndex(telemetry_file_reader_t *reader);
+
+/**
+ * @brief Move a reader on to the next file of a query that spans several files.
+ *
+ * The query's maxSamplesPerId counts data points across all the files, so IDs that got all their data points from
+ * earlier files get none from this one.
+ *
+ * @param reader A reader set up with initTelemetryFileReader, whose previous file has been closed
+ * @param telemFileId File descriptor given by Reliance Edge
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
  * @note File must already be opened for reading
  */
-obc_error_code_t readNextTelemetryFromFile(int32_t telemFileId, telemetry_data_t *telemData);
+obc_error_code_t continueTelemetryFileQuery(telemetry_file_reader_t *reader, int32_t telemFileId);
+
+/**
+ * @brief Check whether the files before the reader's current one can have anything more for its query.
+ *
+ * They can't if every ID selected by the query has all the data points its maxSamplesPerId allows.
+ *
+ * @param reader The reader
+ * @return bool True if no more files need to be read for the query, false otherwise
+ */
+bool isTelemetryFileQueryDone(const telemetry_file_reader_t *reader);
+
+/**
+ * @brief Get the next telemetry data point selected by the reader's query from the given telemetry file
+ *
+ * Blocks are read newest first, so the most recent data points come out first. Within a block, data points are in the
+ * order they were written.
+ *
+ * @param reader The reader for the file
+ * @param telemData Buffer to store the telemetry data point in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, OBC_ERR_CODE_REACHED_EOF once every data point has
+ * been read, error code otherwise
+ */
+obc_error_code_t readNextTelemetryFromFile(telemetry_file_reader_t *reader, telemetry_data_t *telemData);
 
 /**
  * @brief Create and open a new telemetry file in read/write mode.
@@ -95,3 +219,7 @@ obc_error_code_t readNextTelemetryFromFile(int32_t telemFileId, telemetry_data_t
  * @return obc_error_code_t
  */
 obc_error_code_t createAndOpenTelemetryFileRW(uint32_t telemBatchId, int32_t *telemFileId);
+
+#ifdef __cplusplus
+}
+#endif
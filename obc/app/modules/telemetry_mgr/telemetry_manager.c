@@ -6,6 +6,7 @@
 #include "obc_assert.h"
 #include "obc_scheduler_config.h"
 #include "downlink_encoder.h"
+#include "obc_reliance_fs.h"
 
 #include <FreeRTOS.h>
 #include <os_portmacro.h>
@@ -28,6 +29,12 @@
 
 #define STARTING_TELEMETRY_BATCH_ID 0UL
 
+/* Data points taken off the queue are staged in the file writer's blocks in RAM. Full blocks are written as soon as
+   they fill, and everything written while draining the queue is committed with a single transaction. Data points in
+   blocks that haven't filled are written and committed once they've been staged for this long, which bounds how much
+   telemetry a reset can lose. */
+#define TELEMETRY_COMMIT_PERIOD pdMS_TO_TICKS(5UL * 60UL * 1000UL)
+
 /**
  * @brief Check if it's time to downlink telemetry.
  * @return bool True if it's time to downlink telemetry, false otherwise
@@ -42,6 +49,37 @@ static uint8_t telemetryDataQueueStack[TELEMETRY_DATA_QUEUE_LENGTH * TELEMETRY_D
 static SemaphoreHandle_t downlinkReady = NULL;
 static StaticSemaphore_t downlinkReadyBuffer;
 
+// Query for the next downlink, if one has been requested
+static QueueHandle_t downlinkQueryQueueHandle = NULL;
+static StaticQueue_t downlinkQueryQueue;
+static uint8_t downlinkQueryQueueStack[sizeof(telemetry_query_t)];
+
+static telemetry_file_writer_t telemetryFileWriter;
+
+static telemetry_manager_stats_t telemetryMgrStats;
+
+/**
+ * @brief Take every data point waiting in the queue and stage it for the telemetry file
+ *
+ * @return uint32_t Number of data points staged
+ */
+static uint32_t stageQueuedTelemetry(void);
+
+/**
+ * @brief Commit the data points written to the telemetry file so far
+ *
+ * @param telemetryFileId File descriptor of the telemetry file
+ * @param writeStagedBlocks Whether blocks that haven't filled are written first
+ */
+static void commitTelemetry(int32_t telemetryFileId, bool writeStagedBlocks);
+
+// Set once there are data points that haven't been committed, to when the first of them was staged
+static bool hasUncommittedTelemetry = false;
+static TickType_t uncommittedTelemetryTick;
+
+// Value of telemetryFileWriter.numBlocksWritten at the last commit
+static uint32_t numBlocksCommitted = 0;
+
 void obcTaskInitTelemetryMgr(void) {
   memset(&telemetryDataQueue, 0, sizeof(telemetryDataQueue));
   memset(&telemetryDataQueueStack, 0, sizeof(telemetryDataQueueStack));
@@ -52,6 +90,9 @@ void obcTaskInitTelemetryMgr(void) {
 
   ASSERT(&downlinkReadyBuffer != NULL);
   downlinkReady = xSemaphoreCreateBinaryStatic(&downlinkReadyBuffer);
+
+  downlinkQueryQueueHandle =
+      xQueueCreateStatic(1U, sizeof(telemetry_query_t), downlinkQueryQueueStack, &downlinkQueryQueue);
 }
 
 void obcTaskFunctionTelemetryMgr(void *pvParameters) {
@@ -66,26 +107,47 @@ void obcTaskFunctionTelemetryMgr(void *pvParameters) {
 
   // TODO: Deal with errors
   LOG_IF_ERROR_CODE(createAndOpenTelemetryFileRW(telemetryBatchId, &telemetryFileId));
+  LOG_IF_ERROR_CODE(initTelemetryFileWriter(&telemetryFileWriter, telemetryFileId));
 
   while (1) {
-    telemetry_data_t telemData;
-    if (xQueueReceive(telemetryDataQueueHandle, &telemData, TELEMETRY_DATA_QUEUE_WAIT_PERIOD) == pdPASS) {
-      // TODO: Deal with errors
-      LOG_IF_ERROR_CODE(writeTelemetryToFile(telemetryFileId, telemData));
+    if (stageQueuedTelemetry() > 0 && !hasUncommittedTelemetry) {
+      hasUncommittedTelemetry = true;
+      uncommittedTelemetryTick = xTaskGetTickCount();
     }
 
-    // Check if we need to downlink telemetry
-    if (!checkDownlinkAlarm()) {
+    bool blocksWritten = telemetryFileWriter.numBlocksWritten != numBlocksCommitted;
+    bool commitDeadlinePassed =
+        hasUncommittedTelemetry && (xTaskGetTickCount() - uncommittedTelemetryTick) >= TELEMETRY_COMMIT_PERIOD;
+    if (blocksWritten || commitDeadlinePassed) {
+      commitTelemetry(telemetryFileId, commitDeadlinePassed);
+    }
+
+    // Check if we need to downlink telemetry. Queries can select from this batch, so it gets closed either way
+    telemetry_query_t downlinkQuery;
+    bool isQueryDownlink = xQueueReceive(downlinkQueryQueueHandle, &downlinkQuery, 0) == pdPASS;
+    if (!isQueryDownlink && !checkDownlinkAlarm()) {
       continue;
     }
 
-    // Important to close the file before sending it to the comms task
+    // Blocks that haven't filled up yet still belong in this batch, followed by the index so it can be queried
+    LOG_IF_ERROR_CODE(finishTelemetryFile(&telemetryFileWriter));
+
+    // Important to close the file before sending it to the comms task. Closing it is also a transaction point
     LOG_IF_ERROR_CODE(closeTelemetryFile(telemetryFileId));
     if (errCode != OBC_ERR_CODE_SUCCESS) {
       // TODO: Handle this error
     }
 
+    telemetryMgrStats.numCommits++;
+    numBlocksCommitted = telemetryFileWriter.numBlocksWritten;
+    hasUncommittedTelemetry = false;
+
     encode_event_t encodeEvent = {.eventID = DOWNLINK_TELEMETRY_FILE, .telemetryBatchId = telemetryBatchId};
+    if (isQueryDownlink) {
+      encodeEvent.eventID = DOWNLINK_TELEMETRY_QUERY;
+      encodeEvent.telemetryQuery.query = downlinkQuery;
+      encodeEvent.telemetryQuery.newestTelemetryBatchId = telemetryBatchId;
+    }
 
     LOG_IF_ERROR_CODE(sendToDownlinkEncodeQueue(&encodeEvent));
     if (errCode != OBC_ERR_CODE_SUCCESS) {
@@ -103,6 +165,8 @@ void obcTaskFunctionTelemetryMgr(void *pvParameters) {
     if (errCode != OBC_ERR_CODE_SUCCESS) {
       // TODO: Deal with errors
     }
+
+    LOG_IF_ERROR_CODE(initTelemetryFileWriter(&telemetryFileWriter, telemetryFileId));
   }
 }
 
@@ -122,6 +186,59 @@ obc_error_code_t addTelemetryData(telemetry_data_t *data) {
   return OBC_ERR_CODE_QUEUE_FULL;
 }
 
+static uint32_t stageQueuedTelemetry(void) {
+  obc_error_code_t errCode;
+
+  // Wait for the first data point, then take whatever else has queued up without waiting. Stopping after a queue's
+  // worth keeps a producer that never lets up from starving the commit and downlink checks
+  uint32_t numStaged = 0;
+  TickType_t waitPeriod = TELEMETRY_DATA_QUEUE_WAIT_PERIOD;
+  telemetry_data_t telemData;
+  while (numStaged < TELEMETRY_DATA_QUEUE_LENGTH &&
+         xQueueReceive(telemetryDataQueueHandle, &telemData, waitPeriod) == pdPASS) {
+    // TODO: Deal with errors
+    LOG_IF_ERROR_CODE(writeTelemetryToFile(&telemetryFileWriter, &telemData));
+
+    numStaged++;
+    waitPeriod = 0;
+  }
+
+  telemetryMgrStats.numTelemetryStaged += numStaged;
+
+  return numStaged;
+}
+
+static void commitTelemetry(int32_t telemetryFileId, bool writeStagedBlocks) {
+  obc_error_code_t errCode;
+
+  if (writeStagedBlocks) {
+    LOG_IF_ERROR_CODE(flushTelemetryFileWriter(&telemetryFileWriter));
+  }
+
+  // TODO: Deal with errors
+  LOG_IF_ERROR_CODE(syncFile(telemetryFileId));
+
+  telemetryMgrStats.numCommits++;
+  numBlocksCommitted = telemetryFileWriter.numBlocksWritten;
+
+  // Blocks that are still open can hold data points staged before this commit, so the deadline keeps running from
+  // the oldest of them until everything staged has been committed
+  if (telemetryFileWriter.numOpenBlocks == 0) {
+    hasUncommittedTelemetry = false;
+  }
+}
+
+obc_error_code_t getTelemetryManagerStats(telemetry_manager_stats_t *stats) {
+  if (stats == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  *stats = telemetryMgrStats;
+  stats->numFileWrites = telemetryFileWriter.numBlocksWritten;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
 static bool checkDownlinkAlarm(void) { return xSemaphoreTake(downlinkReady, 0) == pdPASS; }
 
 obc_error_code_t setTelemetryManagerDownlinkReady(void) {
@@ -131,3 +248,17 @@ obc_error_code_t setTelemetryManagerDownlinkReady(void) {
 
   return OBC_ERR_CODE_SUCCESS;
 }
+
+obc_error_code_t setTelemetryManagerDownlinkQuery(const telemetry_query_t *query) {
+  if (downlinkQueryQueueHandle == NULL) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  if (query == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  xQueueOverwrite(downlinkQueryQueueHandle, query);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
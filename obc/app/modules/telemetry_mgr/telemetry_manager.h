@@ -2,10 +2,20 @@
 
 #include "obc_errors.h"
 #include "obc_gs_telemetry_data.h"
+#include "telemetry_file_index.h"
 
 #include <stdint.h>
 #include <stddef.h>
 
+/**
+ * @brief Counts of the telemetry manager's work since startup, for comparing against the CPU time it uses
+ */
+typedef struct {
+  uint32_t numTelemetryStaged;  // Data points taken off the telemetry queue
+  uint32_t numFileWrites;       // Writes to telemetry files
+  uint32_t numCommits;          // Transaction points for telemetry files
+} telemetry_manager_stats_t;
+
 /**
  * @brief	Adds a telemetry data point to the telemetry queue
  * @param	data Pointer to the telemetry data point to add
@@ -14,3 +24,17 @@
 obc_error_code_t addTelemetryData(telemetry_data_t *data);
 
 obc_error_code_t setTelemetryManagerDownlinkReady(void);
+
+/**
+ * @brief Downlink the telemetry selected by a query, searching every batch file, at the telemetry manager's next chance
+ * @param query The telemetry to downlink. Replaces any query that hasn't been started yet
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if the query was queued, error code otherwise
+ */
+obc_error_code_t setTelemetryManagerDownlinkQuery(const telemetry_query_t *query);
+
+/**
+ * @brief Get counts of the telemetry manager's work since startup
+ * @param stats Buffer to store the counts in
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, error code otherwise
+ */
+obc_error_code_t getTelemetryManagerStats(telemetry_manager_stats_t *stats);
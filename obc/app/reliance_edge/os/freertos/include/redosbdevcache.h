@@ -0,0 +1,40 @@
+/** @file
+    @brief Counters for the block device write-behind cache; see osbdev.c.
+*/
+#ifndef REDOSBDEVCACHE_H
+#define REDOSBDEVCACHE_H
+
+#include <redfs.h>
+
+/** @brief Counts of the block device cache's activity since startup.
+
+    The number of sectors the cache saved writing is ulWriteHits, and the
+    average run written back is ulSectorsWrittenBack / ulRunsWritten sectors.
+*/
+typedef struct {
+  uint32_t ulReadHits;           /**< Sectors read from the cache. */
+  uint32_t ulReadMisses;         /**< Sectors read from the media. */
+  uint32_t ulWriteHits;          /**< Sectors written over a copy still in the cache. */
+  uint32_t ulWriteMisses;        /**< Sectors written into a free cache slot. */
+  uint32_t ulWriteBypasses;      /**< Sectors written straight to the media, as part of a write too long to cache. */
+  uint32_t ulWriteBacks;         /**< Times the cache was written back, whether flushed or full. */
+  uint32_t ulRunsWritten;        /**< Multi-sector writes issued by write-backs. */
+  uint32_t ulSectorsWrittenBack; /**< Sectors written by those writes. */
+} BDEVCACHESTATS;
+
+/** @brief Get the counts of a block device cache's activity since startup.
+
+    @param bVolNum  The volume number of the volume whose block device cache
+                    is being queried.
+    @param pStats   On successful return, populated with the counts.
+
+    @return A negated ::REDSTATUS code indicating the operation result.
+
+    @retval 0               Operation was successful.
+    @retval -RED_EINVAL     @p bVolNum is an invalid volume number, or @p pStats
+                            is `NULL`.
+    @retval -RED_ENOTSUPP   The block device has no cache.
+*/
+REDSTATUS RedOsBDevGetCacheStats(uint8_t bVolNum, BDEVCACHESTATS *pStats);
+
+#endif
@@ -73,4 +73,16 @@
 */
 #define REDOSCONF_FAKE_UID_GID 0
 
+/** @brief Number of sectors held by the block device write-behind cache.
+
+    Sectors written to the block device are kept in RAM until the cache is
+    full or the block device is flushed, which the core does at every
+    transaction point.  A sector written again before then only reaches the
+    media once, and each run of adjacent sectors is written back with a single
+    multi-sector write.
+
+    Set to 0 to write sectors straight through to the media.
+*/
+#define REDOSCONF_BDEV_CACHE_SECTORS 16U
+
 #endif
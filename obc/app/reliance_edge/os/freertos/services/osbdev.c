@@ -31,6 +31,7 @@
 #include <redfs.h>
 #include <redvolume.h>
 #include <redbdev.h>
+#include <redosbdevcache.h>
 
 /*------------------------------------------------------------------------------
     Porting Note:
@@ -42,6 +43,53 @@
 
 #include "osbdev_fatfs.h"
 
+/*------------------------------------------------------------------------------
+    Write-behind cache
+
+    Sectors written by the file system are held in RAM until the cache fills up
+    or the block device is flushed.  The core flushes before and after writing
+    the metaroot at every transaction point, so everything written by a
+    transaction still reaches the media before the transaction is complete.
+    Between flushes, the order sectors reach the media in doesn't matter to the
+    core, which is what lets the cache put them in sector order and write each
+    run of adjacent sectors with a single multi-sector write.
+------------------------------------------------------------------------------*/
+#if (REDCONF_READ_ONLY == 0) && (REDOSCONF_BDEV_CACHE_SECTORS > 0U)
+
+#define BDEV_CACHE_ENABLED 1
+
+/** @brief The write-behind cache of a volume.
+*/
+typedef struct {
+  /** The sector held by each slot.  Slots [0, ulUsed) hold sectors that
+      haven't been written to the media yet.
+  */
+  uint64_t aullSector[REDOSCONF_BDEV_CACHE_SECTORS];
+  uint32_t ulUsed;
+  BDEVCACHESTATS stats;
+} BDEVCACHE;
+
+static BDEVCACHE gaCache[REDCONF_VOLUME_COUNT];
+
+/*  Each slot's data is at its index times the sector size, so slots holding
+    adjacent sectors in adjacent slots form one buffer that can be written at
+    once.
+*/
+static uint8_t gaabCacheData[REDCONF_VOLUME_COUNT][REDOSCONF_BDEV_CACHE_SECTORS * REDCONF_BLOCK_SIZE];
+
+static REDSTATUS CacheRead(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, uint8_t *pbBuffer);
+static REDSTATUS CacheWrite(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, const uint8_t *pbBuffer);
+static REDSTATUS CacheWriteBack(uint8_t bVolNum);
+static void CacheDiscard(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount);
+static void CacheSort(uint8_t bVolNum);
+static uint32_t CacheFind(uint8_t bVolNum, uint64_t ullSector);
+
+#else
+
+#define BDEV_CACHE_ENABLED 0
+
+#endif
+
 /** @brief Configure a block device.
 
     In some operating environments, block devices need to be configured with
@@ -108,6 +156,10 @@ REDSTATUS RedOsBDevOpen(uint8_t bVolNum, BDEVOPENMODE mode) {
     ret = -RED_EINVAL;
   } else {
     ret = DiskOpen(bVolNum, mode);
+
+#if BDEV_CACHE_ENABLED == 1
+    gaCache[bVolNum].ulUsed = 0U;
+#endif
   }
 
   return ret;
@@ -139,7 +191,21 @@ REDSTATUS RedOsBDevClose(uint8_t bVolNum) {
   if (bVolNum >= REDCONF_VOLUME_COUNT) {
     ret = -RED_EINVAL;
   } else {
+#if BDEV_CACHE_ENABLED == 1
+    /*  The core flushes before closing a volume it wrote to, so this only has
+        anything to write if that flush failed.
+    */
+    REDSTATUS writeBackRet = CacheWriteBack(bVolNum);
+
+    gaCache[bVolNum].ulUsed = 0U;
+
+    ret = DiskClose(bVolNum);
+    if (ret == 0) {
+      ret = writeBackRet;
+    }
+#else
     ret = DiskClose(bVolNum);
+#endif
   }
 
   return ret;
@@ -201,7 +267,11 @@ REDSTATUS RedOsBDevRead(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSec
       (pBuffer == NULL)) {
     ret = -RED_EINVAL;
   } else {
+#if BDEV_CACHE_ENABLED == 1
+    ret = CacheRead(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+#else
     ret = DiskRead(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+#endif
   }
 
   return ret;
@@ -235,7 +305,11 @@ REDSTATUS RedOsBDevWrite(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSe
       (pBuffer == NULL)) {
     ret = -RED_EINVAL;
   } else {
+#if BDEV_CACHE_ENABLED == 1
+    ret = CacheWrite(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+#else
     ret = DiskWrite(bVolNum, ullSectorStart, ulSectorCount, pBuffer);
+#endif
   }
 
   return ret;
@@ -268,10 +342,322 @@ REDSTATUS RedOsBDevFlush(uint8_t bVolNum) {
   if (bVolNum >= REDCONF_VOLUME_COUNT) {
     ret = -RED_EINVAL;
   } else {
+#if BDEV_CACHE_ENABLED == 1
+    ret = CacheWriteBack(bVolNum);
+    if (ret == 0) {
+      ret = DiskFlush(bVolNum);
+    }
+#else
     ret = DiskFlush(bVolNum);
+#endif
   }
 
   return ret;
 }
 
 #endif /* REDCONF_READ_ONLY == 0 */
+
+/** @brief Get the counts of a block device cache's activity since startup.
+
+    @param bVolNum  The volume number of the volume whose block device cache
+                    is being queried.
+    @param pStats   On successful return, populated with the counts.
+
+    @return A negated ::REDSTATUS code indicating the operation result.
+
+    @retval 0               Operation was successful.
+    @retval -RED_EINVAL     @p bVolNum is an invalid volume number, or @p pStats
+                            is `NULL`.
+    @retval -RED_ENOTSUPP   The block device has no cache.
+*/
+REDSTATUS RedOsBDevGetCacheStats(uint8_t bVolNum, BDEVCACHESTATS *pStats) {
+  REDSTATUS ret;
+
+  if ((bVolNum >= REDCONF_VOLUME_COUNT) || (pStats == NULL)) {
+    ret = -RED_EINVAL;
+  } else {
+#if BDEV_CACHE_ENABLED == 1
+    /*  Each count is a single word, so none of them can be torn by a file
+        system operation on another task, even if the set as a whole can be.
+    */
+    *pStats = gaCache[bVolNum].stats;
+    ret = 0;
+#else
+    ret = -RED_ENOTSUPP;
+#endif
+  }
+
+  return ret;
+}
+
+#if BDEV_CACHE_ENABLED == 1
+
+/** @brief Read sectors, taking the ones still in the cache from the cache.
+
+    @param bVolNum          The volume number of the volume whose block device
+                            is being read from.
+    @param ullSectorStart   The starting sector number.
+    @param ulSectorCount    The number of sectors to read.
+    @param pbBuffer         The buffer into which to read the sector data.
+
+    @return A negated ::REDSTATUS code indicating the operation result.
+
+    @retval 0           Operation was successful.
+    @retval -RED_EIO    A disk I/O error occurred.
+*/
+static REDSTATUS CacheRead(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount, uint8_t *pbBuffer) {
+  REDSTATUS ret = 0;
+  BDEVCACHE *pCache = &gaCache[bVolNum];
+  uint32_t ulSectorSize = gaRedBdevInfo[bVolNum].ulSectorSize;
+  uint32_t ulNumCached = 0U;
+  uint32_t ulSlot;
+
+  for (ulSlot = 0U; ulSlot < pCache->ulUsed; ulSlot++) {
+    if ((pCache->aullSector[ulSlot] >= ullSectorStart) &&
+        (pCache->aullSector[ulSlot] - ullSectorStart < ulSectorCount)) {
+      ulNumCached++;
+    }
+  }
+
+  /*  Read the whole range in one go if any of it has to come from the media,
+      then lay the cached sectors over it, since they are newer.
+  */
+  if (ulNumCached < ulSectorCount) {
+    ret = DiskRead(bVolNum, ullSectorStart, ulSectorCount, pbBuffer);
+  }
+
+  if ((ret == 0) && (ulNumCached > 0U)) {
+    for (ulSlot = 0U; ulSlot < pCache->ulUsed; ulSlot++) {
+      if ((pCache->aullSector[ulSlot] >= ullSectorStart) &&
+          (pCache->aullSector[ulSlot] - ullSectorStart < ulSectorCount)) {
+        uint32_t ulSectorIdx = (uint32_t)(pCache->aullSector[ulSlot] - ullSectorStart);
+
+        RedMemCpy(&pbBuffer[ulSectorIdx * ulSectorSize], &gaabCacheData[bVolNum][ulSlot * ulSectorSize],
+                  ulSectorSize);
+      }
+    }
+  }
+
+  if (ret == 0) {
+    pCache->stats.ulReadHits += ulNumCached;
+    pCache->stats.ulReadMisses += ulSectorCount - ulNumCached;
+  }
+
+  return ret;
+}
+
+/** @brief Write sectors into the cache.
+
+    Writes longer than the cache go straight to the media, since they already
+    reach it as a single multi-sector write.
+
+    @param bVolNum          The volume number of the volume whose block device
+                            is being written to.
+    @param ullSectorStart   The starting sector number.
+    @param ulSectorCount    The number of sectors to write.
+    @param pbBuffer         The buffer from which to write the sector data.
+
+    @return A negated ::REDSTATUS code indicating the operation result.
+
+    @retval 0           Operation was successful.
+    @retval -RED_EIO    A disk I/O error occurred.
+*/
+static REDSTATUS CacheWrite(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount,
+                            const uint8_t *pbBuffer) {
+  REDSTATUS ret = 0;
+  BDEVCACHE *pCache = &gaCache[bVolNum];
+  uint32_t ulSectorSize = gaRedBdevInfo[bVolNum].ulSectorSize;
+
+  if (ulSectorCount > REDOSCONF_BDEV_CACHE_SECTORS) {
+    /*  Any copies of these sectors in the cache are older than the ones being
+        written, so they must not be written back over them later.
+    */
+    CacheDiscard(bVolNum, ullSectorStart, ulSectorCount);
+
+    ret = DiskWrite(bVolNum, ullSectorStart, ulSectorCount, pbBuffer);
+    if (ret == 0) {
+      pCache->stats.ulWriteBypasses += ulSectorCount;
+    }
+  } else {
+    uint32_t ulSectorIdx;
+
+    for (ulSectorIdx = 0U; ulSectorIdx < ulSectorCount; ulSectorIdx++) {
+      uint64_t ullSector = ullSectorStart + ulSectorIdx;
+      uint32_t ulSlot = CacheFind(bVolNum, ullSector);
+
+      if (ulSlot < pCache->ulUsed) {
+        pCache->stats.ulWriteHits++;
+      } else {
+        if (pCache->ulUsed == REDOSCONF_BDEV_CACHE_SECTORS) {
+          ret = CacheWriteBack(bVolNum);
+          if (ret != 0) {
+            break;
+          }
+        }
+
+        ulSlot = pCache->ulUsed;
+        pCache->aullSector[ulSlot] = ullSector;
+        pCache->ulUsed++;
+        pCache->stats.ulWriteMisses++;
+      }
+
+      RedMemCpy(&gaabCacheData[bVolNum][ulSlot * ulSectorSize], &pbBuffer[ulSectorIdx * ulSectorSize],
+                ulSectorSize);
+    }
+  }
+
+  return ret;
+}
+
+/** @brief Write every sector in the cache to the media, leaving it empty.
+
+    Sectors are written in order, one multi-sector write per run of adjacent
+    sectors.  If a write fails, every sector stays in the cache, so that
+    retrying the flush writes them all again.
+
+    @param bVolNum  The volume number of the volume whose block device cache
+                    is being written back.
+
+    @return A negated ::REDSTATUS code indicating the operation result.
+
+    @retval 0           Operation was successful.
+    @retval -RED_EIO    A disk I/O error occurred.
+*/
+static REDSTATUS CacheWriteBack(uint8_t bVolNum) {
+  REDSTATUS ret = 0;
+  BDEVCACHE *pCache = &gaCache[bVolNum];
+
+  if (pCache->ulUsed > 0U) {
+    uint32_t ulSectorSize = gaRedBdevInfo[bVolNum].ulSectorSize;
+    uint32_t ulRunStart = 0U;
+
+    CacheSort(bVolNum);
+
+    while (ulRunStart < pCache->ulUsed) {
+      uint32_t ulRunLength = 1U;
+
+      while ((ulRunStart + ulRunLength < pCache->ulUsed) &&
+             (pCache->aullSector[ulRunStart + ulRunLength] == pCache->aullSector[ulRunStart] + ulRunLength)) {
+        ulRunLength++;
+      }
+
+      ret = DiskWrite(bVolNum, pCache->aullSector[ulRunStart], ulRunLength,
+                      &gaabCacheData[bVolNum][ulRunStart * ulSectorSize]);
+      if (ret != 0) {
+        break;
+      }
+
+      pCache->stats.ulRunsWritten++;
+      pCache->stats.ulSectorsWrittenBack += ulRunLength;
+
+      ulRunStart += ulRunLength;
+    }
+
+    if (ret == 0) {
+      pCache->ulUsed = 0U;
+      pCache->stats.ulWriteBacks++;
+    }
+  }
+
+  return ret;
+}
+
+/** @brief Drop any copies of a range of sectors from the cache.
+
+    @param bVolNum          The volume number of the volume whose block device
+                            cache is being updated.
+    @param ullSectorStart   The starting sector number.
+    @param ulSectorCount    The number of sectors to drop.
+*/
+static void CacheDiscard(uint8_t bVolNum, uint64_t ullSectorStart, uint32_t ulSectorCount) {
+  BDEVCACHE *pCache = &gaCache[bVolNum];
+  uint32_t ulSectorSize = gaRedBdevInfo[bVolNum].ulSectorSize;
+  uint32_t ulSlot = 0U;
+
+  while (ulSlot < pCache->ulUsed) {
+    if ((pCache->aullSector[ulSlot] >= ullSectorStart) &&
+        (pCache->aullSector[ulSlot] - ullSectorStart < ulSectorCount)) {
+      /*  Move the last slot into this one.  The slots are only put in order
+          when they are written back, so this doesn't need to keep them in
+          order.
+      */
+      uint32_t ulLast = pCache->ulUsed - 1U;
+
+      if (ulSlot != ulLast) {
+        pCache->aullSector[ulSlot] = pCache->aullSector[ulLast];
+        RedMemCpy(&gaabCacheData[bVolNum][ulSlot * ulSectorSize], &gaabCacheData[bVolNum][ulLast * ulSectorSize],
+                  ulSectorSize);
+      }
+
+      pCache->ulUsed--;
+    } else {
+      ulSlot++;
+    }
+  }
+}
+
+/** @brief Put the slots in the cache in sector order, moving their data with
+           them.
+
+    A selection sort, so that each slot's data is moved at most once.
+
+    @param bVolNum  The volume number of the volume whose block device cache
+                    is being sorted.
+*/
+static void CacheSort(uint8_t bVolNum) {
+  BDEVCACHE *pCache = &gaCache[bVolNum];
+  uint32_t ulSectorSize = gaRedBdevInfo[bVolNum].ulSectorSize;
+  uint32_t ulSlot;
+
+  for (ulSlot = 0U; ulSlot + 1U < pCache->ulUsed; ulSlot++) {
+    uint32_t ulMinSlot = ulSlot;
+    uint32_t ulOther;
+
+    for (ulOther = ulSlot + 1U; ulOther < pCache->ulUsed; ulOther++) {
+      if (pCache->aullSector[ulOther] < pCache->aullSector[ulMinSlot]) {
+        ulMinSlot = ulOther;
+      }
+    }
+
+    if (ulMinSlot != ulSlot) {
+      uint64_t ullSector = pCache->aullSector[ulSlot];
+      uint8_t *pbSlot = &gaabCacheData[bVolNum][ulSlot * ulSectorSize];
+      uint8_t *pbMinSlot = &gaabCacheData[bVolNum][ulMinSlot * ulSectorSize];
+      uint32_t ulByteIdx;
+
+      pCache->aullSector[ulSlot] = pCache->aullSector[ulMinSlot];
+      pCache->aullSector[ulMinSlot] = ullSector;
+
+      for (ulByteIdx = 0U; ulByteIdx < ulSectorSize; ulByteIdx++) {
+        uint8_t bByte = pbSlot[ulByteIdx];
+
+        pbSlot[ulByteIdx] = pbMinSlot[ulByteIdx];
+        pbMinSlot[ulByteIdx] = bByte;
+      }
+    }
+  }
+}
+
+/** @brief Find the slot holding a sector.
+
+    @param bVolNum      The volume number of the volume whose block device
+                        cache is being searched.
+    @param ullSector    The sector number.
+
+    @return The slot holding @p ullSector, or the number of slots in use if it
+            isn't in the cache.
+*/
+static uint32_t CacheFind(uint8_t bVolNum, uint64_t ullSector) {
+  const BDEVCACHE *pCache = &gaCache[bVolNum];
+  uint32_t ulSlot;
+
+  for (ulSlot = 0U; ulSlot < pCache->ulUsed; ulSlot++) {
+    if (pCache->aullSector[ulSlot] == ullSector) {
+      break;
+    }
+  }
+
+  return ulSlot;
+}
+
+#endif /* BDEV_CACHE_ENABLED == 1 */
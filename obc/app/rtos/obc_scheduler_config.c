@@ -27,6 +27,7 @@
 #define TASK_STATS_COLLECTOR_NAME "stats_collector"
 #define TASK_LOGGER_NAME "logger"
 #define TASK_GNC_MGR_NAME "gnc_mgr"
+#define TASK_SPI_ENGINE_NAME "spi_engine"
 
 // Task stack sizes in words
 #define TASK_STATE_MGR_STACK_SIZE 1024U
@@ -44,6 +45,7 @@
 #define TASK_STATS_COLLECTOR_STACK_SIZE 1024U
 #define TASK_LOGGER_STACK_SIZE 512U
 #define TASK_GNC_MGR_STACK_SIZE 1024U
+#define TASK_SPI_ENGINE_STACK_SIZE 512U
 
 // All task priorities must be in [0, OBC_SCHEDULER_MAX_PRIORITY]
 #define OBC_SCHEDULER_MAX_PRIORITY configMAX_PRIORITIES - 1U
@@ -62,12 +64,13 @@
 #define TASK_ALARM_MGR_PRIORITY 4U
 #define TASK_STATE_MGR_PRIORITY 5U
 #define TASK_LOGGER_PRIORITY 5U
+#define TASK_SPI_ENGINE_PRIORITY 5U  // Above the comms tasks, which wait on it for radio FIFO transfers
 #define TASK_TIMEKEEPER_PRIORITY 6U
 #define TASK_DIGITAL_WATCHDOG_MGR_PRIORITY OBC_SCHEDULER_MAX_PRIORITY
 
 /* TYPEDEFS */
 typedef struct {
-  TaskHandle_t *taskHandle;
+  TaskHandle_t taskHandle;
   StaticTask_t *taskBuffer;
   StackType_t *taskStack;
   uint32_t stackSize;
@@ -92,6 +95,7 @@ extern void obcTaskInitHealthCollector(void);
 extern void obcTaskInitStatsCollector(void);
 extern void obcTaskInitLogger(void);
 extern void obcTaskInitGncMgr(void);
+extern void obcTaskInitSpiEngine(void);
 
 /* TASK FUNCTION PROTOTYPES */
 extern void obcTaskFunctionStateMgr(void *params);
@@ -109,6 +113,7 @@ extern void obcTaskFunctionHealthCollector(void *params);
 extern void obcTaskFunctionStatsCollector(void *params);
 extern void obcTaskFunctionLogger(void *params);
 extern void obcTaskFunctionGncMgr(void *params);
+extern void obcTaskFunctionSpiEngine(void *params);
 
 /* PRIVATE FUNCTION PROTOTYPES */
 static obc_scheduler_config_t *obcSchedulerGetConfig(obc_scheduler_config_id_t taskID);
@@ -156,6 +161,9 @@ static StaticTask_t obcTaskBufferLogger;
 static StackType_t obcTaskStackGncMgr[TASK_GNC_MGR_STACK_SIZE];
 static StaticTask_t obcTaskBufferGncMgr;
 
+static StackType_t obcTaskStackSpiEngine[TASK_SPI_ENGINE_STACK_SIZE];
+static StaticTask_t obcTaskBufferSpiEngine;
+
 #if ENABLE_TASK_STATS_COLLECTOR == 1
 static StackType_t obcTaskStackTaskStatsCollector[TASK_STATS_COLLECTOR_STACK_SIZE];
 static StaticTask_t obcTaskBufferTaskStatsCollector;
@@ -302,6 +310,16 @@ static obc_scheduler_config_t obcSchedulerConfig[] = {
             .taskFunc = obcTaskFunctionGncMgr,
             .taskInit = obcTaskInitGncMgr,
         },
+    [OBC_SCHEDULER_CONFIG_ID_SPI_ENGINE] =
+        {
+            .taskName = TASK_SPI_ENGINE_NAME,
+            .taskStack = obcTaskStackSpiEngine,
+            .taskBuffer = &obcTaskBufferSpiEngine,
+            .stackSize = TASK_SPI_ENGINE_STACK_SIZE,
+            .priority = TASK_SPI_ENGINE_PRIORITY,
+            .taskFunc = obcTaskFunctionSpiEngine,
+            .taskInit = obcTaskInitSpiEngine,
+        },
 
 #if ENABLE_TASK_STATS_COLLECTOR == 1
     [OBC_SCHEDULER_CONFIG_ID_STATS_COLLECTOR] =
@@ -16,6 +16,7 @@ typedef enum {
   OBC_SCHEDULER_CONFIG_ID_HEALTH_COLLECTOR,
   OBC_SCHEDULER_CONFIG_ID_LOGGER,
   OBC_SCHEDULER_CONFIG_ID_GNC_MGR,
+  OBC_SCHEDULER_CONFIG_ID_SPI_ENGINE,
 
 #if ENABLE_TASK_STATS_COLLECTOR == 1
   OBC_SCHEDULER_CONFIG_ID_STATS_COLLECTOR,
@@ -131,6 +131,35 @@ obc_error_code_t readFile(int32_t fileId, void *buffer, size_t bufferSize, size_
   return OBC_ERR_CODE_SUCCESS;
 }
 
+obc_error_code_t seekFile(int32_t fileId, size_t offset) {
+  if (fileId < 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  int32_t ret = red_lseek(fileId, (int64_t)offset, RED_SEEK_SET);
+  if (ret < 0) {
+    LOG_ERROR_CODE(red_errno + RELIANCE_EDGE_ERROR_CODES_OFFSET);
+    return OBC_ERR_CODE_FAILED_FILE_SEEK;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t syncFile(int32_t fileId) {
+  if (fileId < 0) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  // RED_TRANSACT_FSYNC is in the transaction mask, so this is a transaction point
+  int32_t ret = red_fsync(fileId);
+  if (ret != 0) {
+    LOG_ERROR_CODE(red_errno + RELIANCE_EDGE_ERROR_CODES_OFFSET);
+    return OBC_ERR_CODE_FAILED_FILE_SYNC;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
 obc_error_code_t getFileSize(int32_t fileId, size_t *fileSize) {
   int32_t curr_pos = red_lseek(fileId, 0, RED_SEEK_CUR);
 
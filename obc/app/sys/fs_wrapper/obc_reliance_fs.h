@@ -5,6 +5,10 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * @brief Setup the file system.
  *
@@ -58,6 +62,23 @@ obc_error_code_t writeFile(int32_t fileId, const void *data, size_t dataLen);
  */
 obc_error_code_t readFile(int32_t fileId, void *buffer, size_t bufferSize, size_t *bytesRead);
 
+/**
+ * @brief Move the read/write position of a file.
+ *
+ * @param fileId File descriptor given by Reliance Edge
+ * @param offset Offset from the start of the file
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+obc_error_code_t seekFile(int32_t fileId, size_t offset);
+
+/**
+ * @brief Commit everything written to a file so far, so that it survives a reset or power loss.
+ *
+ * @param fileId File descriptor given by Reliance Edge
+ * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
+ */
+obc_error_code_t syncFile(int32_t fileId);
+
 /**
  * @brief Get the size of a file.
  *
@@ -66,3 +87,7 @@ obc_error_code_t readFile(int32_t fileId, void *buffer, size_t bufferSize, size_
  * @return obc_error_code_t OBC_ERR_CODE_SUCCESS if successful, otherwise error code
  */
 obc_error_code_t getFileSize(int32_t fileId, size_t *fileSize);
+
+#ifdef __cplusplus
+}
+#endif
@@ -82,6 +82,7 @@ typedef enum {
   OBC_ERR_CODE_AX25_BIT_STUFF_FAILURE,
   OBC_ERR_CODE_AX25_BIT_UNSTUFF_FAILURE,
   OBC_ERR_CODE_AES_DECRYPT_FAILURE,
+  OBC_ERR_CODE_DOWNLINK_NOT_ACKED,
   OBC_ERR_CODE_CC1120_TEST_FAILURE = 599,
 
   /* Payload errors 600 - 699 */
@@ -101,6 +102,7 @@ typedef enum {
   OBC_ERR_CODE_MKDIR_FAILED = 710,
   OBC_ERR_CODE_FAILED_FILE_DELETE = 711,
   OBC_ERR_CODE_FAILED_FILE_SEEK = 712,
+  OBC_ERR_CODE_FAILED_FILE_SYNC = 713,
 
   /* Time errors 800 - 899 */
   OBC_ERR_CODE_UNSUPPORTED_ALARM_TYPE = 800,
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "obc_errors.h"
+
+/* Setup for the host stand-ins of the OBC's peripherals. These are called from main before the scheduler starts; the
+   driver APIs themselves (cc1120Send, framRead, disk_read, ...) are the same ones the firmware calls. */
+
+/**
+ * @brief Opens the pseudo-terminal that stands in for the radio link
+ *
+ * The ground station side of the link is the pseudo-terminal's slave device, which can be opened like a serial port.
+ *
+ * @return obc_error_code_t - OBC_ERR_CODE_UART_FAILURE if the pseudo-terminal couldn't be set up
+ */
+obc_error_code_t simRadioInit(void);
+
+/**
+ * @brief Returns the path of the device the ground station should open to talk to the OBC
+ *
+ * @return const char* - The pseudo-terminal's slave device, or NULL if simRadioInit hasn't succeeded
+ */
+const char *simRadioPortName(void);
+
+/**
+ * @brief Backs the FRAM with a file, so that persistent data survives a restart of the simulation
+ *
+ * Without this, the FRAM only lives in memory.
+ *
+ * @param imagePath - File to load the FRAM contents from and write them through to. Created if it doesn't exist
+ * @return obc_error_code_t - OBC_ERR_CODE_FAILED_FILE_OPEN or OBC_ERR_CODE_FAILED_FILE_READ if the file can't be used
+ */
+obc_error_code_t simFramInit(const char *imagePath);
+
+/**
+ * @brief Sets the disk image that stands in for the microSD card
+ *
+ * @param imagePath - Disk image to use. Created with the volume's size if it doesn't exist
+ * @return obc_error_code_t - OBC_ERR_CODE_FAILED_FILE_OPEN if the image can't be opened or sized
+ */
+obc_error_code_t simSdcInit(const char *imagePath);
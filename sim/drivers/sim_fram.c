@@ -0,0 +1,150 @@
+#include "sim_drivers.h"
+
+#include "fm25v20a.h"
+
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Stand-in for the FM25V20A. The FRAM is an array in memory, optionally written through to a file so that it is
+   non-volatile across runs like the real part. */
+
+#define FRAM_SIZE (FRAM_MAX_ADDRESS + 1U)
+
+// Manufacturer ID (7 bytes of continuation code, then Cypress) followed by the FM25V20A's product ID
+static const uint8_t framId[FRAM_ID_LEN] = {0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xC2, 0x25, 0x08};
+
+static uint8_t framMemory[FRAM_SIZE];
+static uint8_t framStatusReg = 0;
+static bool isAsleep = false;
+static int framImageFd = -1;
+
+/**
+ * @brief Checks that nBytes starting at addr are all within the FRAM
+ */
+static obc_error_code_t checkAddressRange(uint32_t addr, size_t nBytes) {
+  if (addr > FRAM_MAX_ADDRESS || nBytes > FRAM_SIZE - addr) {
+    return OBC_ERR_CODE_FRAM_ADDRESS_OUT_OF_RANGE;
+  }
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t simFramInit(const char *imagePath) {
+  if (imagePath == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  framImageFd = open(imagePath, O_RDWR | O_CREAT, 0644);
+  if (framImageFd < 0) {
+    return OBC_ERR_CODE_FAILED_FILE_OPEN;
+  }
+
+  // A new image reads back as zeros, a shorter one is padded with them
+  if (ftruncate(framImageFd, FRAM_SIZE) != 0) {
+    return OBC_ERR_CODE_FAILED_FILE_OPEN;
+  }
+
+  if (pread(framImageFd, framMemory, FRAM_SIZE, 0) != FRAM_SIZE) {
+    return OBC_ERR_CODE_FAILED_FILE_READ;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+void initFRAM(void) { isAsleep = false; }
+
+obc_error_code_t framReadStatusReg(uint8_t *status) {
+  if (status == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (isAsleep) {
+    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+
+  *status = framStatusReg;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framWriteStatusReg(uint8_t status) {
+  if (isAsleep) {
+    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+
+  framStatusReg = status;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framFastRead(uint32_t addr, uint8_t *buffer, size_t nBytes) { return framRead(addr, buffer, nBytes); }
+
+obc_error_code_t framRead(uint32_t addr, uint8_t *buffer, size_t nBytes) {
+  obc_error_code_t errCode;
+
+  if (buffer == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(checkAddressRange(addr, nBytes));
+
+  if (isAsleep) {
+    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+
+  memcpy(buffer, &framMemory[addr], nBytes);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framWrite(uint32_t addr, const uint8_t *data, size_t nBytes) {
+  obc_error_code_t errCode;
+
+  if (data == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  RETURN_IF_ERROR_CODE(checkAddressRange(addr, nBytes));
+
+  if (isAsleep) {
+    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+
+  memcpy(&framMemory[addr], data, nBytes);
+
+  if (framImageFd >= 0 && pwrite(framImageFd, data, nBytes, addr) != (ssize_t)nBytes) {
+    return OBC_ERR_CODE_FAILED_FILE_WRITE;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framSleep(void) {
+  isAsleep = true;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framWakeUp(void) {
+  isAsleep = false;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t framReadID(uint8_t *id, size_t nBytes) {
+  if (id == NULL || nBytes > FRAM_ID_LEN) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (isAsleep) {
+    LOG_ERROR_CODE(OBC_ERR_CODE_FRAM_IS_ASLEEP);
+    return OBC_ERR_CODE_FRAM_IS_ASLEEP;
+  }
+
+  memcpy(id, framId, nBytes);
+  return OBC_ERR_CODE_SUCCESS;
+}
@@ -0,0 +1,39 @@
+#include "obc_digital_watchdog.h"
+#include "obc_privilege.h"
+#include "obc_reset.h"
+
+#include <FreeRTOS.h>
+
+#include <gio.h>
+#include <sci.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* The parts of the HAL and the RM46 drivers the application calls directly. There is no hardware behind them, so
+   most do nothing. */
+
+BaseType_t prvRaisePrivilege(void) { return pdTRUE; }
+
+void initDigitalWatchdog(void) {}
+
+void feedDigitalWatchdog(void) {}
+
+void resetSystem(obc_reset_reason_t reason) {
+  fprintf(stderr, "OBC reset (reason %d)\n", (int)reason);
+  exit(EXIT_FAILURE);
+}
+
+/* GIO */
+
+void gioToggleBit(gioPORT_t *port, uint32 bit) {
+  (void)port;
+  (void)bit;
+}
+
+/* SCI */
+
+void sciSetBaudrate(sciBASE_t *sci, uint32 baud) {
+  (void)sci;
+  (void)baud;
+}
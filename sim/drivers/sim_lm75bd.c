@@ -0,0 +1,133 @@
+#include "lm75bd.h"
+
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <math.h>
+#include <stdint.h>
+
+/* Stand-in for the LM75BD. The registers are kept in memory and the board sits at a constant temperature. */
+
+#define LM75BD_THYST_RES 0.5f /* Degrees Celsius */
+#define LM75BD_TOS_RES 0.5f   /* Degrees Celsius */
+
+#define LM75BD_TEMP_THRESH_MAX 127.5f /* Degrees Celsius */
+
+#define SIM_BOARD_TEMPERATURE_CELSIUS 25.0f
+
+// Power-on defaults from the datasheet
+static lm75bd_config_t lm75bdConfig = {
+    .devAddr = LM75BD_OBC_I2C_ADDR,
+    .osFaultQueueSize = 1,
+    .osPolarity = LM75BD_OS_POL_ACTIVE_LOW,
+    .osOperationMode = LM75BD_OS_OP_MODE_COMP,
+    .devOperationMode = LM75BD_DEV_OP_MODE_NORMAL,
+    .overTempThresholdCelsius = 80.0f,
+    .hysteresisThresholdCelsius = 75.0f,
+};
+
+obc_error_code_t lm75bdInit(lm75bd_config_t *config) {
+  obc_error_code_t errCode;
+
+  if (config == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  /* TOS must be greater than THYST */
+  if (config->hysteresisThresholdCelsius >= config->overTempThresholdCelsius) return OBC_ERR_CODE_INVALID_ARG;
+
+  RETURN_IF_ERROR_CODE(writeConfigLM75BD(config->devAddr, config->osFaultQueueSize, config->osPolarity,
+                                         config->osOperationMode, config->devOperationMode));
+
+  RETURN_IF_ERROR_CODE(writeThystLM75BD(config->devAddr, config->hysteresisThresholdCelsius));
+  RETURN_IF_ERROR_CODE(writeTosLM75BD(config->devAddr, config->overTempThresholdCelsius));
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t readTempLM75BD(uint8_t devAddr, float *temp) {
+  (void)devAddr;
+
+  if (temp == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  *temp = SIM_BOARD_TEMPERATURE_CELSIUS;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t readConfigLM75BD(lm75bd_config_t *config) {
+  if (config == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  config->osFaultQueueSize = lm75bdConfig.osFaultQueueSize;
+  config->osPolarity = lm75bdConfig.osPolarity;
+  config->osOperationMode = lm75bdConfig.osOperationMode;
+  config->devOperationMode = lm75bdConfig.devOperationMode;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t writeConfigLM75BD(uint8_t devAddr, uint8_t osFaultQueueSize, uint8_t osPolarity,
+                                   uint8_t osOperationMode, uint8_t devOperationMode) {
+  switch (osFaultQueueSize) {
+    case 1:
+    case 2:
+    case 4:
+    case 6:
+      break;
+    default:
+      return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (osPolarity > 1 || osOperationMode > 1 || devOperationMode > 1) return OBC_ERR_CODE_INVALID_ARG;
+
+  lm75bdConfig.devAddr = devAddr;
+  lm75bdConfig.osFaultQueueSize = osFaultQueueSize;
+  lm75bdConfig.osPolarity = osPolarity;
+  lm75bdConfig.osOperationMode = osOperationMode;
+  lm75bdConfig.devOperationMode = devOperationMode;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t readThystLM75BD(uint8_t devAddr, float *hysteresisThresholdCelsius) {
+  (void)devAddr;
+
+  if (hysteresisThresholdCelsius == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  *hysteresisThresholdCelsius = lm75bdConfig.hysteresisThresholdCelsius;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t writeThystLM75BD(uint8_t devAddr, float hysteresisThresholdCelsius) {
+  (void)devAddr;
+
+  /* Threshold must be a multiple of the resolution and less than 127.5 degrees Celsius */
+  if (fmod(hysteresisThresholdCelsius, LM75BD_THYST_RES) != 0 ||
+      fabs(hysteresisThresholdCelsius) > LM75BD_TEMP_THRESH_MAX)
+    return OBC_ERR_CODE_INVALID_ARG;
+
+  lm75bdConfig.hysteresisThresholdCelsius = hysteresisThresholdCelsius;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t readTosLM75BD(uint8_t devAddr, float *overTempThresholdCelsius) {
+  (void)devAddr;
+
+  if (overTempThresholdCelsius == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  *overTempThresholdCelsius = lm75bdConfig.overTempThresholdCelsius;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t writeTosLM75BD(uint8_t devAddr, float overTempThresholdCelsius) {
+  (void)devAddr;
+
+  /* Threshold must be a multiple of the resolution and less than 127.5 degrees Celsius */
+  if (fmod(overTempThresholdCelsius, LM75BD_TOS_RES) != 0 || fabs(overTempThresholdCelsius) > LM75BD_TEMP_THRESH_MAX)
+    return OBC_ERR_CODE_INVALID_ARG;
+
+  lm75bdConfig.overTempThresholdCelsius = overTempThresholdCelsius;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+void osHandlerLM75BD(uint8_t devAddr) {
+  // The temperature never crosses the thresholds, so the OS output never goes active
+  (void)devAddr;
+}
@@ -0,0 +1,202 @@
+#include "sim_drivers.h"
+
+#include "cc1120_txrx.h"
+#include "cc1120.h"
+#include "rffm6404.h"
+#include "uplink_decoder.h"
+
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* Stand-in for the CC1120 and its RF front end. The radio link is a pseudo-terminal: whatever the OBC transmits can be
+   read from the slave device, and whatever is written to the slave device is received by the OBC. There is no air
+   data rate, so a pass runs as fast as both ends can process frames. */
+
+// Same limit as cc1120_txrx.c on the bytes received in one go before the reception is cut off
+#define COMMS_MAX_UPLINK_BYTES 1000U
+
+// A reception ends once nothing has arrived for this long, like the CC1120's RX FIFO threshold timeout
+#define RX_IDLE_TIMEOUT pdMS_TO_TICKS(100)
+
+// The pseudo-terminal is non-blocking, so tasks waiting on it sleep between polls to let the others run
+#define RADIO_POLL_PERIOD pdMS_TO_TICKS(1)
+
+static int radioFd = -1;
+static int radioSlaveFd = -1;
+static const char *radioPortName = NULL;
+
+/**
+ * @brief Reads whatever has arrived over the radio link, up to len bytes
+ *
+ * @param buf - Buffer to read into
+ * @param len - Size of buf
+ * @return ssize_t - Number of bytes read, 0 if nothing has arrived, or -1 if the link failed
+ */
+static ssize_t radioRead(uint8_t *buf, size_t len) {
+  ssize_t numRead = read(radioFd, buf, len);
+  if (numRead < 0 && (errno == EAGAIN || errno == EINTR)) {
+    return 0;
+  }
+  return numRead;
+}
+
+obc_error_code_t simRadioInit(void) {
+  radioFd = posix_openpt(O_RDWR | O_NOCTTY);
+  if (radioFd < 0) {
+    return OBC_ERR_CODE_UART_FAILURE;
+  }
+
+  if (grantpt(radioFd) != 0 || unlockpt(radioFd) != 0 || (radioPortName = ptsname(radioFd)) == NULL) {
+    return OBC_ERR_CODE_UART_FAILURE;
+  }
+
+  // Keep the slave end open so the link stays up while the ground station connects and disconnects. It also has to
+  // be raw, since frames are binary
+  radioSlaveFd = open(radioPortName, O_RDWR | O_NOCTTY);
+  if (radioSlaveFd < 0) {
+    return OBC_ERR_CODE_UART_FAILURE;
+  }
+
+  struct termios attributes;
+  if (tcgetattr(radioSlaveFd, &attributes) != 0) {
+    return OBC_ERR_CODE_UART_FAILURE;
+  }
+  cfmakeraw(&attributes);
+  if (tcsetattr(radioSlaveFd, TCSANOW, &attributes) != 0) {
+    return OBC_ERR_CODE_UART_FAILURE;
+  }
+
+  if (fcntl(radioFd, F_SETFL, fcntl(radioFd, F_GETFL) | O_NONBLOCK) != 0) {
+    return OBC_ERR_CODE_UART_FAILURE;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+const char *simRadioPortName(void) { return radioPortName; }
+
+/* CC1120 */
+
+obc_error_code_t cc1120Init(void) {
+  if (radioFd < 0) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  // Anything sent while the radio was off was never received
+  tcflush(radioFd, TCIFLUSH);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t cc1120StrobeSpi(uint8_t addr) {
+  // There are no radio states to switch between, the link can always send and receive
+  (void)addr;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+void initAllCc1120TxRxSemaphores(void) {}
+
+obc_error_code_t cc1120Send(uint8_t *data, uint32_t len, TickType_t txFifoEmptyTimeoutTicks) {
+  if (data == NULL || len < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (radioFd < 0) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  // The write only blocks if the ground station isn't keeping up, which is when the real TX FIFO wouldn't drain
+  TickType_t startTick = xTaskGetTickCount();
+  uint32_t numSent = 0;
+  while (numSent < len) {
+    ssize_t numWritten = write(radioFd, data + numSent, len - numSent);
+    if (numWritten > 0) {
+      numSent += (uint32_t)numWritten;
+      continue;
+    }
+
+    if (numWritten < 0 && errno != EAGAIN && errno != EINTR) {
+      return OBC_ERR_CODE_UART_FAILURE;
+    }
+
+    if (xTaskGetTickCount() - startTick >= txFifoEmptyTimeoutTicks) {
+      return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+    }
+    vTaskDelay(RADIO_POLL_PERIOD);
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t cc1120ReceiveToDecodeTask(TickType_t syncWordTimeoutTicks) {
+  obc_error_code_t errCode;
+
+  if (radioFd < 0) {
+    return OBC_ERR_CODE_INVALID_STATE;
+  }
+
+  uint8_t dataBuffer[TXRX_INTERRUPT_THRESHOLD];
+
+  // The first byte to arrive stands in for the sync word
+  TickType_t startTick = xTaskGetTickCount();
+  ssize_t numRead;
+  while ((numRead = radioRead(dataBuffer, sizeof(dataBuffer))) == 0) {
+    if (xTaskGetTickCount() - startTick >= syncWordTimeoutTicks) {
+      LOG_ERROR_CODE(OBC_ERR_CODE_SEMAPHORE_TIMEOUT);
+      return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+    }
+    vTaskDelay(RADIO_POLL_PERIOD);
+  }
+
+  // Hand bytes to the decode task as they arrive until the ground station stops transmitting
+  uint32_t numReceived = 0;
+  TickType_t lastRxTick = xTaskGetTickCount();
+  while (true) {
+    if (numRead < 0) {
+      return OBC_ERR_CODE_CC1120_RECEIVE_FAILURE;
+    }
+
+    if (numRead > 0) {
+      LOG_IF_ERROR_CODE(sendToDecodeDataQueue(dataBuffer, (uint16_t)numRead));
+      numReceived += (uint32_t)numRead;
+      lastRxTick = xTaskGetTickCount();
+
+      if (numReceived >= COMMS_MAX_UPLINK_BYTES) {
+        // The reception was cut off by the OBC rather than ending on its own
+        return OBC_ERR_CODE_CC1120_RECEIVE_TERMINATED;
+      }
+    } else if (xTaskGetTickCount() - lastRxTick >= RX_IDLE_TIMEOUT) {
+      break;
+    } else {
+      vTaskDelay(RADIO_POLL_PERIOD);
+    }
+
+    size_t maxRead = COMMS_MAX_UPLINK_BYTES - numReceived;
+    numRead = radioRead(dataBuffer, maxRead < sizeof(dataBuffer) ? maxRead : sizeof(dataBuffer));
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/* RFFM6404 */
+
+obc_error_code_t rffm6404ActivateRx(void) { return OBC_ERR_CODE_SUCCESS; }
+
+obc_error_code_t rffm6404ActivateTx(float voltagePowerControl) {
+  (void)voltagePowerControl;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t rffm6404ActivateRecvByp(void) { return OBC_ERR_CODE_SUCCESS; }
+
+obc_error_code_t rffm6404PowerOff(void) { return OBC_ERR_CODE_SUCCESS; }
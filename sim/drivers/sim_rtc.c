@@ -0,0 +1,422 @@
+#include "ds3232_mz.h"
+#include "alarm_handler.h"
+
+#include "obc_errors.h"
+#include "obc_logging.h"
+
+#include <FreeRTOS.h>
+#include <os_timer.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+/* Stand-in for the DS3232. The RTC runs off the host clock, offset to whatever time it was last set to, and the alarm
+   interrupt is raised from a FreeRTOS timer that checks for an alarm match a few times a second. */
+
+#define MAX_SECONDS 59U
+#define MAX_MINUTES 59U
+#define MAX_HOURS 23U
+#define MIN_DAY 1U
+#define MAX_DAY 7U
+#define MIN_DATE 1U
+#define MAX_DATE 31U
+#define MIN_MONTH 1U
+#define MAX_MONTH 12U
+#define MAX_YEAR 99U
+
+// Temperature reported by the RTC's sensor
+#define SIM_RTC_TEMPERATURE_CELSIUS 25.0f
+
+// Checked more often than once a second so that no second is skipped
+#define ALARM_CHECK_PERIOD pdMS_TO_TICKS(100)
+
+typedef struct {
+  bool matchDate;
+  bool matchHours;
+  bool matchMinutes;
+  bool matchSeconds;
+  rtc_alarm_time_t time;
+} sim_rtc_alarm_t;
+
+// Seconds to add to the host's time to get the RTC's
+static time_t rtcOffsetSeconds = 0;
+// The day of the week register counts independently of the date, so it's kept as an offset from the host's too
+static int8_t rtcDayOffset = 0;
+
+static rtc_control_t rtcControl = {0};
+static rtc_status_t rtcStatus = {0};
+static int8_t rtcAgingOffset = 0;
+
+// The alarm registers power up cleared, which is a date, hours, minutes (and seconds) match on date 0, so never
+static sim_rtc_alarm_t rtcAlarm1 = {.matchDate = true, .matchHours = true, .matchMinutes = true, .matchSeconds = true};
+static sim_rtc_alarm_t rtcAlarm2 = {.matchDate = true, .matchHours = true, .matchMinutes = true};
+
+static TimerHandle_t alarmTimerHandle = NULL;
+static StaticTimer_t alarmTimer;
+static time_t lastAlarmCheckTime = 0;
+
+/**
+ * @brief Returns the RTC's current time broken down in UTC
+ */
+static struct tm getRtcTm(void) {
+  time_t now = time(NULL) + rtcOffsetSeconds;
+  struct tm tm;
+  gmtime_r(&now, &tm);
+  return tm;
+}
+
+/**
+ * @brief Sets the RTC's current time from a broken down UTC time
+ */
+static void setRtcTm(struct tm *tm) {
+  tm->tm_isdst = 0;
+  rtcOffsetSeconds = timegm(tm) - time(NULL);
+}
+
+static bool alarmMatches(const sim_rtc_alarm_t *alarm, const struct tm *tm) {
+  return (!alarm->matchSeconds || alarm->time.time.seconds == tm->tm_sec) &&
+         (!alarm->matchMinutes || alarm->time.time.minutes == tm->tm_min) &&
+         (!alarm->matchHours || alarm->time.time.hours == tm->tm_hour) &&
+         (!alarm->matchDate || alarm->time.date == tm->tm_mday);
+}
+
+/**
+ * @brief Whether the INT/SQW pin is being driven low by an alarm
+ */
+static bool isAlarmInterruptAsserted(void) {
+  return rtcControl.INTCN && ((rtcControl.A1IE && rtcStatus.A1F) || (rtcControl.A2IE && rtcStatus.A2F));
+}
+
+/**
+ * @brief Sets the alarm flags for any alarm that matches the current second and raises the interrupt, which stays
+ * asserted (so doesn't fire again) until the flag is cleared
+ */
+static void alarmTimerCallback(TimerHandle_t timer) {
+  (void)timer;
+
+  time_t now = time(NULL) + rtcOffsetSeconds;
+  if (now == lastAlarmCheckTime) {
+    return;
+  }
+  lastAlarmCheckTime = now;
+
+  struct tm tm;
+  gmtime_r(&now, &tm);
+
+  bool interruptAsserted = isAlarmInterruptAsserted();
+
+  if (alarmMatches(&rtcAlarm1, &tm)) {
+    rtcStatus.A1F = 1;
+  }
+  // Alarm 2 has no seconds register and goes off at the start of the minute
+  if (tm.tm_sec == 0 && alarmMatches(&rtcAlarm2, &tm)) {
+    rtcStatus.A2F = 1;
+  }
+
+  if (!interruptAsserted && isAlarmInterruptAsserted()) {
+    alarmInterruptCallback();
+  }
+}
+
+obc_error_code_t rtcInit(rtc_date_time_t *dateTime) {
+  obc_error_code_t errCode;
+
+  if (dateTime == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  turnOnRTC();
+  RETURN_IF_ERROR_CODE(setCurrentDateTimeRTC(dateTime));
+
+  if (alarmTimerHandle == NULL) {
+    alarmTimerHandle =
+        xTimerCreateStatic("rtc_alarm", ALARM_CHECK_PERIOD, pdTRUE, NULL, alarmTimerCallback, &alarmTimer);
+    xTimerStart(alarmTimerHandle, 0);
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+void turnOnRTC(void) {}
+
+void resetRTC(void) {
+  rtcOffsetSeconds = 0;
+  rtcDayOffset = 0;
+  rtcControl = (rtc_control_t){0};
+  rtcStatus = (rtc_status_t){0};
+  rtcAgingOffset = 0;
+}
+
+/*-------GET FUNCTIONS---------*/
+
+obc_error_code_t getSecondsRTC(uint8_t *seconds) {
+  if (seconds == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *seconds = (uint8_t)getRtcTm().tm_sec;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getMinutesRTC(uint8_t *minutes) {
+  if (minutes == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *minutes = (uint8_t)getRtcTm().tm_min;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getHoursRTC(uint8_t *hours) {
+  if (hours == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *hours = (uint8_t)getRtcTm().tm_hour;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getDayRTC(uint8_t *day) {
+  if (day == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *day = (uint8_t)((getRtcTm().tm_wday + rtcDayOffset + MAX_DAY) % MAX_DAY + MIN_DAY);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getDateRTC(uint8_t *date) {
+  if (date == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *date = (uint8_t)getRtcTm().tm_mday;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getMonthRTC(uint8_t *month) {
+  if (month == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *month = (uint8_t)(getRtcTm().tm_mon + 1);
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getYearRTC(uint8_t *year) {
+  if (year == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *year = (uint8_t)((getRtcTm().tm_year + 1900 - RTC_YEAR_OFFSET) % (MAX_YEAR + 1));
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getCurrentDateTimeRTC(rtc_date_time_t *dateTime) {
+  if (dateTime == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  // Read every field from the same instant, like the DS3232's buffered time registers
+  struct tm tm = getRtcTm();
+  dateTime->date.date = (uint8_t)tm.tm_mday;
+  dateTime->date.month = (uint8_t)(tm.tm_mon + 1);
+  dateTime->date.year = (uint8_t)((tm.tm_year + 1900 - RTC_YEAR_OFFSET) % (MAX_YEAR + 1));
+  dateTime->time.hours = (uint8_t)tm.tm_hour;
+  dateTime->time.minutes = (uint8_t)tm.tm_min;
+  dateTime->time.seconds = (uint8_t)tm.tm_sec;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getCurrentTimeRTC(rtc_time_t *time) {
+  if (time == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  struct tm tm = getRtcTm();
+  time->hours = (uint8_t)tm.tm_hour;
+  time->minutes = (uint8_t)tm.tm_min;
+  time->seconds = (uint8_t)tm.tm_sec;
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getAlarmTimeRTC(rtc_alarm_time_t *alarmTime) {
+  if (alarmTime == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *alarmTime = rtcAlarm1.time;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getControlRTC(rtc_control_t *control) {
+  if (control == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *control = rtcControl;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getStatusRTC(rtc_status_t *status) {
+  if (status == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *status = rtcStatus;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getAgingOffsetRTC(int8_t *agingOffset) {
+  if (agingOffset == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *agingOffset = rtcAgingOffset;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t getTemperatureRTC(float *temperature) {
+  if (temperature == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  *temperature = SIM_RTC_TEMPERATURE_CELSIUS;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/*-------SET FUNCTIONS---------*/
+
+obc_error_code_t setSecondsRTC(uint8_t writeSeconds) {
+  if (writeSeconds > MAX_SECONDS) return OBC_ERR_CODE_INVALID_ARG;
+
+  struct tm tm = getRtcTm();
+  tm.tm_sec = writeSeconds;
+  setRtcTm(&tm);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setMinutesRTC(uint8_t writeMinutes) {
+  if (writeMinutes > MAX_MINUTES) return OBC_ERR_CODE_INVALID_ARG;
+
+  struct tm tm = getRtcTm();
+  tm.tm_min = writeMinutes;
+  setRtcTm(&tm);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setHourRTC(uint8_t writeHour) {
+  if (writeHour > MAX_HOURS) return OBC_ERR_CODE_INVALID_ARG;
+
+  struct tm tm = getRtcTm();
+  tm.tm_hour = writeHour;
+  setRtcTm(&tm);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setDayRTC(uint8_t writeDays) {
+  if (writeDays < MIN_DAY || writeDays > MAX_DAY) return OBC_ERR_CODE_INVALID_ARG;
+
+  rtcDayOffset = (int8_t)((writeDays - MIN_DAY) - getRtcTm().tm_wday);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setDateRTC(uint8_t writeDates) {
+  if (writeDates < MIN_DATE || writeDates > MAX_DATE) return OBC_ERR_CODE_INVALID_ARG;
+
+  struct tm tm = getRtcTm();
+  tm.tm_mday = writeDates;
+  setRtcTm(&tm);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setMonthRTC(uint8_t writeMonths) {
+  uint8_t monthNum = writeMonths & 0x1F;
+  if (monthNum > MAX_MONTH || monthNum < MIN_MONTH) return OBC_ERR_CODE_INVALID_ARG;
+
+  struct tm tm = getRtcTm();
+  tm.tm_mon = monthNum - 1;
+  setRtcTm(&tm);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setYearRTC(uint8_t writeYears) {
+  if (writeYears > MAX_YEAR) return OBC_ERR_CODE_INVALID_ARG;
+
+  struct tm tm = getRtcTm();
+  tm.tm_year = RTC_YEAR_OFFSET + writeYears - 1900;
+  setRtcTm(&tm);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setCurrentDateTimeRTC(rtc_date_time_t *writeDateTime) {
+  if (writeDateTime == NULL) return OBC_ERR_CODE_INVALID_ARG;
+
+  if (writeDateTime->time.seconds > MAX_SECONDS || writeDateTime->time.minutes > MAX_MINUTES ||
+      writeDateTime->time.hours > MAX_HOURS || writeDateTime->date.date < MIN_DATE ||
+      writeDateTime->date.date > MAX_DATE || writeDateTime->date.month < MIN_MONTH ||
+      writeDateTime->date.month > MAX_MONTH || writeDateTime->date.year > MAX_YEAR) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  struct tm tm = {
+      .tm_sec = writeDateTime->time.seconds,
+      .tm_min = writeDateTime->time.minutes,
+      .tm_hour = writeDateTime->time.hours,
+      .tm_mday = writeDateTime->date.date,
+      .tm_mon = writeDateTime->date.month - 1,
+      .tm_year = RTC_YEAR_OFFSET + writeDateTime->date.year - 1900,
+  };
+  setRtcTm(&tm);
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setControlRTC(rtc_control_t *writeControl) {
+  if (writeControl == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  rtcControl = *writeControl;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setStatusRTC(rtc_status_t *writeStatus) {
+  if (writeStatus == NULL) return OBC_ERR_CODE_INVALID_ARG;
+  rtcStatus = *writeStatus;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setAgingOffsetRTC(int8_t writeAgingOffset) {
+  rtcAgingOffset = writeAgingOffset;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setAlarm1RTC(rtc_alarm1_mode_t mode, rtc_alarm_time_t dt) {
+  sim_rtc_alarm_t alarm = {.time = dt};
+
+  switch (mode) {
+    case RTC_ALARM1_ONCE_PER_SECOND:
+      break;
+    case RTC_ALARM1_MATCH_DATE_HOURS_MINUTES_SECONDS:
+      alarm.matchDate = true;
+      // fall through
+    case RTC_ALARM1_MATCH_HOURS_MINUTES_SECONDS:
+      alarm.matchHours = true;
+      // fall through
+    case RTC_ALARM1_MATCH_MINUTES_SECONDS:
+      alarm.matchMinutes = true;
+      // fall through
+    case RTC_ALARM1_MATCH_SECONDS:
+      alarm.matchSeconds = true;
+      break;
+    default:
+      return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (dt.time.seconds > MAX_SECONDS || dt.time.minutes > MAX_MINUTES || dt.time.hours > MAX_HOURS ||
+      (alarm.matchDate && (dt.date < MIN_DATE || dt.date > MAX_DATE))) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  rtcAlarm1 = alarm;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t setAlarm2RTC(rtc_alarm2_mode_t mode, rtc_alarm_time_t dt) {
+  sim_rtc_alarm_t alarm = {.time = dt};
+
+  switch (mode) {
+    case RTC_ALARM2_ONCE_PER_MINUTE:
+      break;
+    case RTC_ALARM2_MATCH_DATE_HOURS_MINUTES:
+      alarm.matchDate = true;
+      // fall through
+    case RTC_ALARM2_MATCH_HOURS_MINUTES:
+      alarm.matchHours = true;
+      // fall through
+    case RTC_ALARM2_MATCH_MINUTES:
+      alarm.matchMinutes = true;
+      break;
+    default:
+      return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (dt.time.minutes > MAX_MINUTES || dt.time.hours > MAX_HOURS ||
+      (alarm.matchDate && (dt.date < MIN_DATE || dt.date > MAX_DATE))) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  rtcAlarm2 = alarm;
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+obc_error_code_t clearAlarm1RTC(void) {
+  rtcStatus.A1F = 0;
+  return OBC_ERR_CODE_SUCCESS;
+}
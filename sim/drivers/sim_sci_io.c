@@ -0,0 +1,85 @@
+#include "obc_sci_io.h"
+#include "obc_errors.h"
+
+#include <FreeRTOS.h>
+#include <os_semphr.h>
+#include <os_task.h>
+
+#include <sci.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/* Stand-in for the SCI driver. The print UART is the simulation's stdout; stdin belongs to the pass console, so
+   nothing is ever received. */
+
+static SemaphoreHandle_t sciMutex = NULL;
+static StaticSemaphore_t sciMutexBuffer;
+static SemaphoreHandle_t sciLinMutex = NULL;
+static StaticSemaphore_t sciLinMutexBuffer;
+
+void initSciMutex(void) {
+  if (sciMutex == NULL) {
+    sciMutex = xSemaphoreCreateMutexStatic(&sciMutexBuffer);
+  }
+  configASSERT(sciMutex);
+
+  if (sciLinMutex == NULL) {
+    sciLinMutex = xSemaphoreCreateMutexStatic(&sciLinMutexBuffer);
+  }
+  configASSERT(sciLinMutex);
+}
+
+obc_error_code_t sciReadBytes(uint8_t *buf, size_t numBytes, TickType_t uartMutexTimeoutTicks,
+                              size_t transferCompleteTimeoutTicks, sciBASE_t *sciReg) {
+  if (!(sciReg == scilinREG || sciReg == sciREG)) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (buf == NULL || numBytes < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  SemaphoreHandle_t mutex = (sciReg == sciREG) ? sciMutex : sciLinMutex;
+  configASSERT(mutex != NULL);
+
+  if (xSemaphoreTake(mutex, uartMutexTimeoutTicks) != pdTRUE) {
+    return OBC_ERR_CODE_MUTEX_TIMEOUT;
+  }
+
+  // Nothing is connected to the receive line, so the transfer never completes
+  vTaskDelay((TickType_t)transferCompleteTimeoutTicks);
+
+  xSemaphoreGive(mutex);
+  return OBC_ERR_CODE_SEMAPHORE_TIMEOUT;
+}
+
+obc_error_code_t sciSendBytes(uint8_t *buf, size_t numBytes, TickType_t uartMutexTimeoutTicks, sciBASE_t *sciReg) {
+  if (!(sciReg == scilinREG || sciReg == sciREG)) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  if (buf == NULL || numBytes < 1) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  SemaphoreHandle_t mutex = (sciReg == sciREG) ? sciMutex : sciLinMutex;
+  configASSERT(mutex != NULL);
+
+  if (xSemaphoreTake(mutex, uartMutexTimeoutTicks) != pdTRUE) {
+    return OBC_ERR_CODE_MUTEX_TIMEOUT;
+  }
+
+  obc_error_code_t errCode = OBC_ERR_CODE_SUCCESS;
+  size_t numSent = 0;
+  while (numSent < numBytes) {
+    ssize_t numWritten = write(STDOUT_FILENO, buf + numSent, numBytes - numSent);
+    if (numWritten <= 0) {
+      errCode = OBC_ERR_CODE_UART_FAILURE;
+      break;
+    }
+    numSent += (size_t)numWritten;
+  }
+
+  xSemaphoreGive(mutex);
+  return errCode;
+}
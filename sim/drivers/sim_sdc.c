@@ -0,0 +1,117 @@
+#include "sim_drivers.h"
+
+#include "sdc_diskio.h"
+
+#include "obc_errors.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Stand-in for the microSD card. Sectors are read from and written to a disk image on the host, so the file system
+   persists across runs and can be inspected offline. */
+
+#define SDC_SECTOR_SIZE 512U
+
+// Size of a new image; matches the volume configured in redconf.c
+#define SDC_DEFAULT_SECTOR_COUNT 1024U
+
+// Erase block size in sectors reported to the file system
+#define SDC_BLOCK_SIZE 1U
+
+static int sdcImageFd = -1;
+static DSTATUS sdcStatus = STA_NOINIT;
+
+obc_error_code_t simSdcInit(const char *imagePath) {
+  if (imagePath == NULL) {
+    return OBC_ERR_CODE_INVALID_ARG;
+  }
+
+  sdcImageFd = open(imagePath, O_RDWR | O_CREAT, 0644);
+  if (sdcImageFd < 0) {
+    return OBC_ERR_CODE_FAILED_FILE_OPEN;
+  }
+
+  struct stat imageStat;
+  if (fstat(sdcImageFd, &imageStat) != 0) {
+    return OBC_ERR_CODE_FAILED_FILE_OPEN;
+  }
+
+  if (imageStat.st_size < (off_t)SDC_SECTOR_SIZE &&
+      ftruncate(sdcImageFd, (off_t)SDC_DEFAULT_SECTOR_COUNT * SDC_SECTOR_SIZE) != 0) {
+    return OBC_ERR_CODE_FAILED_FILE_OPEN;
+  }
+
+  return OBC_ERR_CODE_SUCCESS;
+}
+
+/**
+ * @brief Returns the number of whole sectors in the disk image
+ */
+static uint32_t getSectorCount(void) {
+  struct stat imageStat;
+  if (fstat(sdcImageFd, &imageStat) != 0) {
+    return 0;
+  }
+  return (uint32_t)(imageStat.st_size / SDC_SECTOR_SIZE);
+}
+
+DSTATUS disk_initialize(uint8_t pdrv) {
+  if (pdrv != 0) return STA_NOINIT;
+
+  sdcStatus = (sdcImageFd < 0) ? (STA_NOINIT | STA_NODISK) : 0;
+  return sdcStatus;
+}
+
+DSTATUS disk_status(uint8_t pdrv) {
+  if (pdrv != 0) return STA_NOINIT;
+  return sdcStatus;
+}
+
+DRESULT disk_read(uint8_t pdrv, uint8_t *buff, uint32_t sector, uint32_t count) {
+  if (pdrv != 0 || buff == NULL || count == 0) return RES_PARERR;
+  if (sdcStatus & STA_NOINIT) return RES_NOTRDY;
+  if (sector >= getSectorCount() || count > getSectorCount() - sector) return RES_PARERR;
+
+  size_t len = (size_t)count * SDC_SECTOR_SIZE;
+  if (pread(sdcImageFd, buff, len, (off_t)sector * SDC_SECTOR_SIZE) != (ssize_t)len) return RES_ERROR;
+
+  return RES_OK;
+}
+
+DRESULT disk_write(uint8_t pdrv, const uint8_t *buff, uint32_t sector, uint32_t count) {
+  if (pdrv != 0 || buff == NULL || count == 0) return RES_PARERR;
+  if (sdcStatus & STA_NOINIT) return RES_NOTRDY;
+  if (sdcStatus & STA_PROTECT) return RES_WRPRT;
+  if (sector >= getSectorCount() || count > getSectorCount() - sector) return RES_PARERR;
+
+  size_t len = (size_t)count * SDC_SECTOR_SIZE;
+  if (pwrite(sdcImageFd, buff, len, (off_t)sector * SDC_SECTOR_SIZE) != (ssize_t)len) return RES_ERROR;
+
+  return RES_OK;
+}
+
+DRESULT disk_ioctl(uint8_t pdrv, uint8_t cmd, void *buff) {
+  if (pdrv != 0) return RES_PARERR;
+  if (sdcStatus & STA_NOINIT) return RES_NOTRDY;
+
+  switch (cmd) {
+    case CTRL_SYNC:
+      return (fsync(sdcImageFd) == 0) ? RES_OK : RES_ERROR;
+    case GET_SECTOR_COUNT:
+      if (buff == NULL) return RES_PARERR;
+      *(uint32_t *)buff = getSectorCount();
+      return RES_OK;
+    case GET_SECTOR_SIZE:
+      if (buff == NULL) return RES_PARERR;
+      *(uint16_t *)buff = SDC_SECTOR_SIZE;
+      return RES_OK;
+    case GET_BLOCK_SIZE:
+      if (buff == NULL) return RES_PARERR;
+      *(uint32_t *)buff = SDC_BLOCK_SIZE;
+      return RES_OK;
+    default:
+      return RES_PARERR;
+  }
+}
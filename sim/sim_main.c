@@ -0,0 +1,175 @@
+#include "sim_drivers.h"
+
+#include "comms_manager.h"
+#include "obc_errors.h"
+#include "obc_logging.h"
+#include "obc_reliance_fs.h"
+#include "obc_reset.h"
+#include "obc_sci_io.h"
+#include "obc_scheduler_config.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Entry point of the simulation. On the satellite, the ground station's passes drive the comms manager; here, they're
+   started by typing into the console:
+
+     uplink     - Begin an uplink pass (the ground station sends commands)
+     downlink   - Begin a downlink pass (the OBC sends telemetry)
+     emergency  - Enter emergency comms mode
+     quit       - Stop the simulation
+
+   The ground station talks to the OBC through the pseudo-terminal printed on startup. */
+
+#define SIM_DEFAULT_SD_IMAGE "obc-sim-sd.img"
+
+#define SIM_CONSOLE_TASK_NAME "sim_console"
+#define SIM_CONSOLE_TASK_STACK_SIZE 1024U
+#define SIM_CONSOLE_TASK_PRIORITY 1U
+
+// stdin is non-blocking, so the console sleeps between polls to let the OBC's tasks run
+#define SIM_CONSOLE_POLL_PERIOD pdMS_TO_TICKS(50)
+
+#define SIM_CONSOLE_MAX_LINE_LEN 64U
+
+typedef struct {
+  const char *name;
+  comms_event_id_t eventID;
+} sim_console_cmd_t;
+
+static const sim_console_cmd_t consoleCmds[] = {
+    {"uplink", COMMS_EVENT_BEGIN_UPLINK},
+    {"downlink", COMMS_EVENT_BEGIN_DOWNLINK},
+    {"emergency", COMMS_EVENT_ENTER_EMERG},
+};
+
+static StackType_t consoleTaskStack[SIM_CONSOLE_TASK_STACK_SIZE];
+static StaticTask_t consoleTaskBuffer;
+
+/**
+ * @brief Runs a line typed into the console
+ */
+static void runConsoleLine(const char *line) {
+  obc_error_code_t errCode;
+
+  if (line[0] == '\0') return;
+
+  if (strcmp(line, "quit") == 0) {
+    exit(EXIT_SUCCESS);
+  }
+
+  for (size_t i = 0; i < sizeof(consoleCmds) / sizeof(consoleCmds[0]); i++) {
+    if (strcmp(line, consoleCmds[i].name) == 0) {
+      comms_event_t event = {.eventID = consoleCmds[i].eventID};
+      LOG_IF_ERROR_CODE(sendToCommsManagerQueue(&event));
+      return;
+    }
+  }
+
+  fprintf(stderr, "Unknown command: %s\n", line);
+}
+
+/**
+ * @brief Brings up the parts of the OBC that the firmware doesn't yet, starts the state manager like main does on the
+ * board, then reads pass commands from stdin
+ */
+static void simConsoleTask(void *pvParameters) {
+  obc_error_code_t errCode;
+  (void)pvParameters;
+
+  // The state manager doesn't mount the file system yet, but telemetry and logging to file need it
+  LOG_IF_ERROR_CODE(setupFileSystem());
+
+  obcSchedulerInitTask(OBC_SCHEDULER_CONFIG_ID_STATE_MGR);
+  obcSchedulerCreateTask(OBC_SCHEDULER_CONFIG_ID_STATE_MGR);
+
+  char line[SIM_CONSOLE_MAX_LINE_LEN];
+  size_t lineLen = 0;
+
+  while (1) {
+    char c;
+    ssize_t numRead = read(STDIN_FILENO, &c, 1);
+
+    if (numRead == 0) {
+      // stdin was closed, so keep running without a console
+      vTaskSuspend(NULL);
+    }
+
+    if (numRead < 0) {
+      if (errno != EAGAIN && errno != EINTR) {
+        vTaskSuspend(NULL);
+      }
+      vTaskDelay(SIM_CONSOLE_POLL_PERIOD);
+      continue;
+    }
+
+    if (c == '\n') {
+      line[lineLen] = '\0';
+      runConsoleLine(line);
+      lineLen = 0;
+    } else if (lineLen < SIM_CONSOLE_MAX_LINE_LEN - 1) {
+      line[lineLen++] = c;
+    }
+  }
+}
+
+static void printUsage(const char *progName) {
+  fprintf(stderr, "Usage: %s [-f fram_image] [-s sd_image]\n", progName);
+  fprintf(stderr, "  -f  File to keep the FRAM's contents in (default: FRAM is not kept between runs)\n");
+  fprintf(stderr, "  -s  Disk image to use as the microSD card (default: %s)\n", SIM_DEFAULT_SD_IMAGE);
+}
+
+int main(int argc, char *argv[]) {
+  const char *framImagePath = NULL;
+  const char *sdImagePath = SIM_DEFAULT_SD_IMAGE;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "f:s:h")) != -1) {
+    switch (opt) {
+      case 'f':
+        framImagePath = optarg;
+        break;
+      case 's':
+        sdImagePath = optarg;
+        break;
+      default:
+        printUsage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+
+  if (simRadioInit() != OBC_ERR_CODE_SUCCESS) {
+    fprintf(stderr, "Failed to open the radio link: %s\n", strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  if (framImagePath != NULL && simFramInit(framImagePath) != OBC_ERR_CODE_SUCCESS) {
+    fprintf(stderr, "Failed to open FRAM image %s: %s\n", framImagePath, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  if (simSdcInit(sdImagePath) != OBC_ERR_CODE_SUCCESS) {
+    fprintf(stderr, "Failed to open SD card image %s: %s\n", sdImagePath, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+
+  fprintf(stderr, "Radio link: %s\n", simRadioPortName());
+
+  initSciMutex();
+
+  xTaskCreateStatic(simConsoleTask, SIM_CONSOLE_TASK_NAME, SIM_CONSOLE_TASK_STACK_SIZE, NULL,
+                    SIM_CONSOLE_TASK_PRIORITY, consoleTaskStack, &consoleTaskBuffer);
+
+  vTaskStartScheduler();
+
+  return EXIT_FAILURE;
+}
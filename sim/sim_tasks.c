@@ -0,0 +1,34 @@
+#include "digital_watchdog_mgr.h"
+#include "obc_scheduler_config.h"
+
+#include <FreeRTOS.h>
+#include <os_task.h>
+
+/* Tasks that can't run in the simulation. The GNC manager is built from the attitude models and talks to the VN100
+   and magnetorquers, none of which exist on the host, so it is replaced by a task that only keeps the digital
+   watchdog manager from flagging it. */
+
+// Within the GNC manager's watchdog timeout
+#define GNC_MGR_CHECK_IN_PERIOD pdMS_TO_TICKS(50)
+
+void obcTaskInitGncMgr(void) {}
+
+void obcTaskFunctionGncMgr(void *pvParameters) {
+  (void)pvParameters;
+
+  while (1) {
+    digitalWatchdogTaskCheckIn(OBC_SCHEDULER_CONFIG_ID_GNC_MGR);
+    vTaskDelay(GNC_MGR_CHECK_IN_PERIOD);
+  }
+}
+
+/* The SPI engine runs transactions on the RM46 SPI buses. The simulated devices aren't reached over SPI, so nothing
+   queues transactions to it and it isn't started. */
+
+void obcTaskInitSpiEngine(void) {}
+
+void obcTaskFunctionSpiEngine(void *pvParameters) {
+  (void)pvParameters;
+
+  vTaskDelete(NULL);
+}
@@ -6,7 +6,7 @@
 #include <stdint.h>
 #include <string.h>
 
-#define MOCK_FRAM_MAX_SIZE 1000  // Change as needed
+#define MOCK_FRAM_MAX_SIZE 2000  // Change as needed
 static uint8_t memory[MOCK_FRAM_MAX_SIZE] = {0};
 
 STATIC_ASSERT(MOCK_FRAM_MAX_SIZE <= FRAM_MAX_ADDRESS, "Mock FRAM exceeds available FRAM space");
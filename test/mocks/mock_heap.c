@@ -1,6 +1,12 @@
 #include <correct.h>
 #include <stdlib.h>
 
-void *sysMalloc(size_t size) { return malloc(size); }
+// Number of sysMalloc calls so far, for tests that check a path doesn't touch the heap
+size_t mockHeapAllocations = 0;
+
+void *sysMalloc(size_t size) {
+  ++mockHeapAllocations;
+  return malloc(size);
+}
 
 void sysFreeMem(void *ptr) { free(ptr); }
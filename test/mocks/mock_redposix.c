@@ -0,0 +1,196 @@
+#include <redposix.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* In-memory stand-in for the parts of Reliance Edge's POSIX-like API used by obc_reliance_fs.c. Directories aren't
+ * tracked; a file's path is just its name. */
+
+#define MOCK_REDPOSIX_MAX_FILES 4        // Change as needed
+#define MOCK_REDPOSIX_MAX_FILE_SIZE 65536  // Change as needed
+#define MOCK_REDPOSIX_MAX_PATH_LENGTH 64
+#define MOCK_REDPOSIX_MAX_OPEN_FILES 4
+
+typedef struct {
+  bool exists;
+  char path[MOCK_REDPOSIX_MAX_PATH_LENGTH];
+  uint8_t data[MOCK_REDPOSIX_MAX_FILE_SIZE];
+  uint32_t size;
+} mock_file_t;
+
+typedef struct {
+  bool isOpen;
+  mock_file_t *file;
+  uint32_t openMode;
+  uint32_t position;
+} mock_fildes_t;
+
+static mock_file_t files[MOCK_REDPOSIX_MAX_FILES];
+static mock_fildes_t fildes[MOCK_REDPOSIX_MAX_OPEN_FILES];
+static REDSTATUS mockErrno = 0;
+
+static int32_t fail(REDSTATUS err) {
+  mockErrno = err;
+  return -1;
+}
+
+static mock_file_t *findFile(const char *pszPath) {
+  for (uint32_t i = 0; i < MOCK_REDPOSIX_MAX_FILES; i++) {
+    if (files[i].exists && strcmp(files[i].path, pszPath) == 0) {
+      return &files[i];
+    }
+  }
+  return NULL;
+}
+
+static mock_fildes_t *getFildes(int32_t iFildes) {
+  if (iFildes < 0 || iFildes >= MOCK_REDPOSIX_MAX_OPEN_FILES || !fildes[iFildes].isOpen) {
+    return NULL;
+  }
+  return &fildes[iFildes];
+}
+
+REDSTATUS *red_errnoptr(void) { return &mockErrno; }
+
+int32_t red_init(void) { return 0; }
+
+int32_t red_format(const char *pszVolume) {
+  (void)pszVolume;
+  memset(files, 0, sizeof(files));
+  memset(fildes, 0, sizeof(fildes));
+  return 0;
+}
+
+int32_t red_mount(const char *pszVolume) {
+  (void)pszVolume;
+  return 0;
+}
+
+int32_t red_mkdir(const char *pszPath) {
+  (void)pszPath;
+  return 0;
+}
+
+int32_t red_open(const char *pszPath, uint32_t ulOpenMode) {
+  if (pszPath == NULL || strlen(pszPath) >= MOCK_REDPOSIX_MAX_PATH_LENGTH) {
+    return fail(RED_EINVAL);
+  }
+
+  mock_file_t *file = findFile(pszPath);
+  if (file == NULL) {
+    if ((ulOpenMode & RED_O_CREAT) == 0) {
+      return fail(RED_ENOENT);
+    }
+
+    for (uint32_t i = 0; i < MOCK_REDPOSIX_MAX_FILES && file == NULL; i++) {
+      if (!files[i].exists) {
+        file = &files[i];
+      }
+    }
+    if (file == NULL) {
+      return fail(RED_ENOSPC);
+    }
+
+    file->exists = true;
+    strcpy(file->path, pszPath);
+    file->size = 0;
+  } else if ((ulOpenMode & RED_O_TRUNC) != 0) {
+    file->size = 0;
+  }
+
+  for (int32_t i = 0; i < MOCK_REDPOSIX_MAX_OPEN_FILES; i++) {
+    if (!fildes[i].isOpen) {
+      fildes[i].isOpen = true;
+      fildes[i].file = file;
+      fildes[i].openMode = ulOpenMode;
+      fildes[i].position = 0;
+      return i;
+    }
+  }
+
+  return fail(RED_EMFILE);
+}
+
+int32_t red_close(int32_t iFildes) {
+  mock_fildes_t *fd = getFildes(iFildes);
+  if (fd == NULL) {
+    return fail(RED_EBADF);
+  }
+
+  fd->isOpen = false;
+  return 0;
+}
+
+int32_t red_unlink(const char *pszPath) {
+  mock_file_t *file = findFile(pszPath);
+  if (file == NULL) {
+    return fail(RED_ENOENT);
+  }
+
+  file->exists = false;
+  return 0;
+}
+
+int32_t red_read(int32_t iFildes, void *pBuffer, uint32_t ulLength) {
+  mock_fildes_t *fd = getFildes(iFildes);
+  if (fd == NULL || (fd->openMode & RED_O_WRONLY) != 0) {
+    return fail(RED_EBADF);
+  }
+
+  uint32_t len = ulLength;
+  if (fd->position >= fd->file->size) {
+    len = 0;
+  } else if (len > fd->file->size - fd->position) {
+    len = fd->file->size - fd->position;
+  }
+
+  memcpy(pBuffer, &fd->file->data[fd->position], len);
+  fd->position += len;
+  return (int32_t)len;
+}
+
+int32_t red_write(int32_t iFildes, const void *pBuffer, uint32_t ulLength) {
+  mock_fildes_t *fd = getFildes(iFildes);
+  if (fd == NULL || (fd->openMode & RED_O_RDONLY) != 0) {
+    return fail(RED_EBADF);
+  }
+
+  if ((fd->openMode & RED_O_APPEND) != 0) {
+    fd->position = fd->file->size;
+  }
+
+  if (fd->position + ulLength > MOCK_REDPOSIX_MAX_FILE_SIZE) {
+    return fail(RED_EFBIG);
+  }
+
+  memcpy(&fd->file->data[fd->position], pBuffer, ulLength);
+  fd->position += ulLength;
+  if (fd->position > fd->file->size) {
+    fd->file->size = fd->position;
+  }
+  return (int32_t)ulLength;
+}
+
+int32_t red_fsync(int32_t iFildes) { return getFildes(iFildes) != NULL ? 0 : fail(RED_EBADF); }
+
+int64_t red_lseek(int32_t iFildes, int64_t llOffset, REDWHENCE whence) {
+  mock_fildes_t *fd = getFildes(iFildes);
+  if (fd == NULL) {
+    return fail(RED_EBADF);
+  }
+
+  int64_t position = llOffset;
+  if (whence == RED_SEEK_CUR) {
+    position += fd->position;
+  } else if (whence == RED_SEEK_END) {
+    position += fd->file->size;
+  }
+
+  if (position < 0 || position > MOCK_REDPOSIX_MAX_FILE_SIZE) {
+    return fail(RED_EINVAL);
+  }
+
+  fd->position = (uint32_t)position;
+  return position;
+}
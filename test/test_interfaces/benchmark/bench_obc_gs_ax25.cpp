@@ -0,0 +1,169 @@
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+#include "ax25_bitwise_reference.h"
+
+#include <string.h>
+
+#include <benchmark/benchmark.h>
+
+/**
+ * @brief fills a full-sized unstuffed I frame with pseudorandom data between the flags
+ *
+ * @param frame buffer of AX25_MINIMUM_I_FRAME_LEN bytes
+ * @param onesDensity 0 for uniformly random bytes, 1 to bias towards 1s (more stuffing)
+ */
+static void fillFrame(uint8_t *frame, int onesDensity) {
+  uint32_t seed = 0x1D2F47;  // random number
+  for (uint16_t i = 0; i < AX25_MINIMUM_I_FRAME_LEN; ++i) {
+    seed = (seed * 1103515245 + 12345) % (1U << 31);
+    frame[i] = (uint8_t)(seed >> 16);
+    if (onesDensity) {
+      seed = (seed * 1103515245 + 12345) % (1U << 31);
+      frame[i] |= (uint8_t)(seed >> 16);
+    }
+  }
+  frame[0] = AX25_FLAG;
+  frame[AX25_MINIMUM_I_FRAME_LEN - 1] = AX25_FLAG;
+}
+
+static void setFrameCounters(benchmark::State &state) {
+  state.SetBytesProcessed(state.iterations() * AX25_MINIMUM_I_FRAME_LEN);
+  state.counters["frames"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void BM_Ax25StuffBitwise(benchmark::State &state) {
+  uint8_t frame[AX25_MINIMUM_I_FRAME_LEN];
+  fillFrame(frame, state.range(0));
+  uint8_t stuffed[AX25_MAXIMUM_PKT_LEN];
+  uint16_t stuffedLen;
+
+  for (auto _ : state) {
+    memset(stuffed, 0, sizeof(stuffed));
+    ax25StuffBitwise(frame, AX25_MINIMUM_I_FRAME_LEN, stuffed, &stuffedLen);
+    benchmark::DoNotOptimize(stuffed);
+  }
+  setFrameCounters(state);
+}
+BENCHMARK(BM_Ax25StuffBitwise)->Arg(0)->Arg(1);
+
+static void BM_Ax25Stuff(benchmark::State &state) {
+  uint8_t frame[AX25_MINIMUM_I_FRAME_LEN];
+  fillFrame(frame, state.range(0));
+  uint8_t stuffed[AX25_MAXIMUM_PKT_LEN];
+  uint16_t stuffedLen;
+
+  for (auto _ : state) {
+    memset(stuffed, 0, sizeof(stuffed));
+    ax25Stuff(frame, AX25_MINIMUM_I_FRAME_LEN, stuffed, &stuffedLen);
+    benchmark::DoNotOptimize(stuffed);
+  }
+  setFrameCounters(state);
+}
+BENCHMARK(BM_Ax25Stuff)->Arg(0)->Arg(1);
+
+static void BM_Ax25UnstuffBitwise(benchmark::State &state) {
+  uint8_t frame[AX25_MINIMUM_I_FRAME_LEN];
+  fillFrame(frame, state.range(0));
+  uint8_t stuffed[AX25_MAXIMUM_PKT_LEN] = {0};
+  uint16_t stuffedLen;
+  ax25Stuff(frame, AX25_MINIMUM_I_FRAME_LEN, stuffed, &stuffedLen);
+  stuffed[0] = AX25_FLAG;
+  stuffed[stuffedLen - 1] = AX25_FLAG;
+
+  unstuffed_ax25_i_frame_t unstuffed;
+  for (auto _ : state) {
+    memset(&unstuffed, 0, sizeof(unstuffed));
+    ax25UnstuffBitwise(stuffed, stuffedLen, unstuffed.data, &unstuffed.length);
+    benchmark::DoNotOptimize(unstuffed);
+  }
+  setFrameCounters(state);
+}
+BENCHMARK(BM_Ax25UnstuffBitwise)->Arg(0)->Arg(1);
+
+static void BM_Ax25Unstuff(benchmark::State &state) {
+  uint8_t frame[AX25_MINIMUM_I_FRAME_LEN];
+  fillFrame(frame, state.range(0));
+  uint8_t stuffed[AX25_MAXIMUM_PKT_LEN] = {0};
+  uint16_t stuffedLen;
+  ax25Stuff(frame, AX25_MINIMUM_I_FRAME_LEN, stuffed, &stuffedLen);
+  stuffed[0] = AX25_FLAG;
+  stuffed[stuffedLen - 1] = AX25_FLAG;
+
+  unstuffed_ax25_i_frame_t unstuffed;
+  for (auto _ : state) {
+    memset(&unstuffed, 0, sizeof(unstuffed));
+    ax25Unstuff(stuffed, stuffedLen, unstuffed.data, &unstuffed.length);
+    benchmark::DoNotOptimize(unstuffed);
+  }
+  setFrameCounters(state);
+}
+BENCHMARK(BM_Ax25Unstuff)->Arg(0)->Arg(1);
+
+#define DEFRAME_STREAM_FRAMES 16U
+
+/**
+ * @brief builds a received stream of stuffed full-sized I frames that share flags with each other
+ *
+ * @param stream buffer of DEFRAME_STREAM_FRAMES * AX25_MAXIMUM_PKT_LEN bytes
+ * @return size_t number of bytes in stream
+ */
+static size_t fillDeframeStream(uint8_t *stream) {
+  uint8_t frame[AX25_MINIMUM_I_FRAME_LEN];
+  fillFrame(frame, 0);
+
+  size_t streamLen = 0;
+  for (uint8_t i = 0; i < DEFRAME_STREAM_FRAMES; ++i) {
+    uint16_t stuffedLen;
+    ax25Stuff(frame, AX25_MINIMUM_I_FRAME_LEN, stream + streamLen, &stuffedLen);
+    stream[streamLen] = AX25_FLAG;
+    stream[streamLen + stuffedLen - 1] = AX25_FLAG;
+    streamLen += stuffedLen - AX25_SHARE_FLAG_BYTES;
+  }
+  return streamLen + AX25_SHARE_FLAG_BYTES;
+}
+
+static void countFrame(const uint8_t *frame, uint16_t frameLen, void *userData) {
+  benchmark::DoNotOptimize(frame);
+  ++*static_cast<size_t *>(userData);
+}
+
+static void setDeframeCounters(benchmark::State &state, size_t streamLen, size_t framesFound) {
+  state.SetBytesProcessed(state.iterations() * streamLen);
+  state.counters["frames"] = benchmark::Counter(framesFound, benchmark::Counter::kIsRate);
+}
+
+// Arg is the number of bytes handed over per call, e.g. 100 for one CC1120 RX FIFO read
+static void BM_Ax25DeframeBytewise(benchmark::State &state) {
+  static uint8_t stream[DEFRAME_STREAM_FRAMES * AX25_MAXIMUM_PKT_LEN];
+  size_t streamLen = fillDeframeStream(stream);
+  size_t spanLen = state.range(0);
+  size_t framesFound = 0;
+
+  ax25_bytewise_deframer_t deframer = {};
+  for (auto _ : state) {
+    for (size_t pos = 0; pos < streamLen; pos += spanLen) {
+      size_t len = (streamLen - pos < spanLen) ? streamLen - pos : spanLen;
+      ax25DeframeBytewise(&deframer, stream + pos, len, countFrame, &framesFound);
+    }
+  }
+  setDeframeCounters(state, streamLen, framesFound);
+}
+BENCHMARK(BM_Ax25DeframeBytewise)->Arg(100)->Arg(4096);
+
+static void BM_Ax25DeframerPush(benchmark::State &state) {
+  static uint8_t stream[DEFRAME_STREAM_FRAMES * AX25_MAXIMUM_PKT_LEN];
+  size_t streamLen = fillDeframeStream(stream);
+  size_t spanLen = state.range(0);
+  size_t framesFound = 0;
+
+  ax25_deframer_t deframer;
+  ax25DeframerInit(&deframer, countFrame, &framesFound);
+  for (auto _ : state) {
+    for (size_t pos = 0; pos < streamLen; pos += spanLen) {
+      size_t len = (streamLen - pos < spanLen) ? streamLen - pos : spanLen;
+      ax25DeframerPush(&deframer, stream + pos, len);
+    }
+  }
+  setDeframeCounters(state, streamLen, framesFound);
+}
+BENCHMARK(BM_Ax25DeframerPush)->Arg(100)->Arg(4096);
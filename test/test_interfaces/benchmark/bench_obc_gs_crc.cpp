@@ -0,0 +1,38 @@
+#include "obc_gs_crc.h"
+#include "obc_gs_ax25.h"
+#include "crc_bitwise_reference.h"
+
+#include <benchmark/benchmark.h>
+
+// Arg is the number of bytes checksummed, e.g. the FCS covered part of a full I frame
+static void fillCrcData(uint8_t *data, size_t dataLen) {
+  uint32_t seed = 0xC4C;  // random number
+  for (size_t i = 0; i < dataLen; ++i) {
+    seed = (seed * 1103515245 + 12345) % (1U << 31);
+    data[i] = (uint8_t)(seed >> 16);
+  }
+}
+
+static void BM_Crc16CcittBitwise(benchmark::State &state) {
+  uint8_t data[1024];
+  uint16_t dataLen = state.range(0);
+  fillCrcData(data, dataLen);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(calculateCrc16CcittBitwise(data, dataLen));
+  }
+  state.SetBytesProcessed(state.iterations() * dataLen);
+}
+BENCHMARK(BM_Crc16CcittBitwise)->Arg(AX25_MINIMUM_I_FRAME_LEN - AX25_FCS_BYTES - AX25_TOTAL_FLAG_BYTES)->Arg(1024);
+
+static void BM_Crc16Ccitt(benchmark::State &state) {
+  uint8_t data[1024];
+  uint16_t dataLen = state.range(0);
+  fillCrcData(data, dataLen);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(calculateCrc16Ccitt(data, dataLen));
+  }
+  state.SetBytesProcessed(state.iterations() * dataLen);
+}
+BENCHMARK(BM_Crc16Ccitt)->Arg(AX25_MINIMUM_I_FRAME_LEN - AX25_FCS_BYTES - AX25_TOTAL_FLAG_BYTES)->Arg(1024);
@@ -0,0 +1,150 @@
+#include "obc_gs_fec.h"
+#include "obc_gs_errors.h"
+
+#include <correct.h>
+
+#include <string.h>
+
+#include <benchmark/benchmark.h>
+
+static void fillMessage(uint8_t *data) {
+  uint32_t seed = 0x6E0F13;  // random number
+  for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+    seed = (seed * 1103515245 + 12345) % (1U << 31);
+    data[i] = (uint8_t)(seed >> 16);
+  }
+}
+
+static void setBlockCounters(benchmark::State &state) {
+  state.SetBytesProcessed(state.iterations() * RS_DECODED_SIZE);
+  state.counters["blocks"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void BM_RsEncodeGeneric(benchmark::State &state) {
+  correct_reed_solomon *rs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  uint8_t data[RS_DECODED_SIZE];
+  fillMessage(data);
+  packed_rs_packet_t encoded;
+
+  for (auto _ : state) {
+    correct_reed_solomon_encode(rs, data, RS_DECODED_SIZE, encoded.data);
+    benchmark::DoNotOptimize(encoded);
+  }
+  setBlockCounters(state);
+  correct_reed_solomon_destroy(rs);
+}
+BENCHMARK(BM_RsEncodeGeneric);
+
+static void BM_RsEncode(benchmark::State &state) {
+  uint8_t data[RS_DECODED_SIZE];
+  fillMessage(data);
+  packed_rs_packet_t encoded;
+
+  for (auto _ : state) {
+    rsEncode(data, &encoded);
+    benchmark::DoNotOptimize(encoded);
+  }
+  setBlockCounters(state);
+}
+BENCHMARK(BM_RsEncode);
+
+// Encodes a block and corrupts numErrors distinct bytes of it
+static void makeReceivedBlock(packed_rs_packet_t *encoded, int64_t numErrors) {
+  uint8_t data[RS_DECODED_SIZE];
+  fillMessage(data);
+  correct_reed_solomon_encode_ccsds(data, RS_DECODED_SIZE, encoded->data);
+  for (int64_t i = 0; i < numErrors; ++i) {
+    encoded->data[(i * 37) % RS_ENCODED_SIZE] ^= 0x5A;
+  }
+}
+
+// Arg: number of corrupted bytes
+static void BM_RsDecodeGeneric(benchmark::State &state) {
+  correct_reed_solomon *rs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  packed_rs_packet_t encoded;
+  makeReceivedBlock(&encoded, state.range(0));
+  uint8_t decoded[RS_DECODED_SIZE];
+
+  for (auto _ : state) {
+    correct_reed_solomon_decode(rs, encoded.data, RS_ENCODED_SIZE, decoded);
+    benchmark::DoNotOptimize(decoded);
+  }
+  setBlockCounters(state);
+  correct_reed_solomon_destroy(rs);
+}
+BENCHMARK(BM_RsDecodeGeneric)->Arg(0)->Arg(8)->Arg(16);
+
+// Args: syndrome kernel, number of corrupted bytes
+static void BM_RsDecodeCcsds(benchmark::State &state) {
+  if (!correct_reed_solomon_ccsds_set_syndrome_kernel((correct_rs_syndrome_kernel)state.range(0))) {
+    state.SkipWithError("syndrome kernel not supported on this cpu");
+    return;
+  }
+  correct_reed_solomon *rs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  packed_rs_packet_t encoded;
+  makeReceivedBlock(&encoded, state.range(1));
+  uint8_t decoded[RS_DECODED_SIZE];
+
+  for (auto _ : state) {
+    correct_reed_solomon_decode_ccsds(rs, encoded.data, RS_ENCODED_SIZE, decoded);
+    benchmark::DoNotOptimize(decoded);
+  }
+  setBlockCounters(state);
+  correct_reed_solomon_destroy(rs);
+  correct_reed_solomon_ccsds_set_syndrome_kernel(CORRECT_RS_SYNDROME_KERNEL_AUTO);
+}
+BENCHMARK(BM_RsDecodeCcsds)
+    ->ArgsProduct({{CORRECT_RS_SYNDROME_KERNEL_SCALAR, CORRECT_RS_SYNDROME_KERNEL_SSSE3, CORRECT_RS_SYNDROME_KERNEL_AVX2},
+                   {0, 8, 16}});
+
+static void BM_RsDecode(benchmark::State &state) {
+  initRs();
+  packed_rs_packet_t encoded;
+  makeReceivedBlock(&encoded, 0);
+  uint8_t decoded[RS_DECODED_SIZE];
+
+  for (auto _ : state) {
+    rsDecode(&encoded, decoded, RS_DECODED_SIZE);
+    benchmark::DoNotOptimize(decoded);
+  }
+  setBlockCounters(state);
+}
+BENCHMARK(BM_RsDecode);
+
+// Args: number of batch workers (0 runs on the calling thread only), number of corrupted bytes per block
+static void BM_RsDecodeBatch(benchmark::State &state) {
+  // About 1 MB of received blocks, roughly a short pass capture
+  const size_t numBlocks = 4096;
+  static packed_rs_packet_t encoded[numBlocks];
+  static packed_telem_packet_t decoded[numBlocks];
+  static obc_gs_error_code_t status[numBlocks];
+  for (size_t i = 0; i < numBlocks; ++i) {
+    makeReceivedBlock(&encoded[i], state.range(1));
+  }
+
+  initRs();
+#ifdef OBC_GS_FEC_THREAD_POOL
+  if (state.range(0) != 0) {
+    rsBatchStartWorkers((uint8_t)state.range(0));
+  }
+#else
+  if (state.range(0) != 0) {
+    state.SkipWithError("built without OBC_GS_FEC_THREAD_POOL");
+    return;
+  }
+#endif
+
+  for (auto _ : state) {
+    rsDecodeBatch(encoded, decoded, numBlocks, status);
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetBytesProcessed(state.iterations() * numBlocks * RS_DECODED_SIZE);
+  state.counters["blocks"] = benchmark::Counter(state.iterations() * numBlocks, benchmark::Counter::kIsRate);
+
+#ifdef OBC_GS_FEC_THREAD_POOL
+  if (state.range(0) != 0) {
+    rsBatchStopWorkers();
+  }
+#endif
+}
+BENCHMARK(BM_RsDecodeBatch)->ArgsProduct({{0, 1, 3, 7}, {0, 8}})->UseRealTime();
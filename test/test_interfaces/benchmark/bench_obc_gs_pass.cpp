@@ -0,0 +1,276 @@
+#include "obc_gs_aes128.h"
+#include "obc_gs_ax25.h"
+#include "obc_gs_command_id.h"
+#include "obc_gs_command_pack.h"
+#include "obc_gs_command_unpack.h"
+#include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
+#include "obc_gs_telemetry_pack.h"
+
+#include <string.h>
+
+#include <chrono>
+
+#include <benchmark/benchmark.h>
+
+/* Whole frames through the same chain of interface calls the OBC makes for each frame of a pass, so that changes to
+   any stage show up in what a pass can actually move. Byte counts are of the stuffed frames that go over the air. */
+
+// Frames in the uplink capture that's decoded round robin; enough for the error patterns to average out
+#define UPLINK_CAPTURE_FRAMES 64U
+
+static const uint8_t benchAesKey[AES_KEY_SIZE] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                                  0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+
+static uint32_t nextRandom(uint32_t *seed) {
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 8;
+}
+
+/**
+ * @brief Reports frames per second and ns per stuffed byte
+ *
+ * @param state benchmark state after the timed loop
+ * @param numFrames number of frames processed
+ * @param numBytes number of stuffed frame bytes processed
+ * @param loopStart when the timed loop started
+ */
+static void setPassCounters(benchmark::State &state, int64_t numFrames, int64_t numBytes,
+                            std::chrono::steady_clock::time_point loopStart) {
+  state.SetBytesProcessed(numBytes);
+  state.counters["frames"] = benchmark::Counter(numFrames, benchmark::Counter::kIsRate);
+
+  // A plain ratio; rate counters would be printed per second
+  std::chrono::duration<double, std::nano> loopTime = std::chrono::steady_clock::now() - loopStart;
+  state.counters["ns_per_byte"] = numBytes > 0 ? loopTime.count() / numBytes : 0.0;
+}
+
+/**
+ * @brief Packs telemetry into a packet the way the downlink encoder does, until the next point wouldn't fit
+ *
+ * @param telemPacket packet to fill, cleared first
+ * @param seed PRNG state, so that consecutive packets carry different values
+ */
+static void packTelemetryPacket(uint8_t *telemPacket, uint32_t *seed) {
+  telemetry_packet_builder_t builder;
+  if (initTelemetryPacket(&builder, telemPacket, PACKED_TELEM_PACKET_SIZE) != OBC_GS_ERR_CODE_SUCCESS) {
+    return;
+  }
+
+  uint32_t timestamp = 1700000000U + nextRandom(seed) % 86400U;
+  while (true) {
+    // Mix of the float and state telemetry the OBC collects
+    telemetry_data_t telem = {0};
+    if (nextRandom(seed) % 4 == 0) {
+      telem.id = TELEM_OBC_STATE;
+      telem.obcState = (uint8_t)(nextRandom(seed) % 8);
+    } else {
+      telem.id = TELEM_OBC_TEMP;
+      telem.obcTemp = (float)(nextRandom(seed) % 1000) / 10.0f;
+    }
+    timestamp += nextRandom(seed) % 60U;
+    telem.timestamp = timestamp;
+
+    if (addTelemetryToPacket(&builder, &telem) != OBC_GS_ERR_CODE_SUCCESS) {
+      return;
+    }
+  }
+}
+
+static void BM_PassDownlink(benchmark::State &state) {
+  setCurrentLinkDestAddress(&groundStationCallsign);
+  uint32_t seed = 0x2C41B7;  // random number
+
+  unstuffed_ax25_i_frame_t downlinkFrame;
+  packed_ax25_i_frame_t txFrame;
+  int64_t numBytes = 0;
+
+  std::chrono::steady_clock::time_point loopStart = std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    // As in the downlink encoder, the telemetry is packed straight into the info field and encoded in place
+    uint8_t *infoField = downlinkFrame.data + AX25_INFO_FIELD_POSITION;
+    packTelemetryPacket(infoField, &seed);
+
+    ax25SendIFrame(infoField, RS_DECODED_SIZE, &downlinkFrame);
+
+    packed_rs_packet_t *fecPkt = (packed_rs_packet_t *)infoField;
+    rsEncode(fecPkt->data, fecPkt);
+
+    ax25Stuff(downlinkFrame.data, downlinkFrame.length, txFrame.data, &txFrame.length);
+    txFrame.data[0] = AX25_FLAG;
+    txFrame.data[txFrame.length - 1] = AX25_FLAG;
+
+    benchmark::DoNotOptimize(txFrame);
+    numBytes += txFrame.length;
+  }
+
+  setPassCounters(state, state.iterations(), numBytes, loopStart);
+}
+// The channel only affects the receiver, so the downlink's cost doesn't depend on the bit error rate
+BENCHMARK(BM_PassDownlink);
+
+/**
+ * @brief Builds an uplink frame the way the ground station does: packed commands, encrypted, framed, FEC encoded and
+ * stuffed
+ */
+static void makeUplinkFrame(packed_ax25_i_frame_t *frame, uint32_t *seed) {
+  uint8_t encryptedCmd[RS_DECODED_SIZE] = {0};
+  uint8_t *packedCmds = encryptedCmd + AES_IV_SIZE;
+
+  // Mix of commands with and without arguments, filling the frame
+  uint32_t offset = 0;
+  while (true) {
+    cmd_msg_t cmd = {0};
+    switch (nextRandom(seed) % 3) {
+      case 0:
+        cmd.id = CMD_PING;
+        break;
+      case 1:
+        cmd.id = CMD_RTC_SYNC;
+        cmd.rtcSync.unixTime = 1700000000U + nextRandom(seed) % 86400U;
+        break;
+      default:
+        cmd.id = CMD_DOWNLINK_LOGS_NEXT_PASS;
+        cmd.downlinkLogsNextPass.logLevel = (uint8_t)(nextRandom(seed) % 6);
+        break;
+    }
+
+    uint8_t packedCmd[MAX_CMD_MSG_SIZE];
+    uint32_t packedCmdOffset = 0;
+    uint8_t packedCmdSize = 0;
+    packCmdMsg(packedCmd, &packedCmdOffset, &cmd, &packedCmdSize);
+
+    // Leave room for the end of frame marker
+    if (offset + packedCmdSize >= AES_DECRYPTED_SIZE) {
+      break;
+    }
+
+    memcpy(packedCmds + offset, packedCmd, packedCmdSize);
+    offset += packedCmdSize;
+  }
+  packedCmds[offset] = CMD_END_OF_FRAME;
+
+  for (uint8_t i = 0; i < AES_IV_SIZE; ++i) {
+    encryptedCmd[i] = (uint8_t)nextRandom(seed);
+  }
+
+  // CTR mode is its own inverse, so decrypting the plaintext encrypts it
+  uint8_t plaintext[AES_DECRYPTED_SIZE];
+  memcpy(plaintext, packedCmds, AES_DECRYPTED_SIZE);
+  aes_data_t aesData;
+  memcpy(aesData.iv, encryptedCmd, AES_IV_SIZE);
+  aesData.ciphertext = plaintext;
+  aesData.ciphertextLen = AES_DECRYPTED_SIZE;
+  aes128Decrypt(&aesData, packedCmds, AES_DECRYPTED_SIZE);
+
+  unstuffed_ax25_i_frame_t unstuffedFrame;
+  ax25SendIFrame(encryptedCmd, RS_DECODED_SIZE, &unstuffedFrame);
+
+  packed_rs_packet_t *fecPkt = (packed_rs_packet_t *)(unstuffedFrame.data + AX25_INFO_FIELD_POSITION);
+  rsEncode(fecPkt->data, fecPkt);
+
+  ax25Stuff(unstuffedFrame.data, unstuffedFrame.length, frame->data, &frame->length);
+  frame->data[0] = AX25_FLAG;
+  frame->data[frame->length - 1] = AX25_FLAG;
+}
+
+/**
+ * @brief Flips bits between the flags at the given rate. The flags are left alone, since a frame whose flags are
+ * corrupted never makes it out of the deframer to be decoded
+ */
+static void corruptFrame(packed_ax25_i_frame_t *frame, int64_t bitErrorsPerMillion, uint32_t *seed) {
+  for (uint32_t bit = 8; bit < (uint32_t)(frame->length - 1) * 8; ++bit) {
+    if ((int64_t)(nextRandom(seed) % 1000000U) < bitErrorsPerMillion) {
+      frame->data[bit / 8] ^= (uint8_t)(1U << (bit % 8));
+    }
+  }
+}
+
+/**
+ * @brief Decodes one received uplink frame through to its commands, as the uplink decoder does
+ *
+ * @return true if every command in the frame was recovered
+ */
+static bool decodeUplinkFrame(const packed_ax25_i_frame_t *frame) {
+  unstuffed_ax25_i_frame_t unstuffedFrame;
+  if (ax25Unstuff(frame->data, frame->length, unstuffedFrame.data, &unstuffedFrame.length) !=
+      OBC_GS_ERR_CODE_SUCCESS) {
+    return false;
+  }
+
+  // A corrupted stuffed frame can unstuff to the wrong length, which leaves no whole code word to decode
+  if (unstuffedFrame.length != AX25_MINIMUM_I_FRAME_LEN) {
+    return false;
+  }
+
+  uint8_t *infoField = unstuffedFrame.data + AX25_INFO_FIELD_POSITION;
+  packed_rs_packet_t rsData;
+  memcpy(rsData.data, infoField, RS_ENCODED_SIZE);
+  memset(infoField, 0, RS_ENCODED_SIZE);
+  if (rsDecode(&rsData, infoField, RS_DECODED_SIZE) != OBC_GS_ERR_CODE_SUCCESS) {
+    return false;
+  }
+
+  u_frame_cmd_t command;
+  if (ax25Recv(&unstuffedFrame, &command) != OBC_GS_ERR_CODE_SUCCESS) {
+    return false;
+  }
+
+  uint8_t ciphertext[AES_DECRYPTED_SIZE];
+  memcpy(ciphertext, infoField + AES_IV_SIZE, AES_DECRYPTED_SIZE);
+  aes_data_t aesData;
+  memcpy(aesData.iv, infoField, AES_IV_SIZE);
+  aesData.ciphertext = ciphertext;
+  aesData.ciphertextLen = AES_DECRYPTED_SIZE;
+
+  uint8_t cmdBytes[AES_DECRYPTED_SIZE];
+  if (aes128Decrypt(&aesData, cmdBytes, AES_DECRYPTED_SIZE) != OBC_GS_ERR_CODE_SUCCESS) {
+    return false;
+  }
+
+  uint32_t offset = 0;
+  while (offset < AES_DECRYPTED_SIZE && cmdBytes[offset] != CMD_END_OF_FRAME) {
+    cmd_msg_t cmd;
+    if (unpackCmdMsg(cmdBytes, &offset, &cmd) != OBC_GS_ERR_CODE_SUCCESS) {
+      return false;
+    }
+    benchmark::DoNotOptimize(cmd);
+  }
+
+  return true;
+}
+
+// Arg: bit errors per million bits on the link
+static void BM_PassUplink(benchmark::State &state) {
+  initRs();
+  initializeAesCtx(benchAesKey);
+  setCurrentLinkDestAddress(&cubesatCallsign);
+
+  static packed_ax25_i_frame_t capture[UPLINK_CAPTURE_FRAMES];
+  uint32_t seed = 0x5D03E9;  // random number
+  for (uint32_t i = 0; i < UPLINK_CAPTURE_FRAMES; ++i) {
+    makeUplinkFrame(&capture[i], &seed);
+    corruptFrame(&capture[i], state.range(0), &seed);
+  }
+
+  int64_t numBytes = 0;
+  int64_t numLost = 0;
+  uint32_t frameIndex = 0;
+
+  std::chrono::steady_clock::time_point loopStart = std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    const packed_ax25_i_frame_t *frame = &capture[frameIndex];
+    if (!decodeUplinkFrame(frame)) {
+      ++numLost;
+    }
+
+    numBytes += frame->length;
+    frameIndex = (frameIndex + 1) % UPLINK_CAPTURE_FRAMES;
+  }
+
+  setPassCounters(state, state.iterations(), numBytes, loopStart);
+  state.counters["frames_lost"] = benchmark::Counter(numLost, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_PassUplink)->Arg(0)->Arg(100)->Arg(1000)->Arg(5000);
@@ -0,0 +1,126 @@
+#include "ax25_bitwise_reference.h"
+#include "obc_gs_ax25.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+obc_gs_error_code_t ax25StuffBitwise(const uint8_t *rawData, uint16_t rawDataLen, uint8_t *stuffedData,
+                                     uint16_t *stuffedDataLen) {
+  if (rawData == NULL || stuffedData == NULL || stuffedDataLen == NULL) {
+    return OBC_GS_ERR_CODE_INVALID_ARG;
+  }
+
+  uint16_t rawOffset = 0, stuffedOffset = 8, oneCount = 0;
+  uint8_t currentBit;
+
+  // Cycle through raw data to find 1s
+  for (rawOffset = 8; rawOffset < (rawDataLen - 1) * 8; ++rawOffset) {
+    currentBit = (rawData[rawOffset / 8] >> (7 - (rawOffset % 8))) & 1;
+    stuffedData[stuffedOffset / 8] |= (currentBit << (7 - (stuffedOffset % 8)));
+    stuffedOffset++;
+
+    if (currentBit == 1) {
+      oneCount++;
+      if (oneCount == 5) {
+        oneCount = 0;
+        stuffedData[stuffedOffset / 8] |= 0;
+        stuffedOffset++;
+      }
+    } else {
+      oneCount = 0;
+    }
+  }
+
+  *stuffedDataLen = ((stuffedOffset + 7) / 8) + 1;
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t ax25UnstuffBitwise(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+                                       uint16_t *unstuffedPacketLen) {
+  uint8_t bitCount = 0;
+  uint8_t stuffingFlag = 0;
+  uint16_t unstuffedBitLength = 0;  // count as bits
+
+  // Set the first flag
+  unstuffedPacket[0] = AX25_FLAG;
+  unstuffedBitLength += 8;
+
+  // loop from second byte to second last byte since first and last are the flags
+  for (uint16_t stuffedPacketIndex = 1; stuffedPacketIndex < packetLen - 1; ++stuffedPacketIndex) {
+    uint8_t current_byte = packet[stuffedPacketIndex];
+
+    for (uint8_t offset = 0; offset < 8; ++offset) {
+      uint8_t bit = (current_byte >> (7 - offset)) & 0x01;
+
+      if (stuffingFlag) {
+        bitCount = 0;
+        stuffingFlag = 0;
+        continue;  // Skip adding the stuffed bit
+      }
+
+      if (bit == 1) {
+        bitCount++;
+        if (bitCount == 5) {
+          bitCount = 0;
+          stuffingFlag = 1;
+        }
+      } else {
+        bitCount = 0;
+      }
+      unstuffedPacket[unstuffedBitLength / 8] |= bit << (7 - (unstuffedBitLength % 8));
+      unstuffedBitLength++;
+    }
+  }
+  // Add last flag to end of the packet, rounding up
+  unstuffedPacket[(unstuffedBitLength + 7) / 8] = AX25_FLAG;
+  unstuffedBitLength += 8;
+
+  // convert bits to bytes
+  *unstuffedPacketLen = unstuffedBitLength / 8;
+
+  return OBC_GS_ERR_CODE_SUCCESS;
+}
+
+obc_gs_error_code_t ax25DeframeBytewise(ax25_bytewise_deframer_t *deframer, const uint8_t *data, size_t dataLen,
+                                        ax25_deframer_callback_t callback, void *userData) {
+  obc_gs_error_code_t errCode = OBC_GS_ERR_CODE_SUCCESS;
+
+  for (size_t i = 0; i < dataLen; ++i) {
+    uint8_t byte = data[i];
+
+    if (deframer->axDataIndex >= sizeof(deframer->axData.data)) {
+      errCode = OBC_GS_ERR_CODE_BUFF_TOO_SMALL;
+
+      // Restart the decoding process
+      memset(&deframer->axData, 0, sizeof(deframer->axData));
+      deframer->axDataIndex = 0;
+      deframer->startFlagReceived = false;
+    }
+
+    if (byte == AX25_FLAG) {
+      deframer->axData.data[deframer->axDataIndex++] = byte;
+
+      // Decode packet if we have start flag, end flag, and at least 1 byte of data
+      if (deframer->axDataIndex > 2) {
+        deframer->axData.length = deframer->axDataIndex;
+        callback(deframer->axData.data, deframer->axData.length, userData);
+
+        // Restart the decoding process
+        memset(&deframer->axData, 0, sizeof(deframer->axData));
+        deframer->axDataIndex = 0;
+        deframer->axData.data[deframer->axDataIndex++] = AX25_FLAG;
+      } else {
+        deframer->startFlagReceived = true;
+        deframer->axDataIndex = 1;
+      }
+      continue;
+    }
+
+    if (deframer->startFlagReceived) {
+      deframer->axData.data[deframer->axDataIndex++] = byte;
+    }
+  }
+
+  return errCode;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "obc_gs_errors.h"
+#include "obc_gs_ax25.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief original bit-at-a-time ax.25 bit stuffing, kept as a reference for the table-driven ax25Stuff
+ *
+ * @param rawData unstuffed data buffer
+ * @param rawDataLen length of the rawData buffer
+ * @param stuffedData zero-initialized buffer to store the stuffed data
+ * @param stuffedDataLen number of bytes filled into the stuffedData buffer
+ */
+obc_gs_error_code_t ax25StuffBitwise(const uint8_t *rawData, uint16_t rawDataLen, uint8_t *stuffedData,
+                                     uint16_t *stuffedDataLen);
+
+/**
+ * @brief original bit-at-a-time ax.25 bit unstuffing, kept as a reference for the table-driven ax25Unstuff
+ *
+ * @param packet pointer to a buffer with the received stuffed ax.25 data
+ * @param packetLen length of the packetLen buffer
+ * @param unstuffedPacket zero-initialized buffer to hold the unstuffed ax.25 packet
+ * @param unstuffedPacketLen stores the number of bytes written to unstuffedPacket
+ */
+obc_gs_error_code_t ax25UnstuffBitwise(const uint8_t *packet, uint16_t packetLen, uint8_t *unstuffedPacket,
+                                       uint16_t *unstuffedPacketLen);
+
+typedef struct {
+  packed_ax25_i_frame_t axData;
+  uint16_t axDataIndex;
+  bool startFlagReceived;
+} ax25_bytewise_deframer_t;
+
+/**
+ * @brief original byte-at-a-time flag hunting loop from the uplink decoder, kept as a reference for ax25DeframerPush
+ *
+ * @param deframer zero-initialized state carried between calls
+ * @param data the received bytes
+ * @param dataLen number of bytes in data
+ * @param callback called with every complete frame
+ * @param userData passed through to callback
+ *
+ * @return obc_gs_error_code_t - OBC_GS_ERR_CODE_BUFF_TOO_SMALL if a frame was dropped for being too long
+ */
+obc_gs_error_code_t ax25DeframeBytewise(ax25_bytewise_deframer_t *deframer, const uint8_t *data, size_t dataLen,
+                                        ax25_deframer_callback_t callback, void *userData);
+
+#ifdef __cplusplus
+}
+#endif
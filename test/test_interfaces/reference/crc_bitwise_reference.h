@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief original shift-based CRC16-CCITT, kept as a reference for the table-driven calculateCrc16Ccitt
+ *
+ * @param data: the data that the checksum should be calculated over
+ * @param dataLen: length of the data to calculate the checksum over
+ *
+ * @return calculated checksum
+ */
+uint16_t calculateCrc16CcittBitwise(const uint8_t *data, uint16_t dataLen);
+
+#ifdef __cplusplus
+}
+#endif
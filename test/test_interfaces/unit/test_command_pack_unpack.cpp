@@ -135,3 +135,32 @@ TEST(TestCommandPackUnpack, ValidCmdDownlinkTelemPackUnpack) {
   EXPECT_EQ(packOffset, unpackOffset);
   EXPECT_EQ(cmdMsg.id, unpackedCmdMsg.id);
 }
+
+// CMD_DOWNLINK_TELEM_QUERY
+TEST(TestCommandPackUnpack, ValidCmdDownlinkTelemQueryPackUnpack) {
+  obc_gs_error_code_t errCode;
+  cmd_msg_t cmdMsg = {0};
+  cmdMsg.id = CMD_DOWNLINK_TELEM_QUERY;
+  cmdMsg.downlinkTelemQuery.startTime = 0x12345678;
+  cmdMsg.downlinkTelemQuery.endTime = 0x9ABCDEF0;
+  cmdMsg.downlinkTelemQuery.idMask = 0x00000402;
+  cmdMsg.downlinkTelemQuery.maxSamplesPerId = 0x1234;
+
+  uint8_t buff[MAX_CMD_MSG_SIZE] = {0};
+  uint32_t packOffset = 0;
+  uint8_t numPacked = 0;
+  errCode = packCmdMsg(buff, &packOffset, &cmdMsg, &numPacked);
+  ASSERT_EQ(errCode, OBC_GS_ERR_CODE_SUCCESS);
+
+  cmd_msg_t unpackedCmdMsg = {0};
+  uint32_t unpackOffset = 0;
+  errCode = unpackCmdMsg(buff, &unpackOffset, &unpackedCmdMsg);
+  ASSERT_EQ(errCode, OBC_GS_ERR_CODE_SUCCESS);
+
+  EXPECT_EQ(packOffset, unpackOffset);
+  EXPECT_EQ(cmdMsg.id, unpackedCmdMsg.id);
+  EXPECT_EQ(cmdMsg.downlinkTelemQuery.startTime, unpackedCmdMsg.downlinkTelemQuery.startTime);
+  EXPECT_EQ(cmdMsg.downlinkTelemQuery.endTime, unpackedCmdMsg.downlinkTelemQuery.endTime);
+  EXPECT_EQ(cmdMsg.downlinkTelemQuery.idMask, unpackedCmdMsg.downlinkTelemQuery.idMask);
+  EXPECT_EQ(cmdMsg.downlinkTelemQuery.maxSamplesPerId, unpackedCmdMsg.downlinkTelemQuery.maxSamplesPerId);
+}
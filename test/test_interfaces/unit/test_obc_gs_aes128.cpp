@@ -0,0 +1,119 @@
+#include "obc_gs_aes128.h"
+#include "obc_gs_errors.h"
+
+#include <string.h>
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+// CTR-AES128 test vector F.5.1 from NIST SP 800-38A
+static const uint8_t nistKey[AES_KEY_SIZE] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                              0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+static const uint8_t nistIv[AES_IV_SIZE] = {0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+                                            0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff};
+static const uint8_t nistPlaintext[4 * AES_BLOCK_SIZE] = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10};
+static const uint8_t nistCiphertext[4 * AES_BLOCK_SIZE] = {
+    0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+    0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff, 0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+    0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+    0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1, 0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee};
+
+static aes_data_t makeNistAesData(uint8_t *ciphertext) {
+  aes_data_t aesData;
+  memcpy(aesData.iv, nistIv, AES_IV_SIZE);
+  memcpy(ciphertext, nistCiphertext, sizeof(nistCiphertext));
+  aesData.ciphertext = ciphertext;
+  aesData.ciphertextLen = sizeof(nistCiphertext);
+  return aesData;
+}
+
+TEST(TestAes128, DecryptDefaultCtxKnownAnswer) {
+  uint8_t ciphertext[sizeof(nistCiphertext)];
+  aes_data_t aesData = makeNistAesData(ciphertext);
+  uint8_t output[sizeof(nistPlaintext)];
+
+  ASSERT_EQ(initializeAesCtx(nistKey), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(aes128Decrypt(&aesData, output, sizeof(output)), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(output, nistPlaintext, sizeof(nistPlaintext)), 0);
+
+  // The IV isn't carried over from the previous call
+  ASSERT_EQ(aes128Decrypt(&aesData, output, sizeof(output)), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(output, nistPlaintext, sizeof(nistPlaintext)), 0);
+}
+
+TEST(TestAes128, DecryptWithCtxKnownAnswer) {
+  uint8_t ciphertext[sizeof(nistCiphertext)];
+  aes_data_t aesData = makeNistAesData(ciphertext);
+  uint8_t output[sizeof(nistPlaintext)];
+
+  obc_gs_aes_ctx_t ctx;
+  ASSERT_EQ(aes128InitCtx(&ctx, nistKey), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(aes128DecryptWithCtx(&ctx, &aesData, output, sizeof(output)), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(output, nistPlaintext, sizeof(nistPlaintext)), 0);
+
+  // A context with a different key doesn't affect this one
+  obc_gs_aes_ctx_t otherCtx;
+  uint8_t otherKey[AES_KEY_SIZE] = {0};
+  ASSERT_EQ(aes128InitCtx(&otherCtx, otherKey), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(aes128DecryptWithCtx(&ctx, &aesData, output, sizeof(output)), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(memcmp(output, nistPlaintext, sizeof(nistPlaintext)), 0);
+
+  aes128DestroyCtx(&ctx);
+  aes128DestroyCtx(&otherCtx);
+}
+
+TEST(TestAes128, InvalidArgs) {
+  uint8_t ciphertext[sizeof(nistCiphertext)];
+  aes_data_t aesData = makeNistAesData(ciphertext);
+  uint8_t output[sizeof(nistPlaintext)];
+  obc_gs_aes_ctx_t ctx;
+
+  EXPECT_EQ(aes128InitCtx(NULL, nistKey), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(aes128InitCtx(&ctx, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  ASSERT_EQ(aes128InitCtx(&ctx, nistKey), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(aes128DecryptWithCtx(NULL, &aesData, output, sizeof(output)), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(aes128DecryptWithCtx(&ctx, NULL, output, sizeof(output)), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(aes128DecryptWithCtx(&ctx, &aesData, NULL, sizeof(output)), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(aes128DecryptWithCtx(&ctx, &aesData, output, sizeof(output) - 1), OBC_GS_ERR_CODE_INVALID_ARG);
+}
+
+TEST(TestAes128, SharedCtxConcurrentDecrypt) {
+  obc_gs_aes_ctx_t ctx;
+  ASSERT_EQ(aes128InitCtx(&ctx, nistKey), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Every thread uses its own IV on the same context, which used to race on the shared IV
+  const uint8_t numThreads = 4;
+  std::vector<std::thread> threads;
+  bool matched[numThreads] = {false};
+  for (uint8_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&ctx, &matched, t]() {
+      uint8_t ciphertext[sizeof(nistCiphertext)];
+      aes_data_t aesData = makeNistAesData(ciphertext);
+      aesData.iv[0] ^= t;
+
+      uint8_t expected[sizeof(nistPlaintext)];
+      aes128DecryptWithCtx(&ctx, &aesData, expected, sizeof(expected));
+
+      matched[t] = true;
+      for (uint16_t i = 0; i < 2000; ++i) {
+        uint8_t output[sizeof(nistPlaintext)];
+        aes128DecryptWithCtx(&ctx, &aesData, output, sizeof(output));
+        if (memcmp(output, expected, sizeof(expected)) != 0) matched[t] = false;
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  for (uint8_t t = 0; t < numThreads; ++t) {
+    EXPECT_TRUE(matched[t]);
+  }
+  aes128DestroyCtx(&ctx);
+}
@@ -1,9 +1,12 @@
 #include "obc_gs_ax25.h"
 #include "obc_gs_fec.h"
 #include "obc_gs_errors.h"
+#include "ax25_bitwise_reference.h"
 
 #include <string.h>
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 TEST(TestAx25SendRecv, iFrameLittleStuff) {
@@ -251,3 +254,242 @@ TEST(TestAx25SendRecV, Ax25DestAddressGenerator) {
   ax25GetDestAddress(&sourceAddress, callSign, 4, 0, 1);
   ASSERT_EQ(memcmp(&sourceAddress, &expectedAddress, 7), 0);
 }
+
+TEST(TestAx25SendRecv, iFrameInPlaceMatchesCopy) {
+  packed_telem_packet_t telemPacket;
+  for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+    telemPacket.data[i] = (uint8_t)(i * 7 + 3);
+  }
+  setCurrentLinkDestAddress(&groundStationCallsign);
+
+  // Copy based pipeline: frame from a separate buffer, encode into a separate RS packet and copy it back
+  unstuffed_ax25_i_frame_t copyFrame = {0};
+  ASSERT_EQ(ax25SendIFrame(telemPacket.data, RS_DECODED_SIZE, &copyFrame), OBC_GS_ERR_CODE_SUCCESS);
+  packed_rs_packet_t fecPkt = {0};
+  ASSERT_EQ(rsEncode(copyFrame.data + AX25_INFO_FIELD_POSITION, &fecPkt), OBC_GS_ERR_CODE_SUCCESS);
+  memcpy(copyFrame.data + AX25_INFO_FIELD_POSITION, fecPkt.data, RS_ENCODED_SIZE);
+
+  // In place pipeline: telemetry already in the info field, with leftovers from a previous frame around it
+  unstuffed_ax25_i_frame_t inPlaceFrame;
+  memset(inPlaceFrame.data, 0xA5, sizeof(inPlaceFrame.data));
+  uint8_t *info = inPlaceFrame.data + AX25_INFO_FIELD_POSITION;
+  memcpy(info, telemPacket.data, RS_DECODED_SIZE);
+  ASSERT_EQ(ax25SendIFrame(info, RS_DECODED_SIZE, &inPlaceFrame), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(rsEncode(info, (packed_rs_packet_t *)info), OBC_GS_ERR_CODE_SUCCESS);
+
+  ASSERT_EQ(inPlaceFrame.length, copyFrame.length);
+
+  // The control bytes and FCS differ since every I frame sent bumps the send sequence number
+  EXPECT_EQ(memcmp(inPlaceFrame.data, copyFrame.data, AX25_CONTROL_BYTES_POSITION), 0);
+  EXPECT_EQ(memcmp(inPlaceFrame.data + AX25_MOD128_PID_POSITION, copyFrame.data + AX25_MOD128_PID_POSITION,
+                   AX25_I_FRAME_FCS_POSITION - AX25_MOD128_PID_POSITION),
+            0);
+  EXPECT_EQ(memcmp(info, fecPkt.data, RS_ENCODED_SIZE), 0);
+}
+
+/* Simple LCG so the property tests are reproducible */
+static uint8_t nextPseudorandomByte(uint32_t *seed) {
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return (uint8_t)((*seed >> 16) & 0xFF);
+}
+
+TEST(TestAx25Stuffing, stuffMatchesBitwiseAllBytesAllRunLengths) {
+  for (uint8_t runLength = 0; runLength < 5; ++runLength) {
+    for (uint16_t byte = 0; byte < 256; ++byte) {
+      // The prefix byte ends in exactly runLength 1s so the byte under test starts in that run-length state
+      uint8_t rawData[] = {AX25_FLAG, (uint8_t)((1U << runLength) - 1U), (uint8_t)byte, 0xFF, 0x00, AX25_FLAG};
+
+      uint8_t expected[sizeof(rawData) * 2] = {0};
+      uint16_t expectedLen = 0;
+      ASSERT_EQ(ax25StuffBitwise(rawData, sizeof(rawData), expected, &expectedLen), OBC_GS_ERR_CODE_SUCCESS);
+
+      uint8_t actual[sizeof(rawData) * 2] = {0};
+      uint16_t actualLen = 0;
+      ASSERT_EQ(ax25Stuff(rawData, sizeof(rawData), actual, &actualLen), OBC_GS_ERR_CODE_SUCCESS);
+
+      ASSERT_EQ(actualLen, expectedLen) << "runLength " << (int)runLength << " byte " << byte;
+      ASSERT_EQ(memcmp(actual, expected, sizeof(expected)), 0) << "runLength " << (int)runLength << " byte " << byte;
+    }
+  }
+}
+
+TEST(TestAx25Stuffing, unstuffMatchesBitwiseAllBytesAllStates) {
+  // 0xF8 leaves 5 trailing 1s so the following byte begins with a stuffed bit
+  const uint8_t prefixes[] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0xF8};
+  for (uint8_t i = 0; i < sizeof(prefixes); ++i) {
+    for (uint16_t byte = 0; byte < 256; ++byte) {
+      uint8_t packet[] = {AX25_FLAG, prefixes[i], (uint8_t)byte, 0x00, 0x00, AX25_FLAG};
+
+      uint8_t expected[sizeof(packet) + 2] = {0};
+      uint16_t expectedLen = 0;
+      ASSERT_EQ(ax25UnstuffBitwise(packet, sizeof(packet), expected, &expectedLen), OBC_GS_ERR_CODE_SUCCESS);
+
+      uint8_t actual[sizeof(packet) + 2] = {0};
+      uint16_t actualLen = 0;
+      ASSERT_EQ(ax25Unstuff(packet, sizeof(packet), actual, &actualLen), OBC_GS_ERR_CODE_SUCCESS);
+
+      ASSERT_EQ(actualLen, expectedLen) << "prefix " << (int)prefixes[i] << " byte " << byte;
+      ASSERT_EQ(memcmp(actual, expected, sizeof(expected)), 0) << "prefix " << (int)prefixes[i] << " byte " << byte;
+    }
+  }
+}
+
+TEST(TestAx25Stuffing, stuffUnstuffMatchBitwiseRandomFrames) {
+  uint32_t seed = 0x3C19E5;  // random number
+  for (uint16_t trial = 0; trial < 2000; ++trial) {
+    uint8_t rawData[AX25_MINIMUM_I_FRAME_LEN] = {0};
+    uint16_t rawDataLen = nextPseudorandomByte(&seed) + AX25_TOTAL_FLAG_BYTES;
+    for (uint16_t i = 0; i < rawDataLen; ++i) {
+      // OR two bytes together on odd trials so that long runs of 1s (and therefore stuffing) are common
+      rawData[i] = nextPseudorandomByte(&seed);
+      if (trial & 1) rawData[i] |= nextPseudorandomByte(&seed);
+    }
+    rawData[0] = AX25_FLAG;
+    rawData[rawDataLen - 1] = AX25_FLAG;
+
+    uint8_t expectedStuffed[AX25_MAXIMUM_PKT_LEN] = {0};
+    uint16_t expectedStuffedLen = 0;
+    ASSERT_EQ(ax25StuffBitwise(rawData, rawDataLen, expectedStuffed, &expectedStuffedLen), OBC_GS_ERR_CODE_SUCCESS);
+
+    uint8_t stuffed[AX25_MAXIMUM_PKT_LEN] = {0};
+    uint16_t stuffedLen = 0;
+    ASSERT_EQ(ax25Stuff(rawData, rawDataLen, stuffed, &stuffedLen), OBC_GS_ERR_CODE_SUCCESS);
+    ASSERT_EQ(stuffedLen, expectedStuffedLen);
+    ASSERT_EQ(memcmp(stuffed, expectedStuffed, sizeof(stuffed)), 0);
+
+    stuffed[0] = AX25_FLAG;
+    stuffed[stuffedLen - 1] = AX25_FLAG;
+
+    uint8_t expectedUnstuffed[AX25_MAXIMUM_PKT_LEN] = {0};
+    uint16_t expectedUnstuffedLen = 0;
+    ASSERT_EQ(ax25UnstuffBitwise(stuffed, stuffedLen, expectedUnstuffed, &expectedUnstuffedLen),
+              OBC_GS_ERR_CODE_SUCCESS);
+
+    uint8_t unstuffed[AX25_MAXIMUM_PKT_LEN] = {0};
+    uint16_t unstuffedLen = 0;
+    ASSERT_EQ(ax25Unstuff(stuffed, stuffedLen, unstuffed, &unstuffedLen), OBC_GS_ERR_CODE_SUCCESS);
+    ASSERT_EQ(unstuffedLen, expectedUnstuffedLen);
+    ASSERT_EQ(memcmp(unstuffed, expectedUnstuffed, sizeof(unstuffed)), 0);
+
+    // Everything between the flags must survive the round trip
+    ASSERT_EQ(memcmp(unstuffed + AX25_START_FLAG_BYTES, rawData + AX25_START_FLAG_BYTES,
+                     rawDataLen - AX25_TOTAL_FLAG_BYTES),
+              0);
+  }
+}
+
+TEST(TestAx25Stuffing, unstuffMatchesBitwiseArbitraryInput) {
+  uint32_t seed = 0x51D0A7;  // random number
+  for (uint16_t trial = 0; trial < 2000; ++trial) {
+    uint8_t packet[AX25_MAXIMUM_PKT_LEN] = {0};
+    uint16_t packetLen = nextPseudorandomByte(&seed) + AX25_TOTAL_FLAG_BYTES;
+    for (uint16_t i = 0; i < packetLen; ++i) {
+      packet[i] = nextPseudorandomByte(&seed) | nextPseudorandomByte(&seed);
+    }
+
+    uint8_t expected[AX25_MAXIMUM_PKT_LEN + 2] = {0};
+    uint16_t expectedLen = 0;
+    ASSERT_EQ(ax25UnstuffBitwise(packet, packetLen, expected, &expectedLen), OBC_GS_ERR_CODE_SUCCESS);
+
+    uint8_t actual[AX25_MAXIMUM_PKT_LEN + 2] = {0};
+    uint16_t actualLen = 0;
+    ASSERT_EQ(ax25Unstuff(packet, packetLen, actual, &actualLen), OBC_GS_ERR_CODE_SUCCESS);
+    ASSERT_EQ(actualLen, expectedLen);
+    ASSERT_EQ(memcmp(actual, expected, sizeof(expected)), 0);
+  }
+}
+
+static void collectFrame(const uint8_t *frame, uint16_t frameLen, void *userData) {
+  std::vector<std::vector<uint8_t>> *frames = static_cast<std::vector<std::vector<uint8_t>> *>(userData);
+  frames->emplace_back(frame, frame + frameLen);
+}
+
+TEST(TestAx25Deframer, framesSplitAcrossCalls) {
+  packed_ax25_i_frame_t frame = {0};
+  frame.length = 50;
+  for (uint16_t i = 0; i < frame.length; ++i) {
+    frame.data[i] = (uint8_t)(i + 1);
+  }
+  frame.data[0] = AX25_FLAG;
+  frame.data[frame.length - 1] = AX25_FLAG;
+
+  // Idle flags, then the frame fed one byte at a time
+  std::vector<std::vector<uint8_t>> frames;
+  ax25_deframer_t deframer;
+  ASSERT_EQ(ax25DeframerInit(&deframer, collectFrame, &frames), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint8_t idle[] = {AX25_FLAG, AX25_FLAG, AX25_FLAG};
+  ASSERT_EQ(ax25DeframerPush(&deframer, idle, sizeof(idle)), OBC_GS_ERR_CODE_SUCCESS);
+  for (uint16_t i = 1; i < frame.length; ++i) {
+    ASSERT_EQ(ax25DeframerPush(&deframer, frame.data + i, 1), OBC_GS_ERR_CODE_SUCCESS);
+  }
+
+  ASSERT_EQ(frames.size(), 1U);
+  ASSERT_EQ(frames[0].size(), frame.length);
+  EXPECT_EQ(memcmp(frames[0].data(), frame.data, frame.length), 0);
+}
+
+TEST(TestAx25Deframer, sharedFlagsAndOversizedFrames) {
+  std::vector<std::vector<uint8_t>> frames;
+  ax25_deframer_t deframer;
+  ASSERT_EQ(ax25DeframerInit(&deframer, collectFrame, &frames), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Two frames sharing the flag between them
+  uint8_t shared[] = {AX25_FLAG, 0x01, 0x02, AX25_FLAG, 0x03, AX25_FLAG};
+  ASSERT_EQ(ax25DeframerPush(&deframer, shared, sizeof(shared)), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(frames.size(), 2U);
+  EXPECT_EQ(frames[0], std::vector<uint8_t>({AX25_FLAG, 0x01, 0x02, AX25_FLAG}));
+  EXPECT_EQ(frames[1], std::vector<uint8_t>({AX25_FLAG, 0x03, AX25_FLAG}));
+
+  // A frame one byte longer than the largest stuffed frame is dropped, but the frame after it still comes through
+  std::vector<uint8_t> oversized(AX25_MAXIMUM_PKT_LEN + 1, 0x55);
+  oversized.back() = AX25_FLAG;
+  EXPECT_EQ(ax25DeframerPush(&deframer, oversized.data(), oversized.size()), OBC_GS_ERR_CODE_BUFF_TOO_SMALL);
+  uint8_t next[] = {0x04, AX25_FLAG};
+  ASSERT_EQ(ax25DeframerPush(&deframer, next, sizeof(next)), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(frames.size(), 3U);
+  EXPECT_EQ(frames[2], std::vector<uint8_t>({AX25_FLAG, 0x04, AX25_FLAG}));
+
+  EXPECT_EQ(ax25DeframerInit(NULL, collectFrame, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(ax25DeframerInit(&deframer, NULL, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(ax25DeframerPush(&deframer, NULL, 1), OBC_GS_ERR_CODE_INVALID_ARG);
+}
+
+TEST(TestAx25Deframer, matchesBytewiseRandomStreamsAndSplits) {
+  uint32_t seed = 0xDEF4A3;  // random number
+  for (uint16_t trial = 0; trial < 500; ++trial) {
+    // Frames of random lengths, some too long to fit, separated by single or repeated flags
+    std::vector<uint8_t> stream;
+    while (stream.size() < 4000) {
+      uint8_t flags = (nextPseudorandomByte(&seed) % 3) + 1;
+      stream.insert(stream.end(), flags, AX25_FLAG);
+
+      uint16_t frameLen = (uint16_t)(((nextPseudorandomByte(&seed) << 8) | nextPseudorandomByte(&seed)) % 400);
+      for (uint16_t i = 0; i < frameLen; ++i) {
+        uint8_t byte = nextPseudorandomByte(&seed);
+        stream.push_back(byte == AX25_FLAG ? 0x00 : byte);
+      }
+    }
+    stream.push_back(AX25_FLAG);
+
+    std::vector<std::vector<uint8_t>> expected;
+    ax25_bytewise_deframer_t reference = {};
+    std::vector<std::vector<uint8_t>> actual;
+    ax25_deframer_t deframer;
+    ASSERT_EQ(ax25DeframerInit(&deframer, collectFrame, &actual), OBC_GS_ERR_CODE_SUCCESS);
+
+    // Feed both the same spans of random length, including empty ones
+    size_t pos = 0;
+    while (pos < stream.size()) {
+      size_t spanLen = nextPseudorandomByte(&seed) * (nextPseudorandomByte(&seed) % 3);
+      spanLen = (spanLen > stream.size() - pos) ? stream.size() - pos : spanLen;
+
+      obc_gs_error_code_t expectedErr =
+          ax25DeframeBytewise(&reference, stream.data() + pos, spanLen, collectFrame, &expected);
+      ASSERT_EQ(ax25DeframerPush(&deframer, stream.data() + pos, spanLen), expectedErr);
+      pos += spanLen;
+    }
+
+    ASSERT_EQ(actual, expected);
+  }
+}
@@ -0,0 +1,433 @@
+#include "obc_gs_ax25.h"
+#include "obc_gs_errors.h"
+
+#include <string.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define LOOPBACK_FRAME_COUNT 1000U
+#define LOOPBACK_MAX_CHECKPOINTS (LOOPBACK_FRAME_COUNT * 10U)
+
+/* Simple LCG so the loss pattern is reproducible */
+static uint32_t nextPseudorandom(uint32_t *seed) {
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return *seed >> 16;
+}
+
+typedef struct {
+  uint32_t seed;
+  uint16_t lossPerMille;  // Chance of a frame being corrupted on its way across, out of 1000
+  uint32_t bytesSent;     // Both directions, including retransmissions and S frames
+} lossy_channel_t;
+
+typedef struct {
+  uint32_t delivered;
+  bool inOrder;
+} delivery_log_t;
+
+typedef struct {
+  uint32_t iFramesSent;  // Including retransmissions
+  uint32_t checkpoints;
+  uint32_t bytesSent;
+} loopback_result_t;
+
+/**
+ * @brief carries a stuffed frame across the channel, flipping one of its bits with the channel's loss probability, and
+ * checks it on the other side
+ *
+ * @return bool - whether the receiver accepted the frame
+ */
+static bool transmitFrame(lossy_channel_t *channel, const uint8_t *frame, uint16_t frameLen,
+                          unstuffed_ax25_i_frame_t *received) {
+  uint8_t onAir[AX25_MAXIMUM_PKT_LEN];
+  memcpy(onAir, frame, frameLen);
+  channel->bytesSent += frameLen;
+
+  if (nextPseudorandom(&channel->seed) % 1000 < channel->lossPerMille) {
+    // Leave the flags alone, a broken flag would lose the frame at the deframer instead
+    uint32_t bit = nextPseudorandom(&channel->seed) % ((frameLen - AX25_TOTAL_FLAG_BYTES) * 8U);
+    onAir[AX25_START_FLAG_BYTES + bit / 8] ^= (uint8_t)(1U << (bit % 8));
+  }
+
+  // A corrupted frame can unstuff to more bytes than any valid frame, so unstuff into a buffer that can hold them
+  uint8_t unstuffed[AX25_MAXIMUM_PKT_LEN];
+  uint16_t unstuffedLen = 0;
+  if (ax25Unstuff(onAir, frameLen, unstuffed, &unstuffedLen) != OBC_GS_ERR_CODE_SUCCESS) {
+    return false;
+  }
+  if (unstuffedLen > AX25_MINIMUM_I_FRAME_LEN) {
+    return false;
+  }
+
+  memcpy(received->data, unstuffed, unstuffedLen);
+  received->length = unstuffedLen;
+
+  u_frame_cmd_t command;
+  return ax25Recv(received, &command) == OBC_GS_ERR_CODE_SUCCESS;
+}
+
+static void logDelivery(const unstuffed_ax25_i_frame_t *frame, void *userData) {
+  delivery_log_t *log = (delivery_log_t *)userData;
+
+  uint32_t index;
+  memcpy(&index, frame->data + AX25_INFO_FIELD_POSITION, sizeof(index));
+  if (index != log->delivered) {
+    log->inOrder = false;
+  }
+  log->delivered++;
+}
+
+/**
+ * @brief sends LOOPBACK_FRAME_COUNT numbered I frames between a transmit and receive window over a lossy channel,
+ * checkpointing the way the OBC and ground station do over the half-duplex link
+ *
+ * @param lossPerMille chance of each frame (in either direction) being corrupted, out of 1000
+ * @param useSrej whether the receiver asks for missing frames with SREJs, or with a REJ as a go-back-N receiver would
+ * @param log filled in by the receive window as frames are delivered
+ */
+static loopback_result_t runLoopback(uint16_t lossPerMille, bool useSrej, delivery_log_t *log) {
+  loopback_result_t result = {0};
+  lossy_channel_t channel = {.seed = 0xA59C31U, .lossPerMille = lossPerMille, .bytesSent = 0};
+
+  setCurrentLinkDestAddress(&groundStationCallsign);
+  ax25ResetSendSequenceNumber();
+
+  static ax25_arq_tx_window_t txWindow;
+  static ax25_arq_rx_window_t rxWindow;
+  ax25ArqTxReset(&txWindow);
+  *log = (delivery_log_t){.delivered = 0, .inOrder = true};
+  EXPECT_EQ(ax25ArqRxInit(&rxWindow, logDelivery, log), OBC_GS_ERR_CODE_SUCCESS);
+
+  unstuffed_ax25_i_frame_t received;
+  uint32_t nextIndex = 0;
+
+  while ((nextIndex < LOOPBACK_FRAME_COUNT || ax25ArqTxOutstanding(&txWindow) > 0) &&
+         result.checkpoints < LOOPBACK_MAX_CHECKPOINTS) {
+    // Sender: fill the window with new frames
+    while (nextIndex < LOOPBACK_FRAME_COUNT && ax25ArqTxOutstanding(&txWindow) < AX25_ARQ_WINDOW_SIZE) {
+      uint8_t info[AX25_INFO_BYTES] = {0};
+      memcpy(info, &nextIndex, sizeof(nextIndex));
+
+      unstuffed_ax25_i_frame_t frame = {0};
+      EXPECT_EQ(ax25SendIFrame(info, AX25_INFO_BYTES, &frame), OBC_GS_ERR_CODE_SUCCESS);
+      packed_ax25_i_frame_t packed = {0};
+      EXPECT_EQ(ax25Stuff(frame.data, frame.length, packed.data, &packed.length), OBC_GS_ERR_CODE_SUCCESS);
+      packed.data[0] = AX25_FLAG;
+      packed.data[packed.length - 1] = AX25_FLAG;
+
+      EXPECT_EQ(ax25ArqTxStore(&txWindow, &packed, ax25GetIFrameSendSeqNum(&frame)), OBC_GS_ERR_CODE_SUCCESS);
+      result.iFramesSent++;
+      if (transmitFrame(&channel, packed.data, packed.length, &received)) {
+        EXPECT_EQ(ax25ArqRxFrame(&rxWindow, &received), OBC_GS_ERR_CODE_SUCCESS);
+      }
+      nextIndex++;
+    }
+
+    // Sender: poll for the receiver's state. If the poll is lost the sender times out and polls again
+    result.checkpoints++;
+    ax25ArqTxStartCheckpoint(&txWindow);
+    packed_ax25_s_frame_t poll = {0};
+    EXPECT_EQ(ax25SendSFrame(&poll, AX25_S_FRAME_RR_CONTROL, 0, 1), OBC_GS_ERR_CODE_SUCCESS);
+    if (!transmitFrame(&channel, poll.data, poll.length, &received)) {
+      continue;
+    }
+    ax25_s_frame_info_t pollInfo;
+    EXPECT_EQ(ax25GetSFrameInfo(&received, &pollInfo), OBC_GS_ERR_CODE_SUCCESS);
+    EXPECT_TRUE(pollInfo.pollFinal);
+
+    // Receiver: ask for what is missing, then acknowledge everything up to V(R)
+    std::vector<packed_ax25_s_frame_t> responses;
+    uint8_t missing[AX25_ARQ_WINDOW_SIZE];
+    uint8_t numMissing = 0;
+    EXPECT_EQ(ax25ArqRxMissing(&rxWindow, missing, &numMissing), OBC_GS_ERR_CODE_SUCCESS);
+    if (useSrej) {
+      for (uint8_t i = 0; i < numMissing; ++i) {
+        packed_ax25_s_frame_t srej = {0};
+        EXPECT_EQ(ax25SendSFrame(&srej, AX25_S_FRAME_SREJ_CONTROL, missing[i], 0), OBC_GS_ERR_CODE_SUCCESS);
+        responses.push_back(srej);
+      }
+    }
+    uint8_t finalControl = (!useSrej && numMissing > 0) ? AX25_S_FRAME_REJ_CONTROL : AX25_S_FRAME_RR_CONTROL;
+    packed_ax25_s_frame_t final = {0};
+    EXPECT_EQ(ax25SendSFrame(&final, finalControl, ax25ArqRxNextExpected(&rxWindow), 1), OBC_GS_ERR_CODE_SUCCESS);
+    responses.push_back(final);
+
+    // Sender: act on whichever responses made it across, then resend what was asked for
+    for (const packed_ax25_s_frame_t &response : responses) {
+      if (!transmitFrame(&channel, response.data, response.length, &received)) {
+        continue;
+      }
+      ax25_s_frame_info_t sFrameInfo;
+      EXPECT_EQ(ax25GetSFrameInfo(&received, &sFrameInfo), OBC_GS_ERR_CODE_SUCCESS);
+      EXPECT_EQ(ax25ArqTxHandleSFrame(&txWindow, &sFrameInfo), OBC_GS_ERR_CODE_SUCCESS);
+    }
+
+    const packed_ax25_i_frame_t *retransmission;
+    while (ax25ArqTxNextRetransmission(&txWindow, &retransmission)) {
+      result.iFramesSent++;
+      if (transmitFrame(&channel, retransmission->data, retransmission->length, &received)) {
+        EXPECT_EQ(ax25ArqRxFrame(&rxWindow, &received), OBC_GS_ERR_CODE_SUCCESS);
+      }
+    }
+  }
+
+  result.bytesSent = channel.bytesSent;
+  return result;
+}
+
+TEST(TestAx25Arq, sFrameSendRecv) {
+  setCurrentLinkDestAddress(&groundStationCallsign);
+
+  const uint8_t controls[] = {AX25_S_FRAME_RR_CONTROL, AX25_S_FRAME_RNR_CONTROL, AX25_S_FRAME_REJ_CONTROL,
+                              AX25_S_FRAME_SREJ_CONTROL};
+  for (uint8_t control : controls) {
+    for (uint16_t receiveSeqNum = 0; receiveSeqNum < AX25_ARQ_MODULUS; ++receiveSeqNum) {
+      packed_ax25_s_frame_t sFrame = {0};
+      ASSERT_EQ(ax25SendSFrame(&sFrame, control, (uint8_t)receiveSeqNum, receiveSeqNum % 2), OBC_GS_ERR_CODE_SUCCESS);
+      ASSERT_LE(sFrame.length, AX25_MAXIMUM_S_FRAME_LENGTH);
+
+      unstuffed_ax25_i_frame_t unstuffedPacket = {0};
+      ASSERT_EQ(ax25Unstuff(sFrame.data, sFrame.length, unstuffedPacket.data, &unstuffedPacket.length),
+                OBC_GS_ERR_CODE_SUCCESS);
+      EXPECT_EQ(unstuffedPacket.length, AX25_SUPERVISORY_FRAME_LENGTH);
+
+      u_frame_cmd_t command;
+      ASSERT_EQ(ax25Recv(&unstuffedPacket, &command), OBC_GS_ERR_CODE_SUCCESS);
+
+      ax25_s_frame_info_t sFrameInfo;
+      ASSERT_EQ(ax25GetSFrameInfo(&unstuffedPacket, &sFrameInfo), OBC_GS_ERR_CODE_SUCCESS);
+      EXPECT_EQ(sFrameInfo.control, control);
+      EXPECT_EQ(sFrameInfo.receiveSeqNum, receiveSeqNum);
+      EXPECT_EQ(sFrameInfo.pollFinal, receiveSeqNum % 2 == 1);
+    }
+  }
+
+  packed_ax25_s_frame_t sFrame = {0};
+  EXPECT_EQ(ax25SendSFrame(&sFrame, 0x03, 0, 0), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(ax25SendSFrame(&sFrame, AX25_S_FRAME_RR_CONTROL, AX25_ARQ_MODULUS, 0), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(ax25SendSFrame(&sFrame, AX25_S_FRAME_RR_CONTROL, 0, 2), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  // An I frame is not an S frame
+  uint8_t telemData[AX25_INFO_BYTES] = {0};
+  unstuffed_ax25_i_frame_t iFrame = {0};
+  ASSERT_EQ(ax25SendIFrame(telemData, AX25_INFO_BYTES, &iFrame), OBC_GS_ERR_CODE_SUCCESS);
+  ax25_s_frame_info_t sFrameInfo;
+  EXPECT_EQ(ax25GetSFrameInfo(&iFrame, &sFrameInfo), OBC_GS_ERR_CODE_INVALID_AX25_PACKET);
+}
+
+TEST(TestAx25Arq, txWindowAckAndRetransmit) {
+  static ax25_arq_tx_window_t window;
+  ax25ArqTxReset(&window);
+
+  packed_ax25_i_frame_t frame = {0};
+  frame.length = 10;
+
+  // Frames must be stored in sequence and the window can't overflow
+  EXPECT_EQ(ax25ArqTxStore(&window, &frame, 1), OBC_GS_ERR_CODE_INVALID_ARG);
+  for (uint8_t seqNum = 0; seqNum < AX25_ARQ_WINDOW_SIZE; ++seqNum) {
+    frame.data[0] = seqNum;
+    ASSERT_EQ(ax25ArqTxStore(&window, &frame, seqNum), OBC_GS_ERR_CODE_SUCCESS);
+  }
+  EXPECT_EQ(ax25ArqTxStore(&window, &frame, AX25_ARQ_WINDOW_SIZE), OBC_GS_ERR_CODE_BUFF_TOO_SMALL);
+  EXPECT_EQ(ax25ArqTxOutstanding(&window), AX25_ARQ_WINDOW_SIZE);
+
+  // SREJs for frames 2 and 5, then a final RR acknowledging 0 and 1 only resends the SREJ'd frames
+  ax25_s_frame_info_t srej2 = {.control = AX25_S_FRAME_SREJ_CONTROL, .receiveSeqNum = 2, .pollFinal = false};
+  ax25_s_frame_info_t srej5 = {.control = AX25_S_FRAME_SREJ_CONTROL, .receiveSeqNum = 5, .pollFinal = false};
+  ax25_s_frame_info_t srejUnsent = {.control = AX25_S_FRAME_SREJ_CONTROL, .receiveSeqNum = 100, .pollFinal = false};
+  ax25_s_frame_info_t rr2 = {.control = AX25_S_FRAME_RR_CONTROL, .receiveSeqNum = 2, .pollFinal = true};
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &srej5), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &srej2), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &srejUnsent), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &rr2), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(ax25ArqTxOutstanding(&window), AX25_ARQ_WINDOW_SIZE - 2);
+
+  const packed_ax25_i_frame_t *retransmission;
+  ASSERT_TRUE(ax25ArqTxNextRetransmission(&window, &retransmission));
+  EXPECT_EQ(retransmission->data[0], 2);
+  ASSERT_TRUE(ax25ArqTxNextRetransmission(&window, &retransmission));
+  EXPECT_EQ(retransmission->data[0], 5);
+  EXPECT_FALSE(ax25ArqTxNextRetransmission(&window, &retransmission));
+
+  // A final RR with no gaps reported means everything after N(R) was lost
+  ax25_s_frame_info_t rr6 = {.control = AX25_S_FRAME_RR_CONTROL, .receiveSeqNum = 6, .pollFinal = true};
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &rr6), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_TRUE(ax25ArqTxNextRetransmission(&window, &retransmission));
+  EXPECT_EQ(retransmission->data[0], 6);
+  ASSERT_TRUE(ax25ArqTxNextRetransmission(&window, &retransmission));
+  EXPECT_EQ(retransmission->data[0], 7);
+  EXPECT_FALSE(ax25ArqTxNextRetransmission(&window, &retransmission));
+
+  // N(R) can't acknowledge frames that were never sent, or go backwards
+  ax25_s_frame_info_t rrAhead = {.control = AX25_S_FRAME_RR_CONTROL, .receiveSeqNum = 9, .pollFinal = false};
+  ax25_s_frame_info_t rrBehind = {.control = AX25_S_FRAME_RR_CONTROL, .receiveSeqNum = 5, .pollFinal = false};
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &rrAhead), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &rrBehind), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  ax25_s_frame_info_t rr8 = {.control = AX25_S_FRAME_RR_CONTROL, .receiveSeqNum = 8, .pollFinal = true};
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &rr8), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(ax25ArqTxOutstanding(&window), 0);
+  EXPECT_FALSE(ax25ArqTxNextRetransmission(&window, &retransmission));
+}
+
+TEST(TestAx25Arq, txWindowLostFinalRr) {
+  static ax25_arq_tx_window_t window;
+  ax25ArqTxReset(&window);
+
+  packed_ax25_i_frame_t frame = {0};
+  frame.length = 10;
+  for (uint8_t seqNum = 0; seqNum < AX25_ARQ_WINDOW_SIZE; ++seqNum) {
+    frame.data[0] = seqNum;
+    ASSERT_EQ(ax25ArqTxStore(&window, &frame, seqNum), OBC_GS_ERR_CODE_SUCCESS);
+  }
+
+  // First checkpoint: the SREJ for frame 2 arrives but the final RR after it is lost
+  ax25ArqTxStartCheckpoint(&window);
+  ax25_s_frame_info_t srej2 = {.control = AX25_S_FRAME_SREJ_CONTROL, .receiveSeqNum = 2, .pollFinal = false};
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &srej2), OBC_GS_ERR_CODE_SUCCESS);
+
+  const packed_ax25_i_frame_t *retransmission;
+  ASSERT_TRUE(ax25ArqTxNextRetransmission(&window, &retransmission));
+  EXPECT_EQ(retransmission->data[0], 2);
+  EXPECT_FALSE(ax25ArqTxNextRetransmission(&window, &retransmission));
+
+  // Second checkpoint: the receiver now has everything up to frame 3 and no gaps, so frames 3 onward were lost
+  ax25ArqTxStartCheckpoint(&window);
+  ax25_s_frame_info_t rr3 = {.control = AX25_S_FRAME_RR_CONTROL, .receiveSeqNum = 3, .pollFinal = true};
+  EXPECT_EQ(ax25ArqTxHandleSFrame(&window, &rr3), OBC_GS_ERR_CODE_SUCCESS);
+  for (uint8_t seqNum = 3; seqNum < AX25_ARQ_WINDOW_SIZE; ++seqNum) {
+    ASSERT_TRUE(ax25ArqTxNextRetransmission(&window, &retransmission));
+    EXPECT_EQ(retransmission->data[0], seqNum);
+  }
+  EXPECT_FALSE(ax25ArqTxNextRetransmission(&window, &retransmission));
+}
+
+TEST(TestAx25Arq, rxWindowReordersAndDropsDuplicates) {
+  setCurrentLinkDestAddress(&groundStationCallsign);
+  ax25ResetSendSequenceNumber();
+
+  std::vector<unstuffed_ax25_i_frame_t> frames(AX25_ARQ_MODULUS + 4);
+  for (uint32_t i = 0; i < frames.size(); ++i) {
+    uint8_t info[AX25_INFO_BYTES] = {0};
+    memcpy(info, &i, sizeof(i));
+    ASSERT_EQ(ax25SendIFrame(info, AX25_INFO_BYTES, &frames[i]), OBC_GS_ERR_CODE_SUCCESS);
+  }
+
+  static ax25_arq_rx_window_t window;
+  delivery_log_t log = {.delivered = 0, .inOrder = true};
+  ASSERT_EQ(ax25ArqRxInit(&window, logDelivery, &log), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Frame 0 is lost, so 1-3 are held back and everything but them is reported missing
+  for (uint8_t i = 1; i < 4; ++i) {
+    ASSERT_EQ(ax25ArqRxFrame(&window, &frames[i]), OBC_GS_ERR_CODE_SUCCESS);
+  }
+  EXPECT_EQ(log.delivered, 0U);
+
+  uint8_t missing[AX25_ARQ_WINDOW_SIZE];
+  uint8_t numMissing = 0;
+  ASSERT_EQ(ax25ArqRxMissing(&window, missing, &numMissing), OBC_GS_ERR_CODE_SUCCESS);
+  ASSERT_EQ(numMissing, AX25_ARQ_WINDOW_SIZE - 3);
+  EXPECT_EQ(missing[0], 0);
+  EXPECT_EQ(missing[1], 4);
+
+  // A duplicate while buffered and a frame beyond the window are both ignored
+  ASSERT_EQ(ax25ArqRxFrame(&window, &frames[2]), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(ax25ArqRxFrame(&window, &frames[AX25_ARQ_WINDOW_SIZE + 1]), OBC_GS_ERR_CODE_INVALID_AX25_PACKET);
+
+  // Frame 0 releases 1-3
+  ASSERT_EQ(ax25ArqRxFrame(&window, &frames[0]), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(log.delivered, 4U);
+  EXPECT_EQ(ax25ArqRxNextExpected(&window), 4);
+  ASSERT_EQ(ax25ArqRxMissing(&window, missing, &numMissing), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(numMissing, 0);
+
+  // Frames that were already delivered are dropped
+  ASSERT_EQ(ax25ArqRxFrame(&window, &frames[1]), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(log.delivered, 4U);
+
+  // Sequence numbers wrap around
+  for (uint32_t i = 4; i < frames.size(); ++i) {
+    ASSERT_EQ(ax25ArqRxFrame(&window, &frames[i]), OBC_GS_ERR_CODE_SUCCESS);
+  }
+  EXPECT_EQ(log.delivered, frames.size());
+  EXPECT_TRUE(log.inOrder);
+}
+
+TEST(TestAx25Arq, rxWindowStartsOverAfterDisc) {
+  setCurrentLinkDestAddress(&groundStationCallsign);
+
+  static ax25_arq_rx_window_t window;
+  delivery_log_t log = {.delivered = 0, .inOrder = true};
+  ASSERT_EQ(ax25ArqRxInit(&window, logDelivery, &log), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Two downlinks, each numbered from 0 by the OBC, with a DISC between them
+  const uint32_t framesPerPass = 5;
+  for (uint32_t pass = 0; pass < 2; ++pass) {
+    ax25ResetSendSequenceNumber();
+
+    std::vector<unstuffed_ax25_i_frame_t> frames(framesPerPass);
+    for (uint32_t i = 0; i < framesPerPass; ++i) {
+      uint32_t index = pass * framesPerPass + i;
+      uint8_t info[AX25_INFO_BYTES] = {0};
+      memcpy(info, &index, sizeof(index));
+      ASSERT_EQ(ax25SendIFrame(info, AX25_INFO_BYTES, &frames[i]), OBC_GS_ERR_CODE_SUCCESS);
+    }
+
+    if (pass > 0) {
+      // Until the DISC, frame 0 of the new downlink looks like a retransmission of one already delivered
+      ASSERT_EQ(ax25ArqRxFrame(&window, &frames[0]), OBC_GS_ERR_CODE_SUCCESS);
+      EXPECT_EQ(log.delivered, framesPerPass);
+
+      packed_ax25_u_frame_t disc = {0};
+      ASSERT_EQ(ax25SendUFrame(&disc, U_FRAME_CMD_DISC, 0), OBC_GS_ERR_CODE_SUCCESS);
+      unstuffed_ax25_i_frame_t unstuffedDisc = {0};
+      ASSERT_EQ(ax25Unstuff(disc.data, disc.length, unstuffedDisc.data, &unstuffedDisc.length),
+                OBC_GS_ERR_CODE_SUCCESS);
+      u_frame_cmd_t command;
+      ASSERT_EQ(ax25Recv(&unstuffedDisc, &command), OBC_GS_ERR_CODE_SUCCESS);
+      ASSERT_EQ(command, U_FRAME_CMD_DISC);
+      ax25ArqRxHandleUFrame(&window, command);
+      EXPECT_EQ(ax25ArqRxNextExpected(&window), 0);
+    }
+
+    for (const unstuffed_ax25_i_frame_t &frame : frames) {
+      ASSERT_EQ(ax25ArqRxFrame(&window, &frame), OBC_GS_ERR_CODE_SUCCESS);
+    }
+    EXPECT_EQ(log.delivered, (pass + 1) * framesPerPass);
+    EXPECT_EQ(ax25ArqRxNextExpected(&window), framesPerPass);
+  }
+  EXPECT_TRUE(log.inOrder);
+}
+
+TEST(TestAx25Arq, loopbackDeliversEverythingInOrder) {
+  const uint16_t lossRatesPerMille[] = {0, 10, 50, 200};
+  for (uint16_t lossPerMille : lossRatesPerMille) {
+    for (bool useSrej : {true, false}) {
+      delivery_log_t log;
+      loopback_result_t result = runLoopback(lossPerMille, useSrej, &log);
+
+      EXPECT_LT(result.checkpoints, LOOPBACK_MAX_CHECKPOINTS) << "loss " << lossPerMille << "/1000";
+      EXPECT_EQ(log.delivered, LOOPBACK_FRAME_COUNT) << "loss " << lossPerMille << "/1000";
+      EXPECT_TRUE(log.inOrder) << "loss " << lossPerMille << "/1000";
+      if (lossPerMille == 0) {
+        EXPECT_EQ(result.iFramesSent, LOOPBACK_FRAME_COUNT);
+      }
+    }
+  }
+}
+
+TEST(TestAx25Arq, selectiveRepeatResendsLessThanGoBackN) {
+  const uint16_t lossRatesPerMille[] = {10, 50, 200};
+  for (uint16_t lossPerMille : lossRatesPerMille) {
+    delivery_log_t log;
+    loopback_result_t selectiveRepeat = runLoopback(lossPerMille, true, &log);
+    loopback_result_t goBackN = runLoopback(lossPerMille, false, &log);
+
+    // Each I frame only has to be resent about as often as it is lost, allowing for lost S frames
+    double expectedSends = LOOPBACK_FRAME_COUNT / (1.0 - lossPerMille / 1000.0);
+    EXPECT_LT(selectiveRepeat.iFramesSent, expectedSends * 1.05) << "loss " << lossPerMille << "/1000";
+    EXPECT_LT(selectiveRepeat.iFramesSent, goBackN.iFramesSent) << "loss " << lossPerMille << "/1000";
+  }
+}
@@ -0,0 +1,64 @@
+#include "obc_gs_crc.h"
+#include "crc_bitwise_reference.h"
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+/* Simple LCG so the property tests are reproducible */
+static uint8_t nextPseudorandomByte(uint32_t *seed) {
+  *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+  return (uint8_t)((*seed >> 16) & 0xFF);
+}
+
+TEST(TestCrc16Ccitt, knownCheckValue) {
+  // Standard check value for CRC16-CCITT with a 0 initial value (XMODEM)
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  EXPECT_EQ(calculateCrc16Ccitt(check, sizeof(check)), 0x31C3);
+  EXPECT_EQ(calculateCrc16Ccitt(check, 0), 0x0000);
+}
+
+TEST(TestCrc16Ccitt, matchesBitwiseAllSingleBytes) {
+  for (uint16_t byte = 0; byte < 256; ++byte) {
+    uint8_t data = (uint8_t)byte;
+    ASSERT_EQ(calculateCrc16Ccitt(&data, 1), calculateCrc16CcittBitwise(&data, 1));
+  }
+}
+
+TEST(TestCrc16Ccitt, matchesBitwiseRandomLengthsAndAlignments) {
+  uint32_t seed = 0xC4C16;  // random number
+  uint8_t buffer[1024 + 8];
+  for (uint16_t trial = 0; trial < 2000; ++trial) {
+    uint16_t offset = nextPseudorandomByte(&seed) % 8;
+    uint16_t dataLen = ((nextPseudorandomByte(&seed) << 8) | nextPseudorandomByte(&seed)) % 1024;
+    for (uint16_t i = 0; i < dataLen; ++i) {
+      buffer[offset + i] = nextPseudorandomByte(&seed);
+    }
+
+    ASSERT_EQ(calculateCrc16Ccitt(buffer + offset, dataLen), calculateCrc16CcittBitwise(buffer + offset, dataLen));
+  }
+}
+
+TEST(TestCrc16Ccitt, updateInPiecesMatchesWhole) {
+  uint32_t seed = 0x5EED;  // random number
+  uint8_t data[600];
+  for (uint16_t i = 0; i < sizeof(data); ++i) {
+    data[i] = nextPseudorandomByte(&seed);
+  }
+  uint16_t expected = calculateCrc16CcittBitwise(data, sizeof(data));
+
+  for (uint16_t trial = 0; trial < 500; ++trial) {
+    uint16_t crc = CRC16_CCITT_INITIAL_VALUE;
+    size_t pos = 0;
+    while (pos < sizeof(data)) {
+      size_t pieceLen = nextPseudorandomByte(&seed) % 20;
+      pieceLen = (pieceLen > sizeof(data) - pos) ? sizeof(data) - pos : pieceLen;
+      crc = crc16CcittUpdate(crc, data + pos, pieceLen);
+      pos += pieceLen;
+    }
+    ASSERT_EQ(crc, expected);
+  }
+
+  // A NULL buffer leaves the checksum untouched
+  EXPECT_EQ(crc16CcittUpdate(0x1234, NULL, 10), 0x1234);
+}
@@ -3,8 +3,19 @@
 
 #include <string.h>
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+// The ROM tables are compared against the ones a generic codec builds, which needs libcorrect's internal layout
+extern "C" {
+#include "correct/reed-solomon/ccsds.h"
+}
+
+// Counted by the sysMalloc mock
+extern "C" size_t mockHeapAllocations;
+
 TEST(TestFecEncodeDecode, EncodeDecodeZeroData) {
   packed_rs_packet_t encodedData = {0};
   uint8_t data[RS_DECODED_SIZE];
@@ -38,3 +49,529 @@ TEST(TestFecEncodeDecode, EncodeDecodeNonZero) {
   ASSERT_EQ(memcmp(decodedData, data, RS_DECODED_SIZE), 0);
   destroyRs();
 }
+
+TEST(TestFecEncodeDecode, CcsdsEncoderMatchesGenericEncoder) {
+  correct_reed_solomon *genericRs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  ASSERT_NE(genericRs, nullptr);
+
+  uint32_t seed = 0x2B9E41;  // random number
+  for (uint16_t trial = 0; trial < 500; ++trial) {
+    uint8_t data[RS_DECODED_SIZE];
+    for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+      seed = (seed * 1103515245 + 12345) % (1U << 31);
+      data[i] = (uint8_t)(seed >> 16);
+    }
+    // Cover full blocks as well as shortened blocks with virtual padding
+    size_t msgLen = (trial % 4 == 0) ? (seed % RS_DECODED_SIZE) : RS_DECODED_SIZE;
+    ssize_t encodedLen = msgLen + RS_ENCODED_SIZE - RS_DECODED_SIZE;
+
+    uint8_t expected[RS_ENCODED_SIZE] = {0};
+    uint8_t actual[RS_ENCODED_SIZE] = {0};
+    ASSERT_EQ(correct_reed_solomon_encode(genericRs, data, msgLen, expected), RS_ENCODED_SIZE);
+    ASSERT_EQ(correct_reed_solomon_encode_ccsds(data, msgLen, actual), encodedLen);
+    ASSERT_EQ(memcmp(actual, expected, encodedLen), 0);
+
+    // Encoding in place must give the same result
+    uint8_t inPlace[RS_ENCODED_SIZE] = {0};
+    memcpy(inPlace, data, msgLen);
+    ASSERT_EQ(correct_reed_solomon_encode_ccsds(inPlace, msgLen, inPlace), encodedLen);
+    ASSERT_EQ(memcmp(inPlace, expected, encodedLen), 0);
+  }
+
+  uint8_t tooLong[RS_ENCODED_SIZE] = {0};
+  EXPECT_EQ(correct_reed_solomon_encode_ccsds(tooLong, RS_DECODED_SIZE + 1, tooLong), -1);
+
+  correct_reed_solomon_destroy(genericRs);
+}
+
+TEST(TestFecEncodeDecode, CcsdsDecoderMatchesGenericDecoder) {
+  correct_reed_solomon *genericRs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  ASSERT_NE(genericRs, nullptr);
+
+  const correct_rs_syndrome_kernel kernels[] = {CORRECT_RS_SYNDROME_KERNEL_SCALAR, CORRECT_RS_SYNDROME_KERNEL_SSSE3,
+                                                CORRECT_RS_SYNDROME_KERNEL_AVX2};
+  for (correct_rs_syndrome_kernel kernel : kernels) {
+    if (!correct_reed_solomon_ccsds_set_syndrome_kernel(kernel)) {
+      continue;  // Not available on this cpu
+    }
+    ASSERT_EQ(correct_reed_solomon_ccsds_syndrome_kernel(), kernel);
+
+    // A codec keeps the kernel it was set up with, so each kernel gets a codec of its own
+    correct_reed_solomon_ccsds ccsdsCodec;
+    correct_reed_solomon *ccsdsRs = correct_reed_solomon_ccsds_init(&ccsdsCodec);
+    ASSERT_NE(ccsdsRs, nullptr);
+
+    uint32_t seed = 0x5C03D7;  // random number
+    for (uint16_t trial = 0; trial < 1000; ++trial) {
+      uint8_t data[RS_DECODED_SIZE];
+      for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+        seed = (seed * 1103515245 + 12345) % (1U << 31);
+        data[i] = (uint8_t)(seed >> 16);
+      }
+      // Cover full blocks as well as shortened blocks of every head length
+      size_t msgLen = (trial % 4 == 0) ? (seed % RS_DECODED_SIZE) : RS_DECODED_SIZE;
+      size_t encodedLen = msgLen + RS_ENCODED_SIZE - RS_DECODED_SIZE;
+
+      uint8_t encoded[RS_ENCODED_SIZE] = {0};
+      ASSERT_EQ(correct_reed_solomon_encode_ccsds(data, msgLen, encoded), (ssize_t)encodedLen);
+
+      // Anything from a clean block to well past the 16 correctable errors
+      uint8_t numErrors = (trial % 3 == 0) ? 0 : (seed >> 8) % 24;
+      for (uint8_t i = 0; i < numErrors; ++i) {
+        seed = (seed * 1103515245 + 12345) % (1U << 31);
+        encoded[(seed >> 8) % encodedLen] ^= (uint8_t)((seed >> 16) | 1);
+      }
+
+      uint8_t expected[RS_DECODED_SIZE] = {0};
+      uint8_t actual[RS_DECODED_SIZE] = {0};
+      ssize_t expectedLen = correct_reed_solomon_decode(genericRs, encoded, encodedLen, expected);
+      ASSERT_EQ(correct_reed_solomon_decode_ccsds(ccsdsRs, encoded, encodedLen, actual), expectedLen);
+      if (expectedLen != -1) {
+        ASSERT_EQ(memcmp(actual, expected, msgLen), 0);
+      }
+    }
+  }
+
+  ASSERT_TRUE(correct_reed_solomon_ccsds_set_syndrome_kernel(CORRECT_RS_SYNDROME_KERNEL_AUTO));
+
+  // A codec from correct_reed_solomon_create picks its kernel on the first block
+  correct_reed_solomon *ccsdsRs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  ASSERT_NE(ccsdsRs, nullptr);
+  uint8_t tooLong[RS_ENCODED_SIZE + 1] = {0};
+  uint8_t msg[RS_ENCODED_SIZE] = {0};
+  EXPECT_EQ(correct_reed_solomon_decode_ccsds(ccsdsRs, tooLong, RS_ENCODED_SIZE + 1, msg), -1);
+  uint8_t clean[RS_ENCODED_SIZE] = {0};
+  EXPECT_EQ(correct_reed_solomon_decode_ccsds(ccsdsRs, clean, RS_ENCODED_SIZE, msg), RS_DECODED_SIZE);
+
+  correct_reed_solomon_destroy(genericRs);
+  correct_reed_solomon_destroy(ccsdsRs);
+}
+
+TEST(TestFecEncodeDecode, StaticCcsdsTablesMatchGenericCodec) {
+  correct_reed_solomon *genericRs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  ASSERT_NE(genericRs, nullptr);
+
+  // The generic codec only builds its decoder tables once it has a block with errors to correct
+  uint8_t block[RS_ENCODED_SIZE] = {0};
+  uint8_t msg[RS_DECODED_SIZE];
+  block[7] ^= 0x5A;
+  ASSERT_EQ(correct_reed_solomon_decode(genericRs, block, RS_ENCODED_SIZE, msg), (ssize_t)RS_DECODED_SIZE);
+
+  EXPECT_EQ(memcmp(correct_rs_ccsds_exp, genericRs->field.exp, 512), 0);
+  EXPECT_EQ(memcmp(correct_rs_ccsds_log, genericRs->field.log, 256), 0);
+  ASSERT_EQ(genericRs->generator.order, CCSDS_RS_ROOTS);
+  EXPECT_EQ(memcmp(correct_rs_ccsds_generator, genericRs->generator.coeff, CCSDS_RS_ROOTS + 1), 0);
+  EXPECT_EQ(memcmp(correct_rs_ccsds_generator_roots, genericRs->generator_roots, CCSDS_RS_ROOTS), 0);
+  for (uint8_t i = 0; i < CCSDS_RS_ROOTS; ++i) {
+    EXPECT_EQ(memcmp(correct_rs_ccsds_generator_root_exp[i], genericRs->generator_root_exp[i], RS_ENCODED_SIZE), 0);
+  }
+  for (uint16_t i = 0; i < 256; ++i) {
+    EXPECT_EQ(memcmp(correct_rs_ccsds_element_exp[i], genericRs->element_exp[i], CCSDS_RS_ROOTS), 0);
+  }
+
+  correct_reed_solomon_destroy(genericRs);
+}
+
+TEST(TestFecEncodeDecode, StaticCcsdsCodecMatchesGenericCodec) {
+  correct_reed_solomon *genericRs = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32);
+  ASSERT_NE(genericRs, nullptr);
+  correct_reed_solomon_ccsds codec;
+  correct_reed_solomon *staticRs = correct_reed_solomon_ccsds_init(&codec);
+  ASSERT_NE(staticRs, nullptr);
+  EXPECT_EQ(correct_reed_solomon_ccsds_init(NULL), nullptr);
+
+  uint32_t seed = 0x64E2B9;  // random number
+  for (uint16_t trial = 0; trial < 1000; ++trial) {
+    uint8_t data[RS_DECODED_SIZE];
+    for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+      seed = (seed * 1103515245 + 12345) % (1U << 31);
+      data[i] = (uint8_t)(seed >> 16);
+    }
+    size_t msgLen = (trial % 4 == 0) ? (seed % RS_DECODED_SIZE) : RS_DECODED_SIZE;
+    size_t encodedLen = msgLen + RS_ENCODED_SIZE - RS_DECODED_SIZE;
+
+    uint8_t encoded[RS_ENCODED_SIZE] = {0};
+    uint8_t expectedEncoded[RS_ENCODED_SIZE] = {0};
+    ASSERT_EQ(correct_reed_solomon_encode(genericRs, data, msgLen, expectedEncoded), RS_ENCODED_SIZE);
+    ASSERT_EQ(correct_reed_solomon_encode(staticRs, data, msgLen, encoded), RS_ENCODED_SIZE);
+    ASSERT_EQ(memcmp(encoded, expectedEncoded, encodedLen), 0);
+
+    // Anything from a clean block to well past the 16 correctable errors, with up to 8 of them marked as erasures
+    uint8_t numErrors = (trial % 3 == 0) ? 0 : (seed >> 8) % 24;
+    uint8_t erasures[8];
+    uint8_t numErasures = 0;
+    for (uint8_t i = 0; i < numErrors; ++i) {
+      seed = (seed * 1103515245 + 12345) % (1U << 31);
+      uint8_t pos = (uint8_t)((seed >> 8) % encodedLen);
+      encoded[pos] ^= (uint8_t)((seed >> 16) | 1);
+      if (trial % 2 == 0 && numErasures < sizeof(erasures) && memchr(erasures, pos, numErasures) == NULL) {
+        erasures[numErasures++] = pos;
+      }
+    }
+
+    uint8_t expected[RS_DECODED_SIZE] = {0};
+    uint8_t actual[RS_DECODED_SIZE] = {0};
+    ssize_t expectedLen = correct_reed_solomon_decode(genericRs, encoded, encodedLen, expected);
+    ASSERT_EQ(correct_reed_solomon_decode(staticRs, encoded, encodedLen, actual), expectedLen);
+    if (expectedLen != -1) {
+      ASSERT_EQ(memcmp(actual, expected, msgLen), 0);
+    }
+    ASSERT_EQ(correct_reed_solomon_decode_ccsds(staticRs, encoded, encodedLen, actual), expectedLen);
+    if (expectedLen != -1) {
+      ASSERT_EQ(memcmp(actual, expected, msgLen), 0);
+    }
+
+    expectedLen =
+        correct_reed_solomon_decode_with_erasures(genericRs, encoded, encodedLen, erasures, numErasures, expected);
+    ASSERT_EQ(correct_reed_solomon_decode_with_erasures(staticRs, encoded, encodedLen, erasures, numErasures, actual),
+              expectedLen);
+    if (expectedLen != -1) {
+      ASSERT_EQ(memcmp(actual, expected, msgLen), 0);
+    }
+  }
+
+  // Nothing was allocated, so this must leave the codec alone
+  correct_reed_solomon_destroy(staticRs);
+  correct_reed_solomon_destroy(genericRs);
+}
+
+// Encodes random data and then corrupts numErasures bytes, which are reported as erasures, and numErrors other bytes
+static void makeErasedBlock(uint32_t *seed, uint8_t *data, packed_rs_packet_t *encoded, uint8_t *erasures,
+                            uint8_t numErasures, uint8_t numErrors) {
+  for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+    *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+    data[i] = (uint8_t)(*seed >> 16);
+  }
+  ASSERT_EQ(rsEncode(data, encoded), OBC_GS_ERR_CODE_SUCCESS);
+
+  bool corrupted[RS_ENCODED_SIZE] = {false};
+  for (uint8_t i = 0; i < numErasures + numErrors; ++i) {
+    uint8_t pos;
+    do {
+      *seed = (*seed * 1103515245 + 12345) % (1U << 31);
+      pos = (uint8_t)((*seed >> 8) % RS_ENCODED_SIZE);
+    } while (corrupted[pos]);
+    corrupted[pos] = true;
+    encoded->data[pos] ^= (uint8_t)((*seed >> 16) | 1);
+    if (i < numErasures) {
+      erasures[i] = pos;
+    }
+  }
+}
+
+TEST(TestFecErasures, ErasuresDoubleTheCorrectableBytes) {
+  obc_gs_fec_ctx_t ctx = {.rs = NULL};
+  ASSERT_EQ(rsInitCtx(&ctx), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint32_t seed = 0x2D7F05;  // random number
+  for (uint16_t trial = 0; trial < 300; ++trial) {
+    // Every split of the 32 parity bytes between erasures and errors, 2 * errors + erasures = 32
+    uint8_t numErrors = trial % 17;
+    uint8_t numErasures = RS_PARITY_SIZE - 2 * numErrors;
+
+    uint8_t data[RS_DECODED_SIZE];
+    packed_rs_packet_t encoded;
+    uint8_t erasures[RS_PARITY_SIZE];
+    makeErasedBlock(&seed, data, &encoded, erasures, numErasures, numErrors);
+
+    uint8_t decoded[RS_DECODED_SIZE];
+    ASSERT_EQ(rsDecodeWithErasures(&ctx, &encoded, erasures, numErasures, decoded, RS_DECODED_SIZE),
+              OBC_GS_ERR_CODE_SUCCESS);
+    ASSERT_EQ(memcmp(decoded, data, RS_DECODED_SIZE), 0);
+
+    // More than 16 corrupted bytes is past what decoding without erasures can do
+    if (numErasures + numErrors > RS_PARITY_SIZE / 2) {
+      packed_rs_packet_t copy = encoded;
+      obc_gs_error_code_t errCode = rsDecodeWithCtx(&ctx, &copy, decoded, RS_DECODED_SIZE);
+      ASSERT_TRUE(errCode != OBC_GS_ERR_CODE_SUCCESS || memcmp(decoded, data, RS_DECODED_SIZE) != 0);
+    }
+  }
+
+  rsDestroyCtx(&ctx);
+}
+
+TEST(TestFecErasures, ErasureDecodeDoesNotAllocate) {
+  obc_gs_fec_ctx_t ctx = {.rs = NULL};
+  size_t allocationsBefore = mockHeapAllocations;
+  ASSERT_EQ(rsInitCtx(&ctx), OBC_GS_ERR_CODE_SUCCESS);
+
+  uint32_t seed = 0x6E1B93;  // random number
+  for (uint16_t trial = 0; trial < 100; ++trial) {
+    uint8_t numErasures = 1 + trial % RS_PARITY_SIZE;
+    uint8_t numErrors = (RS_PARITY_SIZE - numErasures) / 2;
+
+    uint8_t data[RS_DECODED_SIZE];
+    packed_rs_packet_t encoded;
+    uint8_t erasures[RS_PARITY_SIZE];
+    makeErasedBlock(&seed, data, &encoded, erasures, numErasures, numErrors);
+
+    uint8_t decoded[RS_DECODED_SIZE];
+    ASSERT_EQ(rsDecodeWithErasures(&ctx, &encoded, erasures, numErasures, decoded, RS_DECODED_SIZE),
+              OBC_GS_ERR_CODE_SUCCESS);
+  }
+
+  EXPECT_EQ(mockHeapAllocations, allocationsBefore);
+  rsDestroyCtx(&ctx);
+}
+
+TEST(TestFecErasures, ErasureDecodeInvalidArgs) {
+  obc_gs_fec_ctx_t ctx = {.rs = NULL};
+  packed_rs_packet_t encoded = {0};
+  uint8_t decoded[RS_DECODED_SIZE];
+  uint8_t erasures[RS_PARITY_SIZE + 1] = {0};
+  for (uint8_t i = 0; i < sizeof(erasures); ++i) {
+    erasures[i] = i;
+  }
+
+  // Not initialized yet
+  EXPECT_EQ(rsDecodeWithErasures(&ctx, &encoded, erasures, 1, decoded, RS_DECODED_SIZE), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  ASSERT_EQ(rsInitCtx(&ctx), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(rsDecodeWithErasures(&ctx, &encoded, NULL, 1, decoded, RS_DECODED_SIZE), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsDecodeWithErasures(&ctx, &encoded, erasures, 1, decoded, RS_DECODED_SIZE - 1),
+            OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsDecodeWithErasures(&ctx, &encoded, erasures, RS_PARITY_SIZE + 1, decoded, RS_DECODED_SIZE),
+            OBC_GS_ERR_CODE_INVALID_ARG);
+
+  uint8_t repeated[] = {3, 9, 3};
+  EXPECT_EQ(rsDecodeWithErasures(&ctx, &encoded, repeated, sizeof(repeated), decoded, RS_DECODED_SIZE),
+            OBC_GS_ERR_CODE_INVALID_ARG);
+  uint8_t outOfRange[] = {RS_ENCODED_SIZE};
+  EXPECT_EQ(rsDecodeWithErasures(&ctx, &encoded, outOfRange, 1, decoded, RS_DECODED_SIZE),
+            OBC_GS_ERR_CODE_INVALID_ARG);
+
+  // No erasures is plain decoding, and the positions aren't looked at
+  EXPECT_EQ(rsDecodeWithErasures(&ctx, &encoded, NULL, 0, decoded, RS_DECODED_SIZE), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(rsDecodeWithErasures(&ctx, &encoded, erasures, RS_PARITY_SIZE, decoded, RS_DECODED_SIZE),
+            OBC_GS_ERR_CODE_SUCCESS);
+  rsDestroyCtx(&ctx);
+}
+
+// Encodes numBlocks random blocks with rsEncodeBatch and corrupts every fifth one past what can be corrected
+static void makeBatch(packed_telem_packet_t *telem, packed_rs_packet_t *encoded, size_t numBlocks) {
+  uint32_t seed = 0x19D4E7;  // random number
+  for (size_t block = 0; block < numBlocks; ++block) {
+    for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+      seed = (seed * 1103515245 + 12345) % (1U << 31);
+      telem[block].data[i] = (uint8_t)(seed >> 16);
+    }
+  }
+
+  obc_gs_error_code_t status[numBlocks];
+  ASSERT_EQ(rsEncodeBatch(telem, encoded, numBlocks, status), OBC_GS_ERR_CODE_SUCCESS);
+
+  for (size_t block = 0; block < numBlocks; ++block) {
+    ASSERT_EQ(status[block], OBC_GS_ERR_CODE_SUCCESS);
+    packed_rs_packet_t single;
+    ASSERT_EQ(rsEncode(telem[block].data, &single), OBC_GS_ERR_CODE_SUCCESS);
+    ASSERT_EQ(memcmp(single.data, encoded[block].data, RS_ENCODED_SIZE), 0);
+
+    uint8_t numErrors = (block % 5 == 4) ? 40 : block % 17;
+    for (uint8_t i = 0; i < numErrors; ++i) {
+      encoded[block].data[(i * 13 + block) % RS_ENCODED_SIZE] ^= 0xA5;
+    }
+  }
+}
+
+static void checkDecodeBatch(const packed_telem_packet_t *telem, const packed_rs_packet_t *encoded, size_t numBlocks) {
+  packed_telem_packet_t decoded[numBlocks];
+  obc_gs_error_code_t status[numBlocks];
+  bool anyFailed = false;
+  obc_gs_error_code_t batchStatus = rsDecodeBatch(encoded, decoded, numBlocks, status);
+
+  for (size_t block = 0; block < numBlocks; ++block) {
+    packed_rs_packet_t single = encoded[block];
+    uint8_t singleDecoded[RS_DECODED_SIZE];
+    obc_gs_error_code_t singleStatus = rsDecode(&single, singleDecoded, RS_DECODED_SIZE);
+
+    ASSERT_EQ(status[block], singleStatus);
+    if (singleStatus == OBC_GS_ERR_CODE_SUCCESS) {
+      ASSERT_EQ(memcmp(decoded[block].data, telem[block].data, RS_DECODED_SIZE), 0);
+    } else {
+      anyFailed = true;
+    }
+  }
+  EXPECT_EQ(batchStatus, anyFailed ? OBC_GS_ERR_CODE_REED_SOL_DEC_ERR : OBC_GS_ERR_CODE_SUCCESS);
+}
+
+TEST(TestFecBatch, BatchMatchesSingleBlockCalls) {
+  const size_t numBlocks = 203;
+  static packed_telem_packet_t telem[numBlocks];
+  static packed_rs_packet_t encoded[numBlocks];
+  initRs();
+  makeBatch(telem, encoded, numBlocks);
+  checkDecodeBatch(telem, encoded, numBlocks);
+
+  // A batch with no failing blocks reports success
+  checkDecodeBatch(telem, encoded, 4);
+  destroyRs();
+}
+
+TEST(TestFecBatch, BatchInvalidArgs) {
+  packed_telem_packet_t telem = {0};
+  packed_rs_packet_t encoded = {0};
+  obc_gs_error_code_t status;
+
+  // The default context isn't initialized lazily
+  EXPECT_EQ(rsDecodeBatch(&encoded, &telem, 0, &status), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  initRs();
+  EXPECT_EQ(rsEncodeBatch(NULL, &encoded, 1, &status), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsEncodeBatch(&telem, NULL, 1, &status), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsEncodeBatch(&telem, &encoded, 1, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsDecodeBatch(NULL, &telem, 1, &status), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsDecodeBatch(&encoded, NULL, 1, &status), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsDecodeBatch(&encoded, &telem, 1, NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsDecodeBatch(&encoded, &telem, 0, &status), OBC_GS_ERR_CODE_SUCCESS);
+  destroyRs();
+}
+
+#ifdef OBC_GS_FEC_THREAD_POOL
+TEST(TestFecBatch, BatchOnWorkerPoolMatchesSingleBlockCalls) {
+  const size_t numBlocks = 1001;
+  static packed_telem_packet_t telem[numBlocks];
+  static packed_rs_packet_t encoded[numBlocks];
+  initRs();
+
+  EXPECT_EQ(rsBatchStartWorkers(0), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsBatchStartWorkers(RS_BATCH_MAX_WORKERS + 1), OBC_GS_ERR_CODE_INVALID_ARG);
+  ASSERT_EQ(rsBatchStartWorkers(4), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(rsBatchStartWorkers(4), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  // Run a few batches back to back on the same workers
+  for (uint8_t run = 0; run < 3; ++run) {
+    makeBatch(telem, encoded, numBlocks);
+    checkDecodeBatch(telem, encoded, numBlocks);
+  }
+
+  rsBatchStopWorkers();
+  // The pool can be restarted with a different size
+  ASSERT_EQ(rsBatchStartWorkers(2), OBC_GS_ERR_CODE_SUCCESS);
+  checkDecodeBatch(telem, encoded, numBlocks);
+  rsBatchStopWorkers();
+  destroyRs();
+}
+#endif
+
+TEST(TestFecBatch, ConcurrentBatchesWithSeparateCtxs) {
+  const size_t numBlocks = 203;
+  static packed_telem_packet_t telem[numBlocks];
+  static packed_rs_packet_t encoded[numBlocks];
+  static obc_gs_error_code_t expectedStatus[numBlocks];
+  initRs();
+  makeBatch(telem, encoded, numBlocks);
+  for (size_t block = 0; block < numBlocks; ++block) {
+    packed_rs_packet_t single = encoded[block];
+    uint8_t singleDecoded[RS_DECODED_SIZE];
+    expectedStatus[block] = rsDecode(&single, singleDecoded, RS_DECODED_SIZE);
+  }
+  destroyRs();
+
+#ifdef OBC_GS_FEC_THREAD_POOL
+  // Only one of the batches at a time gets the workers, the others run on their calling threads
+  ASSERT_EQ(rsBatchStartWorkers(2), OBC_GS_ERR_CODE_SUCCESS);
+#endif
+
+  // Each thread decodes the same batch on its own context
+  const uint8_t numThreads = 4;
+  std::vector<std::thread> threads;
+  bool matched[numThreads] = {false};
+  for (uint8_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&matched, t, numBlocks]() {
+      obc_gs_fec_ctx_t ctx;
+      if (rsInitCtx(&ctx) != OBC_GS_ERR_CODE_SUCCESS) return;
+
+      std::vector<packed_telem_packet_t> decoded(numBlocks);
+      std::vector<obc_gs_error_code_t> status(numBlocks);
+      matched[t] = true;
+      for (uint8_t run = 0; run < 5; ++run) {
+        rsDecodeBatchWithCtx(&ctx, encoded, decoded.data(), numBlocks, status.data());
+        for (size_t block = 0; block < numBlocks; ++block) {
+          if (status[block] != expectedStatus[block] ||
+              (status[block] == OBC_GS_ERR_CODE_SUCCESS &&
+               memcmp(decoded[block].data, telem[block].data, RS_DECODED_SIZE) != 0)) {
+            matched[t] = false;
+          }
+        }
+      }
+      rsDestroyCtx(&ctx);
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+#ifdef OBC_GS_FEC_THREAD_POOL
+  rsBatchStopWorkers();
+#endif
+
+  for (uint8_t t = 0; t < numThreads; ++t) {
+    EXPECT_TRUE(matched[t]);
+  }
+
+  // The decoder has to be set up, but encoding doesn't use it
+  obc_gs_fec_ctx_t ctx = {.rs = NULL};
+  obc_gs_error_code_t status;
+  EXPECT_EQ(rsDecodeBatchWithCtx(&ctx, encoded, telem, 1, &status), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsDecodeBatchWithCtx(NULL, encoded, telem, 1, &status), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsEncodeBatchWithCtx(NULL, telem, encoded, 1, &status), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsEncodeBatchWithCtx(&ctx, telem, encoded, 1, &status), OBC_GS_ERR_CODE_SUCCESS);
+}
+
+TEST(TestFecCtx, CtxInvalidArgs) {
+  obc_gs_fec_ctx_t ctx = {.rs = NULL};
+  packed_rs_packet_t encoded = {0};
+  uint8_t decoded[RS_DECODED_SIZE];
+  EXPECT_EQ(rsInitCtx(NULL), OBC_GS_ERR_CODE_INVALID_ARG);
+  EXPECT_EQ(rsDecodeWithCtx(NULL, &encoded, decoded, RS_DECODED_SIZE), OBC_GS_ERR_CODE_INVALID_ARG);
+  // Not initialized yet
+  EXPECT_EQ(rsDecodeWithCtx(&ctx, &encoded, decoded, RS_DECODED_SIZE), OBC_GS_ERR_CODE_INVALID_ARG);
+
+  ASSERT_EQ(rsInitCtx(&ctx), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(rsDecodeWithCtx(&ctx, &encoded, decoded, RS_DECODED_SIZE), OBC_GS_ERR_CODE_SUCCESS);
+  rsDestroyCtx(&ctx);
+  EXPECT_EQ(ctx.rs, nullptr);
+  rsDestroyCtx(&ctx);
+}
+
+TEST(TestFecCtx, ConcurrentDecodeWithSeparateCtxs) {
+  // Each thread decodes its own stream of corrupted blocks on its own context
+  const uint8_t numThreads = 4;
+  std::vector<std::thread> threads;
+  bool matched[numThreads] = {false};
+  for (uint8_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&matched, t]() {
+      obc_gs_fec_ctx_t ctx;
+      if (rsInitCtx(&ctx) != OBC_GS_ERR_CODE_SUCCESS) return;
+
+      uint32_t seed = 0x3F1A + t;  // random number
+      matched[t] = true;
+      for (uint16_t block = 0; block < 300; ++block) {
+        uint8_t data[RS_DECODED_SIZE];
+        for (uint16_t i = 0; i < RS_DECODED_SIZE; ++i) {
+          seed = (seed * 1103515245 + 12345) % (1U << 31);
+          data[i] = (uint8_t)(seed >> 16);
+        }
+        packed_rs_packet_t encoded;
+        rsEncode(data, &encoded);
+        for (uint8_t i = 0; i < block % 17; ++i) {
+          encoded.data[(i * 29 + block) % RS_ENCODED_SIZE] ^= 0x3C;
+        }
+
+        uint8_t decoded[RS_DECODED_SIZE];
+        if (rsDecodeWithCtx(&ctx, &encoded, decoded, RS_DECODED_SIZE) != OBC_GS_ERR_CODE_SUCCESS ||
+            memcmp(decoded, data, RS_DECODED_SIZE) != 0) {
+          matched[t] = false;
+        }
+      }
+      rsDestroyCtx(&ctx);
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  for (uint8_t t = 0; t < numThreads; ++t) {
+    EXPECT_TRUE(matched[t]);
+  }
+}
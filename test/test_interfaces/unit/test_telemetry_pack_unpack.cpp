@@ -2,10 +2,30 @@
 #include "obc_gs_telemetry_unpack.h"
 #include "obc_gs_telemetry_id.h"
 #include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_schema.h"
 #include "obc_gs_errors.h"
+#include "obc_gs_fec.h"
+
+#include <cmath>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+static std::vector<telemetry_data_t> unpackPacket(const uint8_t *buffer, size_t len) {
+  telemetry_packet_reader_t reader;
+  EXPECT_EQ(initTelemetryPacketReader(&reader, buffer, len), OBC_GS_ERR_CODE_SUCCESS);
+
+  std::vector<telemetry_data_t> unpacked;
+  telemetry_data_t data;
+  obc_gs_error_code_t err;
+  while ((err = unpackNextTelemetryFromPacket(&reader, &data)) == OBC_GS_ERR_CODE_SUCCESS) {
+    unpacked.push_back(data);
+  }
+  EXPECT_EQ(err, OBC_GS_ERR_CODE_END_OF_PACKET);
+
+  return unpacked;
+}
+
 TEST(TestTelemetryPackUnpack, ValidTelemObcTempPackUnpack) {
   obc_gs_error_code_t err;
 
@@ -78,3 +98,157 @@ TEST(TestTelemetryPackUnpack, ValidTelemPongPackUnpack) {
   EXPECT_EQ(data.id, unpackedData.id);
   EXPECT_EQ(data.timestamp, unpackedData.timestamp);
 }
+
+TEST(TestTelemetryPackUnpack, PacketRoundTrip) {
+  uint8_t buffer[PACKED_TELEM_PACKET_SIZE];
+  telemetry_packet_builder_t builder;
+  ASSERT_EQ(initTelemetryPacket(&builder, buffer, sizeof(buffer)), OBC_GS_ERR_CODE_SUCCESS);
+
+  std::vector<telemetry_data_t> packed;
+  telemetry_data_t data = {0};
+
+  // Timestamps go back as well as forward, as when newer blocks of a file are sent first
+  data.id = TELEM_OBC_TEMP;
+  data.timestamp = 1700000000;
+  data.obcTemp = 25.37f;
+  packed.push_back(data);
+  data.timestamp = 1700000010;
+  data.obcTemp = -4.5f;
+  packed.push_back(data);
+  data.id = TELEM_EPS_COMMS_5V_VOLTAGE;
+  data.timestamp = 1699990000;
+  data.epsComms5vVoltage = 5.012f;
+  packed.push_back(data);
+  data = telemetry_data_t{};
+  data.id = TELEM_OBC_STATE;
+  data.timestamp = 1700000020;
+  data.obcState = 3;
+  packed.push_back(data);
+  data.id = TELEM_NUM_CSP_PACKETS_RCVD;
+  data.numCspPacketsRcvd = 123456;
+  packed.push_back(data);
+  data = telemetry_data_t{};
+  data.id = TELEM_PONG;
+  data.timestamp = 1700000021;
+  packed.push_back(data);
+
+  for (const telemetry_data_t &sample : packed) {
+    ASSERT_EQ(addTelemetryToPacket(&builder, &sample), OBC_GS_ERR_CODE_SUCCESS);
+  }
+  EXPECT_EQ(builder.numSamples, packed.size());
+
+  std::vector<telemetry_data_t> unpacked = unpackPacket(buffer, sizeof(buffer));
+  ASSERT_EQ(unpacked.size(), packed.size());
+  for (size_t i = 0; i < packed.size(); ++i) {
+    EXPECT_EQ(unpacked[i].id, packed[i].id);
+    EXPECT_EQ(unpacked[i].timestamp, packed[i].timestamp);
+  }
+  EXPECT_NEAR(unpacked[0].obcTemp, 25.37f, 0.005f);
+  EXPECT_NEAR(unpacked[1].obcTemp, -4.5f, 0.005f);
+  EXPECT_NEAR(unpacked[2].epsComms5vVoltage, 5.012f, 0.0005f);
+  EXPECT_EQ(unpacked[3].obcState, 3);
+  EXPECT_EQ(unpacked[4].numCspPacketsRcvd, 123456U);
+}
+
+TEST(TestTelemetryPackUnpack, PacketFitsManyMoreSamples) {
+  uint8_t buffer[PACKED_TELEM_PACKET_SIZE];
+  telemetry_packet_builder_t builder;
+  ASSERT_EQ(initTelemetryPacket(&builder, buffer, sizeof(buffer)), OBC_GS_ERR_CODE_SUCCESS);
+
+  // Slowly changing temperatures sampled every few seconds
+  telemetry_data_t data = {0};
+  data.id = TELEM_OBC_TEMP;
+  data.timestamp = 1700000000;
+  data.obcTemp = 20.0f;
+  while (addTelemetryToPacket(&builder, &data) == OBC_GS_ERR_CODE_SUCCESS) {
+    data.timestamp += 5;
+    data.obcTemp += 0.13f;
+  }
+
+  // A full packet is left as it was
+  size_t len = builder.len;
+  uint32_t numSamples = builder.numSamples;
+  EXPECT_EQ(addTelemetryToPacket(&builder, &data), OBC_GS_ERR_CODE_BUFF_TOO_SMALL);
+  EXPECT_EQ(builder.len, len);
+  EXPECT_EQ(builder.numSamples, numSamples);
+
+  // Each sample takes 9B one at a time with packTelemetry
+  EXPECT_GE(numSamples, 3 * (PACKED_TELEM_PACKET_SIZE / 9));
+
+  std::vector<telemetry_data_t> unpacked = unpackPacket(buffer, sizeof(buffer));
+  ASSERT_EQ(unpacked.size(), numSamples);
+  EXPECT_EQ(unpacked.back().timestamp, data.timestamp - 5);
+  EXPECT_NEAR(unpacked.back().obcTemp, data.obcTemp - 0.13f, 0.01f);
+}
+
+TEST(TestTelemetryPackUnpack, PacketRunLengthCodesStates) {
+  uint8_t buffer[PACKED_TELEM_PACKET_SIZE];
+  telemetry_packet_builder_t builder;
+  ASSERT_EQ(initTelemetryPacket(&builder, buffer, sizeof(buffer)), OBC_GS_ERR_CODE_SUCCESS);
+
+  telemetry_data_t data = {0};
+  data.id = TELEM_OBC_STATE;
+  data.timestamp = 1700000000;
+  data.obcState = 2;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(addTelemetryToPacket(&builder, &data), OBC_GS_ERR_CODE_SUCCESS);
+    data.timestamp += 60;
+  }
+
+  // A change of value or interval starts a new record
+  data.obcState = 4;
+  ASSERT_EQ(addTelemetryToPacket(&builder, &data), OBC_GS_ERR_CODE_SUCCESS);
+  data.timestamp += 7;
+  ASSERT_EQ(addTelemetryToPacket(&builder, &data), OBC_GS_ERR_CODE_SUCCESS);
+  data.timestamp += 9;
+  ASSERT_EQ(addTelemetryToPacket(&builder, &data), OBC_GS_ERR_CODE_SUCCESS);
+
+  EXPECT_LT(builder.len, 32U);
+
+  std::vector<telemetry_data_t> unpacked = unpackPacket(buffer, sizeof(buffer));
+  ASSERT_EQ(unpacked.size(), 1003U);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(unpacked[i].id, TELEM_OBC_STATE);
+    EXPECT_EQ(unpacked[i].obcState, 2);
+    EXPECT_EQ(unpacked[i].timestamp, 1700000000U + 60U * i);
+  }
+  EXPECT_EQ(unpacked[1000].obcState, 4);
+  EXPECT_EQ(unpacked[1000].timestamp, 1700060000U);
+  EXPECT_EQ(unpacked[1002].timestamp, 1700060016U);
+}
+
+TEST(TestTelemetryPackUnpack, PacketSendsUnquantisableValuesRaw) {
+  uint8_t buffer[PACKED_TELEM_PACKET_SIZE];
+  telemetry_packet_builder_t builder;
+  ASSERT_EQ(initTelemetryPacket(&builder, buffer, sizeof(buffer)), OBC_GS_ERR_CODE_SUCCESS);
+
+  telemetry_data_t data = {0};
+  data.id = TELEM_OBC_TEMP;
+  data.timestamp = 1700000000;
+  data.obcTemp = 1.0e20f;
+  ASSERT_EQ(addTelemetryToPacket(&builder, &data), OBC_GS_ERR_CODE_SUCCESS);
+  data.obcTemp = NAN;
+  ASSERT_EQ(addTelemetryToPacket(&builder, &data), OBC_GS_ERR_CODE_SUCCESS);
+  data.obcTemp = 30.0f;
+  ASSERT_EQ(addTelemetryToPacket(&builder, &data), OBC_GS_ERR_CODE_SUCCESS);
+
+  std::vector<telemetry_data_t> unpacked = unpackPacket(buffer, sizeof(buffer));
+  ASSERT_EQ(unpacked.size(), 3U);
+  EXPECT_EQ(unpacked[0].obcTemp, 1.0e20f);
+  EXPECT_TRUE(std::isnan(unpacked[1].obcTemp));
+  EXPECT_NEAR(unpacked[2].obcTemp, 30.0f, 0.005f);
+}
+
+TEST(TestTelemetryPackUnpack, PacketRejectsCorruptedRecords) {
+  // A timestamp delta that runs off the end of the packet
+  uint8_t truncated[] = {0x65, 0x53, 0xF1, 0x00, TELEM_OBC_TEMP, 0x80, 0x80};
+  telemetry_packet_reader_t reader;
+  ASSERT_EQ(initTelemetryPacketReader(&reader, truncated, sizeof(truncated)), OBC_GS_ERR_CODE_SUCCESS);
+  telemetry_data_t data;
+  EXPECT_EQ(unpackNextTelemetryFromPacket(&reader, &data), OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET);
+
+  // Only states can be run-length coded
+  uint8_t badFlags[] = {0x65, 0x53, 0xF1, 0x00, TELEM_OBC_TEMP | TELEM_RECORD_FLAG_RUN, 0x00, 0x00, 0x01, 0x01};
+  ASSERT_EQ(initTelemetryPacketReader(&reader, badFlags, sizeof(badFlags)), OBC_GS_ERR_CODE_SUCCESS);
+  EXPECT_EQ(unpackNextTelemetryFromPacket(&reader, &data), OBC_GS_ERR_CODE_CORRUPTED_TELEM_PACKET);
+}
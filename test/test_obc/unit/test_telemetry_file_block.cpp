@@ -0,0 +1,138 @@
+#include "telemetry_file_block.h"
+#include "obc_errors.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+static telemetry_data_t makeObcTemp(float temp, uint32_t timestamp) {
+  telemetry_data_t data = {0};
+  data.id = TELEM_OBC_TEMP;
+  data.obcTemp = temp;
+  data.timestamp = timestamp;
+  return data;
+}
+
+static void readBack(const telemetry_block_builder_t *builder, telemetry_block_reader_t *reader) {
+  ASSERT_EQ(serializeTelemetryBlock(builder, reader->block), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(startTelemetryBlock(reader), OBC_ERR_CODE_SUCCESS);
+}
+
+TEST(TestTelemetryFileBlock, RoundTripFloats) {
+  // Deltas that take 1, 2 and 5 bytes to encode
+  const uint32_t timestamps[] = {1700000000, 1700000000, 1700000010, 1700000300, 1700000300 + 0x90000000};
+
+  telemetry_block_builder_t builder;
+  ASSERT_EQ(initTelemetryBlock(&builder, TELEM_OBC_TEMP), OBC_ERR_CODE_SUCCESS);
+  for (size_t i = 0; i < sizeof(timestamps) / sizeof(timestamps[0]); ++i) {
+    telemetry_data_t data = makeObcTemp(20.5f + i, timestamps[i]);
+    ASSERT_EQ(addToTelemetryBlock(&builder, &data), OBC_ERR_CODE_SUCCESS);
+  }
+
+  telemetry_block_reader_t reader;
+  readBack(&builder, &reader);
+
+  for (size_t i = 0; i < sizeof(timestamps) / sizeof(timestamps[0]); ++i) {
+    telemetry_data_t data;
+    ASSERT_EQ(readNextTelemetryFromBlock(&reader, &data), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(data.id, TELEM_OBC_TEMP);
+    EXPECT_EQ(data.timestamp, timestamps[i]);
+    EXPECT_FLOAT_EQ(data.obcTemp, 20.5f + i);
+  }
+
+  telemetry_data_t data;
+  EXPECT_EQ(readNextTelemetryFromBlock(&reader, &data), OBC_ERR_CODE_REACHED_EOF);
+}
+
+TEST(TestTelemetryFileBlock, RoundTripStates) {
+  telemetry_block_builder_t builder;
+  ASSERT_EQ(initTelemetryBlock(&builder, TELEM_OBC_STATE), OBC_ERR_CODE_SUCCESS);
+  for (uint8_t i = 0; i < 10; ++i) {
+    telemetry_data_t data = {0};
+    data.id = TELEM_OBC_STATE;
+    data.obcState = i;
+    data.timestamp = 1000 + i;
+    ASSERT_EQ(addToTelemetryBlock(&builder, &data), OBC_ERR_CODE_SUCCESS);
+  }
+
+  // A 1 byte value and a 1 byte delta per data point after the first
+  EXPECT_EQ(builder.valuesLen + builder.timestampDeltasLen, 10U + 9U);
+
+  telemetry_block_reader_t reader;
+  readBack(&builder, &reader);
+
+  for (uint8_t i = 0; i < 10; ++i) {
+    telemetry_data_t data;
+    ASSERT_EQ(readNextTelemetryFromBlock(&reader, &data), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(data.id, TELEM_OBC_STATE);
+    EXPECT_EQ(data.obcState, i);
+    EXPECT_EQ(data.timestamp, 1000U + i);
+  }
+}
+
+TEST(TestTelemetryFileBlock, FillsBlock) {
+  telemetry_block_builder_t builder;
+  ASSERT_EQ(initTelemetryBlock(&builder, TELEM_OBC_TEMP), OBC_ERR_CODE_SUCCESS);
+
+  // Each data point after the first takes a 4 byte value and a 1 byte delta
+  const size_t expectedSamples = 1 + (TELEMETRY_FILE_BLOCK_SIZE - TELEMETRY_FILE_BLOCK_HEADER_SIZE - 4) / 5;
+
+  uint32_t timestamp = 1700000000;
+  for (size_t i = 0; i < expectedSamples; ++i) {
+    telemetry_data_t data = makeObcTemp(1.0f, timestamp++);
+    ASSERT_EQ(addToTelemetryBlock(&builder, &data), OBC_ERR_CODE_SUCCESS);
+  }
+
+  telemetry_data_t data = makeObcTemp(1.0f, timestamp);
+  EXPECT_EQ(addToTelemetryBlock(&builder, &data), OBC_ERR_CODE_BUFF_TOO_SMALL);
+  EXPECT_EQ(builder.numSamples, expectedSamples);
+}
+
+TEST(TestTelemetryFileBlock, RejectsOlderTimestamp) {
+  telemetry_block_builder_t builder;
+  ASSERT_EQ(initTelemetryBlock(&builder, TELEM_OBC_TEMP), OBC_ERR_CODE_SUCCESS);
+
+  telemetry_data_t data = makeObcTemp(1.0f, 2000);
+  ASSERT_EQ(addToTelemetryBlock(&builder, &data), OBC_ERR_CODE_SUCCESS);
+
+  data = makeObcTemp(1.0f, 1999);
+  EXPECT_EQ(addToTelemetryBlock(&builder, &data), OBC_ERR_CODE_BUFF_TOO_SMALL);
+}
+
+TEST(TestTelemetryFileBlock, RejectsMismatchedId) {
+  telemetry_block_builder_t builder;
+  ASSERT_EQ(initTelemetryBlock(&builder, TELEM_OBC_TEMP), OBC_ERR_CODE_SUCCESS);
+
+  telemetry_data_t data = {0};
+  data.id = TELEM_OBC_STATE;
+  EXPECT_EQ(addToTelemetryBlock(&builder, &data), OBC_ERR_CODE_INVALID_ARG);
+}
+
+TEST(TestTelemetryFileBlock, RejectsInvalidBlock) {
+  telemetry_block_reader_t reader = {0};
+
+  // Padding, or a block that was never written
+  EXPECT_EQ(startTelemetryBlock(&reader), OBC_ERR_CODE_FAILED_FILE_READ);
+
+  // Values that run past the end of the block
+  reader.block[0] = TELEM_OBC_TEMP;
+  reader.block[1] = TELEMETRY_FILE_BLOCK_SIZE / 4;
+  EXPECT_EQ(startTelemetryBlock(&reader), OBC_ERR_CODE_FAILED_FILE_READ);
+}
+
+TEST(TestTelemetryFileBlock, RejectsTruncatedDelta) {
+  telemetry_block_reader_t reader = {0};
+  reader.block[0] = TELEM_OBC_STATE;
+  reader.block[1] = 2;
+
+  // The second data point's delta never ends
+  memset(&reader.block[TELEMETRY_FILE_BLOCK_HEADER_SIZE + 2], 0xFF,
+         TELEMETRY_FILE_BLOCK_SIZE - TELEMETRY_FILE_BLOCK_HEADER_SIZE - 2);
+  ASSERT_EQ(startTelemetryBlock(&reader), OBC_ERR_CODE_SUCCESS);
+
+  telemetry_data_t data;
+  ASSERT_EQ(readNextTelemetryFromBlock(&reader, &data), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(readNextTelemetryFromBlock(&reader, &data), OBC_ERR_CODE_FAILED_FILE_READ);
+}
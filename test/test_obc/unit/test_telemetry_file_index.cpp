@@ -0,0 +1,146 @@
+#include "telemetry_file_index.h"
+#include "telemetry_file_block.h"
+#include "obc_errors.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
+
+#include <gtest/gtest.h>
+
+static void addBlock(telemetry_file_index_t *index, telemetry_data_id_t id, uint32_t firstTimestamp,
+                     uint8_t numSamples) {
+  telemetry_block_builder_t builder;
+  ASSERT_EQ(initTelemetryBlock(&builder, id), OBC_ERR_CODE_SUCCESS);
+  for (uint8_t i = 0; i < numSamples; ++i) {
+    telemetry_data_t data = {0};
+    data.id = id;
+    data.timestamp = firstTimestamp + i;
+    ASSERT_EQ(addToTelemetryBlock(&builder, &data), OBC_ERR_CODE_SUCCESS);
+  }
+  ASSERT_EQ(addBlockToTelemetryFileIndex(index, &builder), OBC_ERR_CODE_SUCCESS);
+}
+
+static size_t trailerFileSize(const telemetry_file_index_t *index) {
+  return index->numBlocks * TELEMETRY_FILE_BLOCK_SIZE + index->numIndexedBlocks * TELEMETRY_FILE_INDEX_ENTRY_SIZE +
+         telemetryFileNumIdSummaries(index) * TELEMETRY_FILE_ID_SUMMARY_SIZE + TELEMETRY_FILE_FOOTER_SIZE;
+}
+
+TEST(TestTelemetryFileIndex, TracksBlocksAndIds) {
+  telemetry_file_index_t index;
+  ASSERT_EQ(initTelemetryFileIndex(&index), OBC_ERR_CODE_SUCCESS);
+
+  addBlock(&index, TELEM_OBC_TEMP, 1000, 10);
+  addBlock(&index, TELEM_OBC_STATE, 1005, 3);
+  addBlock(&index, TELEM_OBC_TEMP, 2000, 5);
+
+  EXPECT_EQ(index.numBlocks, 3U);
+  EXPECT_EQ(index.numIndexedBlocks, 3U);
+  const telemetry_block_index_entry_t *entry = getTelemetryBlockIndexEntry(&index, 2);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->id, TELEM_OBC_TEMP);
+  EXPECT_EQ(entry->firstTimestamp, 2000U);
+  EXPECT_EQ(entry->lastTimestamp, 2004U);
+  EXPECT_EQ(getTelemetryBlockIndexEntry(&index, 3), nullptr);
+
+  EXPECT_EQ(index.ids[TELEM_OBC_TEMP].numSamples, 15U);
+  EXPECT_EQ(index.ids[TELEM_OBC_TEMP].firstTimestamp, 1000U);
+  EXPECT_EQ(index.ids[TELEM_OBC_TEMP].lastTimestamp, 2004U);
+  EXPECT_EQ(telemetryFileNumIdSummaries(&index), 2U);
+}
+
+TEST(TestTelemetryFileIndex, KeepsNewestBlocksWhenFull) {
+  telemetry_file_index_t index;
+  ASSERT_EQ(initTelemetryFileIndex(&index), OBC_ERR_CODE_SUCCESS);
+
+  for (uint32_t i = 0; i < TELEMETRY_FILE_INDEX_MAX_BLOCKS + 2; ++i) {
+    addBlock(&index, TELEM_OBC_STATE, i * 10, 1);
+  }
+
+  EXPECT_EQ(index.numBlocks, TELEMETRY_FILE_INDEX_MAX_BLOCKS + 2);
+  EXPECT_EQ(index.numIndexedBlocks, TELEMETRY_FILE_INDEX_MAX_BLOCKS);
+  EXPECT_EQ(index.ids[TELEM_OBC_STATE].numSamples, TELEMETRY_FILE_INDEX_MAX_BLOCKS + 2);
+
+  EXPECT_EQ(getTelemetryBlockIndexEntry(&index, 0), nullptr);
+  EXPECT_EQ(getTelemetryBlockIndexEntry(&index, 1), nullptr);
+  for (uint32_t blockNum = 2; blockNum < index.numBlocks; ++blockNum) {
+    const telemetry_block_index_entry_t *entry = getTelemetryBlockIndexEntry(&index, blockNum);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->firstTimestamp, blockNum * 10);
+  }
+}
+
+TEST(TestTelemetryFileIndex, RoundTripTrailer) {
+  telemetry_file_index_t written;
+  ASSERT_EQ(initTelemetryFileIndex(&written), OBC_ERR_CODE_SUCCESS);
+  addBlock(&written, TELEM_OBC_TEMP, 1700000000, 20);
+  addBlock(&written, TELEM_OBC_STATE, 1700000010, 2);
+
+  uint8_t footer[TELEMETRY_FILE_FOOTER_SIZE];
+  serializeTelemetryFileFooter(&written, footer);
+
+  telemetry_file_index_t read;
+  uint8_t numIdSummaries;
+  ASSERT_EQ(parseTelemetryFileFooter(footer, trailerFileSize(&written), &read, &numIdSummaries), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(read.numBlocks, 2U);
+  EXPECT_EQ(read.numIndexedBlocks, 2U);
+  EXPECT_EQ(numIdSummaries, 2U);
+
+  for (uint16_t i = 0; i < written.numIndexedBlocks; ++i) {
+    const telemetry_block_index_entry_t *entry = getTelemetryBlockIndexEntry(&written, i);
+    uint8_t buffer[TELEMETRY_FILE_INDEX_ENTRY_SIZE];
+    serializeTelemetryIndexEntry(entry, buffer);
+    ASSERT_EQ(parseTelemetryIndexEntry(buffer, &read.blocks[i]), OBC_ERR_CODE_SUCCESS);
+    EXPECT_EQ(read.blocks[i].id, entry->id);
+    EXPECT_EQ(read.blocks[i].numSamples, entry->numSamples);
+    EXPECT_EQ(read.blocks[i].firstTimestamp, entry->firstTimestamp);
+    EXPECT_EQ(read.blocks[i].lastTimestamp, entry->lastTimestamp);
+  }
+  EXPECT_EQ(getTelemetryBlockIndexEntry(&read, 1), &read.blocks[1]);
+
+  uint8_t buffer[TELEMETRY_FILE_ID_SUMMARY_SIZE];
+  serializeTelemetryIdSummary(TELEM_OBC_TEMP, &written.ids[TELEM_OBC_TEMP], buffer);
+  ASSERT_EQ(parseTelemetryIdSummary(buffer, &read), OBC_ERR_CODE_SUCCESS);
+  EXPECT_EQ(read.ids[TELEM_OBC_TEMP].numSamples, 20U);
+  EXPECT_EQ(read.ids[TELEM_OBC_TEMP].firstTimestamp, 1700000000U);
+  EXPECT_EQ(read.ids[TELEM_OBC_TEMP].lastTimestamp, 1700000019U);
+}
+
+TEST(TestTelemetryFileIndex, RejectsFooterNotMatchingFile) {
+  telemetry_file_index_t index;
+  ASSERT_EQ(initTelemetryFileIndex(&index), OBC_ERR_CODE_SUCCESS);
+  addBlock(&index, TELEM_OBC_TEMP, 1000, 1);
+
+  uint8_t footer[TELEMETRY_FILE_FOOTER_SIZE];
+  serializeTelemetryFileFooter(&index, footer);
+
+  // A file that was written to after the trailer, or whose last block happens to end in the magic number
+  telemetry_file_index_t read;
+  uint8_t numIdSummaries;
+  EXPECT_EQ(parseTelemetryFileFooter(footer, trailerFileSize(&index) + TELEMETRY_FILE_BLOCK_SIZE, &read,
+                                     &numIdSummaries),
+            OBC_ERR_CODE_FAILED_FILE_READ);
+
+  footer[0] = 0;
+  EXPECT_EQ(parseTelemetryFileFooter(footer, trailerFileSize(&index), &read, &numIdSummaries),
+            OBC_ERR_CODE_FAILED_FILE_READ);
+}
+
+TEST(TestTelemetryFileIndex, MatchesQuery) {
+  telemetry_query_t query;
+  ASSERT_EQ(initTelemetryQueryAll(&query), OBC_ERR_CODE_SUCCESS);
+  EXPECT_TRUE(telemetryMatchesQuery(&query, TELEM_PONG, 0));
+
+  query.idMask = 1UL << TELEM_OBC_TEMP;
+  query.startTime = 100;
+  query.endTime = 200;
+  EXPECT_TRUE(telemetryMatchesQuery(&query, TELEM_OBC_TEMP, 100));
+  EXPECT_TRUE(telemetryMatchesQuery(&query, TELEM_OBC_TEMP, 200));
+  EXPECT_FALSE(telemetryMatchesQuery(&query, TELEM_OBC_TEMP, 201));
+  EXPECT_FALSE(telemetryMatchesQuery(&query, TELEM_OBC_STATE, 150));
+
+  // Blocks only have to overlap the time window
+  telemetry_block_index_entry_t entry = {TELEM_OBC_TEMP, 10, 50, 100};
+  EXPECT_TRUE(telemetryBlockMatchesQuery(&query, &entry));
+  entry.firstTimestamp = 201;
+  entry.lastTimestamp = 300;
+  EXPECT_FALSE(telemetryBlockMatchesQuery(&query, &entry));
+}
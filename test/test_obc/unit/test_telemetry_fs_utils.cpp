@@ -0,0 +1,152 @@
+#include "telemetry_fs_utils.h"
+#include "telemetry_file_block.h"
+#include "telemetry_file_index.h"
+#include "obc_reliance_fs.h"
+#include "obc_errors.h"
+#include "obc_gs_telemetry_data.h"
+#include "obc_gs_telemetry_id.h"
+
+#include <gtest/gtest.h>
+
+class TestTelemetryFsUtils : public ::testing::Test {
+ protected:
+  void SetUp() override { ASSERT_EQ(setupFileSystem(), OBC_ERR_CODE_SUCCESS); }
+
+  static bool isStoredId(uint8_t id) {
+    size_t valueSize;
+    return telemetryValueSize((telemetry_data_id_t)id, &valueSize) == OBC_ERR_CODE_SUCCESS;
+  }
+
+  // Open a finished batch file for reading
+  static void openForReading(uint32_t batchId, telemetry_file_reader_t *reader, int32_t *fileId) {
+    ASSERT_EQ(openTelemetryFileRO(batchId, fileId), OBC_ERR_CODE_SUCCESS);
+    ASSERT_EQ(initTelemetryFileReader(reader, &index, *fileId, NULL), OBC_ERR_CODE_SUCCESS);
+  }
+
+  static telemetry_file_index_t index;
+};
+
+telemetry_file_index_t TestTelemetryFsUtils::index;
+
+TEST_F(TestTelemetryFsUtils, TrailerWithEveryId) {
+  int32_t fileId;
+  static telemetry_file_writer_t writer;
+  ASSERT_EQ(createAndOpenTelemetryFileRW(0, &fileId), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(initTelemetryFileWriter(&writer, fileId), OBC_ERR_CODE_SUCCESS);
+
+  uint8_t numIds = 0;
+  for (uint8_t id = 0; id < TELEMETRY_NUM_IDS; ++id) {
+    if (!isStoredId(id)) {
+      continue;
+    }
+
+    telemetry_data_t data = telemetry_data_t{};
+    data.id = (telemetry_data_id_t)id;
+    data.timestamp = 1000U + id;
+    ASSERT_EQ(writeTelemetryToFile(&writer, &data), OBC_ERR_CODE_SUCCESS);
+    numIds++;
+  }
+
+  // The ID summaries take more than a block-sized chunk of the trailer
+  ASSERT_GT(numIds * TELEMETRY_FILE_ID_SUMMARY_SIZE, TELEMETRY_FILE_BLOCK_SIZE);
+
+  ASSERT_EQ(finishTelemetryFile(&writer), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(closeTelemetryFile(fileId), OBC_ERR_CODE_SUCCESS);
+
+  static telemetry_file_reader_t reader;
+  openForReading(0, &reader, &fileId);
+
+  ASSERT_TRUE(reader.index->hasIdSummaries);
+  EXPECT_EQ(reader.index->numBlocks, numIds);
+  for (uint8_t id = 0; id < TELEMETRY_NUM_IDS; ++id) {
+    if (!isStoredId(id)) {
+      continue;
+    }
+
+    EXPECT_EQ(reader.index->ids[id].numSamples, 1U);
+    EXPECT_EQ(reader.index->ids[id].firstTimestamp, 1000U + id);
+    EXPECT_EQ(reader.index->ids[id].lastTimestamp, 1000U + id);
+  }
+
+  uint8_t numRead = 0;
+  telemetry_data_t data;
+  while (readNextTelemetryFromFile(&reader, &data) == OBC_ERR_CODE_SUCCESS) {
+    EXPECT_EQ(data.timestamp, 1000U + data.id);
+    numRead++;
+  }
+  EXPECT_EQ(numRead, numIds);
+
+  ASSERT_EQ(closeTelemetryFile(fileId), OBC_ERR_CODE_SUCCESS);
+}
+
+TEST_F(TestTelemetryFsUtils, IndexesNewestBlocks) {
+  int32_t fileId;
+  static telemetry_file_writer_t writer;
+  ASSERT_EQ(createAndOpenTelemetryFileRW(0, &fileId), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(initTelemetryFileWriter(&writer, fileId), OBC_ERR_CODE_SUCCESS);
+
+  // Flushing after each sample gives it a block of its own
+  const uint32_t numBlocks = TELEMETRY_FILE_INDEX_MAX_BLOCKS + 10;
+  for (uint32_t i = 0; i < numBlocks; ++i) {
+    telemetry_data_t data = telemetry_data_t{};
+    data.id = TELEM_OBC_TEMP;
+    data.timestamp = i;
+    ASSERT_EQ(writeTelemetryToFile(&writer, &data), OBC_ERR_CODE_SUCCESS);
+    ASSERT_EQ(flushTelemetryFileWriter(&writer), OBC_ERR_CODE_SUCCESS);
+  }
+
+  ASSERT_EQ(finishTelemetryFile(&writer), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(closeTelemetryFile(fileId), OBC_ERR_CODE_SUCCESS);
+
+  static telemetry_file_reader_t reader;
+  openForReading(0, &reader, &fileId);
+
+  ASSERT_EQ(reader.index->numBlocks, numBlocks);
+  ASSERT_EQ(reader.index->numIndexedBlocks, TELEMETRY_FILE_INDEX_MAX_BLOCKS);
+  EXPECT_EQ(getTelemetryBlockIndexEntry(reader.index, numBlocks - TELEMETRY_FILE_INDEX_MAX_BLOCKS - 1), nullptr);
+  for (uint32_t blockNum = numBlocks - TELEMETRY_FILE_INDEX_MAX_BLOCKS; blockNum < numBlocks; ++blockNum) {
+    const telemetry_block_index_entry_t *entry = getTelemetryBlockIndexEntry(reader.index, blockNum);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->firstTimestamp, blockNum);
+  }
+
+  // Every block is still read, newest first
+  uint32_t numRead = 0;
+  telemetry_data_t data;
+  while (readNextTelemetryFromFile(&reader, &data) == OBC_ERR_CODE_SUCCESS) {
+    EXPECT_EQ(data.timestamp, numBlocks - 1 - numRead);
+    numRead++;
+  }
+  EXPECT_EQ(numRead, numBlocks);
+
+  ASSERT_EQ(closeTelemetryFile(fileId), OBC_ERR_CODE_SUCCESS);
+}
+
+TEST_F(TestTelemetryFsUtils, QueryNotDoneWhenFileIsBeforeStartTime) {
+  int32_t fileId;
+  static telemetry_file_writer_t writer;
+  ASSERT_EQ(createAndOpenTelemetryFileRW(0, &fileId), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(initTelemetryFileWriter(&writer, fileId), OBC_ERR_CODE_SUCCESS);
+  for (uint32_t timestamp = 100; timestamp <= 110; ++timestamp) {
+    telemetry_data_t data = telemetry_data_t{};
+    data.id = (timestamp % 2 == 0) ? TELEM_OBC_TEMP : TELEM_OBC_STATE;
+    data.timestamp = timestamp;
+    ASSERT_EQ(writeTelemetryToFile(&writer, &data), OBC_ERR_CODE_SUCCESS);
+  }
+  ASSERT_EQ(finishTelemetryFile(&writer), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(closeTelemetryFile(fileId), OBC_ERR_CODE_SUCCESS);
+
+  telemetry_query_t query;
+  ASSERT_EQ(initTelemetryQueryAll(&query), OBC_ERR_CODE_SUCCESS);
+  static telemetry_file_reader_t reader;
+
+  // Every data point is before the start time. The clock may have been set back since an earlier batch was written, so
+  // the earlier batches still have to be read
+  query.startTime = 111;
+  ASSERT_EQ(openTelemetryFileRO(0, &fileId), OBC_ERR_CODE_SUCCESS);
+  ASSERT_EQ(initTelemetryFileReader(&reader, &index, fileId, &query), OBC_ERR_CODE_SUCCESS);
+  telemetry_data_t data;
+  EXPECT_EQ(readNextTelemetryFromFile(&reader, &data), OBC_ERR_CODE_REACHED_EOF);
+  EXPECT_FALSE(isTelemetryFileQueryDone(&reader));
+  ASSERT_EQ(closeTelemetryFile(fileId), OBC_ERR_CODE_SUCCESS);
+}